@@ -0,0 +1,2 @@
+#!/bin/sh
+./replay cfg/replay.cfg "$@"
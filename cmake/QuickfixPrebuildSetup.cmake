@@ -11,7 +11,9 @@ COMMAND ${CMAKE_COMMAND} -E make_directory ${CMAKE_SOURCE_DIR}/include/
 COMMAND ${CMAKE_COMMAND} -E make_directory ${CMAKE_SOURCE_DIR}/include/quickfix
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Acceptor.h ${CMAKE_SOURCE_DIR}/include/quickfix/Acceptor.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Application.h ${CMAKE_SOURCE_DIR}/include/quickfix/Application.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/AsyncSender.h ${CMAKE_SOURCE_DIR}/include/quickfix/AsyncSender.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/AtomicCount.h ${CMAKE_SOURCE_DIR}/include/quickfix/AtomicCount.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/AutoResetEvent.h ${CMAKE_SOURCE_DIR}/include/quickfix/AutoResetEvent.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/config-all.h ${CMAKE_SOURCE_DIR}/include/quickfix/config-all.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/DatabaseConnectionID.h ${CMAKE_SOURCE_DIR}/include/quickfix/DatabaseConnectionID.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/DatabaseConnectionPool.h ${CMAKE_SOURCE_DIR}/include/quickfix/DatabaseConnectionPool.h
@@ -35,19 +37,26 @@ COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/FixFie
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/FixFields.h ${CMAKE_SOURCE_DIR}/include/quickfix/FixFields.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/FixValues.h ${CMAKE_SOURCE_DIR}/include/quickfix/FixValues.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/FlexLexer.h ${CMAKE_SOURCE_DIR}/include/quickfix/FlexLexer.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/FlushTimer.h ${CMAKE_SOURCE_DIR}/include/quickfix/FlushTimer.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Flyweight.h ${CMAKE_SOURCE_DIR}/include/quickfix/Flyweight.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Group.h ${CMAKE_SOURCE_DIR}/include/quickfix/Group.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/GroupView.h ${CMAKE_SOURCE_DIR}/include/quickfix/GroupView.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/HtmlBuilder.h ${CMAKE_SOURCE_DIR}/include/quickfix/HtmlBuilder.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/HttpConnection.h ${CMAKE_SOURCE_DIR}/include/quickfix/HttpConnection.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/HttpMessage.h ${CMAKE_SOURCE_DIR}/include/quickfix/HttpMessage.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/HttpParser.h ${CMAKE_SOURCE_DIR}/include/quickfix/HttpParser.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/HttpServer.h ${CMAKE_SOURCE_DIR}/include/quickfix/HttpServer.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/InboundPipeline.h ${CMAKE_SOURCE_DIR}/include/quickfix/InboundPipeline.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/index.h ${CMAKE_SOURCE_DIR}/include/quickfix/index.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Initiator.h ${CMAKE_SOURCE_DIR}/include/quickfix/Initiator.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/LatencyHistogram.h ${CMAKE_SOURCE_DIR}/include/quickfix/LatencyHistogram.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Log.h ${CMAKE_SOURCE_DIR}/include/quickfix/Log.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/MarketDataColumns.h ${CMAKE_SOURCE_DIR}/include/quickfix/MarketDataColumns.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Message.h ${CMAKE_SOURCE_DIR}/include/quickfix/Message.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/MessageCracker.h ${CMAKE_SOURCE_DIR}/include/quickfix/MessageCracker.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/MessageSorters.h ${CMAKE_SOURCE_DIR}/include/quickfix/MessageSorters.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/MessageStore.h ${CMAKE_SOURCE_DIR}/include/quickfix/MessageStore.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/MpscQueue.h ${CMAKE_SOURCE_DIR}/include/quickfix/MpscQueue.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Mutex.h ${CMAKE_SOURCE_DIR}/include/quickfix/Mutex.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/MySQLConnection.h ${CMAKE_SOURCE_DIR}/include/quickfix/MySQLConnection.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/MySQLLog.h ${CMAKE_SOURCE_DIR}/include/quickfix/MySQLLog.h
@@ -63,9 +72,11 @@ COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Postgr
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/PUGIXML_DOMDocument.h ${CMAKE_SOURCE_DIR}/include/quickfix/PUGIXML_DOMDocument.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Queue.h ${CMAKE_SOURCE_DIR}/include/quickfix/Queue.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Responder.h ${CMAKE_SOURCE_DIR}/include/quickfix/Responder.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/SequenceBuffer.h ${CMAKE_SOURCE_DIR}/include/quickfix/SequenceBuffer.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Session.h ${CMAKE_SOURCE_DIR}/include/quickfix/Session.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/SessionFactory.h ${CMAKE_SOURCE_DIR}/include/quickfix/SessionFactory.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/SessionID.h ${CMAKE_SOURCE_DIR}/include/quickfix/SessionID.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/SessionMetrics.h ${CMAKE_SOURCE_DIR}/include/quickfix/SessionMetrics.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/SessionSettings.h ${CMAKE_SOURCE_DIR}/include/quickfix/SessionSettings.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/SessionState.h ${CMAKE_SOURCE_DIR}/include/quickfix/SessionState.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Settings.h ${CMAKE_SOURCE_DIR}/include/quickfix/Settings.h
@@ -76,11 +87,13 @@ COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Socket
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/SocketInitiator.h ${CMAKE_SOURCE_DIR}/include/quickfix/SocketInitiator.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/SocketMonitor.h ${CMAKE_SOURCE_DIR}/include/quickfix/SocketMonitor.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/SocketServer.h ${CMAKE_SOURCE_DIR}/include/quickfix/SocketServer.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/SpscQueue.h ${CMAKE_SOURCE_DIR}/include/quickfix/SpscQueue.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/SSLSocketAcceptor.h ${CMAKE_SOURCE_DIR}/include/quickfix/SSLSocketAcceptor.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/SSLSocketConnection.h ${CMAKE_SOURCE_DIR}/include/quickfix/SSLSocketConnection.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/SSLSocketInitiator.h ${CMAKE_SOURCE_DIR}/include/quickfix/SSLSocketInitiator.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/stdafx.h ${CMAKE_SOURCE_DIR}/include/quickfix/stdafx.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/stdint_msvc.h ${CMAKE_SOURCE_DIR}/include/quickfix/stdint_msvc.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/StringView.h ${CMAKE_SOURCE_DIR}/include/quickfix/StringView.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/strptime.h ${CMAKE_SOURCE_DIR}/include/quickfix/strptime.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/ThreadedSocketAcceptor.h ${CMAKE_SOURCE_DIR}/include/quickfix/ThreadedSocketAcceptor.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/ThreadedSocketConnection.h ${CMAKE_SOURCE_DIR}/include/quickfix/ThreadedSocketConnection.h
@@ -89,6 +102,11 @@ COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Thread
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/ThreadedSSLSocketConnection.h ${CMAKE_SOURCE_DIR}/include/quickfix/ThreadedSSLSocketConnection.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/ThreadedSSLSocketInitiator.h ${CMAKE_SOURCE_DIR}/include/quickfix/ThreadedSSLSocketInitiator.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/TimeRange.h ${CMAKE_SOURCE_DIR}/include/quickfix/TimeRange.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/TimerWheel.h ${CMAKE_SOURCE_DIR}/include/quickfix/TimerWheel.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/UringAcceptor.h ${CMAKE_SOURCE_DIR}/include/quickfix/UringAcceptor.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/UringConnection.h ${CMAKE_SOURCE_DIR}/include/quickfix/UringConnection.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/UringInitiator.h ${CMAKE_SOURCE_DIR}/include/quickfix/UringInitiator.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/UringMonitor.h ${CMAKE_SOURCE_DIR}/include/quickfix/UringMonitor.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Utility.h ${CMAKE_SOURCE_DIR}/include/quickfix/Utility.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/UtilitySSL.h ${CMAKE_SOURCE_DIR}/include/quickfix/UtilitySSL.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Values.h ${CMAKE_SOURCE_DIR}/include/quickfix/Values.h
@@ -0,0 +1,102 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#else
+#include "config.h"
+#endif
+
+#include "Application.h"
+#include "quickfix/Session.h"
+#include "quickfix/fix44/ExecutionReport.h"
+
+#include <stdlib.h>
+
+void EchoApplication::fromApp( const FIX::Message& message,
+                               const FIX::SessionID& sessionID )
+EXCEPT( FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue, FIX::UnsupportedMessageType )
+{
+  FIX::MsgType msgType;
+  message.getHeader().getField( msgType );
+
+  if( msgType == FIX::MsgType_NewOrderSingle )
+  {
+    FIX::ClOrdID clOrdID;
+    FIX::Side side;
+    FIX::OrderQty orderQty;
+    FIX::Price price;
+    message.getField( clOrdID );
+    message.getField( side );
+    message.getField( orderQty );
+    message.getField( price );
+
+    std::string execID = FIX::IntConvertor::convert( ++m_execID );
+    FIX44::ExecutionReport executionReport
+      ( FIX::OrderID( clOrdID ), FIX::ExecID( execID ),
+        FIX::ExecType( FIX::ExecType_TRADE ),
+        FIX::OrdStatus( FIX::OrdStatus_FILLED ), side,
+        FIX::LeavesQty( 0 ), FIX::CumQty( orderQty ), FIX::AvgPx( price ) );
+    executionReport.set( clOrdID );
+    executionReport.set( FIX::Symbol( message.getField( FIX::FIELD::Symbol ) ) );
+    executionReport.set( FIX::LastQty( orderQty ) );
+    executionReport.set( FIX::LastPx( price ) );
+    FIX::Session::sendToTarget( executionReport, sessionID );
+  }
+  else
+  {
+    FIX::Message echo( message );
+    FIX::Session::sendToTarget( echo, sessionID );
+  }
+}
+
+void LoadApplication::fromApp( const FIX::Message& message,
+                               const FIX::SessionID& sessionID )
+EXCEPT( FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue, FIX::UnsupportedMessageType )
+{
+  int64_t now = FIX::LatencyHistogram::now();
+
+  int tag = message.isSetField( FIX::FIELD::ClOrdID )
+    ? FIX::FIELD::ClOrdID : FIX::FIELD::MDReqID;
+  if( !message.isSetField( tag ) ) return;
+  int64_t due = strtoll( message.getField( tag ).c_str(), 0, 10 );
+
+  FIX::Locker l( m_mutex );
+  ++m_received;
+  if( m_recording )
+    m_histogram.record( now - due );
+}
+
+void LoadApplication::startRecording()
+{
+  FIX::Locker l( m_mutex );
+  m_histogram.reset();
+  m_recordedFrom = m_received;
+  m_recording = true;
+}
+
+void LoadApplication::stopRecording( FIX::LatencyHistogram& histogram,
+                                     long& received )
+{
+  FIX::Locker l( m_mutex );
+  m_recording = false;
+  histogram = m_histogram;
+  received = m_received - m_recordedFrom;
+}
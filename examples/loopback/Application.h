@@ -0,0 +1,89 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifndef LOOPBACK_APPLICATION_H
+#define LOOPBACK_APPLICATION_H
+
+#include "quickfix/Application.h"
+#include "quickfix/AtomicCount.h"
+#include "quickfix/LatencyHistogram.h"
+#include "quickfix/Mutex.h"
+
+/// Acceptor side: answers orders with a fill and echoes everything else.
+class EchoApplication : public FIX::Application
+{
+public:
+  EchoApplication() : m_execID( 0 ) {}
+
+  void onCreate( const FIX::SessionID& ) {}
+  void onLogon( const FIX::SessionID& ) {}
+  void onLogout( const FIX::SessionID& ) {}
+  void toAdmin( FIX::Message&, const FIX::SessionID& ) {}
+  void toApp( FIX::Message&, const FIX::SessionID& )
+    EXCEPT( FIX::DoNotSend ) {}
+  void fromAdmin( const FIX::Message&, const FIX::SessionID& )
+    EXCEPT( FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue, FIX::RejectLogon ) {}
+  void fromApp( const FIX::Message& message, const FIX::SessionID& sessionID )
+    EXCEPT( FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue, FIX::UnsupportedMessageType );
+
+private:
+  FIX::atomic_count m_execID;
+};
+
+/// Initiator side: measures the time from when each message was due to
+/// be sent until its answer arrives.  The due time travels in the
+/// ClOrdID or MDReqID field and comes back unchanged.
+class LoadApplication : public FIX::Application
+{
+public:
+  LoadApplication() : m_received( 0 ), m_logons( 0 ),
+    m_recordedFrom( 0 ), m_recording( false ) {}
+
+  void onCreate( const FIX::SessionID& ) {}
+  void onLogon( const FIX::SessionID& ) { ++m_logons; }
+  void onLogout( const FIX::SessionID& ) { --m_logons; }
+  void toAdmin( FIX::Message&, const FIX::SessionID& ) {}
+  void toApp( FIX::Message&, const FIX::SessionID& )
+    EXCEPT( FIX::DoNotSend ) {}
+  void fromAdmin( const FIX::Message&, const FIX::SessionID& )
+    EXCEPT( FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue, FIX::RejectLogon ) {}
+  void fromApp( const FIX::Message& message, const FIX::SessionID& sessionID )
+    EXCEPT( FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue, FIX::UnsupportedMessageType );
+
+  long getReceived() const { return m_received; }
+  long getLogons() const { return m_logons; }
+
+  /// Round trips completing from now on go into a fresh histogram
+  void startRecording();
+  /// Stops recording and copies out what was recorded
+  void stopRecording( FIX::LatencyHistogram& histogram, long& received );
+
+private:
+  FIX::atomic_count m_received;
+  FIX::atomic_count m_logons;
+  FIX::Mutex m_mutex;
+  FIX::LatencyHistogram m_histogram;
+  long m_recordedFrom;
+  bool m_recording;
+};
+
+#endif
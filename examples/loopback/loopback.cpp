@@ -0,0 +1,574 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#else
+#include "config.h"
+#endif
+
+#include "quickfix/MessageStore.h"
+#include "quickfix/SocketAcceptor.h"
+#include "quickfix/SocketInitiator.h"
+#include "quickfix/ThreadedSocketAcceptor.h"
+#include "quickfix/ThreadedSocketInitiator.h"
+#ifdef HAVE_SSL
+#include "quickfix/SSLSocketAcceptor.h"
+#include "quickfix/SSLSocketInitiator.h"
+#include "quickfix/ThreadedSSLSocketAcceptor.h"
+#include "quickfix/ThreadedSSLSocketInitiator.h"
+#endif
+#ifdef HAVE_IO_URING
+#include "quickfix/UringAcceptor.h"
+#include "quickfix/UringInitiator.h"
+#endif
+#include "quickfix/Session.h"
+#include "quickfix/SessionSettings.h"
+#include "quickfix/fix44/NewOrderSingle.h"
+#include "quickfix/fix44/ExecutionReport.h"
+#include "quickfix/fix44/MarketDataSnapshotFullRefresh.h"
+#include "Application.h"
+
+#include <sys/resource.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+
+struct Options
+{
+  Options()
+  : mode( "both" ), engine( "socket" ), mix( "D=1" ), sessions( 1 ),
+    port( 54500 ), rate( 0 ), duration( 10 ), warmup( 2 ), window( 1000 ) {}
+
+  std::string mode;
+  std::string engine;
+  std::string mix;
+  int sessions;
+  int port;
+  double rate;
+  double duration;
+  double warmup;
+  long window;
+  std::map<std::string, std::string> settings;
+};
+
+/// Jiffies spent busy and in total for the machine and for each core
+struct CpuTimes
+{
+  std::vector<std::string> names;
+  std::vector<unsigned long long> busy;
+  std::vector<unsigned long long> total;
+  double processSeconds;
+  double userSeconds;
+  double systemSeconds;
+};
+
+void usage( const char* name )
+{
+  std::cout
+    << "usage: " << name << " [-m both|acceptor|initiator] [-e engine]"
+    << " [-n sessions]" << std::endl
+    << "  [-r messages_per_second] [-d seconds] [-w warmup_seconds]"
+    << " [-x mix] [-q window]" << std::endl
+    << "  [-p port] [-o Key=Value]..." << std::endl << std::endl
+    << "engines: socket threaded"
+#ifdef HAVE_SSL
+    << " ssl threaded-ssl"
+#endif
+#ifdef HAVE_IO_URING
+    << " uring"
+#endif
+    << std::endl
+    << "mix:     MsgType=weight,... where D is NewOrderSingle answered by"
+    << " an ExecutionReport," << std::endl
+    << "         8 is an echoed ExecutionReport and W an echoed"
+    << " MarketDataSnapshotFullRefresh" << std::endl
+    << "rate:    total for all sessions, 0 sends as fast as the window"
+    << " allows" << std::endl
+    << "window:  most messages awaiting an answer at any time" << std::endl
+    << "-o:      extra [DEFAULT] setting, may be repeated" << std::endl;
+}
+
+bool parseOptions( int argc, char** argv, Options& options )
+{
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string option = argv[ i ];
+    if( option.size() != 2 || option[ 0 ] != '-' || i + 1 == argc )
+      return false;
+    std::string value = argv[ ++i ];
+
+    switch( option[ 1 ] )
+    {
+    case 'm': options.mode = value; break;
+    case 'e': options.engine = value; break;
+    case 'x': options.mix = value; break;
+    case 'n': options.sessions = atoi( value.c_str() ); break;
+    case 'p': options.port = atoi( value.c_str() ); break;
+    case 'r': options.rate = atof( value.c_str() ); break;
+    case 'd': options.duration = atof( value.c_str() ); break;
+    case 'w': options.warmup = atof( value.c_str() ); break;
+    case 'q': options.window = atol( value.c_str() ); break;
+    case 'o':
+      {
+        std::string::size_type equals = value.find( '=' );
+        if( equals == std::string::npos ) return false;
+        options.settings[ value.substr( 0, equals ) ] = value.substr( equals + 1 );
+      }
+      break;
+    default:
+      return false;
+    }
+  }
+
+  return options.sessions > 0 && options.window > 0 && options.duration > 0
+    && ( options.mode == "both" || options.mode == "acceptor"
+         || options.mode == "initiator" );
+}
+
+/// Expands weights like D=8,W=2 into a smoothly interleaved sequence
+bool parseMix( const std::string& mix, std::string& sequence )
+{
+  std::vector<char> types;
+  std::vector<int> weights;
+  int total = 0;
+
+  std::stringstream stream( mix );
+  std::string entry;
+  while( std::getline( stream, entry, ',' ) )
+  {
+    if( entry.size() < 3 || entry[ 1 ] != '=' ) return false;
+    char type = entry[ 0 ];
+    int weight = atoi( entry.c_str() + 2 );
+    if( weight <= 0 ) return false;
+    if( type != 'D' && type != '8' && type != 'W' ) return false;
+    types.push_back( type );
+    weights.push_back( weight );
+    total += weight;
+  }
+  if( !total ) return false;
+
+  std::vector<int> current( types.size(), 0 );
+  for( int n = 0; n < total; ++n )
+  {
+    size_t best = 0;
+    for( size_t i = 0; i < types.size(); ++i )
+    {
+      current[ i ] += weights[ i ];
+      if( current[ i ] > current[ best ] ) best = i;
+    }
+    current[ best ] -= total;
+    sequence += types[ best ];
+  }
+  return true;
+}
+
+std::string createSettings( const Options& options, bool acceptor )
+{
+  std::map<std::string, std::string> defaults;
+  defaults[ "ConnectionType" ] = acceptor ? "acceptor" : "initiator";
+  defaults[ "BeginString" ] = "FIX.4.4";
+  defaults[ "StartTime" ] = "00:00:00";
+  defaults[ "EndTime" ] = "00:00:00";
+  defaults[ "HeartBtInt" ] = "30";
+  defaults[ "ReconnectInterval" ] = "1";
+  defaults[ "ResetOnLogon" ] = "Y";
+  // Repeating groups in market data only parse with a dictionary
+  defaults[ "UseDataDictionary" ] = "Y";
+  defaults[ "DataDictionary" ] = "../spec/FIX44.xml";
+  defaults[ "PersistMessages" ] = "N";
+  defaults[ "SocketNodelay" ] = "Y";
+  defaults[ "SocketAcceptPort" ] = FIX::IntConvertor::convert( options.port );
+  defaults[ "SocketConnectHost" ] = "127.0.0.1";
+  defaults[ "SocketConnectPort" ] = FIX::IntConvertor::convert( options.port );
+  if( options.engine.find( "ssl" ) != std::string::npos )
+  {
+    defaults[ "SSLProtocol" ] = "all";
+    if( acceptor )
+    {
+      defaults[ "ServerCertificateFile" ] = "./cfg/certs/127_0_0_1_server.crt";
+      defaults[ "ServerCertificateKeyFile" ] = "./cfg/certs/127_0_0_1_server.key";
+    }
+  }
+
+  std::map<std::string, std::string>::const_iterator i;
+  for( i = options.settings.begin(); i != options.settings.end(); ++i )
+    defaults[ i->first ] = i->second;
+
+  std::stringstream stream;
+  stream << "[DEFAULT]" << std::endl;
+  for( i = defaults.begin(); i != defaults.end(); ++i )
+    stream << i->first << "=" << i->second << std::endl;
+
+  for( int n = 1; n <= options.sessions; ++n )
+  {
+    std::string client = "CLIENT" + FIX::IntConvertor::convert( n );
+    stream << "[SESSION]" << std::endl
+           << "SenderCompID=" << ( acceptor ? "SERVER" : client ) << std::endl
+           << "TargetCompID=" << ( acceptor ? client : "SERVER" ) << std::endl;
+  }
+  return stream.str();
+}
+
+FIX::Acceptor* createAcceptor( const std::string& engine,
+                               FIX::Application& application,
+                               FIX::MessageStoreFactory& factory,
+                               const FIX::SessionSettings& settings )
+{
+  if( engine == "socket" )
+    return new FIX::SocketAcceptor( application, factory, settings );
+  if( engine == "threaded" )
+    return new FIX::ThreadedSocketAcceptor( application, factory, settings );
+#ifdef HAVE_SSL
+  if( engine == "ssl" )
+    return new FIX::SSLSocketAcceptor( application, factory, settings );
+  if( engine == "threaded-ssl" )
+    return new FIX::ThreadedSSLSocketAcceptor( application, factory, settings );
+#endif
+#ifdef HAVE_IO_URING
+  if( engine == "uring" )
+    return new FIX::UringAcceptor( application, factory, settings );
+#endif
+  throw FIX::ConfigError( "Unknown engine " + engine );
+}
+
+FIX::Initiator* createInitiator( const std::string& engine,
+                                 FIX::Application& application,
+                                 FIX::MessageStoreFactory& factory,
+                                 const FIX::SessionSettings& settings )
+{
+  if( engine == "socket" )
+    return new FIX::SocketInitiator( application, factory, settings );
+  if( engine == "threaded" )
+    return new FIX::ThreadedSocketInitiator( application, factory, settings );
+#ifdef HAVE_SSL
+  if( engine == "ssl" )
+    return new FIX::SSLSocketInitiator( application, factory, settings );
+  if( engine == "threaded-ssl" )
+    return new FIX::ThreadedSSLSocketInitiator( application, factory, settings );
+#endif
+#ifdef HAVE_IO_URING
+  if( engine == "uring" )
+    return new FIX::UringInitiator( application, factory, settings );
+#endif
+  throw FIX::ConfigError( "Unknown engine " + engine );
+}
+
+void readCpuTimes( CpuTimes& times )
+{
+  std::ifstream stat( "/proc/stat" );
+  std::string line;
+  while( std::getline( stat, line ) )
+  {
+    if( line.compare( 0, 3, "cpu" ) != 0 ) break;
+
+    std::stringstream stream( line );
+    std::string name;
+    unsigned long long value, idle = 0, total = 0;
+    stream >> name;
+    for( int column = 0; column < 8 && stream >> value; ++column )
+    {
+      total += value;
+      // idle and iowait
+      if( column == 3 || column == 4 ) idle += value;
+    }
+    times.names.push_back( name );
+    times.busy.push_back( total - idle );
+    times.total.push_back( total );
+  }
+
+  struct rusage usage;
+  getrusage( RUSAGE_SELF, &usage );
+  times.userSeconds = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6;
+  times.systemSeconds = usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+  times.processSeconds = times.userSeconds + times.systemSeconds;
+}
+
+void reportCpu( const CpuTimes& start, const CpuTimes& end, double seconds )
+{
+  std::cout << std::fixed << std::setprecision( 2 )
+            << "process cpu:  " << ( end.processSeconds - start.processSeconds ) / seconds
+            << " cores (user " << end.userSeconds - start.userSeconds
+            << "s, system " << end.systemSeconds - start.systemSeconds
+            << "s)" << std::endl;
+
+  std::cout << std::setprecision( 0 );
+  for( size_t i = 0; i < end.names.size() && i < start.names.size(); ++i )
+  {
+    unsigned long long total = end.total[ i ] - start.total[ i ];
+    unsigned long long busy = end.busy[ i ] - start.busy[ i ];
+    double percent = total ? 100.0 * busy / total : 0;
+
+    if( i == 0 )
+      std::cout << "machine busy: " << percent << "%" << std::endl << "core busy %:";
+    else
+      std::cout << ( i % 8 == 1 ? "\n  " : " " ) << std::setw( 6 )
+                << end.names[ i ].substr( 3 ) << ":" << std::setw( 3 ) << percent;
+  }
+  std::cout << std::endl;
+}
+
+void reportLatency( const FIX::LatencyHistogram& histogram )
+{
+  static const double percentiles[] = { 50, 90, 99, 99.9 };
+  static const char* names[] = { "p50", "p90", "p99", "p99.9" };
+
+  std::cout << std::fixed << std::setprecision( 1 ) << "rtt us:      ";
+  for( size_t i = 0; i < sizeof( percentiles ) / sizeof( double ); ++i )
+  {
+    std::cout << " " << names[ i ] << " "
+              << histogram.getValueAtPercentile( percentiles[ i ] ) / 1000.0;
+  }
+  std::cout << " max " << histogram.getMax() / 1000.0
+            << " mean " << histogram.getMean() / 1000.0 << std::endl;
+}
+
+/// Builds one message of each type per session so sending only stamps the id
+void createMessages( int sessions, std::vector<FIX::Message*>& messages )
+{
+  for( int n = 0; n < sessions; ++n )
+  {
+    FIX44::NewOrderSingle* order = new FIX44::NewOrderSingle
+      ( FIX::ClOrdID( "0" ), FIX::Side( FIX::Side_BUY ),
+        FIX::TransactTime(), FIX::OrdType( FIX::OrdType_LIMIT ) );
+    order->set( FIX::Symbol( "IBM" ) );
+    order->set( FIX::OrderQty( 100 ) );
+    order->set( FIX::Price( 120.25 ) );
+    order->set( FIX::HandlInst( '1' ) );
+    messages.push_back( order );
+
+    FIX44::ExecutionReport* executionReport = new FIX44::ExecutionReport
+      ( FIX::OrderID( "1" ), FIX::ExecID( "1" ),
+        FIX::ExecType( FIX::ExecType_TRADE ),
+        FIX::OrdStatus( FIX::OrdStatus_FILLED ), FIX::Side( FIX::Side_BUY ),
+        FIX::LeavesQty( 0 ), FIX::CumQty( 100 ), FIX::AvgPx( 120.25 ) );
+    executionReport->set( FIX::ClOrdID( "0" ) );
+    executionReport->set( FIX::Symbol( "IBM" ) );
+    executionReport->set( FIX::LastQty( 100 ) );
+    executionReport->set( FIX::LastPx( 120.25 ) );
+    messages.push_back( executionReport );
+
+    FIX44::MarketDataSnapshotFullRefresh* snapshot =
+      new FIX44::MarketDataSnapshotFullRefresh;
+    snapshot->set( FIX::MDReqID( "0" ) );
+    snapshot->set( FIX::Symbol( "IBM" ) );
+    FIX44::MarketDataSnapshotFullRefresh::NoMDEntries entry;
+    for( int i = 0; i < 10; ++i )
+    {
+      entry.set( FIX::MDEntryType( i % 2 ? FIX::MDEntryType_OFFER : FIX::MDEntryType_BID ) );
+      entry.set( FIX::MDEntryPx( 120 + ( i % 2 ? i : -i ) * 0.01 ) );
+      entry.set( FIX::MDEntrySize( 100 * ( i + 1 ) ) );
+      snapshot->addGroup( entry );
+    }
+    messages.push_back( snapshot );
+  }
+}
+
+int runAcceptor( const Options& options, FIX::Acceptor& acceptor )
+{
+  std::cout << "waiting for initiators on port " << options.port << std::endl;
+  while( !acceptor.isLoggedOn() )
+    FIX::process_sleep( 0.01 );
+
+  CpuTimes start, end;
+  readCpuTimes( start );
+  int64_t startTime = FIX::LatencyHistogram::now();
+  while( acceptor.isLoggedOn() )
+    FIX::process_sleep( 0.01 );
+  readCpuTimes( end );
+
+  reportCpu( start, end, ( FIX::LatencyHistogram::now() - startTime ) / 1e9 );
+  return 0;
+}
+
+int runInitiator( const Options& options, const std::string& sequence,
+                  FIX::Initiator& initiator, LoadApplication& application )
+{
+  std::vector<FIX::Session*> sessions;
+  const std::set<FIX::SessionID>& sessionIDs = initiator.getSessions();
+  std::set<FIX::SessionID>::const_iterator i;
+
+  int64_t deadline = FIX::LatencyHistogram::now() + 10 * 1000000000LL;
+  while( application.getLogons() < options.sessions )
+  {
+    if( FIX::LatencyHistogram::now() > deadline )
+    {
+      std::cout << "only " << application.getLogons() << " of "
+                << options.sessions << " sessions logged on" << std::endl;
+      return 1;
+    }
+    FIX::process_sleep( 0.01 );
+  }
+  for( i = sessionIDs.begin(); i != sessionIDs.end(); ++i )
+    sessions.push_back( initiator.getSession( *i ) );
+
+  std::vector<FIX::Message*> messages;
+  createMessages( options.sessions, messages );
+
+  const int64_t interval = options.rate > 0
+    ? static_cast<int64_t>( 1e9 / options.rate ) : 0;
+  const int64_t begin = FIX::LatencyHistogram::now();
+  const int64_t measureFrom = begin + static_cast<int64_t>( options.warmup * 1e9 );
+  const int64_t end = measureFrom + static_cast<int64_t>( options.duration * 1e9 );
+
+  CpuTimes startCpu, endCpu;
+  long sent = 0, sentFrom = 0;
+  bool recording = false;
+  int64_t due = begin;
+
+  while( true )
+  {
+    int64_t now = FIX::LatencyHistogram::now();
+    if( !recording && now >= measureFrom )
+    {
+      readCpuTimes( startCpu );
+      application.startRecording();
+      sentFrom = sent;
+      recording = true;
+    }
+    if( now >= end ) break;
+
+    if( interval && now < due )
+    {
+      if( due - now > 100000 ) FIX::process_sleep( 0.00005 );
+      continue;
+    }
+    if( sent - application.getReceived() >= options.window )
+    {
+      FIX::process_sleep( 0.00001 );
+      continue;
+    }
+    // Unpaced, a message is due when there is room for it.  Paced, it
+    // stays due on schedule so time spent waiting counts against latency.
+    if( !interval ) due = now;
+
+    char type = sequence[ sent % sequence.size() ];
+    int session = sent % options.sessions;
+    int index = type == 'D' ? 0 : type == '8' ? 1 : 2;
+    FIX::Message& message = *messages[ session * 3 + index ];
+
+    char id[ 24 ];
+    snprintf( id, sizeof( id ), "%lld", static_cast<long long>( due ) );
+    if( type == 'W' )
+      message.setField( FIX::MDReqID( id ) );
+    else
+      message.setField( FIX::ClOrdID( id ) );
+    sessions[ session ]->send( message );
+
+    ++sent;
+    due += interval;
+  }
+
+  FIX::LatencyHistogram histogram;
+  long received = 0;
+  application.stopRecording( histogram, received );
+  readCpuTimes( endCpu );
+
+  deadline = FIX::LatencyHistogram::now() + 5 * 1000000000LL;
+  while( application.getReceived() < sent
+         && FIX::LatencyHistogram::now() < deadline )
+    FIX::process_sleep( 0.01 );
+
+  for( size_t n = 0; n < messages.size(); ++n )
+    delete messages[ n ];
+
+  std::cout << std::fixed << std::setprecision( 0 )
+            << "engine:       " << options.engine << ", " << options.sessions
+            << " sessions, mix " << options.mix << ", window "
+            << options.window << ", rate ";
+  if( interval ) std::cout << options.rate << "/s"; else std::cout << "unpaced";
+  std::cout << std::endl
+            << "measured:     " << options.duration << "s after "
+            << options.warmup << "s warmup" << std::endl
+            << "sent:         " << sent - sentFrom << " ("
+            << ( sent - sentFrom ) / options.duration << "/s)" << std::endl
+            << "round trips:  " << received << " ("
+            << received / options.duration << "/s)" << std::endl
+            << "unanswered:   " << sent - application.getReceived()
+            << std::endl;
+  reportLatency( histogram );
+  reportCpu( startCpu, endCpu, options.duration );
+  return 0;
+}
+
+int main( int argc, char** argv )
+{
+  Options options;
+  std::string sequence;
+  if( !parseOptions( argc, argv, options ) || !parseMix( options.mix, sequence ) )
+  {
+    usage( argv[ 0 ] );
+    return 1;
+  }
+
+  FIX::MemoryStoreFactory storeFactory;
+  EchoApplication echoApplication;
+  LoadApplication loadApplication;
+  FIX::Acceptor* acceptor = 0;
+  FIX::Initiator* initiator = 0;
+  int result = 0;
+
+  try
+  {
+    if( options.mode != "initiator" )
+    {
+      FIX::SessionSettings settings;
+      std::stringstream stream( createSettings( options, true ) );
+      stream >> settings;
+      acceptor = createAcceptor
+        ( options.engine, echoApplication, storeFactory, settings );
+      acceptor->start();
+    }
+
+    if( options.mode == "acceptor" )
+    {
+      result = runAcceptor( options, *acceptor );
+    }
+    else
+    {
+      FIX::SessionSettings settings;
+      std::stringstream stream( createSettings( options, false ) );
+      stream >> settings;
+      initiator = createInitiator
+        ( options.engine, loadApplication, storeFactory, settings );
+      initiator->start();
+      result = runInitiator( options, sequence, *initiator, loadApplication );
+      initiator->stop();
+    }
+
+    if( acceptor )
+      acceptor->stop();
+  }
+  catch( std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    result = 1;
+  }
+
+  delete initiator;
+  delete acceptor;
+  return result;
+}
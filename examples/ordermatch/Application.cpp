@@ -71,7 +71,7 @@ void Application::onMessage( const FIX42::NewOrderSingle& message, const FIX::Se
                  convert( side ), convert( ordType ),
                  price, (long)orderQty );
 
-    processOrder( order );
+    m_orderMatcher.submitOrder( order );
   }
   catch ( std::exception & e )
   {
@@ -81,17 +81,23 @@ void Application::onMessage( const FIX42::NewOrderSingle& message, const FIX::Se
 
 void Application::onMessage( const FIX42::OrderCancelRequest& message, const FIX::SessionID& )
 {
+  FIX::SenderCompID senderCompID;
+  FIX::TargetCompID targetCompID;
   FIX::OrigClOrdID origClOrdID;
   FIX::Symbol symbol;
   FIX::Side side;
 
+  message.getHeader().get( senderCompID );
+  message.getHeader().get( targetCompID );
   message.get( origClOrdID );
   message.get( symbol );
   message.get( side );
 
   try
   {
-    processCancel( origClOrdID, symbol, convert( side ) );
+    m_orderMatcher.submitCancel
+      ( Order( origClOrdID, symbol, senderCompID, targetCompID,
+               convert( side ), Order::limit, 0, 0 ) );
   }
   catch ( std::exception& ) {}}
 
@@ -181,14 +187,14 @@ void Application::rejectOrder
   }
   catch ( FIX::SessionNotFound& ) {}}
 
-void Application::processOrder( const Order& order )
+void Application::processOrder( OrderMatcher& orderMatcher, const Order& order )
 {
-  if ( m_orderMatcher.insert( order ) )
+  if ( orderMatcher.insert( order ) )
   {
     acceptOrder( order );
 
     std::queue < Order > orders;
-    m_orderMatcher.match( order.getSymbol(), orders );
+    orderMatcher.match( order.getSymbol(), orders );
 
     while ( orders.size() )
     {
@@ -200,13 +206,13 @@ void Application::processOrder( const Order& order )
     rejectOrder( order );
 }
 
-void Application::processCancel( const std::string& id,
-                                 const std::string& symbol, Order::Side side )
+void Application::processCancel( OrderMatcher& orderMatcher, const Order& cancel )
 {
-  Order & order = m_orderMatcher.find( symbol, side, id );
+  Order & order = orderMatcher.find( cancel.getSymbol(), cancel.getSide(),
+                                     cancel.getOwner(), cancel.getClientID() );
   order.cancel();
   cancelOrder( order );
-  m_orderMatcher.erase( order );
+  orderMatcher.erase( order );
 }
 
 Order::Side Application::convert( const FIX::Side& side )
@@ -23,7 +23,7 @@
 #define ORDERMATCH_APPLICATION_H
 
 #include "IDGenerator.h"
-#include "OrderMatcher.h"
+#include "ShardedOrderMatcher.h"
 #include "Order.h"
 #include <queue>
 #include <iostream>
@@ -41,7 +41,8 @@
 
 class Application
       : public FIX::Application,
-        public FIX::MessageCracker
+        public FIX::MessageCracker,
+        public ShardedOrderMatcher::Processor
 {
   // Application overloads
   void onCreate( const FIX::SessionID& ) {}
@@ -61,9 +62,9 @@ class Application
   void onMessage( const FIX42::MarketDataRequest&, const FIX::SessionID& );
   void onMessage( const FIX43::MarketDataRequest&, const FIX::SessionID& );
 
-  // Order functionality
-  void processOrder( const Order& );
-  void processCancel( const std::string& id, const std::string& symbol, Order::Side );
+  // Order functionality, called on the matcher threads
+  void processOrder( OrderMatcher&, const Order& );
+  void processCancel( OrderMatcher&, const Order& );
 
   void updateOrder( const Order&, char status );
   void rejectOrder( const Order& order )
@@ -89,11 +90,16 @@ class Application
   FIX::Side convert( Order::Side );
   FIX::OrdType convert( Order::Type );
 
-  OrderMatcher m_orderMatcher;
   IDGenerator m_generator;
+  ShardedOrderMatcher m_orderMatcher;
 
 public:
-  const OrderMatcher& orderMatcher() { return m_orderMatcher; }
+  /// Matches orders on as many threads as there are shards
+  Application( size_t shards = 1 ) : m_orderMatcher( *this, shards ) {}
+  /// Stop matching before the members used by the matcher threads go
+  ~Application() { m_orderMatcher.stop(); }
+
+  const ShardedOrderMatcher& orderMatcher() { return m_orderMatcher; }
 };
 
 #endif
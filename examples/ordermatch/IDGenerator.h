@@ -22,8 +22,8 @@
 #ifndef ORDERMATCH_IDGENERATOR_H
 #define ORDERMATCH_IDGENERATOR_H
 
+#include "quickfix/AtomicCount.h"
 #include <string>
-#include <sstream>
 
 class IDGenerator
 {
@@ -32,21 +32,32 @@ IDGenerator() : m_orderID( 0 ), m_executionID( 0 ) {}
 
   std::string genOrderID()
   {
-    std::stringstream stream;
-    stream << ++m_orderID;
-    return stream.str();
+    return toString( ++m_orderID );
   }
 
   std::string genExecutionID()
   {
-    std::stringstream stream;
-    stream << ++m_executionID;
-    return stream.str();
+    return toString( ++m_executionID );
   }
 
 private:
-  long m_orderID;
-  long m_executionID;
+  static std::string toString( unsigned long value )
+  {
+    // digits written backwards from the end of the buffer
+    char buffer[ 24 ];
+    char* const end = buffer + sizeof( buffer );
+    char* p = end;
+    do
+    {
+      *--p = ( char ) ( '0' + value % 10 );
+      value /= 10;
+    } while ( value );
+    return std::string( p, end );
+  }
+
+  // shared by the matcher threads
+  FIX::atomic_count m_orderID;
+  FIX::atomic_count m_executionID;
 };
 
 #endif
@@ -24,84 +24,98 @@
 #endif
 
 #include "Market.h"
+#include <algorithm>
+#include <new>
 #include <iostream>
+#include <cmath>
+
+namespace
+{
+// orders levels so the best price of a side comes last
+struct LevelBefore
+{
+  LevelBefore( bool ascending ) : ascending( ascending ) {}
+  template < typename Level >
+  bool operator()( const Level* pLevel, long price ) const
+  { return ascending ? pLevel->price < price : pLevel->price > price; }
+  bool ascending;
+};
+}
+
+Market::Market( double tickSize )
+: m_tickSize( tickSize ), m_size( 0 ), m_index( 64 ) {}
+
+Market::~Market()
+{
+  for ( size_t i = 0; i < m_index.size(); ++i )
+  {
+    for ( Node* pNode = m_index[ i ]; pNode; )
+    {
+      Node* pNext = pNode->pHashNext;
+      pNode->~Node();
+      pNode = pNext;
+    }
+  }
+}
 
 bool Market::insert( const Order& order )
 {
-  if ( order.getSide() == Order::buy )
-    m_bidOrders.insert( BidOrders::value_type( order.getPrice(), order ) );
-  else
-    m_askOrders.insert( AskOrders::value_type( order.getPrice(), order ) );
+  if ( lookup( order.getOwner(), order.getClientID() ) )
+    return false;
+
+  Node* pNode = new ( m_nodes.allocate() )
+    Node( order, toTicks( order.getPrice() ),
+          hash( order.getOwner(), order.getClientID() ) );
+
+  Level* pLevel = level( order.getSide(), pNode->price );
+  pNode->pLevel = pLevel;
+  pNode->pPrev = pLevel->pTail;
+  if ( pLevel->pTail ) pLevel->pTail->pNext = pNode;
+  else pLevel->pHead = pNode;
+  pLevel->pTail = pNode;
+
+  index( pNode );
   return true;
 }
 
 void Market::erase( const Order& order )
 {
-  std::string id = order.getClientID();
-  if ( order.getSide() == Order::buy )
-  {
-    BidOrders::iterator i;
-    for ( i = m_bidOrders.begin(); i != m_bidOrders.end(); ++i )
-      if ( i->second.getClientID() == id )
-      {
-        m_bidOrders.erase( i );
-        return ;
-      }
-  }
-  else if ( order.getSide() == Order::sell )
-  {
-    AskOrders::iterator i;
-    for ( i = m_askOrders.begin(); i != m_askOrders.end(); ++i )
-      if ( i->second.getClientID() == id )
-      {
-        m_askOrders.erase( i );
-        return ;
-      }
-  }
+  Node* pNode = lookup( order.getOwner(), order.getClientID() );
+  if ( pNode && pNode->order.getSide() == order.getSide() )
+    remove( pNode );
 }
 
 bool Market::match( std::queue < Order > & orders )
 {
-  while ( true )
+  while ( m_bids.size() && m_asks.size() )
   {
-    if ( !m_bidOrders.size() || !m_askOrders.size() )
-      return orders.size() != 0;
-
-    BidOrders::iterator iBid = m_bidOrders.begin();
-    AskOrders::iterator iAsk = m_askOrders.begin();
+    Level* pBid = m_bids.back();
+    Level* pAsk = m_asks.back();
+    if ( pBid->price < pAsk->price )
+      break;
 
-    if ( iBid->second.getPrice() >= iAsk->second.getPrice() )
-    {
-      Order & bid = iBid->second;
-      Order& ask = iAsk->second;
+    Node* pBidNode = pBid->pHead;
+    Node* pAskNode = pAsk->pHead;
+    Order& bid = pBidNode->order;
+    Order& ask = pAskNode->order;
 
-      match( bid, ask );
-      orders.push( bid );
-      orders.push( ask );
+    match( bid, ask );
+    orders.push( bid );
+    orders.push( ask );
 
-      if ( bid.isClosed() ) m_bidOrders.erase( iBid );
-      if ( ask.isClosed() ) m_askOrders.erase( iAsk );
-    }
-    else
-      return orders.size() != 0;
+    if ( bid.isClosed() ) remove( pBidNode );
+    if ( ask.isClosed() ) remove( pAskNode );
   }
+  return orders.size() != 0;
 }
 
-Order& Market::find( Order::Side side, std::string id )
+Order& Market::find( Order::Side side, const std::string& owner,
+                     const std::string& id )
 {
-  if ( side == Order::buy )
-  {
-    BidOrders::iterator i;
-    for ( i = m_bidOrders.begin(); i != m_bidOrders.end(); ++i )
-      if ( i->second.getClientID() == id ) return i->second;
-  }
-  else if ( side == Order::sell )
-  {
-    AskOrders::iterator i;
-    for ( i = m_askOrders.begin(); i != m_askOrders.end(); ++i )
-      if ( i->second.getClientID() == id ) return i->second;
-  }
-  throw std::exception();
+  Node* pNode = lookup( owner, id );
+  if ( !pNode || pNode->order.getSide() != side )
+    throw std::exception();
+  return pNode->order;
 }
 
 void Market::match( Order& bid, Order& ask )
@@ -120,18 +134,129 @@ void Market::match( Order& bid, Order& ask )
 
 void Market::display() const
 {
-  BidOrders::const_iterator iBid;
-  AskOrders::const_iterator iAsk;
+  Levels::const_reverse_iterator i;
 
   std::cout << "BIDS:" << std::endl;
   std::cout << "-----" << std::endl << std::endl;
-  for ( iBid = m_bidOrders.begin(); iBid != m_bidOrders.end(); ++iBid )
-    std::cout << iBid->second << std::endl;
+  for ( i = m_bids.rbegin(); i != m_bids.rend(); ++i )
+    for ( const Node* pNode = ( *i )->pHead; pNode; pNode = pNode->pNext )
+      std::cout << pNode->order << std::endl;
 
   std::cout << std::endl << std::endl;
 
   std::cout << "ASKS:" << std::endl;
   std::cout << "-----" << std::endl << std::endl;
-  for ( iAsk = m_askOrders.begin(); iAsk != m_askOrders.end(); ++iAsk )
-    std::cout << iAsk->second << std::endl;
+  for ( i = m_asks.rbegin(); i != m_asks.rend(); ++i )
+    for ( const Node* pNode = ( *i )->pHead; pNode; pNode = pNode->pNext )
+      std::cout << pNode->order << std::endl;
+}
+
+long Market::toTicks( double price ) const
+{
+  return ( long ) std::floor( price / m_tickSize + 0.5 );
+}
+
+size_t Market::hash( const std::string& owner, const std::string& id )
+{
+  // FNV-1a over the owner, a separator and the id
+  size_t result = 2166136261U;
+  std::string::const_iterator i;
+  for ( i = owner.begin(); i != owner.end(); ++i )
+    result = ( result ^ ( unsigned char ) *i ) * 16777619U;
+  result = ( result ^ 1 ) * 16777619U;
+  for ( i = id.begin(); i != id.end(); ++i )
+    result = ( result ^ ( unsigned char ) *i ) * 16777619U;
+  return result;
+}
+
+Market::Node* Market::lookup( const std::string& owner,
+                              const std::string& id ) const
+{
+  size_t value = hash( owner, id );
+  Node* pNode = m_index[ value & ( m_index.size() - 1 ) ];
+  for ( ; pNode; pNode = pNode->pHashNext )
+  {
+    if ( pNode->hash == value && pNode->order.getClientID() == id
+         && pNode->order.getOwner() == owner )
+      return pNode;
+  }
+  return 0;
+}
+
+void Market::index( Node* pNode )
+{
+  if ( ++m_size > m_index.size() )
+  {
+    // double the buckets, they stay a power of two
+    std::vector < Node* > index( m_index.size() * 2 );
+    for ( size_t i = 0; i < m_index.size(); ++i )
+    {
+      for ( Node* pOld = m_index[ i ]; pOld; )
+      {
+        Node* pNext = pOld->pHashNext;
+        Node*& pBucket = index[ pOld->hash & ( index.size() - 1 ) ];
+        pOld->pHashNext = pBucket;
+        pBucket = pOld;
+        pOld = pNext;
+      }
+    }
+    m_index.swap( index );
+  }
+
+  Node*& pBucket = m_index[ pNode->hash & ( m_index.size() - 1 ) ];
+  pNode->pHashNext = pBucket;
+  pBucket = pNode;
+}
+
+void Market::unindex( Node* pNode )
+{
+  Node** ppNode = &m_index[ pNode->hash & ( m_index.size() - 1 ) ];
+  while ( *ppNode != pNode )
+    ppNode = &( *ppNode )->pHashNext;
+  *ppNode = pNode->pHashNext;
+  --m_size;
+}
+
+Market::Level* Market::level( Order::Side side, long price )
+{
+  bool buy = side == Order::buy;
+  Levels& levels = buy ? m_bids : m_asks;
+
+  Levels::iterator i = std::lower_bound
+    ( levels.begin(), levels.end(), price, LevelBefore( buy ) );
+  if ( i != levels.end() && ( *i )->price == price )
+    return *i;
+
+  Level* pLevel = static_cast < Level* > ( m_levels.allocate() );
+  pLevel->price = price;
+  pLevel->pHead = 0;
+  pLevel->pTail = 0;
+  levels.insert( i, pLevel );
+  return pLevel;
+}
+
+void Market::remove( Node* pNode )
+{
+  Level* pLevel = pNode->pLevel;
+  if ( pNode->pPrev ) pNode->pPrev->pNext = pNode->pNext;
+  else pLevel->pHead = pNode->pNext;
+  if ( pNode->pNext ) pNode->pNext->pPrev = pNode->pPrev;
+  else pLevel->pTail = pNode->pPrev;
+
+  if ( !pLevel->pHead )
+  {
+    bool buy = pNode->order.getSide() == Order::buy;
+    Levels& levels = buy ? m_bids : m_asks;
+    // levels mostly empty out at the top of the book, which is last
+    if ( levels.back() == pLevel )
+      levels.pop_back();
+    else
+      levels.erase( std::lower_bound
+        ( levels.begin(), levels.end(), pLevel->price, LevelBefore( buy ) ) );
+    m_levels.release( pLevel );
+  }
+
+  unindex( pNode );
+  pNode->~Node();
+  m_nodes.release( pNode );
 }
@@ -23,29 +23,131 @@
 #define ORDERMATCH_MARKET_H
 
 #include "Order.h"
-#include <map>
 #include <queue>
+#include <vector>
 #include <string>
-#include <functional>
 
+/// Hands out fixed size blocks from chunks that are never given back
+template < size_t Size >
+class Pool
+{
+public:
+  Pool() : m_pFree( 0 ) {}
+  ~Pool()
+  {
+    for ( size_t i = 0; i < m_chunks.size(); ++i )
+      ::operator delete( m_chunks[ i ] );
+  }
+
+  void* allocate()
+  {
+    if ( !m_pFree ) grow();
+    Free* pFree = m_pFree;
+    m_pFree = pFree->pNext;
+    return pFree;
+  }
+
+  void release( void* p )
+  {
+    Free* pFree = static_cast < Free* > ( p );
+    pFree->pNext = m_pFree;
+    m_pFree = pFree;
+  }
+
+private:
+  struct Free { Free* pNext; };
+  enum { SLOT = ( Size + 15 ) & ~15, COUNT = 256 };
+
+  Pool( const Pool& );
+  Pool& operator=( const Pool& );
+
+  void grow()
+  {
+    char* pChunk = static_cast < char* > ( ::operator new( SLOT * COUNT ) );
+    m_chunks.push_back( pChunk );
+    for ( size_t i = COUNT; i > 0; --i )
+      release( pChunk + ( i - 1 ) * SLOT );
+  }
+
+  Free* m_pFree;
+  std::vector < char* > m_chunks;
+};
+
+/**
+ * The book of one symbol.
+ *
+ * Prices are kept in ticks.  Each side is an array of price levels sorted
+ * so the best one is last, and each level holds its orders in a list in
+ * the order they arrived.  Orders are also indexed by owner and client id
+ * in a hash table, so they are found and taken off the book without a
+ * search.  Orders and levels come from pools, once the book has grown
+ * nothing is allocated to add or remove an order.
+ */
 class Market
 {
 public:
+  Market( double tickSize = 0.0001 );
+  ~Market();
+
+  /// Rest an order on the book, false if its id is already there
   bool insert( const Order& order );
   void erase( const Order& order );
-  Order& find( Order::Side side, std::string id );
+  Order& find( Order::Side side, const std::string& owner, const std::string& id );
   bool match( std::queue < Order > & );
   void display() const;
 
+  /// Number of orders resting on the book
+  size_t size() const { return m_size; }
+
 private:
-  typedef std::multimap < double, Order, std::greater < double > > BidOrders;
-  typedef std::multimap < double, Order, std::less < double > > AskOrders;
+  struct Level;
+
+  struct Node
+  {
+    Node( const Order& order, long price, size_t hash )
+    : order( order ), price( price ), hash( hash ),
+      pLevel( 0 ), pPrev( 0 ), pNext( 0 ), pHashNext( 0 ) {}
+
+    Order order;
+    long price;
+    size_t hash;
+    Level* pLevel;
+    Node* pPrev;
+    Node* pNext;
+    Node* pHashNext;
+  };
+
+  struct Level
+  {
+    long price;
+    Node* pHead;
+    Node* pTail;
+  };
+
+  typedef std::vector < Level* > Levels;
+
+  Market( const Market& );
+  Market& operator=( const Market& );
+
+  long toTicks( double price ) const;
+  static size_t hash( const std::string& owner, const std::string& id );
+
+  Node* lookup( const std::string& owner, const std::string& id ) const;
+  void index( Node* pNode );
+  void unindex( Node* pNode );
 
+  Level* level( Order::Side side, long price );
+  void remove( Node* pNode );
   void match( Order& bid, Order& ask );
 
-  std::queue < Order > m_orderUpdates;
-  BidOrders m_bidOrders;
-  AskOrders m_askOrders;
+  double m_tickSize;
+  size_t m_size;
+  // bids from the lowest price up, asks from the highest down
+  Levels m_bids;
+  Levels m_asks;
+  std::vector < Node* > m_index;
+  Pool < sizeof( Node ) > m_nodes;
+  Pool < sizeof( Level ) > m_levels;
 };
 
 #endif
@@ -28,63 +28,79 @@
 
 class OrderMatcher
 {
-  typedef std::map < std::string, Market > Markets;
+  typedef std::map < std::string, Market* > Markets;
 public:
+  OrderMatcher() {}
+  ~OrderMatcher()
+  {
+    Markets::iterator i;
+    for ( i = m_markets.begin(); i != m_markets.end(); ++i )
+      delete i->second;
+  }
+
   bool insert( const Order& order )
   {
     Markets::iterator i = m_markets.find( order.getSymbol() );
     if ( i == m_markets.end() )
-      i = m_markets.insert( std::make_pair( order.getSymbol(), Market() ) ).first;
-    return i->second.insert( order );
+      i = m_markets.insert( std::make_pair( order.getSymbol(), new Market() ) ).first;
+    return i->second->insert( order );
   }
 
   void erase( const Order& order )
   {
     Markets::iterator i = m_markets.find( order.getSymbol() );
     if ( i == m_markets.end() ) return ;
-    i->second.erase( order );
+    i->second->erase( order );
   }
 
-  Order& find( std::string symbol, Order::Side side, std::string id )
+  Order& find( const std::string& symbol, Order::Side side,
+               const std::string& owner, const std::string& id )
   {
     Markets::iterator i = m_markets.find( symbol );
     if ( i == m_markets.end() ) throw std::exception();
-    return i->second.find( side, id );
+    return i->second->find( side, owner, id );
   }
 
-  bool match( std::string symbol, std::queue < Order > & orders )
+  bool match( const std::string& symbol, std::queue < Order > & orders )
   {
     Markets::iterator i = m_markets.find( symbol );
     if ( i == m_markets.end() ) return false;
-    return i->second.match( orders );
+    return i->second->match( orders );
   }
 
   bool match( std::queue < Order > & orders )
   {
     Markets::iterator i;
     for ( i = m_markets.begin(); i != m_markets.end(); ++i )
-      i->second.match( orders );
+      i->second->match( orders );
     return orders.size() != 0;
   }
 
-  void display( std::string symbol ) const
+  void display( const std::string& symbol ) const
   {
     Markets::const_iterator i = m_markets.find( symbol );
     if ( i == m_markets.end() ) return ;
-    i->second.display();
+    i->second->display();
   }
 
   void display() const
   {
     std::cout << "SYMBOLS:" << std::endl;
     std::cout << "--------" << std::endl;
+    displaySymbols();
+  }
 
+  void displaySymbols() const
+  {
     Markets::const_iterator i;
     for ( i = m_markets.begin(); i != m_markets.end(); ++i )
       std::cout << i->first << std::endl;
   }
 
 private:
+  OrderMatcher( const OrderMatcher& );
+  OrderMatcher& operator=( const OrderMatcher& );
+
   Markets m_markets;
 };
 
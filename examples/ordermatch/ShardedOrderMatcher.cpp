@@ -0,0 +1,189 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#else
+#include "config.h"
+#endif
+
+#include "ShardedOrderMatcher.h"
+#include "quickfix/Exceptions.h"
+#include <iostream>
+
+ShardedOrderMatcher::ShardedOrderMatcher
+( Processor& processor, size_t shards, size_t capacity )
+: m_processor( processor ), m_stop( false ), m_running( false )
+{
+  if ( shards == 0 ) shards = 1;
+  for ( size_t i = 0; i < shards; ++i )
+    m_shards.push_back( new Shard( *this, capacity ) );
+
+  m_running = true;
+  for ( size_t i = 0; i < shards; ++i )
+  {
+    if ( !FIX::thread_spawn( &shardThread, m_shards[ i ], m_shards[ i ]->thread ) )
+    {
+      stop();
+      throw FIX::RuntimeError( "Unable to spawn shard thread" );
+    }
+  }
+}
+
+ShardedOrderMatcher::~ShardedOrderMatcher()
+{
+  stop();
+  for ( size_t i = 0; i < m_shards.size(); ++i )
+    delete m_shards[ i ];
+}
+
+void ShardedOrderMatcher::stop()
+{
+  if ( !m_running ) return;
+  m_running = false;
+  m_stop = true;
+  for ( size_t i = 0; i < m_shards.size(); ++i )
+  {
+    Shard& shard = *m_shards[ i ];
+    if ( !shard.thread ) continue;
+    shard.work.signal();
+    FIX::thread_join( shard.thread );
+  }
+}
+
+long ShardedOrderMatcher::getProcessedCount() const
+{
+  long count = 0;
+  for ( size_t i = 0; i < m_shards.size(); ++i )
+    count += ( long ) m_shards[ i ]->queue.popped();
+  return count;
+}
+
+void ShardedOrderMatcher::display( const std::string& symbol ) const
+{
+  Shard& owner = shard( symbol );
+  FIX::Locker locker( owner.mutex );
+  owner.matcher.display( symbol );
+}
+
+void ShardedOrderMatcher::display() const
+{
+  std::cout << "SYMBOLS:" << std::endl;
+  std::cout << "--------" << std::endl;
+
+  for ( size_t i = 0; i < m_shards.size(); ++i )
+  {
+    FIX::Locker locker( m_shards[ i ]->mutex );
+    m_shards[ i ]->matcher.displaySymbols();
+  }
+}
+
+bool ShardedOrderMatcher::submit( Type type, const Order& order )
+{
+  if ( m_stop ) return false;
+
+  Shard& owner = shard( order.getSymbol() );
+  uint64_t position;
+  Request* pRequest;
+  if ( !( pRequest = owner.queue.claim( position ) ) )
+  {
+    ++owner.blocked;
+    while ( !( pRequest = owner.queue.claim( position ) ) && !m_stop )
+    {
+      owner.work.signal();
+      owner.space.wait( 0.001 );
+    }
+    --owner.blocked;
+    if ( !pRequest ) return false;
+  }
+
+  pRequest->type = type;
+  pRequest->order = order;
+  owner.queue.publish( position );
+  if ( owner.sleeping ) owner.work.signal();
+  return true;
+}
+
+ShardedOrderMatcher::Shard& ShardedOrderMatcher::shard( const std::string& symbol ) const
+{
+  // FNV-1a, so a symbol always lands on the same shard
+  unsigned long hash = 2166136261U;
+  for ( std::string::const_iterator i = symbol.begin(); i != symbol.end(); ++i )
+    hash = ( hash ^ ( unsigned char ) *i ) * 16777619U;
+  return *m_shards[ hash % m_shards.size() ];
+}
+
+THREAD_PROC ShardedOrderMatcher::shardThread( void* p )
+{
+  Shard* pShard = static_cast < Shard* > ( p );
+  pShard->owner.run( *pShard );
+  return 0;
+}
+
+void ShardedOrderMatcher::run( Shard& shard )
+{
+  int idle = 0;
+  while ( true )
+  {
+    size_t count = 0;
+    {
+      FIX::Locker locker( shard.mutex );
+      Request* pRequest;
+      while ( count < BATCH && ( pRequest = shard.queue.front( count ) ) )
+      {
+        try
+        {
+          if ( pRequest->type == ORDER )
+            m_processor.processOrder( shard.matcher, pRequest->order );
+          else
+            m_processor.processCancel( shard.matcher, pRequest->order );
+        }
+        catch ( std::exception& ) {}
+        ++count;
+      }
+    }
+
+    if ( count )
+    {
+      shard.queue.pop( count );
+      idle = 0;
+      if ( shard.blocked ) shard.space.signal();
+    }
+    // everything queued before stop() is processed first
+    else if ( m_stop && shard.queue.empty() )
+    {
+      break;
+    }
+    else if ( ++idle >= SPIN )
+    {
+      sleep( shard );
+      idle = 0;
+    }
+  }
+}
+
+void ShardedOrderMatcher::sleep( Shard& shard )
+{
+  // announce the sleep before looking at the queue a last time, so a
+  // submit either is seen here or sees the flag and signals the event
+  ++shard.sleeping;
+  if ( shard.queue.empty() && !m_stop )
+    shard.work.wait( 1 );
+  --shard.sleeping;
+}
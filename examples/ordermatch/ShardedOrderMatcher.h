@@ -0,0 +1,122 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef ORDERMATCH_SHARDEDORDERMATCHER_H
+#define ORDERMATCH_SHARDEDORDERMATCHER_H
+
+#include "OrderMatcher.h"
+#include "quickfix/MpscQueue.h"
+#include "quickfix/AtomicCount.h"
+#include "quickfix/AutoResetEvent.h"
+#include "quickfix/Mutex.h"
+#include "quickfix/Utility.h"
+#include <vector>
+
+/**
+ * Matches orders on a fixed pool of threads, one per shard.
+ *
+ * Every symbol belongs to one shard, which owns the books of its symbols
+ * and is the only thread to touch them, so shards match in parallel
+ * without sharing anything.  Session threads hand orders and cancels to
+ * the shard of the symbol through a queue of its own and go on; the shard
+ * takes them in the order they were queued, so everything sent for an
+ * order is processed, and reported, in order.  The processor is called on
+ * the shard threads with the matcher of the shard.
+ */
+class ShardedOrderMatcher
+{
+public:
+  class Processor
+  {
+  public:
+    virtual ~Processor() {}
+    virtual void processOrder( OrderMatcher&, const Order& ) = 0;
+    /// The order carries the owner, id, symbol and side to cancel
+    virtual void processCancel( OrderMatcher&, const Order& ) = 0;
+  };
+
+  /// Starts the shard threads, capacity is the number of queued requests
+  ShardedOrderMatcher( Processor& processor, size_t shards,
+                       size_t capacity = 65536 );
+  ~ShardedOrderMatcher();
+
+  /// Queue an order for its shard, waiting while the queue is full
+  bool submitOrder( const Order& order )
+  { return submit( ORDER, order ); }
+  /// Queue a cancel for its shard, waiting while the queue is full
+  bool submitCancel( const Order& order )
+  { return submit( CANCEL, order ); }
+  /// Process everything queued so far and stop the shard threads
+  void stop();
+
+  size_t getShardCount() const { return m_shards.size(); }
+  /// Number of requests processed since the start
+  long getProcessedCount() const;
+
+  void display( const std::string& symbol ) const;
+  void display() const;
+
+private:
+  enum Type { ORDER, CANCEL };
+  enum { BATCH = 64, SPIN = 1000 };
+
+  struct Request
+  {
+    Request() : type( ORDER ) {}
+    Type type;
+    Order order;
+  };
+
+  struct Shard
+  {
+    Shard( ShardedOrderMatcher& owner, size_t capacity )
+    : owner( owner ), queue( capacity ),
+      blocked( 0 ), sleeping( 0 ), thread( 0 ) {}
+
+    ShardedOrderMatcher& owner;
+    FIX::MpscQueue < Request > queue;
+    OrderMatcher matcher;
+    // held while requests are processed, so display can look at the books
+    mutable FIX::Mutex mutex;
+    FIX::AutoResetEvent work;
+    FIX::AutoResetEvent space;
+    FIX::atomic_count blocked;
+    FIX::atomic_count sleeping;
+    FIX::thread_id thread;
+  };
+
+  ShardedOrderMatcher( const ShardedOrderMatcher& );
+  ShardedOrderMatcher& operator=( const ShardedOrderMatcher& );
+
+  bool submit( Type type, const Order& order );
+  Shard& shard( const std::string& symbol ) const;
+
+  static THREAD_PROC shardThread( void* p );
+  void run( Shard& shard );
+  void sleep( Shard& shard );
+
+  Processor& m_processor;
+  std::vector < Shard* > m_shards;
+  volatile bool m_stop;
+  bool m_running;
+};
+
+#endif
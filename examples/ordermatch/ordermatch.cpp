@@ -30,22 +30,24 @@
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <cstdlib>
 
 int main( int argc, char** argv )
 {
-  if ( argc != 2 )
+  if ( argc != 2 && argc != 3 )
   {
     std::cout << "usage: " << argv[ 0 ]
-    << " FILE." << std::endl;
+    << " FILE [MATCHER_THREADS]." << std::endl;
     return 0;
   }
   std::string file = argv[ 1 ];
+  size_t shards = argc == 3 ? atoi( argv[ 2 ] ) : 1;
 
   try
   {
     FIX::SessionSettings settings( file );
 
-    Application application;
+    Application application( shards );
     FIX::FileStoreFactory storeFactory( settings );
     FIX::ScreenLogFactory logFactory( settings );
     FIX::SocketAcceptor acceptor( application, storeFactory, settings, logFactory );
@@ -25,6 +25,10 @@
 
 #include <UnitTest++.h>
 #include "OrderMatcher.h"
+#include "ShardedOrderMatcher.h"
+#include "IDGenerator.h"
+#include <map>
+#include <sstream>
 
 TEST( matchFull )
 {
@@ -327,3 +331,169 @@ TEST( overMatch )
   CHECK_EQUAL(10, matchedOrder2.getLastExecutedQuantity());
 
 }
+
+TEST( insertDuplicate )
+{
+  OrderMatcher object;
+  Order order1("1", "LNUX", "OWNER1", "TARGET",
+               Order::buy, Order::limit, 12.32, 100);
+  Order order2("1", "LNUX", "OWNER1", "TARGET",
+               Order::sell, Order::limit, 12.40, 100);
+  Order order3("1", "LNUX", "OWNER2", "TARGET",
+               Order::sell, Order::limit, 12.40, 100);
+
+  CHECK(object.insert(order1));
+  CHECK(!object.insert(order2));
+  // ids only have to be unique for their owner
+  CHECK(object.insert(order3));
+}
+
+TEST( findAndErase )
+{
+  OrderMatcher object;
+  Order order1("1", "LNUX", "OWNER1", "TARGET",
+               Order::buy, Order::limit, 12.32, 100);
+  Order order2("2", "LNUX", "OWNER1", "TARGET",
+               Order::buy, Order::limit, 12.32, 100);
+  Order order3("3", "LNUX", "OWNER2", "TARGET",
+               Order::sell, Order::limit, 12.32, 50);
+
+  CHECK(object.insert(order1));
+  CHECK(object.insert(order2));
+
+  CHECK_EQUAL("2", object.find("LNUX", Order::buy, "OWNER1", "2").getClientID());
+  CHECK_THROW(object.find("LNUX", Order::sell, "OWNER1", "2"), std::exception);
+  CHECK_THROW(object.find("LNUX", Order::buy, "OWNER2", "2"), std::exception);
+  CHECK_THROW(object.find("MSFT", Order::buy, "OWNER1", "2"), std::exception);
+
+  // the next order at the level fills once the first is gone
+  object.erase(order1);
+  CHECK_THROW(object.find("LNUX", Order::buy, "OWNER1", "1"), std::exception);
+  CHECK(object.insert(order3));
+
+  std::queue<Order> orders;
+  CHECK(object.match("LNUX", orders));
+  CHECK_EQUAL(2U, orders.size());
+  CHECK_EQUAL("2", orders.front().getClientID());
+  CHECK_EQUAL(50, object.find("LNUX", Order::buy, "OWNER1", "2").getOpenQuantity());
+}
+
+TEST( matchAcrossLevels )
+{
+  OrderMatcher object;
+  for( int i = 0; i < 100; ++i )
+  {
+    std::stringstream id;
+    id << i;
+    // asks from 13.00 down to 12.01 in cents, inserted out of order
+    double price = 12.01 + ( ( i * 37 ) % 100 ) * 0.01;
+    CHECK(object.insert(Order(id.str(), "LNUX", "OWNER1", "TARGET",
+                              Order::sell, Order::limit, price, 10)));
+  }
+
+  Order bid("BID", "LNUX", "OWNER2", "TARGET",
+            Order::buy, Order::limit, 12.055, 1000);
+  CHECK(object.insert(bid));
+
+  // only the asks priced at or below the bid fill, cheapest first
+  std::queue<Order> orders;
+  CHECK(object.match("LNUX", orders));
+  CHECK_EQUAL(10U, orders.size());
+
+  double lastPrice = 0;
+  while( orders.size() )
+  {
+    orders.pop();
+    CHECK(orders.front().getLastExecutedPrice() > lastPrice);
+    lastPrice = orders.front().getLastExecutedPrice();
+    orders.pop();
+  }
+  CHECK_CLOSE(12.05, lastPrice, 0.0001);
+}
+
+TEST( generateIDs )
+{
+  IDGenerator object;
+  CHECK_EQUAL("1", object.genOrderID());
+  CHECK_EQUAL("2", object.genOrderID());
+  CHECK_EQUAL("1", object.genExecutionID());
+  for( int i = 0; i < 7; ++i ) object.genExecutionID();
+  CHECK_EQUAL("9", object.genExecutionID());
+  CHECK_EQUAL("10", object.genExecutionID());
+}
+
+namespace
+{
+// records the ids seen for every symbol and the shard matcher they came with
+class RecordingProcessor : public ShardedOrderMatcher::Processor
+{
+public:
+  void processOrder( OrderMatcher& matcher, const Order& order )
+  {
+    matcher.insert( order );
+    record( matcher, order );
+  }
+
+  void processCancel( OrderMatcher& matcher, const Order& order )
+  {
+    matcher.erase( matcher.find( order.getSymbol(), order.getSide(),
+                                 order.getOwner(), order.getClientID() ) );
+    record( matcher, order );
+  }
+
+  FIX::Mutex mutex;
+  std::map<std::string, std::vector<std::string> > ids;
+  std::map<std::string, OrderMatcher*> matchers;
+
+private:
+  void record( OrderMatcher& matcher, const Order& order )
+  {
+    FIX::Locker locker( mutex );
+    ids[order.getSymbol()].push_back( order.getClientID() );
+    OrderMatcher*& pMatcher = matchers[order.getSymbol()];
+    if( !pMatcher ) pMatcher = &matcher;
+    CHECK_EQUAL(pMatcher, &matcher);
+  }
+};
+}
+
+TEST( shardRequestsBySymbol )
+{
+  RecordingProcessor processor;
+  ShardedOrderMatcher object( processor, 3, 16 );
+  CHECK_EQUAL(3U, object.getShardCount());
+
+  const char* symbols[] = { "LNUX", "MSFT", "IBM", "ORCL", "AAPL" };
+  for( int i = 0; i < 500; ++i )
+  {
+    std::stringstream id;
+    id << i;
+    CHECK(object.submitOrder(Order(id.str(), symbols[i % 5], "OWNER1", "TARGET",
+                                   Order::buy, Order::limit, 10 + i % 7, 100)));
+  }
+  for( int i = 0; i < 500; i += 2 )
+  {
+    std::stringstream id;
+    id << i;
+    CHECK(object.submitCancel(Order(id.str(), symbols[i % 5], "OWNER1", "TARGET",
+                                    Order::buy, Order::limit, 0, 0)));
+  }
+
+  // everything queued before the stop is processed, in the order queued
+  object.stop();
+  CHECK_EQUAL(750, object.getProcessedCount());
+  CHECK(!object.submitOrder(Order("500", "LNUX", "OWNER1", "TARGET",
+                                  Order::buy, Order::limit, 10, 100)));
+
+  for( int s = 0; s < 5; ++s )
+  {
+    const std::vector<std::string>& ids = processor.ids[symbols[s]];
+    CHECK_EQUAL(150U, ids.size());
+    for( size_t i = 0; i < ids.size(); ++i )
+    {
+      std::stringstream id;
+      id << ( i < 100 ? s + i * 5 : s + ( i - 100 ) * 10 + ( s % 2 ? 5 : 0 ) );
+      CHECK_EQUAL(id.str(), ids[i]);
+    }
+  }
+}
@@ -0,0 +1,264 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#else
+#include "config.h"
+#endif
+
+#include "OrderMatcher.h"
+#include "ShardedOrderMatcher.h"
+#include "IDGenerator.h"
+#include "LatencyHistogram.h"
+#include "fix42/ExecutionReport.h"
+#include <vector>
+#include <sstream>
+#include <cstdlib>
+#include <iostream>
+
+/*
+ * Replays streams of order adds and cancels, matching after every add as
+ * the ordermatch application does.  Prices scatter around a fixed mid so
+ * the books stay a few hundred levels deep and a share of the adds cross
+ * the spread.
+ *
+ *   ordermatch_pt [COUNT] [SESSIONS] [SHARDS]
+ *
+ * One stream is first replayed against a single OrderMatcher.  Then
+ * SESSIONS threads each replay a stream of their own over 26 symbols into
+ * a ShardedOrderMatcher, which builds an ExecutionReport for every update
+ * as the application does before sending it, once on one shard and once
+ * on SHARDS.
+ */
+
+namespace
+{
+const char* OWNERS[] = { "OWNER1", "OWNER2", "OWNER3", "OWNER4" };
+
+/// Deterministic stream of adds and cancels of resting orders
+class OrderStream
+{
+public:
+  OrderStream( unsigned long seed, const std::string& owner, int symbols )
+  : m_seed( seed ), m_owner( owner ), m_symbols( symbols ) {}
+
+  /// Next order to add, false if it is one to cancel
+  bool next( Order& order )
+  {
+    if ( m_live.size() && nextRandom() % 10 < 3 )
+    {
+      // cancel a resting order, some of them have filled already
+      size_t index = nextRandom() % m_live.size();
+      order = m_live[ index ];
+      m_live[ index ] = m_live.back();
+      m_live.pop_back();
+      return false;
+    }
+
+    Order::Side side = nextRandom() % 2 ? Order::buy : Order::sell;
+    long offset = ( long ) ( nextRandom() % 300 );
+    long ticks = 10000 + ( side == Order::buy ? 10 - offset : offset - 10 );
+    std::string owner = m_owner.size() ? m_owner : OWNERS[ nextRandom() % 4 ];
+    std::string symbol = "SYM";
+    symbol += ( char ) ( 'A' + nextRandom() % m_symbols );
+    order = Order( m_generator.genOrderID(), symbol, owner, "TARGET",
+                   side, Order::limit, ticks * 0.01, 100 * ( 1 + nextRandom() % 10 ) );
+    if ( m_live.size() < 100000 )
+      m_live.push_back( order );
+    return true;
+  }
+
+private:
+  unsigned long nextRandom()
+  {
+    // the LCG of the C standard, so every run replays the same stream
+    m_seed = m_seed * 1103515245 + 12345;
+    return ( m_seed / 65536 ) % 32768;
+  }
+
+  unsigned long m_seed;
+  std::string m_owner;
+  int m_symbols;
+  IDGenerator m_generator;
+  std::vector < Order > m_live;
+};
+
+/// Matches as the application does, building reports instead of sending
+class Processor : public ShardedOrderMatcher::Processor
+{
+public:
+  Processor() : m_reports( 0 ) {}
+
+  void processOrder( OrderMatcher& matcher, const Order& order )
+  {
+    if ( !matcher.insert( order ) )
+      return;
+    report( order, FIX::OrdStatus_NEW );
+
+    std::queue < Order > orders;
+    matcher.match( order.getSymbol(), orders );
+    for ( ; orders.size(); orders.pop() )
+    {
+      const Order& filled = orders.front();
+      report( filled, filled.isFilled()
+              ? FIX::OrdStatus_FILLED : FIX::OrdStatus_PARTIALLY_FILLED );
+    }
+  }
+
+  void processCancel( OrderMatcher& matcher, const Order& cancel )
+  {
+    Order& order = matcher.find( cancel.getSymbol(), cancel.getSide(),
+                                 cancel.getOwner(), cancel.getClientID() );
+    order.cancel();
+    report( order, FIX::OrdStatus_CANCELED );
+    matcher.erase( order );
+  }
+
+  long getReports() const { return m_reports; }
+
+private:
+  void report( const Order& order, char status )
+  {
+    FIX42::ExecutionReport executionReport
+    ( FIX::OrderID( order.getClientID() ),
+      FIX::ExecID( m_generator.genExecutionID() ),
+      FIX::ExecTransType( FIX::ExecTransType_NEW ),
+      FIX::ExecType( status ),
+      FIX::OrdStatus( status ),
+      FIX::Symbol( order.getSymbol() ),
+      FIX::Side( order.getSide() == Order::buy ? FIX::Side_BUY : FIX::Side_SELL ),
+      FIX::LeavesQty( order.getOpenQuantity() ),
+      FIX::CumQty( order.getExecutedQuantity() ),
+      FIX::AvgPx( order.getAvgExecutedPrice() ) );
+    executionReport.getHeader().setField( FIX::SenderCompID( order.getTarget() ) );
+    executionReport.getHeader().setField( FIX::TargetCompID( order.getOwner() ) );
+    executionReport.toString();
+    ++m_reports;
+  }
+
+  IDGenerator m_generator;
+  FIX::atomic_count m_reports;
+};
+
+struct Session
+{
+  ShardedOrderMatcher* pMatcher;
+  OrderStream* pStream;
+  long count;
+  FIX::thread_id thread;
+};
+
+THREAD_PROC sessionThread( void* p )
+{
+  Session* pSession = static_cast < Session* > ( p );
+  for ( long i = 0; i < pSession->count; ++i )
+  {
+    Order order;
+    if ( pSession->pStream->next( order ) )
+      pSession->pMatcher->submitOrder( order );
+    else
+      pSession->pMatcher->submitCancel( order );
+  }
+  return 0;
+}
+
+void report( const std::string& name, long count, int64_t nanos )
+{
+  double seconds = nanos / 1e9;
+  std::cout << name << ": " << std::endl
+  << "    num: " << count << ", seconds: " << seconds
+  << ", num_per_second: " << ( seconds > 0 ? count / seconds : 0 ) << std::endl
+  << "    ns/op mean: " << ( double ) nanos / count << std::endl;
+}
+
+void replay( long count )
+{
+  OrderMatcher matcher;
+  OrderStream stream( 1, "", 1 );
+  std::queue < Order > orders;
+  long fills = 0;
+
+  int64_t start = FIX::LatencyHistogram::now();
+  for ( long i = 0; i < count; ++i )
+  {
+    Order order;
+    if ( !stream.next( order ) )
+    {
+      matcher.erase( order );
+      continue;
+    }
+
+    matcher.insert( order );
+    if ( matcher.match( order.getSymbol(), orders ) )
+    {
+      fills += ( long ) orders.size();
+      while ( orders.size() ) orders.pop();
+    }
+  }
+  report( "Replaying order adds, cancels and matches", count,
+          FIX::LatencyHistogram::now() - start );
+  std::cout << "    fills: " << fills << std::endl;
+}
+
+void replaySessions( long count, int sessions, size_t shards )
+{
+  Processor processor;
+  ShardedOrderMatcher matcher( processor, shards );
+  std::vector < Session > threads( sessions );
+
+  int64_t start = FIX::LatencyHistogram::now();
+  for ( int i = 0; i < sessions; ++i )
+  {
+    std::stringstream owner;
+    owner << "OWNER" << i;
+    threads[ i ].pMatcher = &matcher;
+    threads[ i ].pStream = new OrderStream( i + 1, owner.str(), 26 );
+    threads[ i ].count = count / sessions;
+    FIX::thread_spawn( &sessionThread, &threads[ i ], threads[ i ].thread );
+  }
+  for ( int i = 0; i < sessions; ++i )
+  {
+    FIX::thread_join( threads[ i ].thread );
+    delete threads[ i ].pStream;
+  }
+  matcher.stop();
+  int64_t nanos = FIX::LatencyHistogram::now() - start;
+
+  std::stringstream name;
+  name << "Matching orders from " << sessions << " sessions on "
+       << matcher.getShardCount() << " shards";
+  report( name.str(), matcher.getProcessedCount(), nanos );
+  std::cout << "    reports: " << processor.getReports() << std::endl;
+}
+}
+
+int main( int argc, char** argv )
+{
+  long count = argc > 1 ? atol( argv[ 1 ] ) : 2000000;
+  int sessions = argc > 2 ? atoi( argv[ 2 ] ) : 8;
+  size_t shards = argc > 3 ? atoi( argv[ 3 ] ) : 4;
+  if ( sessions < 1 ) sessions = 1;
+
+  replay( count );
+  replaySessions( count / 4, sessions, 1 );
+  if ( shards > 1 )
+    replaySessions( count / 4, sessions, shards );
+  return 0;
+}
@@ -0,0 +1,71 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#else
+#include "config.h"
+#endif
+
+#include "Application.h"
+#include "quickfix/Session.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+void Application::fromAdmin( const FIX::Message& message,
+                             const FIX::SessionID& )
+EXCEPT( FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue, FIX::RejectLogon )
+{
+  if( !message.isSetField( FIX::FIELD::TestReqID ) ) return;
+  const std::string& testReqID = message.getField( FIX::FIELD::TestReqID );
+  if( testReqID.compare( 0, 7, "replay-" ) != 0 ) return;
+
+  int64_t sent = strtoll( testReqID.c_str() + 7, 0, 10 );
+  FIX::Locker l( m_mutex );
+  m_probes.recordSince( sent );
+  m_lastProbe = sent;
+}
+
+int64_t Application::sendProbe( FIX::Session& session )
+{
+  int64_t now = FIX::LatencyHistogram::now();
+  char testReqID[ 32 ];
+  snprintf( testReqID, sizeof( testReqID ), "replay-%lld",
+            static_cast<long long>( now ) );
+
+  FIX::Message testRequest;
+  testRequest.getHeader().setField( FIX::MsgType( FIX::MsgType_TestRequest ) );
+  testRequest.setField( FIX::TestReqID( testReqID ) );
+  session.send( testRequest );
+  return now;
+}
+
+int64_t Application::getLastProbe()
+{
+  FIX::Locker l( m_mutex );
+  return m_lastProbe;
+}
+
+void Application::getProbes( FIX::LatencyHistogram& histogram )
+{
+  FIX::Locker l( m_mutex );
+  histogram = m_probes;
+}
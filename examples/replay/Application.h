@@ -0,0 +1,69 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifndef REPLAY_APPLICATION_H
+#define REPLAY_APPLICATION_H
+
+#include "quickfix/Application.h"
+#include "quickfix/AtomicCount.h"
+#include "quickfix/LatencyHistogram.h"
+#include "quickfix/Mutex.h"
+
+namespace FIX { class Session; }
+
+/// Counterparty side of a replay.  Counts what the engine under test
+/// sends back and times test request probes, which queue behind the
+/// replayed messages and so show how far behind the engine is running.
+class Application : public FIX::Application
+{
+public:
+  Application() : m_responses( 0 ), m_logons( 0 ), m_lastProbe( 0 ) {}
+
+  void onCreate( const FIX::SessionID& ) {}
+  void onLogon( const FIX::SessionID& ) { ++m_logons; }
+  void onLogout( const FIX::SessionID& ) { --m_logons; }
+  void toAdmin( FIX::Message&, const FIX::SessionID& ) {}
+  void toApp( FIX::Message&, const FIX::SessionID& )
+    EXCEPT( FIX::DoNotSend ) {}
+  void fromAdmin( const FIX::Message&, const FIX::SessionID& )
+    EXCEPT( FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue, FIX::RejectLogon );
+  void fromApp( const FIX::Message&, const FIX::SessionID& )
+    EXCEPT( FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue, FIX::UnsupportedMessageType )
+  { ++m_responses; }
+
+  /// Sends a test request stamped with the current time and returns the stamp
+  int64_t sendProbe( FIX::Session& session );
+
+  long getResponses() const { return m_responses; }
+  bool isLoggedOn() const { return m_logons > 0; }
+  int64_t getLastProbe();
+  void getProbes( FIX::LatencyHistogram& histogram );
+
+private:
+  FIX::atomic_count m_responses;
+  FIX::atomic_count m_logons;
+  FIX::Mutex m_mutex;
+  FIX::LatencyHistogram m_probes;
+  int64_t m_lastProbe;
+};
+
+#endif
@@ -0,0 +1,346 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#else
+#include "config.h"
+#endif
+
+#include "quickfix/MessageStore.h"
+#include "quickfix/FileLog.h"
+#include "quickfix/SocketAcceptor.h"
+#include "quickfix/SocketInitiator.h"
+#include "quickfix/Session.h"
+#include "quickfix/SessionSettings.h"
+#include "Application.h"
+
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <set>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+
+/// A captured application message and when it was originally sent
+struct Entry
+{
+  Entry( int64_t time, const std::string& message )
+  : time( time ), message( message ) {}
+
+  int64_t time;
+  std::string message;
+};
+
+void usage( const char* name )
+{
+  std::cout
+    << "usage: " << name << " [-s speed] [-c SenderCompID] [-i probe_ms]"
+    << " FILE.cfg CAPTURE" << std::endl << std::endl
+    << "CAPTURE is a FileLog messages file or a FileStore body file"
+    << " (with its header file" << std::endl
+    << "alongside).  The first session in FILE.cfg plays the counterparty"
+    << " and sends the" << std::endl
+    << "captured application messages with new sequence numbers and"
+    << " SendingTime." << std::endl << std::endl
+    << "speed: 1 keeps the captured timing, 10 is ten times faster,"
+    << " 0 is as fast as possible" << std::endl
+    << "-c:    replay only messages with this SenderCompID" << std::endl
+    << "-i:    interval between test request probes, default 100"
+    << std::endl;
+}
+
+bool isAdmin( const std::string& message )
+{
+  std::string::size_type type = message.find( "\00135=" );
+  if( type == std::string::npos || type + 5 >= message.size() ) return true;
+  return message[ type + 5 ] == '\001'
+    && std::string( "0A12345" ).find( message[ type + 4 ] ) != std::string::npos;
+}
+
+std::string getField( const std::string& message, const std::string& tag )
+{
+  std::string::size_type start = message.find( "\001" + tag + "=" );
+  if( start == std::string::npos ) return "";
+  start += tag.size() + 2;
+  return message.substr( start, message.find( '\001', start ) - start );
+}
+
+int64_t toNanos( const std::string& value )
+{
+  try
+  {
+    return FIX::UtcTimeStampConvertor::convert( value ).getNanosSinceEpoch();
+  }
+  catch( FIX::FieldConvertError& ) { return 0; }
+}
+
+/// Reads "timestamp : message" lines written by FileLog
+void readLog( std::istream& stream, std::vector<Entry>& entries )
+{
+  std::string line;
+  while( std::getline( stream, line ) )
+  {
+    std::string::size_type separator = line.find( " : 8=" );
+    if( separator == std::string::npos ) continue;
+    entries.push_back
+      ( Entry( toNanos( line.substr( 0, separator ) ),
+               line.substr( separator + 3 ) ) );
+  }
+}
+
+/// Reads the messages a FileStore kept, timed by their SendingTime
+void readStore( const std::string& bodyFile, std::vector<Entry>& entries )
+{
+  std::ifstream body( bodyFile.c_str(), std::ios::binary );
+  std::string headerFile =
+    bodyFile.substr( 0, bodyFile.size() - 4 ) + "header";
+  std::ifstream header( headerFile.c_str() );
+  if( !body || !header )
+    throw FIX::ConfigError( "Could not open " + bodyFile + " or " + headerFile );
+
+  int seqNum;
+  long offset;
+  unsigned long size;
+  char comma;
+  while( header >> seqNum >> comma >> offset >> comma >> size )
+  {
+    std::string message( size, '\0' );
+    body.seekg( offset );
+    if( !body.read( &message[ 0 ], size ) ) break;
+    entries.push_back( Entry( toNanos( getField( message, "52" ) ), message ) );
+  }
+}
+
+int main( int argc, char** argv )
+{
+  double speed = 1;
+  double probeInterval = 0.1;
+  std::string senderCompID;
+
+  int arg = 1;
+  for( ; arg + 1 < argc && argv[ arg ][ 0 ] == '-'; arg += 2 )
+  {
+    std::string option = argv[ arg ];
+    if( option == "-s" ) speed = atof( argv[ arg + 1 ] );
+    else if( option == "-c" ) senderCompID = argv[ arg + 1 ];
+    else if( option == "-i" ) probeInterval = atof( argv[ arg + 1 ] ) / 1000;
+    else arg = argc;
+  }
+  if( arg + 2 != argc || speed < 0 || probeInterval <= 0 )
+  {
+    usage( argv[ 0 ] );
+    return 1;
+  }
+  std::string file = argv[ arg ];
+  std::string capture = argv[ arg + 1 ];
+
+  Application application;
+  FIX::MemoryStoreFactory storeFactory;
+  SmartPtr<FIX::LogFactory> logFactory;
+  FIX::Initiator* initiator = 0;
+  FIX::Acceptor* acceptor = 0;
+  try
+  {
+    std::vector<Entry> entries;
+    if( capture.size() > 4 && capture.compare( capture.size() - 4, 4, "body" ) == 0 )
+      readStore( capture, entries );
+    else
+    {
+      std::ifstream stream( capture.c_str() );
+      if( !stream ) throw FIX::ConfigError( "Could not open " + capture );
+      readLog( stream, entries );
+    }
+
+    std::set<std::string> senders;
+    std::vector<Entry> replay;
+    for( size_t i = 0; i < entries.size(); ++i )
+    {
+      if( isAdmin( entries[ i ].message ) ) continue;
+      std::string sender = getField( entries[ i ].message, "49" );
+      senders.insert( sender );
+      if( senderCompID.empty() || sender == senderCompID )
+        replay.push_back( entries[ i ] );
+    }
+    if( senderCompID.empty() && senders.size() > 1 )
+    {
+      std::cout << "capture has messages from";
+      std::set<std::string>::const_iterator i;
+      for( i = senders.begin(); i != senders.end(); ++i )
+        std::cout << " " << *i;
+      std::cout << ", choose one with -c" << std::endl;
+      return 1;
+    }
+    if( replay.empty() )
+    {
+      std::cout << "no application messages to replay" << std::endl;
+      return 1;
+    }
+
+    FIX::SessionSettings settings( file );
+    if( settings.get().has( FIX::FILE_LOG_PATH ) )
+      logFactory.reset( new FIX::FileLogFactory( settings ) );
+
+    FIX::SessionID sessionID = *settings.getSessions().begin();
+    std::string connectionType =
+      settings.get( sessionID ).getString( FIX::CONNECTION_TYPE );
+    if( connectionType == "acceptor" )
+    {
+      acceptor = logFactory.get()
+        ? new FIX::SocketAcceptor( application, storeFactory, settings, *logFactory )
+        : new FIX::SocketAcceptor( application, storeFactory, settings );
+      acceptor->start();
+    }
+    else
+    {
+      initiator = logFactory.get()
+        ? new FIX::SocketInitiator( application, storeFactory, settings, *logFactory )
+        : new FIX::SocketInitiator( application, storeFactory, settings );
+      initiator->start();
+    }
+
+    FIX::Session& session = *FIX::Session::lookupSession( sessionID );
+
+    // Parse everything up front so replaying costs only the send
+    const FIX::DataDictionaryProvider& provider =
+      session.getDataDictionaryProvider();
+    const FIX::DataDictionary& sessionDictionary =
+      provider.getSessionDataDictionary( sessionID.getBeginString() );
+    const FIX::DataDictionary& applicationDictionary = sessionID.isFIXT()
+      ? provider.getApplicationDataDictionary
+          ( FIX::ApplVerID( session.getSenderDefaultApplVerID() ) )
+      : sessionDictionary;
+
+    std::vector<FIX::Message*> messages;
+    for( size_t i = 0; i < replay.size(); ++i )
+    {
+      FIX::Message* message = new FIX::Message;
+      try
+      {
+        message->setString( replay[ i ].message, false,
+                            &sessionDictionary, &applicationDictionary );
+      }
+      catch( FIX::InvalidMessage& e )
+      {
+        std::cout << "skipping " << replay[ i ].message << ": "
+                  << e.what() << std::endl;
+        delete message;
+        replay.erase( replay.begin() + i-- );
+        continue;
+      }
+      FIX::Header& header = message->getHeader();
+      header.removeField( FIX::FIELD::PossDupFlag );
+      header.removeField( FIX::FIELD::PossResend );
+      header.removeField( FIX::FIELD::OrigSendingTime );
+      messages.push_back( message );
+    }
+
+    std::cout << "replaying " << messages.size() << " messages as "
+              << sessionID << ", waiting for logon" << std::endl;
+    while( !application.isLoggedOn() )
+      FIX::process_sleep( 0.01 );
+
+    FIX::LatencyHistogram lag;
+    size_t maxQueuedMessages = 0, maxQueuedBytes = 0;
+    const int64_t probeNanos = static_cast<int64_t>( probeInterval * 1e9 );
+    const int64_t start = FIX::LatencyHistogram::now();
+    int64_t nextProbe = start;
+
+    for( size_t i = 0; i < messages.size(); ++i )
+    {
+      int64_t now = FIX::LatencyHistogram::now();
+      if( speed > 0 && replay[ i ].time && replay[ 0 ].time )
+      {
+        int64_t due = start + static_cast<int64_t>
+          ( ( replay[ i ].time - replay[ 0 ].time ) / speed );
+        while( now < due )
+        {
+          if( due - now > 200000 ) FIX::process_sleep( 0.0001 );
+          now = FIX::LatencyHistogram::now();
+        }
+        lag.record( now - due );
+      }
+
+      session.send( *messages[ i ] );
+      delete messages[ i ];
+
+      if( now >= nextProbe )
+      {
+        size_t queuedMessages, queuedBytes;
+        session.getSendQueue( queuedMessages, queuedBytes );
+        if( queuedMessages > maxQueuedMessages ) maxQueuedMessages = queuedMessages;
+        if( queuedBytes > maxQueuedBytes ) maxQueuedBytes = queuedBytes;
+        application.sendProbe( session );
+        nextProbe = now + probeNanos;
+      }
+    }
+
+    const int64_t sent = FIX::LatencyHistogram::now();
+    const long responsesWhenSent = application.getResponses();
+    const int64_t lastProbe = application.sendProbe( session );
+    while( application.getLastProbe() != lastProbe
+           && FIX::LatencyHistogram::now() - sent < 60 * 1000000000LL )
+      FIX::process_sleep( 0.001 );
+    const int64_t drained = FIX::LatencyHistogram::now();
+
+    FIX::LatencyHistogram probes;
+    application.getProbes( probes );
+
+    double seconds = ( sent - start ) / 1e9;
+    double captured = ( replay.back().time - replay.front().time ) / 1e9;
+    std::cout << std::fixed << std::setprecision( 1 )
+              << "replayed:     " << replay.size() << " messages in "
+              << seconds << "s (" << replay.size() / seconds << "/s), captured over "
+              << captured << "s" << std::endl;
+    if( lag.getCount() )
+      std::cout << "send lag us:  p50 " << lag.getValueAtPercentile( 50 ) / 1000.0
+                << " p99 " << lag.getValueAtPercentile( 99 ) / 1000.0
+                << " max " << lag.getMax() / 1000.0 << std::endl;
+    std::cout << "responses:    " << application.getResponses() << " ("
+              << responsesWhenSent << " while replaying)" << std::endl
+              << "send queue:   at most " << maxQueuedMessages << " messages, "
+              << maxQueuedBytes << " bytes" << std::endl
+              << "probe rtt us: p50 " << probes.getValueAtPercentile( 50 ) / 1000.0
+              << " p90 " << probes.getValueAtPercentile( 90 ) / 1000.0
+              << " p99 " << probes.getValueAtPercentile( 99 ) / 1000.0
+              << " max " << probes.getMax() / 1000.0
+              << " (" << probes.getCount() << " probes)" << std::endl;
+    if( application.getLastProbe() == lastProbe )
+      std::cout << "caught up:    " << ( drained - sent ) / 1e6
+                << "ms after the last message" << std::endl;
+    else
+      std::cout << "caught up:    not within 60s" << std::endl;
+
+    if( initiator ) initiator->stop();
+    if( acceptor ) acceptor->stop();
+  }
+  catch ( std::exception & e )
+  {
+    std::cout << e.what() << std::endl;
+    delete initiator;
+    delete acceptor;
+    return 1;
+  }
+
+  delete initiator;
+  delete acceptor;
+  return 0;
+}
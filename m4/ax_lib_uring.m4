@@ -0,0 +1,21 @@
+AC_DEFUN([AX_LIB_URING], [
+    has_io_uring=false
+    AC_ARG_WITH(io-uring,
+        [  --with-io-uring        will build the io_uring transport (Linux only)],
+        [if test $withval == "no"
+         then
+           has_io_uring=false
+         else
+           has_io_uring=true
+         fi],
+        has_io_uring=false
+    )
+
+    if test $has_io_uring = true
+    then
+        AC_CHECK_HEADER([linux/io_uring.h], [],
+          [AC_MSG_ERROR([--with-io-uring requires linux/io_uring.h])])
+        AC_DEFINE(HAVE_IO_URING, 1, Define to build the io_uring transport)
+    fi
+    AM_CONDITIONAL(HAVE_IO_URING, $has_io_uring)
+])
@@ -18,10 +18,14 @@ def aggregateFields( type, major, minor, sp, aggregator )
   Processor.new(xml, [aggregator]).processFields
 end
 
+# --decimal generates price, quantity, amount and percentage fields
+# as fixed point Decimal fields instead of doubles
+$decimal = ARGV.include?( "--decimal" )
+
 def generateVersion( type, major, minor, sp, verid, aggregator )
   dir = "../src"
   xml = versionXML( type, major, minor, sp )
-  cpp = GeneratorCPP.new(type, major.to_s, minor.to_s, sp.to_s, verid.to_s, "#{dir}/C++")
+  cpp = GeneratorCPP.new(type, major.to_s, minor.to_s, sp.to_s, verid.to_s, "#{dir}/C++", $decimal, aggregator.getFields)
   python = GeneratorPython.new(type, major.to_s, minor.to_s, sp.to_s, verid.to_s, "#{dir}/python")
   ruby = GeneratorRuby.new(type, major.to_s, minor.to_s, sp.to_s, verid.to_s, "#{dir}/ruby")
   processor = Processor.new(xml, [cpp, python, ruby]).process( aggregator )
@@ -1,8 +1,33 @@
 require 'PrintFile'
 
 class GeneratorCPP
-  def initialize(type, major, minor, sp, verid, basedir)
+  # Field types that can be generated as fixed point decimals
+  DECIMAL_TYPES = [ "PRICE", "QTY", "AMT", "PERCENTAGE" ]
+
+  # Flyweight accessor type and FlyweightReader getter of each field type,
+  # anything else is read as a string view
+  FLYWEIGHT_TYPES = {
+    "CHAR" => [ "char", "Char" ],
+    "BOOLEAN" => [ "bool", "Bool" ],
+    "INT" => [ "int", "Int" ],
+    "LENGTH" => [ "int", "Int" ],
+    "NUMINGROUP" => [ "int", "Int" ],
+    "SEQNUM" => [ "int", "Int" ],
+    "FLOAT" => [ "double", "Double" ],
+    "PRICEOFFSET" => [ "double", "Double" ],
+    "PRICE" => [ "FIX::Decimal", "Decimal" ],
+    "QTY" => [ "FIX::Decimal", "Decimal" ],
+    "AMT" => [ "FIX::Decimal", "Decimal" ],
+    "PERCENTAGE" => [ "FIX::Decimal", "Decimal" ]
+  }
+
+  # Written by FlyweightWriter itself
+  FLYWEIGHT_FRAMING = [ "BeginString", "BodyLength", "MsgType", "CheckSum" ]
+
+  def initialize(type, major, minor, sp, verid, basedir, decimal = false, fieldTypes = {})
     @type = type
+    @decimal = decimal
+    @fieldTypes = fieldTypes
     @major = major
     @minor = minor
     @namespace = type + major + minor
@@ -18,6 +43,8 @@ class GeneratorCPP
     @dir = basedir + "/" + @namespace.downcase
     @basefile = createVersionFile("Message.h")
     @f = @basefile
+    @groups = []
+    @flyweight = []
   end
 
   def createBaseFile(name)
@@ -34,6 +61,8 @@ class GeneratorCPP
     @f.puts
     @f.puts "#include \"../Message.h\""
     @f.puts "#include \"../Group.h\""
+    @f.puts "#include \"../GroupView.h\""
+    @f.puts "#include \"../Flyweight.h\""
     @f.puts
     @f.puts "namespace " + @namespace
     @f.puts "{"
@@ -43,9 +72,15 @@ class GeneratorCPP
     @f.indent
     @f.puts "FIELD_SET(*this, FIX::" + name + ");"
     @f.dedent
+    if @groups.empty?
+      @flyweight << name if !@flyweight.include?(name)
+    else
+      @groups.last[:fields] << name
+    end
   end
 
   def headerStart
+    @flyweight = []
     @f.indent
     @f.puts "class Header : public FIX::Header"
     @f.puts "{"
@@ -53,12 +88,14 @@ class GeneratorCPP
   end
 
   def headerEnd
+    @headerFields = @flyweight
     @f.puts "};"
     @f.puts
     @f.dedent
   end
 
   def trailerStart
+    @flyweight = []
     @f.indent
     @f.puts "class Trailer : public FIX::Trailer"
     @f.puts "{"
@@ -66,6 +103,7 @@ class GeneratorCPP
   end
 
   def trailerEnd
+    @trailerFields = @flyweight
     @f.puts "};"
     @f.puts
     @f.dedent
@@ -92,6 +130,26 @@ class GeneratorCPP
     @f.puts "const Header& getHeader() const { return (Header&)m_header; }"
     @f.puts "Trailer& getTrailer() { return (Trailer&)m_trailer; }"
     @f.puts "const Trailer& getTrailer() const { return (Trailer&)m_trailer; }"
+    @f.puts
+    @f.puts "class Reader : public FIX::FlyweightReader"
+    @f.puts "{"
+    @f.puts "public:"
+    flyweightReaderConstructors( "Reader", "FIX::FlyweightReader" )
+    flyweightGetters( @headerFields + @trailerFields )
+    @f.puts "};"
+    @f.puts
+    @f.puts "class Writer : public FIX::FlyweightWriter"
+    @f.puts "{"
+    @f.puts "public:"
+    @f.indent
+    applVerID = @verid == "0" ? "" : ", \"" + @verid + "\""
+    @f.puts "Writer( const char* msgType )"
+    @f.puts ": FIX::FlyweightWriter( \"" + @beginstring + "\", msgType" + applVerID + " ) {}"
+    @f.dedent
+    headerFields = @headerFields
+    headerFields = headerFields - [ "ApplVerID" ] if @verid != "0"
+    flyweightSetters( headerFields )
+    @f.puts "};"
     @f.dedent
     @f.puts "};"
     @f.puts
@@ -109,14 +167,93 @@ class GeneratorCPP
     @f.print name + "() : FIX::Group(" + number + "," + delim + "," + "FIX::message_order("
     order.each { |field| @f.printInline field + "," }
     @f.putsInline "0)) {}"
+    @groups.last[:groups] << name if !@groups.empty?
+    @groups.push( { :name => name, :fields => [], :groups => [] } )
   end
 
   def groupEnd
+    group = @groups.pop
+    @f.indent
+    @f.puts "class View : public FIX::GroupEntry"
+    @f.puts "{"
+    @f.puts "public:"
+    @f.puts "View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}"
+    @f.indent
+    group[:fields].each { |field|
+      @f.puts "FIELD_VIEW(*m_pMap, FIX::" + field + ");" }
+    group[:groups].each { |name| groupView( "*m_pMap", name ) }
+    @f.dedent
+    @f.puts "};"
+    @f.dedent
     @f.puts "};"
     @f.dedent
+    @f.indent
+    groupView( "*this", group[:name] )
+    @f.dedent
+  end
+
+  def groupView(map, name)
+    view = "FIX::GroupView<" + name + "::View>"
+    @f.puts view + " " + accessorName(name) + "() const"
+    @f.puts "{ return " + view + "( " + map + ", FIX::FIELD::" + name + " ); }"
+  end
+
+  def flyweightReaderConstructors(name, base)
+    @f.indent
+    @f.puts name + "() {}"
+    @f.puts name + "( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )"
+    @f.puts ": " + base + "( data, length, pDataDictionary ) {}"
+    @f.dedent
+  end
+
+  def flyweightType(name)
+    type = @fieldTypes.has_key?(name) ? @fieldTypes[name]["type"].upcase : "STRING"
+    return FLYWEIGHT_TYPES[type] || [ "FIX::StringView", "String" ]
+  end
+
+  def enumeratedChar?(name)
+    return false if !@fieldTypes.has_key?(name)
+    field = @fieldTypes[name]
+    return field["type"].upcase == "CHAR" && field["values"] != nil && !field["values"].empty?
+  end
+
+  def accessorName(name)
+    name[0,1].downcase + name[1..-1]
+  end
+
+  def flyweightGetters(fields)
+    @f.indent
+    fields.each { |name|
+      type, getter = flyweightType(name)
+      if enumeratedChar?(name)
+        @f.puts "FIX::" + name + " " + accessorName(name) + "() const"
+        @f.puts "{ return FIX::" + name + "( get" + getter + "( FIX::FIELD::" + name + " ) ); }"
+      else
+        @f.puts type + " " + accessorName(name) + "() const"
+        @f.puts "{ return get" + getter + "( FIX::FIELD::" + name + " ); }"
+      end
+    }
+    @f.dedent
+  end
+
+  def flyweightSetters(fields)
+    @f.indent
+    fields.each { |name|
+      next if FLYWEIGHT_FRAMING.include?(name)
+      type, setter = flyweightType(name)
+      type = "const " + type + "&" if type.start_with?("FIX::")
+      @f.puts "void set" + name + "( " + type + " value )"
+      @f.puts "{ set" + setter + "( FIX::FIELD::" + name + ", value ); }"
+      if @fieldTypes.has_key?(name) && @fieldTypes[name]["type"].upcase == "UTCTIMESTAMP"
+        @f.puts "void set" + name + "( const FIX::UtcTimeStamp& value, int precision = 0 )"
+        @f.puts "{ setUtcTimeStamp( FIX::FIELD::" + name + ", value, precision ); }"
+      end
+    }
+    @f.dedent
   end
 
   def messageStart(name, msgtype, required)
+    @msgtype = msgtype
     @f = createVersionFile(name + ".h")
     @f.puts "#ifndef " + @namespace + "_" + name.upcase + "_H"
     @f.puts "#define " + @namespace + "_" + name.upcase + "_H"
@@ -127,6 +264,7 @@ class GeneratorCPP
     @f.puts "{"
     @f.puts
 
+    @flyweight = []
     @f.indent
     @f.puts "class " + name + " : public Message"
     @f.puts "{"
@@ -165,6 +303,24 @@ class GeneratorCPP
   end
 
   def messageEnd
+    @f.indent
+    @f.puts
+    @f.puts "class Reader : public Message::Reader"
+    @f.puts "{"
+    @f.puts "public:"
+    flyweightReaderConstructors( "Reader", "Message::Reader" )
+    flyweightGetters( @flyweight )
+    @f.puts "};"
+    @f.puts
+    @f.puts "class Writer : public Message::Writer"
+    @f.puts "{"
+    @f.puts "public:"
+    @f.indent
+    @f.puts "Writer() : Message::Writer( \"" + @msgtype + "\" ) {}"
+    @f.dedent
+    flyweightSetters( @flyweight )
+    @f.puts "};"
+    @f.dedent
     @f.puts "};"
     @f.puts
     @f.dedent
@@ -221,6 +377,8 @@ class GeneratorCPP
   def fixFields(f, name, number, type)
     if( name == "CheckSum" )
       f.puts "DEFINE_CHECKSUM(#{name});"
+    elsif( @decimal && DECIMAL_TYPES.include?(type.upcase) )
+      f.puts "DEFINE_DECIMAL(#{name});"
     else
       f.puts "DEFINE_#{type.upcase}(#{name});"
     end
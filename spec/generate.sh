@@ -8,5 +8,5 @@ fi
 
 set -e
 ./generate_c++.sh
-$RUBY_CMD -I. Generator.rb
+$RUBY_CMD -I. Generator.rb "$@"
 
@@ -0,0 +1,162 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "AsyncSender.h"
+#include "Session.h"
+
+namespace FIX
+{
+AsyncSender::AsyncSender
+( Session& session, size_t capacity, Backpressure backpressure )
+: m_session( session ), m_queue( capacity ), m_backpressure( backpressure ),
+  m_fullCount( 0 ), m_blocked( 0 ), m_waiting( 0 ), m_sleeping( 0 ),
+  m_pushing( 0 ), m_closed( 0 ), m_stop( false ), m_running( false )
+{
+  m_batch.reserve( BATCH );
+  if( !thread_spawn( &senderThread, this, m_thread ) )
+    throw RuntimeError( "Unable to spawn sender thread" );
+  m_running = true;
+}
+
+AsyncSender::~AsyncSender()
+{
+  stop();
+}
+
+uint64_t AsyncSender::push( Message& message )
+{
+  // counted before looking at m_closed, so stop() either turns this push
+  // away or waits for its message to be published
+  ++m_pushing;
+  uint64_t ticket = m_closed ? 0 : claim( message );
+  --m_pushing;
+  return ticket;
+}
+
+uint64_t AsyncSender::claim( Message& message )
+{
+  uint64_t position;
+  Message* pSlot = m_queue.claim( position );
+  if( !pSlot )
+  {
+    ++m_fullCount;
+    if( m_backpressure == REJECT ) return 0;
+
+    ++m_blocked;
+    while( !( pSlot = m_queue.claim( position ) ) && !m_closed )
+    {
+      wake();
+      m_space.wait( 0.001 );
+    }
+    --m_blocked;
+    if( !pSlot ) return 0;
+  }
+
+  pSlot->swap( message );
+  m_queue.publish( position );
+  wake();
+  return position + 1;
+}
+
+bool AsyncSender::wait( uint64_t ticket, double seconds )
+{
+  int64_t deadline = UtcTimeStamp().getNanosSinceEpoch()
+    + ( int64_t ) ( seconds * DateTime::NANOS_PER_SEC );
+  ++m_waiting;
+  while( m_queue.popped() < ticket
+         && UtcTimeStamp().getNanosSinceEpoch() < deadline )
+    m_sent.wait( 0.001 );
+  --m_waiting;
+  return m_queue.popped() >= ticket;
+}
+
+void AsyncSender::stop()
+{
+  if( !m_running ) return;
+  m_running = false;
+  ++m_closed;
+  while( m_pushing )
+    process_sleep( 0.0001 );
+  m_stop = true;
+  m_work.signal();
+  thread_join( m_thread );
+}
+
+THREAD_PROC AsyncSender::senderThread( void* p )
+{
+  AsyncSender* pSender = static_cast < AsyncSender* > ( p );
+  pSender->run();
+  return 0;
+}
+
+void AsyncSender::run()
+{
+  int idle = 0;
+  while( true )
+  {
+    Message* pMessage;
+    while( m_batch.size() < BATCH && ( pMessage = m_queue.front( m_batch.size() ) ) )
+      m_batch.push_back( pMessage );
+
+    if( !m_batch.empty() )
+    {
+      m_session.sendBatch( m_batch );
+      for( size_t i = 0; i < m_batch.size(); ++i )
+        m_batch[ i ]->clear();
+      m_queue.pop( m_batch.size() );
+      m_batch.clear();
+      idle = 0;
+      if( m_blocked ) m_space.signal();
+      if( m_waiting ) m_sent.signal();
+    }
+    // everything queued before stop() is sent first
+    else if( m_stop && m_queue.empty() )
+    {
+      break;
+    }
+    else if( ++idle >= SPIN )
+    {
+      sleep();
+      idle = 0;
+    }
+  }
+}
+
+void AsyncSender::sleep()
+{
+  // announce the sleep before looking at the queue a last time, so a
+  // push either is seen here or sees the flag and signals the event
+  ++m_sleeping;
+  if( m_queue.empty() && !m_stop )
+    m_work.wait( 1 );
+  --m_sleeping;
+}
+
+void AsyncSender::wake()
+{
+  if( m_sleeping )
+    m_work.signal();
+}
+}
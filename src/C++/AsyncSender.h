@@ -0,0 +1,115 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_ASYNCSENDER_H
+#define FIX_ASYNCSENDER_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Message.h"
+#include "MpscQueue.h"
+#include "AtomicCount.h"
+#include "AutoResetEvent.h"
+#include "Utility.h"
+#include <vector>
+
+namespace FIX
+{
+class Session;
+
+/**
+ * Sends the messages of a session from a thread of its own.
+ *
+ * Threads sending on the session only move their message into a slot of a
+ * bounded multiple producer, single consumer queue and go on.  The sender
+ * thread takes whatever has been queued, up to a batch at a time, and
+ * passes it to the session, which assigns sequence numbers, calls toApp,
+ * serializes and persists each message under one acquisition of its lock
+ * and writes the batch to the socket at once.  Callers get a ticket they
+ * can wait on; when the queue is full they either wait for room or are
+ * turned away, depending on the backpressure chosen.
+ */
+class AsyncSender
+{
+public:
+  enum Backpressure
+  {
+    /// wait until the sender thread makes room
+    BLOCK,
+    /// refuse the message
+    REJECT
+  };
+
+  /// Starts the sender thread, capacity is the number of queued messages
+  AsyncSender( Session& session, size_t capacity, Backpressure backpressure );
+  ~AsyncSender();
+
+  /**
+   * Queue a message, taking its contents.  Returns the ticket of the
+   * message, or 0 if it was refused because the queue was full or the
+   * sender is stopped.
+   */
+  uint64_t push( Message& message );
+  /// Wait until the message with this ticket has been sent, false on timeout
+  bool wait( uint64_t ticket, double seconds );
+  /// Send everything queued so far and stop the sender thread
+  void stop();
+
+  size_t capacity() const { return m_queue.capacity(); }
+  Backpressure getBackpressure() const { return m_backpressure; }
+  /// Number of messages waiting for the sender thread
+  size_t size() const { return m_queue.size(); }
+  /// Number of pushes that found the queue full
+  long getFullCount() const { return m_fullCount; }
+
+private:
+  enum { BATCH = 64, SPIN = 1000 };
+
+  uint64_t claim( Message& message );
+  static THREAD_PROC senderThread( void* p );
+  void run();
+  void sleep();
+  void wake();
+
+  Session& m_session;
+  MpscQueue < Message > m_queue;
+  Backpressure m_backpressure;
+  std::vector < Message* > m_batch;
+  AutoResetEvent m_work;
+  AutoResetEvent m_space;
+  AutoResetEvent m_sent;
+  atomic_count m_fullCount;
+  atomic_count m_blocked;
+  atomic_count m_waiting;
+  atomic_count m_sleeping;
+  /// pushes in progress, stop() waits for them once m_closed is set
+  atomic_count m_pushing;
+  atomic_count m_closed;
+  /// set once no push can publish any more, the thread then drains and exits
+  volatile bool m_stop;
+  bool m_running;
+  thread_id m_thread;
+};
+}
+
+#endif //FIX_ASYNCSENDER_H
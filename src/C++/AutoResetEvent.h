@@ -0,0 +1,116 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_AUTORESETEVENT_H
+#define FIX_AUTORESETEVENT_H
+
+#include "Utility.h"
+#include <math.h>
+
+#ifndef _MSC_VER
+#include <pthread.h>
+#include <sys/time.h>
+#include <errno.h>
+#include <cmath>
+#endif
+
+namespace FIX
+{
+/**
+ * Auto reset event.
+ *
+ * Unlike Event, a signal with no thread waiting is kept until the next
+ * wait, which then returns at once and clears it, so a signal sent just
+ * before a thread goes to sleep is not lost.  A signal releases one
+ * waiter; waits time out after the given seconds.
+ */
+class AutoResetEvent
+{
+public:
+  AutoResetEvent()
+  {
+#ifdef _MSC_VER
+    m_event = CreateEvent( 0, false, false, 0 );
+#else
+    m_signaled = false;
+    pthread_mutex_init( &m_mutex, 0 );
+    pthread_cond_init( &m_event, 0 );
+#endif
+  }
+
+  ~AutoResetEvent()
+  {
+#ifdef _MSC_VER
+    CloseHandle( m_event );
+#else
+    pthread_cond_destroy( &m_event );
+    pthread_mutex_destroy( &m_mutex );
+#endif
+  }
+
+  void signal()
+  {
+#ifdef _MSC_VER
+    SetEvent( m_event );
+#else
+    pthread_mutex_lock( &m_mutex );
+    m_signaled = true;
+    pthread_cond_signal( &m_event );
+    pthread_mutex_unlock( &m_mutex );
+#endif
+  }
+
+  void wait( double s )
+  {
+#ifdef _MSC_VER
+    WaitForSingleObject( m_event, (long)(s * 1000) );
+#else
+    pthread_mutex_lock( &m_mutex );
+    // pthread_cond_timedwait takes an absolute deadline
+    struct timeval now;
+    gettimeofday( &now, 0 );
+    timespec time;
+    double intpart;
+    long nanos = now.tv_usec * 1000 + (long)(modf(s, &intpart) * 1e9);
+    time.tv_sec = now.tv_sec + (time_t)intpart + nanos / 1000000000L;
+    time.tv_nsec = nanos % 1000000000L;
+    while( !m_signaled )
+    {
+      if( pthread_cond_timedwait( &m_event, &m_mutex, &time ) == ETIMEDOUT )
+        break;
+    }
+    m_signaled = false;
+    pthread_mutex_unlock( &m_mutex );
+#endif
+  }
+
+private:
+#ifdef _MSC_VER
+  HANDLE m_event;
+#else
+  pthread_cond_t m_event;
+  pthread_mutex_t m_mutex;
+  bool m_signaled;
+#endif
+};
+}
+
+#endif
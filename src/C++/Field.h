@@ -399,6 +399,26 @@ public:
     { return getValue(); }
 };
 
+/// Field that contains a fixed point decimal value
+class DecimalField : public FieldBase
+{
+public:
+  explicit DecimalField( int field, const Decimal& data, int padding = 0 )
+: FieldBase( field, DecimalConvertor::convert( data, padding ) ) {}
+  DecimalField( int field )
+: FieldBase( field, "" ) {}
+
+  void setValue( const Decimal& value, int padding = 0 )
+    { setString( DecimalConvertor::convert( value, padding ) ); }
+  Decimal getValue() const EXCEPT ( IncorrectDataFormat )
+    { try
+      { return DecimalConvertor::convert( getString() ); }
+      catch( FieldConvertError& )
+      { throw IncorrectDataFormat( getTag(), getString() ); } }
+  operator Decimal() const
+    { return getValue(); }
+};
+
 /// Field that contains an integer value
 class IntField : public FieldBase
 {
@@ -645,6 +665,8 @@ DEFINE_FIELD_TIMECLASS_NUM(NAME, TOK, TYPE, DEPRECATED_FIELD::NAME)
   DEFINE_FIELD_CLASS(NAME, Length, FIX::LENGTH)
 #define DEFINE_PERCENTAGE( NAME ) \
   DEFINE_FIELD_CLASS(NAME, Percentage, FIX::PERCENTAGE)
+#define DEFINE_DECIMAL( NAME ) \
+  DEFINE_FIELD_CLASS(NAME, Decimal, FIX::DECIMAL)
 #define DEFINE_COUNTRY( NAME ) \
   DEFINE_FIELD_CLASS(NAME, Country, FIX::COUNTRY)
 #define DEFINE_TZTIMEONLY( NAME ) \
@@ -708,6 +730,8 @@ DEFINE_FIELD_TIMECLASS_NUM(NAME, TOK, TYPE, DEPRECATED_FIELD::NAME)
   DEFINE_FIELD_CLASS_NUM(NAME, Length, FIX::LENGTH, NUM)
 #define USER_DEFINE_PERCENTAGE( NAME, NUM ) \
   DEFINE_FIELD_CLASS_NUM(NAME, Percentage, FIX::PERCENTAGE, NUM)
+#define USER_DEFINE_DECIMAL( NAME, NUM ) \
+  DEFINE_FIELD_CLASS_NUM(NAME, Decimal, FIX::DECIMAL, NUM)
 #define USER_DEFINE_COUNTRY( NAME, NUM ) \
   DEFINE_FIELD_CLASS_NUM(NAME, Country, FIX::COUNTRY, NUM)
 #define USER_DEFINE_TZTIMEONLY( NAME, NUM ) \
@@ -160,10 +160,8 @@ struct IntConvertor
     return std::string( start, buffer + sizeof (buffer) - start );
   }
 
-  static bool convert(     
-    std::string::const_iterator str, 
-    std::string::const_iterator end, 
-    signed_int& result )
+  template < typename Iterator >
+  static bool convert( Iterator str, Iterator end, signed_int& result )
   {
     bool isNegative = false;
     signed_int x = 0;
@@ -255,6 +253,12 @@ public:
   static std::string convert( double value, int padding = 0 )
   {
     char result[BUFFFER_SIZE];
+    return std::string( result, convert( value, padding, result ) );
+  }
+
+  /// Write value into result, BUFFFER_SIZE long, returning its length
+  static int convert( double value, int padding, char* result )
+  {
     char *end = 0;
 
     int size;
@@ -262,7 +266,7 @@ public:
     {
       size = fast_dtoa( result, BUFFFER_SIZE, value ); 
       if( size == 0 )
-        return std::string();
+        return 0;
 
       if( padding > 0 )
       {
@@ -278,6 +282,8 @@ public:
           ++size;
         }
         int needed = padding - (int)(end - point);
+        if( needed > BUFFFER_SIZE - size )
+          needed = BUFFFER_SIZE - size;
 
         if( needed > 0 )
         {
@@ -290,7 +296,7 @@ public:
     {
       size = fast_fixed_dtoa( result, BUFFFER_SIZE, value );
       if( size == 0 )
-        return std::string();
+        return 0;
 
       // strip trailing 0's
       end = result + size - 1;
@@ -315,57 +321,208 @@ public:
       }
    }
 
-   return std::string( result, size );
+   return size;
 }
 
-static bool convert( const std::string& value, double& result )
-{
-  const char * i = value.c_str();
+  static bool convert( const char* str, const char* end, double& result )
+  {
+    const char* i = str;
+
+    // Catch null strings
+    if( i == end ) return false;
+    // Eat leading '-' and recheck for null string
+    if( *i == '-' && ++i == end ) return false;
+
+    bool haveDigit = false;
+
+    while( i != end && IS_DIGIT(*i) )
+    {
+      haveDigit = true;
+      ++i;
+    }
+
+    if( i != end && *i == '.' )
+    {
+      while( ++i != end && IS_DIGIT(*i) )
+        haveDigit = true;
+    }
+
+    if( i != end || !haveDigit ) return false;
 
-  // Catch null strings
-  if( !*i ) return false;
-  // Eat leading '-' and recheck for null string
-  if( *i == '-' && !*++i ) return false;
+    int processed_chars;
+    const int total_length = ( int ) ( end - str );
+    const double val = fast_strtod( str, total_length, &processed_chars );
 
-  bool haveDigit = false;
+    if ( processed_chars != total_length ||
+       val != val /*test for quite NaN*/ )
+    {
+      return false;
+    }
 
-  if( IS_DIGIT(*i) )
+    result = val;
+    return true;
+  }
+
+  static bool convert( const std::string& value, double& result )
   {
-    haveDigit = true;
-    while( IS_DIGIT (*++i) );
+    return convert( value.data(), value.data() + value.size(), result );
   }
 
-  if( *i == '.' && IS_DIGIT(*++i) )
+  static double convert( const std::string& value )
+  EXCEPT ( FieldConvertError )
   {
-    haveDigit = true;
-    while( IS_DIGIT (*++i) );
+    double result = 0.0;
+    if( !convert( value, result ) )
+      throw FieldConvertError(value);
+    else
+      return result;
   }
+};
 
-  if( *i || !haveDigit ) return false;
-    
-  int processed_chars;
-  const int total_length = value.length();
-  const double val = fast_strtod( value.c_str(), total_length, &processed_chars);
+/// Converts Decimal to/from a string with integer arithmetic only
+struct DecimalConvertor
+{
+  static std::string convert( const Decimal& value, int padding = 0 )
+  {
+    std::string result;
+    convert( value, padding, result );
+    return result;
+  }
 
-  if ( processed_chars != total_length ||
-     val != val /*test for quite NaN*/ )
+  /// Append value to result
+  static void convert( const Decimal& value, int padding, std::string& result )
   {
-    return false;
+    const int64_t mantissa = value.getMantissa();
+    const int exponent = value.getExponent();
+    const int places = exponent < 0 ? -exponent : 0;
+    const int extra = padding > places ? padding - places : 0;
+
+    // digits of the mantissa, least significant last
+    char buffer[std::numeric_limits<uint64_t>::digits10 + 2];
+    char* const end = buffer + sizeof( buffer );
+    char* start = end;
+    uint64_t digits = mantissa < 0 ? 0 - ( uint64_t ) mantissa : ( uint64_t ) mantissa;
+    do
+    {
+      *--start = ( char ) ( '0' + digits % 10 );
+      digits /= 10;
+    } while( digits );
+    const int length = ( int ) ( end - start );
+
+    result.reserve( result.size() + length + places + extra + 3 );
+    if( mantissa < 0 )
+      result += '-';
+
+    if( exponent >= 0 )
+    {
+      result.append( start, length );
+      if( mantissa )
+        result.append( exponent, '0' );
+      if( padding > 0 )
+        result.append( 1, '.' ).append( padding, '0' );
+    }
+    else if( length > places )
+    {
+      result.append( start, length - places );
+      result += '.';
+      result.append( end - places, places );
+      result.append( extra, '0' );
+    }
+    else
+    {
+      result += "0.";
+      result.append( places - length, '0' );
+      result.append( start, length );
+      result.append( extra, '0' );
+    }
   }
 
-  result = val;
-  return true;
-}
+  template < typename Iterator >
+  static bool convert( Iterator str, Iterator end, Decimal& result )
+  {
+    bool isNegative = false;
+    bool haveDigit = false;
+    bool havePoint = false;
+    int64_t mantissa = 0;
+    int exponent = 0;
+    // zeros after the point not yet multiplied in
+    int zeros = 0;
 
-  static double convert( const std::string& value )
+    if( str == end )
+      return false;
+
+    if( *str == '-' )
+    {
+      isNegative = true;
+      if( ++str == end )
+        return false;
+    }
+
+    for( ; str != end; ++str )
+    {
+      if( *str == '.' && !havePoint )
+      {
+        havePoint = true;
+        continue;
+      }
+
+      const unsigned_int c = *str - '0';
+      if( c > 9 ) return false;
+      haveDigit = true;
+
+      if( havePoint )
+      {
+        if( c == 0 )
+        {
+          ++zeros;
+          continue;
+        }
+        if( !shift( mantissa, exponent, zeros ) )
+          return false;
+        exponent -= 1;
+      }
+
+      if( mantissa > ( std::numeric_limits<int64_t>::max() - c ) / 10 )
+        return false;
+      mantissa = 10 * mantissa + c;
+    }
+
+    if( !haveDigit )
+      return false;
+
+    // keep trailing zeros as precision when they fit, they do not
+    // change the value so they are dropped otherwise
+    shift( mantissa, exponent, zeros );
+
+    result = Decimal( isNegative ? -mantissa : mantissa, exponent );
+    return true;
+  }
+
+  static bool convert( const std::string& value, Decimal& result )
+  {
+    return convert( value.begin(), value.end(), result );
+  }
+
+  static Decimal convert( const std::string& value )
   EXCEPT ( FieldConvertError )
   {
-    double result = 0.0;
-    if( !convert( value, result ) )
+    Decimal result;
+    if( !convert( value.begin(), value.end(), result ) )
       throw FieldConvertError(value);
     else
       return result;
   }
+
+private:
+  /// Multiply in zeros pending after the point
+  static bool shift( int64_t& mantissa, int& exponent, int& zeros )
+  {
+    if( mantissa && !Decimal::scale( mantissa, zeros, mantissa ) )
+      return false;
+    exponent -= zeros;
+    zeros = 0;
+    return true;
+  }
 };
 
 /// Converts character to/from a string
@@ -431,11 +588,22 @@ struct BoolConvertor
 /// Converts a UtcTimeStamp to/from a string
 struct UtcTimeStampConvertor
 {
+  /// Largest number of characters written by convert into a buffer
+  static const int MAX_LENGTH = 17 + 10;
+
   static std::string convert( const UtcTimeStamp& value,
                               int precision = 0 )
   EXCEPT ( FieldConvertError )
   {
-    char result[ 17+10 ]; // Maximum
+    char result[ MAX_LENGTH ];
+    return std::string( result, convert( value, precision, result ) );
+  }
+
+  /// Write into a buffer of MAX_LENGTH characters, returns the length
+  static int convert( const UtcTimeStamp& value, int precision,
+                      char* result )
+  EXCEPT ( FieldConvertError )
+  {
     int year, month, day, hour, minute, second, fraction;
 
     value.getYMD( year, month, day );
@@ -461,28 +629,33 @@ struct UtcTimeStampConvertor
       }
     }
 
-    return std::string(result, precision ? (17 + 1 + precision) : 17);
+    return precision ? (17 + 1 + precision) : 17;
   }
 
   static UtcTimeStamp convert( const std::string& value )
   EXCEPT ( FieldConvertError )
   {
-    size_t len = value.size();
-    if (len < 17 || len > 27) throw FieldConvertError(value);
+    return convert( value.data(), value.size() );
+  }
+
+  static UtcTimeStamp convert( const char* value, size_t len )
+  EXCEPT ( FieldConvertError )
+  {
+    if (len < 17 || len > 27) throw FieldConvertError( std::string( value, len ) );
 
     size_t i = 0;
     int c = 0;
     for( c = 0; c < 8; ++c )
-      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError(value);
-    if (value[i++] != '-') throw FieldConvertError(value);
+      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError( std::string( value, len ) );
+    if (value[i++] != '-') throw FieldConvertError( std::string( value, len ) );
     for( c = 0; c < 2; ++c )
-      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError(value);
-    if( value[i++] != ':' ) throw FieldConvertError(value);
+      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError( std::string( value, len ) );
+    if( value[i++] != ':' ) throw FieldConvertError( std::string( value, len ) );
     for( c = 0; c < 2; ++c )
-      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError(value);
-    if( value[i++] != ':' ) throw FieldConvertError(value);
+      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError( std::string( value, len ) );
+    if( value[i++] != ':' ) throw FieldConvertError( std::string( value, len ) );
     for( c = 0; c < 2; ++c )
-      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError(value);
+      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError( std::string( value, len ) );
 
     int year, mon, mday, hour, min, sec;
 
@@ -495,25 +668,25 @@ struct UtcTimeStampConvertor
 
     mon = value[i++] - '0';
     mon = 10 * mon + value[i++] - '0';
-    if( mon < 1 || 12 < mon ) throw FieldConvertError(value);
+    if( mon < 1 || 12 < mon ) throw FieldConvertError( std::string( value, len ) );
 
     mday = value[i++] - '0';
     mday = 10 * mday + value[i++] - '0';
-    if( mday < 1 || 31 < mday ) throw FieldConvertError(value);
+    if( mday < 1 || 31 < mday ) throw FieldConvertError( std::string( value, len ) );
 
     ++i; // skip '-'
 
     hour = value[i++] - '0';
     hour = 10 * hour + value[i++] - '0';
     // No check for >= 0 as no '-' are converted here
-    if( 23 < hour ) throw FieldConvertError(value);
+    if( 23 < hour ) throw FieldConvertError( std::string( value, len ) );
 
     ++i; // skip ':'
 
     min = value[i++] - '0';
     min = 10 * min + value[i++] - '0';
     // No check for >= 0 as no '-' are converted here
-    if( 59 < min ) throw FieldConvertError(value);
+    if( 59 < min ) throw FieldConvertError( std::string( value, len ) );
 
     ++i; // skip ':'
 
@@ -521,19 +694,19 @@ struct UtcTimeStampConvertor
     sec = 10 * sec + value[i++] - '0';
 
     // No check for >= 0 as no '-' are converted here
-    if( 60 < sec ) throw FieldConvertError(value);
+    if( 60 < sec ) throw FieldConvertError( std::string( value, len ) );
 
     if (len == 17)
       return UtcTimeStamp (hour, min, sec, 0,
                            mday, mon, year);
 
-    if( value[i++] != '.' ) throw FieldConvertError(value);
+    if( value[i++] != '.' ) throw FieldConvertError( std::string( value, len ) );
 
     int fraction = 0;
     for (; i < len; ++i)
     {
       char ch = value[i];
-      if( !IS_DIGIT(ch)) throw FieldConvertError(value);
+      if( !IS_DIGIT(ch)) throw FieldConvertError( std::string( value, len ) );
       fraction = (fraction * 10) + ch - '0';
     }
 
@@ -571,22 +744,27 @@ struct UtcTimeOnlyConvertor
     return std::string(result, precision ? (8 + 1 + precision) : 8);
   }
 
-  static UtcTimeOnly convert( const std::string& value)
+  static UtcTimeOnly convert( const std::string& value )
   EXCEPT ( FieldConvertError )
   {
-    size_t len = value.size();
-    if (len < 8 || len > 18) throw FieldConvertError(value);
+    return convert( value.data(), value.size() );
+  }
+
+  static UtcTimeOnly convert( const char* value, size_t len )
+  EXCEPT ( FieldConvertError )
+  {
+    if (len < 8 || len > 18) throw FieldConvertError( std::string( value, len ) );
 
     size_t i = 0;
     int c = 0;
     for( c = 0; c < 2; ++c )
-      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError(value);
-    if( value[i++] != ':' ) throw FieldConvertError(value);
+      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError( std::string( value, len ) );
+    if( value[i++] != ':' ) throw FieldConvertError( std::string( value, len ) );
     for( c = 0; c < 2; ++c )
-      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError(value);
-    if( value[i++] != ':' ) throw FieldConvertError(value);
+      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError( std::string( value, len ) );
+    if( value[i++] != ':' ) throw FieldConvertError( std::string( value, len ) );
     for( c = 0; c < 2; ++c )
-      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError(value);
+      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError( std::string( value, len ) );
 
     int hour, min, sec;
 
@@ -595,14 +773,14 @@ struct UtcTimeOnlyConvertor
     hour = value[i++] - '0';
     hour = 10 * hour + value[i++] - '0';
     // No check for >= 0 as no '-' are converted here
-    if( 23 < hour ) throw FieldConvertError(value);
+    if( 23 < hour ) throw FieldConvertError( std::string( value, len ) );
 
     ++i; // skip ':'
 
     min = value[i++] - '0';
     min = 10 * min + value[i++] - '0';
     // No check for >= 0 as no '-' are converted here
-    if( 59 < min ) throw FieldConvertError(value);
+    if( 59 < min ) throw FieldConvertError( std::string( value, len ) );
 
     ++i; // skip ':'
 
@@ -610,18 +788,18 @@ struct UtcTimeOnlyConvertor
     sec = 10 * sec + value[i++] - '0';
 
     // No check for >= 0 as no '-' are converted here
-    if( 60 < sec ) throw FieldConvertError(value);
+    if( 60 < sec ) throw FieldConvertError( std::string( value, len ) );
 
     if (len == 8)
       return UtcTimeOnly (hour, min, sec, 0);
 
-    if( value[i++] != '.' ) throw FieldConvertError(value);
+    if( value[i++] != '.' ) throw FieldConvertError( std::string( value, len ) );
 
     int fraction = 0;
     for (; i < len; ++i)
     {
       char ch = value[i];
-      if( !IS_DIGIT(ch)) throw FieldConvertError(value);
+      if( !IS_DIGIT(ch)) throw FieldConvertError( std::string( value, len ) );
       fraction = (fraction * 10) + ch - '0';
     }
 
@@ -698,6 +876,7 @@ typedef StringConvertor LOCALMKTDATE_CONVERTOR;
 typedef StringConvertor DATA_CONVERTOR;
 typedef DoubleConvertor FLOAT_CONVERTOR;
 typedef DoubleConvertor PRICEOFFSET_CONVERTOR;
+typedef DecimalConvertor DECIMAL_CONVERTOR;
 typedef StringConvertor MONTHYEAR_CONVERTOR;
 typedef StringConvertor DAYOFMONTH_CONVERTOR;
 typedef UtcDateConvertor UTCDATE_CONVERTOR;
@@ -32,24 +32,25 @@ namespace FIX
 {
 
 FieldMap::FieldMap( const message_order& order, int size )
-: m_order(order)
+: m_order(order), m_generation( 0 )
 {
   m_fields.reserve(size);
 }
 
 FieldMap::FieldMap( const message_order& order /*= message_order(message_order::normal)*/)
-: m_order(order)
+: m_order(order), m_generation( 0 )
 {
   m_fields.reserve(DEFAULT_SIZE);
 }
 
 FieldMap::FieldMap( const int order[] )
-: m_order(message_order(order))
+: m_order(message_order(order)), m_generation( 0 )
 {
   m_fields.reserve(DEFAULT_SIZE);
 }
 
 FieldMap::FieldMap( const FieldMap& copy )
+: m_generation( 0 )
 {
   *this = copy;
 }
@@ -80,6 +81,16 @@ FieldMap& FieldMap::operator=( const FieldMap& rhs )
   return *this;
 }
 
+void FieldMap::swap( FieldMap& rhs )
+{
+  // both end up past what either of them had
+  size_t generation = std::max( this->generation(), rhs.generation() ) + 1;
+  m_fields.swap( rhs.m_fields );
+  m_groups.swap( rhs.m_groups );
+  std::swap( m_order, rhs.m_order );
+  m_generation = rhs.m_generation = generation;
+}
+
 void FieldMap::addGroup( int field, const FieldMap& group, bool setCount )
 {
   FieldMap * pGroup = new FieldMap( group );
@@ -94,6 +105,7 @@ void FieldMap::addGroupPtr( int field, FieldMap * group, bool setCount )
 
     std::vector< FieldMap* >& vec = m_groups[ field ];
     vec.push_back( group );
+    ++m_generation;
 
     if( setCount )
         setField( IntField( field, (int)vec.size() ) );
@@ -119,6 +131,8 @@ void FieldMap::removeGroup( int num, int field )
   std::vector< FieldMap* >::iterator iter = vector.begin();
   std::advance( iter, ( num - 1 ) );
 
+  // what the group counted stays counted here
+  m_generation += ( *iter )->generation() + 1;
   delete (*iter);
   vector.erase( iter );
 
@@ -146,8 +160,10 @@ void FieldMap::removeGroup( int field )
 
   m_groups.erase( i );
 
+  ++m_generation;
   while ( !tmp.empty() )
   {
+    m_generation += tmp.back()->generation();
     delete tmp.back();
     tmp.pop_back();
   }
@@ -157,7 +173,10 @@ void FieldMap::removeField( int field )
 {
   Fields::iterator i = findTag( field );
   if ( i != m_fields.end() )
+  {
     m_fields.erase( i );
+    ++m_generation;
+  }
 }
 
 bool FieldMap::hasGroup( int num, int field ) const
@@ -181,6 +200,9 @@ size_t FieldMap::groupCount( int field ) const
 
 void FieldMap::clear()
 {
+  if( !m_groups.empty() )
+    m_generation = generation();
+  ++m_generation;
   m_fields.clear();
 
   Groups::iterator i;
@@ -193,6 +215,19 @@ void FieldMap::clear()
   m_groups.clear();
 }
 
+size_t FieldMap::generation() const
+{
+  size_t result = m_generation;
+  Groups::const_iterator i;
+  for ( i = m_groups.begin(); i != m_groups.end(); ++i )
+  {
+    std::vector < FieldMap* > ::const_iterator j;
+    for ( j = i->second.begin(); j != i->second.end(); ++j )
+      result += ( *j )->generation();
+  }
+  return result;
+}
+
 bool FieldMap::isEmpty()
 {
   return m_fields.empty();
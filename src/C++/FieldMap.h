@@ -112,6 +112,9 @@ public:
 
   FieldMap& operator=( const FieldMap& rhs );
 
+  /// Exchange contents with another map without copying fields or groups
+  void swap( FieldMap& rhs );
+
   /// Set a field without type checking
   void setField( const FieldBase& field, bool overwrite = true )
   EXCEPT ( RepeatedTag )
@@ -130,6 +133,7 @@ public:
       else
       {
         i->setString( field.getString() );
+        ++m_generation;
       }
     }
   }
@@ -228,6 +232,13 @@ public:
     return &getGroupRef( num, tag );
   }
 
+  /// Get all instances of a group, 0 if there are none
+  const std::vector< FieldMap* >* getGroupVector( int tag ) const
+  {
+    Groups::const_iterator i = m_groups.find( tag );
+    return i == m_groups.end() ? 0 : &i->second;
+  }
+
   /// Remove a specific instance of a group.
   void removeGroup( int num, int tag );
   /// Remove all instances of a group.
@@ -255,11 +266,17 @@ public:
 
   int calculateTotal( int checkSumField = FIELD::CheckSum ) const;
 
-  iterator begin() { return m_fields.begin(); }
+  /**
+   * Count of changes to the map and its groups, it only goes up.  Taking
+   * a mutable iterator counts as a change.
+   */
+  size_t generation() const;
+
+  iterator begin() { ++m_generation; return m_fields.begin(); }
   iterator end() { return m_fields.end(); }
   const_iterator begin() const { return m_fields.begin(); }
   const_iterator end() const { return m_fields.end(); }
-  g_iterator g_begin() { return m_groups.begin(); }
+  g_iterator g_begin() { ++m_generation; return m_groups.begin(); }
   g_iterator g_end() { return m_groups.end(); }
   g_const_iterator g_begin() const { return m_groups.begin(); }
   g_const_iterator g_end() const { return m_groups.end(); }
@@ -270,6 +287,7 @@ protected:
 
   void addField( const FieldBase& field )
   {
+    ++m_generation;
     Fields::iterator iter = findPositionFor( field.getTag() );
     if( iter == m_fields.end() )
     {
@@ -296,6 +314,7 @@ protected:
   // only applicable during message decoding
   void appendField( const FieldBase& field )
   {
+    ++m_generation;
     m_fields.push_back( field );
   }
 
@@ -357,6 +376,7 @@ private:
   Fields m_fields;
   Groups m_groups;
   message_order m_order;
+  size_t m_generation;
 };
 /*! @} */
 }
@@ -371,6 +391,14 @@ FIELD& get( FIELD& field ) const          \
 bool getIfSet( FIELD& field ) const       \
 { return (MAP).getFieldIfSet(field); }
 
+#define FIELD_VIEW( MAP, FIELD )          \
+bool isSet( const FIELD& field ) const    \
+{ return (MAP).isSetField(field); }       \
+FIELD& get( FIELD& field ) const          \
+{ return (FIELD&)(MAP).getField(field); } \
+bool getIfSet( FIELD& field ) const       \
+{ return (MAP).getFieldIfSet(field); }
+
 #define FIELD_GET_PTR( MAP, FLD ) \
 (const FIX::FLD*)MAP.getFieldPtr( FIX::FIELD::FLD )
 #define FIELD_GET_REF( MAP, FLD ) \
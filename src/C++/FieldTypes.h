@@ -33,7 +33,9 @@
 #endif
 
 #include "Utility.h"
+#include "Exceptions.h"
 #include <string>
+#include <limits>
 #include <time.h>
 
 namespace FIX
@@ -257,6 +259,12 @@ struct DateTime
             m_time / NANOS_PER_SEC);
   }
 
+  /// Return the number of nanoseconds since the time_t epoch
+  inline int64_t getNanosSinceEpoch() const
+  {
+    return NANOS_PER_DAY * (m_date - JULIAN_19700101) + m_time;
+  }
+
   /// Convert the DateTime to a struct tm which is in UTC
   tm getTmUtc() const 
   {
@@ -868,6 +876,111 @@ public:
   }
 };
 
+/// Fixed point number stored as an integer mantissa and a power of ten
+/// exponent.  Values keep the digits they were parsed or built with, so
+/// prices and quantities pass through without binary rounding.
+class Decimal
+{
+public:
+  /// Largest exponent with an exact int64_t power of ten
+  static const int MAX_DIGITS = 18;
+
+  Decimal() : m_mantissa( 0 ), m_exponent( 0 ) {}
+  Decimal( int64_t mantissa, int exponent = 0 )
+  : m_mantissa( mantissa ), m_exponent( exponent ) {}
+
+  /// Round a double to the given number of decimal places
+  static Decimal fromDouble( double value, int places )
+  EXCEPT ( FieldConvertError )
+  {
+    // 2^63 is exact as a double, NaN fails both comparisons
+    static const double LIMIT = 9223372036854775808.0;
+    double scaled = value * doublePower( places );
+    scaled = scaled < 0 ? scaled - 0.5 : scaled + 0.5;
+    if( !( scaled > -LIMIT && scaled < LIMIT ) )
+      throw FieldConvertError( "Decimal out of range" );
+    return Decimal( ( int64_t ) scaled, -places );
+  }
+
+  int64_t getMantissa() const { return m_mantissa; }
+  int getExponent() const { return m_exponent; }
+
+  double toDouble() const
+  {
+    return m_exponent < 0
+      ? ( double ) m_mantissa / doublePower( -m_exponent )
+      : ( double ) m_mantissa * doublePower( m_exponent );
+  }
+
+  /// Compare numeric values, so 1.50 and 1.5 are equal
+  int compare( const Decimal& rhs ) const
+  {
+    if( m_exponent == rhs.m_exponent )
+      return m_mantissa < rhs.m_mantissa ? -1 : ( m_mantissa > rhs.m_mantissa ? 1 : 0 );
+    if( m_exponent < rhs.m_exponent )
+      return -rhs.compare( *this );
+
+    // scale our mantissa down to rhs's exponent; if that does not fit
+    // it is larger in magnitude than anything rhs can hold
+    int64_t scaled = 0;
+    if( m_mantissa && !scale( m_mantissa, m_exponent - rhs.m_exponent, scaled ) )
+      return m_mantissa < 0 ? -1 : 1;
+    return scaled < rhs.m_mantissa ? -1 : ( scaled > rhs.m_mantissa ? 1 : 0 );
+  }
+
+  /// 10 to the power of digits, for 0 <= digits <= MAX_DIGITS
+  static int64_t power( int digits )
+  {
+    static const int64_t powers[ MAX_DIGITS + 1 ] =
+    {
+      1LL, 10LL, 100LL, 1000LL, 10000LL, 100000LL, 1000000LL, 10000000LL,
+      100000000LL, 1000000000LL, 10000000000LL, 100000000000LL,
+      1000000000000LL, 10000000000000LL, 100000000000000LL,
+      1000000000000000LL, 10000000000000000LL, 100000000000000000LL,
+      1000000000000000000LL
+    };
+    return powers[ digits ];
+  }
+
+  /// value * 10^digits, false if the result does not fit
+  static bool scale( int64_t value, int digits, int64_t& result )
+  {
+    if( digits > MAX_DIGITS )
+      return false;
+    int64_t factor = power( digits );
+    int64_t limit = std::numeric_limits<int64_t>::max() / factor;
+    if( value > limit || value < -limit )
+      return false;
+    result = value * factor;
+    return true;
+  }
+
+private:
+  static double doublePower( int digits )
+  {
+    double result = 1.0;
+    while( digits-- > 0 )
+      result *= 10.0;
+    return result;
+  }
+
+  int64_t m_mantissa;
+  int m_exponent;
+};
+
+inline bool operator==( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) == 0; }
+inline bool operator!=( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) != 0; }
+inline bool operator<( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) < 0; }
+inline bool operator>( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) > 0; }
+inline bool operator<=( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) <= 0; }
+inline bool operator>=( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) >= 0; }
+
 /*! @} */
 
 typedef UtcDate UtcDateOnly;
@@ -903,6 +1016,7 @@ typedef std::string TZTIMEONLY;
 typedef std::string TZTIMESTAMP;
 typedef std::string XMLDATA;
 typedef std::string LANGUAGE;
+typedef Decimal DECIMAL;
 
 namespace TYPE
 {
@@ -191,12 +191,35 @@ void FileStoreFactory::destroy( MessageStore* pStore )
 
 bool FileStore::set( int msgSeqNum, const std::string& msg )
 EXCEPT ( IOException )
+{
+  seekToEnd();
+  append( msgSeqNum, msg );
+  flushMessages();
+  return true;
+}
+
+bool FileStore::setMany( int first, const std::vector < std::string >& msgs )
+EXCEPT ( IOException )
+{
+  // seeking would flush the stream, so it is done once for all messages
+  seekToEnd();
+  for( std::size_t i = 0; i < msgs.size(); ++i )
+    append( first + ( int ) i, msgs[ i ] );
+  flushMessages();
+  return true;
+}
+
+void FileStore::seekToEnd() EXCEPT ( IOException )
 {
   if ( fseek( m_msgFile, 0, SEEK_END ) ) 
     throw IOException( "Cannot seek to end of " + m_msgFileName );
   if ( fseek( m_headerFile, 0, SEEK_END ) ) 
     throw IOException( "Cannot seek to end of " + m_headerFileName );
+}
 
+void FileStore::append( int msgSeqNum, const std::string& msg )
+EXCEPT ( IOException )
+{
   long offset = ftell( m_msgFile );
   if ( offset < 0 ) 
     throw IOException( "Unable to get file pointer position from " + m_msgFileName );
@@ -213,11 +236,14 @@ EXCEPT ( IOException )
   fwrite( msg.c_str(), sizeof( char ), msg.size(), m_msgFile );
   if ( ferror( m_msgFile ) ) 
     throw IOException( "Unable to write to file " + m_msgFileName );
+}
+
+void FileStore::flushMessages() EXCEPT ( IOException )
+{
   if ( fflush( m_msgFile ) == EOF ) 
     throw IOException( "Unable to flush file " + m_msgFileName );
   if ( fflush( m_headerFile ) == EOF ) 
     throw IOException( "Unable to flush file " + m_headerFileName );
-  return true;
 }
 
 void FileStore::get( int begin, int end,
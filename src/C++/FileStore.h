@@ -85,6 +85,7 @@ public:
   virtual ~FileStore();
 
   bool set( int, const std::string& ) EXCEPT ( IOException );
+  bool setMany( int, const std::vector < std::string >& ) EXCEPT ( IOException );
   void get( int, int, std::vector < std::string > & ) const EXCEPT ( IOException );
 
   int getNextSenderMsgSeqNum() const EXCEPT ( IOException );
@@ -110,6 +111,9 @@ private:
   void open( bool deleteFile );
   void populateCache();
   bool readFromFile( int offset, int size, std::string& msg );
+  void seekToEnd() EXCEPT ( IOException );
+  void append( int, const std::string& ) EXCEPT ( IOException );
+  void flushMessages() EXCEPT ( IOException );
   void setSeqNum();
   void setSession();
 
@@ -0,0 +1,120 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_FLUSHTIMER_H
+#define FIX_FLUSHTIMER_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "AutoResetEvent.h"
+#include "Mutex.h"
+#include "Exceptions.h"
+#include "LatencyHistogram.h"
+
+namespace FIX
+{
+/**
+ * Thread calling back once an interval has passed since it was armed.
+ *
+ * Stores that hold writes back to batch them arm it when a batch starts,
+ * so that a partial batch is written even when no later write comes
+ * along to notice that it is due.
+ */
+class FlushTimer
+{
+public:
+  typedef void ( *Callback )( void* );
+
+  /// interval is in milliseconds
+  FlushTimer( Callback callback, void* pArg, int interval )
+  : m_callback( callback ), m_pArg( pArg ), m_interval( interval / 1000.0 ),
+    m_armed( false ), m_armedAt( 0 ), m_stop( false )
+  {
+    if( !thread_spawn( &timerThread, this, m_thread ) )
+      throw ConfigError( "Unable to spawn flush timer thread" );
+  }
+
+  /// Joins the thread, the callback is not called after this returns
+  ~FlushTimer()
+  {
+    {
+      Locker l( m_mutex );
+      m_stop = true;
+    }
+    m_event.signal();
+    thread_join( m_thread );
+  }
+
+  /// Call back once the interval has passed from now
+  void arm()
+  {
+    Locker l( m_mutex );
+    m_armedAt = LatencyHistogram::now();
+    if( m_armed ) return;
+    m_armed = true;
+    m_event.signal();
+  }
+
+private:
+  static THREAD_PROC timerThread( void* p )
+  {
+    static_cast < FlushTimer* > ( p )->run();
+    return 0;
+  }
+
+  void run()
+  {
+    for( ;; )
+    {
+      double wait = 60;
+      {
+        Locker l( m_mutex );
+        if( m_stop ) return;
+        if( m_armed )
+        {
+          wait = m_interval - ( LatencyHistogram::now() - m_armedAt ) / 1e9;
+          if( wait <= 0 ) m_armed = false;
+        }
+      }
+
+      // arm() and the destructor signal, so an idle timer only waits
+      if( wait > 0 )
+        m_event.wait( wait );
+      else
+        m_callback( m_pArg );
+    }
+  }
+
+  Callback m_callback;
+  void* m_pArg;
+  double m_interval;
+  bool m_armed;
+  int64_t m_armedAt;
+  bool m_stop;
+  Mutex m_mutex;
+  AutoResetEvent m_event;
+  thread_id m_thread;
+};
+}
+
+#endif //FIX_FLUSHTIMER_H
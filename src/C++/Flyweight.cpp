@@ -0,0 +1,229 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "Flyweight.h"
+#include "DataDictionary.h"
+#include "FixFieldNumbers.h"
+#include <algorithm>
+
+namespace FIX
+{
+void FlyweightReader::parse( const char* data, size_t length,
+                             const DataDictionary* pDataDictionary )
+EXCEPT ( InvalidMessage )
+{
+  m_data = data;
+  m_length = length;
+  m_fields.clear();
+
+  const char* const end = data + length;
+  const char* pos = data;
+  while( pos != end )
+  {
+    const char* equalSign = ( const char* ) memchr( pos, '=', end - pos );
+    if( !equalSign )
+      throw InvalidMessage( "Equal sign not found in field" );
+
+    Entry entry;
+    if( !IntConvertor::convert( pos, equalSign, entry.tag ) )
+      throw InvalidMessage( "Field tag is invalid: " + std::string( pos, equalSign ) );
+
+    const char* value = equalSign + 1;
+    const char* soh = 0;
+    if( pDataDictionary && pDataDictionary->isDataField( entry.tag ) )
+    {
+      size_t size = dataLength( entry.tag );
+      if( size < ( size_t ) ( end - value ) && value[ size ] == '\001' )
+        soh = value + size;
+    }
+    else
+    {
+      soh = ( const char* ) memchr( value, '\001', end - value );
+    }
+    if( !soh )
+      throw InvalidMessage( "SOH not found at end of field" );
+
+    entry.offset = ( unsigned ) ( value - data );
+    entry.length = ( unsigned ) ( soh - value );
+    m_fields.push_back( entry );
+    pos = soh + 1;
+  }
+}
+
+size_t FlyweightReader::dataLength( int tag ) const
+EXCEPT ( InvalidMessage )
+{
+  // as in Message, the length precedes its data field by one tag
+  int lengthTag = tag == FIELD::Signature ? FIELD::SignatureLength : tag - 1;
+
+  for( size_t i = m_fields.size(); i > 0; --i )
+  {
+    if( m_fields[ i - 1 ].tag != lengthTag ) continue;
+    StringView value = getValue( i - 1 );
+    signed_int result = 0;
+    if( !IntConvertor::convert( value.begin(), value.end(), result ) || result < 0 )
+      throw InvalidMessage( "Unable to determine SOH for data field "
+                            + IntConvertor::convert( tag ) );
+    return ( size_t ) result;
+  }
+
+  throw InvalidMessage( "Data length field " + IntConvertor::convert( lengthTag )
+                        + " was not found for data field "
+                        + IntConvertor::convert( tag ) );
+}
+
+char FlyweightReader::getChar( int tag ) const
+EXCEPT ( FieldNotFound, IncorrectDataFormat )
+{
+  StringView value = getString( tag );
+  if( value.size() != 1 )
+    throw IncorrectDataFormat( tag, value.str() );
+  return value[ 0 ];
+}
+
+signed_int FlyweightReader::getInt( int tag ) const
+EXCEPT ( FieldNotFound, IncorrectDataFormat )
+{
+  StringView value = getString( tag );
+  signed_int result = 0;
+  if( !IntConvertor::convert( value.begin(), value.end(), result ) )
+    throw IncorrectDataFormat( tag, value.str() );
+  return result;
+}
+
+double FlyweightReader::getDouble( int tag ) const
+EXCEPT ( FieldNotFound, IncorrectDataFormat )
+{
+  StringView value = getString( tag );
+  double result = 0.0;
+  if( !DoubleConvertor::convert( value.begin(), value.end(), result ) )
+    throw IncorrectDataFormat( tag, value.str() );
+  return result;
+}
+
+Decimal FlyweightReader::getDecimal( int tag ) const
+EXCEPT ( FieldNotFound, IncorrectDataFormat )
+{
+  StringView value = getString( tag );
+  Decimal result;
+  if( !DecimalConvertor::convert( value.begin(), value.end(), result ) )
+    throw IncorrectDataFormat( tag, value.str() );
+  return result;
+}
+
+bool FlyweightReader::getBool( int tag ) const
+EXCEPT ( FieldNotFound, IncorrectDataFormat )
+{
+  switch( getChar( tag ) )
+  {
+    case 'Y': return true;
+    case 'N': return false;
+    default: throw IncorrectDataFormat( tag, getString( tag ).str() );
+  }
+}
+
+FlyweightWriter::FlyweightWriter( const StringView& beginString,
+                                  const StringView& msgType,
+                                  const StringView& applVerID )
+: m_beginString( beginString.str() ), m_msgType( msgType.str() ),
+  m_applVerID( applVerID.str() )
+{
+  // 8=BeginString<SOH>9=<up to 10 digits><SOH>
+  m_headroom = m_beginString.size() + 16;
+  m_buffer.reserve( 512 );
+  reset();
+}
+
+void FlyweightWriter::reset()
+{
+  m_buffer.assign( m_headroom, '\0' );
+  setString( FIELD::MsgType, m_msgType );
+  if( !m_applVerID.empty() )
+    setString( FIELD::ApplVerID, m_applVerID );
+}
+
+StringView FlyweightWriter::finish()
+{
+  char length[ std::numeric_limits<signed_int>::digits10 + 2 ];
+  char* const lengthEnd = length + sizeof( length );
+  const char* lengthStart = integer_to_string
+    ( length, sizeof( length ), ( signed_int ) ( m_buffer.size() - m_headroom ) );
+
+  // header right before the body, then the checksum over both
+  size_t start = m_headroom - ( m_beginString.size() + ( lengthEnd - lengthStart ) + 6 );
+  char* p = &m_buffer[ start ];
+  *p++ = '8'; *p++ = '=';
+  p = std::copy( m_beginString.begin(), m_beginString.end(), p );
+  *p++ = '\001'; *p++ = '9'; *p++ = '=';
+  p = std::copy( ( const char* ) lengthStart, ( const char* ) lengthEnd, p );
+  *p++ = '\001';
+
+  unsigned char checkSum = 0;
+  for( size_t i = start; i < m_buffer.size(); ++i )
+    checkSum += ( unsigned char ) m_buffer[ i ];
+
+  char trailer[ 7 ] = { '1', '0', '=', 0, 0, 0, '\001' };
+  integer_to_string_padded( trailer + 3, 3, checkSum );
+  m_buffer.append( trailer, sizeof( trailer ) );
+
+  return StringView( m_buffer.data() + start, m_buffer.size() - start );
+}
+
+void FlyweightWriter::setInt( int tag, signed_int value )
+{
+  char buffer[ std::numeric_limits<signed_int>::digits10 + 2 ];
+  char* const end = buffer + sizeof( buffer );
+  const char* start = integer_to_string( buffer, sizeof( buffer ), value );
+  appendTag( tag );
+  append( StringView( start, end - start ) );
+}
+
+void FlyweightWriter::setDouble( int tag, double value, int padding )
+{
+  char buffer[ DoubleConvertor::BUFFFER_SIZE ];
+  int length = DoubleConvertor::convert( value, padding, buffer );
+  appendTag( tag );
+  append( StringView( buffer, length ) );
+}
+
+void FlyweightWriter::setUtcTimeStamp( int tag, const UtcTimeStamp& value,
+                                       int precision )
+EXCEPT ( FieldConvertError )
+{
+  char buffer[ UtcTimeStampConvertor::MAX_LENGTH ];
+  int length = UtcTimeStampConvertor::convert( value, precision, buffer );
+  appendTag( tag );
+  append( StringView( buffer, length ) );
+}
+
+void FlyweightWriter::appendTag( int tag )
+{
+  char buffer[ std::numeric_limits<signed_int>::digits10 + 3 ];
+  char* const end = buffer + sizeof( buffer );
+  end[ -1 ] = '=';
+  const char* start = integer_to_string( buffer, sizeof( buffer ) - 1, tag );
+  m_buffer.append( start, end - start );
+}
+}
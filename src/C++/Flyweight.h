@@ -0,0 +1,180 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_FLYWEIGHT_H
+#define FIX_FLYWEIGHT_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "StringView.h"
+#include "FieldConvertors.h"
+#include "FieldTypes.h"
+#include "Exceptions.h"
+#include <vector>
+#include <string>
+
+namespace FIX
+{
+class DataDictionary;
+
+/**
+ * Reads the fields of a FIX message in place.
+ *
+ * Parsing only records where each field starts in the buffer, values are
+ * converted when asked for and strings are handed out as views, so no
+ * memory is allocated once the table of fields has grown to the size of
+ * the messages read.  The buffer must outlive the reader.  Fields are
+ * found by tag in the order they appear, so the getters return the first
+ * occurrence and repeating groups have to be walked with find().
+ *
+ * The generated Reader classes of each message derive from this one and
+ * add an accessor per field.
+ */
+class FlyweightReader
+{
+public:
+  FlyweightReader() : m_data( 0 ), m_length( 0 ) {}
+  FlyweightReader( const char* data, size_t length,
+                   const DataDictionary* pDataDictionary = 0 )
+  EXCEPT ( InvalidMessage )
+  : m_data( 0 ), m_length( 0 )
+  { parse( data, length, pDataDictionary ); }
+
+  /**
+   * Index the fields of a message, replacing the previous one.  Only the
+   * framing of the fields is checked.  Data fields are recognized when a
+   * data dictionary is given.
+   */
+  void parse( const char* data, size_t length,
+              const DataDictionary* pDataDictionary = 0 )
+  EXCEPT ( InvalidMessage );
+  void parse( const std::string& string,
+              const DataDictionary* pDataDictionary = 0 )
+  EXCEPT ( InvalidMessage )
+  { parse( string.data(), string.size(), pDataDictionary ); }
+
+  /// The buffer being read
+  StringView getData() const { return StringView( m_data, m_length ); }
+
+  /// Number of fields in the message
+  size_t size() const { return m_fields.size(); }
+  int getTag( size_t index ) const { return m_fields[ index ].tag; }
+  StringView getValue( size_t index ) const
+  {
+    const Entry& entry = m_fields[ index ];
+    return StringView( m_data + entry.offset, entry.length );
+  }
+
+  /// Index of the first field with a tag from start on, size() if none
+  size_t find( int tag, size_t start = 0 ) const
+  {
+    size_t count = m_fields.size();
+    for( size_t i = start; i < count; ++i )
+      if( m_fields[ i ].tag == tag ) return i;
+    return count;
+  }
+
+  bool isSet( int tag ) const { return find( tag ) != m_fields.size(); }
+
+  StringView getString( int tag ) const EXCEPT ( FieldNotFound )
+  { return getValue( findOrThrow( tag ) ); }
+  char getChar( int tag ) const EXCEPT ( FieldNotFound, IncorrectDataFormat );
+  signed_int getInt( int tag ) const EXCEPT ( FieldNotFound, IncorrectDataFormat );
+  double getDouble( int tag ) const EXCEPT ( FieldNotFound, IncorrectDataFormat );
+  Decimal getDecimal( int tag ) const EXCEPT ( FieldNotFound, IncorrectDataFormat );
+  bool getBool( int tag ) const EXCEPT ( FieldNotFound, IncorrectDataFormat );
+
+private:
+  struct Entry
+  {
+    int tag;
+    unsigned offset;
+    unsigned length;
+  };
+
+  size_t findOrThrow( int tag ) const EXCEPT ( FieldNotFound )
+  {
+    size_t index = find( tag );
+    if( index == m_fields.size() ) throw FieldNotFound( tag );
+    return index;
+  }
+
+  size_t dataLength( int tag ) const EXCEPT ( InvalidMessage );
+
+  const char* m_data;
+  size_t m_length;
+  std::vector < Entry > m_fields;
+};
+
+/**
+ * Writes a FIX message straight into a buffer of its own.
+ *
+ * BeginString, BodyLength and MsgType are written for the caller, the
+ * header is built in room left ahead of the body once its length is
+ * known and the CheckSum is appended by finish(), so nothing is copied
+ * after a field has been written.  Fields go out in the order they are
+ * set, header fields have to come first.  The buffer is kept from one
+ * message to the next, so once it has grown no memory is allocated.
+ *
+ * The generated Writer classes of each message derive from this one and
+ * add a setter per field.
+ */
+class FlyweightWriter
+{
+public:
+  FlyweightWriter( const StringView& beginString, const StringView& msgType,
+                   const StringView& applVerID = StringView() );
+
+  /// Start the next message of the same type
+  void reset();
+  /// Complete the message, valid until the next reset
+  StringView finish();
+
+  void setString( int tag, const StringView& value )
+  { appendTag( tag ); append( value ); }
+  void setChar( int tag, char value )
+  { appendTag( tag ); m_buffer += value; m_buffer += '\001'; }
+  void setInt( int tag, signed_int value );
+  void setDouble( int tag, double value, int padding = 0 );
+  void setDecimal( int tag, const Decimal& value, int padding = 0 )
+  { appendTag( tag ); DecimalConvertor::convert( value, padding, m_buffer ); m_buffer += '\001'; }
+  void setBool( int tag, bool value )
+  { setChar( tag, value ? 'Y' : 'N' ); }
+  void setUtcTimeStamp( int tag, const UtcTimeStamp& value, int precision = 0 )
+  EXCEPT ( FieldConvertError );
+
+private:
+  void appendTag( int tag );
+  void append( const StringView& value )
+  { m_buffer.append( value.data(), value.size() ); m_buffer += '\001'; }
+
+  std::string m_beginString;
+  std::string m_msgType;
+  std::string m_applVerID;
+  std::string m_buffer;
+  /// room left for BeginString and BodyLength
+  size_t m_headroom;
+};
+}
+
+#endif //FIX_FLYWEIGHT_H
@@ -0,0 +1,123 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_GROUPVIEW
+#define FIX_GROUPVIEW
+
+#ifdef _MSC_VER
+#pragma warning( disable: 4786 )
+#endif
+
+#include "FieldMap.h"
+#include <iterator>
+#include <vector>
+
+namespace FIX
+{
+/**
+ * Base class for the generated read-only repeating group entries.
+ *
+ * An entry only points at an instance parsed into its message, so
+ * fields are read in place rather than out of a copied Group.
+ */
+class GroupEntry
+{
+public:
+  GroupEntry( const FieldMap* pMap = 0 ) : m_pMap( pMap ) {}
+
+  /// The group instance this entry reads from
+  const FieldMap& getFieldMap() const { return *m_pMap; }
+
+protected:
+  const FieldMap* m_pMap;
+};
+
+/**
+ * Read-only range over the instances of a repeating group.
+ *
+ * The group is looked up once when the view is created and iterating
+ * it copies nothing, so a view is only valid as long as its message
+ * and must not be kept across changes to the group.
+ */
+template < typename Entry > class GroupView
+{
+public:
+  typedef std::vector < FieldMap* > Instances;
+
+  class const_iterator
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef Entry value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const Entry* pointer;
+    typedef const Entry& reference;
+
+    const_iterator() {}
+    explicit const_iterator( Instances::const_iterator i ) : m_i( i ) {}
+
+    reference operator*() const
+    { m_entry = Entry( *m_i ); return m_entry; }
+    pointer operator->() const { return &**this; }
+
+    const_iterator& operator++() { ++m_i; return *this; }
+    const_iterator operator++( int )
+    { const_iterator copy( *this ); ++m_i; return copy; }
+
+    bool operator==( const const_iterator& rhs ) const
+    { return m_i == rhs.m_i; }
+    bool operator!=( const const_iterator& rhs ) const
+    { return m_i != rhs.m_i; }
+
+  private:
+    Instances::const_iterator m_i;
+    mutable Entry m_entry;
+  };
+  typedef const_iterator iterator;
+
+  GroupView( const FieldMap& map, int field )
+  : m_pInstances( map.getGroupVector( field ) ) {}
+
+  size_t size() const
+  { return m_pInstances ? m_pInstances->size() : 0; }
+  bool empty() const { return size() == 0; }
+
+  const_iterator begin() const
+  { return const_iterator( instances().begin() ); }
+  const_iterator end() const
+  { return const_iterator( instances().end() ); }
+
+  /// Entry at a zero based index, unlike FieldMap::getGroup
+  Entry operator[]( size_t index ) const
+  { return Entry( instances()[ index ] ); }
+
+private:
+  const Instances& instances() const
+  {
+    static const Instances empty;
+    return m_pInstances ? *m_pInstances : empty;
+  }
+
+  const Instances* m_pInstances;
+};
+}
+
+#endif //FIX_GROUPVIEW
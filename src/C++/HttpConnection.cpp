@@ -125,6 +125,14 @@ void HttpConnection::processStream()
 
 void HttpConnection::processRequest( const HttpMessage& request )
 {
+  if( request.getRootString() == "/metrics"
+      || request.getRootString() == "/metrics.json" )
+  {
+    processMetrics( request, request.getRootString() == "/metrics.json" );
+    disconnect();
+    return;
+  }
+
   int error = 200;
   std::stringstream h;
   std::stringstream b;
@@ -671,6 +679,216 @@ void HttpConnection::processRefreshSession
   }
 }
 
+namespace
+{
+  const char* LATENCY_STAGE_NAMES[] =
+  { "frame", "parse", "validate", "application", "serialize", "persist", "send" };
+
+  const double PERCENTILES[] = { 50, 90, 99, 99.9 };
+  const char* QUANTILES[] = { "0.5", "0.9", "0.99", "0.999" };
+  const int NUM_PERCENTILES = 4;
+
+  struct SessionSample
+  {
+    std::string name;
+    bool loggedOn;
+    int queued;
+    size_t sendMessages;
+    size_t sendBytes;
+    bool counted;
+    SessionMetrics::Snapshot counts;
+    std::vector<LatencyHistogram> latency;
+  };
+
+  std::string escape( const std::string& value )
+  {
+    std::string result;
+    for( std::string::size_type i = 0; i < value.size(); ++i )
+    {
+      if( value[i] == '\\' || value[i] == '"' )
+        result += '\\';
+      if( value[i] == '\n' )
+        result += "\\n";
+      else
+        result += value[i];
+    }
+    return result;
+  }
+
+  std::string rejectReason( int reason )
+  {
+    return reason == SessionMetrics::REJECT_REASONS - 1
+      ? std::string( "other" ) : IntConvertor::convert( reason );
+  }
+
+  void showGauge( std::stringstream& b, const std::vector<SessionSample>& samples,
+                  const std::string& name, int field )
+  {
+    b << "# TYPE quickfix_" << name << " gauge\n";
+    std::vector<SessionSample>::const_iterator i;
+    for( i = samples.begin(); i != samples.end(); ++i )
+    {
+      b << "quickfix_" << name << "{session=\"" << i->name << "\"} ";
+      switch( field )
+      {
+      case 0: b << ( i->loggedOn ? 1 : 0 ); break;
+      case 1: b << i->queued; break;
+      case 2: b << i->sendMessages; break;
+      default: b << i->sendBytes;
+      }
+      b << "\n";
+    }
+  }
+}
+
+void HttpConnection::processMetrics( const HttpMessage& request, bool json )
+{
+  std::vector<SessionSample> samples;
+
+  std::set<SessionID> sessions = Session::getSessions();
+  std::set<SessionID>::iterator i;
+  for( i = sessions.begin(); i != sessions.end(); ++i )
+  {
+    Session* pSession = Session::lookupSession( *i );
+    if( !pSession ) continue;
+
+    SessionSample sample;
+    sample.name = escape( i->toString() );
+    sample.loggedOn = pSession->isLoggedOn();
+    sample.queued = pSession->getQueuedMessages();
+    pSession->getSendQueue( sample.sendMessages, sample.sendBytes );
+    const SessionMetrics* pMetrics = pSession->getMetrics();
+    sample.counted = pMetrics != 0;
+    if( pMetrics )
+      pMetrics->getSnapshot( sample.counts );
+    if( pSession->getLatencyHistograms() )
+    {
+      for( int stage = 0; stage < Session::LATENCY_STAGES; ++stage )
+      {
+        sample.latency.push_back
+          ( pSession->getLatencyHistogram( ( Session::LatencyStage ) stage ) );
+      }
+    }
+    samples.push_back( sample );
+  }
+
+  std::stringstream b;
+  std::vector<SessionSample>::const_iterator s;
+
+  if( json )
+  {
+    b << "{\"sessions\":[";
+    for( s = samples.begin(); s != samples.end(); ++s )
+    {
+      if( s != samples.begin() ) b << ",";
+      b << "{\"session\":\"" << s->name << "\""
+        << ",\"logged_on\":" << ( s->loggedOn ? "true" : "false" )
+        << ",\"queued_messages\":" << s->queued
+        << ",\"send_queue_messages\":" << s->sendMessages
+        << ",\"send_queue_bytes\":" << s->sendBytes;
+
+      if( s->counted )
+      {
+        b << ",\"counters\":{";
+        for( int c = 0; c < SessionMetrics::REJECTS_SENT; ++c )
+        {
+          b << "\"" << SessionMetrics::getName( ( SessionMetrics::Counter ) c )
+            << "\":" << s->counts.counts[ c ] << ",";
+        }
+        b << "\"rejects_sent\":{";
+        bool first = true;
+        for( int r = 0; r < SessionMetrics::REJECT_REASONS; ++r )
+        {
+          uint64_t count = s->counts.counts[ SessionMetrics::REJECTS_SENT + r ];
+          if( !count ) continue;
+          b << ( first ? "" : "," ) << "\"" << rejectReason( r ) << "\":" << count;
+          first = false;
+        }
+        b << "}}";
+      }
+
+      if( s->latency.size() )
+      {
+        b << ",\"latency_nanoseconds\":{";
+        for( size_t stage = 0; stage < s->latency.size(); ++stage )
+        {
+          const LatencyHistogram& histogram = s->latency[ stage ];
+          b << ( stage ? "," : "" ) << "\"" << LATENCY_STAGE_NAMES[ stage ] << "\":{"
+            << "\"count\":" << histogram.getCount()
+            << ",\"mean\":" << histogram.getMean()
+            << ",\"max\":" << histogram.getMax();
+          for( int p = 0; p < NUM_PERCENTILES; ++p )
+          {
+            b << ",\"" << QUANTILES[ p ] << "\":"
+              << histogram.getValueAtPercentile( PERCENTILES[ p ] );
+          }
+          b << "}";
+        }
+        b << "}";
+      }
+      b << "}";
+    }
+    b << "]}";
+
+    send( HttpMessage::createResponse( 200, b.str(), "application/json" ) );
+    return;
+  }
+
+  showGauge( b, samples, "session_logged_on", 0 );
+  showGauge( b, samples, "queued_messages", 1 );
+  showGauge( b, samples, "send_queue_messages", 2 );
+  showGauge( b, samples, "send_queue_bytes", 3 );
+
+  for( int c = 0; c < SessionMetrics::REJECTS_SENT; ++c )
+  {
+    std::string name = SessionMetrics::getName( ( SessionMetrics::Counter ) c );
+    b << "# TYPE quickfix_" << name << "_total counter\n";
+    for( s = samples.begin(); s != samples.end(); ++s )
+    {
+      if( !s->counted ) continue;
+      b << "quickfix_" << name << "_total{session=\"" << s->name << "\"} "
+        << s->counts.counts[ c ] << "\n";
+    }
+  }
+
+  b << "# TYPE quickfix_rejects_sent_total counter\n";
+  for( s = samples.begin(); s != samples.end(); ++s )
+  {
+    if( !s->counted ) continue;
+    for( int r = 0; r < SessionMetrics::REJECT_REASONS; ++r )
+    {
+      uint64_t count = s->counts.counts[ SessionMetrics::REJECTS_SENT + r ];
+      if( !count ) continue;
+      b << "quickfix_rejects_sent_total{session=\"" << s->name
+        << "\",reason=\"" << rejectReason( r ) << "\"} " << count << "\n";
+    }
+  }
+
+  b << "# TYPE quickfix_latency_nanoseconds summary\n";
+  for( s = samples.begin(); s != samples.end(); ++s )
+  {
+    for( size_t stage = 0; stage < s->latency.size(); ++stage )
+    {
+      const LatencyHistogram& histogram = s->latency[ stage ];
+      std::string labels = "session=\"" + s->name + "\",stage=\""
+        + LATENCY_STAGE_NAMES[ stage ] + "\"";
+      for( int p = 0; p < NUM_PERCENTILES; ++p )
+      {
+        b << "quickfix_latency_nanoseconds{" << labels << ",quantile=\""
+          << QUANTILES[ p ] << "\"} "
+          << histogram.getValueAtPercentile( PERCENTILES[ p ] ) << "\n";
+      }
+      b << "quickfix_latency_nanoseconds_sum{" << labels << "} "
+        << ( uint64_t ) ( histogram.getMean() * histogram.getCount() ) << "\n";
+      b << "quickfix_latency_nanoseconds_count{" << labels << "} "
+        << histogram.getCount() << "\n";
+    }
+  }
+
+  send( HttpMessage::createResponse
+    ( 200, b.str(), "text/plain; version=0.0.4; charset=utf-8" ) );
+}
+
 void HttpConnection::showRow
 ( std::stringstream& s, const std::string& name, bool value, const std::string& url )
 {
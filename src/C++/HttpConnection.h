@@ -54,6 +54,7 @@ private:
   void processSession( const HttpMessage&, std::stringstream& h, std::stringstream& b );
   void processResetSession( const HttpMessage&, std::stringstream& h, std::stringstream& b );
   void processRefreshSession( const HttpMessage&, std::stringstream& h, std::stringstream& b );
+  void processMetrics( const HttpMessage&, bool json );
  
  void showToggle
     ( std::stringstream& s, const std::string& name, bool value, const std::string& url );
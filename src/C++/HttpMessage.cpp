@@ -83,7 +83,8 @@ EXCEPT ( InvalidMessage )
   }
 }
 
-std::string HttpMessage::createResponse( int error, const std::string& text )
+std::string HttpMessage::createResponse( int error, const std::string& text,
+                                         const std::string& contentType )
 {
   std::string errorString;
   switch( error )
@@ -131,13 +132,16 @@ std::string HttpMessage::createResponse( int error, const std::string& text )
   default: errorString = "Unknown";
   }
 
+  bool html = contentType.compare( 0, 9, "text/html" ) == 0;
+
   std::stringstream response;
   response << "HTTP/1.1 " << error << " " << errorString << "\r\n"
            << "Server: QuickFIX" << "\r\n"
-           << "Content-Type: text/html; charset=iso-8859-1" << "\r\n\r\n"
-           << "<!DOCTYPE HTML PUBLIC \"-//IETF//DTD HTML 2.0//EN\">";
+           << "Content-Type: " << contentType << "\r\n\r\n";
+  if( html )
+    response << "<!DOCTYPE HTML PUBLIC \"-//IETF//DTD HTML 2.0//EN\">";
 
-  if( error < 200 || error >= 300 )
+  if( html && ( error < 200 || error >= 300 ) )
     response << "<HTML><HEAD><TITLE>" << error << " " << errorString << "</TITLE></HEAD><BODY>"
              << "<H1>" << error << " " << errorString << "</H1>" << text << "</BODY></HTML>";
   else
@@ -113,7 +113,8 @@ public:
     m_parameters.erase( key );
   }  
 
-  static std::string createResponse( int error = 0, const std::string& text = "" );
+  static std::string createResponse( int error = 0, const std::string& text = "",
+                                     const std::string& contentType = "text/html; charset=iso-8859-1" );
  
 private:
   std::string m_root;
@@ -0,0 +1,171 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "InboundPipeline.h"
+#include "Session.h"
+#include "Responder.h"
+
+namespace FIX
+{
+InboundPipeline::InboundPipeline
+( Session& session, Responder& responder, size_t depth )
+: m_session( session ), m_responder( responder ), m_queue( depth ),
+  m_sleeping( 0 ), m_stop( false ), m_discard( false ), m_running( false ),
+  m_fullCount( 0 )
+{
+  if( !thread_spawn( &sequencerThread, this, m_thread ) )
+    throw RuntimeError( "Unable to spawn inbound pipeline thread" );
+  m_running = true;
+}
+
+InboundPipeline::~InboundPipeline()
+{
+  stop();
+}
+
+bool InboundPipeline::push( std::string& msg )
+{
+  Entry* pEntry = m_queue.claim();
+  if( !pEntry )
+  {
+    ++m_fullCount;
+    while( !( pEntry = m_queue.claim() ) )
+    {
+      if( m_stop ) return false;
+      wake();
+      process_sleep( 0.00001 );
+    }
+  }
+  if( m_stop ) return false;
+
+  pEntry->string.swap( msg );
+  pEntry->parsed = m_session.prepare
+    ( pEntry->string, pEntry->message, pEntry->validated );
+  m_queue.publish();
+  wake();
+  return true;
+}
+
+void InboundPipeline::stop()
+{
+  if( !m_running ) return;
+  m_running = false;
+  m_stop = true;
+  m_event.signal();
+  thread_join( m_thread );
+}
+
+THREAD_PROC InboundPipeline::sequencerThread( void* p )
+{
+  InboundPipeline* pPipeline = static_cast < InboundPipeline* > ( p );
+  pPipeline->run();
+  return 0;
+}
+
+void InboundPipeline::run()
+{
+  int idle = 0;
+  while( true )
+  {
+    Entry* pEntry = m_queue.front();
+    if( pEntry )
+    {
+      process( *pEntry );
+      m_queue.pop();
+      idle = 0;
+    }
+    // everything pushed before stop() is processed first
+    else if( m_stop )
+    {
+      break;
+    }
+    else if( ++idle >= SPIN )
+    {
+      sleep();
+      idle = 0;
+    }
+  }
+}
+
+void InboundPipeline::process( Entry& entry )
+{
+  if( m_discard ) return;
+
+  try
+  {
+    if( entry.parsed )
+      m_session.next( entry.string, entry.message, entry.validated, UtcTimeStamp() );
+    else
+      m_session.next( entry.string, UtcTimeStamp() );
+  }
+  catch( InvalidMessage& )
+  {
+    // as with a single thread, the rest of the stream is not read
+    if( !m_session.isLoggedOn() )
+    {
+      m_discard = true;
+      m_responder.disconnect();
+    }
+  }
+}
+
+void InboundPipeline::sleep()
+{
+  // sleep only until the session has a heartbeat or timeout due, but
+  // no longer than a second to see logout requests from other threads
+  UtcTimeStamp now;
+  UtcTimeStamp next = m_session.getNextTimeout( now );
+  int64_t nanos = next.getNanosSinceEpoch() - now.getNanosSinceEpoch();
+  if( nanos > DateTime::NANOS_PER_SEC ) nanos = DateTime::NANOS_PER_SEC;
+
+  if( nanos > 0 )
+  {
+    // announce the sleep before looking at the queue a last time, so a
+    // push either is seen here or sees the flag and signals the event
+#ifdef _MSC_VER
+    InterlockedExchange( &m_sleeping, 1 );
+#else
+    __atomic_store_n( &m_sleeping, 1, __ATOMIC_SEQ_CST );
+#endif
+    if( m_queue.empty() && !m_stop )
+      m_event.wait( ( double ) nanos / DateTime::NANOS_PER_SEC );
+    m_sleeping = 0;
+  }
+
+  if( m_queue.empty() && !m_stop )
+    m_session.next();
+}
+
+void InboundPipeline::wake()
+{
+#ifdef _MSC_VER
+  MemoryBarrier();
+#else
+  __atomic_thread_fence( __ATOMIC_SEQ_CST );
+#endif
+  if( m_sleeping )
+    m_event.signal();
+}
+}
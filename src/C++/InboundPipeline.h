@@ -0,0 +1,102 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_INBOUNDPIPELINE_H
+#define FIX_INBOUNDPIPELINE_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Message.h"
+#include "SpscQueue.h"
+#include "AutoResetEvent.h"
+#include "Utility.h"
+
+namespace FIX
+{
+class Session;
+class Responder;
+
+/**
+ * Splits the handling of incoming messages of a session over two threads.
+ *
+ * The thread reading the socket frames each message and hands it to push(),
+ * which parses and validates it with Session::prepare() into a reusable
+ * slot of a single producer, single consumer queue.  A sequencing thread
+ * owned by the pipeline takes the messages in the order they were pushed
+ * and passes them to Session::next(), so sequence numbers, resends and the
+ * application callbacks are handled exactly as before, only without the
+ * parsing cost.  While the queue is empty the sequencing thread also drives
+ * the timers of the session in place of the reading thread.
+ */
+class InboundPipeline
+{
+public:
+  /// Starts the sequencing thread, depth is the number of queued messages
+  InboundPipeline( Session& session, Responder& responder, size_t depth );
+  ~InboundPipeline();
+
+  /**
+   * Queue a message, waiting while the queue is full.  Takes the contents
+   * of msg and leaves it holding a buffer to reuse.  Returns false once
+   * the pipeline is stopped.
+   */
+  bool push( std::string& msg );
+  /// Process everything queued so far and stop the sequencing thread
+  void stop();
+
+  /// Number of pushes that had to wait for the sequencing thread
+  unsigned long getFullCount() const { return m_fullCount; }
+
+private:
+  struct Entry
+  {
+    Entry() : parsed( false ), validated( false ) {}
+
+    std::string string;
+    Message message;
+    bool parsed;
+    bool validated;
+  };
+
+  enum { SPIN = 1000 };
+
+  static THREAD_PROC sequencerThread( void* p );
+  void run();
+  void process( Entry& entry );
+  void sleep();
+  void wake();
+
+  Session& m_session;
+  Responder& m_responder;
+  SpscQueue < Entry > m_queue;
+  AutoResetEvent m_event;
+  volatile long m_sleeping;
+  volatile bool m_stop;
+  bool m_discard;
+  bool m_running;
+  unsigned long m_fullCount;
+  thread_id m_thread;
+};
+}
+
+#endif //FIX_INBOUNDPIPELINE_H
@@ -0,0 +1,102 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "LatencyHistogram.h"
+#include "Utility.h"
+#include <limits>
+#include <string.h>
+
+namespace FIX
+{
+int64_t LatencyHistogram::now()
+{
+#ifdef _MSC_VER
+  static LARGE_INTEGER frequency = { 0 };
+  if( !frequency.QuadPart )
+    QueryPerformanceFrequency( &frequency );
+  LARGE_INTEGER counter;
+  QueryPerformanceCounter( &counter );
+  return ( int64_t ) ( ( double ) counter.QuadPart * 1e9 / ( double ) frequency.QuadPart );
+#else
+  timespec time;
+  clock_gettime( CLOCK_MONOTONIC, &time );
+  return ( int64_t ) time.tv_sec * 1000000000 + time.tv_nsec;
+#endif
+}
+
+void LatencyHistogram::merge( const LatencyHistogram& other )
+{
+  for( int i = 0; i < BUCKETS; ++i )
+    m_counts[ i ] += other.m_counts[ i ];
+  m_count += other.m_count;
+  m_total += other.m_total;
+  if( other.m_min < m_min ) m_min = other.m_min;
+  if( other.m_max > m_max ) m_max = other.m_max;
+}
+
+void LatencyHistogram::reset()
+{
+  memset( m_counts, 0, sizeof(m_counts) );
+  m_count = 0;
+  m_total = 0;
+  m_min = std::numeric_limits<int64_t>::max();
+  m_max = 0;
+}
+
+int64_t LatencyHistogram::getValueAtPercentile( double percentile ) const
+{
+  if( !m_count )
+    return 0;
+  if( percentile > 100 )
+    percentile = 100;
+
+  uint64_t target = ( uint64_t ) ( percentile / 100 * ( double ) m_count + 0.5 );
+  if( target < 1 ) target = 1;
+
+  uint64_t seen = 0;
+  for( int i = 0; i < BUCKETS; ++i )
+  {
+    seen += m_counts[ i ];
+    if( seen >= target )
+    {
+      // the last bucket has no upper bound
+      int64_t value = i == BUCKETS - 1 ? m_max : highest( i );
+      if( value > m_max ) value = m_max;
+      if( value < m_min ) value = m_min;
+      return value;
+    }
+  }
+  return m_max;
+}
+
+int64_t LatencyHistogram::highest( int index )
+{
+  if( index < SUB_BUCKETS * 2 )
+    return index;
+  int shift = index / SUB_BUCKETS - 1;
+  int64_t mantissa = index - shift * SUB_BUCKETS;
+  return ( ( mantissa + 1 ) << shift ) - 1;
+}
+}
@@ -0,0 +1,121 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_LATENCYHISTOGRAM_H
+#define FIX_LATENCYHISTOGRAM_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#if defined(_MSC_VER) && (_MSC_VER < 1600)
+ #include "stdint_msvc.h"
+#else
+ #include <stdint.h>
+#endif
+
+namespace FIX
+{
+/**
+ * Histogram of latencies in nanoseconds.
+ *
+ * Values are counted in buckets whose width grows with the value, 32 to
+ * each power of two, so any value is reported within about 3% of what was
+ * recorded while the whole range up to about 18 minutes fits in a fixed
+ * array.  Recording is a few instructions and never allocates.  A single
+ * thread may record; reading from another thread sees a recent, possibly
+ * slightly inconsistent, state.
+ */
+class LatencyHistogram
+{
+public:
+  LatencyHistogram() { reset(); }
+
+  /// Nanoseconds from an arbitrary point, never going backwards
+  static int64_t now();
+
+  void record( int64_t nanos )
+  {
+    if( nanos < 0 ) nanos = 0;
+    ++m_counts[ index( nanos ) ];
+    ++m_count;
+    m_total += nanos;
+    if( nanos < m_min ) m_min = nanos;
+    if( nanos > m_max ) m_max = nanos;
+  }
+
+  /// Record the time elapsed since start and return the current time
+  int64_t recordSince( int64_t start )
+  {
+    int64_t time = now();
+    record( time - start );
+    return time;
+  }
+
+  void merge( const LatencyHistogram& );
+  void reset();
+
+  uint64_t getCount() const { return m_count; }
+  int64_t getMin() const { return m_count ? m_min : 0; }
+  int64_t getMax() const { return m_max; }
+  double getMean() const
+  { return m_count ? ( double ) m_total / ( double ) m_count : 0; }
+  /// Value at or below which the given percentage of recorded values fall
+  int64_t getValueAtPercentile( double percentile ) const;
+
+private:
+  enum
+  {
+    SUB_BUCKET_BITS = 5,
+    SUB_BUCKETS = 1 << SUB_BUCKET_BITS,
+    // values of 2^40 nanoseconds and up share the last bucket
+    MAX_SHIFT = 40 - SUB_BUCKET_BITS - 1,
+    BUCKETS = ( MAX_SHIFT + 2 ) * SUB_BUCKETS
+  };
+
+  static int index( int64_t nanos )
+  {
+    uint64_t value = ( uint64_t ) nanos;
+    if( value < SUB_BUCKETS * 2 )
+      return ( int ) value;
+
+#ifdef __GNUC__
+    int shift = 63 - __builtin_clzll( value ) - SUB_BUCKET_BITS;
+#else
+    int shift = 0;
+    while( ( value >> shift ) >= SUB_BUCKETS * 2 ) ++shift;
+#endif
+    if( shift > MAX_SHIFT )
+      return BUCKETS - 1;
+    return shift * SUB_BUCKETS + ( int ) ( value >> shift );
+  }
+
+  static int64_t highest( int index );
+
+  uint64_t m_counts[ BUCKETS ];
+  uint64_t m_count;
+  int64_t m_total;
+  int64_t m_min;
+  int64_t m_max;
+};
+}
+
+#endif //FIX_LATENCYHISTOGRAM_H
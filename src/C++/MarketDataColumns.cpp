@@ -0,0 +1,241 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "MarketDataColumns.h"
+#include "DataDictionary.h"
+#include "FixFieldNumbers.h"
+
+namespace FIX
+{
+bool MarketDataColumns::decode( const Message& message,
+                                const DataDictionary* pDataDictionary )
+EXCEPT ( InvalidMessage, IncorrectDataFormat )
+{
+  clear();
+
+  std::string::size_type pos = 0;
+  const DataDictionary* pPendingDictionary = 0;
+  const std::string* pString = message.getPendingBody( pos, pPendingDictionary );
+  if( !pDataDictionary )
+    pDataDictionary = pPendingDictionary;
+
+  if( pString && pDataDictionary )
+  {
+    m_reader.parse( pString->data() + pos, pString->size() - pos, pDataDictionary );
+    return decodeEntries( message.getHeader().getField( FIELD::MsgType ),
+                          *pDataDictionary );
+  }
+
+  message.parseBody();
+  return decodeEntries( message, pDataDictionary );
+}
+
+bool MarketDataColumns::decode( const std::string& message,
+                                const DataDictionary& dataDictionary )
+EXCEPT ( InvalidMessage, IncorrectDataFormat )
+{
+  clear();
+
+  m_reader.parse( message, &dataDictionary );
+  if( !m_reader.isSet( FIELD::MsgType ) )
+    return false;
+  StringView msgType = m_reader.getString( FIELD::MsgType );
+  m_msgType.assign( msgType.data(), msgType.size() );
+  return decodeEntries( m_msgType, dataDictionary );
+}
+
+void MarketDataColumns::clear()
+{
+  m_entryTypes.clear();
+  m_updateActions.clear();
+  m_prices.clear();
+  m_sizes.clear();
+  m_positions.clear();
+  m_times.clear();
+}
+
+bool MarketDataColumns::decodeEntries( const std::string& msgType,
+                                       const DataDictionary& dataDictionary )
+EXCEPT ( InvalidMessage, IncorrectDataFormat )
+{
+  int delim = 0;
+  const DataDictionary* pGroup = 0;
+  if( !dataDictionary.getGroup( msgType, FIELD::NoMDEntries, delim, pGroup ) )
+    return false;
+
+  size_t index = m_reader.find( FIELD::NoMDEntries );
+  if( index == m_reader.size() )
+    return false;
+
+  setTimeType( &dataDictionary );
+
+  // the count comes off the wire, every entry takes at least one field
+  signed_int count = m_reader.getInt( FIELD::NoMDEntries );
+  if( count > 0 && ( size_t ) count > m_reader.size() - index )
+    count = ( signed_int ) ( m_reader.size() - index );
+  if( count > 0 && ( size_t ) count > m_entryTypes.capacity() )
+  {
+    m_entryTypes.reserve( count );
+    m_updateActions.reserve( count );
+    m_prices.reserve( count );
+    m_sizes.reserve( count );
+    m_positions.reserve( count );
+    m_times.reserve( count );
+  }
+
+  // entries run from the delimiter on until a field the group does not have
+  for( ++index; index < m_reader.size(); )
+  {
+    int tag = m_reader.getTag( index );
+    if( tag != delim && !pGroup->isField( tag ) )
+      break;
+    if( tag == delim || empty() )
+      startEntry();
+
+    int nestedDelim = 0;
+    const DataDictionary* pNested = 0;
+    if( pGroup->getGroup( msgType, tag, nestedDelim, pNested ) )
+    {
+      index = skipGroup( index + 1, msgType, *pNested );
+      continue;
+    }
+
+    setField( tag, m_reader.getValue( index ) );
+    ++index;
+  }
+
+  return true;
+}
+
+bool MarketDataColumns::decodeEntries( const FieldMap& body,
+                                       const DataDictionary* pDataDictionary )
+EXCEPT ( IncorrectDataFormat )
+{
+  const std::vector < FieldMap* >* pEntries = body.getGroupVector( FIELD::NoMDEntries );
+  if( !pEntries )
+    return false;
+
+  setTimeType( pDataDictionary );
+
+  std::vector < FieldMap* >::const_iterator i;
+  for( i = pEntries->begin(); i != pEntries->end(); ++i )
+  {
+    startEntry();
+    FieldMap::const_iterator j;
+    for( j = ( *i )->begin(); j != ( *i )->end(); ++j )
+      setField( j->getTag(), j->getString() );
+  }
+
+  return true;
+}
+
+size_t MarketDataColumns::skipGroup( size_t index, const std::string& msgType,
+                                     const DataDictionary& groupDictionary ) const
+{
+  while( index < m_reader.size() )
+  {
+    int tag = m_reader.getTag( index );
+    if( !groupDictionary.isField( tag ) )
+      break;
+
+    int delim = 0;
+    const DataDictionary* pNested = 0;
+    if( groupDictionary.getGroup( msgType, tag, delim, pNested ) )
+      index = skipGroup( index + 1, msgType, *pNested );
+    else
+      ++index;
+  }
+  return index;
+}
+
+void MarketDataColumns::setTimeType( const DataDictionary* pDataDictionary )
+{
+  TYPE::Type type = TYPE::UtcTimeOnly;
+  if( pDataDictionary )
+    pDataDictionary->getFieldType( FIELD::MDEntryTime, type );
+  m_timeOnly = type != TYPE::UtcTimeStamp;
+}
+
+void MarketDataColumns::startEntry()
+{
+  m_entryTypes.push_back( 0 );
+  m_updateActions.push_back( 0 );
+  m_prices.push_back( 0 );
+  m_sizes.push_back( 0 );
+  m_positions.push_back( 0 );
+  m_times.push_back( 0 );
+}
+
+void MarketDataColumns::setField( int tag, const StringView& value )
+EXCEPT ( IncorrectDataFormat )
+{
+  bool converted = true;
+
+  switch( tag )
+  {
+  case FIELD::MDEntryType:
+    converted = value.size() == 1;
+    if( converted ) m_entryTypes.back() = value[ 0 ];
+    break;
+  case FIELD::MDUpdateAction:
+    converted = value.size() == 1;
+    if( converted ) m_updateActions.back() = value[ 0 ];
+    break;
+  case FIELD::MDEntryPx:
+    converted = DoubleConvertor::convert( value.begin(), value.end(), m_prices.back() );
+    break;
+  case FIELD::MDEntrySize:
+    converted = DoubleConvertor::convert( value.begin(), value.end(), m_sizes.back() );
+    break;
+  case FIELD::MDEntryPositionNo:
+    converted = IntConvertor::convert( value.begin(), value.end(), m_positions.back() );
+    break;
+  case FIELD::MDEntryTime:
+    try
+    {
+      m_times.back() = convertTime( value );
+    }
+    catch( FieldConvertError& )
+    {
+      converted = false;
+    }
+    break;
+  }
+
+  if( !converted )
+    throw IncorrectDataFormat( tag, value.str() );
+}
+
+int64_t MarketDataColumns::convertTime( const StringView& value ) const
+EXCEPT ( FieldConvertError )
+{
+  if( !m_timeOnly )
+    return UtcTimeStampConvertor::convert( value.data(), value.size() ).getNanosSinceEpoch();
+
+  UtcTimeOnly time = UtcTimeOnlyConvertor::convert( value.data(), value.size() );
+  int64_t seconds = ( time.getHour() * 60 + time.getMinute() ) * 60 + time.getSecond();
+  return seconds * DateTime::NANOS_PER_SEC + time.getNanosecond();
+}
+}
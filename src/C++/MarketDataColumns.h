@@ -0,0 +1,114 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_MARKETDATACOLUMNS_H
+#define FIX_MARKETDATACOLUMNS_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Flyweight.h"
+#include "Message.h"
+#include <vector>
+
+namespace FIX
+{
+class DataDictionary;
+
+/**
+ * Decodes the NoMDEntries group of market data messages into columns.
+ *
+ * Each entry of the group becomes one row across arrays of entry types,
+ * update actions, prices, sizes, positions and times, so the entries of
+ * a snapshot or an incremental refresh can be processed in bulk without
+ * a Group being built for each.  The group is located with the data
+ * dictionary and the time column follows the type it gives MDEntryTime:
+ * nanoseconds since midnight for UTCTimeOnly, since the epoch for a
+ * UTCTimestamp.  Fields an entry does not carry are left 0.
+ *
+ * The columns keep their capacity from one message to the next, so once
+ * they have grown to the largest group seen nothing is allocated.  When
+ * its MsgType is listed in LazyBodyMsgTypes a message arrives at fromApp
+ * with its body unparsed and decode reads the group straight from the
+ * received string.
+ */
+class MarketDataColumns
+{
+public:
+  MarketDataColumns() : m_timeOnly( true ) {}
+
+  /**
+   * Decode the entries of a message, replacing the previous ones.  The
+   * data dictionary defaults to the one a lazily parsed message carries.
+   * Returns false if there is no NoMDEntries group to decode.
+   */
+  bool decode( const Message& message, const DataDictionary* pDataDictionary = 0 )
+  EXCEPT ( InvalidMessage, IncorrectDataFormat );
+  /// Decode the entries of a message that has not been parsed at all
+  bool decode( const std::string& message, const DataDictionary& dataDictionary )
+  EXCEPT ( InvalidMessage, IncorrectDataFormat );
+
+  void clear();
+  size_t size() const { return m_entryTypes.size(); }
+  bool empty() const { return m_entryTypes.empty(); }
+
+  /// MDEntryType of each entry
+  const std::vector < char >& getEntryTypes() const { return m_entryTypes; }
+  /// MDUpdateAction of each entry, 0 in snapshots
+  const std::vector < char >& getUpdateActions() const { return m_updateActions; }
+  /// MDEntryPx of each entry
+  const std::vector < double >& getPrices() const { return m_prices; }
+  /// MDEntrySize of each entry
+  const std::vector < double >& getSizes() const { return m_sizes; }
+  /// MDEntryPositionNo of each entry
+  const std::vector < int >& getPositions() const { return m_positions; }
+  /// MDEntryTime of each entry in nanoseconds
+  const std::vector < int64_t >& getTimes() const { return m_times; }
+
+private:
+  bool decodeEntries( const std::string& msgType, const DataDictionary& dataDictionary )
+  EXCEPT ( InvalidMessage, IncorrectDataFormat );
+  bool decodeEntries( const FieldMap& body, const DataDictionary* pDataDictionary )
+  EXCEPT ( IncorrectDataFormat );
+  size_t skipGroup( size_t index, const std::string& msgType,
+                    const DataDictionary& groupDictionary ) const;
+  void setTimeType( const DataDictionary* pDataDictionary );
+  void startEntry();
+  void setField( int tag, const StringView& value )
+  EXCEPT ( IncorrectDataFormat );
+  int64_t convertTime( const StringView& value ) const
+  EXCEPT ( FieldConvertError );
+
+  FlyweightReader m_reader;
+  std::string m_msgType;
+  bool m_timeOnly;
+
+  std::vector < char > m_entryTypes;
+  std::vector < char > m_updateActions;
+  std::vector < double > m_prices;
+  std::vector < double > m_sizes;
+  std::vector < int > m_positions;
+  std::vector < int64_t > m_times;
+};
+}
+
+#endif //FIX_MARKETDATACOLUMNS_H
@@ -125,6 +125,7 @@ Message::Message(const Message& copy)
 , m_trailer(copy.m_trailer)
 , m_validStructure(copy.m_validStructure)
 , m_tag(copy.m_tag)
+, m_pPendingBody(copy.m_pPendingBody)
 #ifdef HAVE_EMX
 , m_subMsgType(copy.m_subMsgType)
 #endif
@@ -136,6 +137,19 @@ Message::~Message()
 {
 }
 
+void Message::swap( Message& rhs )
+{
+  FieldMap::swap( rhs );
+  m_header.swap( rhs.m_header );
+  m_trailer.swap( rhs.m_trailer );
+  std::swap( m_validStructure, rhs.m_validStructure );
+  std::swap( m_tag, rhs.m_tag );
+  std::swap( m_pPendingBody, rhs.m_pPendingBody );
+#ifdef HAVE_EMX
+  m_subMsgType.swap( rhs.m_subMsgType );
+#endif
+}
+
 bool Message::InitializeXML( const std::string& url )
 {
   try
@@ -267,6 +281,49 @@ std::string& Message::toString( std::string& str,
   return str;
 }
 
+SerializedBody& Message::toBody( SerializedBody& body ) const
+{
+  body.string.clear();
+  FieldMap::calculateString( body.string );
+  body.length = calculateLength();
+  body.total = calculateTotal();
+  body.generation = generation();
+  return body;
+}
+
+std::string& Message::toString( const SerializedBody& body,
+                                std::string& str ) const
+{
+  int length = setLengthAndCheckSum( body );
+  str.clear();
+  str.reserve( length + 64 );
+  m_header.calculateString( str );
+  str += body.string;
+  m_trailer.calculateString( str );
+  return str;
+}
+
+void Message::toString( const SerializedBody& body, std::string& header,
+                        std::string& trailer ) const
+{
+  int length = setLengthAndCheckSum( body );
+  header.clear();
+  header.reserve( length - body.length + 32 );
+  m_header.calculateString( header );
+  trailer.clear();
+  m_trailer.calculateString( trailer );
+}
+
+int Message::setLengthAndCheckSum( const SerializedBody& body ) const
+{
+  int length = m_header.calculateLength() + body.length
+               + m_trailer.calculateLength();
+  m_header.setField( BodyLength( length ) );
+  m_trailer.setField( CheckSum( ( m_header.calculateTotal() + body.total
+                                  + m_trailer.calculateTotal() ) % 256 ) );
+  return length;
+}
+
 std::string Message::toXML() const
 {
   std::string str;
@@ -338,23 +395,77 @@ void Message::setString( const std::string& string,
                          const DataDictionary* pSessionDataDictionary,
                          const DataDictionary* pApplicationDataDictionary )
 EXCEPT ( InvalidMessage )
+{
+  setString( string, doValidation,
+             pSessionDataDictionary, pApplicationDataDictionary, false );
+}
+
+void Message::setString( const std::string& string,
+                         bool doValidation,
+                         const DataDictionary* pSessionDataDictionary,
+                         const DataDictionary* pApplicationDataDictionary,
+                         bool deferBody )
+EXCEPT ( InvalidMessage )
 {
   clear();
 
-  std::string::size_type pos = 0;
-  int count = 0;
+  ParseState state;
+  state.pos = 0;
+  state.count = 0;
+  state.validate = doValidation;
+  state.pSessionDataDictionary = pSessionDataDictionary;
+  state.pApplicationDataDictionary = pApplicationDataDictionary;
+
+  if ( deferBody )
+  {
+    parseFields( string, state, true );
+    if ( canDeferBody( string, state ) )
+    {
+      m_header.sortFields();
+      m_pPendingBody = ptr::shared_ptr<PendingBody>( new PendingBody );
+      m_pPendingBody->string = string;
+      m_pPendingBody->state = state;
+      return;
+    }
+  }
+
+  parseFields( string, state, false );
+}
+
+void Message::parseBody() const EXCEPT ( InvalidMessage )
+{
+  if ( !m_pPendingBody.get() ) return;
 
-  FIX::MsgType msg;
+  ptr::shared_ptr<PendingBody> pPendingBody = m_pPendingBody;
+  ParseState state = pPendingBody->state;
 
+  Message& message = const_cast<Message&>( *this );
+  message.m_pPendingBody.reset();
+  message.parseFields( pPendingBody->string, state, false );
+}
+
+void Message::parseFields( const std::string& string, ParseState& state,
+                           bool headerOnly )
+{
   field_type type = header;
 
-  while ( pos < string.size() )
+  while ( state.pos < string.size() )
   {
-    FieldBase field = extractField( string, pos, pSessionDataDictionary, pApplicationDataDictionary );
-    if ( count < 3 && headerOrder[ count++ ] != field.getTag() )
-      if ( doValidation ) throw InvalidMessage("Header fields out of order");
+    std::string::size_type oldPos = state.pos;
+    FieldBase field = extractField( string, state.pos,
+      state.pSessionDataDictionary, state.pApplicationDataDictionary );
 
-    if ( isHeaderField( field, pSessionDataDictionary ) )
+    bool isHeader = isHeaderField( field, state.pSessionDataDictionary );
+    if ( headerOnly && !isHeader )
+    {
+      state.pos = oldPos;
+      return;
+    }
+
+    if ( state.count < 3 && headerOrder[ state.count++ ] != field.getTag() )
+      if ( state.validate ) throw InvalidMessage("Header fields out of order");
+
+    if ( isHeader )
     {
       if ( type != header )
       {
@@ -364,16 +475,16 @@ EXCEPT ( InvalidMessage )
 
       if ( field.getTag() == FIELD::MsgType )
       {
-        msg.setString( field.getString() );
-        if ( isAdminMsgType( msg ) )
+        state.msgType.setString( field.getString() );
+        if ( isAdminMsgType( state.msgType ) )
         {
-          pApplicationDataDictionary = pSessionDataDictionary;
+          state.pApplicationDataDictionary = state.pSessionDataDictionary;
 #ifdef HAVE_EMX
-          m_subMsgType.assign(msg);
+          m_subMsgType.assign(state.msgType);
         }
         else
         {
-          std::string::size_type equalSign = string.find("\0019426=", pos);
+          std::string::size_type equalSign = string.find("\0019426=", state.pos);
           if (equalSign == std::string::npos)
             throw InvalidMessage("EMX message type (9426) not found");
 
@@ -388,16 +499,16 @@ EXCEPT ( InvalidMessage )
 
       m_header.appendField( field );
 
-      if ( pSessionDataDictionary )
-        setGroup( "_header_", field, string, pos, getHeader(), *pSessionDataDictionary );
+      if ( state.pSessionDataDictionary )
+        setGroup( "_header_", field, string, state.pos, getHeader(), *state.pSessionDataDictionary );
     }
-    else if ( isTrailerField( field, pSessionDataDictionary ) )
+    else if ( isTrailerField( field, state.pSessionDataDictionary ) )
     {
       type = trailer;
       m_trailer.appendField( field );
 
-      if ( pSessionDataDictionary )
-        setGroup( "_trailer_", field, string, pos, getTrailer(), *pSessionDataDictionary );
+      if ( state.pSessionDataDictionary )
+        setGroup( "_trailer_", field, string, state.pos, getTrailer(), *state.pSessionDataDictionary );
     }
     else
     {
@@ -410,24 +521,96 @@ EXCEPT ( InvalidMessage )
       type = body;
       appendField( field );
 
-      if ( pApplicationDataDictionary )
+      if ( state.pApplicationDataDictionary )
 #ifdef HAVE_EMX
-        setGroup(m_subMsgType, field, string, pos, *this, *pApplicationDataDictionary);
+        setGroup(m_subMsgType, field, string, state.pos, *this, *state.pApplicationDataDictionary);
 #else
-        setGroup( msg, field, string, pos, *this, *pApplicationDataDictionary );
+        setGroup( state.msgType, field, string, state.pos, *this, *state.pApplicationDataDictionary );
 #endif
     }
   }
 
+  if ( headerOnly ) return;
+
   // sort fields
   m_header.sortFields();
   sortFields();
   m_trailer.sortFields();
 
-  if ( doValidation )
+  if ( state.validate )
     validate();
 }
 
+bool Message::canDeferBody( const std::string& string,
+                            const ParseState& state ) const
+{
+  if ( state.count < 3 || !m_header.isSetField( FIELD::MsgType ) )
+    return false;
+
+  // the string has to end with its CheckSum
+  const std::string::size_type size = string.size();
+  if ( size < 2 || string[ size - 1 ] != '\001' )
+    return false;
+  std::string::size_type checkSumStart = string.rfind( '\001', size - 2 );
+  if ( checkSumStart == std::string::npos
+       || string.compare( ++checkSumStart, 3, "10=" ) != 0
+       || state.pos >= checkSumStart )
+    return false;
+
+  // every body field must be one the header parse would not have wanted
+  int total = 0;
+  std::string::size_type fieldStart = state.pos;
+  for ( std::string::size_type i = state.pos; i < checkSumStart; ++i )
+  {
+    const char c = string[ i ];
+    total += (unsigned char)c;
+
+    if ( i == fieldStart )
+    {
+      if ( c < '1' || c > '9' ) return false;
+      int tag = 0;
+      std::string::size_type j = i;
+      for ( ; j < checkSumStart && string[ j ] >= '0' && string[ j ] <= '9'; ++j )
+      {
+        tag = tag * 10 + ( string[ j ] - '0' );
+        if ( tag > 99999999 ) return false;
+      }
+      if ( j == checkSumStart || string[ j ] != '=' )
+        return false;
+      if ( tag == FIELD::BeginString || tag == FIELD::BodyLength
+           || tag == FIELD::CheckSum
+           || isHeaderField( tag, state.pSessionDataDictionary )
+           || IsDataField( tag, state.pSessionDataDictionary,
+                           state.pApplicationDataDictionary ) )
+        return false;
+    }
+    else if ( c == '\001' )
+      fieldStart = i + 1;
+  }
+
+  if ( !state.validate )
+    return true;
+
+  try
+  {
+    const BodyLength& aBodyLength = FIELD_GET_REF( m_header, BodyLength );
+    const int expectedLength = (int)aBodyLength;
+    const int actualLength = m_header.calculateLength()
+                             + (int)( checkSumStart - state.pos );
+    if ( expectedLength != actualLength )
+      return false;
+
+    const int expectedChecksum = CheckSumConvertor::convert
+      ( string.substr( checkSumStart + 3, size - checkSumStart - 4 ) );
+    const int actualChecksum = ( m_header.calculateTotal() + total ) % 256;
+    return expectedChecksum == actualChecksum;
+  }
+  catch ( std::exception& )
+  {
+    return false;
+  }
+}
+
 void Message::setGroup( const std::string& msg, const FieldBase& field,
                         const std::string& string,
                         std::string::size_type& pos, FieldMap& map,
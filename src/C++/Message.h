@@ -108,6 +108,23 @@ public:
 
 };
 
+/**
+ * Body of a message serialized once, to be sent behind different headers.
+ *
+ * Keeps the length and byte sum of the body so that BodyLength and CheckSum
+ * of each copy only need the header and trailer to be walked, and the
+ * generation of the body it was serialized from.
+ */
+struct SerializedBody
+{
+  SerializedBody() : length( 0 ), total( 0 ), generation( 0 ) {}
+
+  std::string string;
+  int length;
+  int total;
+  size_t generation;
+};
+
 /**
  * Base class for all %FIX messages.
  *
@@ -153,6 +170,9 @@ public:
 
   Message( const Message& copy );
 
+  /// Exchange contents with another message without copying its fields
+  void swap( Message& rhs );
+
   ~Message();
 
   /// Set global data dictionary for encoding messages into XML
@@ -194,6 +214,20 @@ public:
                          int beginStringField = FIELD::BeginString,
                          int bodyLengthField = FIELD::BodyLength,
                          int checkSumField = FIELD::CheckSum ) const;
+  /// Serialize the body alone, to be sent with several headers
+  SerializedBody& toBody( SerializedBody& ) const;
+  /**
+   * Get a string representation around a body serialized by toBody().
+   * Only the header and trailer are walked, the body must not have been
+   * changed since.
+   */
+  std::string& toString( const SerializedBody&, std::string& ) const;
+  /// Whether the body was left unchanged since toBody() serialized it
+  bool isBody( const SerializedBody& body ) const
+  { return generation() == body.generation; }
+  /// Serialize the header and trailer that go around a body from toBody()
+  void toString( const SerializedBody&, std::string& header,
+                 std::string& trailer ) const;
   /// Get a XML representation of the message
   std::string toXML() const;
   /// Get a XML representation without making a copy
@@ -241,6 +275,38 @@ public:
    */
   bool setStringHeader( const std::string& string );
 
+  /**
+   * Set a message from a string, leaving the body for later.
+   * Only the header is parsed, the remaining fields are parsed by
+   * parseBody.  BodyLength and CheckSum are still checked up front and
+   * the whole string is parsed right away when the header alone can not
+   * be relied on.
+   */
+  void setString( const std::string& string,
+                  bool validate,
+                  const FIX::DataDictionary* pSessionDataDictionary,
+                  const FIX::DataDictionary* pApplicationDataDictionary,
+                  bool deferBody )
+  EXCEPT ( InvalidMessage );
+
+  /// Parse a body left by setString, does nothing if there is none
+  void parseBody() const EXCEPT ( InvalidMessage );
+  /// Check if the body has been parsed
+  bool isBodyParsed() const { return m_pPendingBody.get() == 0; }
+  /**
+   * The string a body left by setString would be parsed from, with the
+   * position of its first field and the application data dictionary it
+   * would be parsed with.  Returns 0 once the body is parsed.
+   */
+  const std::string* getPendingBody( std::string::size_type& pos,
+                                     const DataDictionary*& pDataDictionary ) const
+  {
+    if ( !m_pPendingBody.get() ) return 0;
+    pos = m_pPendingBody->state.pos;
+    pDataDictionary = m_pPendingBody->state.pApplicationDataDictionary;
+    return &m_pPendingBody->string;
+  }
+
   /// Getter for the message header
   const Header& getHeader() const { return m_header; }
   /// Mutable getter for the message header
@@ -290,6 +356,7 @@ public:
 
   void clear()
   {
+    m_pPendingBody.reset();
     m_tag = 0;
     m_validStructure = true;
     m_header.clear();
@@ -371,6 +438,25 @@ public:
 #endif
 
 private:
+  struct ParseState
+  {
+    std::string::size_type pos;
+    int count;
+    FIX::MsgType msgType;
+    bool validate;
+    const DataDictionary* pSessionDataDictionary;
+    const DataDictionary* pApplicationDataDictionary;
+  };
+
+  struct PendingBody
+  {
+    std::string string;
+    ParseState state;
+  };
+
+  void parseFields( const std::string& string, ParseState& state, bool headerOnly );
+  bool canDeferBody( const std::string& string, const ParseState& state ) const;
+
   FieldBase extractField(
     const std::string& string, std::string::size_type& pos,
     const DataDictionary* pSessionDD = 0, const DataDictionary* pAppDD = 0,
@@ -390,6 +476,7 @@ private:
     return false;
   }
 
+  int setLengthAndCheckSum( const SerializedBody& body ) const;
   void validate() const;
   std::string toXMLFields(const FieldMap& fields, int space) const;
 
@@ -398,6 +485,7 @@ protected:
   mutable Trailer m_trailer;
   bool m_validStructure;
   int m_tag;
+  ptr::shared_ptr<PendingBody> m_pPendingBody;
 #ifdef HAVE_EMX
   std::string m_subMsgType;
 #endif
@@ -73,6 +73,13 @@ bool MessageStoreExceptionWrapper::set( int num, const std::string& msg, bool& t
   catch ( IOException & e ) { threw = true; ex = e; return false; }
 }
 
+bool MessageStoreExceptionWrapper::setMany( int first, const std::vector < std::string >& msgs, bool& threw, IOException& ex )
+{
+  threw = false;
+  try { return m_pStore->setMany( first, msgs ); }
+  catch ( IOException & e ) { threw = true; ex = e; return false; }
+}
+
 void MessageStoreExceptionWrapper::get( int begin, int end, std::vector < std::string > & msgs, bool& threw, IOException& ex ) const
 {
   threw = false;
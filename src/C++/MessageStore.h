@@ -72,6 +72,19 @@ public:
   EXCEPT ( IOException ) = 0;
   virtual void get( int, int, std::vector < std::string > & ) const
   EXCEPT ( IOException ) = 0;
+  /**
+   * Store messages with consecutive sequence numbers, the first of them
+   * being first.  Stores that can write several messages at once should
+   * override this, the default sets them one by one.
+   */
+  virtual bool setMany( int first, const std::vector < std::string >& messages )
+  EXCEPT ( IOException )
+  {
+    bool result = true;
+    for( std::size_t i = 0; i < messages.size(); ++i )
+      result = set( first + ( int ) i, messages[ i ] ) && result;
+    return result;
+  }
 
   virtual int getNextSenderMsgSeqNum() const EXCEPT ( IOException ) = 0;
   virtual int getNextTargetMsgSeqNum() const EXCEPT ( IOException ) = 0;
@@ -84,6 +97,10 @@ public:
 
   virtual void reset() EXCEPT ( IOException ) = 0;
   virtual void refresh() EXCEPT ( IOException ) = 0;
+
+  /// Write anything held back to batch it, stores that write
+  /// through have nothing to do
+  virtual void flush() EXCEPT ( IOException ) {}
 };
 /*! @} */
 
@@ -156,6 +173,7 @@ public:
   ~MessageStoreExceptionWrapper() { delete m_pStore; }
 
   bool set( int, const std::string&, bool&, IOException& );
+  bool setMany( int, const std::vector < std::string >&, bool&, IOException& );
   void get( int, int, std::vector < std::string > &, bool&, IOException& ) const;
   int getNextSenderMsgSeqNum( bool&, IOException& ) const;
   int getNextTargetMsgSeqNum( bool&, IOException& ) const;
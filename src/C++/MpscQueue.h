@@ -0,0 +1,172 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_MPSCQUEUE_H
+#define FIX_MPSCQUEUE_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Utility.h"
+#include <vector>
+
+namespace FIX
+{
+/**
+ * Bounded lock free queue between any number of producers and one consumer.
+ *
+ * Like SpscQueue the slots are constructed up front and filled and read in
+ * place.  Producers reserve a position with a compare and swap on the tail
+ * and each slot carries a sequence number that tells the consumer when the
+ * producer holding it has published, so a slow producer delays only the
+ * elements behind it and never blocks the others.  Positions count every
+ * element ever queued, which makes them usable as tickets.
+ */
+template < typename T >
+class MpscQueue
+{
+public:
+  /// Capacity is rounded up to a power of two
+  MpscQueue( size_t capacity )
+  : m_head( 0 ), m_tail( 0 )
+  {
+    size_t size = 1;
+    while( size < capacity ) size <<= 1;
+    m_cells.resize( size );
+    for( size_t i = 0; i < size; ++i )
+      m_cells[ i ].sequence = i;
+    m_mask = size - 1;
+  }
+
+  size_t capacity() const { return m_cells.size(); }
+  size_t size() const { return ( size_t ) ( load( m_tail ) - load( m_head ) ); }
+  bool empty() const { return size() == 0; }
+
+  /// Producer: slot for a new element, 0 if the queue is full
+  T* claim( uint64_t& position )
+  {
+    uint64_t tail = load( m_tail );
+    while( true )
+    {
+      Cell& cell = m_cells[ tail & m_mask ];
+      int64_t lag = ( int64_t ) ( load( cell.sequence ) - tail );
+      if( lag == 0 )
+      {
+        if( compareAndSwap( m_tail, tail, tail + 1 ) )
+        {
+          position = tail;
+          return &cell.value;
+        }
+      }
+      else if( lag < 0 )
+        return 0;
+      tail = load( m_tail );
+    }
+  }
+
+  /// Producer: make the slot claimed at position visible to the consumer
+  void publish( uint64_t position )
+  { store( m_cells[ position & m_mask ].sequence, position + 1 ); }
+
+  /**
+   * Consumer: element offset places behind the oldest, 0 if not published
+   * yet.  Reading a run of elements stops at the first 0, as later ones may
+   * already be published while an earlier producer is still filling its slot.
+   */
+  T* front( size_t offset = 0 )
+  {
+    uint64_t position = m_head + offset;
+    Cell& cell = m_cells[ position & m_mask ];
+    if( load( cell.sequence ) != position + 1 )
+      return 0;
+    return &cell.value;
+  }
+
+  /// Consumer: hand the count oldest slots back to the producers
+  void pop( size_t count = 1 )
+  {
+    uint64_t head = m_head;
+    for( size_t i = 0; i < count; ++i, ++head )
+      store( m_cells[ head & m_mask ].sequence, head + m_mask + 1 );
+    store( m_head, head );
+  }
+
+  /// Number of elements popped since the queue was created
+  uint64_t popped() const { return load( m_head ); }
+
+private:
+  MpscQueue( const MpscQueue& );
+  MpscQueue& operator=( const MpscQueue& );
+
+  enum { CACHE_LINE = 64 };
+
+  struct Cell
+  {
+    volatile uint64_t sequence;
+    T value;
+  };
+
+  static uint64_t load( const volatile uint64_t& value )
+  {
+#ifdef _MSC_VER
+    return ( uint64_t ) InterlockedCompareExchange64
+      ( ( volatile LONGLONG* ) &value, 0, 0 );
+#else
+    return __atomic_load_n( &value, __ATOMIC_ACQUIRE );
+#endif
+  }
+
+  static void store( volatile uint64_t& value, uint64_t newValue )
+  {
+#ifdef _MSC_VER
+    InterlockedExchange64( ( volatile LONGLONG* ) &value, ( LONGLONG ) newValue );
+#else
+    __atomic_store_n( &value, newValue, __ATOMIC_RELEASE );
+#endif
+  }
+
+  static bool compareAndSwap( volatile uint64_t& value, uint64_t expected,
+                              uint64_t newValue )
+  {
+#ifdef _MSC_VER
+    return ( uint64_t ) InterlockedCompareExchange64
+      ( ( volatile LONGLONG* ) &value, ( LONGLONG ) newValue,
+        ( LONGLONG ) expected ) == expected;
+#else
+    return __atomic_compare_exchange_n( &value, &expected, newValue, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_RELAXED );
+#endif
+  }
+
+  std::vector < Cell > m_cells;
+  uint64_t m_mask;
+  char m_padding1[ CACHE_LINE ];
+  // written by the consumer only
+  volatile uint64_t m_head;
+  char m_padding2[ CACHE_LINE ];
+  // shared by the producers
+  volatile uint64_t m_tail;
+  char m_padding3[ CACHE_LINE ];
+};
+}
+
+#endif //FIX_MPSCQUEUE_H
@@ -36,7 +36,10 @@
 #include <errmsg.h>
 #include "DatabaseConnectionID.h"
 #include "DatabaseConnectionPool.h"
+#include "FieldConvertors.h"
 #include "Mutex.h"
+#include <cstring>
+#include <vector>
 
 #undef MYSQL_PORT
 
@@ -114,6 +117,146 @@ private:
   std::vector<MYSQL_ROW> m_rows;
 };
 
+/// A statement prepared once per connection and run with bound parameters
+class MySQLStatement
+{
+public:
+  MySQLStatement( const std::string& query )
+  : m_pStatement( 0 ), m_pConnection( 0 ), m_status( 0 ), m_query( query )
+  {}
+
+  ~MySQLStatement()
+  {
+    close();
+  }
+
+  /// Binds the value of the next ? parameter
+  void bind( const std::string& value )
+  {
+    m_parameters.push_back( value );
+    m_null.push_back( false );
+  }
+
+  void bind( int value )
+  {
+    bind( IntConvertor::convert( value ) );
+  }
+
+  void bindNull()
+  {
+    m_parameters.push_back( std::string() );
+    m_null.push_back( true );
+  }
+
+  void clear()
+  {
+    m_parameters.clear();
+    m_null.clear();
+  }
+
+  bool execute( MYSQL* pConnection, bool retry = true )
+  {
+    int attempt = 0;
+
+    do
+    {
+      if( run( pConnection ) ) return true;
+      close();
+      if( !retry ) return false;
+      mysql_ping( pConnection );
+      attempt++;
+    } while( attempt <= 1 );
+    return success();
+  }
+
+  void close()
+  {
+    if( m_pStatement )
+      mysql_stmt_close( m_pStatement );
+    m_pStatement = 0;
+    m_pConnection = 0;
+  }
+
+  bool success()
+  {
+    return m_status == 0;
+  }
+
+  /// True if the failure was the connection rather than the statement
+  bool disconnected()
+  {
+    return m_status == CR_SERVER_GONE_ERROR || m_status == CR_SERVER_LOST;
+  }
+
+  const std::string& reason()
+  {
+    return m_reason;
+  }
+
+  void throwException() EXCEPT ( IOException )
+  {
+    if( !success() )
+      throw IOException( "Query failed [" + m_query + "] " + reason() );
+  }
+
+private:
+  bool run( MYSQL* pConnection )
+  {
+    if( m_pConnection != pConnection )
+      close();
+
+    if( !m_pStatement )
+    {
+      m_pStatement = mysql_stmt_init( pConnection );
+      if( !m_pStatement )
+      {
+        m_status = mysql_errno( pConnection );
+        m_reason = mysql_error( pConnection );
+        return false;
+      }
+      m_pConnection = pConnection;
+      if( mysql_stmt_prepare( m_pStatement, m_query.c_str(), m_query.size() ) )
+        return fail();
+    }
+
+    size_t count = m_parameters.size();
+    std::vector<MYSQL_BIND> binds( count );
+    std::vector<unsigned long> lengths( count );
+    for( size_t i = 0; i < count; ++i )
+    {
+      memset( &binds[ i ], 0, sizeof( MYSQL_BIND ) );
+      lengths[ i ] = (unsigned long)m_parameters[ i ].size();
+      binds[ i ].buffer_type = m_null[ i ] ? MYSQL_TYPE_NULL : MYSQL_TYPE_STRING;
+      binds[ i ].buffer = (void*)m_parameters[ i ].data();
+      binds[ i ].buffer_length = lengths[ i ];
+      binds[ i ].length = &lengths[ i ];
+    }
+
+    if( count && mysql_stmt_bind_param( m_pStatement, &binds[ 0 ] ) )
+      return fail();
+    if( mysql_stmt_execute( m_pStatement ) )
+      return fail();
+
+    m_status = 0;
+    return true;
+  }
+
+  bool fail()
+  {
+    m_status = mysql_stmt_errno( m_pStatement );
+    m_reason = mysql_stmt_error( m_pStatement );
+    return false;
+  }
+
+  MYSQL_STMT* m_pStatement;
+  MYSQL* m_pConnection;
+  int m_status;
+  std::string m_query;
+  std::string m_reason;
+  std::vector<std::string> m_parameters;
+  std::vector<bool> m_null;
+};
+
 class MySQLConnection
 {
 public:
@@ -161,6 +304,68 @@ public:
     return pQuery.execute( m_pConnection );
   }
 
+  bool execute( MySQLStatement& statement )
+  {
+    Locker locker( m_mutex );
+    return statement.execute( m_pConnection );
+  }
+
+  /// Releases the statement's handle on this connection
+  void close( MySQLStatement& statement )
+  {
+    Locker locker( m_mutex );
+    statement.close();
+  }
+
+  /// Runs the statements in one transaction, keeping none of them if any fails
+  void transaction( const std::vector<MySQLStatement*>& statements )
+  EXCEPT ( IOException )
+  {
+    Locker locker( m_mutex );
+
+    if( statements.size() == 1 )
+    {
+      if( !statements[ 0 ]->execute( m_pConnection ) )
+        statements[ 0 ]->throwException();
+      return;
+    }
+
+    for( int attempt = 0; ; ++attempt )
+    {
+      if( mysql_query( m_pConnection, "START TRANSACTION" ) )
+      {
+        if( attempt > 0 )
+          throw IOException( std::string( "Query failed [START TRANSACTION] " )
+                             + mysql_error( m_pConnection ) );
+        mysql_ping( m_pConnection );
+        continue;
+      }
+
+      MySQLStatement* pFailed = 0;
+      for( size_t i = 0; !pFailed && i < statements.size(); ++i )
+      {
+        if( !statements[ i ]->execute( m_pConnection, false ) )
+          pFailed = statements[ i ];
+      }
+
+      if( !pFailed )
+      {
+        if( mysql_commit( m_pConnection ) == 0 )
+          return;
+        if( attempt > 0 )
+          throw IOException( std::string( "Query failed [COMMIT] " )
+                             + mysql_error( m_pConnection ) );
+      }
+      else
+      {
+        mysql_rollback( m_pConnection );
+        if( attempt > 0 || !pFailed->disconnected() )
+          pFailed->throwException();
+      }
+      mysql_ping( m_pConnection );
+    }
+  }
+
 private:
   void connect()
   {
@@ -29,6 +29,7 @@
 #include "SessionID.h"
 #include "SessionSettings.h"
 #include "Utility.h"
+#include "LatencyHistogram.h"
 #include "strptime.h"
 #include <fstream>
 
@@ -78,6 +79,10 @@ MySQLLog::MySQLLog
 
 void MySQLLog::init()
 {
+  m_batchCount = 0;
+  m_batchSize = 1;
+  m_batchInterval = 0;
+  m_batchStart = 0;
   setIncomingTable( "messages_log" );
   setOutgoingTable( "messages_log" );
   setEventTable( "event_log" );
@@ -85,6 +90,14 @@ void MySQLLog::init()
 
 MySQLLog::~MySQLLog()
 {
+  flush();
+
+  for( Inserts::iterator i = m_inserts.begin(); i != m_inserts.end(); ++i )
+  {
+    m_pConnection->close( *i->second );
+    delete i->second;
+  }
+
   if( m_pConnectionPool )
     m_pConnectionPool->destroy( m_pConnection );
   else
@@ -168,6 +181,17 @@ void MySQLLogFactory::init( const Dictionary& settings,
 
 void MySQLLogFactory::initLog( const Dictionary& settings, MySQLLog& log )
 {
+  int batchSize = 1;
+  int batchInterval = 0;
+
+  try { batchSize = settings.getInt( MYSQL_LOG_BATCH_SIZE ); }
+  catch( ConfigError& ) {}
+
+  try { batchInterval = settings.getInt( MYSQL_LOG_BATCH_INTERVAL ); }
+  catch( ConfigError& ) {}
+
+  log.setBatch( batchSize, batchInterval );
+
   try { log.setIncomingTable( settings.getString( MYSQL_LOG_INCOMING_TABLE ) ); }
   catch( ConfigError& ) {}
 
@@ -215,6 +239,9 @@ void MySQLLog::clear()
   eventQuery 
     << "DELETE FROM " << m_eventTable << " " << whereClause.str();
 
+  m_batch.clear();
+  m_batchCount = 0;
+
   MySQLQuery incoming( incomingQuery.str() );
   MySQLQuery outgoing( outgoingQuery.str() );
   MySQLQuery event( eventQuery.str() );
@@ -227,6 +254,83 @@ void MySQLLog::backup()
 {
 }
 
+void MySQLLog::setBatch( int size, int interval )
+{
+  m_batchSize = size > 1 ? size : 1;
+  m_batchInterval = (int64_t)interval * 1000000;
+}
+
+void MySQLLog::flush()
+{
+  if( !m_batchCount ) return;
+
+  // Each table's entries go in chunks of powers of two
+  // so that few distinct inserts are prepared
+  std::vector<MySQLStatement*> statements;
+  for( Batch::const_iterator i = m_batch.begin(); i != m_batch.end(); ++i )
+  {
+    std::vector<Entry>::const_iterator entry = i->second.begin();
+    size_t remaining = i->second.size();
+    while( remaining )
+    {
+      size_t rows = 1;
+      if( remaining == m_batchSize )
+        rows = m_batchSize;
+      else
+        while( rows * 2 <= remaining ) rows *= 2;
+
+      MySQLStatement& insert = insertStatement( i->first, rows );
+      insert.clear();
+      for( size_t row = 0; row < rows; ++row, ++entry )
+      {
+        insert.bind( entry->time );
+        insert.bind( entry->millis );
+        if( m_pSessionID )
+        {
+          insert.bind( m_pSessionID->getBeginString().getValue() );
+          insert.bind( m_pSessionID->getSenderCompID().getValue() );
+          insert.bind( m_pSessionID->getTargetCompID().getValue() );
+          if( m_pSessionID->getSessionQualifier() == "" )
+            insert.bindNull();
+          else
+            insert.bind( m_pSessionID->getSessionQualifier() );
+        }
+        else
+        {
+          insert.bindNull();
+          insert.bindNull();
+          insert.bindNull();
+          insert.bindNull();
+        }
+        insert.bind( entry->text );
+      }
+      statements.push_back( &insert );
+      remaining -= rows;
+    }
+  }
+
+  m_batch.clear();
+  m_batchCount = 0;
+
+  try { m_pConnection->transaction( statements ); }
+  catch( IOException& ) {}
+}
+
+MySQLStatement& MySQLLog::insertStatement( const std::string& table, size_t rows )
+{
+  MySQLStatement*& pStatement = m_inserts[ std::make_pair( table, rows ) ];
+  if( !pStatement )
+  {
+    std::string query = "INSERT INTO " + table + " "
+      "(time, time_milliseconds, beginstring, sendercompid, targetcompid, "
+      "session_qualifier, text) VALUES ";
+    for( size_t row = 0; row < rows; ++row )
+      query += row ? ",(?,?,?,?,?,?,?)" : "(?,?,?,?,?,?,?)";
+    pStatement = new MySQLStatement( query );
+  }
+  return *pStatement;
+}
+
 void MySQLLog::insert( const std::string& table, const std::string value )
 {
   UtcTimeStamp time;
@@ -238,36 +342,19 @@ void MySQLLog::insert( const std::string& table, const std::string value )
   STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d",
            year, month, day, hour, minute, second );
 
-  char* valueCopy = new char[ (value.size() * 2) + 1 ];
-  mysql_escape_string( valueCopy, value.c_str(), value.size() );
-
-  std::stringstream queryString;
-  queryString << "INSERT INTO " << table << " "
-  << "(time, time_milliseconds, beginstring, sendercompid, targetcompid, session_qualifier, text) "
-  << "VALUES ("
-  << "'" << sqlTime << "','" << millis << "',";
-
-  if( m_pSessionID )
-  {
-    queryString
-    << "\"" << m_pSessionID->getBeginString().getValue() << "\","
-    << "\"" << m_pSessionID->getSenderCompID().getValue() << "\","
-    << "\"" << m_pSessionID->getTargetCompID().getValue() << "\",";
-    if( m_pSessionID->getSessionQualifier() == "" )
-      queryString << "NULL" << ",";
-    else
-      queryString << "\"" << m_pSessionID->getSessionQualifier() << "\",";
-  }
-  else
-  {
-    queryString << "NULL, NULL, NULL, NULL, ";
-  }
+  if( !m_batchCount )
+    m_batchStart = LatencyHistogram::now();
 
-  queryString << "\"" << valueCopy << "\")";
-  delete [] valueCopy;
+  Entry entry;
+  entry.time = sqlTime;
+  entry.millis = millis;
+  entry.text = value;
+  m_batch[ table ].push_back( entry );
+  ++m_batchCount;
 
-  MySQLQuery query( queryString.str() );
-  m_pConnection->execute( query );
+  if( m_batchCount >= m_batchSize || ( m_batchInterval
+      && LatencyHistogram::now() - m_batchStart >= m_batchInterval ) )
+    flush();
 }
 
 } //namespace FIX
@@ -37,6 +37,7 @@
 #include "MySQLConnection.h"
 #include <fstream>
 #include <string>
+#include <map>
 
 namespace FIX
 {
@@ -69,10 +70,33 @@ public:
   void onEvent( const std::string& value )
   { insert( m_eventTable, value ); }
 
+  /// Write entries in transactions of up to size entries, or of whatever
+  /// is pending once interval milliseconds have passed.
+  void setBatch( int size, int interval );
+  /// Write anything pending now
+  void flush();
+
 private:
+  struct Entry
+  {
+    std::string time;
+    int millis;
+    std::string text;
+  };
+  typedef std::map < std::string, std::vector < Entry > > Batch;
+  /// Multi-row inserts keyed by table and the number of rows they take
+  typedef std::map < std::pair < std::string, size_t >, MySQLStatement* > Inserts;
+
   void init();
   void insert( const std::string& table, const std::string value );
-
+  MySQLStatement& insertStatement( const std::string& table, size_t rows );
+
+  Batch m_batch;
+  Inserts m_inserts;
+  size_t m_batchCount;
+  size_t m_batchSize;
+  int64_t m_batchInterval;
+  int64_t m_batchStart;
   std::string m_incomingTable;
   std::string m_outgoingTable;
   std::string m_eventTable;
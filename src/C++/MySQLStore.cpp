@@ -31,6 +31,7 @@
 #include "FieldConvertors.h"
 #include "Parser.h"
 #include "Utility.h"
+#include "LatencyHistogram.h"
 #include "strptime.h"
 #include <fstream>
 
@@ -43,9 +44,29 @@ const std::string MySQLStoreFactory::DEFAULT_PASSWORD = "";
 const std::string MySQLStoreFactory::DEFAULT_HOST = "localhost";
 const short MySQLStoreFactory::DEFAULT_PORT = 3306;
 
+static const char INSERT_MESSAGES[] =
+  "INSERT INTO messages (beginstring, sendercompid, targetcompid, "
+  "session_qualifier, msgseqnum, message) VALUES ";
+
+static const char UPSERT_MESSAGES[] =
+  " ON DUPLICATE KEY UPDATE message=VALUES(message)";
+
+static const char UPDATE_SEQNUMS[] =
+  "UPDATE sessions SET incoming_seqnum=?, outgoing_seqnum=? WHERE "
+  "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=?";
+
+static const char DELETE_MESSAGES[] =
+  "DELETE FROM messages WHERE "
+  "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=?";
+
+static const char RESET_SESSION[] =
+  "UPDATE sessions SET creation_time=?, incoming_seqnum=?, outgoing_seqnum=? WHERE "
+  "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=?";
+
 MySQLStore::MySQLStore
 ( const SessionID& s, const DatabaseConnectionID& d, MySQLConnectionPool* p )
-  : m_pConnectionPool( p ), m_sessionID( s )
+  : m_updateSeqNums( UPDATE_SEQNUMS ), m_pending( false ), m_batchSize( 1 ),
+    m_batchInterval( 0 ), m_batchStart( 0 ), m_pTimer( 0 ), m_pConnectionPool( p ), m_sessionID( s )
 {
   m_pConnection = m_pConnectionPool->create( d );
   populateCache();
@@ -54,7 +75,8 @@ MySQLStore::MySQLStore
 MySQLStore::MySQLStore
 ( const SessionID& s, const std::string& database, const std::string& user,
   const std::string& password, const std::string& host, short port )
-  : m_pConnectionPool( 0 ), m_sessionID( s )
+  : m_updateSeqNums( UPDATE_SEQNUMS ), m_pending( false ), m_batchSize( 1 ),
+    m_batchInterval( 0 ), m_batchStart( 0 ), m_pTimer( 0 ), m_pConnectionPool( 0 ), m_sessionID( s )
 {
   m_pConnection = new MySQLConnection( database, user, password, host, port );
   populateCache();
@@ -62,6 +84,20 @@ MySQLStore::MySQLStore
 
 MySQLStore::~MySQLStore()
 {
+  // stopped first, the timer calls back under the lock
+  delete m_pTimer;
+  // Session flushes and logs a failure itself, this only covers
+  // stores that are used without one
+  try { flush(); }
+  catch( IOException& ) {}
+
+  for( Inserts::iterator i = m_inserts.begin(); i != m_inserts.end(); ++i )
+  {
+    m_pConnection->close( *i->second );
+    delete i->second;
+  }
+  m_pConnection->close( m_updateSeqNums );
+
   if( m_pConnectionPool )
     m_pConnectionPool->destroy( m_pConnection );
   else
@@ -157,8 +193,19 @@ MessageStore* MySQLStoreFactory::create( const SessionID& s, const Dictionary& s
   try { port = ( short ) settings.getInt( MYSQL_STORE_PORT ); }
   catch( ConfigError& ) {}
 
+  int batchSize = 1;
+  int batchInterval = 0;
+
+  try { batchSize = settings.getInt( MYSQL_STORE_BATCH_SIZE ); }
+  catch( ConfigError& ) {}
+
+  try { batchInterval = settings.getInt( MYSQL_STORE_BATCH_INTERVAL ); }
+  catch( ConfigError& ) {}
+
   DatabaseConnectionID id( database, user, password, host, port );
-  return new MySQLStore( s, id, m_connectionPoolPtr.get() );
+  MySQLStore* pStore = new MySQLStore( s, id, m_connectionPoolPtr.get() );
+  pStore->setBatch( batchSize, batchInterval );
+  return pStore;
 }
 
 void MySQLStoreFactory::destroy( MessageStore* pStore )
@@ -169,36 +216,11 @@ void MySQLStoreFactory::destroy( MessageStore* pStore )
 bool MySQLStore::set( int msgSeqNum, const std::string& msg )
 EXCEPT ( IOException )
 {
-  char* msgCopy = new char[ (msg.size() * 2) + 1 ];
-  mysql_escape_string( msgCopy, msg.c_str(), msg.size() );
-
-  std::stringstream queryString;
-  queryString << "INSERT INTO messages "
-  << "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
-  << "VALUES ("
-  << "\"" << m_sessionID.getBeginString().getValue() << "\","
-  << "\"" << m_sessionID.getSenderCompID().getValue() << "\","
-  << "\"" << m_sessionID.getTargetCompID().getValue() << "\","
-  << "\"" << m_sessionID.getSessionQualifier() << "\","
-  << msgSeqNum << ","
-  << "\"" << msgCopy << "\")";
-
-  delete [] msgCopy;
-
-  MySQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-  {
-    std::stringstream queryString2;
-    queryString2 << "UPDATE messages SET message=\"" << msg << "\" WHERE "
-    << "beginstring=" << "\"" << m_sessionID.getBeginString().getValue() << "\" and "
-    << "sendercompid=" << "\"" << m_sessionID.getSenderCompID().getValue() << "\" and "
-    << "targetcompid=" << "\"" << m_sessionID.getTargetCompID().getValue() << "\" and "
-    << "session_qualifier=" << "\"" << m_sessionID.getSessionQualifier() << "\" and "
-    << "msgseqnum=" << msgSeqNum;
-    MySQLQuery query2( queryString2.str() );
-    if( !m_pConnection->execute(query2) )
-      query2.throwException();
-  }
+  Locker l( m_mutex );
+  queue();
+  m_batch.push_back( std::make_pair( msgSeqNum, msg ) );
+  // a batch size of 1 writes the message through
+  flushIfDue();
   return true;
 }
 
@@ -206,6 +228,9 @@ void MySQLStore::get( int begin, int end,
                       std::vector < std::string > & result ) const
 EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
+  const_cast<MySQLStore*>( this )->flush();
+
   result.clear();
   std::stringstream queryString;
   queryString << "SELECT message FROM messages WHERE "
@@ -227,74 +252,59 @@ EXCEPT ( IOException )
 
 int MySQLStore::getNextSenderMsgSeqNum() const EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
   return m_cache.getNextSenderMsgSeqNum();
 }
 
 int MySQLStore::getNextTargetMsgSeqNum() const EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
   return m_cache.getNextTargetMsgSeqNum();
 }
 
 void MySQLStore::setNextSenderMsgSeqNum( int value ) EXCEPT ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET outgoing_seqnum=" << value << " WHERE "
-  << "beginstring=" << "\"" << m_sessionID.getBeginString().getValue() << "\" and "
-  << "sendercompid=" << "\"" << m_sessionID.getSenderCompID().getValue() << "\" and "
-  << "targetcompid=" << "\"" << m_sessionID.getTargetCompID().getValue() << "\" and "
-  << "session_qualifier=" << "\"" << m_sessionID.getSessionQualifier() << "\"";
-  MySQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
+  Locker l( m_mutex );
+  queue();
   m_cache.setNextSenderMsgSeqNum( value );
+  flush();
 }
 
 void MySQLStore::setNextTargetMsgSeqNum( int value ) EXCEPT ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET incoming_seqnum=" << value << " WHERE "
-  << "beginstring=" << "\"" << m_sessionID.getBeginString().getValue() << "\" and "
-  << "sendercompid=" << "\"" << m_sessionID.getSenderCompID().getValue() << "\" and "
-  << "targetcompid=" << "\"" << m_sessionID.getTargetCompID().getValue() << "\" and "
-  << "session_qualifier=" << "\"" << m_sessionID.getSessionQualifier() << "\"";
-
-  MySQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
-
+  Locker l( m_mutex );
+  queue();
   m_cache.setNextTargetMsgSeqNum( value );
+  flush();
 }
 
 void MySQLStore::incrNextSenderMsgSeqNum() EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
+  queue();
   m_cache.incrNextSenderMsgSeqNum();
-  setNextSenderMsgSeqNum( m_cache.getNextSenderMsgSeqNum() );
+  flushIfDue();
 }
 
 void MySQLStore::incrNextTargetMsgSeqNum() EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
+  queue();
   m_cache.incrNextTargetMsgSeqNum();
-  setNextTargetMsgSeqNum( m_cache.getNextTargetMsgSeqNum() );
+  flushIfDue();
 }
 
 UtcTimeStamp MySQLStore::getCreationTime() const EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
   return m_cache.getCreationTime();
 }
 
 void MySQLStore::reset() EXCEPT ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "DELETE FROM messages WHERE "
-  << "beginstring=" << "\"" << m_sessionID.getBeginString().getValue() << "\" and "
-  << "sendercompid=" << "\"" << m_sessionID.getSenderCompID().getValue() << "\" and "
-  << "targetcompid=" << "\"" << m_sessionID.getTargetCompID().getValue() << "\" and "
-  << "session_qualifier=" << "\"" << m_sessionID.getSessionQualifier() << "\"";
-
-  MySQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
-
+  Locker l( m_mutex );
+  m_batch.clear();
+  m_pending = false;
   m_cache.reset();
   UtcTimeStamp time = m_cache.getCreationTime();
 
@@ -306,26 +316,133 @@ void MySQLStore::reset() EXCEPT ( IOException )
   STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d",
            year, month, day, hour, minute, second );
 
-  std::stringstream queryString2;
-  queryString2 << "UPDATE sessions SET creation_time='" << sqlTime << "', "
-  << "incoming_seqnum=" << m_cache.getNextTargetMsgSeqNum() << ", "
-  << "outgoing_seqnum=" << m_cache.getNextSenderMsgSeqNum() << " WHERE "
-  << "beginstring=" << "\"" << m_sessionID.getBeginString().getValue() << "\" and "
-  << "sendercompid=" << "\"" << m_sessionID.getSenderCompID().getValue() << "\" and "
-  << "targetcompid=" << "\"" << m_sessionID.getTargetCompID().getValue() << "\" and "
-  << "session_qualifier=" << "\"" << m_sessionID.getSessionQualifier() << "\"";
-
-  MySQLQuery query2( queryString2.str() );
-  if( !m_pConnection->execute(query2) )
-    query2.throwException();
+  MySQLStatement statement( DELETE_MESSAGES );
+  bindSessionID( statement );
+
+  MySQLStatement statement2( RESET_SESSION );
+  statement2.bind( sqlTime );
+  statement2.bind( m_cache.getNextTargetMsgSeqNum() );
+  statement2.bind( m_cache.getNextSenderMsgSeqNum() );
+  bindSessionID( statement2 );
+
+  std::vector<MySQLStatement*> statements;
+  statements.push_back( &statement );
+  statements.push_back( &statement2 );
+  m_pConnection->transaction( statements );
+  m_pConnection->close( statement );
+  m_pConnection->close( statement2 );
 }
 
 void MySQLStore::refresh() EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
+  flush();
   m_cache.reset();
   populateCache(); 
 }
 
+void MySQLStore::setBatch( int size, int interval )
+{
+  delete m_pTimer;
+  m_pTimer = 0;
+
+  Locker l( m_mutex );
+  m_batchSize = size > 1 ? size : 1;
+  m_batchInterval = (int64_t)interval * 1000000;
+  if( m_batchSize > 1 && interval > 0 )
+    m_pTimer = new FlushTimer( &onTimer, this, interval );
+}
+
+void MySQLStore::flush() EXCEPT ( IOException )
+{
+  Locker l( m_mutex );
+  if( !m_pending ) return;
+
+  // A full batch goes in one statement, anything less in chunks
+  // of powers of two so that few distinct inserts are prepared
+  std::vector<MySQLStatement*> statements;
+  Batch::const_iterator i = m_batch.begin();
+  size_t remaining = m_batch.size();
+  while( remaining )
+  {
+    size_t rows = 1;
+    if( remaining == m_batchSize )
+      rows = m_batchSize;
+    else
+      while( rows * 2 <= remaining ) rows *= 2;
+
+    MySQLStatement& insert = insertStatement( rows );
+    insert.clear();
+    for( size_t row = 0; row < rows; ++row, ++i )
+    {
+      bindSessionID( insert );
+      insert.bind( i->first );
+      insert.bind( i->second );
+    }
+    statements.push_back( &insert );
+    remaining -= rows;
+  }
+
+  m_updateSeqNums.clear();
+  m_updateSeqNums.bind( m_cache.getNextTargetMsgSeqNum() );
+  m_updateSeqNums.bind( m_cache.getNextSenderMsgSeqNum() );
+  bindSessionID( m_updateSeqNums );
+  statements.push_back( &m_updateSeqNums );
+
+  m_pConnection->transaction( statements );
+  m_batch.clear();
+  m_pending = false;
+}
+
+MySQLStatement& MySQLStore::insertStatement( size_t rows )
+{
+  MySQLStatement*& pStatement = m_inserts[ rows ];
+  if( !pStatement )
+  {
+    std::string query = INSERT_MESSAGES;
+    for( size_t row = 0; row < rows; ++row )
+      query += row ? ",(?,?,?,?,?,?)" : "(?,?,?,?,?,?)";
+    query += UPSERT_MESSAGES;
+    pStatement = new MySQLStatement( query );
+  }
+  return *pStatement;
+}
+
+void MySQLStore::bindSessionID( MySQLStatement& statement ) const
+{
+  statement.bind( m_sessionID.getBeginString().getValue() );
+  statement.bind( m_sessionID.getSenderCompID().getValue() );
+  statement.bind( m_sessionID.getTargetCompID().getValue() );
+  statement.bind( m_sessionID.getSessionQualifier() );
+}
+
+void MySQLStore::queue()
+{
+  if( !m_pending )
+  {
+    m_batchStart = LatencyHistogram::now();
+    if( m_pTimer ) m_pTimer->arm();
+  }
+  m_pending = true;
+}
+
+void MySQLStore::flushIfDue() EXCEPT ( IOException )
+{
+  if( m_batchSize <= 1 || m_batch.size() >= m_batchSize || ( m_batchInterval
+      && LatencyHistogram::now() - m_batchStart >= m_batchInterval ) )
+    flush();
+}
+
+void MySQLStore::onTimer( void* p )
+{
+  MySQLStore* pStore = static_cast < MySQLStore* > ( p );
+  Locker l( pStore->m_mutex );
+  // a failed write stays pending, the next write on the session
+  // thread finds it due and reports the error there
+  try { pStore->flush(); }
+  catch( IOException& ) {}
+}
+
 }
 
 #endif
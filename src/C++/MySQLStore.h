@@ -33,9 +33,12 @@
 #endif
 
 #include "MessageStore.h"
+#include "FlushTimer.h"
+#include "Mutex.h"
 #include "SessionSettings.h"
 #include "MySQLConnection.h"
 #include <fstream>
+#include <map>
 #include <string>
 
 namespace FIX
@@ -114,6 +117,7 @@ public:
   ~MySQLStore();
 
   bool set( int, const std::string& ) EXCEPT ( IOException );
+  // set() queues, so a batch goes out with the next sequence number update
   void get( int, int, std::vector < std::string > & ) const EXCEPT ( IOException );
 
   int getNextSenderMsgSeqNum() const EXCEPT ( IOException );
@@ -128,10 +132,35 @@ public:
   void reset() EXCEPT ( IOException );
   void refresh() EXCEPT ( IOException );
 
+  /// Write messages and sequence numbers in transactions of up to size
+  /// messages, or of whatever is pending once interval milliseconds have
+  /// passed.  A size of 1 writes each message with its sequence number.
+  void setBatch( int size, int interval );
+  /// Write anything pending now
+  void flush() EXCEPT ( IOException );
+
 private:
+  typedef std::vector < std::pair < int, std::string > > Batch;
+  /// Multi-row inserts keyed by the number of rows they take
+  typedef std::map < size_t, MySQLStatement* > Inserts;
+
   void populateCache();
+  MySQLStatement& insertStatement( size_t rows );
+  void bindSessionID( MySQLStatement& statement ) const;
+  void queue();
+  void flushIfDue() EXCEPT ( IOException );
+  static void onTimer( void* );
 
   MemoryStore m_cache;
+  Batch m_batch;
+  Inserts m_inserts;
+  MySQLStatement m_updateSeqNums;
+  bool m_pending;
+  size_t m_batchSize;
+  int64_t m_batchInterval;
+  int64_t m_batchStart;
+  FlushTimer* m_pTimer;
+  mutable Mutex m_mutex;
   MySQLConnection* m_pConnection;
   MySQLConnectionPool* m_pConnectionPool;
   SessionID m_sessionID;
@@ -37,9 +37,11 @@
 #include <sqlext.h>
 #include <sqltypes.h>
 #include <sstream>
+#include <vector>
 #include "DatabaseConnectionID.h"
 #include "DatabaseConnectionPool.h"
 #include "Exceptions.h"
+#include "FieldConvertors.h"
 #include "Mutex.h"
 
 namespace FIX
@@ -147,12 +149,150 @@ private:
   std::string m_reason;
 };
 
+/// A statement prepared once per connection and executed for each
+/// row of bound parameters.  Its handle belongs to the connection and
+/// is released through OdbcConnection::close().
+class OdbcStatement
+{
+public:
+  /// A row that fails is retried with the fallback statement, if any
+  OdbcStatement( const std::string& query, OdbcStatement* pFallback = 0 )
+  : m_statement( 0 ), m_generation( 0 ), m_result( SQL_SUCCESS ),
+    m_query( query ), m_pFallback( pFallback )
+  {}
+
+  /// Binds the value of the next ? parameter of the current row
+  void bind( const std::string& value )
+  {
+    if( m_rows.empty() ) nextRow();
+    m_rows.back().push_back( std::make_pair( value, false ) );
+  }
+
+  void bind( int value )
+  {
+    bind( IntConvertor::convert( value ) );
+  }
+
+  void bindNull()
+  {
+    if( m_rows.empty() ) nextRow();
+    m_rows.back().push_back( std::make_pair( std::string(), true ) );
+  }
+
+  /// Starts another row of parameters
+  void nextRow()
+  {
+    m_rows.push_back( Parameters() );
+  }
+
+  void clear()
+  {
+    m_rows.clear();
+  }
+
+  bool empty() const
+  {
+    return m_rows.empty();
+  }
+
+  bool execute( HDBC connection, int generation )
+  {
+    if( m_rows.empty() ) nextRow();
+    for( size_t i = 0; i < m_rows.size(); ++i )
+    {
+      if( run( connection, generation, m_rows[ i ] ) )
+        continue;
+      if( !m_pFallback || !m_pFallback->run( connection, generation, m_rows[ i ] ) )
+        return false;
+    }
+    return true;
+  }
+
+  void close( int generation )
+  {
+    // A reconnect has already freed handles of older generations
+    if( m_statement && m_generation == generation )
+      SQLFreeHandle( SQL_HANDLE_STMT, m_statement );
+    m_statement = 0;
+  }
+
+  bool success()
+  {
+    return odbcSuccess( m_result ) || m_result == SQL_NO_DATA;
+  }
+
+  const std::string& reason()
+  {
+    return m_reason;
+  }
+
+  void throwException() EXCEPT ( IOException )
+  {
+    if( !success() )
+      throw IOException( "Query failed [" + m_query + "] " + reason() );
+  }
+
+private:
+  typedef std::vector < std::pair < std::string, bool > > Parameters;
+
+  bool run( HDBC connection, int generation, const Parameters& parameters )
+  {
+    if( m_statement && m_generation != generation )
+      m_statement = 0;
+
+    if( !m_statement )
+    {
+      m_result = SQLAllocHandle( SQL_HANDLE_STMT, connection, &m_statement );
+      if( !odbcSuccess( m_result ) )
+      {
+        m_reason = odbcError( SQL_HANDLE_DBC, connection );
+        m_statement = 0;
+        return false;
+      }
+      m_generation = generation;
+      m_result = SQLPrepare( m_statement, (SQLCHAR*)m_query.c_str(), m_query.size() );
+      if( !odbcSuccess( m_result ) )
+      {
+        m_reason = odbcError( SQL_HANDLE_STMT, m_statement );
+        close( generation );
+        return false;
+      }
+    }
+
+    std::vector<SQLLEN> lengths( parameters.size() );
+    for( size_t i = 0; i < parameters.size(); ++i )
+    {
+      const std::string& value = parameters[ i ].first;
+      lengths[ i ] = parameters[ i ].second ? SQL_NULL_DATA : (SQLLEN)value.size();
+      SQLBindParameter
+        ( m_statement, (SQLUSMALLINT)( i + 1 ), SQL_PARAM_INPUT, SQL_C_CHAR,
+          value.size() > 4000 ? SQL_LONGVARCHAR : SQL_VARCHAR,
+          value.size() ? value.size() : 1, 0,
+          (SQLPOINTER)value.c_str(), value.size(), &lengths[ i ] );
+    }
+
+    m_result = SQLExecute( m_statement );
+    if( !success() )
+      m_reason = odbcError( SQL_HANDLE_STMT, m_statement );
+    SQLFreeStmt( m_statement, SQL_CLOSE );
+    return success();
+  }
+
+  HSTMT m_statement;
+  int m_generation;
+  RETCODE m_result;
+  std::string m_query;
+  std::string m_reason;
+  std::vector < Parameters > m_rows;
+  OdbcStatement* m_pFallback;
+};
+
 class OdbcConnection
 {
 public:
   OdbcConnection
   ( const DatabaseConnectionID& id )
-    : m_connection( 0 ), m_environment( 0 ), m_connectionID( id )
+    : m_connection( 0 ), m_environment( 0 ), m_generation( 0 ), m_connectionID( id )
   {
     connect();
   }
@@ -160,7 +300,8 @@ public:
   OdbcConnection
   ( const std::string& user, const std::string& password, 
     const std::string& connectionString )
-  : m_connection( 0 ), m_environment( 0 ), m_connectionID( "", user, password, connectionString, 0 )
+  : m_connection( 0 ), m_environment( 0 ), m_generation( 0 ),
+    m_connectionID( "", user, password, connectionString, 0 )
   {
     connect();
   }
@@ -192,6 +333,7 @@ public:
     SQLDisconnect( m_connection );
     SQLFreeHandle( SQL_HANDLE_DBC, m_connection );
     m_connection = 0;
+    m_generation++;
     connect();
     return true;
   }
@@ -207,6 +349,48 @@ public:
     return true;
   }
 
+  /// Releases the statement's handle on this connection
+  void close( OdbcStatement& statement )
+  {
+    Locker locker( m_mutex );
+    statement.close( m_generation );
+  }
+
+  /// Runs the statements in one transaction, keeping none of them if any fails
+  void transaction( const std::vector<OdbcStatement*>& statements )
+  EXCEPT ( IOException )
+  {
+    Locker locker( m_mutex );
+
+    for( int attempt = 0; ; ++attempt )
+    {
+      SQLSetConnectAttr( m_connection, SQL_ATTR_AUTOCOMMIT,
+                         (SQLPOINTER)SQL_AUTOCOMMIT_OFF, 0 );
+
+      OdbcStatement* pFailed = 0;
+      for( size_t i = 0; !pFailed && i < statements.size(); ++i )
+      {
+        if( !statements[ i ]->execute( m_connection, m_generation ) )
+          pFailed = statements[ i ];
+      }
+
+      RETCODE result = SQLEndTran
+        ( SQL_HANDLE_DBC, m_connection, pFailed ? SQL_ROLLBACK : SQL_COMMIT );
+      std::string error = odbcSuccess( result ) ? "" : odbcError( SQL_HANDLE_DBC, m_connection );
+      SQLSetConnectAttr( m_connection, SQL_ATTR_AUTOCOMMIT,
+                         (SQLPOINTER)SQL_AUTOCOMMIT_ON, 0 );
+
+      if( !pFailed && odbcSuccess( result ) )
+        return;
+      if( attempt > 0 )
+      {
+        if( pFailed ) pFailed->throwException();
+        throw IOException( "Commit failed " + error );
+      }
+      reconnect();
+    }
+  }
+
 private:
   void connect()
   {
@@ -256,6 +440,7 @@ private:
 
   HENV m_environment;
   HDBC m_connection;
+  int m_generation;
   bool m_connected;
   DatabaseConnectionID m_connectionID;
   Mutex m_mutex;
@@ -29,6 +29,7 @@
 #include "SessionID.h"
 #include "SessionSettings.h"
 #include "Utility.h"
+#include "LatencyHistogram.h"
 #include "strptime.h"
 #include <fstream>
 
@@ -60,6 +61,10 @@ OdbcLog::OdbcLog
 
 void OdbcLog::init()
 {
+  m_batchCount = 0;
+  m_batchSize = 1;
+  m_batchInterval = 0;
+  m_batchStart = 0;
   setIncomingTable( "messages_log" );
   setOutgoingTable( "messages_log" );
   setEventTable( "event_log" );
@@ -67,6 +72,14 @@ void OdbcLog::init()
 
 OdbcLog::~OdbcLog()
 {
+  flush();
+
+  for( Inserts::iterator i = m_inserts.begin(); i != m_inserts.end(); ++i )
+  {
+    m_pConnection->close( *i->second );
+    delete i->second;
+  }
+
   delete m_pSessionID;
   delete m_pConnection;
 }
@@ -146,6 +159,17 @@ void OdbcLogFactory::init( const Dictionary& settings,
 
 void OdbcLogFactory::initLog( const Dictionary& settings, OdbcLog& log )
 {
+  int batchSize = 1;
+  int batchInterval = 0;
+
+  try { batchSize = settings.getInt( ODBC_LOG_BATCH_SIZE ); }
+  catch( ConfigError& ) {}
+
+  try { batchInterval = settings.getInt( ODBC_LOG_BATCH_INTERVAL ); }
+  catch( ConfigError& ) {}
+
+  log.setBatch( batchSize, batchInterval );
+
   try { log.setIncomingTable( settings.getString( ODBC_LOG_INCOMING_TABLE ) ); }
   catch( ConfigError& ) {}
 
@@ -193,6 +217,10 @@ void OdbcLog::clear()
   eventQuery 
     << "DELETE FROM " << m_eventTable << " " << whereClause.str();
 
+  for( Inserts::iterator i = m_inserts.begin(); i != m_inserts.end(); ++i )
+    i->second->clear();
+  m_batchCount = 0;
+
   OdbcQuery incoming( incomingQuery.str() );
   OdbcQuery outgoing( outgoingQuery.str() );
   OdbcQuery event( eventQuery.str() );
@@ -205,6 +233,31 @@ void OdbcLog::backup()
 {
 }
 
+void OdbcLog::setBatch( int size, int interval )
+{
+  m_batchSize = size > 1 ? size : 1;
+  m_batchInterval = (int64_t)interval * 1000000;
+}
+
+void OdbcLog::flush()
+{
+  if( !m_batchCount ) return;
+
+  std::vector<OdbcStatement*> statements;
+  for( Inserts::iterator i = m_inserts.begin(); i != m_inserts.end(); ++i )
+  {
+    if( !i->second->empty() )
+      statements.push_back( i->second );
+  }
+
+  try { m_pConnection->transaction( statements ); }
+  catch( IOException& ) {}
+
+  for( Inserts::iterator i = m_inserts.begin(); i != m_inserts.end(); ++i )
+    i->second->clear();
+  m_batchCount = 0;
+}
+
 void OdbcLog::insert( const std::string& table, const std::string value )
 {
   UtcTimeStamp time;
@@ -216,35 +269,42 @@ void OdbcLog::insert( const std::string& table, const std::string value )
   STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d.%003d",
                   year, month, day, hour, minute, second, millis );
 
-  std::string valueCopy = value;
-  string_replace( "'", "''", valueCopy );
+  OdbcStatement*& pInsert = m_inserts[ table ];
+  if( !pInsert )
+  {
+    pInsert = new OdbcStatement( "INSERT INTO " + table + " "
+      "(time, beginstring, sendercompid, targetcompid, session_qualifier, text) "
+      "VALUES (?,?,?,?,?,?)" );
+  }
 
-  std::stringstream queryString;
-  queryString << "INSERT INTO " << table << " "
-  << "(time, beginstring, sendercompid, targetcompid, session_qualifier, text) "
-  << "VALUES ("
-  << "{ts '" << sqlTime << "'},";
+  if( !m_batchCount )
+    m_batchStart = LatencyHistogram::now();
 
+  pInsert->nextRow();
+  pInsert->bind( sqlTime );
   if( m_pSessionID )
   {
-    queryString
-    << "'" << m_pSessionID->getBeginString().getValue() << "',"
-    << "'" << m_pSessionID->getSenderCompID().getValue() << "',"
-    << "'" << m_pSessionID->getTargetCompID().getValue() << "',";
+    pInsert->bind( m_pSessionID->getBeginString().getValue() );
+    pInsert->bind( m_pSessionID->getSenderCompID().getValue() );
+    pInsert->bind( m_pSessionID->getTargetCompID().getValue() );
     if( m_pSessionID->getSessionQualifier() == "" )
-      queryString << "NULL" << ",";
+      pInsert->bindNull();
     else
-      queryString << "'" << m_pSessionID->getSessionQualifier() << "',";
+      pInsert->bind( m_pSessionID->getSessionQualifier() );
   }
   else
   {
-    queryString << "NULL, NULL, NULL, NULL, ";
+    pInsert->bindNull();
+    pInsert->bindNull();
+    pInsert->bindNull();
+    pInsert->bindNull();
   }
+  pInsert->bind( value );
+  ++m_batchCount;
 
-  queryString << "'" << valueCopy << "')";
-
-  OdbcQuery query( queryString.str() );
-  m_pConnection->execute( query );
+  if( m_batchCount >= m_batchSize || ( m_batchInterval
+      && LatencyHistogram::now() - m_batchStart >= m_batchInterval ) )
+    flush();
 }
 
 }
@@ -36,6 +36,7 @@
 #include "SessionSettings.h"
 #include <fstream>
 #include <string>
+#include <map>
 
 namespace FIX
 {
@@ -66,10 +67,24 @@ public:
   void onEvent( const std::string& value )
   { insert( m_eventTable, value ); }
 
+  /// Write entries in transactions of up to size entries, or of whatever
+  /// is pending once interval milliseconds have passed.
+  void setBatch( int size, int interval );
+  /// Write anything pending now
+  void flush();
+
 private:
+  /// Inserts keyed by table, each holding a row per pending entry
+  typedef std::map < std::string, OdbcStatement* > Inserts;
+
   void init();
   void insert( const std::string& table, const std::string value );
 
+  Inserts m_inserts;
+  size_t m_batchCount;
+  size_t m_batchSize;
+  int64_t m_batchInterval;
+  int64_t m_batchStart;
   std::string m_incomingTable;
   std::string m_outgoingTable;
   std::string m_eventTable;
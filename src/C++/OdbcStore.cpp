@@ -35,6 +35,7 @@
 #include "FieldConvertors.h"
 #include "Parser.h"
 #include "Utility.h"
+#include "LatencyHistogram.h"
 #include "strptime.h"
 #include <fstream>
 
@@ -46,10 +47,29 @@ const std::string OdbcStoreFactory::DEFAULT_PASSWORD = "";
 const std::string OdbcStoreFactory::DEFAULT_CONNECTION_STRING 
   = "DATABASE=quickfix;DRIVER={SQL Server};SERVER=(local);";
 
+// The insert and its fallback update take their parameters in the same order
+static const char INSERT_MESSAGE[] =
+  "INSERT INTO messages (message, beginstring, sendercompid, targetcompid, "
+  "session_qualifier, msgseqnum) VALUES (?,?,?,?,?,?)";
+
+static const char UPDATE_MESSAGE[] =
+  "UPDATE messages SET message=? WHERE beginstring=? and sendercompid=? and "
+  "targetcompid=? and session_qualifier=? and msgseqnum=?";
+
+static const char UPDATE_SEQNUMS[] =
+  "UPDATE sessions SET incoming_seqnum=?, outgoing_seqnum=? WHERE "
+  "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=?";
+
+static const char DELETE_MESSAGES[] =
+  "DELETE FROM messages WHERE "
+  "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=?";
+
 OdbcStore::OdbcStore
 ( const SessionID& s, const std::string& user, const std::string& password, 
   const std::string& connectionString )
-  : m_sessionID( s )
+  : m_update( UPDATE_MESSAGE ), m_insert( INSERT_MESSAGE, &m_update ),
+    m_updateSeqNums( UPDATE_SEQNUMS ), m_batchCount( 0 ), m_pending( false ),
+    m_batchSize( 1 ), m_batchInterval( 0 ), m_batchStart( 0 ), m_pTimer( 0 ), m_sessionID( s )
 {
   m_pConnection = new OdbcConnection( user, password, connectionString );
   populateCache();
@@ -57,6 +77,16 @@ OdbcStore::OdbcStore
 
 OdbcStore::~OdbcStore()
 {
+  // stopped first, the timer calls back under the lock
+  delete m_pTimer;
+  // Session flushes and logs a failure itself, this only covers
+  // stores that are used without one
+  try { flush(); }
+  catch( IOException& ) {}
+
+  m_pConnection->close( m_insert );
+  m_pConnection->close( m_update );
+  m_pConnection->close( m_updateSeqNums );
   delete m_pConnection;
 }
 
@@ -158,41 +188,32 @@ MessageStore* OdbcStoreFactory::create( const SessionID& s, const Dictionary& se
   try { connectionString = settings.getString( ODBC_STORE_CONNECTION_STRING ); }
   catch( ConfigError& ) {}
 
-  return new OdbcStore( s, user, password, connectionString );
+  int batchSize = 1;
+  int batchInterval = 0;
+
+  try { batchSize = settings.getInt( ODBC_STORE_BATCH_SIZE ); }
+  catch( ConfigError& ) {}
+
+  try { batchInterval = settings.getInt( ODBC_STORE_BATCH_INTERVAL ); }
+  catch( ConfigError& ) {}
+
+  OdbcStore* pStore = new OdbcStore( s, user, password, connectionString );
+  pStore->setBatch( batchSize, batchInterval );
+  return pStore;
 }
 
 bool OdbcStore::set( int msgSeqNum, const std::string& msg )
 EXCEPT ( IOException )
 {
-  std::string msgCopy = msg;
-  string_replace( "'", "''", msgCopy );
-
-  std::stringstream queryString;
-  queryString << "INSERT INTO messages "
-  << "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
-  << "VALUES ("
-  << "'" << m_sessionID.getBeginString().getValue() << "',"
-  << "'" << m_sessionID.getSenderCompID().getValue() << "',"
-  << "'" << m_sessionID.getTargetCompID().getValue() << "',"
-  << "'" << m_sessionID.getSessionQualifier() << "',"
-  << msgSeqNum << ","
-  << "'" << msgCopy << "')";
-
-  OdbcQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-  {
-    query.close();
-    std::stringstream queryString2;
-    queryString2 << "UPDATE messages SET message='" << msgCopy << "' WHERE "
-    << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-    << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-    << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-    << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "' and "
-    << "msgseqnum=" << msgSeqNum;
-    OdbcQuery query2( queryString2.str() );
-    if( !m_pConnection->execute(query2) )
-      query2.throwException();
-  }
+  Locker l( m_mutex );
+  queue();
+  m_insert.nextRow();
+  m_insert.bind( msg );
+  bindSessionID( m_insert );
+  m_insert.bind( msgSeqNum );
+  ++m_batchCount;
+  // a batch size of 1 writes the message through
+  flushIfDue();
   return true;
 }
 
@@ -200,6 +221,9 @@ void OdbcStore::get( int begin, int end,
                     std::vector < std::string > & result ) const
 EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
+  const_cast<OdbcStore*>( this )->flush();
+
   result.clear();
   std::stringstream queryString;
   queryString << "SELECT message FROM messages WHERE "
@@ -233,75 +257,60 @@ EXCEPT ( IOException )
 
 int OdbcStore::getNextSenderMsgSeqNum() const EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
   return m_cache.getNextSenderMsgSeqNum();
 }
 
 int OdbcStore::getNextTargetMsgSeqNum() const EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
   return m_cache.getNextTargetMsgSeqNum();
 }
 
 void OdbcStore::setNextSenderMsgSeqNum( int value ) EXCEPT ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET outgoing_seqnum=" << value << " WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "'";
-  OdbcQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
+  Locker l( m_mutex );
+  queue();
   m_cache.setNextSenderMsgSeqNum( value );
+  flush();
 }
 
 void OdbcStore::setNextTargetMsgSeqNum( int value ) EXCEPT ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET incoming_seqnum=" << value << " WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "'";
-
-  OdbcQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
-
+  Locker l( m_mutex );
+  queue();
   m_cache.setNextTargetMsgSeqNum( value );
+  flush();
 }
 
 void OdbcStore::incrNextSenderMsgSeqNum() EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
+  queue();
   m_cache.incrNextSenderMsgSeqNum();
-  setNextSenderMsgSeqNum( m_cache.getNextSenderMsgSeqNum() );
+  flushIfDue();
 }
 
 void OdbcStore::incrNextTargetMsgSeqNum() EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
+  queue();
   m_cache.incrNextTargetMsgSeqNum();
-  setNextTargetMsgSeqNum( m_cache.getNextTargetMsgSeqNum() );
+  flushIfDue();
 }
 
 UtcTimeStamp OdbcStore::getCreationTime() const EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
   return m_cache.getCreationTime();
 }
 
 void OdbcStore::reset() EXCEPT ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "DELETE FROM messages WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "'";
-
-  OdbcQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
-  query.close();
-
+  Locker l( m_mutex );
+  m_insert.clear();
+  m_batchCount = 0;
+  m_pending = false;
   m_cache.reset();
   UtcTimeStamp time = m_cache.getCreationTime();
 
@@ -313,26 +322,109 @@ void OdbcStore::reset() EXCEPT ( IOException )
   STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d",
            year, month, day, hour, minute, second );
 
+  OdbcStatement statement( DELETE_MESSAGES );
+  bindSessionID( statement );
+
   std::stringstream queryString2;
   queryString2 << "UPDATE sessions SET creation_time={ts '" << sqlTime << "'}, "
-  << "incoming_seqnum=" << m_cache.getNextTargetMsgSeqNum() << ", "
-  << "outgoing_seqnum=" << m_cache.getNextSenderMsgSeqNum() << " WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "'";
-
-  OdbcQuery query2( queryString2.str() );
-  if( !m_pConnection->execute(query2) )
-    query2.throwException();
+  << "incoming_seqnum=?, outgoing_seqnum=? WHERE "
+  << "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=?";
+
+  OdbcStatement statement2( queryString2.str() );
+  statement2.bind( m_cache.getNextTargetMsgSeqNum() );
+  statement2.bind( m_cache.getNextSenderMsgSeqNum() );
+  bindSessionID( statement2 );
+
+  std::vector<OdbcStatement*> statements;
+  statements.push_back( &statement );
+  statements.push_back( &statement2 );
+  try { m_pConnection->transaction( statements ); }
+  catch( IOException& )
+  {
+    m_pConnection->close( statement );
+    m_pConnection->close( statement2 );
+    throw;
+  }
+  m_pConnection->close( statement );
+  m_pConnection->close( statement2 );
 }
 
 void OdbcStore::refresh() EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
+  flush();
   m_cache.reset();
   populateCache(); 
 }
 
+void OdbcStore::setBatch( int size, int interval )
+{
+  delete m_pTimer;
+  m_pTimer = 0;
+
+  Locker l( m_mutex );
+  m_batchSize = size > 1 ? size : 1;
+  m_batchInterval = (int64_t)interval * 1000000;
+  if( m_batchSize > 1 && interval > 0 )
+    m_pTimer = new FlushTimer( &onTimer, this, interval );
+}
+
+void OdbcStore::flush() EXCEPT ( IOException )
+{
+  Locker l( m_mutex );
+  if( !m_pending ) return;
+
+  std::vector<OdbcStatement*> statements;
+  if( m_batchCount )
+    statements.push_back( &m_insert );
+
+  m_updateSeqNums.clear();
+  m_updateSeqNums.bind( m_cache.getNextTargetMsgSeqNum() );
+  m_updateSeqNums.bind( m_cache.getNextSenderMsgSeqNum() );
+  bindSessionID( m_updateSeqNums );
+  statements.push_back( &m_updateSeqNums );
+
+  m_pConnection->transaction( statements );
+  m_insert.clear();
+  m_batchCount = 0;
+  m_pending = false;
+}
+
+void OdbcStore::bindSessionID( OdbcStatement& statement ) const
+{
+  statement.bind( m_sessionID.getBeginString().getValue() );
+  statement.bind( m_sessionID.getSenderCompID().getValue() );
+  statement.bind( m_sessionID.getTargetCompID().getValue() );
+  statement.bind( m_sessionID.getSessionQualifier() );
+}
+
+void OdbcStore::queue()
+{
+  if( !m_pending )
+  {
+    m_batchStart = LatencyHistogram::now();
+    if( m_pTimer ) m_pTimer->arm();
+  }
+  m_pending = true;
+}
+
+void OdbcStore::flushIfDue() EXCEPT ( IOException )
+{
+  if( m_batchSize <= 1 || m_batchCount >= m_batchSize || ( m_batchInterval
+      && LatencyHistogram::now() - m_batchStart >= m_batchInterval ) )
+    flush();
+}
+
+void OdbcStore::onTimer( void* p )
+{
+  OdbcStore* pStore = static_cast < OdbcStore* > ( p );
+  Locker l( pStore->m_mutex );
+  // a failed write stays pending, the next write on the session
+  // thread finds it due and reports the error there
+  try { pStore->flush(); }
+  catch( IOException& ) {}
+}
+
 }
 
 #endif
@@ -33,6 +33,8 @@
 
 #include "OdbcConnection.h"
 #include "MessageStore.h"
+#include "FlushTimer.h"
+#include "Mutex.h"
 #include "SessionSettings.h"
 #include <fstream>
 #include <string>
@@ -86,6 +88,7 @@ public:
   ~OdbcStore();
 
   bool set( int, const std::string& ) EXCEPT ( IOException );
+  // set() queues, so a batch goes out with the next sequence number update
   void get( int, int, std::vector < std::string > & ) const EXCEPT ( IOException );
 
   int getNextSenderMsgSeqNum() const EXCEPT ( IOException );
@@ -100,11 +103,32 @@ public:
   void reset() EXCEPT ( IOException );
   void refresh() EXCEPT ( IOException );
 
+  /// Write messages and sequence numbers in transactions of up to size
+  /// messages, or of whatever is pending once interval milliseconds have
+  /// passed.  A size of 1 writes each message with its sequence number.
+  void setBatch( int size, int interval );
+  /// Write anything pending now
+  void flush() EXCEPT ( IOException );
+
 private:
   void populateCache();
+  void bindSessionID( OdbcStatement& statement ) const;
+  void queue();
+  void flushIfDue() EXCEPT ( IOException );
+  static void onTimer( void* );
 
   OdbcConnection* m_pConnection;
   MemoryStore m_cache;
+  OdbcStatement m_update;
+  OdbcStatement m_insert;
+  OdbcStatement m_updateSeqNums;
+  size_t m_batchCount;
+  bool m_pending;
+  size_t m_batchSize;
+  int64_t m_batchInterval;
+  int64_t m_batchStart;
+  FlushTimer* m_pTimer;
+  mutable Mutex m_mutex;
   SessionID m_sessionID;
 };
 }
@@ -35,7 +35,10 @@
 #include <libpq-fe.h>
 #include "DatabaseConnectionID.h"
 #include "DatabaseConnectionPool.h"
+#include "FieldConvertors.h"
 #include "Mutex.h"
+#include <set>
+#include <vector>
 
 namespace FIX
 {
@@ -43,7 +46,12 @@ class PostgreSQLQuery
 {
 public:
   PostgreSQLQuery( const std::string& query ) 
-  : m_result( 0 ), m_query( query ) 
+  : m_result( 0 ), m_status( PGRES_EMPTY_QUERY ), m_query( query ) 
+  {}
+
+  /// A query prepared once per connection under the given name
+  PostgreSQLQuery( const std::string& name, const std::string& query )
+  : m_result( 0 ), m_status( PGRES_EMPTY_QUERY ), m_name( name ), m_query( query )
   {}
 
   ~PostgreSQLQuery()
@@ -52,19 +60,44 @@ public:
       PQclear( m_result );
   }
 
-  bool execute( PGconn* pConnection )
+  /// Binds the value of the next $n parameter
+  void bind( const std::string& value )
+  {
+    m_parameters.push_back( value );
+  }
+
+  void bind( int value )
   {
-    int retry = 0;
+    m_parameters.push_back( IntConvertor::convert( value ) );
+  }
+
+  /// Appends a quoted element to the body of an array literal
+  static void appendArray( std::string& array, const std::string& value )
+  {
+    array += array.empty() ? "\"" : ",\"";
+    for( std::string::const_iterator i = value.begin(); i != value.end(); ++i )
+    {
+      if( *i == '"' || *i == '\\' ) array += '\\';
+      array += *i;
+    }
+    array += '"';
+  }
+
+  bool execute( PGconn* pConnection, std::set<std::string>& prepared,
+                bool retry = true )
+  {
+    int attempt = 0;
     
     do
     {
       if( m_result ) PQclear( m_result );
-      m_result = PQexec( pConnection, m_query.c_str() );
+      m_result = send( pConnection, prepared );
       m_status = PQresultStatus( m_result );
-      if( success() ) return true;
+      if( success() || !retry ) return success();
       PQreset( pConnection );
-      retry++;
-    } while( retry <= 1 );
+      prepared.clear();
+      attempt++;
+    } while( attempt <= 1 );
     return success();
   }
 
@@ -81,7 +114,7 @@ public:
 
   char* reason()
   {
-    return PQresultErrorMessage( m_result );
+    return m_result ? PQresultErrorMessage( m_result ) : (char*)"";
   }
 
   char* getValue( int row, int column )
@@ -92,13 +125,40 @@ public:
   void throwException() EXCEPT ( IOException )
   {
     if( !success() )
-      throw IOException( "Query failed [" + m_query + "] " );
+      throw IOException( "Query failed [" + m_query + "] " + reason() );
   }
 
 private:
+  PGresult* send( PGconn* pConnection, std::set<std::string>& prepared )
+  {
+    if( m_name.empty() && m_parameters.empty() )
+      return PQexec( pConnection, m_query.c_str() );
+
+    std::vector<const char*> values( m_parameters.size() );
+    for( size_t i = 0; i < m_parameters.size(); ++i )
+      values[ i ] = m_parameters[ i ].c_str();
+    const char* const* pValues = values.empty() ? 0 : &values[ 0 ];
+    int count = (int)values.size();
+
+    if( m_name.empty() )
+      return PQexecParams( pConnection, m_query.c_str(), count, 0, pValues, 0, 0, 0 );
+
+    if( prepared.find( m_name ) == prepared.end() )
+    {
+      PGresult* result = PQprepare
+        ( pConnection, m_name.c_str(), m_query.c_str(), count, 0 );
+      if( PQresultStatus( result ) == PGRES_COMMAND_OK )
+        prepared.insert( m_name );
+      PQclear( result );
+    }
+    return PQexecPrepared( pConnection, m_name.c_str(), count, pValues, 0, 0, 0 );
+  }
+
   PGresult* m_result;
   ExecStatusType m_status;
+  std::string m_name;
   std::string m_query; 
+  std::vector<std::string> m_parameters;
 };
 
 class PostgreSQLConnection
@@ -140,13 +200,98 @@ public:
   {
     Locker locker( m_mutex );
     PQreset( m_pConnection );
+    m_prepared.clear();
     return connected();
   }
 
   bool execute( PostgreSQLQuery& pQuery )
   {
     Locker locker( m_mutex );
-    return pQuery.execute( m_pConnection );
+    return pQuery.execute( m_pConnection, m_prepared );
+  }
+
+  /// Streams rows in COPY text format with the given COPY ... FROM STDIN
+  /// statement.  The rows commit together or, with reason set, not at all.
+  bool copy( const std::string& statement, const std::string& rows,
+             std::string& reason )
+  {
+    Locker locker( m_mutex );
+
+    for( int attempt = 0; attempt <= 1; ++attempt )
+    {
+      if( attempt )
+      {
+        PQreset( m_pConnection );
+        m_prepared.clear();
+      }
+
+      PGresult* result = PQexec( m_pConnection, statement.c_str() );
+      bool started = PQresultStatus( result ) == PGRES_COPY_IN;
+      if( !started ) reason = PQresultErrorMessage( result );
+      PQclear( result );
+      if( !started ) continue;
+
+      bool sent = PQputCopyData
+        ( m_pConnection, rows.data(), (int)rows.size() ) == 1;
+      if( PQputCopyEnd( m_pConnection, sent ? 0 : "send failed" ) != 1 )
+        sent = false;
+      if( !sent ) reason = PQerrorMessage( m_pConnection );
+
+      bool copied = sent;
+      while( ( result = PQgetResult( m_pConnection ) ) )
+      {
+        if( PQresultStatus( result ) != PGRES_COMMAND_OK )
+        {
+          reason = PQresultErrorMessage( result );
+          copied = false;
+        }
+        PQclear( result );
+      }
+      if( copied ) return true;
+    }
+    return false;
+  }
+
+  /// Runs the queries in one transaction, keeping none of them if any fails
+  void transaction( const std::vector<PostgreSQLQuery*>& queries )
+  EXCEPT ( IOException )
+  {
+    Locker locker( m_mutex );
+
+    if( queries.size() == 1 )
+    {
+      if( !queries[ 0 ]->execute( m_pConnection, m_prepared ) )
+        queries[ 0 ]->throwException();
+      return;
+    }
+
+    for( int attempt = 0; ; ++attempt )
+    {
+      PostgreSQLQuery begin( "BEGIN" );
+      PostgreSQLQuery commit( "COMMIT" );
+      PostgreSQLQuery* pFailed = &begin;
+
+      if( begin.execute( m_pConnection, m_prepared, false ) )
+      {
+        pFailed = 0;
+        for( size_t i = 0; !pFailed && i < queries.size(); ++i )
+        {
+          if( !queries[ i ]->execute( m_pConnection, m_prepared, false ) )
+            pFailed = queries[ i ];
+        }
+        if( !pFailed && !commit.execute( m_pConnection, m_prepared, false ) )
+          pFailed = &commit;
+        if( !pFailed )
+          return;
+      }
+
+      PostgreSQLQuery rollback( "ROLLBACK" );
+      rollback.execute( m_pConnection, m_prepared, false );
+      if( attempt > 0 || PQstatus( m_pConnection ) == CONNECTION_OK )
+        pFailed->throwException();
+      PQreset( m_pConnection );
+      m_prepared.clear();
+    }
   }
 
 private:
@@ -164,6 +309,7 @@ private:
   PGconn* m_pConnection;
   DatabaseConnectionID m_connectionID;
   Mutex m_mutex;
+  std::set<std::string> m_prepared;
 };
 
 typedef DatabaseConnectionPool<PostgreSQLConnection>
@@ -29,6 +29,7 @@
 #include "SessionID.h"
 #include "SessionSettings.h"
 #include "Utility.h"
+#include "LatencyHistogram.h"
 #include "strptime.h"
 #include <fstream>
 
@@ -41,6 +42,192 @@ const std::string PostgreSQLLogFactory::DEFAULT_PASSWORD = "";
 const std::string PostgreSQLLogFactory::DEFAULT_HOST = "localhost";
 const short PostgreSQLLogFactory::DEFAULT_PORT = 0;
 
+PostgreSQLLogWriter::PostgreSQLLogWriter
+( const DatabaseConnectionID& d, size_t bufferSize, int interval )
+: m_connection( d ), m_bufferSize( bufferSize ), m_pendingBytes( 0 ),
+  m_interval( (int64_t)interval * 1000000 ), m_oldest( 0 ),
+  m_lastWrite( LatencyHistogram::now() ), m_stop( false )
+{
+  m_stats.written = 0;
+  m_stats.dropped = 0;
+  m_stats.failed = 0;
+  m_stats.commits = 0;
+  m_stats.pendingBytes = 0;
+  m_stats.lag = 0;
+  m_stats.lastLatency = 0;
+
+  if( !thread_spawn( &writerThread, this, m_thread ) )
+    throw ConfigError( "Unable to spawn PostgreSQL log writer thread" );
+}
+
+PostgreSQLLogWriter::~PostgreSQLLogWriter()
+{
+  {
+    Locker locker( m_mutex );
+    m_stop = true;
+  }
+  m_event.signal();
+  thread_join( m_thread );
+}
+
+bool PostgreSQLLogWriter::add
+( const std::string& table, const SessionID* pSessionID, const std::string& value )
+{
+  UtcTimeStamp time;
+  int year, month, day, hour, minute, second, millis;
+  time.getYMD( year, month, day );
+  time.getHMS( hour, minute, second, millis );
+
+  char sqlTime[ 24 ];
+  STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d.%03d",
+           year, month, day, hour, minute, second, millis );
+
+  Locker locker( m_mutex );
+
+  Buffer& buffer = m_buffers[ table ];
+  size_t size = buffer.data.size();
+  buffer.data += sqlTime;
+  if( pSessionID )
+  {
+    buffer.data += '\t';
+    appendCopyValue( buffer.data, pSessionID->getBeginString().getValue() );
+    buffer.data += '\t';
+    appendCopyValue( buffer.data, pSessionID->getSenderCompID().getValue() );
+    buffer.data += '\t';
+    appendCopyValue( buffer.data, pSessionID->getTargetCompID().getValue() );
+    buffer.data += '\t';
+    if( pSessionID->getSessionQualifier() == "" )
+      buffer.data += "\\N";
+    else
+      appendCopyValue( buffer.data, pSessionID->getSessionQualifier() );
+  }
+  else
+  {
+    buffer.data += "\t\\N\t\\N\t\\N\t\\N";
+  }
+  buffer.data += '\t';
+  appendCopyValue( buffer.data, value );
+  buffer.data += '\n';
+
+  size_t added = buffer.data.size() - size;
+  if( m_pendingBytes + added > m_bufferSize )
+  {
+    buffer.data.resize( size );
+    ++m_stats.dropped;
+    return false;
+  }
+
+  // the writer thread sleeps until there is something to write
+  // or enough of it to write before the interval is up
+  bool wake = !m_pendingBytes
+    || ( m_pendingBytes < m_bufferSize / 2 && m_pendingBytes + added >= m_bufferSize / 2 );
+  if( !m_pendingBytes )
+    m_oldest = LatencyHistogram::now();
+  m_pendingBytes += added;
+  ++buffer.rows;
+  if( wake ) m_event.signal();
+  return true;
+}
+
+void PostgreSQLLogWriter::flush()
+{
+  write();
+}
+
+void PostgreSQLLogWriter::getStats( Stats& stats ) const
+{
+  Locker locker( m_mutex );
+  stats = m_stats;
+  stats.pendingBytes = m_pendingBytes;
+  stats.lag = m_pendingBytes ? LatencyHistogram::now() - m_oldest : 0;
+}
+
+void PostgreSQLLogWriter::appendCopyValue( std::string& row, const std::string& value )
+{
+  for( std::string::const_iterator i = value.begin(); i != value.end(); ++i )
+  {
+    switch( *i )
+    {
+    case '\\': row += "\\\\"; break;
+    case '\t': row += "\\t"; break;
+    case '\n': row += "\\n"; break;
+    case '\r': row += "\\r"; break;
+    default: row += *i;
+    }
+  }
+}
+
+THREAD_PROC PostgreSQLLogWriter::writerThread( void* p )
+{
+  static_cast < PostgreSQLLogWriter* > ( p )->run();
+  return 0;
+}
+
+void PostgreSQLLogWriter::run()
+{
+  for( ;; )
+  {
+    bool due = false;
+    double wait = m_interval / 1e9;
+    {
+      Locker locker( m_mutex );
+      if( m_stop ) break;
+      if( m_pendingBytes )
+      {
+        int64_t left = m_interval - ( LatencyHistogram::now() - m_lastWrite );
+        due = m_pendingBytes >= m_bufferSize / 2 || left <= 0;
+        wait = left / 1e9;
+      }
+    }
+
+    if( due )
+      write();
+    else
+      m_event.wait( wait );
+  }
+
+  write();
+}
+
+void PostgreSQLLogWriter::write()
+{
+  Locker writing( m_writeMutex );
+
+  Buffers buffers;
+  int64_t oldest;
+  {
+    Locker locker( m_mutex );
+    buffers.swap( m_buffers );
+    oldest = m_oldest;
+    m_pendingBytes = 0;
+    m_lastWrite = LatencyHistogram::now();
+  }
+
+  for( Buffers::const_iterator i = buffers.begin(); i != buffers.end(); ++i )
+  {
+    if( !i->second.rows ) continue;
+
+    std::string statement = "COPY " + i->first
+      + " (time, beginstring, sendercompid, targetcompid, session_qualifier, text)"
+      + " FROM STDIN";
+    std::string reason;
+    bool copied = m_connection.copy( statement, i->second.data, reason );
+
+    Locker locker( m_mutex );
+    if( copied )
+    {
+      m_stats.written += i->second.rows;
+      ++m_stats.commits;
+      m_stats.lastLatency = LatencyHistogram::now() - oldest;
+    }
+    else
+    {
+      m_stats.failed += i->second.rows;
+      m_lastError = reason;
+    }
+  }
+}
+
 PostgreSQLLog::PostgreSQLLog
 ( const SessionID& s, const DatabaseConnectionID& d, PostgreSQLConnectionPool* p )
 : m_pConnectionPool( p )
@@ -79,6 +266,11 @@ PostgreSQLLog::PostgreSQLLog
 
 void PostgreSQLLog::init()
 {
+  m_pWriter = 0;
+  m_batchCount = 0;
+  m_batchSize = 1;
+  m_batchInterval = 0;
+  m_batchStart = 0;
   setIncomingTable( "messages_log" );
   setOutgoingTable( "messages_log" );
   setEventTable( "event_log" );
@@ -86,6 +278,7 @@ void PostgreSQLLog::init()
 
 PostgreSQLLog::~PostgreSQLLog()
 {
+  flush();
   if( m_pConnectionPool )
     m_pConnectionPool->destroy( m_pConnection );
   else
@@ -104,7 +297,7 @@ Log* PostgreSQLLogFactory::create()
   init( m_settings.get(), database, user, password, host, port );
   DatabaseConnectionID id( database, user, password, host, port );
   PostgreSQLLog* result = new PostgreSQLLog( id, m_connectionPoolPtr.get() );
-  initLog( m_settings.get(), *result );
+  initLog( m_settings.get(), id, *result );
   return result;
 }
 
@@ -123,7 +316,7 @@ Log* PostgreSQLLogFactory::create( const SessionID& s )
   init( settings, database, user, password, host, port );
   DatabaseConnectionID id( database, user, password, host, port );
   PostgreSQLLog* result = new PostgreSQLLog( s, id, m_connectionPoolPtr.get() );
-  initLog( settings, *result );
+  initLog( settings, id, *result );
   return result;
 }
 
@@ -167,8 +360,45 @@ void PostgreSQLLogFactory::init( const Dictionary& settings,
   }
 }
 
-void PostgreSQLLogFactory::initLog( const Dictionary& settings, PostgreSQLLog& log )
+void PostgreSQLLogFactory::initLog( const Dictionary& settings,
+                                    const DatabaseConnectionID& id,
+                                    PostgreSQLLog& log )
 {
+  bool copy = false;
+  try { copy = settings.getBool( POSTGRESQL_LOG_COPY ); }
+  catch( ConfigError& ) {}
+
+  if( copy )
+  {
+    // One writer serves every log on the same connection
+    PostgreSQLLogWriter*& pWriter = m_writers[ id ];
+    if( !pWriter )
+    {
+      int bufferSize = 64 * 1024 * 1024;
+      int interval = 100;
+
+      try { bufferSize = settings.getInt( POSTGRESQL_LOG_COPY_BUFFER_SIZE ); }
+      catch( ConfigError& ) {}
+
+      try { interval = settings.getInt( POSTGRESQL_LOG_COPY_INTERVAL ); }
+      catch( ConfigError& ) {}
+
+      pWriter = new PostgreSQLLogWriter( id, bufferSize, interval );
+    }
+    log.setWriter( pWriter );
+  }
+
+  int batchSize = 1;
+  int batchInterval = 0;
+
+  try { batchSize = settings.getInt( POSTGRESQL_LOG_BATCH_SIZE ); }
+  catch( ConfigError& ) {}
+
+  try { batchInterval = settings.getInt( POSTGRESQL_LOG_BATCH_INTERVAL ); }
+  catch( ConfigError& ) {}
+
+  log.setBatch( batchSize, batchInterval );
+
   try { log.setIncomingTable( settings.getString( POSTGRESQL_LOG_INCOMING_TABLE ) ); }
   catch( ConfigError& ) {}
 
@@ -184,6 +414,18 @@ void PostgreSQLLogFactory::destroy( Log* pLog )
   delete pLog;
 }
 
+PostgreSQLLogFactory::~PostgreSQLLogFactory()
+{
+  for( Writers::iterator i = m_writers.begin(); i != m_writers.end(); ++i )
+    delete i->second;
+}
+
+PostgreSQLLogWriter* PostgreSQLLogFactory::getWriter( const DatabaseConnectionID& id )
+{
+  Writers::iterator i = m_writers.find( id );
+  return i == m_writers.end() ? 0 : i->second;
+}
+
 void PostgreSQLLog::clear()
 {
   std::stringstream whereClause;
@@ -216,6 +458,9 @@ void PostgreSQLLog::clear()
   eventQuery 
     << "DELETE FROM " << m_eventTable << " " << whereClause.str();
 
+  m_batch.clear();
+  m_batchCount = 0;
+
   PostgreSQLQuery incoming( incomingQuery.str() );
   PostgreSQLQuery outgoing( outgoingQuery.str() );
   PostgreSQLQuery event( eventQuery.str() );
@@ -228,8 +473,68 @@ void PostgreSQLLog::backup()
 {
 }
 
+void PostgreSQLLog::setBatch( int size, int interval )
+{
+  m_batchSize = size > 1 ? size : 1;
+  m_batchInterval = (int64_t)interval * 1000000;
+}
+
+void PostgreSQLLog::flush()
+{
+  if( !m_batchCount ) return;
+
+  std::string beginString;
+  std::string senderCompID;
+  std::string targetCompID;
+  std::string qualifier;
+  if( m_pSessionID )
+  {
+    beginString = m_pSessionID->getBeginString().getValue();
+    senderCompID = m_pSessionID->getSenderCompID().getValue();
+    targetCompID = m_pSessionID->getTargetCompID().getValue();
+    qualifier = m_pSessionID->getSessionQualifier();
+  }
+
+  std::vector<PostgreSQLQuery*> queries;
+  for( Batch::const_iterator i = m_batch.begin(); i != m_batch.end(); ++i )
+  {
+    // Empty session fields are written as NULL
+    std::stringstream queryString;
+    queryString << "INSERT INTO " << i->first << " "
+    << "(time, beginstring, sendercompid, targetcompid, session_qualifier, text) "
+    << "SELECT batch.time::timestamp, NULLIF($1::text, ''), NULLIF($2::text, ''), "
+    << "NULLIF($3::text, ''), NULLIF($4::text, ''), batch.text "
+    << "FROM unnest($5::text[], $6::text[]) AS batch(time, text)";
+
+    PostgreSQLQuery* pQuery = new PostgreSQLQuery
+      ( "quickfix_log_" + i->first, queryString.str() );
+    pQuery->bind( beginString );
+    pQuery->bind( senderCompID );
+    pQuery->bind( targetCompID );
+    pQuery->bind( qualifier );
+    pQuery->bind( "{" + i->second.first + "}" );
+    pQuery->bind( "{" + i->second.second + "}" );
+    queries.push_back( pQuery );
+  }
+
+  m_batch.clear();
+  m_batchCount = 0;
+
+  try { m_pConnection->transaction( queries ); }
+  catch( IOException& ) {}
+
+  for( size_t i = 0; i < queries.size(); ++i )
+    delete queries[ i ];
+}
+
 void PostgreSQLLog::insert( const std::string& table, const std::string value )
 {
+  if( m_pWriter )
+  {
+    m_pWriter->add( table, m_pSessionID, value );
+    return;
+  }
+
   UtcTimeStamp time;
   int year, month, day, hour, minute, second, millis;
   time.getYMD( year, month, day );
@@ -238,37 +543,18 @@ void PostgreSQLLog::insert( const std::string& table, const std::string value )
   char sqlTime[ 24 ];
   STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d.%003d",
            year, month, day, hour, minute, second, millis );
-  
-  char* valueCopy = new char[ (value.size() * 2) + 1 ];
-  PQescapeString( valueCopy, value.c_str(), value.size() );
-
-  std::stringstream queryString;
-  queryString << "INSERT INTO " << table << " "
-  << "(time, beginstring, sendercompid, targetcompid, session_qualifier, text) "
-  << "VALUES ("
-  << "'" << sqlTime << "',";
 
-  if( m_pSessionID )
-  {
-    queryString
-    << "'" << m_pSessionID->getBeginString().getValue() << "',"
-    << "'" << m_pSessionID->getSenderCompID().getValue() << "',"
-    << "'" << m_pSessionID->getTargetCompID().getValue() << "',";
-    if( m_pSessionID->getSessionQualifier() == "" )
-      queryString << "NULL" << ",";
-    else
-      queryString << "'" << m_pSessionID->getSessionQualifier() << "',";
-  }
-  else
-  {
-    queryString << "NULL, NULL, NULL, NULL, ";
-  }
+  if( !m_batchCount )
+    m_batchStart = LatencyHistogram::now();
 
-  queryString << "'" << valueCopy << "')";
-  delete [] valueCopy;
+  std::pair<std::string, std::string>& entries = m_batch[ table ];
+  PostgreSQLQuery::appendArray( entries.first, sqlTime );
+  PostgreSQLQuery::appendArray( entries.second, value );
+  ++m_batchCount;
 
-  PostgreSQLQuery query( queryString.str() );
-  m_pConnection->execute( query );
+  if( m_batchCount >= m_batchSize || ( m_batchInterval
+      && LatencyHistogram::now() - m_batchStart >= m_batchInterval ) )
+    flush();
 }
 
 } // namespace FIX
@@ -34,11 +34,90 @@
 #include "Log.h"
 #include "SessionSettings.h"
 #include "PostgreSQLConnection.h"
+#include "Utility.h"
+#include "Mutex.h"
+#include "AutoResetEvent.h"
 #include <fstream>
 #include <string>
+#include <map>
 
 namespace FIX
 {
+/**
+ * Streams log entries into PostgreSQL with COPY from a background thread.
+ *
+ * Entries are formatted as COPY rows on the logging thread and appended
+ * to a buffer per table.  Every interval, or as soon as half the buffer
+ * is used, the writer thread takes the buffers and copies each one in a
+ * single transaction.  Entries that
+ * would grow the buffers past their size are dropped and counted.
+ */
+class PostgreSQLLogWriter
+{
+public:
+  struct Stats
+  {
+    /// Entries committed to the database
+    uint64_t written;
+    /// Entries refused because the buffers were full
+    uint64_t dropped;
+    /// Entries lost to COPY failures
+    uint64_t failed;
+    /// COPY transactions committed
+    uint64_t commits;
+    /// Bytes waiting to be written
+    size_t pendingBytes;
+    /// Nanoseconds the oldest waiting entry has been queued
+    int64_t lag;
+    /// Nanoseconds the oldest entry of the last write waited to commit
+    int64_t lastLatency;
+  };
+
+  /// bufferSize is in bytes and interval in milliseconds
+  PostgreSQLLogWriter( const DatabaseConnectionID& d, size_t bufferSize, int interval );
+  ~PostgreSQLLogWriter();
+
+  /// Queues an entry, or counts it as dropped and returns false
+  bool add( const std::string& table, const SessionID* pSessionID,
+            const std::string& value );
+  /// Writes everything queued so far before returning
+  void flush();
+  void getStats( Stats& stats ) const;
+  std::string getLastError() const
+  { Locker locker( m_mutex ); return m_lastError; }
+
+  /// Appends a value escaped for the COPY text format
+  static void appendCopyValue( std::string& row, const std::string& value );
+
+private:
+  struct Buffer
+  {
+    Buffer() : rows( 0 ) {}
+    std::string data;
+    size_t rows;
+  };
+  typedef std::map < std::string, Buffer > Buffers;
+
+  static THREAD_PROC writerThread( void* p );
+  void run();
+  void write();
+
+  PostgreSQLConnection m_connection;
+  Buffers m_buffers;
+  size_t m_bufferSize;
+  size_t m_pendingBytes;
+  int64_t m_interval;
+  int64_t m_oldest;
+  int64_t m_lastWrite;
+  Stats m_stats;
+  std::string m_lastError;
+  bool m_stop;
+  thread_id m_thread;
+  mutable Mutex m_mutex;
+  Mutex m_writeMutex;
+  AutoResetEvent m_event;
+};
+
 /// PostgreSQL based implementation of Log.
 class PostgreSQLLog : public Log
 {
@@ -60,6 +139,9 @@ public:
   { m_outgoingTable = outgoingTable; }
   void setEventTable( const std::string& eventTable )
   { m_eventTable = eventTable; }
+  /// Queue entries on writer instead of inserting them
+  void setWriter( PostgreSQLLogWriter* pWriter )
+  { m_pWriter = pWriter; }
 
   void onIncoming( const std::string& value )
   { insert( m_incomingTable, value ); }
@@ -68,10 +150,25 @@ public:
   void onEvent( const std::string& value )
   { insert( m_eventTable, value ); }
 
+  /// Write entries in transactions of up to size entries, or of whatever
+  /// is pending once interval milliseconds have passed.
+  void setBatch( int size, int interval );
+  /// Write anything pending now
+  void flush();
+
 private:
+  /// Array literal bodies of the times and texts pending for one table
+  typedef std::map < std::string, std::pair < std::string, std::string > > Batch;
+
   void init();
   void insert( const std::string& table, const std::string value );
 
+  PostgreSQLLogWriter* m_pWriter;
+  Batch m_batch;
+  size_t m_batchCount;
+  size_t m_batchSize;
+  int64_t m_batchInterval;
+  int64_t m_batchStart;
   std::string m_incomingTable;
   std::string m_outgoingTable;
   std::string m_eventTable;
@@ -119,17 +216,27 @@ public:
       ( new PostgreSQLConnectionPool(false) );
   }
 
+  ~PostgreSQLLogFactory();
+
   Log* create();
   Log* create( const SessionID& );
   void destroy( Log* );
+
+  /// The COPY writer shared by the logs on a database connection,
+  /// if PostgreSQLLogCopy is enabled for them
+  PostgreSQLLogWriter* getWriter( const DatabaseConnectionID& id );
 private:
+  typedef std::map < DatabaseConnectionID, PostgreSQLLogWriter* > Writers;
+
   void init( const Dictionary& settings, std::string& database,
              std::string& user, std::string& password,
              std::string& host, short& port );
 
-  void initLog( const Dictionary& settings, PostgreSQLLog& log );
+  void initLog( const Dictionary& settings, const DatabaseConnectionID& id,
+                PostgreSQLLog& log );
 
   PostgreSQLConnectionPoolPtr m_connectionPoolPtr;
+  Writers m_writers;
   SessionSettings m_settings;
   std::string m_database;
   std::string m_user;
@@ -31,6 +31,7 @@
 #include "FieldConvertors.h"
 #include "Parser.h"
 #include "Utility.h"
+#include "LatencyHistogram.h"
 #include "strptime.h"
 #include <fstream>
 
@@ -43,9 +44,35 @@ const std::string PostgreSQLStoreFactory::DEFAULT_PASSWORD = "";
 const std::string PostgreSQLStoreFactory::DEFAULT_HOST = "localhost";
 const short PostgreSQLStoreFactory::DEFAULT_PORT = 0;
 
+static const char INSERT_MESSAGES[] =
+  "INSERT INTO messages (beginstring, sendercompid, targetcompid, "
+  "session_qualifier, msgseqnum, message) "
+  "SELECT $1::text, $2::text, $3::text, $4::text, batch.msgseqnum, batch.message "
+  "FROM unnest($5::integer[], $6::text[]) AS batch(msgseqnum, message) "
+  "ON CONFLICT (beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum) "
+  "DO UPDATE SET message=EXCLUDED.message";
+
+static const char UPDATE_SEQNUMS[] =
+  "UPDATE sessions SET incoming_seqnum=$5, outgoing_seqnum=$6 WHERE "
+  "beginstring=$1 and sendercompid=$2 and targetcompid=$3 and session_qualifier=$4";
+
+static const char SELECT_MESSAGES[] =
+  "SELECT message FROM messages WHERE "
+  "beginstring=$1 and sendercompid=$2 and targetcompid=$3 and session_qualifier=$4 and "
+  "msgseqnum>=$5 and msgseqnum<=$6 ORDER BY msgseqnum";
+
+static const char DELETE_MESSAGES[] =
+  "DELETE FROM messages WHERE "
+  "beginstring=$1 and sendercompid=$2 and targetcompid=$3 and session_qualifier=$4";
+
+static const char RESET_SESSION[] =
+  "UPDATE sessions SET creation_time=$5, incoming_seqnum=$6, outgoing_seqnum=$7 WHERE "
+  "beginstring=$1 and sendercompid=$2 and targetcompid=$3 and session_qualifier=$4";
+
 PostgreSQLStore::PostgreSQLStore
 ( const SessionID& s, const DatabaseConnectionID& d, PostgreSQLConnectionPool* p )
-: m_pConnectionPool( p ), m_sessionID( s )
+: m_pending( false ), m_batchSize( 1 ), m_batchInterval( 0 ), m_batchStart( 0 ), m_pTimer( 0 ),
+  m_pConnectionPool( p ), m_sessionID( s )
 {
   m_pConnection = m_pConnectionPool->create( d );
   populateCache();
@@ -54,7 +81,8 @@ PostgreSQLStore::PostgreSQLStore
 PostgreSQLStore::PostgreSQLStore
 ( const SessionID& s, const std::string& database, const std::string& user,
   const std::string& password, const std::string& host, short port )
-  : m_pConnectionPool( 0 ), m_sessionID( s )
+  : m_pending( false ), m_batchSize( 1 ), m_batchInterval( 0 ), m_batchStart( 0 ), m_pTimer( 0 ),
+    m_pConnectionPool( 0 ), m_sessionID( s )
 {
   m_pConnection = new PostgreSQLConnection( database, user, password, host, port );
   populateCache();
@@ -62,6 +90,13 @@ PostgreSQLStore::PostgreSQLStore
 
 PostgreSQLStore::~PostgreSQLStore()
 {
+  // stopped first, the timer calls back under the lock
+  delete m_pTimer;
+  // Session flushes and logs a failure itself, this only covers
+  // stores that are used without one
+  try { flush(); }
+  catch( IOException& ) {}
+
   if( m_pConnectionPool )
     m_pConnectionPool->destroy( m_pConnection );
   else
@@ -157,8 +192,19 @@ MessageStore* PostgreSQLStoreFactory::create( const SessionID& s, const Dictiona
   try { port = ( short ) settings.getInt( POSTGRESQL_STORE_PORT ); }
   catch( ConfigError& ) {}
 
+  int batchSize = 1;
+  int batchInterval = 0;
+
+  try { batchSize = settings.getInt( POSTGRESQL_STORE_BATCH_SIZE ); }
+  catch( ConfigError& ) {}
+
+  try { batchInterval = settings.getInt( POSTGRESQL_STORE_BATCH_INTERVAL ); }
+  catch( ConfigError& ) {}
+
   DatabaseConnectionID id( database, user, password, host, port );
-  return new PostgreSQLStore( s, id, m_connectionPoolPtr.get() );
+  PostgreSQLStore* pStore = new PostgreSQLStore( s, id, m_connectionPoolPtr.get() );
+  pStore->setBatch( batchSize, batchInterval );
+  return pStore;
 }
 
 void PostgreSQLStoreFactory::destroy( MessageStore* pStore )
@@ -169,37 +215,18 @@ void PostgreSQLStoreFactory::destroy( MessageStore* pStore )
 bool PostgreSQLStore::set( int msgSeqNum, const std::string& msg )
 EXCEPT ( IOException )
 {
-  char* msgCopy = new char[ (msg.size() * 2) + 1 ];
-  PQescapeString( msgCopy, msg.c_str(), msg.size() );
-
-  std::stringstream queryString;
-  queryString << "INSERT INTO messages "
-  << "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
-  << "VALUES ("
-  << "'" << m_sessionID.getBeginString().getValue() << "',"
-  << "'" << m_sessionID.getSenderCompID().getValue() << "',"
-  << "'" << m_sessionID.getTargetCompID().getValue() << "',"
-  << "'" << m_sessionID.getSessionQualifier() << "',"
-  << msgSeqNum << ","
-  << "'" << msgCopy << "')";
-
-  delete [] msgCopy;
-
-  PostgreSQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
+  Locker l( m_mutex );
+  queue();
+  // ON CONFLICT can not touch the same row twice in one insert
+  for( Batch::iterator i = m_batch.begin(); i != m_batch.end(); ++i )
   {
-    std::stringstream queryString2;
-    queryString2 << "UPDATE messages SET message='" << msg << "' WHERE "
-    << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-    << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-    << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-    << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "' and "
-    << "msgseqnum=" << msgSeqNum;
-    PostgreSQLQuery query2( queryString2.str() );
-    if( !m_pConnection->execute(query2) )
-      query2.throwException();
+    if( i->first != msgSeqNum ) continue;
+    i->second = msg;
+    return true;
   }
-
+  m_batch.push_back( std::make_pair( msgSeqNum, msg ) );
+  // a batch size of 1 writes the message through
+  flushIfDue();
   return true;
 }
 
@@ -207,17 +234,15 @@ void PostgreSQLStore::get( int begin, int end,
                       std::vector < std::string > & result ) const
 EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
+  const_cast<PostgreSQLStore*>( this )->flush();
+
   result.clear();
-  std::stringstream queryString;
-  queryString << "SELECT message FROM messages WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "' and "
-  << "msgseqnum>=" << begin << " and " << "msgseqnum<=" << end << " "
-  << "ORDER BY msgseqnum";
+  PostgreSQLQuery query( "quickfix_store_select", SELECT_MESSAGES );
+  bindSessionID( query );
+  query.bind( begin );
+  query.bind( end );
 
-  PostgreSQLQuery query( queryString.str() );
   if( !m_pConnection->execute(query) )
     query.throwException();
 
@@ -228,76 +253,59 @@ EXCEPT ( IOException )
 
 int PostgreSQLStore::getNextSenderMsgSeqNum() const EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
   return m_cache.getNextSenderMsgSeqNum();
 }
 
 int PostgreSQLStore::getNextTargetMsgSeqNum() const EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
   return m_cache.getNextTargetMsgSeqNum();
 }
 
 void PostgreSQLStore::setNextSenderMsgSeqNum( int value ) EXCEPT ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET outgoing_seqnum=" << value << " WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "'";
-
-  PostgreSQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
-
+  Locker l( m_mutex );
+  queue();
   m_cache.setNextSenderMsgSeqNum( value );
+  flush();
 }
 
 void PostgreSQLStore::setNextTargetMsgSeqNum( int value ) EXCEPT ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET incoming_seqnum=" << value << " WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "'";
-
-  PostgreSQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
-
+  Locker l( m_mutex );
+  queue();
   m_cache.setNextTargetMsgSeqNum( value );
+  flush();
 }
 
 void PostgreSQLStore::incrNextSenderMsgSeqNum() EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
+  queue();
   m_cache.incrNextSenderMsgSeqNum();
-  setNextSenderMsgSeqNum( m_cache.getNextSenderMsgSeqNum() );
+  flushIfDue();
 }
 
 void PostgreSQLStore::incrNextTargetMsgSeqNum() EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
+  queue();
   m_cache.incrNextTargetMsgSeqNum();
-  setNextTargetMsgSeqNum( m_cache.getNextTargetMsgSeqNum() );
+  flushIfDue();
 }
 
 UtcTimeStamp PostgreSQLStore::getCreationTime() const EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
   return m_cache.getCreationTime();
 }
 
 void PostgreSQLStore::reset() EXCEPT ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "DELETE FROM messages WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "'";
-
-  PostgreSQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
-
+  Locker l( m_mutex );
+  m_batch.clear();
+  m_pending = false;
   m_cache.reset();
   UtcTimeStamp time = m_cache.getCreationTime();
 
@@ -309,26 +317,111 @@ void PostgreSQLStore::reset() EXCEPT ( IOException )
   STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d",
            year, month, day, hour, minute, second );
 
-  std::stringstream queryString2;
-  queryString2 << "UPDATE sessions SET creation_time='" << sqlTime << "', "
-  << "incoming_seqnum=" << m_cache.getNextTargetMsgSeqNum() << ", "
-  << "outgoing_seqnum=" << m_cache.getNextSenderMsgSeqNum() << " WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "'";
+  PostgreSQLQuery query( "quickfix_store_delete", DELETE_MESSAGES );
+  bindSessionID( query );
 
-  PostgreSQLQuery query2( queryString2.str() );
-  if( !m_pConnection->execute(query2) )
-    query2.throwException();
+  PostgreSQLQuery query2( "quickfix_store_reset", RESET_SESSION );
+  bindSessionID( query2 );
+  query2.bind( sqlTime );
+  query2.bind( m_cache.getNextTargetMsgSeqNum() );
+  query2.bind( m_cache.getNextSenderMsgSeqNum() );
+
+  std::vector<PostgreSQLQuery*> queries;
+  queries.push_back( &query );
+  queries.push_back( &query2 );
+  m_pConnection->transaction( queries );
 }
 
 void PostgreSQLStore::refresh() EXCEPT ( IOException )
 {
+  Locker l( m_mutex );
+  flush();
   m_cache.reset();
   populateCache(); 
 }
 
+void PostgreSQLStore::setBatch( int size, int interval )
+{
+  delete m_pTimer;
+  m_pTimer = 0;
+
+  Locker l( m_mutex );
+  m_batchSize = size > 1 ? size : 1;
+  m_batchInterval = (int64_t)interval * 1000000;
+  if( m_batchSize > 1 && interval > 0 )
+    m_pTimer = new FlushTimer( &onTimer, this, interval );
+}
+
+void PostgreSQLStore::flush() EXCEPT ( IOException )
+{
+  Locker l( m_mutex );
+  if( !m_pending ) return;
+
+  std::vector<PostgreSQLQuery*> queries;
+  PostgreSQLQuery insert( "quickfix_store_insert", INSERT_MESSAGES );
+  if( m_batch.size() )
+  {
+    std::string seqNums;
+    std::string messages;
+    for( Batch::const_iterator i = m_batch.begin(); i != m_batch.end(); ++i )
+    {
+      if( seqNums.size() ) seqNums += ',';
+      seqNums += IntConvertor::convert( i->first );
+      PostgreSQLQuery::appendArray( messages, i->second );
+    }
+
+    bindSessionID( insert );
+    insert.bind( "{" + seqNums + "}" );
+    insert.bind( "{" + messages + "}" );
+    queries.push_back( &insert );
+  }
+
+  PostgreSQLQuery update( "quickfix_store_seqnums", UPDATE_SEQNUMS );
+  bindSessionID( update );
+  update.bind( m_cache.getNextTargetMsgSeqNum() );
+  update.bind( m_cache.getNextSenderMsgSeqNum() );
+  queries.push_back( &update );
+
+  m_pConnection->transaction( queries );
+  m_batch.clear();
+  m_pending = false;
+}
+
+void PostgreSQLStore::bindSessionID( PostgreSQLQuery& query ) const
+{
+  query.bind( m_sessionID.getBeginString().getValue() );
+  query.bind( m_sessionID.getSenderCompID().getValue() );
+  query.bind( m_sessionID.getTargetCompID().getValue() );
+  query.bind( m_sessionID.getSessionQualifier() );
+}
+
+void PostgreSQLStore::queue()
+{
+  if( !m_pending )
+  {
+    m_batchStart = LatencyHistogram::now();
+    if( m_pTimer ) m_pTimer->arm();
+  }
+  m_pending = true;
+}
+
+void PostgreSQLStore::flushIfDue() EXCEPT ( IOException )
+{
+  if( m_batchSize <= 1 || m_batch.size() >= m_batchSize || ( m_batchInterval
+      && LatencyHistogram::now() - m_batchStart >= m_batchInterval ) )
+    flush();
+}
+
+void PostgreSQLStore::onTimer( void* p )
+{
+  PostgreSQLStore* pStore = static_cast < PostgreSQLStore* > ( p );
+  Locker l( pStore->m_mutex );
+  // a failed write stays pending, the next write on the session
+  // thread finds it due and reports the error there
+  try { pStore->flush(); }
+  catch( IOException& ) {}
+}
+
 }
 
 #endif
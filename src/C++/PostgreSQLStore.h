@@ -32,6 +32,8 @@
 #endif
 
 #include "MessageStore.h"
+#include "FlushTimer.h"
+#include "Mutex.h"
 #include "SessionSettings.h"
 #include "PostgreSQLConnection.h"
 #include <fstream>
@@ -113,6 +115,7 @@ public:
   ~PostgreSQLStore();
 
   bool set( int, const std::string& ) EXCEPT ( IOException );
+  // set() queues, so a batch goes out with the next sequence number update
   void get( int, int, std::vector < std::string > & ) const EXCEPT ( IOException );
 
   int getNextSenderMsgSeqNum() const EXCEPT ( IOException );
@@ -127,10 +130,30 @@ public:
   void reset() EXCEPT ( IOException );
   void refresh() EXCEPT ( IOException );
 
+  /// Write messages and sequence numbers in transactions of up to size
+  /// messages, or of whatever is pending once interval milliseconds have
+  /// passed.  A size of 1 writes each message with its sequence number.
+  void setBatch( int size, int interval );
+  /// Write anything pending now
+  void flush() EXCEPT ( IOException );
+
 private:
+  typedef std::vector < std::pair < int, std::string > > Batch;
+
   void populateCache();
+  void bindSessionID( PostgreSQLQuery& query ) const;
+  void queue();
+  void flushIfDue() EXCEPT ( IOException );
+  static void onTimer( void* );
 
   MemoryStore m_cache;
+  Batch m_batch;
+  bool m_pending;
+  size_t m_batchSize;
+  int64_t m_batchInterval;
+  int64_t m_batchStart;
+  FlushTimer* m_pTimer;
+  mutable Mutex m_mutex;
   PostgreSQLConnection* m_pConnection;
   PostgreSQLConnectionPool* m_pConnectionPool;
   SessionID m_sessionID;
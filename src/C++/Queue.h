@@ -29,8 +29,8 @@
 
 namespace FIX
 {
-/// A thread safe monitored queue
-template < typename T > class Queue
+/// A thread safe monitored queue, waiting on an Event or AutoResetEvent
+template < typename T, typename E = Event > class Queue
 {
 public:
   void push( const T& value )
@@ -66,7 +66,7 @@ public:
   }
 
 private:
-  Event m_event;
+  E m_event;
   Mutex m_mutex;
   std::queue < T > m_queue;
 };
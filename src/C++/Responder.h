@@ -27,6 +27,7 @@
 #endif
 
 #include <string>
+#include <stddef.h>
 
 namespace FIX
 {
@@ -36,7 +37,28 @@ namespace FIX
   public:
     virtual ~Responder() {}
     virtual bool send( const std::string& ) = 0;
+    /**
+     * Send the concatenation of count buffers.  Transports that can write
+     * them with one gathering call override this, the default copies them
+     * into one string.
+     */
+    virtual bool sendBuffers( const std::string* const* buffers, size_t count )
+    {
+      size_t size = 0;
+      for( size_t i = 0; i < count; ++i )
+        size += buffers[ i ]->size();
+      std::string string;
+      string.reserve( size );
+      for( size_t i = 0; i < count; ++i )
+        string += *buffers[ i ];
+      return send( string );
+    }
     virtual void disconnect() = 0;
+    /// The session deadlines moved, ask it for getNextTimeout() again
+    virtual void reschedule() {}
+    /// Messages and bytes accepted by send() but not yet written
+    virtual void getSendQueue( size_t& messages, size_t& bytes )
+    { messages = 0; bytes = 0; }
   };
 }
 
@@ -140,8 +140,9 @@ SSLSocketAcceptor::SSLSocketAcceptor( Application& application,
                                 MessageStoreFactory& factory,
                                 const SessionSettings& settings ) EXCEPT ( ConfigError )
 : Acceptor( application, factory, settings ),
-  m_pServer( 0 ), m_sslInit(false),
-  m_verify(SSL_CLIENT_VERIFY_NOTSET), m_ctx(0), m_revocationStore(0)
+  m_pServer( 0 ), m_pHandshakePool( 0 ), m_sslInit(false),
+  m_verify(SSL_CLIENT_VERIFY_NOTSET), m_handshakeThreads( 0 ),
+  m_handshakeTimeout( 10 ), m_ctx(0), m_revocationStore(0)
 {
   acceptObj = this;
 }
@@ -151,8 +152,9 @@ SSLSocketAcceptor::SSLSocketAcceptor( Application& application,
                                 const SessionSettings& settings,
                                 LogFactory& logFactory ) EXCEPT ( ConfigError )
 : Acceptor( application, factory, settings, logFactory ),
-  m_pServer( 0 ), m_sslInit(false),
-  m_verify(SSL_CLIENT_VERIFY_NOTSET), m_ctx(0), m_revocationStore(0)
+  m_pServer( 0 ), m_pHandshakePool( 0 ), m_sslInit(false),
+  m_verify(SSL_CLIENT_VERIFY_NOTSET), m_handshakeThreads( 0 ),
+  m_handshakeTimeout( 10 ), m_ctx(0), m_revocationStore(0)
 {
   acceptObj = this;
 }
@@ -163,6 +165,8 @@ SSLSocketAcceptor::~SSLSocketAcceptor()
   for ( iter = m_connections.begin(); iter != m_connections.end(); ++iter )
     delete iter->second;
 
+  delete m_pHandshakePool;
+
   if (m_sslInit)
   {
     SSL_CTX_free(m_ctx);
@@ -185,6 +189,12 @@ EXCEPT ( ConfigError )
     if( settings.has(SOCKET_NODELAY) )
       settings.getBool( SOCKET_NODELAY );
   }
+
+  const Dictionary& dict = s.get();
+  if( dict.has( SSL_HANDSHAKE_THREADS ) )
+    m_handshakeThreads = dict.getInt( SSL_HANDSHAKE_THREADS );
+  if( dict.has( SSL_HANDSHAKE_TIMEOUT ) )
+    m_handshakeTimeout = dict.getInt( SSL_HANDSHAKE_TIMEOUT );
 }
 
 void SSLSocketAcceptor::onInitialize( const SessionSettings& s )
@@ -228,6 +238,9 @@ EXCEPT ( RuntimeError )
 
   short port = 0;
 
+  if( m_handshakeThreads > 0 && !m_pHandshakePool )
+    m_pHandshakePool = new SSLHandshakePool( m_handshakeThreads );
+
   try
   {
     m_pServer = new SocketServer( 1 );
@@ -264,7 +277,9 @@ EXCEPT ( RuntimeError )
 
 void SSLSocketAcceptor::onStart()
 {
-  while ( !isStopped() && m_pServer && m_pServer->block( *this ) ) {}
+  while ( !isStopped() && m_pServer
+          && m_pServer->block( *this, false, m_timers.timeout() ) )
+    onTimeout( *m_pServer );
 
   if( !m_pServer )
     return;
@@ -275,11 +290,16 @@ void SSLSocketAcceptor::onStart()
   ::time( &start );
   while ( isLoggedOn() )
   {
-    m_pServer->block( *this );
+    m_pServer->block( *this, false, m_timers.timeout() );
+    onTimeout( *m_pServer );
     if( ::time(&now) -5 >= start )
       break;
   }
 
+  // workers signal the monitor of the server being closed
+  delete m_pHandshakePool;
+  m_pHandshakePool = 0;
+
   m_pServer->close();
   delete m_pServer;
   m_pServer = 0;
@@ -310,6 +330,7 @@ bool SSLSocketAcceptor::onPoll( double timeout )
   }
 
   m_pServer->block( *this, true, timeout );
+  onTimeout( *m_pServer );
   return true;
 }
 
@@ -326,27 +347,26 @@ void SSLSocketAcceptor::onConnect( SocketServer& server, int a, int s )
   Sessions sessions = m_portToSessions[port];
 
   SSL *ssl = SSL_new(m_ctx);
+  if (ssl == 0)
+  {
+    if( getLog() )
+      getLog()->onEvent( "Failed to create ssl object" );
+    server.getMonitor().drop( s );
+    return;
+  }
   SSL_clear(ssl);
-  BIO *sBio = BIO_new_socket(s, BIO_CLOSE);
-  SSL_set_bio(ssl, sBio, sBio);
   // TODO - check this
   SSL_set_app_data(ssl, m_revocationStore);
   SSL_set_verify_result(ssl, X509_V_OK);
+  SSL_set_accept_state(ssl);
 
-  SSLSocketConnection * sconn = new SSLSocketConnection( s, ssl, sessions, &server.getMonitor() );
-  // SSL accept
-  if (acceptSSLConnection(sconn->getSocket(), sconn->sslObject(), getLog(), m_verify) != 0)
-  {
-    std::stringstream stream;
-    stream << "Failed to accept SSL connection from " << socket_peername( s ) << " on port " << port;
-    if( getLog() )
-      getLog()->onEvent( stream.str() );
-
-    delete sconn;
-    return;
-  }
+  // the handshake is driven by socket events, see SSLSocketConnection::read
+  SSLSocketConnection * sconn = new SSLSocketConnection
+    ( s, ssl, sessions, &server.getMonitor(), getLog(), m_pHandshakePool,
+      m_verify, m_handshakeTimeout );
 
   m_connections[ s ] = sconn;
+  m_timers.schedule( s, sconn->getNextTimeout( UtcTimeStamp() ) );
 
   std::stringstream stream;
   stream << "Accepted SSL connection from " << socket_peername( s ) << " on port " << port;
@@ -362,6 +382,11 @@ void SSLSocketAcceptor::onWrite( SocketServer& server, int s )
   SSLSocketConnection* pSocketConnection = i->second;
   if( pSocketConnection->processQueue() )
     pSocketConnection->unsignal();
+  // the session may have asked for its deadlines to be looked at again
+  m_timers.schedule( s, pSocketConnection->getNextTimeout( UtcTimeStamp() ) );
+  // handshake pool workers signal here when they are done
+  if( !pSocketConnection->getSession() )
+    pSocketConnection->processInput( *this, server );
 }
 
 bool SSLSocketAcceptor::onData( SocketServer& server, int s )
@@ -383,6 +408,7 @@ void SSLSocketAcceptor::onDisconnect( SocketServer&, int s )
 
   delete pSocketConnection;
   m_connections.erase( s );
+  m_timers.cancel( s );
 }
 
 void SSLSocketAcceptor::onError( SocketServer& )
@@ -391,9 +417,18 @@ void SSLSocketAcceptor::onError( SocketServer& )
 
 void SSLSocketAcceptor::onTimeout( SocketServer& )
 {
-  SocketConnections::iterator i;
-  for ( i = m_connections.begin(); i != m_connections.end(); ++i )
-    i->second->onTimeout();
+  UtcTimeStamp now;
+  TimerWheel::Timers timers;
+  m_timers.expire( now, timers );
+
+  TimerWheel::Timers::iterator i;
+  for ( i = timers.begin(); i != timers.end(); ++i )
+  {
+    SocketConnections::iterator j = m_connections.find( *i );
+    if ( j == m_connections.end() ) continue;
+    j->second->onTimeout();
+    m_timers.schedule( *i, j->second->getNextTimeout( now ) );
+  }
 }
 
 int SSLSocketAcceptor::passwordHandleCallback(char *buf, size_t bufsize,
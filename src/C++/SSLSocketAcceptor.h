@@ -126,6 +126,7 @@
 #include "Acceptor.h"
 #include "SocketServer.h"
 #include "SSLSocketConnection.h"
+#include "TimerWheel.h"
 
 namespace FIX
 {
@@ -169,11 +170,15 @@ private:
   void onTimeout( SocketServer& );
 
   SocketServer* m_pServer;
+  SSLHandshakePool* m_pHandshakePool;
   PortToSessions m_portToSessions;
   SocketConnections m_connections;
+  TimerWheel m_timers;
 
   bool m_sslInit;
   int m_verify;
+  int m_handshakeThreads;
+  int m_handshakeTimeout;
   SSL_CTX *m_ctx;
   X509_STORE *m_revocationStore;
   std::string m_password;
@@ -129,37 +129,116 @@
 
 namespace FIX
 {
+SSLHandshakePool::SSLHandshakePool( int threads )
+: m_stop( false )
+{
+  for( int i = 0; i < threads; ++i )
+  {
+    thread_id thread;
+    if( thread_spawn( &workerThread, this, thread ) )
+      m_threads.push_back( thread );
+  }
+}
+
+SSLHandshakePool::~SSLHandshakePool()
+{
+  {
+    Locker l( m_mutex );
+    m_stop = true;
+  }
+  m_queue.signal();
+  for( size_t i = 0; i < m_threads.size(); ++i )
+    thread_join( m_threads[ i ] );
+}
+
+void SSLHandshakePool::add( SSLSocketConnection* pConnection )
+{
+  m_queue.push( pConnection );
+}
+
+THREAD_PROC SSLHandshakePool::workerThread( void* p )
+{
+  static_cast < SSLHandshakePool* > ( p )->run();
+  return 0;
+}
+
+void SSLHandshakePool::run()
+{
+  // connections wait for their queued handshakes, so drain before stopping
+  for( ;; )
+  {
+    SSLSocketConnection* pConnection = 0;
+    if( m_queue.pop( pConnection ) )
+    {
+      // one signal wakes one worker, pass it on while work is left
+      if( m_queue.size() ) m_queue.signal();
+      pConnection->continueHandshake();
+      continue;
+    }
+
+    {
+      Locker l( m_mutex );
+      if( m_stop ) break;
+    }
+    m_queue.wait( 60 );
+  }
+
+  // wake the next worker to see the stop
+  m_queue.signal();
+}
+
 SSLSocketConnection::SSLSocketConnection(int s, SSL *ssl, Sessions sessions,
-                                    SocketMonitor* pMonitor )
-: m_socket( s ), m_ssl(ssl), m_sendLength( 0 ),
-  m_sessions(sessions), m_pSession( 0 ), m_pMonitor( pMonitor )
+                                    SocketMonitor* pMonitor, Log* pLog,
+                                    SSLHandshakePool* pPool, int verify,
+                                    int timeout )
+: m_socket( s ), m_ssl(ssl), m_rbio( 0 ), m_wbio( 0 ),
+  m_sessions(sessions), m_pSession( 0 ), m_pMonitor( pMonitor ),
+  m_pLog( pLog ), m_pPool( pPool ), m_handshake( HANDSHAKE_PENDING ),
+  m_handshakeBusy( false ), m_handshakeLogged( false ), m_signalled( false ),
+  m_verify( verify ), m_deadline( time( 0 ) + timeout )
 {
-  FD_ZERO( &m_fds );
-  FD_SET( m_socket, &m_fds );
+  init();
 }
 
 SSLSocketConnection::SSLSocketConnection(SSLSocketInitiator &i,
                                     const SessionID& sessionID, int s, SSL * ssl,
-                                    SocketMonitor* pMonitor )
-: m_socket( s ), m_ssl(ssl), m_sendLength( 0 ),
+                                    SocketMonitor* pMonitor, int timeout )
+: m_socket( s ), m_ssl(ssl), m_rbio( 0 ), m_wbio( 0 ),
   m_pSession( i.getSession( sessionID, *this ) ),
-  m_pMonitor( pMonitor ) 
+  m_pMonitor( pMonitor ), m_pLog( 0 ), m_pPool( 0 ),
+  m_handshake( HANDSHAKE_PENDING ), m_handshakeBusy( false ),
+  m_handshakeLogged( false ), m_signalled( false ),
+  m_verify( SSL_CLIENT_VERIFY_NOTSET ), m_deadline( time( 0 ) + timeout )
 {
-  FD_ZERO( &m_fds );
-  FD_SET( m_socket, &m_fds );
   m_sessions.insert( sessionID );
+  init();
 }
 
 SSLSocketConnection::~SSLSocketConnection()
 {
+  // a handshake pool worker may still own the SSL object
+  for( ;; )
+  {
+    {
+      Locker l( m_mutex );
+      if( !m_handshakeBusy ) break;
+    }
+    m_handshakeIdle.wait( 60 );
+  }
+
   if ( m_pSession )
     Session::unregisterSession( m_pSession->getSessionID() );
 
-  ssl_socket_close(m_socket, m_ssl);
-
   SSL_free(m_ssl);
 }
 
+void SSLSocketConnection::init()
+{
+  m_rbio = BIO_new( BIO_s_mem() );
+  m_wbio = BIO_new( BIO_s_mem() );
+  SSL_set_bio( m_ssl, m_rbio, m_wbio );
+}
+
 bool SSLSocketConnection::send( const std::string& msg )
 {
   Locker l( m_mutex );
@@ -174,66 +253,224 @@ bool SSLSocketConnection::processQueue()
 {
   Locker l( m_mutex );
 
-  if( m_sendQueue.empty() ) return true;
-
-  struct timeval timeout = { 0, 0 };
-  fd_set writeset = m_fds;
-  if( select( 1 + m_socket, 0, &writeset, 0, &timeout ) <= 0 )
-    return false;
-    
-  const std::string& msg = m_sendQueue.front();
-  m_sendLength = 0;
+  flushOutput();
+  if( m_output.empty() && m_handshake == HANDSHAKE_DONE && !m_sendQueue.empty() )
+  {
+    encryptQueue();
+    flushOutput();
+  }
+  return !wantsWrite();
+}
 
-  while (m_sendLength < (int)msg.length())
+void SSLSocketConnection::encryptQueue()
+{
+  // Only called once the socket took everything encrypted before, so all
+  // messages queued up in the meantime are packed into full records.
+  while( !m_sendQueue.empty() )
   {
-    errno = 0;
-    int errCodeSSL = 0;
-    int sent = 0;
+    m_plain.clear();
+    while( !m_sendQueue.empty()
+           && ( m_plain.empty()
+                || m_plain.size() + m_sendQueue.front().size() <= sizeof(m_buffer) ) )
+    {
+      m_plain += m_sendQueue.front();
+      m_sendQueue.pop_front();
+    }
+
     ERR_clear_error();
+    int sent = SSL_write( m_ssl, m_plain.data(), (int)m_plain.size() );
+    if( sent <= 0 )
+    {
+      if( log() )
+        log()->onEvent( "SSL send error <"
+                        + IntConvertor::convert( SSL_get_error( m_ssl, sent ) )
+                        + ">" );
+      m_sendQueue.clear();
+      break;
+    }
+  }
+
+  drainOutput( m_output );
+}
+
+void SSLSocketConnection::drainOutput( std::string& output )
+{
+  int pending = 0;
+  while( ( pending = (int)BIO_ctrl_pending( m_wbio ) ) > 0 )
+  {
+    size_t start = output.size();
+    output.resize( start + pending );
+    int size = BIO_read( m_wbio, &output[ start ], pending );
+    output.resize( start + ( size > 0 ? size : 0 ) );
+    if( size <= 0 ) break;
+  }
+}
+
+void SSLSocketConnection::flushOutput()
+{
+  size_t sent = 0;
+  while( sent < m_output.size() )
+  {
+    ssize_t result = socket_send( m_socket, m_output.data() + sent,
+                                  m_output.size() - sent );
+    if( result <= 0 ) break;
+    sent += result;
+  }
+  m_output.erase( 0, sent );
+}
 
-    // Cannot do concurrent SSL write and read as ssl context has to be
-    // protected. Done above.
+void SSLSocketConnection::disconnect()
+{
+  {
+    Locker l( m_mutex );
+    if( m_handshake == HANDSHAKE_DONE && !m_handshakeBusy )
     {
-      sent = SSL_write(m_ssl, msg.c_str() + m_sendLength,  msg.length() - m_sendLength);
-      if (sent <= 0)
-        errCodeSSL = SSL_get_error(m_ssl, sent);
+      SSL_shutdown( m_ssl );
+      drainOutput( m_output );
+      flushOutput();
     }
+  }
+
+  if ( m_pMonitor )
+    m_pMonitor->drop( m_socket );
+}
+
+void SSLSocketConnection::handshake()
+{
+  Locker l( m_mutex );
 
-    if (sent <= 0)
+  if( m_handshake == HANDSHAKE_PENDING )
+  {
+    std::string error;
+    HandshakeState state = stepHandshake( m_output, error );
+    if( state != HANDSHAKE_PENDING )
+    {
+      m_handshake = state;
+      m_handshakeError = error;
+    }
+  }
+
+  processQueue();
+  signal();
+}
+
+void SSLSocketConnection::continueHandshake()
+{
+  std::string input;
+  std::string output;
+  std::string error;
+  HandshakeState state = HANDSHAKE_PENDING;
+
+  for( ;; )
+  {
     {
-      if ((errCodeSSL == SSL_ERROR_WANT_READ) ||
-          (errCodeSSL == SSL_ERROR_WANT_WRITE))
+      Locker l( m_mutex );
+      m_output += output;
+      output.clear();
+
+      if( state != HANDSHAKE_PENDING || m_handshakeInput.empty() )
       {
-        errno = EINTR;
-        sent = 0;
+        // the reactor owns the SSL object from here on, hand it
+        // whatever arrived after the last handshake message as well
+        if( !m_handshakeInput.empty() )
+          BIO_write( m_rbio, m_handshakeInput.data(), (int)m_handshakeInput.size() );
+        m_handshakeInput.clear();
+        if( state != HANDSHAKE_PENDING )
+        {
+          m_handshake = state;
+          m_handshakeError = error;
+        }
+        m_handshakeBusy = false;
+        m_handshakeIdle.signal();
+        m_pMonitor->signal( m_socket );
+        return;
       }
-      else
-      {
-        char errbuf[200];
 
-        socket_error(errbuf, sizeof(errbuf));
+      input.swap( m_handshakeInput );
+      m_handshakeInput.clear();
+    }
 
-        m_pSession->getLog()->onEvent("SSL send error <" +
-                                      IntConvertor::convert(errCodeSSL) + "> " +
-                                      errbuf);
+    BIO_write( m_rbio, input.data(), (int)input.size() );
+    state = stepHandshake( output, error );
+  }
+}
 
-        return m_sendQueue.empty();
+SSLSocketConnection::HandshakeState
+SSLSocketConnection::stepHandshake( std::string& output, std::string& error )
+{
+  HandshakeState state = HANDSHAKE_PENDING;
+
+  ERR_clear_error();
+  int result = SSL_do_handshake( m_ssl );
+  if( result == 1 )
+  {
+    state = HANDSHAKE_DONE;
+    if( SSL_is_server( m_ssl ) && verifySSLPeer( m_ssl, m_verify, error ) != 0 )
+      state = HANDSHAKE_FAILED;
+  }
+  else
+  {
+    int code = SSL_get_error( m_ssl, result );
+    if( code != SSL_ERROR_WANT_READ && code != SSL_ERROR_WANT_WRITE )
+    {
+      state = HANDSHAKE_FAILED;
+      error = "SSL error " + IntConvertor::convert( code );
+      unsigned long reason = 0;
+      while( ( reason = ERR_get_error() ) != 0 )
+      {
+        const char* text = ERR_reason_error_string( reason );
+        if( text ) error += std::string( ", " ) + text;
       }
     }
-
-    m_sendLength += sent;
   }
 
-  m_sendLength = 0;
-  m_sendQueue.pop_front();
+  // alerts for a failed handshake are sent as well
+  drainOutput( output );
+  return state;
+}
+
+SSLSocketConnection::HandshakeState SSLSocketConnection::checkHandshake()
+{
+  Locker l( m_mutex );
+
+  if( m_handshake == HANDSHAKE_PENDING || m_handshakeLogged )
+    return m_handshake;
+
+  m_handshakeLogged = true;
+  if( !log() )
+    return m_handshake;
 
-  return m_sendQueue.empty();
+  std::string peer = socket_peername( m_socket );
+  if( m_handshake == HANDSHAKE_FAILED )
+  {
+    log()->onEvent( "SSL handshake with " + peer + " failed: " + m_handshakeError );
+  }
+  else
+  {
+    log()->onEvent( "SSL handshake with " + peer + " completed using "
+                    + SSL_get_version( m_ssl ) + " " + SSL_get_cipher_name( m_ssl )
+                    + ( SSL_session_reused( m_ssl ) ? ", session resumed"
+                                                    : ", new session" ) );
+  }
+  return m_handshake;
 }
 
-void SSLSocketConnection::disconnect()
+SSL_SESSION* SSLSocketConnection::getSSLSession()
 {
-  if ( m_pMonitor )
-    m_pMonitor->drop( m_socket );
+  Locker l( m_mutex );
+
+  if( m_handshake != HANDSHAKE_DONE || m_handshakeBusy )
+    return 0;
+
+  SSL_SESSION* pSession = SSL_get1_session( m_ssl );
+#if (OPENSSL_VERSION_NUMBER >= 0x10101000L)
+  if( pSession && !SSL_SESSION_is_resumable( pSession ) )
+  {
+    SSL_SESSION_free( pSession );
+    pSession = 0;
+  }
+#endif
+  return pSession;
 }
 
 bool SSLSocketConnection::read( SocketConnector& s )
@@ -243,6 +480,8 @@ bool SSLSocketConnection::read( SocketConnector& s )
   try
   {
     readFromSocket();
+    if( checkHandshake() == HANDSHAKE_FAILED )
+      return false;
     readMessages( s.getMonitor() );
   }
   catch( SocketRecvFailed& e )
@@ -254,25 +493,42 @@ bool SSLSocketConnection::read( SocketConnector& s )
 }
 
 bool SSLSocketConnection::read(SSLSocketAcceptor &a, SocketServer& s )
+{
+  try
+  {
+    readFromSocket();
+  }
+  catch ( SocketRecvFailed& e )
+  {
+    if( m_pSession )
+      m_pSession->getLog()->onEvent( e.what() );
+    s.getMonitor().drop( m_socket );
+    return false;
+  }
+
+  return processInput( a, s );
+}
+
+bool SSLSocketConnection::processInput( SSLSocketAcceptor& a, SocketServer& s )
 {
   std::string msg;
   try
   {
-    if ( !m_pSession )
+    HandshakeState state = checkHandshake();
+    if( state == HANDSHAKE_PENDING )
+      return true;
+    if( state == HANDSHAKE_FAILED )
     {
-      struct timeval timeout = { 1, 0 };
-      fd_set readset = m_fds;
+      s.getMonitor().drop( m_socket );
+      return false;
+    }
 
-      while( !readMessage( msg ) )
-      {
-        int result = select( 1 + m_socket, &readset, 0, 0, &timeout );
-        if( result > 0 )
-          readFromSocket();
-        else if( result == 0 )
-          return false;
-        else if( result < 0 )
-          return false;
-      }
+    decrypt();
+
+    if ( !m_pSession )
+    {
+      if( !readMessage( msg ) )
+        return true;
 
       m_pSession = Session::lookupSession( msg, true );
       if( !isValidSession() )
@@ -295,14 +551,10 @@ bool SSLSocketConnection::read(SSLSocketAcceptor &a, SocketServer& s )
       }
 
       Session::registerSession( m_pSession->getSessionID() );
-      return true;
-    }
-    else
-    {
-      readFromSocket();
-      readMessages( s.getMonitor() );
-      return true;
     }
+
+    readMessages( s.getMonitor() );
+    return true;
   }
   catch ( SocketRecvFailed& e )
   {
@@ -330,62 +582,71 @@ bool SSLSocketConnection::isValidSession()
 void SSLSocketConnection::readFromSocket()
 EXCEPT ( SocketRecvFailed )
 {
-  bool pending = false;
+  ssize_t size = socket_recv( m_socket, m_buffer, sizeof(m_buffer) );
+  if( size <= 0 ) throw SocketRecvFailed( size );
 
-  do
-  {
-    pending = false;
-    errno = 0;
-    ssize_t size = 0;
-    int errCodeSSL = 0;
-    ERR_clear_error();
+  Locker l( m_mutex );
 
-    // Cannot do concurrent SSL write and read as ssl context has to be
-    // protected.
+  if( m_handshake == HANDSHAKE_PENDING && m_pPool )
+  {
+    m_handshakeInput.append( m_buffer, size );
+    if( !m_handshakeBusy )
     {
-      Locker locker(m_mutex);
-
-      size = SSL_read(m_ssl, m_buffer, sizeof(m_buffer));
-      if (size <= 0)
-        errCodeSSL = SSL_get_error(m_ssl, size);
-      else if (SSL_pending(m_ssl) > 0)
-        pending = true;
+      m_handshakeBusy = true;
+      m_pPool->add( this );
     }
+    return;
+  }
 
-    if (size <= 0)
+  BIO_write( m_rbio, m_buffer, (int)size );
+
+  if( m_handshake == HANDSHAKE_PENDING )
+  {
+    std::string error;
+    HandshakeState state = stepHandshake( m_output, error );
+    if( state != HANDSHAKE_PENDING )
     {
-      if ((errCodeSSL == SSL_ERROR_WANT_READ) ||
-          (errCodeSSL == SSL_ERROR_WANT_WRITE))
-      {
-        errno = EINTR;
-        size = 0;
+      m_handshake = state;
+      m_handshakeError = error;
+    }
+  }
 
-        return;
-      }
-      else
-      {
-        char errbuf[200];
+  decrypt();
+  processQueue();
+  signal();
+}
 
-        socket_error(errbuf, sizeof(errbuf));
+void SSLSocketConnection::decrypt()
+EXCEPT ( SocketRecvFailed )
+{
+  Locker l( m_mutex );
 
-        if (m_pSession)
-          m_pSession->getLog()->onEvent("SSL read error <" +
-                                        IntConvertor::convert(errCodeSSL) +
-                                        "> " + errbuf);
-        else
-        {
-          std::cerr << UtcTimeStampConvertor::convert(UtcTimeStamp())
-                    << "SSL read error <"
-                    << IntConvertor::convert(errCodeSSL) << "> " << errbuf
-                    << std::endl;
-        }
+  if( m_handshake != HANDSHAKE_DONE )
+    return;
 
-        throw SocketRecvFailed(size);
-      }
+  for( ;; )
+  {
+    ERR_clear_error();
+    int size = SSL_read( m_ssl, m_buffer, sizeof(m_buffer) );
+    if( size > 0 )
+    {
+      m_parser.addToStream( m_buffer, size );
+      continue;
     }
 
-    m_parser.addToStream(m_buffer, size);
-  } while (pending);
+    int code = SSL_get_error( m_ssl, size );
+    if( code == SSL_ERROR_WANT_READ || code == SSL_ERROR_WANT_WRITE )
+      break;
+
+    drainOutput( m_output );
+    flushOutput();
+    if( code == SSL_ERROR_ZERO_RETURN )
+      throw SocketRecvFailed( 0 );
+    throw SocketRecvFailed( "SSL read error <" + IntConvertor::convert( code ) + ">" );
+  }
+
+  // session tickets and key updates are answered right away
+  drainOutput( m_output );
 }
 
 bool SSLSocketConnection::readMessage( std::string& msg )
@@ -417,11 +678,44 @@ void SSLSocketConnection::readMessages( SocketMonitor& s )
   }
 }
 
+Log* SSLSocketConnection::log()
+{
+  return m_pSession ? m_pSession->getLog() : m_pLog;
+}
+
 void SSLSocketConnection::onTimeout()
 {
+  if( checkHandshake() == HANDSHAKE_FAILED )
+  {
+    disconnect();
+    return;
+  }
+
+  // connections get until the deadline to finish the handshake and, on
+  // an acceptor, to send the message that identifies their session
+  if( ( m_handshake == HANDSHAKE_PENDING || !m_pSession )
+      && time( 0 ) >= m_deadline )
+  {
+    if( log() )
+      log()->onEvent( std::string( m_handshake == HANDSHAKE_PENDING
+                                   ? "SSL handshake with "
+                                   : "No message received from " )
+                      + socket_peername( m_socket ) + " before timeout" );
+    disconnect();
+    return;
+  }
+
   if ( m_pSession ) m_pSession->next();
 }
 
+UtcTimeStamp SSLSocketConnection::getNextTimeout( const UtcTimeStamp& now )
+{
+  if ( m_pSession ) return m_pSession->getNextTimeout( now );
+  UtcTimeStamp next = now;
+  next += 1;
+  return next;
+}
+
 } // namespace FIX
 
 #endif
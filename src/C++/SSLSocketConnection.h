@@ -130,7 +130,11 @@
 #include "Utility.h"
 #include "UtilitySSL.h"
 #include "Mutex.h"
+#include "AutoResetEvent.h"
+#include "Queue.h"
 #include <set>
+#include <deque>
+#include <vector>
 
 namespace FIX
 {
@@ -138,16 +142,46 @@ class SSLSocketAcceptor;
 class SocketServer;
 class SocketConnector;
 class SSLSocketInitiator;
+class SSLSocketConnection;
 class Session;
+class Log;
+
+/// Runs SSL handshake steps for reactor connections on worker threads.
+class SSLHandshakePool
+{
+public:
+  SSLHandshakePool( int threads );
+  ~SSLHandshakePool();
+
+  void add( SSLSocketConnection* );
+
+private:
+  static THREAD_PROC workerThread( void* p );
+  void run();
+
+  FIX::Queue<SSLSocketConnection*, AutoResetEvent> m_queue;
+  std::vector<thread_id> m_threads;
+  bool m_stop;
+  Mutex m_mutex;
+};
 
 /// Encapsulates a socket file descriptor (single-threaded).
+/**
+ * The SSL object reads and writes memory BIOs, the socket itself is only
+ * touched by the reactor with non-blocking calls.  Messages are queued in
+ * the clear and encrypted together once the socket can take more, so a
+ * burst of messages shares as few SSL records as possible.
+ */
 class SSLSocketConnection : Responder
 {
 public:
   typedef std::set<SessionID> Sessions;
 
-  SSLSocketConnection( int s, SSL *ssl, Sessions sessions, SocketMonitor* pMonitor );
-  SSLSocketConnection( SSLSocketInitiator&, const SessionID&, int, SSL *, SocketMonitor* );
+  SSLSocketConnection( int s, SSL *ssl, Sessions sessions, SocketMonitor* pMonitor,
+                       Log* pLog = 0, SSLHandshakePool* pPool = 0,
+                       int verify = SSL_CLIENT_VERIFY_NOTSET, int timeout = 10 );
+  SSLSocketConnection( SSLSocketInitiator&, const SessionID&, int, SSL *, SocketMonitor*,
+                       int timeout = 10 );
   virtual ~SSLSocketConnection();
 
   int getSocket() const { return m_socket; }
@@ -155,23 +189,38 @@ public:
 
   bool read( SocketConnector& s );
   bool read( SSLSocketAcceptor&, SocketServer& );
+  /// Handles input decrypted outside of read(), e.g. by the handshake pool
+  bool processInput( SSLSocketAcceptor&, SocketServer& );
   bool processQueue();
+  /// Starts the client side of the handshake once the socket is connected
+  void handshake();
+  /// Runs the handshake on the input gathered so far (handshake pool only)
+  void continueHandshake();
+  /// Takes a reference to the SSL session for a later resumption
+  SSL_SESSION* getSSLSession();
 
   void signal()
   {
     Locker l( m_mutex );
-    if( m_sendQueue.size() == 1 )
+    if( !m_signalled && wantsWrite() )
+    {
+      m_signalled = true;
       m_pMonitor->signal( m_socket );
+    }
   }
 
   void unsignal()
   {
     Locker l( m_mutex );
-    if( m_sendQueue.size() == 0 )
+    if( !wantsWrite() )
+    {
+      m_signalled = false;
       m_pMonitor->unsignal( m_socket );
+    }
   }
 
   void onTimeout();
+  UtcTimeStamp getNextTimeout( const UtcTimeStamp& now );
 
   SSL *sslObject() { return m_ssl; }
 
@@ -179,25 +228,60 @@ private:
   typedef std::deque<std::string, ALLOCATOR<std::string> >
     Queue;
 
+  enum HandshakeState { HANDSHAKE_PENDING, HANDSHAKE_DONE, HANDSHAKE_FAILED };
+
+  void init();
   bool isValidSession();
   void readFromSocket() EXCEPT ( SocketRecvFailed );
+  void decrypt() EXCEPT ( SocketRecvFailed );
+  HandshakeState checkHandshake();
+  HandshakeState stepHandshake( std::string& output, std::string& error );
+  void encryptQueue();
+  void drainOutput( std::string& output );
+  void flushOutput();
+  bool wantsWrite() const
+  {
+    return !m_output.empty()
+      || ( m_handshake == HANDSHAKE_DONE && !m_sendQueue.empty() );
+  }
   bool readMessage( std::string& msg );
   void readMessages( SocketMonitor& s );
   bool send( const std::string& );
   void disconnect();
+  void reschedule()
+  {
+    // onWrite() of the acceptor or initiator asks for the next timeout
+    Locker l( m_mutex );
+    m_signalled = true;
+    m_pMonitor->signal( m_socket );
+  }
+  Log* log();
 
   int m_socket;
   SSL *m_ssl;
-  char m_buffer[BUFSIZ];
+  BIO *m_rbio;
+  BIO *m_wbio;
+  char m_buffer[ SSL3_RT_MAX_PLAIN_LENGTH ];
 
   Parser m_parser;
   Queue m_sendQueue;
-  unsigned m_sendLength;
+  std::string m_plain;
+  std::string m_output;
   Sessions m_sessions;
   Session* m_pSession;
   SocketMonitor* m_pMonitor;
+  Log* m_pLog;
+  SSLHandshakePool* m_pPool;
+  HandshakeState m_handshake;
+  std::string m_handshakeInput;
+  std::string m_handshakeError;
+  bool m_handshakeBusy;
+  AutoResetEvent m_handshakeIdle;
+  bool m_handshakeLogged;
+  bool m_signalled;
+  int m_verify;
+  time_t m_deadline;
   Mutex m_mutex;
-  fd_set m_fds;
 };
 }
 
@@ -141,7 +141,8 @@ EXCEPT ( ConfigError )
 : Initiator( application, factory, settings ),
   m_connector( 1 ), m_lastConnect( 0 ),
   m_reconnectInterval( 30 ), m_noDelay( false ), m_sendBufSize( 0 ),
-  m_rcvBufSize( 0 ), m_sslInit(false), m_ctx(0), m_cert(0), m_key(0)
+  m_rcvBufSize( 0 ), m_handshakeTimeout( 10 ), m_resumption( true ),
+  m_sslInit(false), m_ctx(0), m_cert(0), m_key(0)
 {
   initObj = this;
 }
@@ -154,7 +155,8 @@ EXCEPT ( ConfigError )
 : Initiator( application, factory, settings, logFactory ),
   m_connector( 1 ), m_lastConnect( 0 ),
   m_reconnectInterval( 30 ), m_noDelay( false ), m_sendBufSize( 0 ),
-  m_rcvBufSize( 0 ), m_sslInit(false), m_ctx(0), m_cert(0), m_key(0)
+  m_rcvBufSize( 0 ), m_handshakeTimeout( 10 ), m_resumption( true ),
+  m_sslInit(false), m_ctx(0), m_cert(0), m_key(0)
 {
   initObj = this;
 }
@@ -170,6 +172,10 @@ SSLSocketInitiator::~SSLSocketInitiator()
        i != m_pendingConnections.end(); ++i)
     delete i->second;
 
+  SSLSessions::iterator j;
+  for (j = m_sslSessions.begin(); j != m_sslSessions.end(); ++j)
+    SSL_SESSION_free(j->second);
+
   if (m_sslInit)
   {
     SSL_CTX_free(m_ctx);
@@ -191,6 +197,10 @@ EXCEPT ( ConfigError )
     m_sendBufSize = dict.getInt( SOCKET_SEND_BUFFER_SIZE );
   if( dict.has( SOCKET_RECEIVE_BUFFER_SIZE ) )
     m_rcvBufSize = dict.getInt( SOCKET_RECEIVE_BUFFER_SIZE );
+  if( dict.has( SSL_HANDSHAKE_TIMEOUT ) )
+    m_handshakeTimeout = dict.getInt( SSL_HANDSHAKE_TIMEOUT );
+  if( dict.has( SSL_SESSION_RESUMPTION ) )
+    m_resumption = dict.getBool( SSL_SESSION_RESUMPTION );
 }
 
 void SSLSocketInitiator::onInitialize( const SessionSettings& s )
@@ -244,7 +254,8 @@ void SSLSocketInitiator::onStart()
   connect();
 
   while ( !isStopped() ) {
-    m_connector.block( *this, false, 1.0 );
+    double timeout = m_timers.timeout();
+    m_connector.block( *this, false, timeout ? timeout : 1.0 );
     onTimeout( m_connector );
   }
 
@@ -254,7 +265,8 @@ void SSLSocketInitiator::onStart()
   ::time( &start );
   while ( isLoggedOn() )
   {
-    m_connector.block( *this );
+    m_connector.block( *this, false, m_timers.timeout() );
+    onTimeout( m_connector );
     if( ::time(&now) -5 >= start )
       break;
   }
@@ -276,6 +288,7 @@ bool SSLSocketInitiator::onPoll( double timeout )
   }
 
   m_connector.block( *this, true, timeout );
+  onTimeout( m_connector );
   return true;
 }
 
@@ -309,36 +322,15 @@ void SSLSocketInitiator::doConnect( const SessionID& s, const Dictionary& d )
       return;
     }
     SSL_clear(ssl);
-    BIO *sbio = BIO_new_socket(result, BIO_CLOSE);
-    if (sbio == 0)
-    {
-      log->onEvent("BIO_new_socket failed");
-      return;
-    }
-    SSL_set_bio(ssl, sbio, sbio);
+    SSL_set_connect_state(ssl);
 
-    ERR_clear_error();
-    // Do the SSL handshake.
-    int rc = SSL_connect(ssl);
-    while (rc <= 0)
-    {
-      int err = SSL_get_error(ssl, rc);
-      if ((err == SSL_ERROR_WANT_READ) ||
-          (err == SSL_ERROR_WANT_WRITE))
-      {
-        errno = EINTR;
-      }
-      else
-      {
-        getLog()->onEvent("SSL_connect failed with SSL error " + IntConvertor::convert(err));
-        return;
-      }
-      ERR_clear_error();
-      rc = SSL_connect(ssl);
-    }
+    SSLSessions::iterator i = m_sslSessions.find( s );
+    if( i != m_sslSessions.end() )
+      SSL_set_session(ssl, i->second);
 
+    // the handshake starts once the socket is connected, see onConnect
     setPending( s );
-    m_pendingConnections[ result ] = new SSLSocketConnection( *this, s, result, ssl, &m_connector.getMonitor() );
+    m_pendingConnections[ result ] = new SSLSocketConnection( *this, s, result, ssl, &m_connector.getMonitor(), m_handshakeTimeout );
   }
   catch ( std::exception& ) {}
 }
@@ -352,7 +344,9 @@ void SSLSocketInitiator::onConnect( SocketConnector&, int s )
   m_connections[s] = pSocketConnection;
   m_pendingConnections.erase( i );
   setConnected( pSocketConnection->getSession()->getSessionID() );
+  pSocketConnection->handshake();
   pSocketConnection->onTimeout();
+  m_timers.schedule( s, pSocketConnection->getNextTimeout( UtcTimeStamp() ) );
 }
 
 void SSLSocketInitiator::onWrite( SocketConnector& connector, int s )
@@ -362,6 +356,8 @@ void SSLSocketInitiator::onWrite( SocketConnector& connector, int s )
   SSLSocketConnection* pSocketConnection = i->second;
   if( pSocketConnection->processQueue() )
     pSocketConnection->unsignal();
+  // the session may have asked for its deadlines to be looked at again
+  m_timers.schedule( s, pSocketConnection->getNextTimeout( UtcTimeStamp() ) );
 }
 
 bool SSLSocketInitiator::onData( SocketConnector& connector, int s )
@@ -387,6 +383,16 @@ void SSLSocketInitiator::onDisconnect( SocketConnector&, int s )
 
   setDisconnected( pSocketConnection->getSession()->getSessionID() );
 
+  SSL_SESSION* pSSLSession = 0;
+  if( m_resumption && ( pSSLSession = pSocketConnection->getSSLSession() ) )
+  {
+    const SessionID& sessionID = pSocketConnection->getSession()->getSessionID();
+    SSLSessions::iterator k = m_sslSessions.find( sessionID );
+    if( k != m_sslSessions.end() )
+      SSL_SESSION_free( k->second );
+    m_sslSessions[ sessionID ] = pSSLSession;
+  }
+
   Session* pSession = pSocketConnection->getSession();
   if ( pSession )
   {
@@ -397,6 +403,7 @@ void SSLSocketInitiator::onDisconnect( SocketConnector&, int s )
   delete pSocketConnection;
   m_connections.erase( s );
   m_pendingConnections.erase( s );
+  m_timers.cancel( s );
 }
 
 void SSLSocketInitiator::onError( SocketConnector& connector )
@@ -415,9 +422,18 @@ void SSLSocketInitiator::onTimeout( SocketConnector& )
     m_lastConnect = now;
   }
 
-  SocketConnections::iterator i;
-  for ( i = m_connections.begin(); i != m_connections.end(); ++i )
-    i->second->onTimeout();
+  UtcTimeStamp timeStamp;
+  TimerWheel::Timers timers;
+  m_timers.expire( timeStamp, timers );
+
+  TimerWheel::Timers::iterator i;
+  for ( i = timers.begin(); i != timers.end(); ++i )
+  {
+    SocketConnections::iterator j = m_connections.find( *i );
+    if ( j == m_connections.end() ) continue;
+    j->second->onTimeout();
+    m_timers.schedule( *i, j->second->getNextTimeout( timeStamp ) );
+  }
 }
 
 void SSLSocketInitiator::getHost( const SessionID& s, const Dictionary& d,
@@ -126,6 +126,7 @@
 #include "Initiator.h"
 #include "SocketConnector.h"
 #include "SSLSocketConnection.h"
+#include "TimerWheel.h"
 
 namespace FIX
 {
@@ -155,6 +156,7 @@ public:
 private:
   typedef std::map < int, SSLSocketConnection* > SocketConnections;
   typedef std::map < SessionID, int > SessionToHostNum;
+  typedef std::map < SessionID, SSL_SESSION* > SSLSessions;
 
   void onConfigure( const SessionSettings& ) EXCEPT ( ConfigError );
   void onInitialize( const SessionSettings& ) EXCEPT ( RuntimeError );
@@ -174,14 +176,18 @@ private:
   void getHost( const SessionID&, const Dictionary&, std::string&, short&, std::string&, short& );
 
   SessionToHostNum m_sessionToHostNum;
+  SSLSessions m_sslSessions;
   SocketConnector m_connector;
   SocketConnections m_pendingConnections;
   SocketConnections m_connections;
+  TimerWheel m_timers;
   time_t m_lastConnect;
   int m_reconnectInterval;
   bool m_noDelay;
   int m_sendBufSize;
   int m_rcvBufSize;
+  int m_handshakeTimeout;
+  bool m_resumption;
   bool m_sslInit;
   SSL_CTX *m_ctx;
   std::string m_password;
@@ -0,0 +1,220 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "SequenceBuffer.h"
+#include <algorithm>
+#include <climits>
+
+namespace FIX
+{
+// slots kept after clear() so that a typical gap does not reallocate
+static const int INITIAL_SLOTS = 16;
+static const int RETAINED_SLOTS = 1024;
+// the window stops growing here, messages further ahead go to the map
+static const int MAX_SLOTS = 65536;
+
+SequenceBuffer::SequenceBuffer( int maxSize )
+: m_slots( INITIAL_SLOTS, ( Message* ) 0 ),
+  m_base( 1 ), m_size( 0 ), m_maxSize( maxSize ) {}
+
+SequenceBuffer::~SequenceBuffer()
+{
+  clear();
+}
+
+bool SequenceBuffer::push( int nextSeqNum, int msgSeqNum, const Message& message )
+{
+  return push( nextSeqNum, msgSeqNum, new Message( message ) );
+}
+
+bool SequenceBuffer::push( int nextSeqNum, int msgSeqNum, Message* pMessage )
+{
+  if( nextSeqNum <= 0 || msgSeqNum < nextSeqNum
+      || ( m_maxSize > 0 && msgSeqNum - nextSeqNum > m_maxSize ) )
+  {
+    delete pMessage;
+    return false;
+  }
+
+  advance( nextSeqNum );
+
+  Message** ppSlot;
+  if( msgSeqNum - m_base < MAX_SLOTS )
+  {
+    reserve( msgSeqNum - m_base + 1 );
+    ppSlot = &slot( msgSeqNum );
+  }
+  else
+  {
+    ppSlot = &m_spilled[ msgSeqNum ];
+  }
+
+  if( *ppSlot )
+    delete *ppSlot;
+  else
+    ++m_size;
+  *ppSlot = pMessage;
+  return true;
+}
+
+bool SequenceBuffer::pop( int msgSeqNum, Message& message )
+{
+  advance( msgSeqNum );
+  Message* pMessage = take( msgSeqNum );
+  if( !pMessage )
+    return false;
+
+  message = *pMessage;
+  delete pMessage;
+  return true;
+}
+
+int SequenceBuffer::pop( int msgSeqNum, Messages& messages )
+{
+  advance( msgSeqNum );
+
+  int count = 0;
+  for( Message* pMessage; ( pMessage = take( m_base ) ); )
+  {
+    messages.push_back( pMessage );
+    ++count;
+    if( m_base == INT_MAX )
+      break;
+    ++m_base;
+    unspill();
+  }
+  return count;
+}
+
+void SequenceBuffer::clear()
+{
+  for( size_t i = 0; m_size && i < m_slots.size(); ++i )
+  {
+    if( !m_slots[ i ] ) continue;
+    delete m_slots[ i ];
+    m_slots[ i ] = 0;
+    --m_size;
+  }
+
+  Spilled::iterator i;
+  for( i = m_spilled.begin(); i != m_spilled.end(); ++i )
+    delete i->second;
+  m_spilled.clear();
+
+  m_size = 0;
+  if( m_slots.size() > ( size_t ) RETAINED_SLOTS )
+    Messages( INITIAL_SLOTS, ( Message* ) 0 ).swap( m_slots );
+}
+
+Message* SequenceBuffer::take( int msgSeqNum )
+{
+  if( !m_size || msgSeqNum != m_base )
+    return 0;
+
+  Message*& pSlot = slot( msgSeqNum );
+  Message* pMessage = pSlot;
+  pSlot = 0;
+  if( pMessage )
+    --m_size;
+  return pMessage;
+}
+
+void SequenceBuffer::advance( int nextSeqNum )
+{
+  if( !m_size )
+  {
+    m_base = nextSeqNum;
+    return;
+  }
+  if( nextSeqNum == m_base )
+    return;
+
+  if( nextSeqNum < m_base )
+  {
+    // the expected number went back, lay the window out again from there
+    for( size_t i = 0; i < m_slots.size(); ++i )
+    {
+      unsigned seq = ( unsigned ) m_base + i;
+      Message*& pSlot = slot( seq );
+      if( !pSlot ) continue;
+      m_spilled[ ( int ) seq ] = pSlot;
+      pSlot = 0;
+    }
+    m_base = nextSeqNum;
+    unspill();
+    return;
+  }
+
+  unsigned count = std::min( ( unsigned ) ( nextSeqNum - m_base ),
+                             ( unsigned ) m_slots.size() );
+  for( unsigned i = 0; i < count; ++i )
+  {
+    Message*& pSlot = slot( ( unsigned ) m_base + i );
+    if( !pSlot ) continue;
+    delete pSlot;
+    pSlot = 0;
+    --m_size;
+  }
+
+  while( m_spilled.size() && m_spilled.begin()->first < nextSeqNum )
+  {
+    delete m_spilled.begin()->second;
+    m_spilled.erase( m_spilled.begin() );
+    --m_size;
+  }
+
+  m_base = nextSeqNum;
+  unspill();
+}
+
+void SequenceBuffer::reserve( int span )
+{
+  size_t capacity = m_slots.size();
+  if( ( size_t ) span <= capacity )
+    return;
+
+  while( capacity < ( size_t ) span )
+    capacity <<= 1;
+
+  Messages slots( capacity, ( Message* ) 0 );
+  for( size_t i = 0; i < m_slots.size(); ++i )
+  {
+    unsigned seq = ( unsigned ) m_base + i;
+    slots[ seq & ( capacity - 1 ) ] = slot( seq );
+  }
+  m_slots.swap( slots );
+}
+
+void SequenceBuffer::unspill()
+{
+  while( m_spilled.size() && m_spilled.begin()->first - m_base < MAX_SLOTS )
+  {
+    int msgSeqNum = m_spilled.begin()->first;
+    reserve( msgSeqNum - m_base + 1 );
+    slot( msgSeqNum ) = m_spilled.begin()->second;
+    m_spilled.erase( m_spilled.begin() );
+  }
+}
+}
@@ -0,0 +1,105 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_SEQUENCEBUFFER_H
+#define FIX_SEQUENCEBUFFER_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Message.h"
+#include <vector>
+#include <map>
+
+namespace FIX
+{
+/**
+ * Circular buffer of messages indexed by sequence number.
+ *
+ * Holds messages that arrived ahead of the next expected sequence number.
+ * Slots cover a window starting at the next expected number, a message is
+ * stored in slot (seqnum mod capacity), so inserting and draining a
+ * contiguous run are constant time per message and no message is copied on
+ * the way out.  The window grows up to a fixed number of slots, messages
+ * further ahead are kept in a map until the window reaches them.  How far
+ * ahead a message may be can be capped, in which case push() refuses
+ * messages beyond the cap.
+ */
+class SequenceBuffer
+{
+public:
+  typedef std::vector < Message* > Messages;
+
+  SequenceBuffer( int maxSize = 0 );
+  ~SequenceBuffer();
+
+  /// How many numbers past the next expected one may be held, 0 if unbounded
+  int maxSize() const { return m_maxSize; }
+  void maxSize( int value ) { m_maxSize = value; }
+
+  /// Number of messages held
+  int size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+  /**
+   * Store a copy of a message while nextSeqNum is expected, discarding any
+   * held below it.  False if the message is not ahead of nextSeqNum or is
+   * further ahead than maxSize.
+   */
+  bool push( int nextSeqNum, int msgSeqNum, const Message& message );
+  /// Take ownership of a message, false (and delete it) if it is refused
+  bool push( int nextSeqNum, int msgSeqNum, Message* pMessage );
+
+  /// Remove a single message, discarding any held below msgSeqNum
+  bool pop( int msgSeqNum, Message& message );
+  /**
+   * Remove the contiguous run of messages starting at msgSeqNum,
+   * discarding any held below it.  Ownership of the returned messages
+   * passes to the caller.  Returns the number of messages appended.
+   */
+  int pop( int msgSeqNum, Messages& messages );
+
+  void clear();
+
+private:
+  typedef std::map < int, Message* > Spilled;
+
+  SequenceBuffer( const SequenceBuffer& );
+  SequenceBuffer& operator=( const SequenceBuffer& );
+
+  Message*& slot( unsigned msgSeqNum )
+  { return m_slots[ msgSeqNum & ( m_slots.size() - 1 ) ]; }
+
+  Message* take( int msgSeqNum );
+  void advance( int nextSeqNum );
+  void reserve( int span );
+  void unspill();
+
+  Messages m_slots;
+  Spilled m_spilled;
+  int m_base;
+  int m_size;
+  int m_maxSize;
+};
+}
+
+#endif //FIX_SEQUENCEBUFFER_H
@@ -61,10 +61,20 @@ Session::Session( Application& application,
   m_timestampPrecision( 3 ),
   m_persistMessages( true ),
   m_validateLengthAndChecksum( true ),
+  m_lazyBodyParsing( false ),
+  m_disconnectOnQueueOverflow( false ),
   m_dataDictionaryProvider( dataDictionaryProvider ),
   m_messageStoreFactory( messageStoreFactory ),
   m_pLogFactory( pLogFactory ),
-  m_pResponder( 0 )
+  m_pResponder( 0 ),
+  m_pLatency( 0 ),
+  m_pMetrics( 0 ),
+  m_latencyHistograms( 0 ),
+  m_collectMetrics( 0 ),
+  m_validatedTime( 0 ),
+  m_pAsyncSender( 0 ),
+  m_batchSends( false ),
+  m_batchSeqNum( 0 )
 {
   m_state.heartBtInt( heartBtInt );
   m_state.initiate( heartBtInt != 0 );
@@ -82,12 +92,64 @@ Session::Session( Application& application,
 
 Session::~Session()
 {
+  // sends whatever is still queued
+  delete m_pAsyncSender;
   removeSession( *this );
+  delete [] m_pLatency;
+  delete m_pMetrics;
+  // a batching store writes what it still holds, failing that is
+  // logged while the session log is still around
+  try { m_state.flush(); }
+  catch( IOException& e )
+  { m_state.onEvent( std::string( "Unable to flush message store: " ) + e.what() ); }
   m_messageStoreFactory.destroy( m_state.store() );
   if ( m_pLogFactory && m_state.log() )
     m_pLogFactory->destroy( m_state.log() );
 }
 
+void Session::setLatencyHistograms( bool value )
+{
+  Locker l( m_mutex );
+  // the reading and sending threads record without the lock, so the
+  // histograms stay allocated once they were turned on
+  if( value && !m_pLatency )
+    m_pLatency = new LatencyHistogram[ LATENCY_STAGES ];
+  store( m_latencyHistograms, value ? 1 : 0 );
+}
+
+LatencyHistogram Session::getLatencyHistogram( LatencyStage stage ) const
+{
+  Locker l( m_mutex );
+  if( !m_pLatency || stage < 0 || stage >= LATENCY_STAGES )
+    return LatencyHistogram();
+  return m_pLatency[ stage ];
+}
+
+void Session::resetLatencyHistograms()
+{
+  Locker l( m_mutex );
+  if( !m_pLatency ) return;
+  for( int i = 0; i < LATENCY_STAGES; ++i )
+    m_pLatency[ i ].reset();
+}
+
+void Session::setCollectMetrics( bool value )
+{
+  Locker l( m_mutex );
+  if( value && !m_pMetrics )
+    m_pMetrics = new SessionMetrics;
+  store( m_collectMetrics, value ? 1 : 0 );
+}
+
+void Session::getSendQueue( size_t& messages, size_t& bytes )
+{
+  Locker l( m_mutex );
+  messages = 0;
+  bytes = 0;
+  if( m_pResponder )
+    m_pResponder->getSendQueue( messages, bytes );
+}
+
 void Session::insertSendingTime( Header& header )
 {
   UtcTimeStamp now;
@@ -199,6 +261,65 @@ void Session::next( const UtcTimeStamp& timeStamp )
   }
 }
 
+bool Session::recheckSessionTime( const UtcTimeStamp& timeStamp )
+{
+  UtcTimeStamp creationTime = m_state.getCreationTime();
+  if( !m_sessionTime.isInSameRange( timeStamp, creationTime ) )
+  {
+    m_state.clearSessionTime();
+    return false;
+  }
+
+  // nothing can change until the current session window closes, unless
+  // another thread resets the store in the meantime
+  m_state.sessionTime( timeStamp.getNanosSinceEpoch(),
+                       m_sessionTime.getRangeEnd( timeStamp ).getNanosSinceEpoch(),
+                       creationTime );
+  return true;
+}
+
+UtcTimeStamp Session::getNextTimeout( const UtcTimeStamp& timeStamp )
+{
+  UtcTimeStamp limit = timeStamp;
+
+  // outside of the session time next() resets the session, waiting for
+  // the next session to begin is still done by polling once a second
+  if( !checkSessionTime( timeStamp ) )
+  {
+    limit += 1;
+    return limit;
+  }
+
+  bool logonTime = isLogonTime( timeStamp );
+  if( !isEnabled() || !logonTime )
+  {
+    if( isLoggedOn() && !m_state.sentLogout() )
+      return timeStamp;
+  }
+  else if( m_state.shouldSendLogon() )
+    return timeStamp;
+
+  limit = m_sessionTime.getRangeEnd( timeStamp );
+  if( logonTime )
+  {
+    UtcTimeStamp logonEnd = m_logonTime.getRangeEnd( timeStamp );
+    if( logonEnd < limit ) limit = logonEnd;
+  }
+  else
+  {
+    limit = timeStamp;
+    limit += 1;
+  }
+
+  return m_state.nextTimeout( timeStamp, limit );
+}
+
+void Session::reschedule()
+{
+  Locker l( m_mutex );
+  if( m_pResponder ) m_pResponder->reschedule();
+}
+
 void Session::nextLogon( const Message& logon, const UtcTimeStamp& timeStamp )
 {
   SenderCompID senderCompID;
@@ -280,6 +401,7 @@ void Session::nextLogon( const Message& logon, const UtcTimeStamp& timeStamp )
 void Session::nextHeartbeat( const Message& heartbeat, const UtcTimeStamp& timeStamp )
 {
   if ( !verify( heartbeat ) ) return ;
+  if( getCollectMetrics() ) m_pMetrics->add( SessionMetrics::HEARTBEATS_RECEIVED );
   m_state.incrNextTargetMsgSeqNum();
   nextQueued( timeStamp );
 }
@@ -287,6 +409,7 @@ void Session::nextHeartbeat( const Message& heartbeat, const UtcTimeStamp& timeS
 void Session::nextTestRequest( const Message& testRequest, const UtcTimeStamp& timeStamp )
 {
   if ( !verify( testRequest ) ) return ;
+  if( getCollectMetrics() ) m_pMetrics->add( SessionMetrics::TEST_REQUESTS_RECEIVED );
   generateHeartbeat( testRequest );
   m_state.incrNextTargetMsgSeqNum();
   nextQueued( timeStamp );
@@ -312,6 +435,7 @@ void Session::nextLogout( const Message& logout, const UtcTimeStamp& timeStamp )
 void Session::nextReject( const Message& reject, const UtcTimeStamp& timeStamp )
 {
   if ( !verify( reject, false, true ) ) return ;
+  if( getCollectMetrics() ) m_pMetrics->add( SessionMetrics::REJECTS_RECEIVED );
   m_state.incrNextTargetMsgSeqNum();
   nextQueued( timeStamp );
 }
@@ -346,6 +470,7 @@ void Session::nextResendRequest( const Message& resendRequest, const UtcTimeStam
   if ( !verify( resendRequest, false, false ) ) return ;
 
   Locker l( m_mutex );
+  if( getCollectMetrics() ) m_pMetrics->add( SessionMetrics::RESEND_REQUESTS_SERVED );
 
   BeginSeqNo beginSeqNo;
   EndSeqNo endSeqNo;
@@ -461,6 +586,7 @@ void Session::nextResendRequest( const Message& resendRequest, const UtcTimeStam
       {
         if ( begin ) generateSequenceReset( begin, msgSeqNum );
         send( msg.toString(messageString) );
+        if( getCollectMetrics() ) m_pMetrics->add( SessionMetrics::MESSAGES_RESENT );
         m_state.onEvent( "Resending Message: "
                          + IntConvertor::convert( msgSeqNum ) );
         begin = 0;
@@ -522,14 +648,123 @@ Message * Session::newMessage(const std::string & msgType) const
 
 bool Session::send( Message& message )
 {
+  if( m_pAsyncSender )
+    return m_pAsyncSender->push( message ) != 0;
+
   message.getHeader().removeField( FIELD::PossDupFlag );
   message.getHeader().removeField( FIELD::OrigSendingTime );
   return sendRaw( message );
 }
 
-bool Session::sendRaw( Message& message, int num )
+bool Session::send( std::vector < Message >& messages )
+{
+  if( m_pAsyncSender )
+  {
+    bool result = true;
+    std::vector < Message > ::iterator i;
+    for( i = messages.begin(); i != messages.end(); ++i )
+      result = m_pAsyncSender->push( *i ) != 0 && result;
+    return result;
+  }
+
+  std::vector < Message* > pointers;
+  pointers.reserve( messages.size() );
+  std::vector < Message > ::iterator i;
+  for( i = messages.begin(); i != messages.end(); ++i )
+    pointers.push_back( &*i );
+  return sendBatch( pointers );
+}
+
+bool Session::send( Message& message, const SerializedBody& body )
+{
+  // the message goes on to the next session, so the queue gets a copy
+  if( m_pAsyncSender )
+  {
+    Message copy( message );
+    return m_pAsyncSender->push( copy ) != 0;
+  }
+
+  message.getHeader().removeField( FIELD::PossDupFlag );
+  message.getHeader().removeField( FIELD::OrigSendingTime );
+  return sendRaw( message, 0, &body );
+}
+
+void Session::setAsyncSend( int queueSize, AsyncSender::Backpressure backpressure )
+{
+  delete m_pAsyncSender;
+  m_pAsyncSender = 0;
+  if( queueSize > 0 )
+    m_pAsyncSender = new AsyncSender( *this, queueSize, backpressure );
+}
+
+uint64_t Session::sendAsync( Message& message )
+{
+  return m_pAsyncSender ? m_pAsyncSender->push( message ) : 0;
+}
+
+bool Session::waitForSend( uint64_t ticket, double seconds )
+{
+  return !m_pAsyncSender || m_pAsyncSender->wait( ticket, seconds );
+}
+
+bool Session::sendBatch( const std::vector < Message* >& messages )
 {
   Locker l( m_mutex );
+  m_batchSends = true;
+  m_sendBatch.clear();
+  m_storeBatch.clear();
+  bool result = true;
+
+  try
+  {
+    std::vector < Message* > ::const_iterator i;
+    for( i = messages.begin(); i != messages.end(); ++i )
+    {
+      Header& header = ( *i )->getHeader();
+      header.removeField( FIELD::PossDupFlag );
+      header.removeField( FIELD::OrigSendingTime );
+
+      // admin messages may reset the sequence numbers, so whatever came
+      // before them is stored first and they are persisted on their own
+      MsgType msgType;
+      header.getFieldIfSet( msgType );
+      if( Message::isAdminMsgType( msgType ) )
+        persistBatch();
+      else if( !m_batchSeqNum )
+        m_batchSeqNum = m_state.getNextSenderMsgSeqNum();
+
+      try
+      {
+        result = sendRaw( **i ) && result;
+      }
+      catch( std::exception& e )
+      {
+        m_state.onEvent( e.what() );
+        result = false;
+      }
+    }
+    persistBatch();
+  }
+  catch( IOException& e )
+  {
+    // nothing goes out that could not be stored for a resend
+    m_state.onEvent( e.what() );
+    m_batchSeqNum = 0;
+    m_sendBatch.clear();
+    result = false;
+  }
+
+  m_batchSends = false;
+  // one write for everything that went out
+  if( !m_sendBatch.empty() && m_pResponder )
+    result = m_pResponder->send( m_sendBatch ) && result;
+  return result;
+}
+
+bool Session::sendRaw( Message& message, int num, const SerializedBody* pBody )
+{
+  Locker l( m_mutex );
+  int64_t time = getLatencyHistograms() ? LatencyHistogram::now() : 0;
 
   try
   {
@@ -562,9 +797,15 @@ bool Session::sendRaw( Message& message, int num )
       }
 
       message.toString( messageString );
+      if( getLatencyHistograms() )
+        time = m_pLatency[ LATENCY_SERIALIZE ].recordSince( time );
 
       if( !num )
+      {
         persist( message, messageString );
+        if( getLatencyHistograms() )
+          time = m_pLatency[ LATENCY_PERSIST ].recordSince( time );
+      }
 
       if (
         msgType == "A" || msgType == "5"
@@ -572,6 +813,8 @@ bool Session::sendRaw( Message& message, int num )
         || isLoggedOn() )
       {
         send( messageString );
+        if( getLatencyHistograms() )
+          m_pLatency[ LATENCY_SEND ].recordSince( time );
       }
     }
     else
@@ -583,13 +826,36 @@ bool Session::sendRaw( Message& message, int num )
       try
       {
         m_application.toApp( message, m_sessionID );
-        message.toString( messageString );
+        if( pBody && !message.isBody( *pBody ) )
+          pBody = 0;
+        // a body serialized ahead is gathered from where it is when
+        // neither the store nor the log needs the message in one piece
+        std::string trailer;
+        if( !pBody )
+          message.toString( messageString );
+        else if( m_persistMessages || m_state.hasLog() || m_batchSends )
+          message.toString( *pBody, messageString );
+        else
+          message.toString( *pBody, messageString, trailer );
+        if( getLatencyHistograms() )
+          time = m_pLatency[ LATENCY_SERIALIZE ].recordSince( time );
 
         if( !num )
+        {
           persist( message, messageString );
+          if( getLatencyHistograms() )
+            time = m_pLatency[ LATENCY_PERSIST ].recordSince( time );
+        }
 
         if ( isLoggedOn() )
-          send( messageString );
+        {
+          if( trailer.empty() )
+            send( messageString );
+          else
+            send( messageString, pBody->string, trailer );
+          if( getLatencyHistograms() )
+            m_pLatency[ LATENCY_SEND ].recordSince( time );
+        }
       }
       catch ( DoNotSend& ) { return false; }
     }
@@ -605,11 +871,43 @@ bool Session::sendRaw( Message& message, int num )
 
 bool Session::send( const std::string& string )
 {
+  Locker l( m_mutex );
   if ( !m_pResponder ) return false;
-  m_state.onOutgoing( string );
+  if( getCollectMetrics() )
+  {
+    int64_t time = LatencyHistogram::now();
+    m_state.onOutgoing( string );
+    m_pMetrics->addWrite( SessionMetrics::LOG_WRITES, time );
+    m_pMetrics->add( SessionMetrics::MESSAGES_SENT );
+    m_pMetrics->add( SessionMetrics::BYTES_SENT, string.size() );
+  }
+  else
+    m_state.onOutgoing( string );
+
+  if( m_batchSends )
+  {
+    m_sendBatch += string;
+    return true;
+  }
   return m_pResponder->send( string );
 }
 
+bool Session::send( const std::string& header, const std::string& body,
+                    const std::string& trailer )
+{
+  Locker l( m_mutex );
+  if ( !m_pResponder ) return false;
+  if( getCollectMetrics() )
+  {
+    m_pMetrics->add( SessionMetrics::MESSAGES_SENT );
+    m_pMetrics->add( SessionMetrics::BYTES_SENT,
+                     header.size() + body.size() + trailer.size() );
+  }
+
+  const std::string* buffers[] = { &header, &body, &trailer };
+  return m_pResponder->sendBuffers( buffers, 3 );
+}
+
 void Session::disconnect()
 {
   Locker l(m_mutex);
@@ -663,11 +961,39 @@ bool Session::resend( Message& message )
 void Session::persist( const Message& message,  const std::string& messageString ) 
 EXCEPT ( IOException )
 {
+  if( m_batchSeqNum )
+  {
+    // stored with the rest of the batch by persistBatch()
+    if( m_persistMessages )
+      m_storeBatch.push_back( messageString );
+    ++m_batchSeqNum;
+    return;
+  }
+
   MsgSeqNum msgSeqNum;
   message.getHeader().getField( msgSeqNum );
+  // Database stores write the message together with the sequence
+  // number, so the write is timed across both calls
+  int64_t time = getCollectMetrics() && m_persistMessages ? LatencyHistogram::now() : 0;
   if( m_persistMessages )
     m_state.set( msgSeqNum, messageString );
   m_state.incrNextSenderMsgSeqNum();
+  if( time ) m_pMetrics->addWrite( SessionMetrics::STORE_WRITES, time );
+}
+
+void Session::persistBatch() EXCEPT ( IOException )
+{
+  int next = m_batchSeqNum;
+  m_batchSeqNum = 0;
+  int first = m_state.getNextSenderMsgSeqNum();
+  if( next <= first ) return;
+
+  int64_t time = getCollectMetrics() ? LatencyHistogram::now() : 0;
+  if( m_persistMessages )
+    m_state.setMany( first, m_storeBatch );
+  m_storeBatch.clear();
+  m_state.setNextSenderMsgSeqNum( next );
+  if( time ) m_pMetrics->addWrite( SessionMetrics::STORE_WRITES, time );
 }
 
 void Session::generateLogon()
@@ -768,6 +1094,7 @@ void Session::generateHeartbeat()
 
   heartbeat.getHeader().setField( MsgType( "0" ) );
   fill( heartbeat.getHeader() );
+  if( getCollectMetrics() ) m_pMetrics->add( SessionMetrics::HEARTBEATS_SENT );
   sendRaw( heartbeat );
 }
 
@@ -786,6 +1113,7 @@ void Session::generateHeartbeat( const Message& testRequest )
   }
   catch ( FieldNotFound& ) {}
 
+  if( getCollectMetrics() ) m_pMetrics->add( SessionMetrics::HEARTBEATS_SENT );
   sendRaw( heartbeat );
 }
 
@@ -799,6 +1127,7 @@ void Session::generateTestRequest( const std::string& id )
   TestReqID testReqID( id );
   testRequest.setField( testReqID );
 
+  if( getCollectMetrics() ) m_pMetrics->add( SessionMetrics::TEST_REQUESTS_SENT );
   sendRaw( testRequest );
 }
 
@@ -896,6 +1225,7 @@ void Session::generateReject( const Message& message, int err, int field )
   if ( !m_state.receivedLogon() )
     throw std::runtime_error( "Tried to send a reject while not logged on" );
 
+  if( getCollectMetrics() ) m_pMetrics->addReject( err );
   sendRaw( reject );
 }
 
@@ -923,6 +1253,7 @@ void Session::generateReject( const Message& message, const std::string& str )
     m_state.incrNextTargetMsgSeqNum();
 
   reject.setField( Text( str ) );
+  if( getCollectMetrics() ) m_pMetrics->addReject( -1 );
   sendRaw( reject );
   m_state.onEvent( "Message " + msgSeqNum.getString()
                    + " Rejected: " + str );
@@ -990,6 +1321,7 @@ void Session::generateBusinessReject( const Message& message, int err, int field
   else
     m_state.onEvent( "Message " + msgSeqNum.getString() + " Rejected" );
 
+  if( getCollectMetrics() ) m_pMetrics->add( SessionMetrics::BUSINESS_REJECTS_SENT );
   sendRaw( reject );
 }
 
@@ -1004,6 +1336,7 @@ void Session::generateLogout( const std::string& text )
     logout.setField( Text( text ) );
   sendRaw( logout );
   m_state.sentLogout( true );
+  reschedule();
 }
 
 void Session::populateRejectReason( Message& reject, int field,
@@ -1097,12 +1430,34 @@ bool Session::verify( const Message& msg, bool checkTooHigh,
 
   UtcTimeStamp now;
   m_state.lastReceivedTime( now );
-  m_state.testRequest( 0 );
+  // an answered test request brings the heartbeat deadline back
+  if ( m_state.testRequest() )
+  {
+    m_state.testRequest( 0 );
+    reschedule();
+  }
 
   fromCallback( pMsgType ? *pMsgType : MsgType(), msg, m_sessionID );
   return true;
 }
 
+bool Session::canSkipBody( const Message& message )
+{
+  try
+  {
+    return isLoggedOn() && message.isApp()
+      && isTargetTooLow( FIELD_GET_REF( message.getHeader(), MsgSeqNum ) );
+  }
+  catch( std::exception& ) { return false; }
+}
+
+bool Session::canDeferBody( const Message& message )
+{
+  if( m_lazyBodyMsgTypes.empty() || !message.isApp() ) return false;
+  const MsgType& msgType = FIELD_GET_REF( message.getHeader(), MsgType );
+  return m_lazyBodyMsgTypes.find( msgType ) != m_lazyBodyMsgTypes.end();
+}
+
 bool Session::shouldSendReset()
 {
   std::string beginString = m_sessionID.getBeginString();
@@ -1140,7 +1495,11 @@ void Session::fromCallback( const MsgType& msgType, const Message& msg,
   if ( Message::isAdminMsgType( msgType ) )
     m_application.fromAdmin( msg, m_sessionID );
   else
+  {
     m_application.fromApp( msg, m_sessionID );
+    if( m_validatedTime )
+      m_pLatency[ LATENCY_APPLICATION ].recordSince( m_validatedTime );
+  }
 }
 
 void Session::doBadTime( const Message& msg )
@@ -1216,7 +1575,20 @@ void Session::doTargetTooHigh( const Message& msg )
                    + " but received "
                    + IntConvertor::convert( msgSeqNum ) );
 
-  m_state.queue( msgSeqNum, msg );
+  if( !m_state.queue( msgSeqNum, msg ) )
+  {
+    m_state.onEvent( "Queue limit of "
+                     + IntConvertor::convert( m_state.maxQueueSize() )
+                     + " exceeded, discarding message: "
+                     + IntConvertor::convert( msgSeqNum ) );
+
+    if( m_disconnectOnQueueOverflow )
+    {
+      generateLogout( "Too many messages queued" );
+      disconnect();
+      return;
+    }
+  }
 
   if( m_state.resendRequested() )
   {
@@ -1237,50 +1609,83 @@ void Session::doTargetTooHigh( const Message& msg )
 
 void Session::nextQueued( const UtcTimeStamp& timeStamp )
 {
-  while ( nextQueued( getExpectedTargetNum(), timeStamp ) ) {}
-}
-
-bool Session::nextQueued( int num, const UtcTimeStamp& timeStamp )
-{
-  Message msg;
-  MsgType msgType;
+  SessionState::Messages messages;
+  int num = getExpectedTargetNum();
 
-  if( m_state.retrieve( num, msg ) )
+  while( m_state.retrieve( num, messages ) )
   {
-    m_state.onEvent( "Processing QUEUED message: "
-                     + IntConvertor::convert( num ) );
-    msg.getHeader().getField( msgType );
-    if( msgType == MsgType_Logon
-        || msgType == MsgType_ResendRequest )
+    int epoch = m_state.queueEpoch();
+    SessionState::Messages::size_type i = 0;
+
+    try
     {
-      m_state.incrNextTargetMsgSeqNum();
+      for( ; i < messages.size(); ++i, ++num )
+      {
+        if( num != getExpectedTargetNum() || epoch != m_state.queueEpoch() )
+          break;
+        SmartPtr<Message> pMsg( messages[ i ] );
+        messages[ i ] = 0;
+        nextQueued( num, *pMsg, timeStamp );
+      }
     }
-    else
+    catch( ... )
     {
-      next( msg, timeStamp, true );
+      for( i = 0; i < messages.size(); ++i )
+        delete messages[ i ];
+      throw;
     }
-    return true;
+
+    // give back what processing did not reach unless the queue was reset
+    for( ; i < messages.size(); ++i, ++num )
+    {
+      if( epoch == m_state.queueEpoch() && num > getExpectedTargetNum() )
+        m_state.queue( num, messages[ i ] );
+      else
+        delete messages[ i ];
+    }
+
+    messages.clear();
+    num = getExpectedTargetNum();
+  }
+}
+
+void Session::nextQueued( int num, const Message& msg, const UtcTimeStamp& timeStamp )
+{
+  MsgType msgType;
+
+  m_state.onEvent( "Processing QUEUED message: "
+                   + IntConvertor::convert( num ) );
+  msg.getHeader().getField( msgType );
+  if( msgType == MsgType_Logon
+      || msgType == MsgType_ResendRequest )
+  {
+    m_state.incrNextTargetMsgSeqNum();
+  }
+  else
+  {
+    next( msg, timeStamp, true );
   }
-  return false;
 }
 
 void Session::next( const std::string& msg, const UtcTimeStamp& timeStamp, bool queued )
 {
   try
   {
-    m_state.onIncoming( msg );
+    int64_t time = received( msg );
     const DataDictionary& sessionDD = 
       m_dataDictionaryProvider.getSessionDataDictionary(m_sessionID.getBeginString());
-    if( m_sessionID.isFIXT() )
-    {
-      const DataDictionary& applicationDD =
-        m_dataDictionaryProvider.getApplicationDataDictionary(m_senderDefaultApplVerID);
-      next( Message( msg, sessionDD, applicationDD, m_validateLengthAndChecksum ), timeStamp, queued );
-    }
-    else
-    {
-      next( Message( msg, sessionDD, m_validateLengthAndChecksum ), timeStamp, queued );
-    }
+    const DataDictionary& applicationDD = m_sessionID.isFIXT()
+      ? m_dataDictionaryProvider.getApplicationDataDictionary(m_senderDefaultApplVerID)
+      : sessionDD;
+
+    Message message;
+    message.setString( msg, m_validateLengthAndChecksum,
+                       &sessionDD, &applicationDD, m_lazyBodyParsing );
+    if( !message.isBodyParsed() && !canSkipBody( message )
+        && !canDeferBody( message ) )
+      message.parseBody();
+    recordLatency( LATENCY_PARSE, time );
+    next( message, timeStamp, queued );
   }
   catch( InvalidMessage& e )
   {
@@ -1298,9 +1703,67 @@ void Session::next( const std::string& msg, const UtcTimeStamp& timeStamp, bool
   }
 }
 
-void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool queued )
+int64_t Session::received( const std::string& msg )
+{
+  bool collectMetrics = getCollectMetrics();
+  int64_t time = collectMetrics || getLatencyHistograms() ? LatencyHistogram::now() : 0;
+  m_state.onIncoming( msg );
+  if( collectMetrics )
+  {
+    m_pMetrics->addWrite( SessionMetrics::LOG_WRITES, time );
+    m_pMetrics->add( SessionMetrics::MESSAGES_RECEIVED );
+    m_pMetrics->add( SessionMetrics::BYTES_RECEIVED, msg.size() );
+  }
+  return time;
+}
+
+bool Session::prepare( const std::string& msg, Message& message, bool& validated ) const
+{
+  validated = false;
+  const DataDictionary& sessionDD = 
+    m_dataDictionaryProvider.getSessionDataDictionary(m_sessionID.getBeginString());
+  const DataDictionary& applicationDD = m_sessionID.isFIXT()
+    ? m_dataDictionaryProvider.getApplicationDataDictionary(m_senderDefaultApplVerID)
+    : sessionDD;
+
+  try
+  {
+    message.setString( msg, m_validateLengthAndChecksum, &sessionDD, &applicationDD );
+  }
+  catch( InvalidMessage& ) { return false; }
+
+  try
+  {
+    if( m_sessionID.isFIXT() && message.isApp() )
+    {
+      // without ApplVerID the dictionary follows the logon of the counterparty
+      ApplVerID applVerID;
+      if( !message.getHeader().getFieldIfSet( applVerID ) )
+        return true;
+      DataDictionary::validate( message, &sessionDD,
+        &m_dataDictionaryProvider.getApplicationDataDictionary( applVerID ) );
+    }
+    else
+    {
+      sessionDD.validate( message );
+    }
+    validated = true;
+  }
+  catch( std::exception& ) {}
+  return true;
+}
+
+void Session::next( const std::string& msg, const Message& message, bool validated,
+                    const UtcTimeStamp& timeStamp )
+{
+  received( msg );
+  next( message, timeStamp, false, validated );
+}
+
+void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool queued, bool validated )
 {
   const Header& header = message.getHeader();
+  m_validatedTime = getLatencyHistograms() ? LatencyHistogram::now() : 0;
 
   try
   {
@@ -1329,22 +1792,41 @@ void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool
       }
     }
 
-    const DataDictionary& sessionDataDictionary = 
-        m_dataDictionaryProvider.getSessionDataDictionary(m_sessionID.getBeginString());
+    // a sequence number too low is turned away by verify on the header
+    // alone, and the application parses the body of deferred types itself;
+    // either way the header and trailer are still validated below
+    if( !message.isBodyParsed() && !canSkipBody( message )
+        && !canDeferBody( message ) )
+      message.parseBody();
 
-    if( m_sessionID.isFIXT() && message.isApp() )
-    {
-      ApplVerID applVerID = m_targetDefaultApplVerID;
-      header.getFieldIfSet(applVerID);
-      const DataDictionary& applicationDataDictionary = 
-        m_dataDictionaryProvider.getApplicationDataDictionary(applVerID);
-      DataDictionary::validate( message, &sessionDataDictionary, &applicationDataDictionary );
-    }
-    else
+    // prepare() may already have validated it on the reading thread
+    if( !validated )
     {
-      sessionDataDictionary.validate( message );
+      const DataDictionary& sessionDataDictionary = 
+          m_dataDictionaryProvider.getSessionDataDictionary(m_sessionID.getBeginString());
+
+      if( !message.isBodyParsed() )
+      {
+        // only the header and trailer, the body is left unvalidated
+        DataDictionary::validate( message, &sessionDataDictionary, 0 );
+      }
+      else if( m_sessionID.isFIXT() && message.isApp() )
+      {
+        ApplVerID applVerID = m_targetDefaultApplVerID;
+        header.getFieldIfSet(applVerID);
+        const DataDictionary& applicationDataDictionary = 
+          m_dataDictionaryProvider.getApplicationDataDictionary(applVerID);
+        DataDictionary::validate( message, &sessionDataDictionary, &applicationDataDictionary );
+      }
+      else
+      {
+        sessionDataDictionary.validate( message );
+      }
     }
 
+    if( m_validatedTime && !validated )
+      m_validatedTime = m_pLatency[ LATENCY_VALIDATE ].recordSince( m_validatedTime );
+
     if ( msgType == MsgType_Logon )
       nextLogon( message, timeStamp );
     else if ( msgType == MsgType_Heartbeat )
@@ -1482,6 +1964,85 @@ EXCEPT ( SessionNotFound )
                        TargetCompID( target ), qualifier );
 }
 
+bool Session::sendToTarget
+( std::vector < Message >& messages, const std::string& qualifier )
+EXCEPT ( SessionNotFound )
+{
+  if( messages.empty() ) return true;
+  try
+  {
+    SessionID sessionID = messages.front().getSessionID( qualifier );
+    return sendToTarget( messages, sessionID );
+  }
+  catch ( FieldNotFound& ) { throw SessionNotFound(); }
+}
+
+bool Session::sendToTarget
+( std::vector < Message >& messages, const SessionID& sessionID )
+EXCEPT ( SessionNotFound )
+{
+  Session* pSession = lookupSession( sessionID );
+  if ( !pSession ) throw SessionNotFound();
+  std::vector < Message > ::iterator i;
+  for( i = messages.begin(); i != messages.end(); ++i )
+    i->setSessionID( sessionID );
+  return pSession->send( messages );
+}
+
+bool Session::sendToTarget
+( std::vector < Message >& messages,
+  const SenderCompID& senderCompID,
+  const TargetCompID& targetCompID,
+  const std::string& qualifier )
+EXCEPT ( SessionNotFound )
+{
+  std::vector < Message > ::iterator i;
+  for( i = messages.begin(); i != messages.end(); ++i )
+  {
+    i->getHeader().setField( senderCompID );
+    i->getHeader().setField( targetCompID );
+  }
+  return sendToTarget( messages, qualifier );
+}
+
+bool Session::sendToTarget
+( std::vector < Message >& messages, const std::string& sender,
+  const std::string& target, const std::string& qualifier )
+EXCEPT ( SessionNotFound )
+{
+  return sendToTarget( messages, SenderCompID( sender ),
+                       TargetCompID( target ), qualifier );
+}
+
+int Session::sendToTargets
+( Message& message, const std::vector < SessionID >& sessionIDs )
+EXCEPT ( SessionNotFound )
+{
+  std::vector < Session* > sessions;
+  sessions.reserve( sessionIDs.size() );
+  std::vector < SessionID > ::const_iterator i;
+  for( i = sessionIDs.begin(); i != sessionIDs.end(); ++i )
+  {
+    Session* pSession = lookupSession( *i );
+    if ( !pSession ) throw SessionNotFound();
+    sessions.push_back( pSession );
+  }
+
+  SerializedBody body;
+  message.toBody( body );
+
+  // as with calling sendToTarget for each of them, what a session and its
+  // toApp leave in the header is seen by the next one
+  int sent = 0;
+  for( size_t j = 0; j < sessions.size(); ++j )
+  {
+    message.setSessionID( sessionIDs[ j ] );
+    if( sessions[ j ]->send( message, body ) )
+      ++sent;
+  }
+  return sent;
+}
+
 std::set<SessionID> Session::getSessions()
 {
   return s_sessionIDs;
@@ -35,6 +35,9 @@
 #include "Application.h"
 #include "Mutex.h"
 #include "Log.h"
+#include "LatencyHistogram.h"
+#include "SessionMetrics.h"
+#include "AsyncSender.h"
 #include <utility>
 #include <map>
 #include <queue>
@@ -53,9 +56,9 @@ public:
   virtual ~Session();
 
   void logon() 
-  { m_state.enabled( true ); m_state.logoutReason( "" ); }
+  { m_state.enabled( true ); m_state.logoutReason( "" ); reschedule(); }
   void logout( const std::string& reason = "" ) 
-  { m_state.enabled( false ); m_state.logoutReason( reason ); }
+  { m_state.enabled( false ); m_state.logoutReason( reason ); reschedule(); }
   bool isEnabled() 
   { return m_state.enabled(); }
 
@@ -94,6 +97,32 @@ public:
                             const std::string& targetCompID,
                             const std::string& qualifier = "" )
   EXCEPT ( SessionNotFound );
+  /**
+   * Send one application message to many sessions.  The body is serialized
+   * once; each session only fills in and serializes its own header and
+   * trailer, calls toApp and persists its copy as usual.  A session whose
+   * toApp changes the body serializes the whole message again.  Returns the number of sessions the message was sent to.
+   */
+  static int sendToTargets( Message& message,
+                            const std::vector < SessionID >& sessionIDs )
+  EXCEPT ( SessionNotFound );
+  /// Send messages as one batch, to the session of the first of them
+  static bool sendToTarget( std::vector < Message >& messages,
+                            const std::string& qualifier = "" )
+  EXCEPT ( SessionNotFound );
+  static bool sendToTarget( std::vector < Message >& messages,
+                            const SessionID& sessionID )
+  EXCEPT ( SessionNotFound );
+  static bool sendToTarget( std::vector < Message >& messages,
+                            const SenderCompID& senderCompID,
+                            const TargetCompID& targetCompID,
+                            const std::string& qualifier = "" )
+  EXCEPT ( SessionNotFound );
+  static bool sendToTarget( std::vector < Message >& messages,
+                            const std::string& senderCompID,
+                            const std::string& targetCompID,
+                            const std::string& qualifier = "" )
+  EXCEPT ( SessionNotFound );
 
   static std::set<SessionID> getSessions();
   static bool doesSessionExist( const SessionID& );
@@ -117,7 +146,7 @@ public:
   const TimeRange& getLogonTime()
     { return m_logonTime; }
   void setLogonTime( const TimeRange& value )
-    { m_logonTime = value; }
+    { m_logonTime = value; reschedule(); }
 
   const std::string& getSenderDefaultApplVerID()
     { return m_senderDefaultApplVerID; }
@@ -152,12 +181,12 @@ public:
   int getLogonTimeout()
     { return m_state.logonTimeout(); }
   void setLogonTimeout ( int value )
-    { m_state.logonTimeout( value ); }
+    { m_state.logonTimeout( value ); reschedule(); }
 
   int getLogoutTimeout()
     { return m_state.logoutTimeout(); }
   void setLogoutTimeout ( int value )
-    { m_state.logoutTimeout( value ); }
+    { m_state.logoutTimeout( value ); reschedule(); }
 
   bool getResetOnLogon()
     { return m_resetOnLogon; }
@@ -207,6 +236,101 @@ public:
   void setValidateLengthAndChecksum ( bool value )
     { m_validateLengthAndChecksum = value; }
 
+  bool getLazyBodyParsing()
+    { return m_lazyBodyParsing; }
+  void setLazyBodyParsing ( bool value )
+    { m_lazyBodyParsing = value; }
+
+  const std::set<std::string>& getLazyBodyMsgTypes()
+    { return m_lazyBodyMsgTypes; }
+  void setLazyBodyMsgTypes ( const std::set<std::string>& value )
+    { m_lazyBodyMsgTypes = value; }
+
+  int getMaxQueuedMessages()
+    { return m_state.maxQueueSize(); }
+  void setMaxQueuedMessages ( int value )
+    { m_state.maxQueueSize( value ); }
+
+  bool getDisconnectOnQueueOverflow()
+    { return m_disconnectOnQueueOverflow; }
+  void setDisconnectOnQueueOverflow ( bool value )
+    { m_disconnectOnQueueOverflow = value; }
+
+  /// Points in the handling of a message where latency is recorded
+  enum LatencyStage
+  {
+    /// socket read to framed as a message
+    LATENCY_FRAME,
+    /// framed to parsed into a Message
+    LATENCY_PARSE,
+    /// parsed to validated against the data dictionary
+    LATENCY_VALIDATE,
+    /// validated to fromApp returning
+    LATENCY_APPLICATION,
+    /// sendRaw entry, including toApp or toAdmin, to serialized
+    LATENCY_SERIALIZE,
+    /// serialized to persisted in the message store
+    LATENCY_PERSIST,
+    /// persisted to handed to the socket
+    LATENCY_SEND,
+    LATENCY_STAGES
+  };
+
+  /**
+   * Record latency histograms.  The histograms are allocated when first
+   * turned on and kept until the session is destroyed, so this may be
+   * switched while the session is running.
+   */
+  bool getLatencyHistograms() const
+    { return load( m_latencyHistograms ) != 0; }
+  void setLatencyHistograms( bool value );
+  /// Copy of the histogram for a stage, empty if never recorded
+  LatencyHistogram getLatencyHistogram( LatencyStage stage ) const;
+  void resetLatencyHistograms();
+  /// Record the time since start for a stage, if recording
+  void recordLatency( LatencyStage stage, int64_t start )
+    { if( start && getLatencyHistograms() ) m_pLatency[ stage ].recordSince( start ); }
+
+  /// Count traffic in SessionMetrics, kept like the latency histograms
+  bool getCollectMetrics() const
+    { return load( m_collectMetrics ) != 0; }
+  void setCollectMetrics( bool value );
+  /// Counters of the session, 0 if not collecting
+  const SessionMetrics* getMetrics() const
+    { return getCollectMetrics() ? m_pMetrics : 0; }
+  /// Count a transport spin that found data, or one that ran out and blocked
+  void countSpin( bool found )
+  {
+    if( getCollectMetrics() )
+      m_pMetrics->add( found ? SessionMetrics::SPIN_READS : SessionMetrics::SPIN_PARKS );
+  }
+  int getQueuedMessages() const
+    { return m_state.queueSize(); }
+
+  /**
+   * Queue messages passed to send() for a sender thread of the session
+   * instead of sending them on the calling thread, 0 to turn it off.
+   * send() then takes the contents of the messages, like sendAsync().
+   * To be set before the session is used.
+   */
+  void setAsyncSend( int queueSize,
+                     AsyncSender::Backpressure backpressure = AsyncSender::BLOCK );
+  int getAsyncSendQueueSize() const
+    { return m_pAsyncSender ? ( int ) m_pAsyncSender->capacity() : 0; }
+  /// Messages queued for the sender thread and not yet sent
+  size_t getAsyncSendQueued() const
+    { return m_pAsyncSender ? m_pAsyncSender->size() : 0; }
+  /**
+   * Queue a message for the sender thread, taking its contents.  Returns
+   * a ticket for waitForSend(), or 0 if the message was not queued because
+   * the queue was full or asynchronous sending is off.
+   */
+  uint64_t sendAsync( Message& );
+  /// Wait until a message queued by sendAsync() was sent, false on timeout
+  bool waitForSend( uint64_t ticket, double seconds );
+  /// Messages and bytes waiting in the transport to be written
+  void getSendQueue( size_t& messages, size_t& bytes );
+
   void setResponder( Responder* pR )
   {
     if( !checkSessionTime(UtcTimeStamp()) )
@@ -215,29 +339,66 @@ public:
   }
 
   bool send( Message& );
+  /**
+   * Send messages as one batch.  They get consecutive sequence numbers
+   * under one acquisition of the session lock, are persisted with one call
+   * to MessageStore::setMany() and go to the responder in one buffer.
+   * Returns false if any of them was not sent.
+   */
+  bool send( std::vector < Message >& messages );
+  /// Send an application message around a body serialized by Message::toBody(),
+  /// or serialized again if toApp changed the body
+  bool send( Message& message, const SerializedBody& body );
   void next();
   void next( const UtcTimeStamp& timeStamp );
   void next( const std::string&, const UtcTimeStamp& timeStamp, bool queued = false );
-  void next( const Message&, const UtcTimeStamp& timeStamp, bool queued = false );
+  void next( const Message& message, const UtcTimeStamp& timeStamp, bool queued = false )
+    { next( message, timeStamp, queued, false ); }
   void disconnect();
 
-  int getExpectedSenderNum() { return m_state.getNextSenderMsgSeqNum(); }
+  /**
+   * Parse a message and validate it against the data dictionary ahead of
+   * next().  Only reads the configuration of the session, so it may run on
+   * another thread than the one processing it.  Returns false if the string
+   * did not parse and has to be passed to next( const std::string& ).
+   * Messages that fail validation, or whose validation depends on the state
+   * of the session, come back with validated false and are checked by next.
+   */
+  bool prepare( const std::string& msg, Message& message, bool& validated ) const;
+  /// Process a message built by prepare() from the string msg
+  void next( const std::string& msg, const Message& message, bool validated,
+             const UtcTimeStamp& timeStamp );
+
+  /// Latest time at which next() must be called again
+  UtcTimeStamp getNextTimeout( const UtcTimeStamp& timeStamp );
+
+  int getExpectedSenderNum()
+  { return m_batchSeqNum ? m_batchSeqNum : m_state.getNextSenderMsgSeqNum(); }
   int getExpectedTargetNum() { return m_state.getNextTargetMsgSeqNum(); }
 
   Log* getLog() { return &m_state; }
   const MessageStore* getStore() { return &m_state; }
 
 private:
+  friend class AsyncSender;
+
   typedef std::map < SessionID, Session* > Sessions;
   typedef std::set < SessionID > SessionIDs;
 
   static bool addSession( Session& );
   static void removeSession( Session& );
 
+  void next( const Message&, const UtcTimeStamp& timeStamp, bool queued, bool validated );
+  int64_t received( const std::string& msg );
+
   bool send( const std::string& );
-  bool sendRaw( Message&, int msgSeqNum = 0 );
+  bool sendBatch( const std::vector < Message* >& messages );
+  bool send( const std::string& header, const std::string& body,
+             const std::string& trailer );
+  bool sendRaw( Message&, int msgSeqNum = 0, const SerializedBody* pBody = 0 );
   bool resend( Message& message );
   void persist( const Message&, const std::string& ) EXCEPT ( IOException );
+  void persistBatch() EXCEPT ( IOException );
 
   void insertSendingTime( Header& );
   void insertOrigSendingTime( Header&,
@@ -252,13 +413,40 @@ private:
   }
   bool checkSessionTime( const UtcTimeStamp& timeStamp )
   {
-    UtcTimeStamp creationTime = m_state.getCreationTime();
-    return m_sessionTime.isInSameRange( timeStamp, creationTime );
+    if( m_state.inSessionTime( timeStamp.getNanosSinceEpoch() ) )
+      return true;
+    return recheckSessionTime( timeStamp );
+  }
+  bool recheckSessionTime( const UtcTimeStamp& timeStamp );
+
+  static long load( const volatile long& flag )
+  {
+#ifdef _MSC_VER
+    long value = flag;
+    MemoryBarrier();
+    return value;
+#else
+    return __atomic_load_n( &flag, __ATOMIC_ACQUIRE );
+#endif
+  }
+
+  static void store( volatile long& flag, long value )
+  {
+#ifdef _MSC_VER
+    MemoryBarrier();
+    flag = value;
+#else
+    __atomic_store_n( &flag, value, __ATOMIC_RELEASE );
+#endif
   }
+  /// Tell the responder that getNextTimeout() may return an earlier time
+  void reschedule();
   bool isTargetTooHigh( const MsgSeqNum& msgSeqNum )
   { return msgSeqNum > ( m_state.getNextTargetMsgSeqNum() ); }
   bool isTargetTooLow( const MsgSeqNum& msgSeqNum )
   { return msgSeqNum < ( m_state.getNextTargetMsgSeqNum() ); }
+  bool canSkipBody( const Message& message );
+  bool canDeferBody( const Message& message );
   bool isCorrectCompID( const SenderCompID& senderCompID,
                         const TargetCompID& targetCompID )
   {
@@ -280,7 +468,7 @@ private:
   bool doTargetTooLow( const Message& msg );
   void doTargetTooHigh( const Message& msg );
   void nextQueued( const UtcTimeStamp& timeStamp );
-  bool nextQueued( int num, const UtcTimeStamp& timeStamp );
+  void nextQueued( int num, const Message&, const UtcTimeStamp& timeStamp );
 
   void nextLogon( const Message&, const UtcTimeStamp& timeStamp );
   void nextHeartbeat( const Message&, const UtcTimeStamp& timeStamp );
@@ -331,13 +519,27 @@ private:
   int m_timestampPrecision;
   bool m_persistMessages;
   bool m_validateLengthAndChecksum;
+  bool m_lazyBodyParsing;
+  std::set<std::string> m_lazyBodyMsgTypes;
+  bool m_disconnectOnQueueOverflow;
 
   SessionState m_state;
   DataDictionaryProvider m_dataDictionaryProvider;
   MessageStoreFactory& m_messageStoreFactory;
   LogFactory* m_pLogFactory;
   Responder* m_pResponder;
-  Mutex m_mutex;
+  // allocated once, the flags are set after and cleared before use
+  LatencyHistogram* m_pLatency;
+  SessionMetrics* m_pMetrics;
+  volatile long m_latencyHistograms;
+  volatile long m_collectMetrics;
+  int64_t m_validatedTime;
+  AsyncSender* m_pAsyncSender;
+  bool m_batchSends;
+  std::string m_sendBatch;
+  int m_batchSeqNum;
+  std::vector < std::string > m_storeBatch;
+  mutable Mutex m_mutex;
 
   static Sessions s_sessions;
   static SessionIDs s_sessionIDs;
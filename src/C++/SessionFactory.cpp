@@ -196,6 +196,45 @@ Session* SessionFactory::create( const SessionID& sessionID,
     pSession->setPersistMessages( settings.getBool( PERSIST_MESSAGES ) );
   if ( settings.has( VALIDATE_LENGTH_AND_CHECKSUM ) )
     pSession->setValidateLengthAndChecksum( settings.getBool( VALIDATE_LENGTH_AND_CHECKSUM ) );
+  if ( settings.has( LAZY_BODY_PARSING ) )
+    pSession->setLazyBodyParsing( settings.getBool( LAZY_BODY_PARSING ) );
+  if ( settings.has( LAZY_BODY_MSG_TYPES ) )
+  {
+    // a comma separated list of MsgType values, like W,X
+    std::string value = settings.getString( LAZY_BODY_MSG_TYPES );
+    std::set<std::string> msgTypes;
+    std::string::size_type pos = 0;
+    while( pos <= value.size() )
+    {
+      std::string::size_type end = value.find( ',', pos );
+      if( end == std::string::npos ) end = value.size();
+      std::string msgType = string_strip( value.substr( pos, end - pos ) );
+      pos = end + 1;
+      if( !msgType.empty() ) msgTypes.insert( msgType );
+    }
+    pSession->setLazyBodyMsgTypes( msgTypes );
+  }
+  if ( settings.has( MAX_QUEUED_MESSAGES ) )
+    pSession->setMaxQueuedMessages( settings.getInt( MAX_QUEUED_MESSAGES ) );
+  if ( settings.has( DISCONNECT_ON_QUEUE_OVERFLOW ) )
+    pSession->setDisconnectOnQueueOverflow( settings.getBool( DISCONNECT_ON_QUEUE_OVERFLOW ) );
+  if ( settings.has( LATENCY_HISTOGRAMS ) )
+    pSession->setLatencyHistograms( settings.getBool( LATENCY_HISTOGRAMS ) );
+  if ( settings.has( COLLECT_METRICS ) )
+    pSession->setCollectMetrics( settings.getBool( COLLECT_METRICS ) );
+  if ( settings.has( ASYNC_SEND_QUEUE_SIZE ) )
+  {
+    AsyncSender::Backpressure backpressure = AsyncSender::BLOCK;
+    if ( settings.has( ASYNC_SEND_BACKPRESSURE ) )
+    {
+      std::string value = string_toLower( settings.getString( ASYNC_SEND_BACKPRESSURE ) );
+      if ( value == "reject" )
+        backpressure = AsyncSender::REJECT;
+      else if ( value != "block" )
+        throw ConfigError( std::string( ASYNC_SEND_BACKPRESSURE ) + " must be block or reject" );
+    }
+    pSession->setAsyncSend( settings.getInt( ASYNC_SEND_QUEUE_SIZE ), backpressure );
+  }
    
   return pSession.release();
 }
@@ -0,0 +1,96 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "SessionMetrics.h"
+#include <string.h>
+
+namespace FIX
+{
+THREAD_LOCAL int SessionMetrics::s_shard = -1;
+
+int SessionMetrics::nextShard()
+{
+  static uint64_t threads = 0;
+#ifdef _MSC_VER
+  uint64_t thread = ( uint64_t ) InterlockedExchangeAdd64
+    ( ( volatile LONGLONG* ) &threads, 1 );
+#elif defined(__GNUC__)
+  uint64_t thread = __sync_fetch_and_add( &threads, 1 );
+#else
+  uint64_t thread = threads++;
+#endif
+  return ( int ) ( thread & ( SHARDS - 1 ) );
+}
+
+void SessionMetrics::getSnapshot( Snapshot& snapshot ) const
+{
+  memset( snapshot.counts, 0, sizeof(snapshot.counts) );
+  for( int i = 0; i < SHARDS; ++i )
+  {
+    for( int j = 0; j < COUNTERS; ++j )
+      snapshot.counts[ j ] += m_shards[ i ].m_counts[ j ];
+  }
+}
+
+uint64_t SessionMetrics::get( Counter counter ) const
+{
+  uint64_t result = 0;
+  for( int i = 0; i < SHARDS; ++i )
+    result += m_shards[ i ].m_counts[ counter ];
+  return result;
+}
+
+void SessionMetrics::reset()
+{
+  for( int i = 0; i < SHARDS; ++i )
+    memset( m_shards[ i ].m_counts, 0, sizeof(m_shards[ i ].m_counts) );
+}
+
+const char* SessionMetrics::getName( Counter counter )
+{
+  switch( counter )
+  {
+  case MESSAGES_RECEIVED: return "messages_received";
+  case BYTES_RECEIVED: return "bytes_received";
+  case MESSAGES_SENT: return "messages_sent";
+  case BYTES_SENT: return "bytes_sent";
+  case HEARTBEATS_RECEIVED: return "heartbeats_received";
+  case HEARTBEATS_SENT: return "heartbeats_sent";
+  case TEST_REQUESTS_RECEIVED: return "test_requests_received";
+  case TEST_REQUESTS_SENT: return "test_requests_sent";
+  case REJECTS_RECEIVED: return "rejects_received";
+  case BUSINESS_REJECTS_SENT: return "business_rejects_sent";
+  case RESEND_REQUESTS_SERVED: return "resend_requests_served";
+  case MESSAGES_RESENT: return "messages_resent";
+  case STORE_WRITES: return "store_writes";
+  case STORE_WRITE_NANOSECONDS: return "store_write_nanoseconds";
+  case LOG_WRITES: return "log_writes";
+  case LOG_WRITE_NANOSECONDS: return "log_write_nanoseconds";
+  case SPIN_READS: return "spin_reads";
+  case SPIN_PARKS: return "spin_parks";
+  default: return "rejects_sent";
+  }
+}
+}
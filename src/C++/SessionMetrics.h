@@ -0,0 +1,146 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_SESSIONMETRICS_H
+#define FIX_SESSIONMETRICS_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "LatencyHistogram.h"
+#include "Utility.h"
+
+namespace FIX
+{
+/**
+ * Counters describing the traffic on a session.
+ *
+ * Each counter is kept in 16 shards, each on its own cache lines.  A
+ * thread is handed the next shard in turn the first time it counts
+ * anything and keeps it, so the first 16 threads of the process never
+ * share cache lines with each other.  Further threads share shards round
+ * robin; their counts stay exact, as shards are updated atomically, only
+ * the cache lines are contended.  No lock is taken, and shards are only
+ * summed when the counters are read.
+ */
+class SessionMetrics
+{
+public:
+  /// Session level reject reasons 0 to 18 are counted apart, others together
+  enum { REJECT_REASONS = 20 };
+
+  enum Counter
+  {
+    MESSAGES_RECEIVED,
+    BYTES_RECEIVED,
+    MESSAGES_SENT,
+    BYTES_SENT,
+    HEARTBEATS_RECEIVED,
+    HEARTBEATS_SENT,
+    TEST_REQUESTS_RECEIVED,
+    TEST_REQUESTS_SENT,
+    REJECTS_RECEIVED,
+    BUSINESS_REJECTS_SENT,
+    RESEND_REQUESTS_SERVED,
+    MESSAGES_RESENT,
+    STORE_WRITES,
+    STORE_WRITE_NANOSECONDS,
+    LOG_WRITES,
+    LOG_WRITE_NANOSECONDS,
+    SPIN_READS,
+    SPIN_PARKS,
+    REJECTS_SENT,
+    COUNTERS = REJECTS_SENT + REJECT_REASONS
+  };
+
+  struct Snapshot
+  {
+    uint64_t counts[ COUNTERS ];
+  };
+
+  SessionMetrics() { reset(); }
+
+  void add( Counter counter, uint64_t value = 1 )
+  { increment( m_shards[ shard() ].m_counts[ counter ], value ); }
+
+  /// Count a session level reject sent with the given SessionRejectReason
+  void addReject( int reason )
+  {
+    if( reason < 0 || reason >= REJECT_REASONS )
+      reason = REJECT_REASONS - 1;
+    add( ( Counter ) ( REJECTS_SENT + reason ), 1 );
+  }
+
+  /// Count one write and the nanoseconds it took since start
+  void addWrite( Counter counter, int64_t start )
+  {
+    Shard& shard = m_shards[ this->shard() ];
+    increment( shard.m_counts[ counter ], 1 );
+    int64_t elapsed = LatencyHistogram::now() - start;
+    increment( shard.m_counts[ counter + 1 ], elapsed > 0 ? elapsed : 0 );
+  }
+
+  /// Sum of all shards
+  void getSnapshot( Snapshot& ) const;
+  uint64_t get( Counter ) const;
+  void reset();
+
+  /// Name of a counter, in lower case with words separated by '_'
+  static const char* getName( Counter );
+
+private:
+  enum { SHARDS = 16, CACHE_LINE = 64 };
+
+  struct Shard
+  {
+    uint64_t m_counts[ COUNTERS ];
+    // keeps the counts of neighbouring shards on different lines
+    char m_padding[ CACHE_LINE ];
+  };
+
+  static int shard()
+  {
+    if( s_shard < 0 )
+      s_shard = nextShard();
+    return s_shard;
+  }
+
+  static int nextShard();
+  /// shard of the calling thread, -1 until it first counts something
+  static THREAD_LOCAL int s_shard;
+
+  static void increment( uint64_t& counter, uint64_t value )
+  {
+#ifdef _MSC_VER
+    InterlockedExchangeAdd64( ( volatile LONGLONG* ) &counter, ( LONGLONG ) value );
+#elif defined(__GNUC__)
+    __sync_fetch_and_add( &counter, value );
+#else
+    counter += value;
+#endif
+  }
+
+  Shard m_shards[ SHARDS ];
+};
+}
+
+#endif //FIX_SESSIONMETRICS_H
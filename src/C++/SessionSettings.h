@@ -68,8 +68,19 @@ const char SOCKET_CONNECT_SOURCE_PORT[] = "SocketConnectSourcePort";
 const char SOCKET_NODELAY[] = "SocketNodelay";
 const char SOCKET_SEND_BUFFER_SIZE[] = "SocketSendBufferSize";
 const char SOCKET_RECEIVE_BUFFER_SIZE[] = "SocketReceiveBufferSize";
+const char SOCKET_BUSY_POLL[] = "SocketBusyPoll";
+const char SOCKET_SPIN_TIME[] = "SocketSpinTime";
+const char INBOUND_PIPELINE_DEPTH[] = "InboundPipelineDepth";
+const char THREAD_AFFINITY[] = "ThreadAffinity";
+const char URING_QUEUE_DEPTH[] = "UringQueueDepth";
+const char URING_BUFFER_COUNT[] = "UringBufferCount";
+const char URING_SQ_POLL[] = "UringSQPoll";
 const char RECONNECT_INTERVAL[] = "ReconnectInterval";
 const char VALIDATE_LENGTH_AND_CHECKSUM[] = "ValidateLengthAndChecksum";
+const char LAZY_BODY_PARSING[] = "LazyBodyParsing";
+const char LAZY_BODY_MSG_TYPES[] = "LazyBodyMsgTypes";
+const char ASYNC_SEND_QUEUE_SIZE[] = "AsyncSendQueueSize";
+const char ASYNC_SEND_BACKPRESSURE[] = "AsyncSendBackpressure";
 const char VALIDATE_FIELDS_OUT_OF_ORDER[] = "ValidateFieldsOutOfOrder";
 const char VALIDATE_FIELDS_HAVE_VALUES[] = "ValidateFieldsHaveValues";
 const char VALIDATE_USER_DEFINED_FIELDS[] = "ValidateUserDefinedFields";
@@ -84,15 +95,21 @@ const char MYSQL_STORE_USER[] = "MySQLStoreUser";
 const char MYSQL_STORE_PASSWORD[] = "MySQLStorePassword";
 const char MYSQL_STORE_HOST[] = "MySQLStoreHost";
 const char MYSQL_STORE_PORT[] = "MySQLStorePort";
+const char MYSQL_STORE_BATCH_SIZE[] = "MySQLStoreBatchSize";
+const char MYSQL_STORE_BATCH_INTERVAL[] = "MySQLStoreBatchInterval";
 const char POSTGRESQL_STORE_USECONNECTIONPOOL[] = "PostgreSQLStoreUseConnectionPool";
 const char POSTGRESQL_STORE_DATABASE[] = "PostgreSQLStoreDatabase";
 const char POSTGRESQL_STORE_USER[] = "PostgreSQLStoreUser";
 const char POSTGRESQL_STORE_PASSWORD[] = "PostgreSQLStorePassword";
 const char POSTGRESQL_STORE_HOST[] = "PostgreSQLStoreHost";
 const char POSTGRESQL_STORE_PORT[] = "PostgreSQLStorePort";
+const char POSTGRESQL_STORE_BATCH_SIZE[] = "PostgreSQLStoreBatchSize";
+const char POSTGRESQL_STORE_BATCH_INTERVAL[] = "PostgreSQLStoreBatchInterval";
 const char ODBC_STORE_USER[] = "OdbcStoreUser";
 const char ODBC_STORE_PASSWORD[] = "OdbcStorePassword";
 const char ODBC_STORE_CONNECTION_STRING[] = "OdbcStoreConnectionString";
+const char ODBC_STORE_BATCH_SIZE[] = "OdbcStoreBatchSize";
+const char ODBC_STORE_BATCH_INTERVAL[] = "OdbcStoreBatchInterval";
 const char FILE_LOG_PATH[] = "FileLogPath";
 const char FILE_LOG_BACKUP_PATH[] = "FileLogBackupPath";
 const char SCREEN_LOG_SHOW_INCOMING[] = "ScreenLogShowIncoming";
@@ -107,6 +124,8 @@ const char MYSQL_LOG_PORT[] = "MySQLLogPort";
 const char MYSQL_LOG_INCOMING_TABLE[] = "MySQLLogIncomingTable";
 const char MYSQL_LOG_OUTGOING_TABLE[] = "MySQLLogOutgoingTable";
 const char MYSQL_LOG_EVENT_TABLE[] = "MySQLLogEventTable";
+const char MYSQL_LOG_BATCH_SIZE[] = "MySQLLogBatchSize";
+const char MYSQL_LOG_BATCH_INTERVAL[] = "MySQLLogBatchInterval";
 const char POSTGRESQL_LOG_USECONNECTIONPOOL[] = "PostgreSQLLogUseConnectionPool";
 const char POSTGRESQL_LOG_DATABASE[] = "PostgreSQLLogDatabase";
 const char POSTGRESQL_LOG_USER[] = "PostgreSQLLogUser";
@@ -116,12 +135,19 @@ const char POSTGRESQL_LOG_PORT[] = "PostgreSQLLogPort";
 const char POSTGRESQL_LOG_INCOMING_TABLE[] = "PostgreSQLLogIncomingTable";
 const char POSTGRESQL_LOG_OUTGOING_TABLE[] = "PostgreSQLLogOutgoingTable";
 const char POSTGRESQL_LOG_EVENT_TABLE[] = "PostgreSQLLogEventTable";
+const char POSTGRESQL_LOG_BATCH_SIZE[] = "PostgreSQLLogBatchSize";
+const char POSTGRESQL_LOG_BATCH_INTERVAL[] = "PostgreSQLLogBatchInterval";
+const char POSTGRESQL_LOG_COPY[] = "PostgreSQLLogCopy";
+const char POSTGRESQL_LOG_COPY_BUFFER_SIZE[] = "PostgreSQLLogCopyBufferSize";
+const char POSTGRESQL_LOG_COPY_INTERVAL[] = "PostgreSQLLogCopyInterval";
 const char ODBC_LOG_USER[] = "OdbcLogUser";
 const char ODBC_LOG_PASSWORD[] = "OdbcLogPassword";
 const char ODBC_LOG_CONNECTION_STRING[] = "OdbcLogConnectionString";
 const char ODBC_LOG_INCOMING_TABLE[] = "OdbcLogIncomingTable";
 const char ODBC_LOG_OUTGOING_TABLE[] = "OdbcLogOutgoingTable";
 const char ODBC_LOG_EVENT_TABLE[] = "OdbcLogEventTable";
+const char ODBC_LOG_BATCH_SIZE[] = "OdbcLogBatchSize";
+const char ODBC_LOG_BATCH_INTERVAL[] = "OdbcLogBatchInterval";
 const char RESET_ON_LOGON[] = "ResetOnLogon";
 const char RESET_ON_LOGOUT[] = "ResetOnLogout";
 const char RESET_ON_DISCONNECT[] = "ResetOnDisconnect";
@@ -130,6 +156,10 @@ const char MILLISECONDS_IN_TIMESTAMP[] = "MillisecondsInTimeStamp";
 const char TIMESTAMP_PRECISION[] = "TimestampPrecision";
 const char HTTP_ACCEPT_PORT[] = "HttpAcceptPort";
 const char PERSIST_MESSAGES[] = "PersistMessages";
+const char MAX_QUEUED_MESSAGES[] = "MaxQueuedMessages";
+const char DISCONNECT_ON_QUEUE_OVERFLOW[] = "DisconnectOnQueueOverflow";
+const char LATENCY_HISTOGRAMS[] = "LatencyHistograms";
+const char COLLECT_METRICS[] = "CollectMetrics";
 const char SERVER_CERT_FILE[] = "ServerCertificateFile";
 const char SERVER_CERT_KEY_FILE[] = "ServerCertificateKeyFile";
 const char CLIENT_CERT_FILE[] = "ClientCertificateFile";
@@ -214,6 +244,9 @@ const char SSL_PROTOCOL[] = "SSLProtocol";
 # Example: RC4+RSA:+HIGH:
 */
 const char SSL_CIPHER_SUITE[] = "SSLCipherSuite";
+const char SSL_HANDSHAKE_THREADS[] = "SSLHandshakeThreads";
+const char SSL_HANDSHAKE_TIMEOUT[] = "SSLHandshakeTimeout";
+const char SSL_SESSION_RESUMPTION[] = "SSLSessionResumption";
 
 
 /// Container for setting dictionaries mapped to sessions.
@@ -28,6 +28,7 @@
 
 #include "FieldTypes.h"
 #include "MessageStore.h"
+#include "SequenceBuffer.h"
 #include "Log.h"
 #include "Mutex.h"
 
@@ -36,16 +37,17 @@ namespace FIX
 /// Maintains all of state for the Session class.
 class SessionState : public MessageStore, public Log
 {
-  typedef std::map < int, Message > Messages;
-
 public:
+  typedef SequenceBuffer::Messages Messages;
+
   SessionState()
 : m_enabled( true ), m_receivedLogon( false ),
   m_sentLogout( false ), m_sentLogon( false ),
   m_sentReset( false ), m_receivedReset( false ),
   m_initiate( false ), m_logonTimeout( 10 ), 
   m_logoutTimeout( 2 ), m_testRequest( 0 ),
-  m_pStore( 0 ), m_pLog( 0 ) {}
+  m_sessionTimeBegin( 0 ), m_sessionTimeEnd( 0 ),
+  m_queueEpoch( 0 ), m_pStore( 0 ), m_pLog( 0 ) {}
 
   bool enabled() const { return m_enabled; }
   void enabled( bool value ) { m_enabled = value; }
@@ -89,6 +91,7 @@ public:
   MessageStore* store() { return m_pStore; }
   void store( MessageStore* pValue ) { m_pStore = pValue; }
   Log* log() { return m_pLog ? m_pLog : &m_nullLog; }
+  bool hasLog() const { return m_pLog != 0; }
   void log( Log* pValue ) { m_pLog = pValue; }
 
   void heartBtInt( const HeartBtInt& value )
@@ -117,60 +120,113 @@ public:
   bool logonTimedOut() const
   {
     UtcTimeStamp now;
-    return now - lastReceivedTime() >= logonTimeout();
+    return elapsed( now, lastReceivedTime() ) >= logonTimeout();
   }
   bool logoutTimedOut() const
   {
     UtcTimeStamp now;
-    return sentLogout() && ( ( now - lastSentTime() ) >= logoutTimeout() );
+    return sentLogout() && ( elapsed( now, lastSentTime() ) >= logoutTimeout() );
   }
   bool withinHeartBeat() const
   {
     UtcTimeStamp now;
-    return ( ( now - lastSentTime() ) < heartBtInt() ) &&
-           ( ( now - lastReceivedTime() ) < heartBtInt() );
+    return ( elapsed( now, lastSentTime() ) < heartBtInt() ) &&
+           ( elapsed( now, lastReceivedTime() ) < heartBtInt() );
   }
   bool timedOut() const
   {
     UtcTimeStamp now;
-    return ( now - lastReceivedTime() ) >= ( 2.4 * ( double ) heartBtInt() );
+    return elapsed( now, lastReceivedTime() ) >= ( 2.4 * ( double ) heartBtInt() );
   }
   bool needHeartbeat() const
   {
     UtcTimeStamp now;
-    return ( ( now - lastSentTime() ) >= heartBtInt() ) && !testRequest();
+    return ( elapsed( now, lastSentTime() ) >= heartBtInt() ) && !testRequest();
   }
   bool needTestRequest() const
   {
     UtcTimeStamp now;
-    return ( now - lastReceivedTime() ) >=
+    return elapsed( now, lastReceivedTime() ) >=
            ( ( 1.2 * ( ( double ) testRequest() + 1 ) ) * ( double ) heartBtInt() );
   }
 
+  /**
+   * Earliest instant after now at which one of the timeouts above can
+   * become due, but no later than limit.
+   */
+  UtcTimeStamp nextTimeout( const UtcTimeStamp& now, const UtcTimeStamp& limit ) const
+  {
+    UtcTimeStamp result = limit;
+    if ( alreadySentLogon() && !receivedLogon() )
+      earliest( result, now, later( lastReceivedTime(), logonTimeout() ) );
+    if ( sentLogout() )
+      earliest( result, now, later( lastSentTime(), logoutTimeout() ) );
+    if ( receivedLogon() && heartBtInt() > 0 )
+    {
+      double heartBtInt = this->heartBtInt();
+      if ( !testRequest() )
+        earliest( result, now, later( lastSentTime(), heartBtInt ) );
+      earliest( result, now, later( lastReceivedTime(),
+                1.2 * ( ( double ) testRequest() + 1 ) * heartBtInt ) );
+      earliest( result, now, later( lastReceivedTime(), 2.4 * heartBtInt ) );
+    }
+    return result;
+  }
+
+  /**
+   * Interval, in nanoseconds since the epoch, over which the session time
+   * is known to match the store creation time.  Cleared by reset() and
+   * refresh(), and only set while the store still has the creation time
+   * it was checked against.
+   */
+  bool inSessionTime( int64_t now ) const
+  {
+    Locker l( m_mutex );
+    return now >= m_sessionTimeBegin && now < m_sessionTimeEnd;
+  }
+  void sessionTime( int64_t begin, int64_t end, const UtcTimeStamp& creationTime )
+  EXCEPT ( IOException )
+  {
+    Locker l( m_mutex );
+    if( m_pStore->getCreationTime() != creationTime ) return;
+    m_sessionTimeBegin = begin;
+    m_sessionTimeEnd = end;
+  }
+  void clearSessionTime()
+  { Locker l( m_mutex ); m_sessionTimeBegin = m_sessionTimeEnd = 0; }
+
   std::string logoutReason() const 
   { Locker l( m_mutex ); return m_logoutReason; }
   void logoutReason( const std::string& value ) 
   { Locker l( m_mutex ); m_logoutReason = value; }
 
-  void queue( int msgSeqNum, const Message& message )
-  { Locker l( m_mutex ); m_queue[ msgSeqNum ] = message; }
-  bool retrieve( int msgSeqNum, Message& message )
+  bool queue( int msgSeqNum, const Message& message )
+  { return queue( msgSeqNum, new Message( message ) ); }
+  bool queue( int msgSeqNum, Message* pMessage )
   {
     Locker l( m_mutex );
-    Messages::iterator i = m_queue.find( msgSeqNum );
-    if ( i != m_queue.end() )
-    {
-      message = i->second;
-      m_queue.erase( i );
-      return true;
-    }
-    return false;
+    return m_queue.push( m_pStore->getNextTargetMsgSeqNum(), msgSeqNum, pMessage );
   }
+  bool retrieve( int msgSeqNum, Message& message )
+  { Locker l( m_mutex ); return m_queue.pop( msgSeqNum, message ); }
+  int retrieve( int msgSeqNum, Messages& messages )
+  { Locker l( m_mutex ); return m_queue.pop( msgSeqNum, messages ); }
   void clearQueue()
-  { Locker l( m_mutex ); m_queue.clear(); }
+  { Locker l( m_mutex ); m_queue.clear(); ++m_queueEpoch; }
+  int queueSize() const
+  { Locker l( m_mutex ); return m_queue.size(); }
+  /// Incremented whenever the queue is cleared
+  int queueEpoch() const
+  { Locker l( m_mutex ); return m_queueEpoch; }
+  int maxQueueSize() const
+  { Locker l( m_mutex ); return m_queue.maxSize(); }
+  void maxQueueSize( int value )
+  { Locker l( m_mutex ); m_queue.maxSize( value ); }
 
   bool set( int s, const std::string& m ) EXCEPT ( IOException )
   { Locker l( m_mutex ); return m_pStore->set( s, m ); }
+  bool setMany( int s, const std::vector < std::string >& m ) EXCEPT ( IOException )
+  { Locker l( m_mutex ); return m_pStore->setMany( s, m ); }
   void get( int b, int e, std::vector < std::string > &m ) const
   EXCEPT ( IOException )
   { Locker l( m_mutex ); m_pStore->get( b, e, m ); }
@@ -189,9 +245,11 @@ public:
   UtcTimeStamp getCreationTime() const EXCEPT ( IOException )
   { Locker l( m_mutex ); return m_pStore->getCreationTime(); }
   void reset() EXCEPT ( IOException )
-  { Locker l( m_mutex ); m_pStore->reset(); }
+  { Locker l( m_mutex ); clearSessionTime(); m_pStore->reset(); }
   void refresh() EXCEPT ( IOException )
-  { Locker l( m_mutex ); m_pStore->refresh(); }
+  { Locker l( m_mutex ); clearSessionTime(); m_pStore->refresh(); }
+  void flush() EXCEPT ( IOException )
+  { Locker l( m_mutex ); m_pStore->flush(); }
 
   void clear()
   { if ( !m_pLog ) return ; Locker l( m_mutex ); m_pLog->clear(); }
@@ -205,6 +263,29 @@ public:
   { if ( !m_pLog ) return ; Locker l( m_mutex ); m_pLog->onEvent( string ); }
 
 private:
+  /// Seconds between two timestamps, including the fraction
+  static double elapsed( const UtcTimeStamp& now, const UtcTimeStamp& then )
+  {
+    return ( double ) ( now.getNanosSinceEpoch() - then.getNanosSinceEpoch() )
+           / DateTime::NANOS_PER_SEC;
+  }
+
+  static UtcTimeStamp later( const UtcTimeStamp& time, double seconds )
+  {
+    UtcTimeStamp result = time;
+    int64_t nanos = time.m_time + ( int64_t ) ( seconds * DateTime::NANOS_PER_SEC );
+    result.set( time.getJulianDate() + ( int ) ( nanos / DateTime::NANOS_PER_DAY ),
+                nanos % DateTime::NANOS_PER_DAY );
+    return result;
+  }
+
+  /// Lower result to time unless time has already passed
+  static void earliest( UtcTimeStamp& result, const UtcTimeStamp& now, const UtcTimeStamp& time )
+  {
+    if ( time > now && time < result )
+      result = time;
+  }
+
   bool m_enabled;
   bool m_receivedLogon;
   bool m_sentLogout;
@@ -220,7 +301,10 @@ private:
   UtcTimeStamp m_lastSentTime;
   UtcTimeStamp m_lastReceivedTime;
   std::string m_logoutReason;
-  Messages m_queue;
+  int64_t m_sessionTimeBegin;
+  int64_t m_sessionTimeEnd;
+  SequenceBuffer m_queue;
+  int m_queueEpoch;
   MessageStore* m_pStore;
   Log* m_pLog;
   NullLog m_nullLog;
@@ -35,14 +35,14 @@ SocketAcceptor::SocketAcceptor( Application& application,
                                 MessageStoreFactory& factory,
                                 const SessionSettings& settings ) EXCEPT ( ConfigError )
 : Acceptor( application, factory, settings ),
-  m_pServer( 0 ) {}
+  m_pServer( 0 ), m_spinTime( 0 ) {}
 
 SocketAcceptor::SocketAcceptor( Application& application,
                                 MessageStoreFactory& factory,
                                 const SessionSettings& settings,
                                 LogFactory& logFactory ) EXCEPT ( ConfigError )
 : Acceptor( application, factory, settings, logFactory ),
-  m_pServer( 0 ) 
+  m_pServer( 0 ), m_spinTime( 0 ) 
 {
 }
 
@@ -66,7 +66,17 @@ EXCEPT ( ConfigError )
       settings.getBool( SOCKET_REUSE_ADDRESS );
     if( settings.has(SOCKET_NODELAY) )
       settings.getBool( SOCKET_NODELAY );
+    if( settings.has(SOCKET_BUSY_POLL) )
+      settings.getInt( SOCKET_BUSY_POLL );
   }
+
+  const Dictionary& dict = s.get();
+  m_affinity.clear();
+  if( dict.has( THREAD_AFFINITY )
+      && !thread_parseaffinity( dict.getString( THREAD_AFFINITY ), m_affinity ) )
+    throw ConfigError( std::string( THREAD_AFFINITY ) + " is not a list of processors" );
+  m_spinTime = dict.has( SOCKET_SPIN_TIME ) ?
+    dict.getInt( SOCKET_SPIN_TIME ) : 0;
 }
 
 void SocketAcceptor::onInitialize( const SessionSettings& s )
@@ -77,6 +87,7 @@ EXCEPT ( RuntimeError )
   try
   {
     m_pServer = new SocketServer( 1 );
+    m_pServer->getMonitor().setSpinTime( m_spinTime );
 
     std::set<SessionID> sessions = s.getSessions();
     std::set<SessionID>::iterator i = sessions.begin();
@@ -97,8 +108,11 @@ EXCEPT ( RuntimeError )
       const int rcvBufSize = settings.has( SOCKET_RECEIVE_BUFFER_SIZE ) ?
         settings.getInt( SOCKET_RECEIVE_BUFFER_SIZE ) : 0;
 
+      const int busyPoll = settings.has( SOCKET_BUSY_POLL ) ?
+        settings.getInt( SOCKET_BUSY_POLL ) : 0;
+
       m_portToSessions[port].insert( *i );
-      m_pServer->add( port, reuseAddress, noDelay, sendBufSize, rcvBufSize );      
+      m_pServer->add( port, reuseAddress, noDelay, sendBufSize, rcvBufSize, busyPoll );
     }    
   }
   catch( SocketException& e )
@@ -110,7 +124,12 @@ EXCEPT ( RuntimeError )
 
 void SocketAcceptor::onStart()
 {
-  while ( !isStopped() && m_pServer && m_pServer->block( *this ) ) {}
+  if( !thread_setaffinity( m_affinity ) && getLog() )
+    getLog()->onEvent( "Unable to set thread affinity" );
+
+  while ( !isStopped() && m_pServer
+          && m_pServer->block( *this, false, m_timers.timeout() ) )
+    onTimeout( *m_pServer );
 
   if( !m_pServer )
     return;
@@ -121,7 +140,8 @@ void SocketAcceptor::onStart()
   ::time( &start );
   while ( isLoggedOn() )
   {
-    m_pServer->block( *this );
+    m_pServer->block( *this, false, m_timers.timeout() );
+    onTimeout( *m_pServer );
     if( ::time(&now) -5 >= start )
       break;
   }
@@ -156,6 +176,7 @@ bool SocketAcceptor::onPoll( double timeout )
   }
 
   m_pServer->block( *this, true, timeout );
+  onTimeout( *m_pServer );
   return true;
 }
 
@@ -171,6 +192,7 @@ void SocketAcceptor::onConnect( SocketServer& server, int a, int s )
   int port = server.socketToPort( a );
   Sessions sessions = m_portToSessions[port];
   m_connections[ s ] = new SocketConnection( s, sessions, &server.getMonitor() );
+  m_timers.schedule( s, m_connections[ s ]->getNextTimeout( UtcTimeStamp() ) );
 
   std::stringstream stream;
   stream << "Accepted connection from " << socket_peername( s ) << " on port " << port;
@@ -186,6 +208,8 @@ void SocketAcceptor::onWrite( SocketServer& server, int s )
   SocketConnection* pSocketConnection = i->second;
   if( pSocketConnection->processQueue() )
     pSocketConnection->unsignal();
+  // the session may have asked for its deadlines to be looked at again
+  m_timers.schedule( s, pSocketConnection->getNextTimeout( UtcTimeStamp() ) );
 }
 
 bool SocketAcceptor::onData( SocketServer& server, int s )
@@ -207,6 +231,7 @@ void SocketAcceptor::onDisconnect( SocketServer&, int s )
 
   delete pSocketConnection;
   m_connections.erase( s );
+  m_timers.cancel( s );
 }
 
 void SocketAcceptor::onError( SocketServer& ) 
@@ -215,8 +240,17 @@ void SocketAcceptor::onError( SocketServer& )
 
 void SocketAcceptor::onTimeout( SocketServer& )
 {
-  SocketConnections::iterator i;
-  for ( i = m_connections.begin(); i != m_connections.end(); ++i )
-    i->second->onTimeout();
+  UtcTimeStamp now;
+  TimerWheel::Timers timers;
+  m_timers.expire( now, timers );
+
+  TimerWheel::Timers::iterator i;
+  for ( i = timers.begin(); i != timers.end(); ++i )
+  {
+    SocketConnections::iterator j = m_connections.find( *i );
+    if ( j == m_connections.end() ) continue;
+    j->second->onTimeout();
+    m_timers.schedule( *i, j->second->getNextTimeout( now ) );
+  }
 }
 }
@@ -29,6 +29,7 @@
 #include "Acceptor.h"
 #include "SocketServer.h"
 #include "SocketConnection.h"
+#include "TimerWheel.h"
 
 namespace FIX
 {
@@ -44,6 +45,13 @@ public:
 
   virtual ~SocketAcceptor();
 
+  /// Number of blocks on the sockets that found an event while spinning
+  unsigned long getSpinCount()
+  { return m_pServer ? m_pServer->getMonitor().getSpinCount() : 0; }
+  /// Number of times spinning ran out and the event loop blocked
+  unsigned long getParkCount()
+  { return m_pServer ? m_pServer->getMonitor().getParkCount() : 0; }
+
 private:
   bool readSettings( const SessionSettings& );
 
@@ -68,6 +76,9 @@ private:
   SocketServer* m_pServer;
   PortToSessions m_portToSessions;
   SocketConnections m_connections;
+  TimerWheel m_timers;
+  std::set<int> m_affinity;
+  int m_spinTime;
 };
 /*! @} */
 }
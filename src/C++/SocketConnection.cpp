@@ -35,7 +35,8 @@ namespace FIX
 SocketConnection::SocketConnection( int s, Sessions sessions,
                                     SocketMonitor* pMonitor )
 : m_socket( s ), m_sendLength( 0 ),
-  m_sessions(sessions), m_pSession( 0 ), m_pMonitor( pMonitor )
+  m_sessions(sessions), m_pSession( 0 ), m_pMonitor( pMonitor ),
+  m_readTime( 0 )
 {
   FD_ZERO( &m_fds );
   FD_SET( m_socket, &m_fds );
@@ -46,7 +47,7 @@ SocketConnection::SocketConnection( SocketInitiator& i,
                                     SocketMonitor* pMonitor )
 : m_socket( s ), m_sendLength( 0 ),
   m_pSession( i.getSession( sessionID, *this ) ),
-  m_pMonitor( pMonitor ) 
+  m_pMonitor( pMonitor ), m_readTime( 0 )
 {
   FD_ZERO( &m_fds );
   FD_SET( m_socket, &m_fds );
@@ -69,6 +70,18 @@ bool SocketConnection::send( const std::string& msg )
   return true;
 }
 
+void SocketConnection::getSendQueue( size_t& messages, size_t& bytes )
+{
+  Locker l( m_mutex );
+
+  messages = m_sendQueue.size();
+  bytes = 0;
+  Queue::const_iterator i;
+  for( i = m_sendQueue.begin(); i != m_sendQueue.end(); ++i )
+    bytes += i->size();
+  if( bytes ) bytes -= m_sendLength;
+}
+
 bool SocketConnection::processQueue()
 {
   Locker l( m_mutex );
@@ -199,6 +212,8 @@ EXCEPT ( SocketRecvFailed )
 {
   ssize_t size = socket_recv( m_socket, m_buffer, sizeof(m_buffer) );
   if( size <= 0 ) throw SocketRecvFailed( size );
+  if( m_pSession && m_pSession->getLatencyHistograms() )
+    m_readTime = LatencyHistogram::now();
   m_parser.addToStream( m_buffer, size );
 }
 
@@ -221,6 +236,8 @@ void SocketConnection::readMessages( SocketMonitor& s )
   {
     try
     {
+      if( m_readTime )
+        m_pSession->recordLatency( Session::LATENCY_FRAME, m_readTime );
       m_pSession->next( msg, UtcTimeStamp() );
     }
     catch ( InvalidMessage& )
@@ -235,4 +252,12 @@ void SocketConnection::onTimeout()
 {
   if ( m_pSession ) m_pSession->next();
 }
+
+UtcTimeStamp SocketConnection::getNextTimeout( const UtcTimeStamp& now )
+{
+  if ( m_pSession ) return m_pSession->getNextTimeout( now );
+  UtcTimeStamp next = now;
+  next += 1;
+  return next;
+}
 } // namespace FIX
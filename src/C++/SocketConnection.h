@@ -74,6 +74,7 @@ public:
   }
 
   void onTimeout();
+  UtcTimeStamp getNextTimeout( const UtcTimeStamp& now );
 
 private:
   typedef std::deque<std::string, ALLOCATOR<std::string> >
@@ -85,6 +86,12 @@ private:
   void readMessages( SocketMonitor& s );
   bool send( const std::string& );
   void disconnect();
+  void reschedule()
+  {
+    // onWrite() of the acceptor or initiator asks for the next timeout
+    m_pMonitor->signal( m_socket );
+  }
+  void getSendQueue( size_t& messages, size_t& bytes );
 
   int m_socket;
   char m_buffer[BUFSIZ];
@@ -97,6 +104,7 @@ private:
   SocketMonitor* m_pMonitor;
   Mutex m_mutex;
   fd_set m_fds;
+  int64_t m_readTime;
 };
 }
 
@@ -80,7 +80,7 @@ private:
 };
 
 SocketConnector::SocketConnector( int timeout )
-: m_monitor( timeout ) {}
+: m_monitor( timeout ), m_busyPoll( 0 ) {}
 
 int SocketConnector::connect( const std::string& address, int port, bool noDelay,
                               int sendBufSize, int rcvBufSize,
@@ -96,6 +96,10 @@ int SocketConnector::connect( const std::string& address, int port, bool noDelay
       socket_setsockopt( socket, SO_SNDBUF, sendBufSize );
     if( rcvBufSize )
       socket_setsockopt( socket, SO_RCVBUF, rcvBufSize );
+#ifdef SO_BUSY_POLL
+    if( m_busyPoll )
+      socket_setsockopt( socket, SO_BUSY_POLL, m_busyPoll );
+#endif
     if ( !sourceAddress.empty() || sourcePort )
           socket_bind( socket, sourceAddress.c_str(), sourcePort );
     m_monitor.addConnect( socket );
@@ -46,9 +46,12 @@ public:
                int sendBufSize, int rcvBufSize, Strategy& );
   void block( Strategy& strategy, bool poll = 0, double timeout = 0.0 );
   SocketMonitor& getMonitor() { return m_monitor; }
+  /// SO_BUSY_POLL microseconds for sockets connected from now on, 0 for none
+  void setBusyPoll( int microseconds ) { m_busyPoll = microseconds; }
 
 private:
   SocketMonitor m_monitor;
+  int m_busyPoll;
 
 public:
   class Strategy
@@ -77,6 +77,14 @@ EXCEPT ( ConfigError )
     m_sendBufSize = dict.getInt( SOCKET_SEND_BUFFER_SIZE );
   if( dict.has( SOCKET_RECEIVE_BUFFER_SIZE ) )
     m_rcvBufSize = dict.getInt( SOCKET_RECEIVE_BUFFER_SIZE );
+  m_affinity.clear();
+  if( dict.has( THREAD_AFFINITY )
+      && !thread_parseaffinity( dict.getString( THREAD_AFFINITY ), m_affinity ) )
+    throw ConfigError( std::string( THREAD_AFFINITY ) + " is not a list of processors" );
+  if( dict.has( SOCKET_BUSY_POLL ) )
+    m_connector.setBusyPoll( dict.getInt( SOCKET_BUSY_POLL ) );
+  if( dict.has( SOCKET_SPIN_TIME ) )
+    m_connector.getMonitor().setSpinTime( dict.getInt( SOCKET_SPIN_TIME ) );
 }
 
 void SocketInitiator::onInitialize( const SessionSettings& s )
@@ -86,10 +94,14 @@ EXCEPT ( RuntimeError )
 
 void SocketInitiator::onStart()
 {
+  if( !thread_setaffinity( m_affinity ) && getLog() )
+    getLog()->onEvent( "Unable to set thread affinity" );
+
   connect();
 
   while ( !isStopped() ) {
-    m_connector.block( *this, false, 1.0 );
+    double timeout = m_timers.timeout();
+    m_connector.block( *this, false, timeout ? timeout : 1.0 );
     onTimeout( m_connector );
   }
 
@@ -99,7 +111,8 @@ void SocketInitiator::onStart()
   ::time( &start );
   while ( isLoggedOn() )
   {
-    m_connector.block( *this );
+    m_connector.block( *this, false, m_timers.timeout() );
+    onTimeout( m_connector );
     if( ::time(&now) -5 >= start )
       break;
   }
@@ -121,6 +134,7 @@ bool SocketInitiator::onPoll( double timeout )
   }
 
   m_connector.block( *this, true, timeout );
+  onTimeout( m_connector );
   return true;
 }
 
@@ -164,6 +178,7 @@ void SocketInitiator::onConnect( SocketConnector&, int s )
   m_pendingConnections.erase( i );
   setConnected( pSocketConnection->getSession()->getSessionID() );
   pSocketConnection->onTimeout();
+  m_timers.schedule( s, pSocketConnection->getNextTimeout( UtcTimeStamp() ) );
 }
 
 void SocketInitiator::onWrite( SocketConnector& connector, int s )
@@ -173,6 +188,8 @@ void SocketInitiator::onWrite( SocketConnector& connector, int s )
   SocketConnection* pSocketConnection = i->second;
   if( pSocketConnection->processQueue() )
     pSocketConnection->unsignal();
+  // the session may have asked for its deadlines to be looked at again
+  m_timers.schedule( s, pSocketConnection->getNextTimeout( UtcTimeStamp() ) );
 }
 
 bool SocketInitiator::onData( SocketConnector& connector, int s )
@@ -208,6 +225,7 @@ void SocketInitiator::onDisconnect( SocketConnector&, int s )
   delete pSocketConnection;
   m_connections.erase( s );
   m_pendingConnections.erase( s );
+  m_timers.cancel( s );
 }
 
 void SocketInitiator::onError( SocketConnector& connector )
@@ -226,9 +244,18 @@ void SocketInitiator::onTimeout( SocketConnector& )
     m_lastConnect = now;
   }
 
-  SocketConnections::iterator i;
-  for ( i = m_connections.begin(); i != m_connections.end(); ++i )
-    i->second->onTimeout();
+  UtcTimeStamp timeStamp;
+  TimerWheel::Timers timers;
+  m_timers.expire( timeStamp, timers );
+
+  TimerWheel::Timers::iterator i;
+  for ( i = timers.begin(); i != timers.end(); ++i )
+  {
+    SocketConnections::iterator j = m_connections.find( *i );
+    if ( j == m_connections.end() ) continue;
+    j->second->onTimeout();
+    m_timers.schedule( *i, j->second->getNextTimeout( timeStamp ) );
+  }
 }
 
 void SocketInitiator::getHost( const SessionID& s, const Dictionary& d,
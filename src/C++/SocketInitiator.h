@@ -29,6 +29,7 @@
 #include "Initiator.h"
 #include "SocketConnector.h"
 #include "SocketConnection.h"
+#include "TimerWheel.h"
 
 namespace FIX
 {
@@ -43,6 +44,13 @@ public:
 
   virtual ~SocketInitiator();
 
+  /// Number of blocks on the sockets that found an event while spinning
+  unsigned long getSpinCount()
+  { return m_connector.getMonitor().getSpinCount(); }
+  /// Number of times spinning ran out and the event loop blocked
+  unsigned long getParkCount()
+  { return m_connector.getMonitor().getParkCount(); }
+
 private:
   typedef std::map < int, SocketConnection* > SocketConnections;
   typedef std::map < SessionID, int > SessionToHostNum;
@@ -69,11 +77,13 @@ private:
   SocketConnector m_connector;
   SocketConnections m_pendingConnections;
   SocketConnections m_connections;
+  TimerWheel m_timers;
   time_t m_lastConnect;
   int m_reconnectInterval;
   bool m_noDelay;
   int m_sendBufSize;
   int m_rcvBufSize;
+  std::set<int> m_affinity;
 };
 /*! @} */
 }
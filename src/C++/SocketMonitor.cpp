@@ -25,6 +25,7 @@
 
 #include "SocketMonitor.h"
 #include "Utility.h"
+#include "FieldTypes.h"
 #include <exception>
 #include <set>
 #include <algorithm>
@@ -33,7 +34,7 @@
 namespace FIX
 {
 SocketMonitor::SocketMonitor( int timeout )
-: m_timeout( timeout )
+: m_timeout( timeout ), m_spinTime( 0 ), m_spinCount( 0 ), m_parkCount( 0 )
 {
   socket_init();
 
@@ -124,6 +125,14 @@ inline timeval* SocketMonitor::getTimeval( bool poll, double timeout )
     return &m_timeval;
   }
 
+  // a shorter timeout requested by the caller (e.g. the next timer) wins
+  if ( timeout > 0 && ( !m_timeout || timeout < m_timeout ) )
+  {
+    m_timeval.tv_sec = (long)timeout;
+    m_timeval.tv_usec = (long)( ( timeout - m_timeval.tv_sec ) * 1000000 );
+    return &m_timeval;
+  }
+
   timeout = m_timeout;
 
   if ( !timeout )
@@ -205,7 +214,11 @@ void SocketMonitor::block( Strategy& strategy, bool poll, double timeout )
     return;
   }
 
-  int result = select( FD_SETSIZE, &readSet, &writeSet, &exceptSet, getTimeval(poll, timeout) );
+  int result = 0;
+  if ( m_spinTime && !poll )
+    result = spin( readSet, writeSet, exceptSet );
+  if ( !result )
+    result = select( FD_SETSIZE, &readSet, &writeSet, &exceptSet, getTimeval(poll, timeout) );
 
   if ( result == 0 )
   {
@@ -224,6 +237,35 @@ void SocketMonitor::block( Strategy& strategy, bool poll, double timeout )
   }
 }
 
+int SocketMonitor::spin( fd_set& readSet, fd_set& writeSet, fd_set& exceptSet )
+{
+  // keep the thread running while events are expected, blocking in select
+  // only costs a wakeup on the next one
+  UtcTimeStamp start;
+  int64_t limit = ( int64_t ) m_spinTime * 1000;
+  do
+  {
+    fd_set reads = readSet;
+    fd_set writes = writeSet;
+    fd_set excepts = exceptSet;
+    timeval zero = { 0, 0 };
+    int result = select( FD_SETSIZE, &reads, &writes, &excepts, &zero );
+    if ( result > 0 )
+    {
+      ++m_spinCount;
+      readSet = reads;
+      writeSet = writes;
+      exceptSet = excepts;
+    }
+    if ( result )
+      return result;
+  }
+  while( UtcTimeStamp().getNanosSinceEpoch() - start.getNanosSinceEpoch() < limit );
+
+  ++m_parkCount;
+  return 0;
+}
+
 void SocketMonitor::processReadSet( Strategy& strategy, fd_set& readSet )
 {
 #ifdef _MSC_VER
@@ -60,6 +60,14 @@ public:
   void unsignal( int socket );
   void block( Strategy& strategy, bool poll = 0, double timeout = 0.0 );
 
+  /// Poll the sockets for this many microseconds before blocking on them
+  void setSpinTime( int microseconds ) { m_spinTime = microseconds; }
+  int getSpinTime() const { return m_spinTime; }
+  /// Number of blocks that found an event while spinning
+  unsigned long getSpinCount() const { return m_spinCount; }
+  /// Number of times spinning ran out and select blocked
+  unsigned long getParkCount() const { return m_parkCount; }
+
   size_t numSockets() 
   { return m_readSockets.size() - 1; }
 
@@ -73,6 +81,7 @@ private:
   void buildSet( const Sockets&, fd_set& );
   inline timeval* getTimeval( bool poll, double timeout );
   inline bool sleepIfEmpty( bool poll );
+  int spin( fd_set& readSet, fd_set& writeSet, fd_set& exceptSet );
 
   void processReadSet( Strategy&, fd_set& );
   void processWriteSet( Strategy&, fd_set& );
@@ -90,6 +99,9 @@ private:
   Sockets m_readSockets;
   Sockets m_writeSockets;
   Queue m_dropped;
+  int m_spinTime;
+  unsigned long m_spinCount;
+  unsigned long m_parkCount;
 
 public:
   class Strategy
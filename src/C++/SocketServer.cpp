@@ -95,7 +95,7 @@ SocketServer::SocketServer( int timeout )
 : m_monitor( timeout ) {}
 
 int SocketServer::add( int port, bool reuse, bool noDelay, 
-                       int sendBufSize, int rcvBufSize )
+                       int sendBufSize, int rcvBufSize, int busyPoll )
   EXCEPT ( SocketException& )
 {
   if( m_portToInfo.find(port) != m_portToInfo.end() )
@@ -110,9 +110,13 @@ int SocketServer::add( int port, bool reuse, bool noDelay,
     socket_setsockopt( socket, SO_SNDBUF, sendBufSize );
   if( rcvBufSize )
     socket_setsockopt( socket, SO_RCVBUF, rcvBufSize );
+#ifdef SO_BUSY_POLL
+  if( busyPoll )
+    socket_setsockopt( socket, SO_BUSY_POLL, busyPoll );
+#endif
   m_monitor.addRead( socket );
 
-  SocketInfo info( socket, port, noDelay, sendBufSize, rcvBufSize );
+  SocketInfo info( socket, port, noDelay, sendBufSize, rcvBufSize, busyPoll );
   m_socketToInfo[socket] = info;
   m_portToInfo[port] = info;
   return socket;
@@ -129,6 +133,10 @@ int SocketServer::accept( int socket )
     socket_setsockopt( result, SO_SNDBUF, info.m_sendBufSize );
   if( info.m_rcvBufSize )
     socket_setsockopt( result, SO_RCVBUF, info.m_rcvBufSize );
+#ifdef SO_BUSY_POLL
+  if( info.m_busyPoll )
+    socket_setsockopt( result, SO_BUSY_POLL, info.m_busyPoll );
+#endif
   if ( result >= 0 )
     m_monitor.addConnect( result );
   return result;
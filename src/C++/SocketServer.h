@@ -39,17 +39,20 @@ struct SocketInfo
 {
   SocketInfo()
   : m_socket( -1 ), m_port( 0 ), m_noDelay( false ),
-    m_sendBufSize( 0 ), m_rcvBufSize( 0 ) {}
+    m_sendBufSize( 0 ), m_rcvBufSize( 0 ), m_busyPoll( 0 ) {}
   
-  SocketInfo( int socket, short port, bool noDelay, int sendBufSize, int rcvBufSize )
+  SocketInfo( int socket, short port, bool noDelay, int sendBufSize, int rcvBufSize,
+              int busyPoll = 0 )
   : m_socket( socket ), m_port( port ), m_noDelay( noDelay ), 
-    m_sendBufSize( sendBufSize ), m_rcvBufSize( rcvBufSize ) {}
+    m_sendBufSize( sendBufSize ), m_rcvBufSize( rcvBufSize ),
+    m_busyPoll( busyPoll ) {}
 
   int m_socket;
   short m_port;
   bool m_noDelay;
   int m_sendBufSize;
   int m_rcvBufSize;
+  int m_busyPoll;
 };
 
 /// Listens for and accepts incoming socket connections on a port.
@@ -61,7 +64,8 @@ public:
   SocketServer( int timeout = 0 );
 
   int add( int port, bool reuse = false, bool noDelay = false, 
-           int sendBufSize = 0, int rcvBufSize = 0 ) EXCEPT ( SocketException& );
+           int sendBufSize = 0, int rcvBufSize = 0,
+           int busyPoll = 0 ) EXCEPT ( SocketException& );
   int accept( int socket );
   void close();
   bool block( Strategy& strategy, bool poll = 0, double timeout = 0.0 );
@@ -0,0 +1,127 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_SPSCQUEUE_H
+#define FIX_SPSCQUEUE_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Utility.h"
+#include <vector>
+
+namespace FIX
+{
+/**
+ * Bounded lock free queue between exactly one producer and one consumer.
+ *
+ * The slots are constructed up front and reused, so the producer fills a
+ * slot in place with claim() and makes it visible with publish(), and the
+ * consumer reads it in place with front() and releases it with pop().
+ * Nothing is allocated or copied per element and neither side ever takes
+ * a lock; the two indices live on separate cache lines so the threads do
+ * not invalidate each other on every operation.
+ */
+template < typename T >
+class SpscQueue
+{
+public:
+  /// Capacity is rounded up to a power of two
+  SpscQueue( size_t capacity )
+  : m_head( 0 ), m_tail( 0 )
+  {
+    size_t size = 1;
+    while( size < capacity ) size <<= 1;
+    m_slots.resize( size );
+    m_mask = ( unsigned ) size - 1;
+  }
+
+  size_t capacity() const { return m_slots.size(); }
+  size_t size() const { return load( m_tail ) - load( m_head ); }
+  bool empty() const { return size() == 0; }
+
+  /// Producer: slot to fill for the next element, 0 if the queue is full
+  T* claim()
+  {
+    unsigned tail = m_tail;
+    if( tail - load( m_head ) > m_mask )
+      return 0;
+    return &m_slots[ tail & m_mask ];
+  }
+
+  /// Producer: make the slot returned by claim() visible to the consumer
+  void publish()
+  { store( m_tail, m_tail + 1 ); }
+
+  /// Consumer: oldest published element, 0 if the queue is empty
+  T* front()
+  {
+    unsigned head = m_head;
+    if( load( m_tail ) == head )
+      return 0;
+    return &m_slots[ head & m_mask ];
+  }
+
+  /// Consumer: hand the slot returned by front() back to the producer
+  void pop()
+  { store( m_head, m_head + 1 ); }
+
+private:
+  SpscQueue( const SpscQueue& );
+  SpscQueue& operator=( const SpscQueue& );
+
+  enum { CACHE_LINE = 64 };
+
+  static unsigned load( const volatile unsigned& index )
+  {
+#ifdef _MSC_VER
+    unsigned value = index;
+    MemoryBarrier();
+    return value;
+#else
+    return __atomic_load_n( &index, __ATOMIC_ACQUIRE );
+#endif
+  }
+
+  static void store( volatile unsigned& index, unsigned value )
+  {
+#ifdef _MSC_VER
+    MemoryBarrier();
+    index = value;
+#else
+    __atomic_store_n( &index, value, __ATOMIC_RELEASE );
+#endif
+  }
+
+  std::vector < T > m_slots;
+  unsigned m_mask;
+  char m_padding1[ CACHE_LINE ];
+  // written by the consumer only
+  volatile unsigned m_head;
+  char m_padding2[ CACHE_LINE ];
+  // written by the producer only
+  volatile unsigned m_tail;
+  char m_padding3[ CACHE_LINE ];
+};
+}
+
+#endif //FIX_SPSCQUEUE_H
@@ -0,0 +1,90 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_STRINGVIEW_H
+#define FIX_STRINGVIEW_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include <string>
+#include <cstring>
+#include <ostream>
+
+namespace FIX
+{
+/**
+ * Characters owned by someone else.
+ *
+ * A view is only a pointer and a length, so it is valid only as long as
+ * the buffer it points into and is not null terminated.
+ */
+class StringView
+{
+public:
+  typedef const char* const_iterator;
+
+  StringView() : m_data( "" ), m_length( 0 ) {}
+  StringView( const char* data, size_t length )
+  : m_data( data ), m_length( length ) {}
+  StringView( const char* data )
+  : m_data( data ), m_length( strlen( data ) ) {}
+  StringView( const std::string& string )
+  : m_data( string.data() ), m_length( string.size() ) {}
+
+  const char* data() const { return m_data; }
+  size_t size() const { return m_length; }
+  size_t length() const { return m_length; }
+  bool empty() const { return m_length == 0; }
+
+  const_iterator begin() const { return m_data; }
+  const_iterator end() const { return m_data + m_length; }
+  char operator[]( size_t index ) const { return m_data[ index ]; }
+
+  /// Copy the characters into a string of their own
+  std::string str() const { return std::string( m_data, m_length ); }
+
+  int compare( const StringView& rhs ) const
+  {
+    size_t length = m_length < rhs.m_length ? m_length : rhs.m_length;
+    int result = length ? memcmp( m_data, rhs.m_data, length ) : 0;
+    if( result ) return result;
+    return m_length < rhs.m_length ? -1 : ( m_length > rhs.m_length ? 1 : 0 );
+  }
+
+private:
+  const char* m_data;
+  size_t m_length;
+};
+
+inline bool operator==( const StringView& lhs, const StringView& rhs )
+{ return lhs.size() == rhs.size() && lhs.compare( rhs ) == 0; }
+inline bool operator!=( const StringView& lhs, const StringView& rhs )
+{ return !( lhs == rhs ); }
+inline bool operator<( const StringView& lhs, const StringView& rhs )
+{ return lhs.compare( rhs ) < 0; }
+
+inline std::ostream& operator<<( std::ostream& stream, const StringView& view )
+{ return stream.write( view.data(), view.size() ); }
+}
+
+#endif //FIX_STRINGVIEW_H
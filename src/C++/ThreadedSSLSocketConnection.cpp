@@ -224,9 +224,21 @@ bool ThreadedSSLSocketConnection::read()
   struct timeval timeout = {1, 0};
   fd_set readset = m_fds;
 
+  if (m_pSession)
+  {
+    // sleep only until the session has a heartbeat or timeout due, but
+    // no longer than a second to see logout requests from other threads
+    UtcTimeStamp now;
+    UtcTimeStamp next = m_pSession->getNextTimeout(now);
+    int64_t nanos = next.getNanosSinceEpoch() - now.getNanosSinceEpoch();
+    if (nanos > DateTime::NANOS_PER_SEC) nanos = DateTime::NANOS_PER_SEC;
+    timeout.tv_sec = (long)(nanos / DateTime::NANOS_PER_SEC);
+    timeout.tv_usec = (long)((nanos % DateTime::NANOS_PER_SEC) / 1000);
+  }
+
   try
   {
-    // Wait for input (1 second timeout)
+    // Wait for input (at most 1 second)
     int result = select(1 + m_socket, &readset, 0, 0, &timeout);
 
     if (result > 0) // Something to read
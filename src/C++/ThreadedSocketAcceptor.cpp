@@ -33,7 +33,8 @@ ThreadedSocketAcceptor::ThreadedSocketAcceptor(
   Application& application,
   MessageStoreFactory& factory,
   const SessionSettings& settings ) EXCEPT ( ConfigError )
-: Acceptor( application, factory, settings )
+: Acceptor( application, factory, settings ), m_spinTime( 0 ),
+  m_pipelineDepth( 0 )
 { socket_init(); }
 
 ThreadedSocketAcceptor::ThreadedSocketAcceptor(
@@ -41,7 +42,8 @@ ThreadedSocketAcceptor::ThreadedSocketAcceptor(
   MessageStoreFactory& factory,
   const SessionSettings& settings,
   LogFactory& logFactory ) EXCEPT ( ConfigError )
-: Acceptor( application, factory, settings, logFactory )
+: Acceptor( application, factory, settings, logFactory ), m_spinTime( 0 ),
+  m_pipelineDepth( 0 )
 { 
   socket_init(); 
 }
@@ -64,7 +66,21 @@ EXCEPT ( ConfigError )
       settings.getBool( SOCKET_REUSE_ADDRESS );
     if( settings.has(SOCKET_NODELAY) )
       settings.getBool( SOCKET_NODELAY );
+    if( settings.has(SOCKET_BUSY_POLL) )
+      settings.getInt( SOCKET_BUSY_POLL );
   }
+
+  const Dictionary& dict = s.get();
+  m_spinTime = dict.has( SOCKET_SPIN_TIME ) ?
+    dict.getInt( SOCKET_SPIN_TIME ) : 0;
+  m_pipelineDepth = dict.has( INBOUND_PIPELINE_DEPTH ) ?
+    dict.getInt( INBOUND_PIPELINE_DEPTH ) : 0;
+  if( m_pipelineDepth < 0 )
+    throw ConfigError( std::string( INBOUND_PIPELINE_DEPTH ) + " must not be negative" );
+  m_affinity.clear();
+  if( dict.has( THREAD_AFFINITY )
+      && !thread_parseaffinity( dict.getString( THREAD_AFFINITY ), m_affinity ) )
+    throw ConfigError( std::string( THREAD_AFFINITY ) + " is not a list of processors" );
 }
 
 void ThreadedSocketAcceptor::onInitialize( const SessionSettings& s )
@@ -98,6 +114,9 @@ EXCEPT ( RuntimeError )
     const int rcvBufSize = settings.has( SOCKET_RECEIVE_BUFFER_SIZE ) ?
       settings.getInt( SOCKET_RECEIVE_BUFFER_SIZE ) : 0;
 
+    const int busyPoll = settings.has( SOCKET_BUSY_POLL ) ?
+      settings.getInt( SOCKET_BUSY_POLL ) : 0;
+
     int socket = socket_createAcceptor( port, reuseAddress );
     if( socket < 0 )
     {
@@ -112,6 +131,10 @@ EXCEPT ( RuntimeError )
       socket_setsockopt( socket, SO_SNDBUF, sendBufSize );
     if( rcvBufSize )
       socket_setsockopt( socket, SO_RCVBUF, rcvBufSize );
+#ifdef SO_BUSY_POLL
+    if( busyPoll )
+      socket_setsockopt( socket, SO_BUSY_POLL, busyPoll );
+#endif
 
     m_socketToPort[socket] = port;
     m_sockets.insert( socket );
@@ -195,9 +218,13 @@ THREAD_PROC ThreadedSocketAcceptor::socketAcceptorThread( void* p )
   int noDelay = 0;
   int sendBufSize = 0;
   int rcvBufSize = 0;
+  int busyPoll = 0;
   socket_getsockopt( s, TCP_NODELAY, noDelay );
   socket_getsockopt( s, SO_SNDBUF, sendBufSize );
   socket_getsockopt( s, SO_RCVBUF, rcvBufSize );
+#ifdef SO_BUSY_POLL
+  socket_getsockopt( s, SO_BUSY_POLL, busyPoll );
+#endif
 
   int socket = 0;
   while ( ( !pAcceptor->isStopped() && ( socket = socket_accept( s ) ) >= 0 ) )
@@ -208,12 +235,18 @@ THREAD_PROC ThreadedSocketAcceptor::socketAcceptorThread( void* p )
       socket_setsockopt( socket, SO_SNDBUF, sendBufSize );
     if( rcvBufSize )
       socket_setsockopt( socket, SO_RCVBUF, rcvBufSize );
+#ifdef SO_BUSY_POLL
+    if( busyPoll )
+      socket_setsockopt( socket, SO_BUSY_POLL, busyPoll );
+#endif
 
     Sessions sessions = pAcceptor->m_portToSessions[port];
 
     ThreadedSocketConnection * pConnection =
       new ThreadedSocketConnection
         ( socket, sessions, pAcceptor->getLog() );
+    pConnection->setSpinTime( pAcceptor->m_spinTime );
+    pConnection->setPipelineDepth( pAcceptor->m_pipelineDepth );
 
     ConnectionThreadInfo* info = new ConnectionThreadInfo( pAcceptor, pConnection );
 
@@ -253,6 +286,9 @@ THREAD_PROC ThreadedSocketAcceptor::socketConnectionThread( void* p )
 
   int socket = pConnection->getSocket();
 
+  if( !thread_setaffinity( pAcceptor->m_affinity ) && pAcceptor->getLog() )
+    pAcceptor->getLog()->onEvent( "Unable to set thread affinity" );
+
   while ( pConnection->read() ) {}
   delete pConnection;
   if( !pAcceptor->isStopped() )
@@ -90,6 +90,9 @@ private:
   PortToSessions m_portToSessions;
   SocketToPort m_socketToPort;
   SocketToThread m_threads;
+  int m_spinTime;
+  int m_pipelineDepth;
+  std::set<int> m_affinity;
   Mutex m_mutex;
 };
 /*! @} */
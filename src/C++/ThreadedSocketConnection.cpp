@@ -35,7 +35,8 @@ ThreadedSocketConnection::ThreadedSocketConnection
 ( int s, Sessions sessions, Log* pLog )
 : m_socket( s ), m_pLog( pLog ),
   m_sessions( sessions ), m_pSession( 0 ),
-  m_disconnect( false )
+  m_disconnect( false ), m_spinTime( 0 ), m_spinCount( 0 ), m_parkCount( 0 ),
+  m_readTime( 0 ), m_pipelineDepth( 0 )
 {
   FD_ZERO( &m_fds );
   FD_SET( m_socket, &m_fds );
@@ -50,7 +51,8 @@ ThreadedSocketConnection::ThreadedSocketConnection
     m_sourceAddress( sourceAddress ), m_sourcePort( sourcePort ),
     m_pLog( pLog ),
     m_pSession( Session::lookupSession( sessionID ) ),
-    m_disconnect( false )
+    m_disconnect( false ), m_spinTime( 0 ), m_spinCount( 0 ), m_parkCount( 0 ),
+  m_readTime( 0 ), m_pipelineDepth( 0 )
 {
   FD_ZERO( &m_fds );
   FD_SET( m_socket, &m_fds );
@@ -59,6 +61,7 @@ ThreadedSocketConnection::ThreadedSocketConnection
 
 ThreadedSocketConnection::~ThreadedSocketConnection()
 {
+  stopPipeline();
   if ( m_pSession )
   {
     m_pSession->setResponder( 0 );
@@ -71,7 +74,7 @@ bool ThreadedSocketConnection::send( const std::string& msg )
   int totalSent = 0;
   while(totalSent < (int)msg.length())
   {
-    ssize_t sent = socket_send( m_socket, msg.c_str() + totalSent, msg.length() );
+    ssize_t sent = socket_send( m_socket, msg.c_str() + totalSent, msg.length() - totalSent );
     if(sent < 0) return false;
     totalSent += sent;
   }
@@ -79,6 +82,33 @@ bool ThreadedSocketConnection::send( const std::string& msg )
   return true;
 }
 
+bool ThreadedSocketConnection::sendBuffers( const std::string* const* buffers, size_t count )
+{
+  ssize_t sent = socket_sendv( m_socket, buffers, count );
+  if( sent < 0 ) return false;
+
+  // whatever a short write left goes out one buffer at a time
+  for( size_t i = 0; i < count; ++i )
+  {
+    size_t size = buffers[ i ]->size();
+    if( ( size_t ) sent >= size )
+    {
+      sent -= size;
+      continue;
+    }
+    size_t offset = sent;
+    sent = 0;
+    while( offset < size )
+    {
+      ssize_t result = socket_send
+        ( m_socket, buffers[ i ]->c_str() + offset, size - offset );
+      if( result < 0 ) return false;
+      offset += result;
+    }
+  }
+  return true;
+}
+
 bool ThreadedSocketConnection::connect()
 {
   // do the bind in the thread as name resolution may block
@@ -94,14 +124,73 @@ void ThreadedSocketConnection::disconnect()
   socket_close( m_socket );
 }
 
+bool ThreadedSocketConnection::spin()
+{
+  // keep the thread running while data is expected, blocking in select
+  // only costs a wakeup on the next message
+  UtcTimeStamp start;
+  int64_t limit = ( int64_t ) m_spinTime * 1000;
+  int bytes = 0;
+  do
+  {
+    if( !socket_fionread( m_socket, bytes ) )
+      return false;
+    if( bytes > 0 )
+      return true;
+  }
+  while( UtcTimeStamp().getNanosSinceEpoch() - start.getNanosSinceEpoch() < limit );
+  return false;
+}
+
 bool ThreadedSocketConnection::read()
 {
+  if( m_pipelineDepth && m_pSession && !m_pPipeline.get() )
+    startPipeline();
+
+  if( m_spinTime && spin() )
+  {
+    ++m_spinCount;
+    if( m_pSession ) m_pSession->countSpin( true );
+    try
+    {
+      ssize_t size = socket_recv( m_socket, m_buffer, sizeof(m_buffer) );
+      if ( size <= 0 ) { throw SocketRecvFailed( size ); }
+      if( m_pSession && m_pSession->getLatencyHistograms() )
+        m_readTime = LatencyHistogram::now();
+      m_parser.addToStream( m_buffer, size );
+      processStream();
+      return true;
+    }
+    catch ( SocketRecvFailed& e )
+    {
+      return onRecvFailed( e );
+    }
+  }
+  if( m_spinTime )
+  {
+    ++m_parkCount;
+    if( m_pSession ) m_pSession->countSpin( false );
+  }
+
   struct timeval timeout = { 1, 0 };
   fd_set readset = m_fds;
 
+  // with a pipeline the sequencing thread takes care of the timers
+  if( m_pSession && !m_pPipeline.get() )
+  {
+    // sleep only until the session has a heartbeat or timeout due, but
+    // no longer than a second to see logout requests from other threads
+    UtcTimeStamp now;
+    UtcTimeStamp next = m_pSession->getNextTimeout( now );
+    int64_t nanos = next.getNanosSinceEpoch() - now.getNanosSinceEpoch();
+    if( nanos > DateTime::NANOS_PER_SEC ) nanos = DateTime::NANOS_PER_SEC;
+    timeout.tv_sec = ( long ) ( nanos / DateTime::NANOS_PER_SEC );
+    timeout.tv_usec = ( long ) ( ( nanos % DateTime::NANOS_PER_SEC ) / 1000 );
+  }
+
   try
   {
-    // Wait for input (1 second timeout)
+    // Wait for input (at most 1 second)
     int result = select( 1 + m_socket, &readset, 0, 0, &timeout );
 
     if( result > 0 ) // Something to read
@@ -109,9 +198,11 @@ bool ThreadedSocketConnection::read()
       // We can read without blocking
       ssize_t size = socket_recv( m_socket, m_buffer, sizeof(m_buffer) );
       if ( size <= 0 ) { throw SocketRecvFailed( size ); }
+      if( m_pSession && m_pSession->getLatencyHistograms() )
+        m_readTime = LatencyHistogram::now();
       m_parser.addToStream( m_buffer, size );
     }
-    else if( result == 0 && m_pSession ) // Timeout
+    else if( result == 0 && m_pSession && !m_pPipeline.get() ) // Timeout
     {
       m_pSession->next();
     }
@@ -125,21 +216,28 @@ bool ThreadedSocketConnection::read()
   }
   catch ( SocketRecvFailed& e )
   {
-    if( m_disconnect )
-      return false;
-
-    if( m_pSession )
-    {
-      m_pSession->getLog()->onEvent( e.what() );
-      m_pSession->disconnect();
-    }
-    else
-    {
-      disconnect();
-    }
+    return onRecvFailed( e );
+  }
+}
 
+bool ThreadedSocketConnection::onRecvFailed( SocketRecvFailed& e )
+{
+  if( m_disconnect )
     return false;
+
+  if( m_pSession )
+  {
+    // let the session see everything read before the connection dropped
+    stopPipeline();
+    m_pSession->getLog()->onEvent( e.what() );
+    m_pSession->disconnect();
+  }
+  else
+  {
+    disconnect();
   }
+
+  return false;
 }
 
 bool ThreadedSocketConnection::readMessage( std::string& msg )
@@ -162,9 +260,19 @@ void ThreadedSocketConnection::processStream()
     {
       if ( !setSession( msg ) )
       { disconnect(); continue; }
+      if( m_pipelineDepth )
+        startPipeline();
     }
     try
     {
+      if( m_readTime )
+        m_pSession->recordLatency( Session::LATENCY_FRAME, m_readTime );
+      if( m_pPipeline.get() )
+      {
+        if( !m_pPipeline->push( msg ) )
+          return;
+        continue;
+      }
       m_pSession->next( msg, UtcTimeStamp() );
     }
     catch( InvalidMessage& )
@@ -178,6 +286,24 @@ void ThreadedSocketConnection::processStream()
   }
 }
 
+void ThreadedSocketConnection::startPipeline()
+{
+  m_pPipeline.reset( new InboundPipeline( *m_pSession, *this, m_pipelineDepth ) );
+}
+
+void ThreadedSocketConnection::stopPipeline()
+{
+  if( !m_pPipeline.get() ) return;
+  m_pPipeline->stop();
+  if( m_pPipeline->getFullCount() )
+  {
+    std::stringstream stream;
+    stream << "Inbound pipeline was full " << m_pPipeline->getFullCount() << " times";
+    m_pSession->getLog()->onEvent( stream.str() );
+  }
+  m_pPipeline.reset();
+}
+
 bool ThreadedSocketConnection::setSession( const std::string& msg )
 {
   m_pSession = Session::lookupSession( msg, true );
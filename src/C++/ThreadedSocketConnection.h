@@ -27,6 +27,7 @@
 #endif
 
 #include "Parser.h"
+#include "InboundPipeline.h"
 #include "Responder.h"
 #include "SessionID.h"
 #include <set>
@@ -59,11 +60,29 @@ public:
   void disconnect();
   bool read();
 
+  /// Poll the socket for this many microseconds before blocking on it
+  void setSpinTime( int microseconds ) { m_spinTime = microseconds; }
+  /// Number of reads that found data while spinning
+  unsigned long getSpinCount() const { return m_spinCount; }
+  /// Number of times spinning ran out and the thread blocked
+  unsigned long getParkCount() const { return m_parkCount; }
+  /**
+   * Parse and validate on the reading thread and hand the messages to the
+   * session on a thread of their own, through a queue of this many
+   * messages.  0 processes them on the reading thread.
+   */
+  void setPipelineDepth( int depth ) { m_pipelineDepth = depth; }
+
 private:
+  bool spin();
+  bool onRecvFailed( SocketRecvFailed& );
   bool readMessage( std::string& msg ) EXCEPT ( SocketRecvFailed );
   void processStream();
   bool send( const std::string& );
+  bool sendBuffers( const std::string* const* buffers, size_t count );
   bool setSession( const std::string& msg );
+  void startPipeline();
+  void stopPipeline();
 
   int m_socket;
   char m_buffer[BUFSIZ];
@@ -79,6 +98,12 @@ private:
   Session* m_pSession;
   bool m_disconnect;
   fd_set m_fds;
+  int m_spinTime;
+  unsigned long m_spinCount;
+  unsigned long m_parkCount;
+  int64_t m_readTime;
+  int m_pipelineDepth;
+  SmartPtr < InboundPipeline > m_pPipeline;
 };
 }
 
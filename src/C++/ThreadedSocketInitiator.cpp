@@ -35,7 +35,8 @@ ThreadedSocketInitiator::ThreadedSocketInitiator(
   const SessionSettings& settings ) EXCEPT ( ConfigError )
 : Initiator( application, factory, settings ),
   m_lastConnect( 0 ), m_reconnectInterval( 30 ), m_noDelay( false ), 
-  m_sendBufSize( 0 ), m_rcvBufSize( 0 ) 
+  m_sendBufSize( 0 ), m_rcvBufSize( 0 ), m_busyPoll( 0 ), m_spinTime( 0 ),
+  m_pipelineDepth( 0 )
 { 
   socket_init(); 
 }
@@ -47,7 +48,8 @@ ThreadedSocketInitiator::ThreadedSocketInitiator(
   LogFactory& logFactory ) EXCEPT ( ConfigError )
 : Initiator( application, factory, settings, logFactory ),
   m_lastConnect( 0 ), m_reconnectInterval( 30 ), m_noDelay( false ), 
-  m_sendBufSize( 0 ), m_rcvBufSize( 0 ) 
+  m_sendBufSize( 0 ), m_rcvBufSize( 0 ), m_busyPoll( 0 ), m_spinTime( 0 ),
+  m_pipelineDepth( 0 )
 { 
   socket_init(); 
 }
@@ -70,6 +72,18 @@ EXCEPT ( ConfigError )
     m_sendBufSize = dict.getInt( SOCKET_SEND_BUFFER_SIZE );
   if( dict.has( SOCKET_RECEIVE_BUFFER_SIZE ) )
     m_rcvBufSize = dict.getInt( SOCKET_RECEIVE_BUFFER_SIZE );
+  if( dict.has( SOCKET_BUSY_POLL ) )
+    m_busyPoll = dict.getInt( SOCKET_BUSY_POLL );
+  if( dict.has( SOCKET_SPIN_TIME ) )
+    m_spinTime = dict.getInt( SOCKET_SPIN_TIME );
+  if( dict.has( INBOUND_PIPELINE_DEPTH ) )
+    m_pipelineDepth = dict.getInt( INBOUND_PIPELINE_DEPTH );
+  if( m_pipelineDepth < 0 )
+    throw ConfigError( std::string( INBOUND_PIPELINE_DEPTH ) + " must not be negative" );
+  m_affinity.clear();
+  if( dict.has( THREAD_AFFINITY )
+      && !thread_parseaffinity( dict.getString( THREAD_AFFINITY ), m_affinity ) )
+    throw ConfigError( std::string( THREAD_AFFINITY ) + " is not a list of processors" );
 }
 
 void ThreadedSocketInitiator::onInitialize( const SessionSettings& s )
@@ -152,12 +166,18 @@ void ThreadedSocketInitiator::doConnect( const SessionID& s, const Dictionary& d
       socket_setsockopt( socket, SO_SNDBUF, m_sendBufSize );
     if( m_rcvBufSize )
       socket_setsockopt( socket, SO_RCVBUF, m_rcvBufSize );
+#ifdef SO_BUSY_POLL
+    if( m_busyPoll )
+      socket_setsockopt( socket, SO_BUSY_POLL, m_busyPoll );
+#endif
 
     setPending( s );
     log->onEvent( "Connecting to " + address + " on port " + IntConvertor::convert((unsigned short)port) + " (Source " + sourceAddress + ":" + IntConvertor::convert((unsigned short)sourcePort) + ")");
 
     ThreadedSocketConnection* pConnection =
       new ThreadedSocketConnection( s, socket, address, port, getLog(), sourceAddress, sourcePort );
+    pConnection->setSpinTime( m_spinTime );
+    pConnection->setPipelineDepth( m_pipelineDepth );
 
     ThreadPair* pair = new ThreadPair( this, pConnection );
 
@@ -225,6 +245,9 @@ THREAD_PROC ThreadedSocketInitiator::socketThread( void* p )
   pInitiator->setConnected( sessionID );
   pInitiator->getLog()->onEvent( "Connection succeeded" );
 
+  if( !thread_setaffinity( pInitiator->m_affinity ) )
+    pInitiator->getLog()->onEvent( "Unable to set thread affinity" );
+
   pSession->next();
 
   while ( pConnection->read() ) {}
@@ -75,6 +75,10 @@ private:
   bool m_noDelay;
   int m_sendBufSize;
   int m_rcvBufSize;
+  int m_busyPoll;
+  int m_spinTime;
+  int m_pipelineDepth;
+  std::set<int> m_affinity;
   SocketToThread m_threads;
   Mutex m_mutex;
 };
@@ -170,4 +170,67 @@ namespace FIX
     int absoluteDay2 = time2.getJulianDate() - time2.getWeekDay();
     return absoluteDay1 == absoluteDay2;
   }
+
+  DateTime TimeRange::getRangeEnd( const DateTime& startTime,
+                                   const DateTime& endTime,
+                                   int startDay,
+                                   int endDay,
+                                   const DateTime& time )
+  {
+    int date = time.getJulianDate();
+    int64_t end = endTime.m_time;
+
+    if( startDay < 0 && endDay < 0 )
+    {
+      // a range that starts where it ends rolls over with the date
+      if( startTime.m_time == end )
+        return DateTime( date + 1, 0 );
+      if( startTime.m_time > end && time.m_time > end )
+        ++date;
+      return DateTime( date, end );
+    }
+
+    // weekly ranges never span the start of a new week
+    int weekDay = time.getWeekDay();
+    int nextWeek = date - weekDay + 8;
+    int days = ( endDay - weekDay + 7 ) % 7;
+    if( days == 0 && time.m_time > end )
+      days = 7;
+
+    if( date + days < nextWeek )
+      return DateTime( date + days, end );
+    return DateTime( nextWeek, 0 );
+  }
+
+  UtcTimeStamp TimeRange::getRangeEnd( const UtcTimeStamp& time )
+  {
+    if( !m_useLocalTime )
+    {
+      UtcTimeStamp result = time;
+      result.set( getRangeEnd( m_startTime, m_endTime, m_startDay, m_endDay, time ) );
+      return result;
+    }
+
+    time_t now = time.getTimeT();
+    time_t offset = LocalTimeStamp( now ).getTimeT() - now;
+    time_t end = getRangeEnd( m_startTime, m_endTime, m_startDay, m_endDay,
+                              LocalTimeStamp( now ) ).getTimeT() - offset;
+
+    // local and utc times only map one to one while the offset between
+    // them holds, so stop at a daylight saving change before the end
+    if( end > now && LocalTimeStamp( end ).getTimeT() - end != offset )
+    {
+      time_t first = now;
+      while( end - first > 1 )
+      {
+        time_t middle = first + ( end - first ) / 2;
+        if( LocalTimeStamp( middle ).getTimeT() - middle == offset )
+          first = middle;
+        else
+          end = middle;
+      }
+    }
+
+    return UtcTimeStamp( end );
+  }
 }
@@ -181,6 +181,12 @@ private:
                              int endDay,
                              const DateTime& time1,
                              const DateTime& time2 );
+
+  static DateTime getRangeEnd( const DateTime& startTime,
+                               const DateTime& endTime,
+                               int startDay,
+                               int endDay,
+                               const DateTime& time );
 public:  
   bool isInRange( const DateTime& dateTime, int day )
   {
@@ -237,6 +243,13 @@ public:
     return isInSameRange( (DateTime)time1, (DateTime)time2 );
   }
 
+  /**
+   * Earliest instant after time at which a later time may no longer be
+   * in the same range as time.  time must be in range; the result may be
+   * earlier than the actual end of the range but never later.
+   */
+  UtcTimeStamp getRangeEnd( const UtcTimeStamp& time );
+
 private:
   bool isInSameRange( const DateTime& time1, const DateTime& time2 )
   {
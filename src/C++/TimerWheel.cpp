@@ -0,0 +1,192 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "TimerWheel.h"
+#include <algorithm>
+
+namespace FIX
+{
+static const int LEVELS = 4;
+static const int SLOT_BITS = 6;
+static const int SLOTS = 1 << SLOT_BITS;
+static const int64_t SLOT_MASK = SLOTS - 1;
+// furthest a timer can be placed from the current tick
+static const int64_t SPAN = ( int64_t ) 1 << ( SLOT_BITS * LEVELS );
+
+TimerWheel::TimerWheel( int resolution, const DateTime& now )
+: m_resolution( resolution > 0 ? resolution : 1 ),
+  m_size( 0 ),
+  m_slots( LEVELS * SLOTS, -1 ),
+  m_occupied( LEVELS, 0 )
+{
+  m_current = tick( now, false );
+}
+
+void TimerWheel::schedule( int id, const DateTime& time )
+{
+  if( id < 0 ) return;
+  if( id >= ( int ) m_timers.size() )
+    m_timers.resize( id + 1 );
+
+  if( m_timers[ id ].m_slot >= 0 )
+    unlink( id );
+  else
+    ++m_size;
+  m_timers[ id ].m_tick = tick( time, true );
+  insert( id, m_current + 1 );
+}
+
+void TimerWheel::cancel( int id )
+{
+  if( !isScheduled( id ) ) return;
+  unlink( id );
+  m_timers[ id ].m_slot = -1;
+  --m_size;
+}
+
+void TimerWheel::clear()
+{
+  std::fill( m_slots.begin(), m_slots.end(), -1 );
+  std::fill( m_occupied.begin(), m_occupied.end(), 0 );
+  std::fill( m_timers.begin(), m_timers.end(), Timer() );
+  m_size = 0;
+}
+
+int TimerWheel::expire( const DateTime& now, Timers& timers )
+{
+  int64_t target = tick( now, false );
+  int count = 0;
+
+  while( m_current < target && m_size )
+  {
+    int64_t at = next();
+    if( at > target ) break;
+    m_current = at;
+
+    for( int level = 1; level < LEVELS; ++level )
+    {
+      if( m_current & ( ( ( int64_t ) 1 << ( SLOT_BITS * level ) ) - 1 ) )
+        break;
+      cascade( level );
+    }
+
+    int slot = ( int ) ( m_current & SLOT_MASK );
+    int id = m_slots[ slot ];
+    m_slots[ slot ] = -1;
+    m_occupied[ 0 ] &= ~( ( uint64_t ) 1 << slot );
+    while( id >= 0 )
+    {
+      Timer& timer = m_timers[ id ];
+      timer.m_slot = -1;
+      timers.push_back( id );
+      --m_size;
+      ++count;
+      id = timer.m_next;
+    }
+  }
+
+  // nothing left to fire or cascade on the way, jump straight to now
+  if( m_current < target )
+    m_current = target;
+  return count;
+}
+
+double TimerWheel::timeout() const
+{
+  if( !m_size )
+    return 0;
+  return ( double ) ( ( next() - m_current ) * m_resolution ) / 1000.0;
+}
+
+int64_t TimerWheel::tick( const DateTime& time, bool roundUp ) const
+{
+  int64_t nanosPerTick = ( int64_t ) m_resolution * 1000000;
+  int64_t nanos = time.getNanosSinceEpoch();
+  return roundUp ? ( nanos + nanosPerTick - 1 ) / nanosPerTick
+                 : nanos / nanosPerTick;
+}
+
+int64_t TimerWheel::next() const
+{
+  // first level slots after the current one and before the wrap
+  int offset = ( int ) ( m_current & SLOT_MASK );
+  uint64_t ahead = offset == SLOT_MASK
+    ? 0 : m_occupied[ 0 ] & ( ~( uint64_t ) 0 << ( offset + 1 ) );
+  if( ahead )
+    return ( m_current & ~SLOT_MASK ) + __builtin_ctzll( ahead );
+  return ( m_current | SLOT_MASK ) + 1;
+}
+
+void TimerWheel::insert( int id, int64_t earliest )
+{
+  Timer& timer = m_timers[ id ];
+  int64_t at = std::max( timer.m_tick, earliest );
+  if( at - m_current >= SPAN )
+    at = m_current + SPAN - 1;
+
+  int level = 0;
+  while( level < LEVELS - 1 &&
+         ( at - m_current ) >= ( ( int64_t ) 1 << ( SLOT_BITS * ( level + 1 ) ) ) )
+    ++level;
+
+  int slot = ( int ) ( ( at >> ( SLOT_BITS * level ) ) & SLOT_MASK );
+  timer.m_slot = level * SLOTS + slot;
+  timer.m_prev = -1;
+  timer.m_next = m_slots[ timer.m_slot ];
+  if( timer.m_next >= 0 )
+    m_timers[ timer.m_next ].m_prev = id;
+  m_slots[ timer.m_slot ] = id;
+  m_occupied[ level ] |= ( uint64_t ) 1 << slot;
+}
+
+void TimerWheel::unlink( int id )
+{
+  Timer& timer = m_timers[ id ];
+  if( timer.m_prev >= 0 )
+    m_timers[ timer.m_prev ].m_next = timer.m_next;
+  else
+    m_slots[ timer.m_slot ] = timer.m_next;
+  if( timer.m_next >= 0 )
+    m_timers[ timer.m_next ].m_prev = timer.m_prev;
+
+  if( m_slots[ timer.m_slot ] < 0 )
+    m_occupied[ timer.m_slot / SLOTS ] &= ~( ( uint64_t ) 1 << ( timer.m_slot & SLOT_MASK ) );
+}
+
+void TimerWheel::cascade( int level )
+{
+  int slot = ( int ) ( ( m_current >> ( SLOT_BITS * level ) ) & SLOT_MASK );
+  int id = m_slots[ level * SLOTS + slot ];
+  m_slots[ level * SLOTS + slot ] = -1;
+  m_occupied[ level ] &= ~( ( uint64_t ) 1 << slot );
+  // the current tick has not fired yet, so timers due now land on it
+  while( id >= 0 )
+  {
+    int following = m_timers[ id ].m_next;
+    insert( id, m_current );
+    id = following;
+  }
+}
+}
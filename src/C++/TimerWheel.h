@@ -0,0 +1,108 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_TIMERWHEEL_H
+#define FIX_TIMERWHEEL_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "FieldTypes.h"
+#include <vector>
+
+namespace FIX
+{
+/**
+ * Hierarchical timing wheel of integer timer ids.
+ *
+ * Deadlines are rounded up to a tick of resolution milliseconds.  The
+ * first level holds the next 64 ticks, each further level covers 64 times
+ * the span of the one below and is cascaded down as time reaches it.
+ * Timers are kept in a table indexed by id and linked into their slot, so
+ * scheduling and cancelling are constant time and do not allocate once
+ * the table has grown to the largest id.  Ids are meant to be small and
+ * non-negative, like socket descriptors; negative ids are ignored.
+ * Expiring jumps from one occupied slot or cascade to the next instead of
+ * stepping every tick.  A timer is either scheduled or not; scheduling it
+ * again moves it.
+ */
+class TimerWheel
+{
+public:
+  typedef std::vector < int > Timers;
+
+  TimerWheel( int resolution = 10, const DateTime& now = UtcTimeStamp() );
+
+  /// Milliseconds per tick
+  int resolution() const { return m_resolution; }
+
+  /// Number of pending timers
+  int size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+  bool isScheduled( int id ) const
+  { return id >= 0 && id < ( int ) m_timers.size() && m_timers[ id ].m_slot >= 0; }
+
+  /// Fire id at or after time, replacing any pending deadline
+  void schedule( int id, const DateTime& time );
+  void cancel( int id );
+  void clear();
+
+  /// Advance to now, appending the ids of timers that fired
+  int expire( const DateTime& now, Timers& timers );
+
+  /**
+   * Seconds from the last expire() until the next timer may fire or
+   * the next level has to be cascaded.  0 if nothing is scheduled.
+   */
+  double timeout() const;
+
+private:
+  struct Timer
+  {
+    Timer() : m_tick( 0 ), m_slot( -1 ), m_prev( -1 ), m_next( -1 ) {}
+
+    int64_t m_tick;
+    /// index into m_slots, -1 if not scheduled
+    int m_slot;
+    int m_prev;
+    int m_next;
+  };
+
+  int64_t tick( const DateTime& time, bool roundUp ) const;
+  /// Tick of the next occupied first level slot or cascade
+  int64_t next() const;
+  void insert( int id, int64_t earliest );
+  void unlink( int id );
+  void cascade( int level );
+
+  int m_resolution;
+  int64_t m_current;
+  int m_size;
+  std::vector < Timer > m_timers;
+  /// first timer id of each slot, -1 if empty
+  std::vector < int > m_slots;
+  /// one bit per occupied slot of each level
+  std::vector < uint64_t > m_occupied;
+};
+}
+
+#endif //FIX_TIMERWHEEL_H
@@ -0,0 +1,295 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#if HAVE_IO_URING
+
+#include "UringAcceptor.h"
+#include "Session.h"
+#include "Settings.h"
+#include "Utility.h"
+#include "Exceptions.h"
+
+namespace FIX
+{
+UringAcceptor::UringAcceptor( Application& application,
+                              MessageStoreFactory& factory,
+                              const SessionSettings& settings ) EXCEPT ( ConfigError )
+: Acceptor( application, factory, settings ),
+  m_pMonitor( 0 ) {}
+
+UringAcceptor::UringAcceptor( Application& application,
+                              MessageStoreFactory& factory,
+                              const SessionSettings& settings,
+                              LogFactory& logFactory ) EXCEPT ( ConfigError )
+: Acceptor( application, factory, settings, logFactory ),
+  m_pMonitor( 0 ) {}
+
+UringAcceptor::~UringAcceptor()
+{
+  close();
+}
+
+void UringAcceptor::onConfigure( const SessionSettings& s )
+EXCEPT ( ConfigError )
+{
+  std::set<SessionID> sessions = s.getSessions();
+  std::set<SessionID>::iterator i;
+  for( i = sessions.begin(); i != sessions.end(); ++i )
+  {
+    const Dictionary& settings = s.get( *i );
+    settings.getInt( SOCKET_ACCEPT_PORT );
+    if( settings.has(SOCKET_REUSE_ADDRESS) )
+      settings.getBool( SOCKET_REUSE_ADDRESS );
+    if( settings.has(SOCKET_NODELAY) )
+      settings.getBool( SOCKET_NODELAY );
+  }
+
+  const Dictionary& dict = s.get();
+  if( dict.has(URING_QUEUE_DEPTH) )
+    dict.getInt( URING_QUEUE_DEPTH );
+  if( dict.has(URING_BUFFER_COUNT) )
+    dict.getInt( URING_BUFFER_COUNT );
+  if( dict.has(URING_SQ_POLL) )
+    dict.getBool( URING_SQ_POLL );
+}
+
+void UringAcceptor::onInitialize( const SessionSettings& s )
+EXCEPT ( RuntimeError )
+{
+  close();
+
+  const Dictionary& dict = s.get();
+  const int entries = dict.has( URING_QUEUE_DEPTH ) ?
+    dict.getInt( URING_QUEUE_DEPTH ) : 1024;
+  const int buffers = dict.has( URING_BUFFER_COUNT ) ?
+    dict.getInt( URING_BUFFER_COUNT ) : 1024;
+  const bool sqPoll = dict.has( URING_SQ_POLL ) ?
+    dict.getBool( URING_SQ_POLL ) : false;
+
+  try
+  {
+    m_pMonitor = new UringMonitor( entries, buffers, 4096, sqPoll );
+  }
+  catch( SocketException& e )
+  {
+    throw RuntimeError( std::string( "Unable to create io_uring (" ) + e.what() + ")" );
+  }
+
+  short port = 0;
+  std::set<SessionID> sessions = s.getSessions();
+  std::set<SessionID>::iterator i = sessions.begin();
+  for( ; i != sessions.end(); ++i )
+  {
+    const Dictionary& settings = s.get( *i );
+    port = (short)settings.getInt( SOCKET_ACCEPT_PORT );
+
+    const bool reuseAddress = settings.has( SOCKET_REUSE_ADDRESS ) ?
+      settings.getBool( SOCKET_REUSE_ADDRESS ) : true;
+
+    const bool noDelay = settings.has( SOCKET_NODELAY ) ?
+      settings.getBool( SOCKET_NODELAY ) : false;
+
+    const int sendBufSize = settings.has( SOCKET_SEND_BUFFER_SIZE ) ?
+      settings.getInt( SOCKET_SEND_BUFFER_SIZE ) : 0;
+
+    const int rcvBufSize = settings.has( SOCKET_RECEIVE_BUFFER_SIZE ) ?
+      settings.getInt( SOCKET_RECEIVE_BUFFER_SIZE ) : 0;
+
+    m_portToSessions[port].insert( *i );
+
+    bool found = false;
+    SocketToInfo::iterator j;
+    for( j = m_socketToInfo.begin(); j != m_socketToInfo.end(); ++j )
+      found = found || j->second.m_port == port;
+    if( found )
+      continue;
+
+    int socket = socket_createAcceptor( port, reuseAddress );
+    if( socket < 0 )
+    {
+      SocketException e;
+      close();
+      throw RuntimeError( "Unable to create, bind, or listen to port "
+                         + IntConvertor::convert( (unsigned short)port ) + " (" + e.what() + ")" );
+    }
+
+    m_socketToInfo[ socket ] =
+      SocketInfo( socket, port, noDelay, sendBufSize, rcvBufSize );
+    m_pMonitor->addAccept( socket );
+  }
+}
+
+void UringAcceptor::onStart()
+{
+  while ( !isStopped() && m_pMonitor )
+  {
+    m_pMonitor->block( *this, false, m_timers.timeout() );
+    onTimeout();
+  }
+
+  if( !m_pMonitor )
+    return;
+
+  time_t start = 0;
+  time_t now = 0;
+
+  ::time( &start );
+  while ( isLoggedOn() )
+  {
+    m_pMonitor->block( *this, false, m_timers.timeout() );
+    onTimeout();
+    if( ::time(&now) -5 >= start )
+      break;
+  }
+
+  close();
+}
+
+bool UringAcceptor::onPoll( double timeout )
+{
+  if( !m_pMonitor )
+    return false;
+
+  time_t start = 0;
+  time_t now = 0;
+
+  if( isStopped() )
+  {
+    if( start == 0 )
+      ::time( &start );
+    if( !isLoggedOn() )
+    {
+      start = 0;
+      return false;
+    }
+    if( ::time(&now) - 5 >= start )
+    {
+      start = 0;
+      return false;
+    }
+  }
+
+  m_pMonitor->block( *this, true, timeout );
+  onTimeout();
+  return true;
+}
+
+void UringAcceptor::onStop()
+{
+}
+
+void UringAcceptor::onAccept( UringMonitor& monitor, int a, int s )
+{
+  UringConnections::iterator i = m_connections.find( s );
+  if ( i != m_connections.end() ) return;
+
+  const SocketInfo& info = m_socketToInfo[ a ];
+  if( info.m_noDelay )
+    socket_setsockopt( s, TCP_NODELAY );
+  if( info.m_sendBufSize )
+    socket_setsockopt( s, SO_SNDBUF, info.m_sendBufSize );
+  if( info.m_rcvBufSize )
+    socket_setsockopt( s, SO_RCVBUF, info.m_rcvBufSize );
+
+  Sessions sessions = m_portToSessions[ info.m_port ];
+  m_connections[ s ] = new UringConnection( s, sessions, &monitor );
+  m_timers.schedule( s, m_connections[ s ]->getNextTimeout( UtcTimeStamp() ) );
+
+  std::stringstream stream;
+  stream << "Accepted connection from " << socket_peername( s ) << " on port " << info.m_port;
+
+  if( getLog() )
+    getLog()->onEvent( stream.str() );
+}
+
+void UringAcceptor::onData( UringMonitor& monitor, int s, const char* data, size_t size )
+{
+  UringConnections::iterator i = m_connections.find( s );
+  if ( i == m_connections.end() ) return;
+  if( !i->second->read( *this, data, size ) )
+    monitor.drop( s );
+}
+
+void UringAcceptor::onDisconnect( UringMonitor&, int s )
+{
+  UringConnections::iterator i = m_connections.find( s );
+  if ( i == m_connections.end() ) return ;
+  UringConnection* pUringConnection = i->second;
+
+  Session* pSession = pUringConnection->getSession();
+  if ( pSession ) pSession->disconnect();
+
+  delete pUringConnection;
+  m_connections.erase( s );
+  m_timers.cancel( s );
+}
+
+void UringAcceptor::onWake( UringMonitor&, int s )
+{
+  UringConnections::iterator i = m_connections.find( s );
+  if ( i == m_connections.end() ) return ;
+  m_timers.schedule( s, i->second->getNextTimeout( UtcTimeStamp() ) );
+}
+
+void UringAcceptor::onError( UringMonitor& )
+{
+}
+
+void UringAcceptor::onTimeout()
+{
+  UtcTimeStamp now;
+  TimerWheel::Timers timers;
+  m_timers.expire( now, timers );
+
+  TimerWheel::Timers::iterator i;
+  for ( i = timers.begin(); i != timers.end(); ++i )
+  {
+    UringConnections::iterator j = m_connections.find( *i );
+    if ( j == m_connections.end() ) continue;
+    j->second->onTimeout();
+    m_timers.schedule( *i, j->second->getNextTimeout( now ) );
+  }
+}
+
+void UringAcceptor::close()
+{
+  UringConnections::iterator i;
+  for ( i = m_connections.begin(); i != m_connections.end(); ++i )
+  {
+    Session* pSession = i->second->getSession();
+    if ( pSession ) pSession->disconnect();
+    delete i->second;
+  }
+  m_connections.clear();
+  m_timers.clear();
+
+  // the monitor closes the listening sockets along with the connections
+  delete m_pMonitor;
+  m_pMonitor = 0;
+  m_socketToInfo.clear();
+}
+}
+
+#endif //HAVE_IO_URING
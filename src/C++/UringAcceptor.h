@@ -0,0 +1,83 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef HAVE_IO_URING
+#error UringAcceptor.h included, but HAVE_IO_URING not defined
+#endif
+
+#ifdef HAVE_IO_URING
+#ifndef FIX_URINGACCEPTOR_H
+#define FIX_URINGACCEPTOR_H
+
+#include "Acceptor.h"
+#include "SocketServer.h"
+#include "UringMonitor.h"
+#include "UringConnection.h"
+#include "TimerWheel.h"
+
+namespace FIX
+{
+/// io_uring implementation of Acceptor.
+class UringAcceptor : public Acceptor, UringMonitor::Strategy
+{
+  friend class UringConnection;
+public:
+  UringAcceptor( Application&, MessageStoreFactory&,
+                 const SessionSettings& ) EXCEPT ( ConfigError );
+  UringAcceptor( Application&, MessageStoreFactory&,
+                 const SessionSettings&, LogFactory& ) EXCEPT ( ConfigError );
+
+  virtual ~UringAcceptor();
+
+  UringMonitor* getMonitor() { return m_pMonitor; }
+
+private:
+  typedef std::set < SessionID > Sessions;
+  typedef std::map < int, Sessions > PortToSessions;
+  typedef std::map < int, SocketInfo > SocketToInfo;
+  typedef std::map < int, UringConnection* > UringConnections;
+
+  void onConfigure( const SessionSettings& ) EXCEPT ( ConfigError );
+  void onInitialize( const SessionSettings& ) EXCEPT ( RuntimeError );
+
+  void onStart();
+  bool onPoll( double timeout );
+  void onStop();
+
+  void onAccept( UringMonitor&, int, int );
+  void onData( UringMonitor&, int, const char*, size_t );
+  void onDisconnect( UringMonitor&, int );
+  void onWake( UringMonitor&, int );
+  void onError( UringMonitor& );
+  void onTimeout();
+  void close();
+
+  UringMonitor* m_pMonitor;
+  PortToSessions m_portToSessions;
+  SocketToInfo m_socketToInfo;
+  UringConnections m_connections;
+  TimerWheel m_timers;
+};
+/*! @} */
+}
+
+#endif //FIX_URINGACCEPTOR_H
+#endif //HAVE_IO_URING
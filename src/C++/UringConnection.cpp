@@ -0,0 +1,181 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#if HAVE_IO_URING
+
+#include "UringConnection.h"
+#include "UringAcceptor.h"
+#include "UringInitiator.h"
+#include "Session.h"
+
+namespace FIX
+{
+UringConnection::UringConnection( int s, Sessions sessions,
+                                  UringMonitor* pMonitor )
+: m_socket( s ), m_sessions( sessions ), m_pSession( 0 ),
+  m_pMonitor( pMonitor ), m_readTime( 0 ) {}
+
+UringConnection::UringConnection( UringInitiator& i,
+                                  const SessionID& sessionID, int s,
+                                  UringMonitor* pMonitor )
+: m_socket( s ), m_pSession( i.getSession( sessionID, *this ) ),
+  m_pMonitor( pMonitor ), m_readTime( 0 )
+{
+  m_sessions.insert( sessionID );
+}
+
+UringConnection::~UringConnection()
+{
+  if ( m_pSession )
+    Session::unregisterSession( m_pSession->getSessionID() );
+}
+
+bool UringConnection::send( const std::string& msg )
+{
+  return m_pMonitor->send( m_socket, msg );
+}
+
+void UringConnection::disconnect()
+{
+  if ( m_pMonitor )
+    m_pMonitor->drop( m_socket );
+}
+
+bool UringConnection::read( UringInitiator&, const char* data, size_t size )
+{
+  if ( !m_pSession ) return false;
+
+  if( m_pSession->getLatencyHistograms() )
+    m_readTime = LatencyHistogram::now();
+  m_parser.addToStream( data, size );
+  readMessages();
+  return true;
+}
+
+bool UringConnection::read( UringAcceptor& a, const char* data, size_t size )
+{
+  if( m_pSession && m_pSession->getLatencyHistograms() )
+    m_readTime = LatencyHistogram::now();
+  m_parser.addToStream( data, size );
+  if ( m_pSession )
+  {
+    readMessages();
+    return true;
+  }
+
+  // the first message selects the session
+  std::string msg;
+  if ( !readMessage( msg ) )
+    return true;
+
+  m_pSession = Session::lookupSession( msg, true );
+  if( !isValidSession() )
+  {
+    m_pSession = 0;
+    if( a.getLog() )
+    {
+      a.getLog()->onEvent( "Session not found for incoming message: " + msg );
+      a.getLog()->onIncoming( msg );
+    }
+  }
+  if( m_pSession )
+    m_pSession = a.getSession( msg, *this );
+  if( m_pSession )
+  {
+    try
+    {
+      m_pSession->next( msg, UtcTimeStamp() );
+    }
+    catch ( InvalidMessage& )
+    {
+      m_pSession = 0;
+    }
+  }
+  if( !m_pSession )
+    return false;
+
+  Session::registerSession( m_pSession->getSessionID() );
+
+  // a logon may arrive together with the messages that follow it
+  readMessages();
+  return true;
+}
+
+bool UringConnection::isValidSession()
+{
+  if( m_pSession == 0 )
+    return false;
+  SessionID sessionID = m_pSession->getSessionID();
+  if( Session::isSessionRegistered(sessionID) )
+    return false;
+  return !( m_sessions.find(sessionID) == m_sessions.end() );
+}
+
+bool UringConnection::readMessage( std::string& msg )
+{
+  try
+  {
+    return m_parser.readFixMessage( msg );
+  }
+  catch ( MessageParseError& ) {}
+  return true;
+}
+
+void UringConnection::readMessages()
+{
+  if( !m_pSession ) return;
+
+  std::string msg;
+  while( readMessage( msg ) )
+  {
+    try
+    {
+      if( m_readTime )
+        m_pSession->recordLatency( Session::LATENCY_FRAME, m_readTime );
+      m_pSession->next( msg, UtcTimeStamp() );
+    }
+    catch ( InvalidMessage& )
+    {
+      if( !m_pSession->isLoggedOn() )
+        m_pMonitor->drop( m_socket );
+    }
+  }
+}
+
+void UringConnection::onTimeout()
+{
+  if ( m_pSession ) m_pSession->next();
+}
+
+UtcTimeStamp UringConnection::getNextTimeout( const UtcTimeStamp& now )
+{
+  if ( m_pSession ) return m_pSession->getNextTimeout( now );
+  UtcTimeStamp next = now;
+  next += 1;
+  return next;
+}
+}
+
+#endif //HAVE_IO_URING
@@ -0,0 +1,80 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef HAVE_IO_URING
+#error UringConnection.h included, but HAVE_IO_URING not defined
+#endif
+
+#ifdef HAVE_IO_URING
+#ifndef FIX_URINGCONNECTION_H
+#define FIX_URINGCONNECTION_H
+
+#include "Parser.h"
+#include "Responder.h"
+#include "SessionID.h"
+#include "UringMonitor.h"
+#include "FieldTypes.h"
+#include <set>
+
+namespace FIX
+{
+class UringAcceptor;
+class UringInitiator;
+class Session;
+
+/// Encapsulates a socket driven by a UringMonitor.
+class UringConnection : Responder
+{
+public:
+  typedef std::set<SessionID> Sessions;
+
+  UringConnection( int s, Sessions sessions, UringMonitor* pMonitor );
+  UringConnection( UringInitiator&, const SessionID&, int, UringMonitor* );
+  virtual ~UringConnection();
+
+  int getSocket() const { return m_socket; }
+  Session* getSession() const { return m_pSession; }
+
+  bool read( UringAcceptor&, const char* data, size_t size );
+  bool read( UringInitiator&, const char* data, size_t size );
+
+  void onTimeout();
+  UtcTimeStamp getNextTimeout( const UtcTimeStamp& now );
+
+private:
+  bool isValidSession();
+  bool readMessage( std::string& msg );
+  void readMessages();
+  bool send( const std::string& );
+  void disconnect();
+  void reschedule() { m_pMonitor->wake( m_socket ); }
+
+  int m_socket;
+  Parser m_parser;
+  Sessions m_sessions;
+  Session* m_pSession;
+  UringMonitor* m_pMonitor;
+  int64_t m_readTime;
+};
+}
+
+#endif //FIX_URINGCONNECTION_H
+#endif //HAVE_IO_URING
@@ -0,0 +1,378 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#if HAVE_IO_URING
+
+#include "UringInitiator.h"
+#include "Session.h"
+#include "Settings.h"
+#include <netinet/tcp.h>
+
+namespace FIX
+{
+UringInitiator::UringInitiator( Application& application,
+                                MessageStoreFactory& factory,
+                                const SessionSettings& settings )
+EXCEPT ( ConfigError )
+: Initiator( application, factory, settings ),
+  m_pMonitor( 0 ), m_lastConnect( 0 ),
+  m_reconnectInterval( 30 ), m_noDelay( false ), m_sendBufSize( 0 ),
+  m_rcvBufSize( 0 ) {}
+
+UringInitiator::UringInitiator( Application& application,
+                                MessageStoreFactory& factory,
+                                const SessionSettings& settings,
+                                LogFactory& logFactory )
+EXCEPT ( ConfigError )
+: Initiator( application, factory, settings, logFactory ),
+  m_pMonitor( 0 ), m_lastConnect( 0 ),
+  m_reconnectInterval( 30 ), m_noDelay( false ), m_sendBufSize( 0 ),
+  m_rcvBufSize( 0 ) {}
+
+UringInitiator::~UringInitiator()
+{
+  close();
+}
+
+void UringInitiator::onConfigure( const SessionSettings& s )
+EXCEPT ( ConfigError )
+{
+  const Dictionary& dict = s.get();
+
+  if( dict.has( RECONNECT_INTERVAL ) )
+    m_reconnectInterval = dict.getInt( RECONNECT_INTERVAL );
+  if( dict.has( SOCKET_NODELAY ) )
+    m_noDelay = dict.getBool( SOCKET_NODELAY );
+  if( dict.has( SOCKET_SEND_BUFFER_SIZE ) )
+    m_sendBufSize = dict.getInt( SOCKET_SEND_BUFFER_SIZE );
+  if( dict.has( SOCKET_RECEIVE_BUFFER_SIZE ) )
+    m_rcvBufSize = dict.getInt( SOCKET_RECEIVE_BUFFER_SIZE );
+  if( dict.has( URING_QUEUE_DEPTH ) )
+    dict.getInt( URING_QUEUE_DEPTH );
+  if( dict.has( URING_BUFFER_COUNT ) )
+    dict.getInt( URING_BUFFER_COUNT );
+  if( dict.has( URING_SQ_POLL ) )
+    dict.getBool( URING_SQ_POLL );
+}
+
+void UringInitiator::onInitialize( const SessionSettings& s )
+EXCEPT ( RuntimeError )
+{
+  close();
+
+  const Dictionary& dict = s.get();
+  const int entries = dict.has( URING_QUEUE_DEPTH ) ?
+    dict.getInt( URING_QUEUE_DEPTH ) : 1024;
+  const int buffers = dict.has( URING_BUFFER_COUNT ) ?
+    dict.getInt( URING_BUFFER_COUNT ) : 1024;
+  const bool sqPoll = dict.has( URING_SQ_POLL ) ?
+    dict.getBool( URING_SQ_POLL ) : false;
+
+  try
+  {
+    m_pMonitor = new UringMonitor( entries, buffers, 4096, sqPoll );
+  }
+  catch( SocketException& e )
+  {
+    throw RuntimeError( std::string( "Unable to create io_uring (" ) + e.what() + ")" );
+  }
+}
+
+void UringInitiator::onStart()
+{
+  connect();
+
+  while ( !isStopped() ) {
+    double timeout = m_timers.timeout();
+    m_pMonitor->block( *this, false, timeout ? timeout : 1.0 );
+    onTimeout();
+  }
+
+  time_t start = 0;
+  time_t now = 0;
+
+  ::time( &start );
+  while ( isLoggedOn() )
+  {
+    m_pMonitor->block( *this, false, m_timers.timeout() );
+    onTimeout();
+    if( ::time(&now) -5 >= start )
+      break;
+  }
+
+  close();
+}
+
+bool UringInitiator::onPoll( double timeout )
+{
+  time_t start = 0;
+  time_t now = 0;
+
+  if( isStopped() )
+  {
+    if( start == 0 )
+      ::time( &start );
+    if( !isLoggedOn() )
+      return false;
+    if( ::time(&now) - 5 >= start )
+      return false;
+  }
+
+  m_pMonitor->block( *this, true, timeout );
+  onTimeout();
+  return true;
+}
+
+void UringInitiator::onStop()
+{
+}
+
+void UringInitiator::doConnect( const SessionID& s, const Dictionary& d )
+{
+  try
+  {
+    std::string address;
+    short port = 0;
+    std::string sourceAddress;
+    short sourcePort = 0;
+
+    Session* session = Session::lookupSession( s );
+    if( !session->isSessionTime(UtcTimeStamp()) ) return;
+    if( !m_pMonitor ) return;
+
+    Log* log = session->getLog();
+
+    getHost( s, d, address, port, sourceAddress, sourcePort );
+
+    log->onEvent( "Connecting to " + address + " on port " + IntConvertor::convert((unsigned short)port) + " (Source " + sourceAddress + ":" + IntConvertor::convert((unsigned short)sourcePort) + ")");
+
+    const char* hostname = socket_hostname( address.c_str() );
+    if( hostname == 0 )
+    {
+      log->onEvent( "Unable to resolve " + address );
+      return;
+    }
+
+    sockaddr_in addr;
+    memset( &addr, 0, sizeof(addr) );
+    addr.sin_family = PF_INET;
+    addr.sin_port = htons( port );
+    addr.sin_addr.s_addr = inet_addr( hostname );
+
+    int result = socket_createConnector();
+    if( result < 0 ) return;
+
+    if( m_noDelay )
+      socket_setsockopt( result, TCP_NODELAY );
+    if( m_sendBufSize )
+      socket_setsockopt( result, SO_SNDBUF, m_sendBufSize );
+    if( m_rcvBufSize )
+      socket_setsockopt( result, SO_RCVBUF, m_rcvBufSize );
+    if ( !sourceAddress.empty() || sourcePort )
+      socket_bind( result, sourceAddress.c_str(), sourcePort );
+
+    if( !m_pMonitor->addConnect( result, addr ) )
+    {
+      socket_close( result );
+      return;
+    }
+    setPending( s );
+
+    m_pendingConnections[ result ]
+      = new UringConnection( *this, s, result, m_pMonitor );
+  }
+  catch ( std::exception& ) {}
+}
+
+void UringInitiator::onConnect( UringMonitor&, int s )
+{
+  UringConnections::iterator i = m_pendingConnections.find( s );
+  if( i == m_pendingConnections.end() ) return;
+  UringConnection* pUringConnection = i->second;
+
+  m_connections[s] = pUringConnection;
+  m_pendingConnections.erase( i );
+  setConnected( pUringConnection->getSession()->getSessionID() );
+  pUringConnection->onTimeout();
+  m_timers.schedule( s, pUringConnection->getNextTimeout( UtcTimeStamp() ) );
+}
+
+void UringInitiator::onData( UringMonitor& monitor, int s, const char* data, size_t size )
+{
+  UringConnections::iterator i = m_connections.find( s );
+  if ( i == m_connections.end() ) return;
+  if( !i->second->read( *this, data, size ) )
+    monitor.drop( s );
+}
+
+void UringInitiator::onDisconnect( UringMonitor&, int s )
+{
+  UringConnections::iterator i = m_connections.find( s );
+  UringConnections::iterator j = m_pendingConnections.find( s );
+
+  UringConnection* pUringConnection = 0;
+  if( i != m_connections.end() )
+    pUringConnection = i->second;
+  if( j != m_pendingConnections.end() )
+    pUringConnection = j->second;
+  if( !pUringConnection )
+    return;
+
+  Session* pSession = pUringConnection->getSession();
+  if ( pSession )
+  {
+    pSession->disconnect();
+    setDisconnected( pSession->getSessionID() );
+  }
+
+  delete pUringConnection;
+  m_connections.erase( s );
+  m_pendingConnections.erase( s );
+  m_timers.cancel( s );
+}
+
+void UringInitiator::onWake( UringMonitor&, int s )
+{
+  UringConnections::iterator i = m_connections.find( s );
+  if ( i == m_connections.end() ) return ;
+  m_timers.schedule( s, i->second->getNextTimeout( UtcTimeStamp() ) );
+}
+
+void UringInitiator::onError( UringMonitor& )
+{
+  onTimeout();
+}
+
+void UringInitiator::onTimeout()
+{
+  time_t now;
+  ::time( &now );
+
+  if ( (now - m_lastConnect) >= m_reconnectInterval )
+  {
+    connect();
+    m_lastConnect = now;
+  }
+
+  UtcTimeStamp timeStamp;
+  TimerWheel::Timers timers;
+  m_timers.expire( timeStamp, timers );
+
+  TimerWheel::Timers::iterator i;
+  for ( i = timers.begin(); i != timers.end(); ++i )
+  {
+    UringConnections::iterator j = m_connections.find( *i );
+    if ( j == m_connections.end() ) continue;
+    j->second->onTimeout();
+    m_timers.schedule( *i, j->second->getNextTimeout( timeStamp ) );
+  }
+}
+
+void UringInitiator::close()
+{
+  UringConnections::iterator i;
+  for ( i = m_connections.begin(); i != m_connections.end(); ++i )
+  {
+    Session* pSession = i->second->getSession();
+    if ( pSession )
+    {
+      pSession->disconnect();
+      setDisconnected( pSession->getSessionID() );
+    }
+    delete i->second;
+  }
+
+  for ( i = m_pendingConnections.begin(); i != m_pendingConnections.end(); ++i )
+  {
+    Session* pSession = i->second->getSession();
+    if ( pSession )
+    {
+      pSession->disconnect();
+      setDisconnected( pSession->getSessionID() );
+    }
+    delete i->second;
+  }
+
+  m_connections.clear();
+  m_pendingConnections.clear();
+  m_timers.clear();
+
+  delete m_pMonitor;
+  m_pMonitor = 0;
+}
+
+void UringInitiator::getHost( const SessionID& s, const Dictionary& d,
+                              std::string& address, short& port,
+                              std::string& sourceAddress, short& sourcePort)
+{
+  int num = 0;
+  SessionToHostNum::iterator i = m_sessionToHostNum.find( s );
+  if ( i != m_sessionToHostNum.end() ) num = i->second;
+
+  std::stringstream hostStream;
+  hostStream << SOCKET_CONNECT_HOST << num;
+  std::string hostString = hostStream.str();
+
+  std::stringstream portStream;
+  portStream << SOCKET_CONNECT_PORT << num;
+  std::string portString = portStream.str();
+
+  sourcePort = 0;
+  sourceAddress.clear();
+
+  if( d.has(hostString) && d.has(portString) )
+  {
+    address = d.getString( hostString );
+    port = ( short ) d.getInt( portString );
+
+    std::stringstream sourceHostStream;
+    sourceHostStream << SOCKET_CONNECT_SOURCE_HOST << num;
+    hostString = sourceHostStream.str();
+    if( d.has(hostString) )
+      sourceAddress = d.getString( hostString );
+
+    std::stringstream sourcePortStream;
+    sourcePortStream << SOCKET_CONNECT_SOURCE_PORT << num;
+    portString = sourcePortStream.str();
+    if( d.has(portString) )
+      sourcePort = ( short ) d.getInt( portString );
+  }
+  else
+  {
+    num = 0;
+    address = d.getString( SOCKET_CONNECT_HOST );
+    port = ( short ) d.getInt( SOCKET_CONNECT_PORT );
+
+    if( d.has(SOCKET_CONNECT_SOURCE_HOST) )
+      sourceAddress = d.getString( SOCKET_CONNECT_SOURCE_HOST );
+    if( d.has(SOCKET_CONNECT_SOURCE_PORT) )
+      sourcePort = ( short ) d.getInt( SOCKET_CONNECT_SOURCE_PORT );
+  }
+
+  m_sessionToHostNum[ s ] = ++num;
+}
+}
+
+#endif //HAVE_IO_URING
@@ -0,0 +1,87 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef HAVE_IO_URING
+#error UringInitiator.h included, but HAVE_IO_URING not defined
+#endif
+
+#ifdef HAVE_IO_URING
+#ifndef FIX_URINGINITIATOR_H
+#define FIX_URINGINITIATOR_H
+
+#include "Initiator.h"
+#include "UringMonitor.h"
+#include "UringConnection.h"
+#include "TimerWheel.h"
+
+namespace FIX
+{
+/// io_uring implementation of Initiator.
+class UringInitiator : public Initiator, UringMonitor::Strategy
+{
+public:
+  UringInitiator( Application&, MessageStoreFactory&,
+                  const SessionSettings& ) EXCEPT ( ConfigError );
+  UringInitiator( Application&, MessageStoreFactory&,
+                  const SessionSettings&, LogFactory& ) EXCEPT ( ConfigError );
+
+  virtual ~UringInitiator();
+
+  UringMonitor* getMonitor() { return m_pMonitor; }
+
+private:
+  typedef std::map < int, UringConnection* > UringConnections;
+  typedef std::map < SessionID, int > SessionToHostNum;
+
+  void onConfigure( const SessionSettings& ) EXCEPT ( ConfigError );
+  void onInitialize( const SessionSettings& ) EXCEPT ( RuntimeError );
+
+  void onStart();
+  bool onPoll( double timeout );
+  void onStop();
+
+  void doConnect( const SessionID&, const Dictionary& d );
+  void onConnect( UringMonitor&, int );
+  void onData( UringMonitor&, int, const char*, size_t );
+  void onDisconnect( UringMonitor&, int );
+  void onWake( UringMonitor&, int );
+  void onError( UringMonitor& );
+  void onTimeout();
+  void close();
+
+  void getHost( const SessionID&, const Dictionary&, std::string&, short&, std::string&, short& );
+
+  UringMonitor* m_pMonitor;
+  SessionToHostNum m_sessionToHostNum;
+  UringConnections m_pendingConnections;
+  UringConnections m_connections;
+  TimerWheel m_timers;
+  time_t m_lastConnect;
+  int m_reconnectInterval;
+  bool m_noDelay;
+  int m_sendBufSize;
+  int m_rcvBufSize;
+};
+/*! @} */
+}
+
+#endif //FIX_URINGINITIATOR_H
+#endif //HAVE_IO_URING
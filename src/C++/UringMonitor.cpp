@@ -0,0 +1,737 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#if HAVE_IO_URING
+
+#include "UringMonitor.h"
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <algorithm>
+
+namespace FIX
+{
+// longest chain of linked sends submitted for one socket at a time
+static const unsigned MAX_SEND_CHAIN = 32;
+// provided buffer group used for every recv
+static const unsigned short BUFFER_GROUP = 0;
+
+static inline unsigned long long userData( int op, int socket )
+{
+  return ( ( unsigned long long ) op << 32 ) | ( unsigned ) socket;
+}
+
+static void* mapRing( int ring, size_t size, unsigned long long offset )
+{
+  void* result = mmap( 0, size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, ring, offset );
+  return result == MAP_FAILED ? 0 : result;
+}
+
+static unsigned roundUpPowerOfTwo( unsigned value )
+{
+  unsigned result = 1;
+  while( result < value ) result <<= 1;
+  return result;
+}
+
+UringMonitor::UringMonitor( unsigned entries, unsigned buffers,
+                            unsigned bufferSize, bool sqPoll )
+EXCEPT ( SocketException )
+: m_ring( -1 ), m_sqPoll( sqPoll ), m_entries( 0 ),
+  m_sqMap( 0 ), m_sqMapSize( 0 ), m_cqMap( 0 ), m_cqMapSize( 0 ),
+  m_sqes( 0 ), m_sqesSize( 0 ), m_sqLocalTail( 0 ),
+  m_bufferRing( 0 ), m_bufferData( 0 ),
+  m_bufferCount( roundUpPowerOfTwo( buffers ? buffers : 1 ) ),
+  m_bufferSize( bufferSize ), m_bufferTail( 0 ),
+  m_wakeFd( -1 ), m_wakeValue( 0 ), m_thread( 0 ),
+  m_enterCount( 0 ), m_completionCount( 0 )
+{
+  io_uring_params params;
+  memset( &params, 0, sizeof(params) );
+  params.flags = IORING_SETUP_CLAMP;
+  if( m_sqPoll )
+  {
+    params.flags |= IORING_SETUP_SQPOLL;
+    params.sq_thread_idle = 100;
+  }
+
+  m_ring = syscall( __NR_io_uring_setup, entries, &params );
+  if( m_ring < 0 )
+    throw SocketException();
+
+  if( !( params.features & IORING_FEAT_EXT_ARG ) )
+  {
+    ::close( m_ring );
+    throw SocketException( "io_uring does not support timed waits" );
+  }
+
+  m_entries = params.sq_entries;
+  m_sqMapSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  m_cqMapSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  if( params.features & IORING_FEAT_SINGLE_MMAP )
+  {
+    m_sqMapSize = m_cqMapSize = std::max( m_sqMapSize, m_cqMapSize );
+    m_sqMap = m_cqMap = mapRing( m_ring, m_sqMapSize, IORING_OFF_SQ_RING );
+  }
+  else
+  {
+    m_sqMap = mapRing( m_ring, m_sqMapSize, IORING_OFF_SQ_RING );
+    m_cqMap = mapRing( m_ring, m_cqMapSize, IORING_OFF_CQ_RING );
+  }
+  m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+  m_sqes = ( io_uring_sqe* ) mapRing( m_ring, m_sqesSize, IORING_OFF_SQES );
+
+  char* sq = ( char* ) m_sqMap;
+  char* cq = ( char* ) m_cqMap;
+  if( !sq || !cq || !m_sqes )
+  {
+    SocketException e;
+    destroy();
+    throw e;
+  }
+
+  m_sqHead = ( unsigned* ) ( sq + params.sq_off.head );
+  m_sqTail = ( unsigned* ) ( sq + params.sq_off.tail );
+  m_sqFlags = ( unsigned* ) ( sq + params.sq_off.flags );
+  m_sqArray = ( unsigned* ) ( sq + params.sq_off.array );
+  m_sqMask = *( unsigned* ) ( sq + params.sq_off.ring_mask );
+  m_sqLocalTail = *m_sqTail;
+
+  m_cqHead = ( unsigned* ) ( cq + params.cq_off.head );
+  m_cqTail = ( unsigned* ) ( cq + params.cq_off.tail );
+  m_cqMask = *( unsigned* ) ( cq + params.cq_off.ring_mask );
+  m_cqes = ( io_uring_cqe* ) ( cq + params.cq_off.cqes );
+
+  // the kernel picks recv buffers from this ring as data arrives
+  size_t ringSize = m_bufferCount * sizeof(io_uring_buf);
+  void* ring = mmap( 0, ringSize, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+  m_bufferRing = ring == MAP_FAILED ? 0 : ( io_uring_buf_ring* ) ring;
+  m_bufferData = new char[ m_bufferCount * m_bufferSize ];
+
+  io_uring_buf_reg reg;
+  memset( &reg, 0, sizeof(reg) );
+  reg.ring_addr = ( unsigned long ) m_bufferRing;
+  reg.ring_entries = m_bufferCount;
+  reg.bgid = BUFFER_GROUP;
+  if( !m_bufferRing
+      || syscall( __NR_io_uring_register, m_ring,
+                  IORING_REGISTER_PBUF_RING, &reg, 1 ) < 0 )
+  {
+    SocketException e( "io_uring does not support provided buffer rings" );
+    destroy();
+    throw e;
+  }
+
+  for( unsigned i = 0; i < m_bufferCount; ++i )
+    recycle( ( unsigned short ) i );
+
+  // blocking, so that the read below waits in the kernel for a wakeup
+  m_wakeFd = eventfd( 0, EFD_CLOEXEC );
+  if( m_wakeFd < 0 )
+  {
+    SocketException e;
+    destroy();
+    throw e;
+  }
+  armWake();
+}
+
+UringMonitor::~UringMonitor()
+{
+  destroy();
+}
+
+void UringMonitor::destroy()
+{
+  // closing the ring cancels everything still in flight
+  if( m_ring >= 0 )
+    ::close( m_ring );
+  m_ring = -1;
+
+  if( m_sqes )
+    munmap( m_sqes, m_sqesSize );
+  if( m_cqMap && m_cqMap != m_sqMap )
+    munmap( m_cqMap, m_cqMapSize );
+  if( m_sqMap )
+    munmap( m_sqMap, m_sqMapSize );
+  if( m_bufferRing )
+    munmap( m_bufferRing, m_bufferCount * sizeof(io_uring_buf) );
+  m_sqes = 0;
+  m_sqMap = m_cqMap = 0;
+  m_bufferRing = 0;
+
+  delete [] m_bufferData;
+  m_bufferData = 0;
+
+  if( m_wakeFd >= 0 )
+    ::close( m_wakeFd );
+  m_wakeFd = -1;
+
+  Sockets::iterator i;
+  for( i = m_sockets.begin(); i != m_sockets.end(); ++i )
+    socket_close( i->first );
+  m_sockets.clear();
+}
+
+bool UringMonitor::addAccept( int socket )
+{
+  if( m_sockets.find( socket ) != m_sockets.end() )
+    return false;
+
+  Socket& s = m_sockets[ socket ];
+  s.m_listening = true;
+  armAccept( socket, s );
+  return s.m_outstanding != 0;
+}
+
+bool UringMonitor::addConnect( int socket, const sockaddr_in& address )
+{
+  if( m_sockets.find( socket ) != m_sockets.end() )
+    return false;
+
+  io_uring_sqe* sqe = getSqe();
+  if( !sqe ) return false;
+
+  Socket& s = m_sockets[ socket ];
+  s.m_connecting = true;
+  s.m_address = address;
+  prepare( sqe, CONNECT, socket );
+  sqe->opcode = IORING_OP_CONNECT;
+  sqe->addr = ( unsigned long ) &s.m_address;
+  sqe->off = sizeof(s.m_address);
+  ++s.m_outstanding;
+  return true;
+}
+
+bool UringMonitor::addRead( int socket )
+{
+  Socket& s = m_sockets[ socket ];
+  if( s.m_reading || s.m_dropped )
+    return false;
+  armRecv( socket, s );
+  return s.m_reading;
+}
+
+bool UringMonitor::send( int socket, const std::string& data )
+{
+  if( thread_self() != m_thread )
+  {
+    Locker l( m_mutex );
+    bool wake = m_outbox.empty() && m_dropRequests.empty()
+      && m_wakeRequests.empty();
+    m_outbox.push_back( std::make_pair( socket, data ) );
+    if( wake ) wakeup();
+    return true;
+  }
+
+  Sockets::iterator i = m_sockets.find( socket );
+  if( i == m_sockets.end() || i->second.m_dropped )
+    return false;
+
+  Socket& s = i->second;
+  s.m_queue.push_back( data );
+  if( !s.m_dirty )
+  {
+    s.m_dirty = true;
+    m_dirty.push_back( socket );
+  }
+  return true;
+}
+
+bool UringMonitor::drop( int socket )
+{
+  if( thread_self() != m_thread )
+  {
+    Locker l( m_mutex );
+    bool wake = m_outbox.empty() && m_dropRequests.empty()
+      && m_wakeRequests.empty();
+    m_dropRequests.push_back( socket );
+    if( wake ) wakeup();
+    return true;
+  }
+
+  Sockets::iterator i = m_sockets.find( socket );
+  if( i == m_sockets.end() || i->second.m_dropped )
+    return false;
+
+  Socket& s = i->second;
+  s.m_dropped = true;
+  m_dropped.push_back( socket );
+
+  // what was sent just before disconnecting, like a logout, goes out first
+  if( !s.m_sending )
+    flush( socket, s );
+  if( !s.m_sending )
+    terminate( socket, s );
+  return true;
+}
+
+void UringMonitor::wake( int socket )
+{
+  Locker l( m_mutex );
+  bool wake = m_outbox.empty() && m_dropRequests.empty()
+    && m_wakeRequests.empty();
+  m_wakeRequests.push_back( socket );
+  if( wake && thread_self() != m_thread ) wakeup();
+}
+
+void UringMonitor::block( Strategy& strategy, bool poll, double timeout )
+{
+  m_thread = thread_self();
+
+  drainOutbox();
+  flushAll();
+  processDropped( strategy );
+  processWakes( strategy );
+
+  bool ready = __atomic_load_n( m_cqTail, __ATOMIC_ACQUIRE ) != *m_cqHead;
+  int result = enter( poll || ready ? 0 : 1, timeout > 0 ? timeout : 1.0 );
+  if( result < 0 && errno != ETIME && errno != EINTR && errno != EBUSY )
+    strategy.onError( *this );
+
+  processCompletions( strategy );
+
+  drainOutbox();
+  flushAll();
+  processDropped( strategy );
+  processWakes( strategy );
+
+  // with SQPOLL the kernel thread takes new sends without a syscall
+  if( m_sqPoll )
+    enter( 0, 0 );
+}
+
+io_uring_sqe* UringMonitor::getSqe()
+{
+  unsigned head = __atomic_load_n( m_sqHead, __ATOMIC_ACQUIRE );
+  if( m_sqLocalTail - head >= m_entries )
+  {
+    enter( 0, 0 );
+    head = __atomic_load_n( m_sqHead, __ATOMIC_ACQUIRE );
+    if( m_sqLocalTail - head >= m_entries )
+      return 0;
+  }
+
+  unsigned index = m_sqLocalTail & m_sqMask;
+  io_uring_sqe* sqe = &m_sqes[ index ];
+  m_sqArray[ index ] = index;
+  ++m_sqLocalTail;
+  memset( sqe, 0, sizeof(*sqe) );
+  return sqe;
+}
+
+void UringMonitor::prepare( io_uring_sqe* sqe, int op, int socket )
+{
+  sqe->fd = socket;
+  sqe->user_data = userData( op, socket );
+}
+
+void UringMonitor::terminate( int socket, Socket& s )
+{
+  s.m_shutdown = true;
+  s.m_queue.clear();
+  s.m_inflight.clear();
+  s.m_offset = 0;
+  shutdown( socket, SHUT_RDWR );
+
+  // the socket is closed only after every operation on it completes, so
+  // its descriptor cannot be reused while the kernel still refers to it
+  if( s.m_outstanding )
+  {
+    io_uring_sqe* sqe = getSqe();
+    if( sqe )
+    {
+      prepare( sqe, CANCEL, socket );
+      sqe->opcode = IORING_OP_ASYNC_CANCEL;
+      sqe->cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+      ++s.m_outstanding;
+    }
+  }
+}
+
+void UringMonitor::armAccept( int socket, Socket& s )
+{
+  io_uring_sqe* sqe = getSqe();
+  if( !sqe ) return;
+
+  prepare( sqe, ACCEPT, socket );
+  sqe->opcode = IORING_OP_ACCEPT;
+  sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+  sqe->accept_flags = SOCK_CLOEXEC;
+  ++s.m_outstanding;
+}
+
+void UringMonitor::armRecv( int socket, Socket& s )
+{
+  io_uring_sqe* sqe = getSqe();
+  if( !sqe )
+  {
+    drop( socket );
+    return;
+  }
+
+  prepare( sqe, RECV, socket );
+  sqe->opcode = IORING_OP_RECV;
+  sqe->ioprio = IORING_RECV_MULTISHOT;
+  sqe->flags = IOSQE_BUFFER_SELECT;
+  sqe->buf_group = BUFFER_GROUP;
+  s.m_reading = true;
+  ++s.m_outstanding;
+}
+
+void UringMonitor::armWake()
+{
+  io_uring_sqe* sqe = getSqe();
+  if( !sqe ) return;
+
+  prepare( sqe, WAKE, m_wakeFd );
+  sqe->opcode = IORING_OP_READ;
+  sqe->addr = ( unsigned long ) &m_wakeValue;
+  sqe->len = sizeof(m_wakeValue);
+}
+
+void UringMonitor::wakeup()
+{
+  unsigned long long value = 1;
+  ssize_t result = ::write( m_wakeFd, &value, sizeof(value) );
+  ( void ) result;
+}
+
+void UringMonitor::flush( int socket, Socket& s )
+{
+  if( s.m_sending || s.m_shutdown )
+    return;
+
+  while( !s.m_queue.empty() )
+  {
+    s.m_inflight.push_back( std::string() );
+    s.m_inflight.back().swap( s.m_queue.front() );
+    s.m_queue.pop_front();
+  }
+
+  unsigned count = std::min( ( unsigned ) s.m_inflight.size(), MAX_SEND_CHAIN );
+  if( !count )
+    return;
+
+  // a chain must go to the kernel in one submission, so make room first
+  unsigned head = __atomic_load_n( m_sqHead, __ATOMIC_ACQUIRE );
+  if( m_entries - ( m_sqLocalTail - head ) < count )
+  {
+    enter( 0, 0 );
+    head = __atomic_load_n( m_sqHead, __ATOMIC_ACQUIRE );
+    count = std::min( count, m_entries - ( m_sqLocalTail - head ) );
+  }
+
+  Queue::iterator i = s.m_inflight.begin();
+  for( unsigned n = 0; n < count; ++n, ++i )
+  {
+    size_t offset = n ? 0 : s.m_offset;
+    io_uring_sqe* sqe = getSqe();
+    prepare( sqe, SEND, socket );
+    sqe->opcode = IORING_OP_SEND;
+    sqe->addr = ( unsigned long ) ( i->data() + offset );
+    sqe->len = ( unsigned ) ( i->size() - offset );
+    sqe->msg_flags = MSG_NOSIGNAL | MSG_WAITALL;
+    if( n + 1 < count )
+      sqe->flags = IOSQE_IO_LINK;
+    ++s.m_sending;
+    ++s.m_outstanding;
+  }
+}
+
+void UringMonitor::flushAll()
+{
+  SocketList dirty;
+  dirty.swap( m_dirty );
+
+  SocketList::iterator i;
+  for( i = dirty.begin(); i != dirty.end(); ++i )
+  {
+    Sockets::iterator j = m_sockets.find( *i );
+    if( j == m_sockets.end() ) continue;
+    j->second.m_dirty = false;
+    flush( *i, j->second );
+  }
+}
+
+void UringMonitor::drainOutbox()
+{
+  Outbox outbox;
+  SocketList drops;
+  {
+    Locker l( m_mutex );
+    outbox.swap( m_outbox );
+    drops.swap( m_dropRequests );
+  }
+
+  Outbox::iterator i;
+  for( i = outbox.begin(); i != outbox.end(); ++i )
+    send( i->first, i->second );
+
+  SocketList::iterator j;
+  for( j = drops.begin(); j != drops.end(); ++j )
+    drop( *j );
+}
+
+int UringMonitor::enter( unsigned wait, double timeout )
+{
+  __atomic_store_n( m_sqTail, m_sqLocalTail, __ATOMIC_RELEASE );
+
+  unsigned submit = m_sqLocalTail - __atomic_load_n( m_sqHead, __ATOMIC_ACQUIRE );
+  unsigned flags = 0;
+  if( m_sqPoll )
+  {
+    if( __atomic_load_n( m_sqFlags, __ATOMIC_ACQUIRE ) & IORING_SQ_NEED_WAKEUP )
+      flags |= IORING_ENTER_SQ_WAKEUP;
+    submit = 0;
+  }
+
+  if( !submit && !wait && !flags )
+    return 0;
+
+  io_uring_getevents_arg arg;
+  __kernel_timespec ts;
+  memset( &arg, 0, sizeof(arg) );
+  if( wait )
+  {
+    ts.tv_sec = ( long long ) timeout;
+    ts.tv_nsec = ( long long ) ( ( timeout - ts.tv_sec ) * 1000000000 );
+    arg.ts = ( unsigned long long ) &ts;
+    flags |= IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+  }
+
+  ++m_enterCount;
+  return syscall( __NR_io_uring_enter, m_ring, submit, wait, flags,
+                  wait ? &arg : 0, wait ? sizeof(arg) : 0 );
+}
+
+unsigned UringMonitor::processCompletions( Strategy& strategy )
+{
+  unsigned count = 0;
+  unsigned head = *m_cqHead;
+  unsigned tail = __atomic_load_n( m_cqTail, __ATOMIC_ACQUIRE );
+
+  while( head != tail )
+  {
+    io_uring_cqe cqe = m_cqes[ head & m_cqMask ];
+    __atomic_store_n( m_cqHead, ++head, __ATOMIC_RELEASE );
+    process( strategy, cqe );
+    ++count;
+
+    if( head == tail )
+      tail = __atomic_load_n( m_cqTail, __ATOMIC_ACQUIRE );
+  }
+
+  m_completionCount += count;
+  return count;
+}
+
+void UringMonitor::process( Strategy& strategy, const io_uring_cqe& cqe )
+{
+  int op = ( int ) ( cqe.user_data >> 32 );
+  int socket = ( int ) ( cqe.user_data & 0xffffffff );
+  bool more = ( cqe.flags & IORING_CQE_F_MORE ) != 0;
+
+  if( op == WAKE )
+  {
+    armWake();
+    return;
+  }
+
+  Sockets::iterator i = m_sockets.find( socket );
+  if( i == m_sockets.end() )
+  {
+    if( cqe.flags & IORING_CQE_F_BUFFER )
+      recycle( ( unsigned short ) ( cqe.flags >> IORING_CQE_BUFFER_SHIFT ) );
+    return;
+  }
+  Socket& s = i->second;
+
+  switch( op )
+  {
+  case ACCEPT:
+    if( !more ) --s.m_outstanding;
+    if( cqe.res >= 0 )
+    {
+      if( s.m_dropped || m_sockets.find( cqe.res ) != m_sockets.end() )
+        socket_close( cqe.res );
+      else
+      {
+        armRecv( cqe.res, m_sockets[ cqe.res ] );
+        strategy.onAccept( *this, socket, cqe.res );
+      }
+    }
+    if( !more && !s.m_dropped )
+      armAccept( socket, s );
+    break;
+
+  case CONNECT:
+    --s.m_outstanding;
+    s.m_connecting = false;
+    if( s.m_dropped )
+      break;
+    if( cqe.res < 0 )
+      drop( socket );
+    else
+    {
+      armRecv( socket, s );
+      strategy.onConnect( *this, socket );
+    }
+    break;
+
+  case RECV:
+    if( !more )
+    {
+      --s.m_outstanding;
+      s.m_reading = false;
+    }
+    if( cqe.res > 0 )
+    {
+      unsigned short buffer =
+        ( unsigned short ) ( cqe.flags >> IORING_CQE_BUFFER_SHIFT );
+      if( !s.m_dropped )
+        strategy.onData( *this, socket, m_bufferData + buffer * m_bufferSize, cqe.res );
+      recycle( buffer );
+    }
+    else if( cqe.res != -ENOBUFS )
+      drop( socket );
+    if( !s.m_reading && !s.m_dropped )
+      armRecv( socket, s );
+    break;
+
+  case SEND:
+    --s.m_outstanding;
+    --s.m_sending;
+    if( s.m_shutdown )
+      break;
+    if( cqe.res >= 0 )
+    {
+      s.m_offset += cqe.res;
+      if( s.m_offset == s.m_inflight.front().size() )
+      {
+        s.m_offset = 0;
+        s.m_inflight.pop_front();
+      }
+    }
+    else if( cqe.res != -ECANCELED )
+    {
+      if( s.m_dropped )
+        terminate( socket, s );
+      else
+      {
+        s.m_queue.clear();
+        s.m_inflight.clear();
+        drop( socket );
+      }
+      break;
+    }
+    if( s.m_sending )
+      break;
+    // once the chain has drained, send what is left or queued since
+    if( s.m_inflight.size() || s.m_queue.size() )
+    {
+      if( !s.m_dirty )
+      {
+        s.m_dirty = true;
+        m_dirty.push_back( socket );
+      }
+    }
+    else if( s.m_dropped )
+      terminate( socket, s );
+    break;
+
+  case CANCEL:
+    --s.m_outstanding;
+    break;
+  }
+
+  if( s.m_dropped && s.m_notified && !s.m_outstanding )
+    release( socket, s );
+}
+
+void UringMonitor::recycle( unsigned short buffer )
+{
+  // bufs[] is not used as C++ gives the empty struct in front of it a size
+  io_uring_buf* buf = ( io_uring_buf* ) m_bufferRing
+                      + ( m_bufferTail & ( m_bufferCount - 1 ) );
+  buf->addr = ( unsigned long ) ( m_bufferData + buffer * m_bufferSize );
+  buf->len = m_bufferSize;
+  buf->bid = buffer;
+  __atomic_store_n( &m_bufferRing->tail, ++m_bufferTail, __ATOMIC_RELEASE );
+}
+
+void UringMonitor::release( int socket, Socket& )
+{
+  socket_close( socket );
+  m_sockets.erase( socket );
+}
+
+void UringMonitor::processDropped( Strategy& strategy )
+{
+  while( m_dropped.size() )
+  {
+    SocketList dropped;
+    dropped.swap( m_dropped );
+
+    SocketList::iterator i;
+    for( i = dropped.begin(); i != dropped.end(); ++i )
+    {
+      Sockets::iterator j = m_sockets.find( *i );
+      if( j == m_sockets.end() ) continue;
+      j->second.m_notified = true;
+      strategy.onDisconnect( *this, *i );
+
+      j = m_sockets.find( *i );
+      if( j != m_sockets.end() && !j->second.m_outstanding )
+        release( *i, j->second );
+    }
+  }
+}
+
+void UringMonitor::processWakes( Strategy& strategy )
+{
+  SocketList wakes;
+  {
+    Locker l( m_mutex );
+    wakes.swap( m_wakeRequests );
+  }
+
+  SocketList::iterator i;
+  for( i = wakes.begin(); i != wakes.end(); ++i )
+  {
+    Sockets::iterator j = m_sockets.find( *i );
+    if( j == m_sockets.end() || j->second.m_dropped ) continue;
+    strategy.onWake( *this, *i );
+  }
+}
+}
+
+#endif //HAVE_IO_URING
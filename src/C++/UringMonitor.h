@@ -0,0 +1,198 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef HAVE_IO_URING
+#error UringMonitor.h included, but HAVE_IO_URING not defined
+#endif
+
+#ifdef HAVE_IO_URING
+#ifndef FIX_URINGMONITOR_H
+#define FIX_URINGMONITOR_H
+
+#include "Exceptions.h"
+#include "Mutex.h"
+#include "Utility.h"
+#include <netinet/in.h>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct io_uring_buf_ring;
+
+namespace FIX
+{
+/**
+ * Drives a set of sockets from a single io_uring.
+ *
+ * Each connected socket has one multishot recv outstanding that reads
+ * into a ring of provided buffers, so a busy socket costs no syscalls to
+ * keep reading.  Outgoing messages are queued and submitted as a chain of
+ * linked sends, and everything queued between two waits goes to the
+ * kernel with the same io_uring_enter call.  With SQPOLL a kernel thread
+ * picks up submissions and the only remaining syscall is the wait.
+ */
+class UringMonitor
+{
+public:
+  class Strategy;
+
+  UringMonitor( unsigned entries = 1024, unsigned buffers = 1024,
+                unsigned bufferSize = 4096, bool sqPoll = false )
+  EXCEPT ( SocketException );
+  virtual ~UringMonitor();
+
+  /// Accept connections on a listening socket
+  bool addAccept( int socket );
+  /// Start a non-blocking connect, reported through Strategy::onConnect
+  bool addConnect( int socket, const sockaddr_in& address );
+  /// Start reading from a connected socket
+  bool addRead( int socket );
+  /// Queue data to be sent, may be called from any thread
+  bool send( int socket, const std::string& data );
+  /// Close a socket once queued data is sent and the kernel is done with it
+  bool drop( int socket );
+  /// Report a socket through Strategy::onWake, may be called from any thread
+  void wake( int socket );
+  void block( Strategy& strategy, bool poll = false, double timeout = 0.0 );
+
+  size_t numSockets() const { return m_sockets.size(); }
+
+  /// Number of io_uring_enter calls made, for measuring
+  unsigned long getEnterCount() const { return m_enterCount; }
+  /// Number of completions processed, for measuring
+  unsigned long getCompletionCount() const { return m_completionCount; }
+
+private:
+  enum Operation
+  { ACCEPT = 1, CONNECT, RECV, SEND, CANCEL, WAKE };
+
+  typedef std::deque<std::string, ALLOCATOR<std::string> > Queue;
+
+  struct Socket
+  {
+    Socket()
+    : m_listening( false ), m_connecting( false ), m_reading( false ),
+      m_dirty( false ), m_dropped( false ), m_shutdown( false ),
+      m_notified( false ),
+      m_sending( 0 ), m_outstanding( 0 ), m_offset( 0 ) {}
+
+    bool m_listening;
+    bool m_connecting;
+    bool m_reading;
+    bool m_dirty;
+    bool m_dropped;
+    bool m_shutdown;
+    bool m_notified;
+    unsigned m_sending;
+    unsigned m_outstanding;
+    size_t m_offset;
+    sockaddr_in m_address;
+    Queue m_queue;
+    Queue m_inflight;
+  };
+
+  typedef std::map<int, Socket> Sockets;
+  typedef std::vector<int> SocketList;
+  typedef std::vector<std::pair<int, std::string> > Outbox;
+
+  void destroy();
+  io_uring_sqe* getSqe();
+  void prepare( io_uring_sqe*, int op, int socket );
+  void terminate( int socket, Socket& );
+  void armAccept( int socket, Socket& );
+  void armRecv( int socket, Socket& );
+  void armWake();
+  void flush( int socket, Socket& );
+  void flushAll();
+  void drainOutbox();
+  int enter( unsigned wait, double timeout );
+  unsigned processCompletions( Strategy& );
+  void process( Strategy&, const io_uring_cqe& );
+  void recycle( unsigned short buffer );
+  void release( int socket, Socket& );
+  void processDropped( Strategy& );
+  void processWakes( Strategy& );
+  void wakeup();
+
+  int m_ring;
+  bool m_sqPoll;
+  unsigned m_entries;
+
+  void* m_sqMap;
+  size_t m_sqMapSize;
+  void* m_cqMap;
+  size_t m_cqMapSize;
+  io_uring_sqe* m_sqes;
+  size_t m_sqesSize;
+
+  unsigned* m_sqHead;
+  unsigned* m_sqTail;
+  unsigned* m_sqFlags;
+  unsigned* m_sqArray;
+  unsigned m_sqMask;
+  unsigned m_sqLocalTail;
+
+  unsigned* m_cqHead;
+  unsigned* m_cqTail;
+  unsigned m_cqMask;
+  io_uring_cqe* m_cqes;
+
+  io_uring_buf_ring* m_bufferRing;
+  char* m_bufferData;
+  unsigned m_bufferCount;
+  unsigned m_bufferSize;
+  unsigned short m_bufferTail;
+
+  int m_wakeFd;
+  unsigned long long m_wakeValue;
+  thread_id m_thread;
+
+  Sockets m_sockets;
+  SocketList m_dirty;
+  SocketList m_dropped;
+  SocketList m_dropRequests;
+  SocketList m_wakeRequests;
+  Outbox m_outbox;
+  Mutex m_mutex;
+
+  unsigned long m_enterCount;
+  unsigned long m_completionCount;
+
+public:
+  class Strategy
+  {
+  public:
+    virtual ~Strategy() {}
+    virtual void onAccept( UringMonitor&, int acceptSocket, int socket ) {}
+    virtual void onConnect( UringMonitor&, int socket ) {}
+    virtual void onData( UringMonitor&, int socket, const char* data, size_t size ) = 0;
+    virtual void onDisconnect( UringMonitor&, int socket ) = 0;
+    virtual void onWake( UringMonitor&, int socket ) {}
+    virtual void onError( UringMonitor& ) = 0;
+  };
+};
+}
+
+#endif //FIX_URINGMONITOR_H
+#endif //HAVE_IO_URING
@@ -30,6 +30,8 @@
 #include <sys/conf.h>
 #endif
 #include <string.h>
+#include <stdlib.h>
+#include <errno.h>
 #include <math.h>
 #include <stdio.h>
 #include <algorithm>
@@ -177,6 +179,32 @@ ssize_t socket_send( int s, const char* msg, size_t length )
   return send( s, msg, length, 0 );
 }
 
+ssize_t socket_sendv( int s, const std::string* const* buffers, size_t count )
+{
+  enum { MAX_BUFFERS = 16 };
+  if( count > MAX_BUFFERS ) count = MAX_BUFFERS;
+#ifdef _MSC_VER
+  WSABUF vector[ MAX_BUFFERS ];
+  for( size_t i = 0; i < count; ++i )
+  {
+    vector[ i ].buf = const_cast < char* > ( buffers[ i ]->data() );
+    vector[ i ].len = ( ULONG ) buffers[ i ]->size();
+  }
+  DWORD sent = 0;
+  if( WSASend( s, vector, ( DWORD ) count, &sent, 0, 0, 0 ) != 0 )
+    return -1;
+  return sent;
+#else
+  struct iovec vector[ MAX_BUFFERS ];
+  for( size_t i = 0; i < count; ++i )
+  {
+    vector[ i ].iov_base = const_cast < char* > ( buffers[ i ]->data() );
+    vector[ i ].iov_len = buffers[ i ]->size();
+  }
+  return writev( s, vector, ( int ) count );
+#endif
+}
+
 void socket_close( int s )
 {
   shutdown( s, 2 );
@@ -463,6 +491,83 @@ thread_id thread_self()
 #endif
 }
 
+/// Processors thread_setaffinity() is able to pin a thread to
+#ifdef _MSC_VER
+#define MAX_AFFINITY_CPUS ( sizeof(DWORD_PTR) * 8 )
+#elif defined(__linux__)
+#define MAX_AFFINITY_CPUS CPU_SETSIZE
+#else
+#define MAX_AFFINITY_CPUS 1024
+#endif
+
+static bool thread_parsecpu( const std::string& value, int& cpu )
+{
+  if( value.empty() || value.find_first_not_of( "0123456789" ) != std::string::npos )
+    return false;
+
+  errno = 0;
+  char* end = 0;
+  long result = strtol( value.c_str(), &end, 10 );
+  if( errno == ERANGE || *end || result >= ( long ) MAX_AFFINITY_CPUS )
+    return false;
+  cpu = ( int ) result;
+  return true;
+}
+
+bool thread_parseaffinity( const std::string& value, std::set<int>& cpus )
+{
+  // a list of processors and ranges of processors, like 0,2-3
+  std::string::size_type pos = 0;
+  while( pos <= value.size() )
+  {
+    std::string::size_type end = value.find( ',', pos );
+    if( end == std::string::npos ) end = value.size();
+    std::string item = string_strip( value.substr( pos, end - pos ) );
+    pos = end + 1;
+
+    std::string::size_type dash = item.find( '-' );
+    std::string first = item.substr( 0, dash );
+    std::string last = dash == std::string::npos ? first : item.substr( dash + 1 );
+
+    int from = 0;
+    int to = 0;
+    if( !thread_parsecpu( first, from ) || !thread_parsecpu( last, to ) )
+      return false;
+    if( from > to ) return false;
+    for( int cpu = from; cpu <= to; ++cpu )
+      cpus.insert( cpu );
+  }
+  return !cpus.empty();
+}
+
+bool thread_setaffinity( const std::set<int>& cpus )
+{
+  if( cpus.empty() ) return true;
+
+#ifdef _MSC_VER
+  DWORD_PTR mask = 0;
+  std::set<int>::const_iterator i;
+  for( i = cpus.begin(); i != cpus.end(); ++i )
+  {
+    if( *i >= ( int ) ( sizeof(mask) * 8 ) ) return false;
+    mask |= ( DWORD_PTR ) 1 << *i;
+  }
+  return SetThreadAffinityMask( GetCurrentThread(), mask ) != 0;
+#elif defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO( &set );
+  std::set<int>::const_iterator i;
+  for( i = cpus.begin(); i != cpus.end(); ++i )
+  {
+    if( *i >= CPU_SETSIZE ) return false;
+    CPU_SET( *i, &set );
+  }
+  return pthread_setaffinity_np( pthread_self(), sizeof(set), &set ) == 0;
+#else
+  return false;
+#endif
+}
+
 void process_sleep( double s )
 {
 #ifdef _MSC_VER
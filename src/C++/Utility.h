@@ -75,6 +75,7 @@ typedef int ssize_t;
 /////////////////////////////////////////////
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/ioctl.h>
 #if defined(__SUNPRO_CC)
 #include <sys/filio.h>
@@ -102,6 +103,7 @@ typedef int ssize_t;
 #include <cstdio>
 #include <cstdlib>
 #include <memory>
+#include <set>
 
 #if !defined(HAVE_STD_UNIQUE_PTR)
 #define SmartPtr std::auto_ptr
@@ -149,6 +151,7 @@ int socket_connect( int s, const char* address, int port );
 int socket_accept( int s );
 ssize_t socket_recv( int s, char* buf, size_t length );
 ssize_t socket_send( int s, const char* msg, size_t length );
+ssize_t socket_sendv( int s, const std::string* const* buffers, size_t count );
 void socket_close( int s );
 bool socket_fionread( int s, int& bytes );
 bool socket_disconnected( int s );
@@ -186,6 +189,12 @@ extern "C" { typedef void * (THREAD_START_ROUTINE)(void *); }
 #define THREAD_PROC void *
 #endif
 
+#ifdef _MSC_VER
+#define THREAD_LOCAL __declspec( thread )
+#else
+#define THREAD_LOCAL __thread
+#endif
+
 #ifdef _MSC_VER
 typedef unsigned thread_id;
 #else
@@ -197,6 +206,8 @@ bool thread_spawn( THREAD_START_ROUTINE func, void* var );
 void thread_join( thread_id thread );
 void thread_detach( thread_id thread );
 thread_id thread_self();
+bool thread_parseaffinity( const std::string& value, std::set<int>& cpus );
+bool thread_setaffinity( const std::set<int>& cpus );
 
 void process_sleep( double s );
 
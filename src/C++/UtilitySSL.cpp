@@ -1202,9 +1202,25 @@ SSL_CTX *createSSLContext(bool server, const SessionSettings &settings,
   setCtxOptions(ctx, options);
 
   SSL_CTX_set_options(ctx, SSL_OP_SINGLE_DH_USE);
-  if (server)
+  bool resumption = true;
+  if (settings.get().has(SSL_SESSION_RESUMPTION))
+    resumption = settings.get().getBool(SSL_SESSION_RESUMPTION);
+
+  if (server && resumption)
   {
     SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+    /* sessions of verified clients are only resumed within this context */
+    static const unsigned char sessionIdContext[] = "QuickFIX";
+    SSL_CTX_set_session_id_context(ctx, sessionIdContext,
+                                   sizeof(sessionIdContext) - 1);
+  }
+  else if (server)
+  {
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+    SSL_CTX_set_options(ctx, SSL_OP_NO_TICKET);
+#if (OPENSSL_VERSION_NUMBER >= 0x10101000L)
+    SSL_CTX_set_num_tickets(ctx, 0);
+#endif
   }
 
   SSL_CTX_set_mode(ctx, SSL_MODE_ENABLE_PARTIAL_WRITE |
@@ -1523,7 +1539,6 @@ int acceptSSLConnection(int socket, SSL *ssl, Log *log, int verify)
 {
   int rc;
   int result = -1;
-  char *subjName = 0;
   time_t timeout = time(0) + 10;
 #ifdef __TOS_AIX__
   int retries = 0;
@@ -1692,34 +1707,46 @@ int acceptSSLConnection(int socket, SSL *ssl, Log *log, int verify)
       process_sleep(0.01);
     }
 
-    X509 *xs = 0;
-
-    /*
-     * Check for failed client authentication
-     */
-    if ((result = SSL_get_verify_result(ssl)) != X509_V_OK)
-    {
-      if (log)
-        log->onEvent("SSL client authentication failed: ");
-      SSL_set_shutdown(ssl, SSL_RECEIVED_SHUTDOWN);
-      ssl_socket_close(socket, ssl);
-      return result;
-    }
-    else
-    {
-      if ((xs = SSL_get_peer_certificate(ssl)) != 0)
-      {
-        subjName = X509_NAME_oneline(X509_get_subject_name(xs), 0, 0);
-      }
-    }
   }
 
-  if ((verify == SSL_CLIENT_VERIFY_REQUIRE) && subjName == 0)
+  std::string errStr;
+  if ((result = verifySSLPeer(ssl, verify, errStr)) != 0)
   {
     if (log)
-      log->onEvent("No acceptable peer certificate available");
+      log->onEvent(errStr);
     SSL_set_shutdown(ssl, SSL_RECEIVED_SHUTDOWN);
     ssl_socket_close(socket, ssl);
+  }
+
+  return result;
+}
+
+int verifySSLPeer(SSL *ssl, int verify, std::string &errStr)
+{
+  errStr.erase();
+
+  int result = 0;
+  char *subjName = 0;
+  X509 *xs = 0;
+
+  /*
+   * Check for failed client authentication
+   */
+  if ((result = SSL_get_verify_result(ssl)) != X509_V_OK)
+  {
+    errStr.assign("SSL client authentication failed: ");
+    return result;
+  }
+
+  if ((xs = SSL_get_peer_certificate(ssl)) != 0)
+  {
+    subjName = X509_NAME_oneline(X509_get_subject_name(xs), 0, 0);
+    X509_free(xs);
+  }
+
+  if ((verify == SSL_CLIENT_VERIFY_REQUIRE) && subjName == 0)
+  {
+    errStr.assign("No acceptable peer certificate available");
     result = 2;
   }
 
@@ -270,6 +270,9 @@ X509_STORE *loadCRLInfo(SSL_CTX *ctx, const SessionSettings &settings, Log *log,
                         std::string &errStr);
 
 int acceptSSLConnection(int socket, SSL * ssl, Log * log, int verify);
+
+/* checks the peer of a finished server handshake, returns 0 when accepted */
+int verifySSLPeer(SSL *ssl, int verify, std::string &errStr);
 }
 
 #endif
@@ -45,6 +45,82 @@ namespace FIX40
     FIELD_SET(*this, FIX::Currency);
     FIELD_SET(*this, FIX::TransactTime);
     FIELD_SET(*this, FIX::Text);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView advId() const
+      { return getString( FIX::FIELD::AdvId ); }
+      FIX::StringView advTransType() const
+      { return getString( FIX::FIELD::AdvTransType ); }
+      FIX::StringView advRefID() const
+      { return getString( FIX::FIELD::AdvRefID ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      FIX::AdvSide advSide() const
+      { return FIX::AdvSide( getChar( FIX::FIELD::AdvSide ) ); }
+      FIX::Decimal shares() const
+      { return getDecimal( FIX::FIELD::Shares ); }
+      FIX::Decimal price() const
+      { return getDecimal( FIX::FIELD::Price ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "7" ) {}
+      void setAdvId( const FIX::StringView& value )
+      { setString( FIX::FIELD::AdvId, value ); }
+      void setAdvTransType( const FIX::StringView& value )
+      { setString( FIX::FIELD::AdvTransType, value ); }
+      void setAdvRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AdvRefID, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setAdvSide( char value )
+      { setChar( FIX::FIELD::AdvSide, value ); }
+      void setShares( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Shares, value ); }
+      void setPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Price, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+    };
   };
 
 }
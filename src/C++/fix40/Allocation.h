@@ -66,7 +66,18 @@ namespace FIX40
       FIELD_SET(*this, FIX::OrderID);
       FIELD_SET(*this, FIX::ListID);
       FIELD_SET(*this, FIX::WaveNo);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::OrderID);
+        FIELD_VIEW(*m_pMap, FIX::ListID);
+        FIELD_VIEW(*m_pMap, FIX::WaveNo);
+      };
     };
+    FIX::GroupView<NoOrders::View> noOrders() const
+    { return FIX::GroupView<NoOrders::View>( *this, FIX::FIELD::NoOrders ); }
     FIELD_SET(*this, FIX::NoExecs);
     class NoExecs: public FIX::Group
     {
@@ -76,7 +87,18 @@ namespace FIX40
       FIELD_SET(*this, FIX::LastShares);
       FIELD_SET(*this, FIX::LastPx);
       FIELD_SET(*this, FIX::LastMkt);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ExecID);
+        FIELD_VIEW(*m_pMap, FIX::LastShares);
+        FIELD_VIEW(*m_pMap, FIX::LastPx);
+        FIELD_VIEW(*m_pMap, FIX::LastMkt);
+      };
     };
+    FIX::GroupView<NoExecs::View> noExecs() const
+    { return FIX::GroupView<NoExecs::View>( *this, FIX::FIELD::NoExecs ); }
     FIELD_SET(*this, FIX::NoMiscFees);
     class NoMiscFees: public FIX::Group
     {
@@ -85,7 +107,17 @@ namespace FIX40
       FIELD_SET(*this, FIX::MiscFeeAmt);
       FIELD_SET(*this, FIX::MiscFeeCurr);
       FIELD_SET(*this, FIX::MiscFeeType);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::MiscFeeAmt);
+        FIELD_VIEW(*m_pMap, FIX::MiscFeeCurr);
+        FIELD_VIEW(*m_pMap, FIX::MiscFeeType);
+      };
     };
+    FIX::GroupView<NoMiscFees::View> noMiscFees() const
+    { return FIX::GroupView<NoMiscFees::View>( *this, FIX::FIELD::NoMiscFees ); }
     FIELD_SET(*this, FIX::NoAllocs);
     class NoAllocs: public FIX::Group
     {
@@ -101,6 +133,147 @@ namespace FIX40
       FIELD_SET(*this, FIX::NoDlvyInst);
       FIELD_SET(*this, FIX::BrokerOfCredit);
       FIELD_SET(*this, FIX::DlvyInst);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::AllocAccount);
+        FIELD_VIEW(*m_pMap, FIX::AllocShares);
+        FIELD_VIEW(*m_pMap, FIX::ProcessCode);
+        FIELD_VIEW(*m_pMap, FIX::ExecBroker);
+        FIELD_VIEW(*m_pMap, FIX::ClientID);
+        FIELD_VIEW(*m_pMap, FIX::Commission);
+        FIELD_VIEW(*m_pMap, FIX::CommType);
+        FIELD_VIEW(*m_pMap, FIX::NoDlvyInst);
+        FIELD_VIEW(*m_pMap, FIX::BrokerOfCredit);
+        FIELD_VIEW(*m_pMap, FIX::DlvyInst);
+      };
+    };
+    FIX::GroupView<NoAllocs::View> noAllocs() const
+    { return FIX::GroupView<NoAllocs::View>( *this, FIX::FIELD::NoAllocs ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView allocID() const
+      { return getString( FIX::FIELD::AllocID ); }
+      FIX::AllocTransType allocTransType() const
+      { return FIX::AllocTransType( getChar( FIX::FIELD::AllocTransType ) ); }
+      FIX::StringView refAllocID() const
+      { return getString( FIX::FIELD::RefAllocID ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      FIX::Decimal shares() const
+      { return getDecimal( FIX::FIELD::Shares ); }
+      FIX::Decimal avgPx() const
+      { return getDecimal( FIX::FIELD::AvgPx ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      int avgPrxPrecision() const
+      { return getInt( FIX::FIELD::AvgPrxPrecision ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      FIX::SettlmntTyp settlmntTyp() const
+      { return FIX::SettlmntTyp( getChar( FIX::FIELD::SettlmntTyp ) ); }
+      FIX::StringView futSettDate() const
+      { return getString( FIX::FIELD::FutSettDate ); }
+      FIX::Decimal netMoney() const
+      { return getDecimal( FIX::FIELD::NetMoney ); }
+      FIX::Decimal settlCurrAmt() const
+      { return getDecimal( FIX::FIELD::SettlCurrAmt ); }
+      FIX::StringView settlCurrency() const
+      { return getString( FIX::FIELD::SettlCurrency ); }
+      FIX::OpenClose openClose() const
+      { return FIX::OpenClose( getChar( FIX::FIELD::OpenClose ) ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int noOrders() const
+      { return getInt( FIX::FIELD::NoOrders ); }
+      int noExecs() const
+      { return getInt( FIX::FIELD::NoExecs ); }
+      int noMiscFees() const
+      { return getInt( FIX::FIELD::NoMiscFees ); }
+      int noAllocs() const
+      { return getInt( FIX::FIELD::NoAllocs ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "J" ) {}
+      void setAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocID, value ); }
+      void setAllocTransType( char value )
+      { setChar( FIX::FIELD::AllocTransType, value ); }
+      void setRefAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RefAllocID, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setShares( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Shares, value ); }
+      void setAvgPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AvgPx, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setAvgPrxPrecision( int value )
+      { setInt( FIX::FIELD::AvgPrxPrecision, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setSettlmntTyp( char value )
+      { setChar( FIX::FIELD::SettlmntTyp, value ); }
+      void setFutSettDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate, value ); }
+      void setNetMoney( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::NetMoney, value ); }
+      void setSettlCurrAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::SettlCurrAmt, value ); }
+      void setSettlCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlCurrency, value ); }
+      void setOpenClose( char value )
+      { setChar( FIX::FIELD::OpenClose, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setNoOrders( int value )
+      { setInt( FIX::FIELD::NoOrders, value ); }
+      void setNoExecs( int value )
+      { setInt( FIX::FIELD::NoExecs, value ); }
+      void setNoMiscFees( int value )
+      { setInt( FIX::FIELD::NoMiscFees, value ); }
+      void setNoAllocs( int value )
+      { setInt( FIX::FIELD::NoAllocs, value ); }
     };
   };
 
@@ -41,6 +41,56 @@ namespace FIX40
     FIELD_SET(*this, FIX::LastShares);
     FIELD_SET(*this, FIX::LastPx);
     FIELD_SET(*this, FIX::Text);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView execID() const
+      { return getString( FIX::FIELD::ExecID ); }
+      FIX::DKReason dKReason() const
+      { return FIX::DKReason( getChar( FIX::FIELD::DKReason ) ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::Decimal orderQty() const
+      { return getDecimal( FIX::FIELD::OrderQty ); }
+      FIX::Decimal lastShares() const
+      { return getDecimal( FIX::FIELD::LastShares ); }
+      FIX::Decimal lastPx() const
+      { return getDecimal( FIX::FIELD::LastPx ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "Q" ) {}
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setExecID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecID, value ); }
+      void setDKReason( char value )
+      { setChar( FIX::FIELD::DKReason, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderQty, value ); }
+      void setLastShares( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastShares, value ); }
+      void setLastPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastPx, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+    };
   };
 
 }
@@ -35,6 +35,58 @@ namespace FIX40
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::RawDataLength);
     FIELD_SET(*this, FIX::RawData);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::EmailType emailType() const
+      { return FIX::EmailType( getChar( FIX::FIELD::EmailType ) ); }
+      FIX::StringView origTime() const
+      { return getString( FIX::FIELD::OrigTime ); }
+      FIX::StringView relatdSym() const
+      { return getString( FIX::FIELD::RelatdSym ); }
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      int linesOfText() const
+      { return getInt( FIX::FIELD::LinesOfText ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int rawDataLength() const
+      { return getInt( FIX::FIELD::RawDataLength ); }
+      FIX::StringView rawData() const
+      { return getString( FIX::FIELD::RawData ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "C" ) {}
+      void setEmailType( char value )
+      { setChar( FIX::FIELD::EmailType, value ); }
+      void setOrigTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrigTime, value ); }
+      void setOrigTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::OrigTime, value, precision ); }
+      void setRelatdSym( const FIX::StringView& value )
+      { setString( FIX::FIELD::RelatdSym, value ); }
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setLinesOfText( int value )
+      { setInt( FIX::FIELD::LinesOfText, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setRawDataLength( int value )
+      { setInt( FIX::FIELD::RawDataLength, value ); }
+      void setRawData( const FIX::StringView& value )
+      { setString( FIX::FIELD::RawData, value ); }
+    };
   };
 
 }
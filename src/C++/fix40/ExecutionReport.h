@@ -94,6 +94,214 @@ namespace FIX40
       FIELD_SET(*this, FIX::MiscFeeAmt);
       FIELD_SET(*this, FIX::MiscFeeCurr);
       FIELD_SET(*this, FIX::MiscFeeType);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::MiscFeeAmt);
+        FIELD_VIEW(*m_pMap, FIX::MiscFeeCurr);
+        FIELD_VIEW(*m_pMap, FIX::MiscFeeType);
+      };
+    };
+    FIX::GroupView<NoMiscFees::View> noMiscFees() const
+    { return FIX::GroupView<NoMiscFees::View>( *this, FIX::FIELD::NoMiscFees ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      FIX::StringView clientID() const
+      { return getString( FIX::FIELD::ClientID ); }
+      FIX::StringView execBroker() const
+      { return getString( FIX::FIELD::ExecBroker ); }
+      FIX::StringView listID() const
+      { return getString( FIX::FIELD::ListID ); }
+      FIX::StringView execID() const
+      { return getString( FIX::FIELD::ExecID ); }
+      FIX::ExecTransType execTransType() const
+      { return FIX::ExecTransType( getChar( FIX::FIELD::ExecTransType ) ); }
+      FIX::StringView execRefID() const
+      { return getString( FIX::FIELD::ExecRefID ); }
+      FIX::OrdStatus ordStatus() const
+      { return FIX::OrdStatus( getChar( FIX::FIELD::OrdStatus ) ); }
+      int ordRejReason() const
+      { return getInt( FIX::FIELD::OrdRejReason ); }
+      FIX::StringView account() const
+      { return getString( FIX::FIELD::Account ); }
+      FIX::SettlmntTyp settlmntTyp() const
+      { return FIX::SettlmntTyp( getChar( FIX::FIELD::SettlmntTyp ) ); }
+      FIX::StringView futSettDate() const
+      { return getString( FIX::FIELD::FutSettDate ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::Decimal orderQty() const
+      { return getDecimal( FIX::FIELD::OrderQty ); }
+      FIX::OrdType ordType() const
+      { return FIX::OrdType( getChar( FIX::FIELD::OrdType ) ); }
+      FIX::Decimal price() const
+      { return getDecimal( FIX::FIELD::Price ); }
+      FIX::Decimal stopPx() const
+      { return getDecimal( FIX::FIELD::StopPx ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::TimeInForce timeInForce() const
+      { return FIX::TimeInForce( getChar( FIX::FIELD::TimeInForce ) ); }
+      FIX::StringView expireTime() const
+      { return getString( FIX::FIELD::ExpireTime ); }
+      FIX::StringView execInst() const
+      { return getString( FIX::FIELD::ExecInst ); }
+      FIX::Rule80A rule80A() const
+      { return FIX::Rule80A( getChar( FIX::FIELD::Rule80A ) ); }
+      FIX::Decimal lastShares() const
+      { return getDecimal( FIX::FIELD::LastShares ); }
+      FIX::Decimal lastPx() const
+      { return getDecimal( FIX::FIELD::LastPx ); }
+      FIX::StringView lastMkt() const
+      { return getString( FIX::FIELD::LastMkt ); }
+      FIX::LastCapacity lastCapacity() const
+      { return FIX::LastCapacity( getChar( FIX::FIELD::LastCapacity ) ); }
+      FIX::Decimal cumQty() const
+      { return getDecimal( FIX::FIELD::CumQty ); }
+      FIX::Decimal avgPx() const
+      { return getDecimal( FIX::FIELD::AvgPx ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      bool reportToExch() const
+      { return getBool( FIX::FIELD::ReportToExch ); }
+      FIX::Decimal commission() const
+      { return getDecimal( FIX::FIELD::Commission ); }
+      FIX::CommType commType() const
+      { return FIX::CommType( getChar( FIX::FIELD::CommType ) ); }
+      FIX::Decimal netMoney() const
+      { return getDecimal( FIX::FIELD::NetMoney ); }
+      FIX::Decimal settlCurrAmt() const
+      { return getDecimal( FIX::FIELD::SettlCurrAmt ); }
+      FIX::StringView settlCurrency() const
+      { return getString( FIX::FIELD::SettlCurrency ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int noMiscFees() const
+      { return getInt( FIX::FIELD::NoMiscFees ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "8" ) {}
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setClientID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClientID, value ); }
+      void setExecBroker( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecBroker, value ); }
+      void setListID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListID, value ); }
+      void setExecID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecID, value ); }
+      void setExecTransType( char value )
+      { setChar( FIX::FIELD::ExecTransType, value ); }
+      void setExecRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecRefID, value ); }
+      void setOrdStatus( char value )
+      { setChar( FIX::FIELD::OrdStatus, value ); }
+      void setOrdRejReason( int value )
+      { setInt( FIX::FIELD::OrdRejReason, value ); }
+      void setAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::Account, value ); }
+      void setSettlmntTyp( char value )
+      { setChar( FIX::FIELD::SettlmntTyp, value ); }
+      void setFutSettDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderQty, value ); }
+      void setOrdType( char value )
+      { setChar( FIX::FIELD::OrdType, value ); }
+      void setPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Price, value ); }
+      void setStopPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StopPx, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setTimeInForce( char value )
+      { setChar( FIX::FIELD::TimeInForce, value ); }
+      void setExpireTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExpireTime, value ); }
+      void setExpireTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::ExpireTime, value, precision ); }
+      void setExecInst( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecInst, value ); }
+      void setRule80A( char value )
+      { setChar( FIX::FIELD::Rule80A, value ); }
+      void setLastShares( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastShares, value ); }
+      void setLastPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastPx, value ); }
+      void setLastMkt( const FIX::StringView& value )
+      { setString( FIX::FIELD::LastMkt, value ); }
+      void setLastCapacity( char value )
+      { setChar( FIX::FIELD::LastCapacity, value ); }
+      void setCumQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CumQty, value ); }
+      void setAvgPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AvgPx, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setReportToExch( bool value )
+      { setBool( FIX::FIELD::ReportToExch, value ); }
+      void setCommission( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Commission, value ); }
+      void setCommType( char value )
+      { setChar( FIX::FIELD::CommType, value ); }
+      void setNetMoney( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::NetMoney, value ); }
+      void setSettlCurrAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::SettlCurrAmt, value ); }
+      void setSettlCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlCurrency, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setNoMiscFees( int value )
+      { setInt( FIX::FIELD::NoMiscFees, value ); }
     };
   };
 
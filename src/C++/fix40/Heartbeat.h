@@ -16,6 +16,24 @@ namespace FIX40
     static FIX::MsgType MsgType() { return FIX::MsgType("0"); }
 
     FIELD_SET(*this, FIX::TestReqID);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView testReqID() const
+      { return getString( FIX::FIELD::TestReqID ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "0" ) {}
+      void setTestReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TestReqID, value ); }
+    };
   };
 
 }
@@ -49,6 +49,98 @@ namespace FIX40
     FIELD_SET(*this, FIX::IOINaturalFlag);
     FIELD_SET(*this, FIX::IOIQualifier);
     FIELD_SET(*this, FIX::Text);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView iOIid() const
+      { return getString( FIX::FIELD::IOIid ); }
+      FIX::IOITransType iOITransType() const
+      { return FIX::IOITransType( getChar( FIX::FIELD::IOITransType ) ); }
+      FIX::StringView iOIRefID() const
+      { return getString( FIX::FIELD::IOIRefID ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::StringView iOIShares() const
+      { return getString( FIX::FIELD::IOIShares ); }
+      FIX::Decimal price() const
+      { return getDecimal( FIX::FIELD::Price ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::StringView validUntilTime() const
+      { return getString( FIX::FIELD::ValidUntilTime ); }
+      FIX::IOIQltyInd iOIQltyInd() const
+      { return FIX::IOIQltyInd( getChar( FIX::FIELD::IOIQltyInd ) ); }
+      FIX::IOIOthSvc iOIOthSvc() const
+      { return FIX::IOIOthSvc( getChar( FIX::FIELD::IOIOthSvc ) ); }
+      bool iOINaturalFlag() const
+      { return getBool( FIX::FIELD::IOINaturalFlag ); }
+      FIX::IOIQualifier iOIQualifier() const
+      { return FIX::IOIQualifier( getChar( FIX::FIELD::IOIQualifier ) ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "6" ) {}
+      void setIOIid( const FIX::StringView& value )
+      { setString( FIX::FIELD::IOIid, value ); }
+      void setIOITransType( char value )
+      { setChar( FIX::FIELD::IOITransType, value ); }
+      void setIOIRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::IOIRefID, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setIOIShares( const FIX::StringView& value )
+      { setString( FIX::FIELD::IOIShares, value ); }
+      void setPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Price, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setValidUntilTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::ValidUntilTime, value ); }
+      void setValidUntilTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::ValidUntilTime, value, precision ); }
+      void setIOIQltyInd( char value )
+      { setChar( FIX::FIELD::IOIQltyInd, value ); }
+      void setIOIOthSvc( char value )
+      { setChar( FIX::FIELD::IOIOthSvc, value ); }
+      void setIOINaturalFlag( bool value )
+      { setBool( FIX::FIELD::IOINaturalFlag, value ); }
+      void setIOIQualifier( char value )
+      { setChar( FIX::FIELD::IOIQualifier, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+    };
   };
 
 }
@@ -39,6 +39,51 @@ namespace FIX40
       FIELD_SET(*this, FIX::CumQty);
       FIELD_SET(*this, FIX::CxlQty);
       FIELD_SET(*this, FIX::AvgPx);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::CumQty);
+        FIELD_VIEW(*m_pMap, FIX::CxlQty);
+        FIELD_VIEW(*m_pMap, FIX::AvgPx);
+      };
+    };
+    FIX::GroupView<NoOrders::View> noOrders() const
+    { return FIX::GroupView<NoOrders::View>( *this, FIX::FIELD::NoOrders ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView listID() const
+      { return getString( FIX::FIELD::ListID ); }
+      FIX::StringView waveNo() const
+      { return getString( FIX::FIELD::WaveNo ); }
+      int noRpts() const
+      { return getInt( FIX::FIELD::NoRpts ); }
+      int rptSeq() const
+      { return getInt( FIX::FIELD::RptSeq ); }
+      int noOrders() const
+      { return getInt( FIX::FIELD::NoOrders ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "N" ) {}
+      void setListID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListID, value ); }
+      void setWaveNo( const FIX::StringView& value )
+      { setString( FIX::FIELD::WaveNo, value ); }
+      void setNoRpts( int value )
+      { setInt( FIX::FIELD::NoRpts, value ); }
+      void setRptSeq( int value )
+      { setInt( FIX::FIELD::RptSeq, value ); }
+      void setNoOrders( int value )
+      { setInt( FIX::FIELD::NoOrders, value ); }
     };
   };
 
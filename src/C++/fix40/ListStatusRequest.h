@@ -25,6 +25,32 @@ namespace FIX40
     FIELD_SET(*this, FIX::ListID);
     FIELD_SET(*this, FIX::WaveNo);
     FIELD_SET(*this, FIX::Text);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView listID() const
+      { return getString( FIX::FIELD::ListID ); }
+      FIX::StringView waveNo() const
+      { return getString( FIX::FIELD::WaveNo ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "M" ) {}
+      void setListID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListID, value ); }
+      void setWaveNo( const FIX::StringView& value )
+      { setString( FIX::FIELD::WaveNo, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+    };
   };
 
 }
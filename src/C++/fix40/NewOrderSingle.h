@@ -68,6 +68,166 @@ namespace FIX40
     FIELD_SET(*this, FIX::ForexReq);
     FIELD_SET(*this, FIX::SettlCurrency);
     FIELD_SET(*this, FIX::Text);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      FIX::StringView clientID() const
+      { return getString( FIX::FIELD::ClientID ); }
+      FIX::StringView execBroker() const
+      { return getString( FIX::FIELD::ExecBroker ); }
+      FIX::StringView account() const
+      { return getString( FIX::FIELD::Account ); }
+      FIX::SettlmntTyp settlmntTyp() const
+      { return FIX::SettlmntTyp( getChar( FIX::FIELD::SettlmntTyp ) ); }
+      FIX::StringView futSettDate() const
+      { return getString( FIX::FIELD::FutSettDate ); }
+      FIX::HandlInst handlInst() const
+      { return FIX::HandlInst( getChar( FIX::FIELD::HandlInst ) ); }
+      FIX::StringView execInst() const
+      { return getString( FIX::FIELD::ExecInst ); }
+      FIX::Decimal minQty() const
+      { return getDecimal( FIX::FIELD::MinQty ); }
+      FIX::Decimal maxFloor() const
+      { return getDecimal( FIX::FIELD::MaxFloor ); }
+      FIX::StringView exDestination() const
+      { return getString( FIX::FIELD::ExDestination ); }
+      FIX::ProcessCode processCode() const
+      { return FIX::ProcessCode( getChar( FIX::FIELD::ProcessCode ) ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      FIX::Decimal prevClosePx() const
+      { return getDecimal( FIX::FIELD::PrevClosePx ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      bool locateReqd() const
+      { return getBool( FIX::FIELD::LocateReqd ); }
+      FIX::Decimal orderQty() const
+      { return getDecimal( FIX::FIELD::OrderQty ); }
+      FIX::OrdType ordType() const
+      { return FIX::OrdType( getChar( FIX::FIELD::OrdType ) ); }
+      FIX::Decimal price() const
+      { return getDecimal( FIX::FIELD::Price ); }
+      FIX::Decimal stopPx() const
+      { return getDecimal( FIX::FIELD::StopPx ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::StringView iOIid() const
+      { return getString( FIX::FIELD::IOIid ); }
+      FIX::StringView quoteID() const
+      { return getString( FIX::FIELD::QuoteID ); }
+      FIX::TimeInForce timeInForce() const
+      { return FIX::TimeInForce( getChar( FIX::FIELD::TimeInForce ) ); }
+      FIX::StringView expireTime() const
+      { return getString( FIX::FIELD::ExpireTime ); }
+      FIX::Decimal commission() const
+      { return getDecimal( FIX::FIELD::Commission ); }
+      FIX::CommType commType() const
+      { return FIX::CommType( getChar( FIX::FIELD::CommType ) ); }
+      FIX::Rule80A rule80A() const
+      { return FIX::Rule80A( getChar( FIX::FIELD::Rule80A ) ); }
+      bool forexReq() const
+      { return getBool( FIX::FIELD::ForexReq ); }
+      FIX::StringView settlCurrency() const
+      { return getString( FIX::FIELD::SettlCurrency ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "D" ) {}
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setClientID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClientID, value ); }
+      void setExecBroker( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecBroker, value ); }
+      void setAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::Account, value ); }
+      void setSettlmntTyp( char value )
+      { setChar( FIX::FIELD::SettlmntTyp, value ); }
+      void setFutSettDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate, value ); }
+      void setHandlInst( char value )
+      { setChar( FIX::FIELD::HandlInst, value ); }
+      void setExecInst( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecInst, value ); }
+      void setMinQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MinQty, value ); }
+      void setMaxFloor( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MaxFloor, value ); }
+      void setExDestination( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExDestination, value ); }
+      void setProcessCode( char value )
+      { setChar( FIX::FIELD::ProcessCode, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setPrevClosePx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::PrevClosePx, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setLocateReqd( bool value )
+      { setBool( FIX::FIELD::LocateReqd, value ); }
+      void setOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderQty, value ); }
+      void setOrdType( char value )
+      { setChar( FIX::FIELD::OrdType, value ); }
+      void setPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Price, value ); }
+      void setStopPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StopPx, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setIOIid( const FIX::StringView& value )
+      { setString( FIX::FIELD::IOIid, value ); }
+      void setQuoteID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteID, value ); }
+      void setTimeInForce( char value )
+      { setChar( FIX::FIELD::TimeInForce, value ); }
+      void setExpireTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExpireTime, value ); }
+      void setExpireTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::ExpireTime, value, precision ); }
+      void setCommission( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Commission, value ); }
+      void setCommType( char value )
+      { setChar( FIX::FIELD::CommType, value ); }
+      void setRule80A( char value )
+      { setChar( FIX::FIELD::Rule80A, value ); }
+      void setForexReq( bool value )
+      { setBool( FIX::FIELD::ForexReq, value ); }
+      void setSettlCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlCurrency, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+    };
   };
 
 }
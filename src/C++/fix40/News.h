@@ -31,6 +31,50 @@ namespace FIX40
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::RawDataLength);
     FIELD_SET(*this, FIX::RawData);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView origTime() const
+      { return getString( FIX::FIELD::OrigTime ); }
+      FIX::Urgency urgency() const
+      { return FIX::Urgency( getChar( FIX::FIELD::Urgency ) ); }
+      FIX::StringView relatdSym() const
+      { return getString( FIX::FIELD::RelatdSym ); }
+      int linesOfText() const
+      { return getInt( FIX::FIELD::LinesOfText ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int rawDataLength() const
+      { return getInt( FIX::FIELD::RawDataLength ); }
+      FIX::StringView rawData() const
+      { return getString( FIX::FIELD::RawData ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "B" ) {}
+      void setOrigTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrigTime, value ); }
+      void setOrigTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::OrigTime, value, precision ); }
+      void setUrgency( char value )
+      { setChar( FIX::FIELD::Urgency, value ); }
+      void setRelatdSym( const FIX::StringView& value )
+      { setString( FIX::FIELD::RelatdSym, value ); }
+      void setLinesOfText( int value )
+      { setInt( FIX::FIELD::LinesOfText, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setRawDataLength( int value )
+      { setInt( FIX::FIELD::RawDataLength, value ); }
+      void setRawData( const FIX::StringView& value )
+      { setString( FIX::FIELD::RawData, value ); }
+    };
   };
 
 }
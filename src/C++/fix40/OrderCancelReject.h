@@ -31,6 +31,48 @@ namespace FIX40
     FIELD_SET(*this, FIX::ListID);
     FIELD_SET(*this, FIX::CxlRejReason);
     FIELD_SET(*this, FIX::Text);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      FIX::StringView clientID() const
+      { return getString( FIX::FIELD::ClientID ); }
+      FIX::StringView execBroker() const
+      { return getString( FIX::FIELD::ExecBroker ); }
+      FIX::StringView listID() const
+      { return getString( FIX::FIELD::ListID ); }
+      int cxlRejReason() const
+      { return getInt( FIX::FIELD::CxlRejReason ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "9" ) {}
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setClientID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClientID, value ); }
+      void setExecBroker( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecBroker, value ); }
+      void setListID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListID, value ); }
+      void setCxlRejReason( int value )
+      { setInt( FIX::FIELD::CxlRejReason, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+    };
   };
 
 }
@@ -39,6 +39,74 @@ namespace FIX40
     FIELD_SET(*this, FIX::BidSize);
     FIELD_SET(*this, FIX::OfferSize);
     FIELD_SET(*this, FIX::ValidUntilTime);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView quoteReqID() const
+      { return getString( FIX::FIELD::QuoteReqID ); }
+      FIX::StringView quoteID() const
+      { return getString( FIX::FIELD::QuoteID ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      FIX::Decimal bidPx() const
+      { return getDecimal( FIX::FIELD::BidPx ); }
+      FIX::Decimal offerPx() const
+      { return getDecimal( FIX::FIELD::OfferPx ); }
+      FIX::Decimal bidSize() const
+      { return getDecimal( FIX::FIELD::BidSize ); }
+      FIX::Decimal offerSize() const
+      { return getDecimal( FIX::FIELD::OfferSize ); }
+      FIX::StringView validUntilTime() const
+      { return getString( FIX::FIELD::ValidUntilTime ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "S" ) {}
+      void setQuoteReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteReqID, value ); }
+      void setQuoteID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteID, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setBidPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::BidPx, value ); }
+      void setOfferPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OfferPx, value ); }
+      void setBidSize( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::BidSize, value ); }
+      void setOfferSize( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OfferSize, value ); }
+      void setValidUntilTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::ValidUntilTime, value ); }
+      void setValidUntilTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::ValidUntilTime, value, precision ); }
+    };
   };
 
 }
@@ -48,6 +48,108 @@ namespace FIX41
     FIELD_SET(*this, FIX::LastShares);
     FIELD_SET(*this, FIX::LastPx);
     FIELD_SET(*this, FIX::Text);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView execID() const
+      { return getString( FIX::FIELD::ExecID ); }
+      FIX::DKReason dKReason() const
+      { return FIX::DKReason( getChar( FIX::FIELD::DKReason ) ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDay() const
+      { return getString( FIX::FIELD::MaturityDay ); }
+      int putOrCall() const
+      { return getInt( FIX::FIELD::PutOrCall ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::Decimal orderQty() const
+      { return getDecimal( FIX::FIELD::OrderQty ); }
+      FIX::Decimal cashOrderQty() const
+      { return getDecimal( FIX::FIELD::CashOrderQty ); }
+      FIX::Decimal lastShares() const
+      { return getDecimal( FIX::FIELD::LastShares ); }
+      FIX::Decimal lastPx() const
+      { return getDecimal( FIX::FIELD::LastPx ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "Q" ) {}
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setExecID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecID, value ); }
+      void setDKReason( char value )
+      { setChar( FIX::FIELD::DKReason, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDay( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDay, value ); }
+      void setPutOrCall( int value )
+      { setInt( FIX::FIELD::PutOrCall, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderQty, value ); }
+      void setCashOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CashOrderQty, value ); }
+      void setLastShares( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastShares, value ); }
+      void setLastPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastPx, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+    };
   };
 
 }
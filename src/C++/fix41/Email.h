@@ -52,13 +52,97 @@ namespace FIX41
       FIELD_SET(*this, FIX::SecurityExchange);
       FIELD_SET(*this, FIX::Issuer);
       FIELD_SET(*this, FIX::SecurityDesc);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::RelatdSym);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::IDSource);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDay);
+        FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+      };
     };
+    FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+    { return FIX::GroupView<NoRelatedSym::View>( *this, FIX::FIELD::NoRelatedSym ); }
     FIELD_SET(*this, FIX::LinesOfText);
     class LinesOfText: public FIX::Group
     {
     public:
     LinesOfText() : FIX::Group(33,58,FIX::message_order(58,0)) {}
       FIELD_SET(*this, FIX::Text);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Text);
+      };
+    };
+    FIX::GroupView<LinesOfText::View> linesOfText() const
+    { return FIX::GroupView<LinesOfText::View>( *this, FIX::FIELD::LinesOfText ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView emailThreadID() const
+      { return getString( FIX::FIELD::EmailThreadID ); }
+      FIX::EmailType emailType() const
+      { return FIX::EmailType( getChar( FIX::FIELD::EmailType ) ); }
+      FIX::StringView origTime() const
+      { return getString( FIX::FIELD::OrigTime ); }
+      FIX::StringView subject() const
+      { return getString( FIX::FIELD::Subject ); }
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      int rawDataLength() const
+      { return getInt( FIX::FIELD::RawDataLength ); }
+      FIX::StringView rawData() const
+      { return getString( FIX::FIELD::RawData ); }
+      int noRelatedSym() const
+      { return getInt( FIX::FIELD::NoRelatedSym ); }
+      int linesOfText() const
+      { return getInt( FIX::FIELD::LinesOfText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "C" ) {}
+      void setEmailThreadID( const FIX::StringView& value )
+      { setString( FIX::FIELD::EmailThreadID, value ); }
+      void setEmailType( char value )
+      { setChar( FIX::FIELD::EmailType, value ); }
+      void setOrigTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrigTime, value ); }
+      void setOrigTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::OrigTime, value, precision ); }
+      void setSubject( const FIX::StringView& value )
+      { setString( FIX::FIELD::Subject, value ); }
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setRawDataLength( int value )
+      { setInt( FIX::FIELD::RawDataLength, value ); }
+      void setRawData( const FIX::StringView& value )
+      { setString( FIX::FIELD::RawData, value ); }
+      void setNoRelatedSym( int value )
+      { setInt( FIX::FIELD::NoRelatedSym, value ); }
+      void setLinesOfText( int value )
+      { setInt( FIX::FIELD::LinesOfText, value ); }
     };
   };
 
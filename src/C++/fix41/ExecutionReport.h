@@ -105,6 +105,260 @@ namespace FIX41
     FIELD_SET(*this, FIX::SettlCurrFxRate);
     FIELD_SET(*this, FIX::SettlCurrFxRateCalc);
     FIELD_SET(*this, FIX::Text);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView secondaryOrderID() const
+      { return getString( FIX::FIELD::SecondaryOrderID ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      FIX::StringView origClOrdID() const
+      { return getString( FIX::FIELD::OrigClOrdID ); }
+      FIX::StringView clientID() const
+      { return getString( FIX::FIELD::ClientID ); }
+      FIX::StringView execBroker() const
+      { return getString( FIX::FIELD::ExecBroker ); }
+      FIX::StringView listID() const
+      { return getString( FIX::FIELD::ListID ); }
+      FIX::StringView execID() const
+      { return getString( FIX::FIELD::ExecID ); }
+      FIX::ExecTransType execTransType() const
+      { return FIX::ExecTransType( getChar( FIX::FIELD::ExecTransType ) ); }
+      FIX::StringView execRefID() const
+      { return getString( FIX::FIELD::ExecRefID ); }
+      FIX::ExecType execType() const
+      { return FIX::ExecType( getChar( FIX::FIELD::ExecType ) ); }
+      FIX::OrdStatus ordStatus() const
+      { return FIX::OrdStatus( getChar( FIX::FIELD::OrdStatus ) ); }
+      int ordRejReason() const
+      { return getInt( FIX::FIELD::OrdRejReason ); }
+      FIX::StringView account() const
+      { return getString( FIX::FIELD::Account ); }
+      FIX::SettlmntTyp settlmntTyp() const
+      { return FIX::SettlmntTyp( getChar( FIX::FIELD::SettlmntTyp ) ); }
+      FIX::StringView futSettDate() const
+      { return getString( FIX::FIELD::FutSettDate ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDay() const
+      { return getString( FIX::FIELD::MaturityDay ); }
+      int putOrCall() const
+      { return getInt( FIX::FIELD::PutOrCall ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::Decimal orderQty() const
+      { return getDecimal( FIX::FIELD::OrderQty ); }
+      FIX::OrdType ordType() const
+      { return FIX::OrdType( getChar( FIX::FIELD::OrdType ) ); }
+      FIX::Decimal price() const
+      { return getDecimal( FIX::FIELD::Price ); }
+      FIX::Decimal stopPx() const
+      { return getDecimal( FIX::FIELD::StopPx ); }
+      double pegDifference() const
+      { return getDouble( FIX::FIELD::PegDifference ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::TimeInForce timeInForce() const
+      { return FIX::TimeInForce( getChar( FIX::FIELD::TimeInForce ) ); }
+      FIX::StringView expireTime() const
+      { return getString( FIX::FIELD::ExpireTime ); }
+      FIX::StringView execInst() const
+      { return getString( FIX::FIELD::ExecInst ); }
+      FIX::Rule80A rule80A() const
+      { return FIX::Rule80A( getChar( FIX::FIELD::Rule80A ) ); }
+      FIX::Decimal lastShares() const
+      { return getDecimal( FIX::FIELD::LastShares ); }
+      FIX::Decimal lastPx() const
+      { return getDecimal( FIX::FIELD::LastPx ); }
+      FIX::Decimal lastSpotRate() const
+      { return getDecimal( FIX::FIELD::LastSpotRate ); }
+      double lastForwardPoints() const
+      { return getDouble( FIX::FIELD::LastForwardPoints ); }
+      FIX::StringView lastMkt() const
+      { return getString( FIX::FIELD::LastMkt ); }
+      FIX::LastCapacity lastCapacity() const
+      { return FIX::LastCapacity( getChar( FIX::FIELD::LastCapacity ) ); }
+      FIX::Decimal leavesQty() const
+      { return getDecimal( FIX::FIELD::LeavesQty ); }
+      FIX::Decimal cumQty() const
+      { return getDecimal( FIX::FIELD::CumQty ); }
+      FIX::Decimal avgPx() const
+      { return getDecimal( FIX::FIELD::AvgPx ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      bool reportToExch() const
+      { return getBool( FIX::FIELD::ReportToExch ); }
+      FIX::Decimal commission() const
+      { return getDecimal( FIX::FIELD::Commission ); }
+      FIX::CommType commType() const
+      { return FIX::CommType( getChar( FIX::FIELD::CommType ) ); }
+      FIX::Decimal settlCurrAmt() const
+      { return getDecimal( FIX::FIELD::SettlCurrAmt ); }
+      FIX::StringView settlCurrency() const
+      { return getString( FIX::FIELD::SettlCurrency ); }
+      double settlCurrFxRate() const
+      { return getDouble( FIX::FIELD::SettlCurrFxRate ); }
+      FIX::SettlCurrFxRateCalc settlCurrFxRateCalc() const
+      { return FIX::SettlCurrFxRateCalc( getChar( FIX::FIELD::SettlCurrFxRateCalc ) ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "8" ) {}
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setSecondaryOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecondaryOrderID, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setOrigClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrigClOrdID, value ); }
+      void setClientID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClientID, value ); }
+      void setExecBroker( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecBroker, value ); }
+      void setListID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListID, value ); }
+      void setExecID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecID, value ); }
+      void setExecTransType( char value )
+      { setChar( FIX::FIELD::ExecTransType, value ); }
+      void setExecRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecRefID, value ); }
+      void setExecType( char value )
+      { setChar( FIX::FIELD::ExecType, value ); }
+      void setOrdStatus( char value )
+      { setChar( FIX::FIELD::OrdStatus, value ); }
+      void setOrdRejReason( int value )
+      { setInt( FIX::FIELD::OrdRejReason, value ); }
+      void setAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::Account, value ); }
+      void setSettlmntTyp( char value )
+      { setChar( FIX::FIELD::SettlmntTyp, value ); }
+      void setFutSettDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDay( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDay, value ); }
+      void setPutOrCall( int value )
+      { setInt( FIX::FIELD::PutOrCall, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderQty, value ); }
+      void setOrdType( char value )
+      { setChar( FIX::FIELD::OrdType, value ); }
+      void setPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Price, value ); }
+      void setStopPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StopPx, value ); }
+      void setPegDifference( double value )
+      { setDouble( FIX::FIELD::PegDifference, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setTimeInForce( char value )
+      { setChar( FIX::FIELD::TimeInForce, value ); }
+      void setExpireTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExpireTime, value ); }
+      void setExpireTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::ExpireTime, value, precision ); }
+      void setExecInst( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecInst, value ); }
+      void setRule80A( char value )
+      { setChar( FIX::FIELD::Rule80A, value ); }
+      void setLastShares( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastShares, value ); }
+      void setLastPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastPx, value ); }
+      void setLastSpotRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastSpotRate, value ); }
+      void setLastForwardPoints( double value )
+      { setDouble( FIX::FIELD::LastForwardPoints, value ); }
+      void setLastMkt( const FIX::StringView& value )
+      { setString( FIX::FIELD::LastMkt, value ); }
+      void setLastCapacity( char value )
+      { setChar( FIX::FIELD::LastCapacity, value ); }
+      void setLeavesQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LeavesQty, value ); }
+      void setCumQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CumQty, value ); }
+      void setAvgPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AvgPx, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setReportToExch( bool value )
+      { setBool( FIX::FIELD::ReportToExch, value ); }
+      void setCommission( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Commission, value ); }
+      void setCommType( char value )
+      { setChar( FIX::FIELD::CommType, value ); }
+      void setSettlCurrAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::SettlCurrAmt, value ); }
+      void setSettlCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlCurrency, value ); }
+      void setSettlCurrFxRate( double value )
+      { setDouble( FIX::FIELD::SettlCurrFxRate, value ); }
+      void setSettlCurrFxRateCalc( char value )
+      { setChar( FIX::FIELD::SettlCurrFxRateCalc, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+    };
   };
 
 }
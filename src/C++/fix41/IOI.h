@@ -63,6 +63,144 @@ namespace FIX41
     public:
     NoIOIQualifiers() : FIX::Group(199,104,FIX::message_order(104,0)) {}
       FIELD_SET(*this, FIX::IOIQualifier);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::IOIQualifier);
+      };
+    };
+    FIX::GroupView<NoIOIQualifiers::View> noIOIQualifiers() const
+    { return FIX::GroupView<NoIOIQualifiers::View>( *this, FIX::FIELD::NoIOIQualifiers ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView iOIid() const
+      { return getString( FIX::FIELD::IOIid ); }
+      FIX::IOITransType iOITransType() const
+      { return FIX::IOITransType( getChar( FIX::FIELD::IOITransType ) ); }
+      FIX::StringView iOIRefID() const
+      { return getString( FIX::FIELD::IOIRefID ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDay() const
+      { return getString( FIX::FIELD::MaturityDay ); }
+      int putOrCall() const
+      { return getInt( FIX::FIELD::PutOrCall ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::StringView iOIShares() const
+      { return getString( FIX::FIELD::IOIShares ); }
+      FIX::Decimal price() const
+      { return getDecimal( FIX::FIELD::Price ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::StringView validUntilTime() const
+      { return getString( FIX::FIELD::ValidUntilTime ); }
+      FIX::IOIQltyInd iOIQltyInd() const
+      { return FIX::IOIQltyInd( getChar( FIX::FIELD::IOIQltyInd ) ); }
+      FIX::IOIOthSvc iOIOthSvc() const
+      { return FIX::IOIOthSvc( getChar( FIX::FIELD::IOIOthSvc ) ); }
+      bool iOINaturalFlag() const
+      { return getBool( FIX::FIELD::IOINaturalFlag ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      FIX::StringView uRLLink() const
+      { return getString( FIX::FIELD::URLLink ); }
+      int noIOIQualifiers() const
+      { return getInt( FIX::FIELD::NoIOIQualifiers ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "6" ) {}
+      void setIOIid( const FIX::StringView& value )
+      { setString( FIX::FIELD::IOIid, value ); }
+      void setIOITransType( char value )
+      { setChar( FIX::FIELD::IOITransType, value ); }
+      void setIOIRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::IOIRefID, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDay( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDay, value ); }
+      void setPutOrCall( int value )
+      { setInt( FIX::FIELD::PutOrCall, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setIOIShares( const FIX::StringView& value )
+      { setString( FIX::FIELD::IOIShares, value ); }
+      void setPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Price, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setValidUntilTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::ValidUntilTime, value ); }
+      void setValidUntilTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::ValidUntilTime, value, precision ); }
+      void setIOIQltyInd( char value )
+      { setChar( FIX::FIELD::IOIQltyInd, value ); }
+      void setIOIOthSvc( char value )
+      { setChar( FIX::FIELD::IOIOthSvc, value ); }
+      void setIOINaturalFlag( bool value )
+      { setBool( FIX::FIELD::IOINaturalFlag, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setURLLink( const FIX::StringView& value )
+      { setString( FIX::FIELD::URLLink, value ); }
+      void setNoIOIQualifiers( int value )
+      { setInt( FIX::FIELD::NoIOIQualifiers, value ); }
     };
   };
 
@@ -29,6 +29,40 @@ namespace FIX41
     FIELD_SET(*this, FIX::RawDataLength);
     FIELD_SET(*this, FIX::RawData);
     FIELD_SET(*this, FIX::ResetSeqNumFlag);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      int encryptMethod() const
+      { return getInt( FIX::FIELD::EncryptMethod ); }
+      int heartBtInt() const
+      { return getInt( FIX::FIELD::HeartBtInt ); }
+      int rawDataLength() const
+      { return getInt( FIX::FIELD::RawDataLength ); }
+      FIX::StringView rawData() const
+      { return getString( FIX::FIELD::RawData ); }
+      bool resetSeqNumFlag() const
+      { return getBool( FIX::FIELD::ResetSeqNumFlag ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "A" ) {}
+      void setEncryptMethod( int value )
+      { setInt( FIX::FIELD::EncryptMethod, value ); }
+      void setHeartBtInt( int value )
+      { setInt( FIX::FIELD::HeartBtInt, value ); }
+      void setRawDataLength( int value )
+      { setInt( FIX::FIELD::RawDataLength, value ); }
+      void setRawData( const FIX::StringView& value )
+      { setString( FIX::FIELD::RawData, value ); }
+      void setResetSeqNumFlag( bool value )
+      { setBool( FIX::FIELD::ResetSeqNumFlag, value ); }
+    };
   };
 
 }
@@ -81,6 +81,226 @@ namespace FIX41
     FIELD_SET(*this, FIX::CustomerOrFirm);
     FIELD_SET(*this, FIX::MaxShow);
     FIELD_SET(*this, FIX::PegDifference);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      FIX::StringView clientID() const
+      { return getString( FIX::FIELD::ClientID ); }
+      FIX::StringView execBroker() const
+      { return getString( FIX::FIELD::ExecBroker ); }
+      FIX::StringView account() const
+      { return getString( FIX::FIELD::Account ); }
+      FIX::SettlmntTyp settlmntTyp() const
+      { return FIX::SettlmntTyp( getChar( FIX::FIELD::SettlmntTyp ) ); }
+      FIX::StringView futSettDate() const
+      { return getString( FIX::FIELD::FutSettDate ); }
+      FIX::HandlInst handlInst() const
+      { return FIX::HandlInst( getChar( FIX::FIELD::HandlInst ) ); }
+      FIX::StringView execInst() const
+      { return getString( FIX::FIELD::ExecInst ); }
+      FIX::Decimal minQty() const
+      { return getDecimal( FIX::FIELD::MinQty ); }
+      FIX::Decimal maxFloor() const
+      { return getDecimal( FIX::FIELD::MaxFloor ); }
+      FIX::StringView exDestination() const
+      { return getString( FIX::FIELD::ExDestination ); }
+      FIX::ProcessCode processCode() const
+      { return FIX::ProcessCode( getChar( FIX::FIELD::ProcessCode ) ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDay() const
+      { return getString( FIX::FIELD::MaturityDay ); }
+      int putOrCall() const
+      { return getInt( FIX::FIELD::PutOrCall ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      FIX::Decimal prevClosePx() const
+      { return getDecimal( FIX::FIELD::PrevClosePx ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      bool locateReqd() const
+      { return getBool( FIX::FIELD::LocateReqd ); }
+      FIX::Decimal orderQty() const
+      { return getDecimal( FIX::FIELD::OrderQty ); }
+      FIX::Decimal cashOrderQty() const
+      { return getDecimal( FIX::FIELD::CashOrderQty ); }
+      FIX::OrdType ordType() const
+      { return FIX::OrdType( getChar( FIX::FIELD::OrdType ) ); }
+      FIX::Decimal price() const
+      { return getDecimal( FIX::FIELD::Price ); }
+      FIX::Decimal stopPx() const
+      { return getDecimal( FIX::FIELD::StopPx ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::StringView iOIid() const
+      { return getString( FIX::FIELD::IOIid ); }
+      FIX::StringView quoteID() const
+      { return getString( FIX::FIELD::QuoteID ); }
+      FIX::TimeInForce timeInForce() const
+      { return FIX::TimeInForce( getChar( FIX::FIELD::TimeInForce ) ); }
+      FIX::StringView expireTime() const
+      { return getString( FIX::FIELD::ExpireTime ); }
+      FIX::Decimal commission() const
+      { return getDecimal( FIX::FIELD::Commission ); }
+      FIX::CommType commType() const
+      { return FIX::CommType( getChar( FIX::FIELD::CommType ) ); }
+      FIX::Rule80A rule80A() const
+      { return FIX::Rule80A( getChar( FIX::FIELD::Rule80A ) ); }
+      bool forexReq() const
+      { return getBool( FIX::FIELD::ForexReq ); }
+      FIX::StringView settlCurrency() const
+      { return getString( FIX::FIELD::SettlCurrency ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      FIX::StringView futSettDate2() const
+      { return getString( FIX::FIELD::FutSettDate2 ); }
+      FIX::Decimal orderQty2() const
+      { return getDecimal( FIX::FIELD::OrderQty2 ); }
+      FIX::OpenClose openClose() const
+      { return FIX::OpenClose( getChar( FIX::FIELD::OpenClose ) ); }
+      int coveredOrUncovered() const
+      { return getInt( FIX::FIELD::CoveredOrUncovered ); }
+      int customerOrFirm() const
+      { return getInt( FIX::FIELD::CustomerOrFirm ); }
+      FIX::Decimal maxShow() const
+      { return getDecimal( FIX::FIELD::MaxShow ); }
+      double pegDifference() const
+      { return getDouble( FIX::FIELD::PegDifference ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "D" ) {}
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setClientID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClientID, value ); }
+      void setExecBroker( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecBroker, value ); }
+      void setAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::Account, value ); }
+      void setSettlmntTyp( char value )
+      { setChar( FIX::FIELD::SettlmntTyp, value ); }
+      void setFutSettDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate, value ); }
+      void setHandlInst( char value )
+      { setChar( FIX::FIELD::HandlInst, value ); }
+      void setExecInst( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecInst, value ); }
+      void setMinQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MinQty, value ); }
+      void setMaxFloor( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MaxFloor, value ); }
+      void setExDestination( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExDestination, value ); }
+      void setProcessCode( char value )
+      { setChar( FIX::FIELD::ProcessCode, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDay( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDay, value ); }
+      void setPutOrCall( int value )
+      { setInt( FIX::FIELD::PutOrCall, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setPrevClosePx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::PrevClosePx, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setLocateReqd( bool value )
+      { setBool( FIX::FIELD::LocateReqd, value ); }
+      void setOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderQty, value ); }
+      void setCashOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CashOrderQty, value ); }
+      void setOrdType( char value )
+      { setChar( FIX::FIELD::OrdType, value ); }
+      void setPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Price, value ); }
+      void setStopPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StopPx, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setIOIid( const FIX::StringView& value )
+      { setString( FIX::FIELD::IOIid, value ); }
+      void setQuoteID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteID, value ); }
+      void setTimeInForce( char value )
+      { setChar( FIX::FIELD::TimeInForce, value ); }
+      void setExpireTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExpireTime, value ); }
+      void setExpireTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::ExpireTime, value, precision ); }
+      void setCommission( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Commission, value ); }
+      void setCommType( char value )
+      { setChar( FIX::FIELD::CommType, value ); }
+      void setRule80A( char value )
+      { setChar( FIX::FIELD::Rule80A, value ); }
+      void setForexReq( bool value )
+      { setBool( FIX::FIELD::ForexReq, value ); }
+      void setSettlCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlCurrency, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setFutSettDate2( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate2, value ); }
+      void setOrderQty2( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderQty2, value ); }
+      void setOpenClose( char value )
+      { setChar( FIX::FIELD::OpenClose, value ); }
+      void setCoveredOrUncovered( int value )
+      { setInt( FIX::FIELD::CoveredOrUncovered, value ); }
+      void setCustomerOrFirm( int value )
+      { setInt( FIX::FIELD::CustomerOrFirm, value ); }
+      void setMaxShow( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MaxShow, value ); }
+      void setPegDifference( double value )
+      { setDouble( FIX::FIELD::PegDifference, value ); }
+    };
   };
 
 }
@@ -46,13 +46,89 @@ namespace FIX41
       FIELD_SET(*this, FIX::SecurityExchange);
       FIELD_SET(*this, FIX::Issuer);
       FIELD_SET(*this, FIX::SecurityDesc);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::RelatdSym);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::IDSource);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDay);
+        FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+      };
     };
+    FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+    { return FIX::GroupView<NoRelatedSym::View>( *this, FIX::FIELD::NoRelatedSym ); }
     FIELD_SET(*this, FIX::LinesOfText);
     class LinesOfText: public FIX::Group
     {
     public:
     LinesOfText() : FIX::Group(33,58,FIX::message_order(58,0)) {}
       FIELD_SET(*this, FIX::Text);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Text);
+      };
+    };
+    FIX::GroupView<LinesOfText::View> linesOfText() const
+    { return FIX::GroupView<LinesOfText::View>( *this, FIX::FIELD::LinesOfText ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView origTime() const
+      { return getString( FIX::FIELD::OrigTime ); }
+      FIX::Urgency urgency() const
+      { return FIX::Urgency( getChar( FIX::FIELD::Urgency ) ); }
+      FIX::StringView headline() const
+      { return getString( FIX::FIELD::Headline ); }
+      FIX::StringView uRLLink() const
+      { return getString( FIX::FIELD::URLLink ); }
+      int rawDataLength() const
+      { return getInt( FIX::FIELD::RawDataLength ); }
+      FIX::StringView rawData() const
+      { return getString( FIX::FIELD::RawData ); }
+      int noRelatedSym() const
+      { return getInt( FIX::FIELD::NoRelatedSym ); }
+      int linesOfText() const
+      { return getInt( FIX::FIELD::LinesOfText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "B" ) {}
+      void setOrigTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrigTime, value ); }
+      void setOrigTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::OrigTime, value, precision ); }
+      void setUrgency( char value )
+      { setChar( FIX::FIELD::Urgency, value ); }
+      void setHeadline( const FIX::StringView& value )
+      { setString( FIX::FIELD::Headline, value ); }
+      void setURLLink( const FIX::StringView& value )
+      { setString( FIX::FIELD::URLLink, value ); }
+      void setRawDataLength( int value )
+      { setInt( FIX::FIELD::RawDataLength, value ); }
+      void setRawData( const FIX::StringView& value )
+      { setString( FIX::FIELD::RawData, value ); }
+      void setNoRelatedSym( int value )
+      { setInt( FIX::FIELD::NoRelatedSym, value ); }
+      void setLinesOfText( int value )
+      { setInt( FIX::FIELD::LinesOfText, value ); }
     };
   };
 
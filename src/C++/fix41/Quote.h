@@ -53,6 +53,140 @@ namespace FIX41
     FIELD_SET(*this, FIX::OrdType);
     FIELD_SET(*this, FIX::FutSettDate2);
     FIELD_SET(*this, FIX::OrderQty2);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView quoteReqID() const
+      { return getString( FIX::FIELD::QuoteReqID ); }
+      FIX::StringView quoteID() const
+      { return getString( FIX::FIELD::QuoteID ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDay() const
+      { return getString( FIX::FIELD::MaturityDay ); }
+      int putOrCall() const
+      { return getInt( FIX::FIELD::PutOrCall ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      FIX::Decimal bidPx() const
+      { return getDecimal( FIX::FIELD::BidPx ); }
+      FIX::Decimal offerPx() const
+      { return getDecimal( FIX::FIELD::OfferPx ); }
+      FIX::Decimal bidSize() const
+      { return getDecimal( FIX::FIELD::BidSize ); }
+      FIX::Decimal offerSize() const
+      { return getDecimal( FIX::FIELD::OfferSize ); }
+      FIX::StringView validUntilTime() const
+      { return getString( FIX::FIELD::ValidUntilTime ); }
+      FIX::Decimal bidSpotRate() const
+      { return getDecimal( FIX::FIELD::BidSpotRate ); }
+      FIX::Decimal offerSpotRate() const
+      { return getDecimal( FIX::FIELD::OfferSpotRate ); }
+      double bidForwardPoints() const
+      { return getDouble( FIX::FIELD::BidForwardPoints ); }
+      double offerForwardPoints() const
+      { return getDouble( FIX::FIELD::OfferForwardPoints ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      FIX::StringView futSettDate() const
+      { return getString( FIX::FIELD::FutSettDate ); }
+      FIX::OrdType ordType() const
+      { return FIX::OrdType( getChar( FIX::FIELD::OrdType ) ); }
+      FIX::StringView futSettDate2() const
+      { return getString( FIX::FIELD::FutSettDate2 ); }
+      FIX::Decimal orderQty2() const
+      { return getDecimal( FIX::FIELD::OrderQty2 ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "S" ) {}
+      void setQuoteReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteReqID, value ); }
+      void setQuoteID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteID, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDay( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDay, value ); }
+      void setPutOrCall( int value )
+      { setInt( FIX::FIELD::PutOrCall, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setBidPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::BidPx, value ); }
+      void setOfferPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OfferPx, value ); }
+      void setBidSize( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::BidSize, value ); }
+      void setOfferSize( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OfferSize, value ); }
+      void setValidUntilTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::ValidUntilTime, value ); }
+      void setValidUntilTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::ValidUntilTime, value, precision ); }
+      void setBidSpotRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::BidSpotRate, value ); }
+      void setOfferSpotRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OfferSpotRate, value ); }
+      void setBidForwardPoints( double value )
+      { setDouble( FIX::FIELD::BidForwardPoints, value ); }
+      void setOfferForwardPoints( double value )
+      { setDouble( FIX::FIELD::OfferForwardPoints, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setFutSettDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate, value ); }
+      void setOrdType( char value )
+      { setChar( FIX::FIELD::OrdType, value ); }
+      void setFutSettDate2( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate2, value ); }
+      void setOrderQty2( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderQty2, value ); }
+    };
   };
 
 }
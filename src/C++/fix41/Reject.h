@@ -24,6 +24,28 @@ namespace FIX41
 
     FIELD_SET(*this, FIX::RefSeqNum);
     FIELD_SET(*this, FIX::Text);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      int refSeqNum() const
+      { return getInt( FIX::FIELD::RefSeqNum ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "3" ) {}
+      void setRefSeqNum( int value )
+      { setInt( FIX::FIELD::RefSeqNum, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+    };
   };
 
 }
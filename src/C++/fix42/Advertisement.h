@@ -64,6 +64,158 @@ namespace FIX42
     FIELD_SET(*this, FIX::URLLink);
     FIELD_SET(*this, FIX::LastMkt);
     FIELD_SET(*this, FIX::TradingSessionID);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView advId() const
+      { return getString( FIX::FIELD::AdvId ); }
+      FIX::StringView advTransType() const
+      { return getString( FIX::FIELD::AdvTransType ); }
+      FIX::StringView advRefID() const
+      { return getString( FIX::FIELD::AdvRefID ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDay() const
+      { return getString( FIX::FIELD::MaturityDay ); }
+      int putOrCall() const
+      { return getInt( FIX::FIELD::PutOrCall ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      FIX::AdvSide advSide() const
+      { return FIX::AdvSide( getChar( FIX::FIELD::AdvSide ) ); }
+      FIX::Decimal shares() const
+      { return getDecimal( FIX::FIELD::Shares ); }
+      FIX::Decimal price() const
+      { return getDecimal( FIX::FIELD::Price ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      FIX::StringView uRLLink() const
+      { return getString( FIX::FIELD::URLLink ); }
+      FIX::StringView lastMkt() const
+      { return getString( FIX::FIELD::LastMkt ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "7" ) {}
+      void setAdvId( const FIX::StringView& value )
+      { setString( FIX::FIELD::AdvId, value ); }
+      void setAdvTransType( const FIX::StringView& value )
+      { setString( FIX::FIELD::AdvTransType, value ); }
+      void setAdvRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AdvRefID, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDay( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDay, value ); }
+      void setPutOrCall( int value )
+      { setInt( FIX::FIELD::PutOrCall, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setAdvSide( char value )
+      { setChar( FIX::FIELD::AdvSide, value ); }
+      void setShares( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Shares, value ); }
+      void setPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Price, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setURLLink( const FIX::StringView& value )
+      { setString( FIX::FIELD::URLLink, value ); }
+      void setLastMkt( const FIX::StringView& value )
+      { setString( FIX::FIELD::LastMkt, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+    };
   };
 
 }
@@ -87,7 +87,19 @@ namespace FIX42
       FIELD_SET(*this, FIX::SecondaryOrderID);
       FIELD_SET(*this, FIX::ListID);
       FIELD_SET(*this, FIX::WaveNo);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::OrderID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryOrderID);
+        FIELD_VIEW(*m_pMap, FIX::ListID);
+        FIELD_VIEW(*m_pMap, FIX::WaveNo);
+      };
     };
+    FIX::GroupView<NoOrders::View> noOrders() const
+    { return FIX::GroupView<NoOrders::View>( *this, FIX::FIELD::NoOrders ); }
     FIELD_SET(*this, FIX::NoExecs);
     class NoExecs: public FIX::Group
     {
@@ -97,7 +109,18 @@ namespace FIX42
       FIELD_SET(*this, FIX::ExecID);
       FIELD_SET(*this, FIX::LastPx);
       FIELD_SET(*this, FIX::LastCapacity);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::LastShares);
+        FIELD_VIEW(*m_pMap, FIX::ExecID);
+        FIELD_VIEW(*m_pMap, FIX::LastPx);
+        FIELD_VIEW(*m_pMap, FIX::LastCapacity);
+      };
     };
+    FIX::GroupView<NoExecs::View> noExecs() const
+    { return FIX::GroupView<NoExecs::View>( *this, FIX::FIELD::NoExecs ); }
     FIELD_SET(*this, FIX::NoAllocs);
     class NoAllocs: public FIX::Group
     {
@@ -133,8 +156,250 @@ namespace FIX42
         FIELD_SET(*this, FIX::MiscFeeAmt);
         FIELD_SET(*this, FIX::MiscFeeCurr);
         FIELD_SET(*this, FIX::MiscFeeType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::MiscFeeAmt);
+          FIELD_VIEW(*m_pMap, FIX::MiscFeeCurr);
+          FIELD_VIEW(*m_pMap, FIX::MiscFeeType);
+        };
+      };
+      FIX::GroupView<NoMiscFees::View> noMiscFees() const
+      { return FIX::GroupView<NoMiscFees::View>( *this, FIX::FIELD::NoMiscFees ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::AllocAccount);
+        FIELD_VIEW(*m_pMap, FIX::AllocPrice);
+        FIELD_VIEW(*m_pMap, FIX::AllocShares);
+        FIELD_VIEW(*m_pMap, FIX::ProcessCode);
+        FIELD_VIEW(*m_pMap, FIX::BrokerOfCredit);
+        FIELD_VIEW(*m_pMap, FIX::NotifyBrokerOfCredit);
+        FIELD_VIEW(*m_pMap, FIX::AllocHandlInst);
+        FIELD_VIEW(*m_pMap, FIX::AllocText);
+        FIELD_VIEW(*m_pMap, FIX::EncodedAllocTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedAllocText);
+        FIELD_VIEW(*m_pMap, FIX::ExecBroker);
+        FIELD_VIEW(*m_pMap, FIX::ClientID);
+        FIELD_VIEW(*m_pMap, FIX::Commission);
+        FIELD_VIEW(*m_pMap, FIX::CommType);
+        FIELD_VIEW(*m_pMap, FIX::AllocAvgPx);
+        FIELD_VIEW(*m_pMap, FIX::AllocNetMoney);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrAmt);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrency);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrFxRate);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrFxRateCalc);
+        FIELD_VIEW(*m_pMap, FIX::AccruedInterestAmt);
+        FIELD_VIEW(*m_pMap, FIX::SettlInstMode);
+        FIELD_VIEW(*m_pMap, FIX::NoMiscFees);
+        FIX::GroupView<NoMiscFees::View> noMiscFees() const
+        { return FIX::GroupView<NoMiscFees::View>( *m_pMap, FIX::FIELD::NoMiscFees ); }
       };
     };
+    FIX::GroupView<NoAllocs::View> noAllocs() const
+    { return FIX::GroupView<NoAllocs::View>( *this, FIX::FIELD::NoAllocs ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView allocID() const
+      { return getString( FIX::FIELD::AllocID ); }
+      FIX::AllocTransType allocTransType() const
+      { return FIX::AllocTransType( getChar( FIX::FIELD::AllocTransType ) ); }
+      FIX::StringView refAllocID() const
+      { return getString( FIX::FIELD::RefAllocID ); }
+      FIX::StringView allocLinkID() const
+      { return getString( FIX::FIELD::AllocLinkID ); }
+      int allocLinkType() const
+      { return getInt( FIX::FIELD::AllocLinkType ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDay() const
+      { return getString( FIX::FIELD::MaturityDay ); }
+      int putOrCall() const
+      { return getInt( FIX::FIELD::PutOrCall ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      FIX::Decimal shares() const
+      { return getDecimal( FIX::FIELD::Shares ); }
+      FIX::StringView lastMkt() const
+      { return getString( FIX::FIELD::LastMkt ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::Decimal avgPx() const
+      { return getDecimal( FIX::FIELD::AvgPx ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      int avgPrxPrecision() const
+      { return getInt( FIX::FIELD::AvgPrxPrecision ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      FIX::SettlmntTyp settlmntTyp() const
+      { return FIX::SettlmntTyp( getChar( FIX::FIELD::SettlmntTyp ) ); }
+      FIX::StringView futSettDate() const
+      { return getString( FIX::FIELD::FutSettDate ); }
+      FIX::Decimal grossTradeAmt() const
+      { return getDecimal( FIX::FIELD::GrossTradeAmt ); }
+      FIX::Decimal netMoney() const
+      { return getDecimal( FIX::FIELD::NetMoney ); }
+      FIX::OpenClose openClose() const
+      { return FIX::OpenClose( getChar( FIX::FIELD::OpenClose ) ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      int numDaysInterest() const
+      { return getInt( FIX::FIELD::NumDaysInterest ); }
+      FIX::Decimal accruedInterestRate() const
+      { return getDecimal( FIX::FIELD::AccruedInterestRate ); }
+      int noOrders() const
+      { return getInt( FIX::FIELD::NoOrders ); }
+      int noExecs() const
+      { return getInt( FIX::FIELD::NoExecs ); }
+      int noAllocs() const
+      { return getInt( FIX::FIELD::NoAllocs ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "J" ) {}
+      void setAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocID, value ); }
+      void setAllocTransType( char value )
+      { setChar( FIX::FIELD::AllocTransType, value ); }
+      void setRefAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RefAllocID, value ); }
+      void setAllocLinkID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocLinkID, value ); }
+      void setAllocLinkType( int value )
+      { setInt( FIX::FIELD::AllocLinkType, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDay( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDay, value ); }
+      void setPutOrCall( int value )
+      { setInt( FIX::FIELD::PutOrCall, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setShares( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Shares, value ); }
+      void setLastMkt( const FIX::StringView& value )
+      { setString( FIX::FIELD::LastMkt, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setAvgPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AvgPx, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setAvgPrxPrecision( int value )
+      { setInt( FIX::FIELD::AvgPrxPrecision, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setSettlmntTyp( char value )
+      { setChar( FIX::FIELD::SettlmntTyp, value ); }
+      void setFutSettDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate, value ); }
+      void setGrossTradeAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::GrossTradeAmt, value ); }
+      void setNetMoney( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::NetMoney, value ); }
+      void setOpenClose( char value )
+      { setChar( FIX::FIELD::OpenClose, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setNumDaysInterest( int value )
+      { setInt( FIX::FIELD::NumDaysInterest, value ); }
+      void setAccruedInterestRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AccruedInterestRate, value ); }
+      void setNoOrders( int value )
+      { setInt( FIX::FIELD::NoOrders, value ); }
+      void setNoExecs( int value )
+      { setInt( FIX::FIELD::NoExecs, value ); }
+      void setNoAllocs( int value )
+      { setInt( FIX::FIELD::NoAllocs, value ); }
+    };
   };
 
 }
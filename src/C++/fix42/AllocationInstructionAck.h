@@ -36,6 +36,62 @@ namespace FIX42
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView clientID() const
+      { return getString( FIX::FIELD::ClientID ); }
+      FIX::StringView execBroker() const
+      { return getString( FIX::FIELD::ExecBroker ); }
+      FIX::StringView allocID() const
+      { return getString( FIX::FIELD::AllocID ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      int allocStatus() const
+      { return getInt( FIX::FIELD::AllocStatus ); }
+      int allocRejCode() const
+      { return getInt( FIX::FIELD::AllocRejCode ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "P" ) {}
+      void setClientID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClientID, value ); }
+      void setExecBroker( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecBroker, value ); }
+      void setAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocID, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setAllocStatus( int value )
+      { setInt( FIX::FIELD::AllocStatus, value ); }
+      void setAllocRejCode( int value )
+      { setInt( FIX::FIELD::AllocRejCode, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+    };
   };
 
 }
@@ -37,6 +37,54 @@ namespace FIX42
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Commission);
+        FIELD_VIEW(*m_pMap, FIX::CommType);
+        FIELD_VIEW(*m_pMap, FIX::ListID);
+        FIELD_VIEW(*m_pMap, FIX::Country);
+        FIELD_VIEW(*m_pMap, FIX::Side);
+        FIELD_VIEW(*m_pMap, FIX::Price);
+        FIELD_VIEW(*m_pMap, FIX::PriceType);
+        FIELD_VIEW(*m_pMap, FIX::FairValue);
+        FIELD_VIEW(*m_pMap, FIX::NetGrossInd);
+        FIELD_VIEW(*m_pMap, FIX::SettlmntTyp);
+        FIELD_VIEW(*m_pMap, FIX::FutSettDate);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+      };
+    };
+    FIX::GroupView<NoBidComponents::View> noBidComponents() const
+    { return FIX::GroupView<NoBidComponents::View>( *this, FIX::FIELD::NoBidComponents ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView bidID() const
+      { return getString( FIX::FIELD::BidID ); }
+      FIX::StringView clientBidID() const
+      { return getString( FIX::FIELD::ClientBidID ); }
+      int noBidComponents() const
+      { return getInt( FIX::FIELD::NoBidComponents ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "l" ) {}
+      void setBidID( const FIX::StringView& value )
+      { setString( FIX::FIELD::BidID, value ); }
+      void setClientBidID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClientBidID, value ); }
+      void setNoBidComponents( int value )
+      { setInt( FIX::FIELD::NoBidComponents, value ); }
     };
   };
 
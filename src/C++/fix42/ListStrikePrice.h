@@ -58,6 +58,66 @@ namespace FIX42
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::IDSource);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDay);
+        FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::PrevClosePx);
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::Side);
+        FIELD_VIEW(*m_pMap, FIX::Price);
+        FIELD_VIEW(*m_pMap, FIX::Currency);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+      };
+    };
+    FIX::GroupView<NoStrikes::View> noStrikes() const
+    { return FIX::GroupView<NoStrikes::View>( *this, FIX::FIELD::NoStrikes ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView listID() const
+      { return getString( FIX::FIELD::ListID ); }
+      int totNoStrikes() const
+      { return getInt( FIX::FIELD::TotNoStrikes ); }
+      int noStrikes() const
+      { return getInt( FIX::FIELD::NoStrikes ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "m" ) {}
+      void setListID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListID, value ); }
+      void setTotNoStrikes( int value )
+      { setInt( FIX::FIELD::TotNoStrikes, value ); }
+      void setNoStrikes( int value )
+      { setInt( FIX::FIELD::NoStrikes, value ); }
     };
   };
 
@@ -77,6 +77,91 @@ namespace FIX42
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::MDUpdateAction);
+        FIELD_VIEW(*m_pMap, FIX::DeleteReason);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryType);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryID);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryRefID);
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::IDSource);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDay);
+        FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::FinancialStatus);
+        FIELD_VIEW(*m_pMap, FIX::CorporateAction);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryPx);
+        FIELD_VIEW(*m_pMap, FIX::Currency);
+        FIELD_VIEW(*m_pMap, FIX::MDEntrySize);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryDate);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryTime);
+        FIELD_VIEW(*m_pMap, FIX::TickDirection);
+        FIELD_VIEW(*m_pMap, FIX::MDMkt);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::QuoteCondition);
+        FIELD_VIEW(*m_pMap, FIX::TradeCondition);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryOriginator);
+        FIELD_VIEW(*m_pMap, FIX::LocationID);
+        FIELD_VIEW(*m_pMap, FIX::DeskID);
+        FIELD_VIEW(*m_pMap, FIX::OpenCloseSettleFlag);
+        FIELD_VIEW(*m_pMap, FIX::TimeInForce);
+        FIELD_VIEW(*m_pMap, FIX::ExpireDate);
+        FIELD_VIEW(*m_pMap, FIX::ExpireTime);
+        FIELD_VIEW(*m_pMap, FIX::MinQty);
+        FIELD_VIEW(*m_pMap, FIX::ExecInst);
+        FIELD_VIEW(*m_pMap, FIX::SellerDays);
+        FIELD_VIEW(*m_pMap, FIX::OrderID);
+        FIELD_VIEW(*m_pMap, FIX::QuoteEntryID);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryBuyer);
+        FIELD_VIEW(*m_pMap, FIX::MDEntrySeller);
+        FIELD_VIEW(*m_pMap, FIX::NumberOfOrders);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryPositionNo);
+        FIELD_VIEW(*m_pMap, FIX::TotalVolumeTraded);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+      };
+    };
+    FIX::GroupView<NoMDEntries::View> noMDEntries() const
+    { return FIX::GroupView<NoMDEntries::View>( *this, FIX::FIELD::NoMDEntries ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView mDReqID() const
+      { return getString( FIX::FIELD::MDReqID ); }
+      int noMDEntries() const
+      { return getInt( FIX::FIELD::NoMDEntries ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "X" ) {}
+      void setMDReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MDReqID, value ); }
+      void setNoMDEntries( int value )
+      { setInt( FIX::FIELD::NoMDEntries, value ); }
     };
   };
 
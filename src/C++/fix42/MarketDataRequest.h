@@ -37,7 +37,15 @@ namespace FIX42
     public:
     NoMDEntryTypes() : FIX::Group(267,269,FIX::message_order(269,0)) {}
       FIELD_SET(*this, FIX::MDEntryType);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::MDEntryType);
+      };
     };
+    FIX::GroupView<NoMDEntryTypes::View> noMDEntryTypes() const
+    { return FIX::GroupView<NoMDEntryTypes::View>( *this, FIX::FIELD::NoMDEntryTypes ); }
     FIELD_SET(*this, FIX::NoRelatedSym);
     class NoRelatedSym: public FIX::Group
     {
@@ -63,6 +71,75 @@ namespace FIX42
       FIELD_SET(*this, FIX::EncodedSecurityDescLen);
       FIELD_SET(*this, FIX::EncodedSecurityDesc);
       FIELD_SET(*this, FIX::TradingSessionID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::IDSource);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDay);
+        FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+      };
+    };
+    FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+    { return FIX::GroupView<NoRelatedSym::View>( *this, FIX::FIELD::NoRelatedSym ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView mDReqID() const
+      { return getString( FIX::FIELD::MDReqID ); }
+      FIX::SubscriptionRequestType subscriptionRequestType() const
+      { return FIX::SubscriptionRequestType( getChar( FIX::FIELD::SubscriptionRequestType ) ); }
+      int marketDepth() const
+      { return getInt( FIX::FIELD::MarketDepth ); }
+      int mDUpdateType() const
+      { return getInt( FIX::FIELD::MDUpdateType ); }
+      bool aggregatedBook() const
+      { return getBool( FIX::FIELD::AggregatedBook ); }
+      int noMDEntryTypes() const
+      { return getInt( FIX::FIELD::NoMDEntryTypes ); }
+      int noRelatedSym() const
+      { return getInt( FIX::FIELD::NoRelatedSym ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "V" ) {}
+      void setMDReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MDReqID, value ); }
+      void setSubscriptionRequestType( char value )
+      { setChar( FIX::FIELD::SubscriptionRequestType, value ); }
+      void setMarketDepth( int value )
+      { setInt( FIX::FIELD::MarketDepth, value ); }
+      void setMDUpdateType( int value )
+      { setInt( FIX::FIELD::MDUpdateType, value ); }
+      void setAggregatedBook( bool value )
+      { setBool( FIX::FIELD::AggregatedBook, value ); }
+      void setNoMDEntryTypes( int value )
+      { setInt( FIX::FIELD::NoMDEntryTypes, value ); }
+      void setNoRelatedSym( int value )
+      { setInt( FIX::FIELD::NoRelatedSym, value ); }
     };
   };
 
@@ -80,6 +80,153 @@ namespace FIX42
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::MDEntryType);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryPx);
+        FIELD_VIEW(*m_pMap, FIX::Currency);
+        FIELD_VIEW(*m_pMap, FIX::MDEntrySize);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryDate);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryTime);
+        FIELD_VIEW(*m_pMap, FIX::TickDirection);
+        FIELD_VIEW(*m_pMap, FIX::MDMkt);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::QuoteCondition);
+        FIELD_VIEW(*m_pMap, FIX::TradeCondition);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryOriginator);
+        FIELD_VIEW(*m_pMap, FIX::LocationID);
+        FIELD_VIEW(*m_pMap, FIX::DeskID);
+        FIELD_VIEW(*m_pMap, FIX::OpenCloseSettleFlag);
+        FIELD_VIEW(*m_pMap, FIX::TimeInForce);
+        FIELD_VIEW(*m_pMap, FIX::ExpireDate);
+        FIELD_VIEW(*m_pMap, FIX::ExpireTime);
+        FIELD_VIEW(*m_pMap, FIX::MinQty);
+        FIELD_VIEW(*m_pMap, FIX::ExecInst);
+        FIELD_VIEW(*m_pMap, FIX::SellerDays);
+        FIELD_VIEW(*m_pMap, FIX::OrderID);
+        FIELD_VIEW(*m_pMap, FIX::QuoteEntryID);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryBuyer);
+        FIELD_VIEW(*m_pMap, FIX::MDEntrySeller);
+        FIELD_VIEW(*m_pMap, FIX::NumberOfOrders);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryPositionNo);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+      };
+    };
+    FIX::GroupView<NoMDEntries::View> noMDEntries() const
+    { return FIX::GroupView<NoMDEntries::View>( *this, FIX::FIELD::NoMDEntries ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView mDReqID() const
+      { return getString( FIX::FIELD::MDReqID ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDay() const
+      { return getString( FIX::FIELD::MaturityDay ); }
+      int putOrCall() const
+      { return getInt( FIX::FIELD::PutOrCall ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      FIX::StringView financialStatus() const
+      { return getString( FIX::FIELD::FinancialStatus ); }
+      FIX::StringView corporateAction() const
+      { return getString( FIX::FIELD::CorporateAction ); }
+      FIX::Decimal totalVolumeTraded() const
+      { return getDecimal( FIX::FIELD::TotalVolumeTraded ); }
+      int noMDEntries() const
+      { return getInt( FIX::FIELD::NoMDEntries ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "W" ) {}
+      void setMDReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MDReqID, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDay( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDay, value ); }
+      void setPutOrCall( int value )
+      { setInt( FIX::FIELD::PutOrCall, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setFinancialStatus( const FIX::StringView& value )
+      { setString( FIX::FIELD::FinancialStatus, value ); }
+      void setCorporateAction( const FIX::StringView& value )
+      { setString( FIX::FIELD::CorporateAction, value ); }
+      void setTotalVolumeTraded( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::TotalVolumeTraded, value ); }
+      void setNoMDEntries( int value )
+      { setInt( FIX::FIELD::NoMDEntries, value ); }
     };
   };
 
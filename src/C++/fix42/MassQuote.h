@@ -95,7 +95,120 @@ namespace FIX42
         FIELD_SET(*this, FIX::FutSettDate2);
         FIELD_SET(*this, FIX::OrderQty2);
         FIELD_SET(*this, FIX::Currency);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::QuoteEntryID);
+          FIELD_VIEW(*m_pMap, FIX::Symbol);
+          FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+          FIELD_VIEW(*m_pMap, FIX::SecurityID);
+          FIELD_VIEW(*m_pMap, FIX::IDSource);
+          FIELD_VIEW(*m_pMap, FIX::SecurityType);
+          FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+          FIELD_VIEW(*m_pMap, FIX::MaturityDay);
+          FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+          FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+          FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+          FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::CouponRate);
+          FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+          FIELD_VIEW(*m_pMap, FIX::Issuer);
+          FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+          FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::BidPx);
+          FIELD_VIEW(*m_pMap, FIX::OfferPx);
+          FIELD_VIEW(*m_pMap, FIX::BidSize);
+          FIELD_VIEW(*m_pMap, FIX::OfferSize);
+          FIELD_VIEW(*m_pMap, FIX::ValidUntilTime);
+          FIELD_VIEW(*m_pMap, FIX::BidSpotRate);
+          FIELD_VIEW(*m_pMap, FIX::OfferSpotRate);
+          FIELD_VIEW(*m_pMap, FIX::BidForwardPoints);
+          FIELD_VIEW(*m_pMap, FIX::OfferForwardPoints);
+          FIELD_VIEW(*m_pMap, FIX::TransactTime);
+          FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+          FIELD_VIEW(*m_pMap, FIX::FutSettDate);
+          FIELD_VIEW(*m_pMap, FIX::OrdType);
+          FIELD_VIEW(*m_pMap, FIX::FutSettDate2);
+          FIELD_VIEW(*m_pMap, FIX::OrderQty2);
+          FIELD_VIEW(*m_pMap, FIX::Currency);
+        };
       };
+      FIX::GroupView<NoQuoteEntries::View> noQuoteEntries() const
+      { return FIX::GroupView<NoQuoteEntries::View>( *this, FIX::FIELD::NoQuoteEntries ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::QuoteSetID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbol);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingIDSource);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityDay);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingPutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingOptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponRate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingIssuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuer);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::QuoteSetValidUntilTime);
+        FIELD_VIEW(*m_pMap, FIX::TotQuoteEntries);
+        FIELD_VIEW(*m_pMap, FIX::NoQuoteEntries);
+        FIX::GroupView<NoQuoteEntries::View> noQuoteEntries() const
+        { return FIX::GroupView<NoQuoteEntries::View>( *m_pMap, FIX::FIELD::NoQuoteEntries ); }
+      };
+    };
+    FIX::GroupView<NoQuoteSets::View> noQuoteSets() const
+    { return FIX::GroupView<NoQuoteSets::View>( *this, FIX::FIELD::NoQuoteSets ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView quoteReqID() const
+      { return getString( FIX::FIELD::QuoteReqID ); }
+      FIX::StringView quoteID() const
+      { return getString( FIX::FIELD::QuoteID ); }
+      int quoteResponseLevel() const
+      { return getInt( FIX::FIELD::QuoteResponseLevel ); }
+      FIX::Decimal defBidSize() const
+      { return getDecimal( FIX::FIELD::DefBidSize ); }
+      FIX::Decimal defOfferSize() const
+      { return getDecimal( FIX::FIELD::DefOfferSize ); }
+      int noQuoteSets() const
+      { return getInt( FIX::FIELD::NoQuoteSets ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "i" ) {}
+      void setQuoteReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteReqID, value ); }
+      void setQuoteID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteID, value ); }
+      void setQuoteResponseLevel( int value )
+      { setInt( FIX::FIELD::QuoteResponseLevel, value ); }
+      void setDefBidSize( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DefBidSize, value ); }
+      void setDefOfferSize( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DefOfferSize, value ); }
+      void setNoQuoteSets( int value )
+      { setInt( FIX::FIELD::NoQuoteSets, value ); }
     };
   };
 
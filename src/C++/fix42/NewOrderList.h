@@ -121,14 +121,178 @@ namespace FIX42
       NoAllocs() : FIX::Group(78,79,FIX::message_order(79,80,0)) {}
         FIELD_SET(*this, FIX::AllocAccount);
         FIELD_SET(*this, FIX::AllocShares);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::AllocAccount);
+          FIELD_VIEW(*m_pMap, FIX::AllocShares);
+        };
       };
+      FIX::GroupView<NoAllocs::View> noAllocs() const
+      { return FIX::GroupView<NoAllocs::View>( *this, FIX::FIELD::NoAllocs ); }
       FIELD_SET(*this, FIX::NoTradingSessions);
       class NoTradingSessions: public FIX::Group
       {
       public:
       NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,0)) {}
         FIELD_SET(*this, FIX::TradingSessionID);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        };
       };
+      FIX::GroupView<NoTradingSessions::View> noTradingSessions() const
+      { return FIX::GroupView<NoTradingSessions::View>( *this, FIX::FIELD::NoTradingSessions ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::ListSeqNo);
+        FIELD_VIEW(*m_pMap, FIX::SettlInstMode);
+        FIELD_VIEW(*m_pMap, FIX::ClientID);
+        FIELD_VIEW(*m_pMap, FIX::ExecBroker);
+        FIELD_VIEW(*m_pMap, FIX::Account);
+        FIELD_VIEW(*m_pMap, FIX::SettlmntTyp);
+        FIELD_VIEW(*m_pMap, FIX::FutSettDate);
+        FIELD_VIEW(*m_pMap, FIX::HandlInst);
+        FIELD_VIEW(*m_pMap, FIX::ExecInst);
+        FIELD_VIEW(*m_pMap, FIX::MinQty);
+        FIELD_VIEW(*m_pMap, FIX::MaxFloor);
+        FIELD_VIEW(*m_pMap, FIX::ExDestination);
+        FIELD_VIEW(*m_pMap, FIX::ProcessCode);
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::IDSource);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDay);
+        FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::PrevClosePx);
+        FIELD_VIEW(*m_pMap, FIX::Side);
+        FIELD_VIEW(*m_pMap, FIX::SideValueInd);
+        FIELD_VIEW(*m_pMap, FIX::LocateReqd);
+        FIELD_VIEW(*m_pMap, FIX::TransactTime);
+        FIELD_VIEW(*m_pMap, FIX::OrderQty);
+        FIELD_VIEW(*m_pMap, FIX::CashOrderQty);
+        FIELD_VIEW(*m_pMap, FIX::OrdType);
+        FIELD_VIEW(*m_pMap, FIX::Price);
+        FIELD_VIEW(*m_pMap, FIX::StopPx);
+        FIELD_VIEW(*m_pMap, FIX::Currency);
+        FIELD_VIEW(*m_pMap, FIX::ComplianceID);
+        FIELD_VIEW(*m_pMap, FIX::SolicitedFlag);
+        FIELD_VIEW(*m_pMap, FIX::IOIid);
+        FIELD_VIEW(*m_pMap, FIX::QuoteID);
+        FIELD_VIEW(*m_pMap, FIX::TimeInForce);
+        FIELD_VIEW(*m_pMap, FIX::EffectiveTime);
+        FIELD_VIEW(*m_pMap, FIX::ExpireDate);
+        FIELD_VIEW(*m_pMap, FIX::ExpireTime);
+        FIELD_VIEW(*m_pMap, FIX::GTBookingInst);
+        FIELD_VIEW(*m_pMap, FIX::Commission);
+        FIELD_VIEW(*m_pMap, FIX::CommType);
+        FIELD_VIEW(*m_pMap, FIX::Rule80A);
+        FIELD_VIEW(*m_pMap, FIX::ForexReq);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrency);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+        FIELD_VIEW(*m_pMap, FIX::FutSettDate2);
+        FIELD_VIEW(*m_pMap, FIX::OrderQty2);
+        FIELD_VIEW(*m_pMap, FIX::OpenClose);
+        FIELD_VIEW(*m_pMap, FIX::CoveredOrUncovered);
+        FIELD_VIEW(*m_pMap, FIX::CustomerOrFirm);
+        FIELD_VIEW(*m_pMap, FIX::MaxShow);
+        FIELD_VIEW(*m_pMap, FIX::PegDifference);
+        FIELD_VIEW(*m_pMap, FIX::DiscretionInst);
+        FIELD_VIEW(*m_pMap, FIX::DiscretionOffset);
+        FIELD_VIEW(*m_pMap, FIX::ClearingFirm);
+        FIELD_VIEW(*m_pMap, FIX::ClearingAccount);
+        FIELD_VIEW(*m_pMap, FIX::NoAllocs);
+        FIELD_VIEW(*m_pMap, FIX::NoTradingSessions);
+        FIX::GroupView<NoAllocs::View> noAllocs() const
+        { return FIX::GroupView<NoAllocs::View>( *m_pMap, FIX::FIELD::NoAllocs ); }
+        FIX::GroupView<NoTradingSessions::View> noTradingSessions() const
+        { return FIX::GroupView<NoTradingSessions::View>( *m_pMap, FIX::FIELD::NoTradingSessions ); }
+      };
+    };
+    FIX::GroupView<NoOrders::View> noOrders() const
+    { return FIX::GroupView<NoOrders::View>( *this, FIX::FIELD::NoOrders ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView listID() const
+      { return getString( FIX::FIELD::ListID ); }
+      FIX::StringView bidID() const
+      { return getString( FIX::FIELD::BidID ); }
+      FIX::StringView clientBidID() const
+      { return getString( FIX::FIELD::ClientBidID ); }
+      int progRptReqs() const
+      { return getInt( FIX::FIELD::ProgRptReqs ); }
+      int bidType() const
+      { return getInt( FIX::FIELD::BidType ); }
+      int progPeriodInterval() const
+      { return getInt( FIX::FIELD::ProgPeriodInterval ); }
+      FIX::ListExecInstType listExecInstType() const
+      { return FIX::ListExecInstType( getChar( FIX::FIELD::ListExecInstType ) ); }
+      FIX::StringView listExecInst() const
+      { return getString( FIX::FIELD::ListExecInst ); }
+      int encodedListExecInstLen() const
+      { return getInt( FIX::FIELD::EncodedListExecInstLen ); }
+      FIX::StringView encodedListExecInst() const
+      { return getString( FIX::FIELD::EncodedListExecInst ); }
+      int totNoOrders() const
+      { return getInt( FIX::FIELD::TotNoOrders ); }
+      int noOrders() const
+      { return getInt( FIX::FIELD::NoOrders ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "E" ) {}
+      void setListID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListID, value ); }
+      void setBidID( const FIX::StringView& value )
+      { setString( FIX::FIELD::BidID, value ); }
+      void setClientBidID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClientBidID, value ); }
+      void setProgRptReqs( int value )
+      { setInt( FIX::FIELD::ProgRptReqs, value ); }
+      void setBidType( int value )
+      { setInt( FIX::FIELD::BidType, value ); }
+      void setProgPeriodInterval( int value )
+      { setInt( FIX::FIELD::ProgPeriodInterval, value ); }
+      void setListExecInstType( char value )
+      { setChar( FIX::FIELD::ListExecInstType, value ); }
+      void setListExecInst( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListExecInst, value ); }
+      void setEncodedListExecInstLen( int value )
+      { setInt( FIX::FIELD::EncodedListExecInstLen, value ); }
+      void setEncodedListExecInst( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedListExecInst, value ); }
+      void setTotNoOrders( int value )
+      { setInt( FIX::FIELD::TotNoOrders, value ); }
+      void setNoOrders( int value )
+      { setInt( FIX::FIELD::NoOrders, value ); }
     };
   };
 
@@ -37,7 +37,16 @@ namespace FIX42
     NoRoutingIDs() : FIX::Group(215,216,FIX::message_order(216,217,0)) {}
       FIELD_SET(*this, FIX::RoutingType);
       FIELD_SET(*this, FIX::RoutingID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::RoutingType);
+        FIELD_VIEW(*m_pMap, FIX::RoutingID);
+      };
     };
+    FIX::GroupView<NoRoutingIDs::View> noRoutingIDs() const
+    { return FIX::GroupView<NoRoutingIDs::View>( *this, FIX::FIELD::NoRoutingIDs ); }
     FIELD_SET(*this, FIX::NoRelatedSym);
     class NoRelatedSym: public FIX::Group
     {
@@ -62,7 +71,33 @@ namespace FIX42
       FIELD_SET(*this, FIX::SecurityDesc);
       FIELD_SET(*this, FIX::EncodedSecurityDescLen);
       FIELD_SET(*this, FIX::EncodedSecurityDesc);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::RelatdSym);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::IDSource);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDay);
+        FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+      };
     };
+    FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+    { return FIX::GroupView<NoRelatedSym::View>( *this, FIX::FIELD::NoRelatedSym ); }
     FIELD_SET(*this, FIX::LinesOfText);
     class LinesOfText: public FIX::Group
     {
@@ -71,6 +106,76 @@ namespace FIX42
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+      };
+    };
+    FIX::GroupView<LinesOfText::View> linesOfText() const
+    { return FIX::GroupView<LinesOfText::View>( *this, FIX::FIELD::LinesOfText ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView origTime() const
+      { return getString( FIX::FIELD::OrigTime ); }
+      FIX::Urgency urgency() const
+      { return FIX::Urgency( getChar( FIX::FIELD::Urgency ) ); }
+      FIX::StringView headline() const
+      { return getString( FIX::FIELD::Headline ); }
+      int encodedHeadlineLen() const
+      { return getInt( FIX::FIELD::EncodedHeadlineLen ); }
+      FIX::StringView encodedHeadline() const
+      { return getString( FIX::FIELD::EncodedHeadline ); }
+      FIX::StringView uRLLink() const
+      { return getString( FIX::FIELD::URLLink ); }
+      int rawDataLength() const
+      { return getInt( FIX::FIELD::RawDataLength ); }
+      FIX::StringView rawData() const
+      { return getString( FIX::FIELD::RawData ); }
+      int noRoutingIDs() const
+      { return getInt( FIX::FIELD::NoRoutingIDs ); }
+      int noRelatedSym() const
+      { return getInt( FIX::FIELD::NoRelatedSym ); }
+      int linesOfText() const
+      { return getInt( FIX::FIELD::LinesOfText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "B" ) {}
+      void setOrigTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrigTime, value ); }
+      void setOrigTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::OrigTime, value, precision ); }
+      void setUrgency( char value )
+      { setChar( FIX::FIELD::Urgency, value ); }
+      void setHeadline( const FIX::StringView& value )
+      { setString( FIX::FIELD::Headline, value ); }
+      void setEncodedHeadlineLen( int value )
+      { setInt( FIX::FIELD::EncodedHeadlineLen, value ); }
+      void setEncodedHeadline( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedHeadline, value ); }
+      void setURLLink( const FIX::StringView& value )
+      { setString( FIX::FIELD::URLLink, value ); }
+      void setRawDataLength( int value )
+      { setInt( FIX::FIELD::RawDataLength, value ); }
+      void setRawData( const FIX::StringView& value )
+      { setString( FIX::FIELD::RawData, value ); }
+      void setNoRoutingIDs( int value )
+      { setInt( FIX::FIELD::NoRoutingIDs, value ); }
+      void setNoRelatedSym( int value )
+      { setInt( FIX::FIELD::NoRelatedSym, value ); }
+      void setLinesOfText( int value )
+      { setInt( FIX::FIELD::LinesOfText, value ); }
     };
   };
 
@@ -81,6 +81,165 @@ namespace FIX42
       FIELD_SET(*this, FIX::RatioQty);
       FIELD_SET(*this, FIX::Side);
       FIELD_SET(*this, FIX::UnderlyingCurrency);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbol);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingIDSource);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityDay);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingPutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingOptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponRate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingIssuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuer);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::RatioQty);
+        FIELD_VIEW(*m_pMap, FIX::Side);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrency);
+      };
+    };
+    FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+    { return FIX::GroupView<NoRelatedSym::View>( *this, FIX::FIELD::NoRelatedSym ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView securityReqID() const
+      { return getString( FIX::FIELD::SecurityReqID ); }
+      FIX::StringView securityResponseID() const
+      { return getString( FIX::FIELD::SecurityResponseID ); }
+      int securityResponseType() const
+      { return getInt( FIX::FIELD::SecurityResponseType ); }
+      int totalNumSecurities() const
+      { return getInt( FIX::FIELD::TotalNumSecurities ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDay() const
+      { return getString( FIX::FIELD::MaturityDay ); }
+      int putOrCall() const
+      { return getInt( FIX::FIELD::PutOrCall ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      int noRelatedSym() const
+      { return getInt( FIX::FIELD::NoRelatedSym ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "d" ) {}
+      void setSecurityReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityReqID, value ); }
+      void setSecurityResponseID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityResponseID, value ); }
+      void setSecurityResponseType( int value )
+      { setInt( FIX::FIELD::SecurityResponseType, value ); }
+      void setTotalNumSecurities( int value )
+      { setInt( FIX::FIELD::TotalNumSecurities, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDay( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDay, value ); }
+      void setPutOrCall( int value )
+      { setInt( FIX::FIELD::PutOrCall, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setNoRelatedSym( int value )
+      { setInt( FIX::FIELD::NoRelatedSym, value ); }
     };
   };
 
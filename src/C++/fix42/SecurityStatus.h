@@ -58,6 +58,166 @@ namespace FIX42
     FIELD_SET(*this, FIX::LastPx);
     FIELD_SET(*this, FIX::TransactTime);
     FIELD_SET(*this, FIX::Adjustment);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView securityStatusReqID() const
+      { return getString( FIX::FIELD::SecurityStatusReqID ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView iDSource() const
+      { return getString( FIX::FIELD::IDSource ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDay() const
+      { return getString( FIX::FIELD::MaturityDay ); }
+      int putOrCall() const
+      { return getInt( FIX::FIELD::PutOrCall ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      bool unsolicitedIndicator() const
+      { return getBool( FIX::FIELD::UnsolicitedIndicator ); }
+      int securityTradingStatus() const
+      { return getInt( FIX::FIELD::SecurityTradingStatus ); }
+      FIX::StringView financialStatus() const
+      { return getString( FIX::FIELD::FinancialStatus ); }
+      FIX::StringView corporateAction() const
+      { return getString( FIX::FIELD::CorporateAction ); }
+      FIX::HaltReasonChar haltReasonChar() const
+      { return FIX::HaltReasonChar( getChar( FIX::FIELD::HaltReasonChar ) ); }
+      bool inViewOfCommon() const
+      { return getBool( FIX::FIELD::InViewOfCommon ); }
+      bool dueToRelated() const
+      { return getBool( FIX::FIELD::DueToRelated ); }
+      FIX::Decimal buyVolume() const
+      { return getDecimal( FIX::FIELD::BuyVolume ); }
+      FIX::Decimal sellVolume() const
+      { return getDecimal( FIX::FIELD::SellVolume ); }
+      FIX::Decimal highPx() const
+      { return getDecimal( FIX::FIELD::HighPx ); }
+      FIX::Decimal lowPx() const
+      { return getDecimal( FIX::FIELD::LowPx ); }
+      FIX::Decimal lastPx() const
+      { return getDecimal( FIX::FIELD::LastPx ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      int adjustment() const
+      { return getInt( FIX::FIELD::Adjustment ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "f" ) {}
+      void setSecurityStatusReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityStatusReqID, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::IDSource, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDay( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDay, value ); }
+      void setPutOrCall( int value )
+      { setInt( FIX::FIELD::PutOrCall, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setUnsolicitedIndicator( bool value )
+      { setBool( FIX::FIELD::UnsolicitedIndicator, value ); }
+      void setSecurityTradingStatus( int value )
+      { setInt( FIX::FIELD::SecurityTradingStatus, value ); }
+      void setFinancialStatus( const FIX::StringView& value )
+      { setString( FIX::FIELD::FinancialStatus, value ); }
+      void setCorporateAction( const FIX::StringView& value )
+      { setString( FIX::FIELD::CorporateAction, value ); }
+      void setHaltReasonChar( char value )
+      { setChar( FIX::FIELD::HaltReasonChar, value ); }
+      void setInViewOfCommon( bool value )
+      { setBool( FIX::FIELD::InViewOfCommon, value ); }
+      void setDueToRelated( bool value )
+      { setBool( FIX::FIELD::DueToRelated, value ); }
+      void setBuyVolume( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::BuyVolume, value ); }
+      void setSellVolume( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::SellVolume, value ); }
+      void setHighPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::HighPx, value ); }
+      void setLowPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LowPx, value ); }
+      void setLastPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastPx, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setAdjustment( int value )
+      { setInt( FIX::FIELD::Adjustment, value ); }
+    };
   };
 
 }
@@ -70,6 +70,168 @@ namespace FIX42
     FIELD_SET(*this, FIX::CashSettlAgentAcctName);
     FIELD_SET(*this, FIX::CashSettlAgentContactName);
     FIELD_SET(*this, FIX::CashSettlAgentContactPhone);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView settlInstID() const
+      { return getString( FIX::FIELD::SettlInstID ); }
+      FIX::SettlInstTransType settlInstTransType() const
+      { return FIX::SettlInstTransType( getChar( FIX::FIELD::SettlInstTransType ) ); }
+      FIX::StringView settlInstRefID() const
+      { return getString( FIX::FIELD::SettlInstRefID ); }
+      FIX::SettlInstMode settlInstMode() const
+      { return FIX::SettlInstMode( getChar( FIX::FIELD::SettlInstMode ) ); }
+      FIX::SettlInstSource settlInstSource() const
+      { return FIX::SettlInstSource( getChar( FIX::FIELD::SettlInstSource ) ); }
+      FIX::StringView allocAccount() const
+      { return getString( FIX::FIELD::AllocAccount ); }
+      FIX::StringView settlLocation() const
+      { return getString( FIX::FIELD::SettlLocation ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView allocID() const
+      { return getString( FIX::FIELD::AllocID ); }
+      FIX::StringView lastMkt() const
+      { return getString( FIX::FIELD::LastMkt ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView effectiveTime() const
+      { return getString( FIX::FIELD::EffectiveTime ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      FIX::StringView clientID() const
+      { return getString( FIX::FIELD::ClientID ); }
+      FIX::StringView execBroker() const
+      { return getString( FIX::FIELD::ExecBroker ); }
+      int standInstDbType() const
+      { return getInt( FIX::FIELD::StandInstDbType ); }
+      FIX::StringView standInstDbName() const
+      { return getString( FIX::FIELD::StandInstDbName ); }
+      FIX::StringView standInstDbID() const
+      { return getString( FIX::FIELD::StandInstDbID ); }
+      int settlDeliveryType() const
+      { return getInt( FIX::FIELD::SettlDeliveryType ); }
+      FIX::StringView settlDepositoryCode() const
+      { return getString( FIX::FIELD::SettlDepositoryCode ); }
+      FIX::StringView settlBrkrCode() const
+      { return getString( FIX::FIELD::SettlBrkrCode ); }
+      FIX::StringView settlInstCode() const
+      { return getString( FIX::FIELD::SettlInstCode ); }
+      FIX::StringView securitySettlAgentName() const
+      { return getString( FIX::FIELD::SecuritySettlAgentName ); }
+      FIX::StringView securitySettlAgentCode() const
+      { return getString( FIX::FIELD::SecuritySettlAgentCode ); }
+      FIX::StringView securitySettlAgentAcctNum() const
+      { return getString( FIX::FIELD::SecuritySettlAgentAcctNum ); }
+      FIX::StringView securitySettlAgentAcctName() const
+      { return getString( FIX::FIELD::SecuritySettlAgentAcctName ); }
+      FIX::StringView securitySettlAgentContactName() const
+      { return getString( FIX::FIELD::SecuritySettlAgentContactName ); }
+      FIX::StringView securitySettlAgentContactPhone() const
+      { return getString( FIX::FIELD::SecuritySettlAgentContactPhone ); }
+      FIX::StringView cashSettlAgentName() const
+      { return getString( FIX::FIELD::CashSettlAgentName ); }
+      FIX::StringView cashSettlAgentCode() const
+      { return getString( FIX::FIELD::CashSettlAgentCode ); }
+      FIX::StringView cashSettlAgentAcctNum() const
+      { return getString( FIX::FIELD::CashSettlAgentAcctNum ); }
+      FIX::StringView cashSettlAgentAcctName() const
+      { return getString( FIX::FIELD::CashSettlAgentAcctName ); }
+      FIX::StringView cashSettlAgentContactName() const
+      { return getString( FIX::FIELD::CashSettlAgentContactName ); }
+      FIX::StringView cashSettlAgentContactPhone() const
+      { return getString( FIX::FIELD::CashSettlAgentContactPhone ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "T" ) {}
+      void setSettlInstID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlInstID, value ); }
+      void setSettlInstTransType( char value )
+      { setChar( FIX::FIELD::SettlInstTransType, value ); }
+      void setSettlInstRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlInstRefID, value ); }
+      void setSettlInstMode( char value )
+      { setChar( FIX::FIELD::SettlInstMode, value ); }
+      void setSettlInstSource( char value )
+      { setChar( FIX::FIELD::SettlInstSource, value ); }
+      void setAllocAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocAccount, value ); }
+      void setSettlLocation( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlLocation, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocID, value ); }
+      void setLastMkt( const FIX::StringView& value )
+      { setString( FIX::FIELD::LastMkt, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setEffectiveTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::EffectiveTime, value ); }
+      void setEffectiveTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::EffectiveTime, value, precision ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setClientID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClientID, value ); }
+      void setExecBroker( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecBroker, value ); }
+      void setStandInstDbType( int value )
+      { setInt( FIX::FIELD::StandInstDbType, value ); }
+      void setStandInstDbName( const FIX::StringView& value )
+      { setString( FIX::FIELD::StandInstDbName, value ); }
+      void setStandInstDbID( const FIX::StringView& value )
+      { setString( FIX::FIELD::StandInstDbID, value ); }
+      void setSettlDeliveryType( int value )
+      { setInt( FIX::FIELD::SettlDeliveryType, value ); }
+      void setSettlDepositoryCode( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlDepositoryCode, value ); }
+      void setSettlBrkrCode( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlBrkrCode, value ); }
+      void setSettlInstCode( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlInstCode, value ); }
+      void setSecuritySettlAgentName( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySettlAgentName, value ); }
+      void setSecuritySettlAgentCode( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySettlAgentCode, value ); }
+      void setSecuritySettlAgentAcctNum( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySettlAgentAcctNum, value ); }
+      void setSecuritySettlAgentAcctName( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySettlAgentAcctName, value ); }
+      void setSecuritySettlAgentContactName( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySettlAgentContactName, value ); }
+      void setSecuritySettlAgentContactPhone( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySettlAgentContactPhone, value ); }
+      void setCashSettlAgentName( const FIX::StringView& value )
+      { setString( FIX::FIELD::CashSettlAgentName, value ); }
+      void setCashSettlAgentCode( const FIX::StringView& value )
+      { setString( FIX::FIELD::CashSettlAgentCode, value ); }
+      void setCashSettlAgentAcctNum( const FIX::StringView& value )
+      { setString( FIX::FIELD::CashSettlAgentAcctNum, value ); }
+      void setCashSettlAgentAcctName( const FIX::StringView& value )
+      { setString( FIX::FIELD::CashSettlAgentAcctName, value ); }
+      void setCashSettlAgentContactName( const FIX::StringView& value )
+      { setString( FIX::FIELD::CashSettlAgentContactName, value ); }
+      void setCashSettlAgentContactPhone( const FIX::StringView& value )
+      { setString( FIX::FIELD::CashSettlAgentContactPhone, value ); }
+    };
   };
 
 }
@@ -81,7 +81,16 @@ namespace FIX43
     NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+    { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
     FIELD_SET(*this, FIX::Quantity);
     FIELD_SET(*this, FIX::LastMkt);
     FIELD_SET(*this, FIX::TradeOriginationDate);
@@ -100,7 +109,18 @@ namespace FIX43
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
       FIELD_SET(*this, FIX::PartySubID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PartyID);
+        FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PartyRole);
+        FIELD_VIEW(*m_pMap, FIX::PartySubID);
+      };
     };
+    FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+    { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
     FIELD_SET(*this, FIX::TradeDate);
     FIELD_SET(*this, FIX::TransactTime);
     FIELD_SET(*this, FIX::SettlmntTyp);
@@ -127,7 +147,19 @@ namespace FIX43
       FIELD_SET(*this, FIX::SecondaryOrderID);
       FIELD_SET(*this, FIX::SecondaryClOrdID);
       FIELD_SET(*this, FIX::ListID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::OrderID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryOrderID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::ListID);
+      };
     };
+    FIX::GroupView<NoOrders::View> noOrders() const
+    { return FIX::GroupView<NoOrders::View>( *this, FIX::FIELD::NoOrders ); }
     FIELD_SET(*this, FIX::NoExecs);
     class NoExecs: public FIX::Group
     {
@@ -138,7 +170,19 @@ namespace FIX43
       FIELD_SET(*this, FIX::SecondaryExecID);
       FIELD_SET(*this, FIX::LastPx);
       FIELD_SET(*this, FIX::LastCapacity);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::LastQty);
+        FIELD_VIEW(*m_pMap, FIX::ExecID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryExecID);
+        FIELD_VIEW(*m_pMap, FIX::LastPx);
+        FIELD_VIEW(*m_pMap, FIX::LastCapacity);
+      };
     };
+    FIX::GroupView<NoExecs::View> noExecs() const
+    { return FIX::GroupView<NoExecs::View>( *this, FIX::FIELD::NoExecs ); }
     FIELD_SET(*this, FIX::NoAllocs);
     class NoAllocs: public FIX::Group
     {
@@ -158,7 +202,18 @@ namespace FIX43
         FIELD_SET(*this, FIX::NestedPartyIDSource);
         FIELD_SET(*this, FIX::NestedPartyRole);
         FIELD_SET(*this, FIX::NestedPartySubID);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyID);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartySubID);
+        };
       };
+      FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+      { return FIX::GroupView<NoNestedPartyIDs::View>( *this, FIX::FIELD::NoNestedPartyIDs ); }
       FIELD_SET(*this, FIX::NotifyBrokerOfCredit);
       FIELD_SET(*this, FIX::AllocHandlInst);
       FIELD_SET(*this, FIX::AllocText);
@@ -184,7 +239,348 @@ namespace FIX43
         FIELD_SET(*this, FIX::MiscFeeAmt);
         FIELD_SET(*this, FIX::MiscFeeCurr);
         FIELD_SET(*this, FIX::MiscFeeType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::MiscFeeAmt);
+          FIELD_VIEW(*m_pMap, FIX::MiscFeeCurr);
+          FIELD_VIEW(*m_pMap, FIX::MiscFeeType);
+        };
       };
+      FIX::GroupView<NoMiscFees::View> noMiscFees() const
+      { return FIX::GroupView<NoMiscFees::View>( *this, FIX::FIELD::NoMiscFees ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::AllocAccount);
+        FIELD_VIEW(*m_pMap, FIX::AllocPrice);
+        FIELD_VIEW(*m_pMap, FIX::AllocQty);
+        FIELD_VIEW(*m_pMap, FIX::IndividualAllocID);
+        FIELD_VIEW(*m_pMap, FIX::ProcessCode);
+        FIELD_VIEW(*m_pMap, FIX::NoNestedPartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::NotifyBrokerOfCredit);
+        FIELD_VIEW(*m_pMap, FIX::AllocHandlInst);
+        FIELD_VIEW(*m_pMap, FIX::AllocText);
+        FIELD_VIEW(*m_pMap, FIX::EncodedAllocTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedAllocText);
+        FIELD_VIEW(*m_pMap, FIX::Commission);
+        FIELD_VIEW(*m_pMap, FIX::CommType);
+        FIELD_VIEW(*m_pMap, FIX::CommCurrency);
+        FIELD_VIEW(*m_pMap, FIX::FundRenewWaiv);
+        FIELD_VIEW(*m_pMap, FIX::AllocAvgPx);
+        FIELD_VIEW(*m_pMap, FIX::AllocNetMoney);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrAmt);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrency);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrFxRate);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrFxRateCalc);
+        FIELD_VIEW(*m_pMap, FIX::AccruedInterestAmt);
+        FIELD_VIEW(*m_pMap, FIX::SettlInstMode);
+        FIELD_VIEW(*m_pMap, FIX::NoMiscFees);
+        FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+        { return FIX::GroupView<NoNestedPartyIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartyIDs ); }
+        FIX::GroupView<NoMiscFees::View> noMiscFees() const
+        { return FIX::GroupView<NoMiscFees::View>( *m_pMap, FIX::FIELD::NoMiscFees ); }
+      };
+    };
+    FIX::GroupView<NoAllocs::View> noAllocs() const
+    { return FIX::GroupView<NoAllocs::View>( *this, FIX::FIELD::NoAllocs ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView allocID() const
+      { return getString( FIX::FIELD::AllocID ); }
+      FIX::AllocTransType allocTransType() const
+      { return FIX::AllocTransType( getChar( FIX::FIELD::AllocTransType ) ); }
+      int allocType() const
+      { return getInt( FIX::FIELD::AllocType ); }
+      FIX::StringView refAllocID() const
+      { return getString( FIX::FIELD::RefAllocID ); }
+      FIX::StringView allocLinkID() const
+      { return getString( FIX::FIELD::AllocLinkID ); }
+      int allocLinkType() const
+      { return getInt( FIX::FIELD::AllocLinkType ); }
+      FIX::StringView bookingRefID() const
+      { return getString( FIX::FIELD::BookingRefID ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView securityIDSource() const
+      { return getString( FIX::FIELD::SecurityIDSource ); }
+      int product() const
+      { return getInt( FIX::FIELD::Product ); }
+      FIX::StringView cFICode() const
+      { return getString( FIX::FIELD::CFICode ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDate() const
+      { return getString( FIX::FIELD::MaturityDate ); }
+      FIX::StringView couponPaymentDate() const
+      { return getString( FIX::FIELD::CouponPaymentDate ); }
+      FIX::StringView issueDate() const
+      { return getString( FIX::FIELD::IssueDate ); }
+      FIX::StringView repoCollateralSecurityType() const
+      { return getString( FIX::FIELD::RepoCollateralSecurityType ); }
+      int repurchaseTerm() const
+      { return getInt( FIX::FIELD::RepurchaseTerm ); }
+      FIX::Decimal repurchaseRate() const
+      { return getDecimal( FIX::FIELD::RepurchaseRate ); }
+      double factor() const
+      { return getDouble( FIX::FIELD::Factor ); }
+      FIX::StringView creditRating() const
+      { return getString( FIX::FIELD::CreditRating ); }
+      FIX::StringView instrRegistry() const
+      { return getString( FIX::FIELD::InstrRegistry ); }
+      FIX::StringView countryOfIssue() const
+      { return getString( FIX::FIELD::CountryOfIssue ); }
+      FIX::StringView stateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::StateOrProvinceOfIssue ); }
+      FIX::StringView localeOfIssue() const
+      { return getString( FIX::FIELD::LocaleOfIssue ); }
+      FIX::StringView redemptionDate() const
+      { return getString( FIX::FIELD::RedemptionDate ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      int noSecurityAltID() const
+      { return getInt( FIX::FIELD::NoSecurityAltID ); }
+      FIX::Decimal quantity() const
+      { return getDecimal( FIX::FIELD::Quantity ); }
+      FIX::StringView lastMkt() const
+      { return getString( FIX::FIELD::LastMkt ); }
+      FIX::StringView tradeOriginationDate() const
+      { return getString( FIX::FIELD::TradeOriginationDate ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::StringView tradingSessionSubID() const
+      { return getString( FIX::FIELD::TradingSessionSubID ); }
+      int priceType() const
+      { return getInt( FIX::FIELD::PriceType ); }
+      FIX::Decimal avgPx() const
+      { return getDecimal( FIX::FIELD::AvgPx ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      int avgPrxPrecision() const
+      { return getInt( FIX::FIELD::AvgPrxPrecision ); }
+      int noPartyIDs() const
+      { return getInt( FIX::FIELD::NoPartyIDs ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      FIX::SettlmntTyp settlmntTyp() const
+      { return FIX::SettlmntTyp( getChar( FIX::FIELD::SettlmntTyp ) ); }
+      FIX::StringView futSettDate() const
+      { return getString( FIX::FIELD::FutSettDate ); }
+      FIX::Decimal grossTradeAmt() const
+      { return getDecimal( FIX::FIELD::GrossTradeAmt ); }
+      FIX::Decimal concession() const
+      { return getDecimal( FIX::FIELD::Concession ); }
+      FIX::Decimal totalTakedown() const
+      { return getDecimal( FIX::FIELD::TotalTakedown ); }
+      FIX::Decimal netMoney() const
+      { return getDecimal( FIX::FIELD::NetMoney ); }
+      FIX::PositionEffect positionEffect() const
+      { return FIX::PositionEffect( getChar( FIX::FIELD::PositionEffect ) ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      int numDaysInterest() const
+      { return getInt( FIX::FIELD::NumDaysInterest ); }
+      FIX::Decimal accruedInterestRate() const
+      { return getDecimal( FIX::FIELD::AccruedInterestRate ); }
+      FIX::Decimal totalAccruedInterestAmt() const
+      { return getDecimal( FIX::FIELD::TotalAccruedInterestAmt ); }
+      bool legalConfirm() const
+      { return getBool( FIX::FIELD::LegalConfirm ); }
+      int noOrders() const
+      { return getInt( FIX::FIELD::NoOrders ); }
+      int noExecs() const
+      { return getInt( FIX::FIELD::NoExecs ); }
+      int noAllocs() const
+      { return getInt( FIX::FIELD::NoAllocs ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "J" ) {}
+      void setAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocID, value ); }
+      void setAllocTransType( char value )
+      { setChar( FIX::FIELD::AllocTransType, value ); }
+      void setAllocType( int value )
+      { setInt( FIX::FIELD::AllocType, value ); }
+      void setRefAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RefAllocID, value ); }
+      void setAllocLinkID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocLinkID, value ); }
+      void setAllocLinkType( int value )
+      { setInt( FIX::FIELD::AllocLinkType, value ); }
+      void setBookingRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::BookingRefID, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityIDSource, value ); }
+      void setProduct( int value )
+      { setInt( FIX::FIELD::Product, value ); }
+      void setCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::CFICode, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDate, value ); }
+      void setCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::CouponPaymentDate, value ); }
+      void setIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::IssueDate, value ); }
+      void setRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RepoCollateralSecurityType, value ); }
+      void setRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::RepurchaseTerm, value ); }
+      void setRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::RepurchaseRate, value ); }
+      void setFactor( double value )
+      { setDouble( FIX::FIELD::Factor, value ); }
+      void setCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::CreditRating, value ); }
+      void setInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::InstrRegistry, value ); }
+      void setCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::CountryOfIssue, value ); }
+      void setStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::StateOrProvinceOfIssue, value ); }
+      void setLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::LocaleOfIssue, value ); }
+      void setRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::RedemptionDate, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setNoSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoSecurityAltID, value ); }
+      void setQuantity( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Quantity, value ); }
+      void setLastMkt( const FIX::StringView& value )
+      { setString( FIX::FIELD::LastMkt, value ); }
+      void setTradeOriginationDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeOriginationDate, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setTradingSessionSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionSubID, value ); }
+      void setPriceType( int value )
+      { setInt( FIX::FIELD::PriceType, value ); }
+      void setAvgPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AvgPx, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setAvgPrxPrecision( int value )
+      { setInt( FIX::FIELD::AvgPrxPrecision, value ); }
+      void setNoPartyIDs( int value )
+      { setInt( FIX::FIELD::NoPartyIDs, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setSettlmntTyp( char value )
+      { setChar( FIX::FIELD::SettlmntTyp, value ); }
+      void setFutSettDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate, value ); }
+      void setGrossTradeAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::GrossTradeAmt, value ); }
+      void setConcession( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Concession, value ); }
+      void setTotalTakedown( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::TotalTakedown, value ); }
+      void setNetMoney( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::NetMoney, value ); }
+      void setPositionEffect( char value )
+      { setChar( FIX::FIELD::PositionEffect, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setNumDaysInterest( int value )
+      { setInt( FIX::FIELD::NumDaysInterest, value ); }
+      void setAccruedInterestRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AccruedInterestRate, value ); }
+      void setTotalAccruedInterestAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::TotalAccruedInterestAmt, value ); }
+      void setLegalConfirm( bool value )
+      { setBool( FIX::FIELD::LegalConfirm, value ); }
+      void setNoOrders( int value )
+      { setInt( FIX::FIELD::NoOrders, value ); }
+      void setNoExecs( int value )
+      { setInt( FIX::FIELD::NoExecs, value ); }
+      void setNoAllocs( int value )
+      { setInt( FIX::FIELD::NoAllocs, value ); }
     };
   };
 
@@ -35,7 +35,18 @@ namespace FIX43
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
       FIELD_SET(*this, FIX::PartySubID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PartyID);
+        FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PartyRole);
+        FIELD_VIEW(*m_pMap, FIX::PartySubID);
+      };
     };
+    FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+    { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
     FIELD_SET(*this, FIX::AllocID);
     FIELD_SET(*this, FIX::TradeDate);
     FIELD_SET(*this, FIX::TransactTime);
@@ -45,6 +56,62 @@ namespace FIX43
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
     FIELD_SET(*this, FIX::LegalConfirm);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      int noPartyIDs() const
+      { return getInt( FIX::FIELD::NoPartyIDs ); }
+      FIX::StringView allocID() const
+      { return getString( FIX::FIELD::AllocID ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      int allocStatus() const
+      { return getInt( FIX::FIELD::AllocStatus ); }
+      int allocRejCode() const
+      { return getInt( FIX::FIELD::AllocRejCode ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      bool legalConfirm() const
+      { return getBool( FIX::FIELD::LegalConfirm ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "P" ) {}
+      void setNoPartyIDs( int value )
+      { setInt( FIX::FIELD::NoPartyIDs, value ); }
+      void setAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocID, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setAllocStatus( int value )
+      { setInt( FIX::FIELD::AllocStatus, value ); }
+      void setAllocRejCode( int value )
+      { setInt( FIX::FIELD::AllocRejCode, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setLegalConfirm( bool value )
+      { setBool( FIX::FIELD::LegalConfirm, value ); }
+    };
   };
 
 }
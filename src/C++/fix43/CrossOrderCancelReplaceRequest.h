@@ -78,7 +78,16 @@ namespace FIX43
     NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+    { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
     FIELD_SET(*this, FIX::SettlmntTyp);
     FIELD_SET(*this, FIX::FutSettDate);
     FIELD_SET(*this, FIX::HandlInst);
@@ -97,7 +106,16 @@ namespace FIX43
     NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
       FIELD_SET(*this, FIX::StipulationType);
       FIELD_SET(*this, FIX::StipulationValue);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::StipulationType);
+        FIELD_VIEW(*m_pMap, FIX::StipulationValue);
+      };
     };
+    FIX::GroupView<NoStipulations::View> noStipulations() const
+    { return FIX::GroupView<NoStipulations::View>( *this, FIX::FIELD::NoStipulations ); }
     FIELD_SET(*this, FIX::OrdType);
     FIELD_SET(*this, FIX::PriceType);
     FIELD_SET(*this, FIX::Price);
@@ -148,7 +166,18 @@ namespace FIX43
         FIELD_SET(*this, FIX::PartyIDSource);
         FIELD_SET(*this, FIX::PartyRole);
         FIELD_SET(*this, FIX::PartySubID);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::PartyID);
+          FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::PartyRole);
+          FIELD_VIEW(*m_pMap, FIX::PartySubID);
+        };
       };
+      FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+      { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
       FIELD_SET(*this, FIX::TradeOriginationDate);
       FIELD_SET(*this, FIX::Account);
       FIELD_SET(*this, FIX::AccountType);
@@ -195,10 +224,83 @@ namespace FIX43
           FIELD_SET(*this, FIX::NestedPartyIDSource);
           FIELD_SET(*this, FIX::NestedPartyRole);
           FIELD_SET(*this, FIX::NestedPartySubID);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::NestedPartyID);
+            FIELD_VIEW(*m_pMap, FIX::NestedPartyIDSource);
+            FIELD_VIEW(*m_pMap, FIX::NestedPartyRole);
+            FIELD_VIEW(*m_pMap, FIX::NestedPartySubID);
+          };
         };
+        FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+        { return FIX::GroupView<NoNestedPartyIDs::View>( *this, FIX::FIELD::NoNestedPartyIDs ); }
         FIELD_SET(*this, FIX::AllocQty);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::AllocAccount);
+          FIELD_VIEW(*m_pMap, FIX::IndividualAllocID);
+          FIELD_VIEW(*m_pMap, FIX::NoNestedPartyIDs);
+          FIELD_VIEW(*m_pMap, FIX::AllocQty);
+          FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+          { return FIX::GroupView<NoNestedPartyIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartyIDs ); }
+        };
+      };
+      FIX::GroupView<NoAllocs::View> noAllocs() const
+      { return FIX::GroupView<NoAllocs::View>( *this, FIX::FIELD::NoAllocs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Side);
+        FIELD_VIEW(*m_pMap, FIX::OrigClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::ClOrdLinkID);
+        FIELD_VIEW(*m_pMap, FIX::OrigOrdModTime);
+        FIELD_VIEW(*m_pMap, FIX::NoPartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::TradeOriginationDate);
+        FIELD_VIEW(*m_pMap, FIX::Account);
+        FIELD_VIEW(*m_pMap, FIX::AccountType);
+        FIELD_VIEW(*m_pMap, FIX::DayBookingInst);
+        FIELD_VIEW(*m_pMap, FIX::BookingUnit);
+        FIELD_VIEW(*m_pMap, FIX::PreallocMethod);
+        FIELD_VIEW(*m_pMap, FIX::QuantityType);
+        FIELD_VIEW(*m_pMap, FIX::OrderQty);
+        FIELD_VIEW(*m_pMap, FIX::CashOrderQty);
+        FIELD_VIEW(*m_pMap, FIX::OrderPercent);
+        FIELD_VIEW(*m_pMap, FIX::RoundingDirection);
+        FIELD_VIEW(*m_pMap, FIX::RoundingModulus);
+        FIELD_VIEW(*m_pMap, FIX::Commission);
+        FIELD_VIEW(*m_pMap, FIX::CommType);
+        FIELD_VIEW(*m_pMap, FIX::CommCurrency);
+        FIELD_VIEW(*m_pMap, FIX::FundRenewWaiv);
+        FIELD_VIEW(*m_pMap, FIX::OrderCapacity);
+        FIELD_VIEW(*m_pMap, FIX::OrderRestrictions);
+        FIELD_VIEW(*m_pMap, FIX::CustOrderCapacity);
+        FIELD_VIEW(*m_pMap, FIX::ForexReq);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrency);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+        FIELD_VIEW(*m_pMap, FIX::PositionEffect);
+        FIELD_VIEW(*m_pMap, FIX::CoveredOrUncovered);
+        FIELD_VIEW(*m_pMap, FIX::CashMargin);
+        FIELD_VIEW(*m_pMap, FIX::ClearingFeeIndicator);
+        FIELD_VIEW(*m_pMap, FIX::SolicitedFlag);
+        FIELD_VIEW(*m_pMap, FIX::SideComplianceID);
+        FIELD_VIEW(*m_pMap, FIX::NoAllocs);
+        FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+        { return FIX::GroupView<NoPartyIDs::View>( *m_pMap, FIX::FIELD::NoPartyIDs ); }
+        FIX::GroupView<NoAllocs::View> noAllocs() const
+        { return FIX::GroupView<NoAllocs::View>( *m_pMap, FIX::FIELD::NoAllocs ); }
       };
     };
+    FIX::GroupView<NoSides::View> noSides() const
+    { return FIX::GroupView<NoSides::View>( *this, FIX::FIELD::NoSides ); }
     FIELD_SET(*this, FIX::NoTradingSessions);
     class NoTradingSessions: public FIX::Group
     {
@@ -206,6 +308,363 @@ namespace FIX43
     NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,0)) {}
       FIELD_SET(*this, FIX::TradingSessionID);
       FIELD_SET(*this, FIX::TradingSessionSubID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+      };
+    };
+    FIX::GroupView<NoTradingSessions::View> noTradingSessions() const
+    { return FIX::GroupView<NoTradingSessions::View>( *this, FIX::FIELD::NoTradingSessions ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView crossID() const
+      { return getString( FIX::FIELD::CrossID ); }
+      FIX::StringView origCrossID() const
+      { return getString( FIX::FIELD::OrigCrossID ); }
+      int crossType() const
+      { return getInt( FIX::FIELD::CrossType ); }
+      int crossPrioritization() const
+      { return getInt( FIX::FIELD::CrossPrioritization ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView securityIDSource() const
+      { return getString( FIX::FIELD::SecurityIDSource ); }
+      int product() const
+      { return getInt( FIX::FIELD::Product ); }
+      FIX::StringView cFICode() const
+      { return getString( FIX::FIELD::CFICode ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDate() const
+      { return getString( FIX::FIELD::MaturityDate ); }
+      FIX::StringView couponPaymentDate() const
+      { return getString( FIX::FIELD::CouponPaymentDate ); }
+      FIX::StringView issueDate() const
+      { return getString( FIX::FIELD::IssueDate ); }
+      FIX::StringView repoCollateralSecurityType() const
+      { return getString( FIX::FIELD::RepoCollateralSecurityType ); }
+      int repurchaseTerm() const
+      { return getInt( FIX::FIELD::RepurchaseTerm ); }
+      FIX::Decimal repurchaseRate() const
+      { return getDecimal( FIX::FIELD::RepurchaseRate ); }
+      double factor() const
+      { return getDouble( FIX::FIELD::Factor ); }
+      FIX::StringView creditRating() const
+      { return getString( FIX::FIELD::CreditRating ); }
+      FIX::StringView instrRegistry() const
+      { return getString( FIX::FIELD::InstrRegistry ); }
+      FIX::StringView countryOfIssue() const
+      { return getString( FIX::FIELD::CountryOfIssue ); }
+      FIX::StringView stateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::StateOrProvinceOfIssue ); }
+      FIX::StringView localeOfIssue() const
+      { return getString( FIX::FIELD::LocaleOfIssue ); }
+      FIX::StringView redemptionDate() const
+      { return getString( FIX::FIELD::RedemptionDate ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      int noSecurityAltID() const
+      { return getInt( FIX::FIELD::NoSecurityAltID ); }
+      FIX::SettlmntTyp settlmntTyp() const
+      { return FIX::SettlmntTyp( getChar( FIX::FIELD::SettlmntTyp ) ); }
+      FIX::StringView futSettDate() const
+      { return getString( FIX::FIELD::FutSettDate ); }
+      FIX::HandlInst handlInst() const
+      { return FIX::HandlInst( getChar( FIX::FIELD::HandlInst ) ); }
+      FIX::StringView execInst() const
+      { return getString( FIX::FIELD::ExecInst ); }
+      FIX::Decimal minQty() const
+      { return getDecimal( FIX::FIELD::MinQty ); }
+      FIX::Decimal maxFloor() const
+      { return getDecimal( FIX::FIELD::MaxFloor ); }
+      FIX::StringView exDestination() const
+      { return getString( FIX::FIELD::ExDestination ); }
+      FIX::ProcessCode processCode() const
+      { return FIX::ProcessCode( getChar( FIX::FIELD::ProcessCode ) ); }
+      FIX::Decimal prevClosePx() const
+      { return getDecimal( FIX::FIELD::PrevClosePx ); }
+      bool locateReqd() const
+      { return getBool( FIX::FIELD::LocateReqd ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      int noStipulations() const
+      { return getInt( FIX::FIELD::NoStipulations ); }
+      FIX::OrdType ordType() const
+      { return FIX::OrdType( getChar( FIX::FIELD::OrdType ) ); }
+      int priceType() const
+      { return getInt( FIX::FIELD::PriceType ); }
+      FIX::Decimal price() const
+      { return getDecimal( FIX::FIELD::Price ); }
+      FIX::Decimal stopPx() const
+      { return getDecimal( FIX::FIELD::StopPx ); }
+      double spread() const
+      { return getDouble( FIX::FIELD::Spread ); }
+      FIX::StringView benchmarkCurveCurrency() const
+      { return getString( FIX::FIELD::BenchmarkCurveCurrency ); }
+      FIX::StringView benchmarkCurveName() const
+      { return getString( FIX::FIELD::BenchmarkCurveName ); }
+      FIX::StringView benchmarkCurvePoint() const
+      { return getString( FIX::FIELD::BenchmarkCurvePoint ); }
+      FIX::StringView yieldType() const
+      { return getString( FIX::FIELD::YieldType ); }
+      FIX::Decimal yield() const
+      { return getDecimal( FIX::FIELD::Yield ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::StringView complianceID() const
+      { return getString( FIX::FIELD::ComplianceID ); }
+      FIX::StringView iOIid() const
+      { return getString( FIX::FIELD::IOIid ); }
+      FIX::StringView quoteID() const
+      { return getString( FIX::FIELD::QuoteID ); }
+      FIX::TimeInForce timeInForce() const
+      { return FIX::TimeInForce( getChar( FIX::FIELD::TimeInForce ) ); }
+      FIX::StringView effectiveTime() const
+      { return getString( FIX::FIELD::EffectiveTime ); }
+      FIX::StringView expireDate() const
+      { return getString( FIX::FIELD::ExpireDate ); }
+      FIX::StringView expireTime() const
+      { return getString( FIX::FIELD::ExpireTime ); }
+      int gTBookingInst() const
+      { return getInt( FIX::FIELD::GTBookingInst ); }
+      FIX::Decimal maxShow() const
+      { return getDecimal( FIX::FIELD::MaxShow ); }
+      double pegDifference() const
+      { return getDouble( FIX::FIELD::PegDifference ); }
+      FIX::DiscretionInst discretionInst() const
+      { return FIX::DiscretionInst( getChar( FIX::FIELD::DiscretionInst ) ); }
+      double discretionOffset() const
+      { return getDouble( FIX::FIELD::DiscretionOffset ); }
+      FIX::CancellationRights cancellationRights() const
+      { return FIX::CancellationRights( getChar( FIX::FIELD::CancellationRights ) ); }
+      FIX::MoneyLaunderingStatus moneyLaunderingStatus() const
+      { return FIX::MoneyLaunderingStatus( getChar( FIX::FIELD::MoneyLaunderingStatus ) ); }
+      FIX::StringView registID() const
+      { return getString( FIX::FIELD::RegistID ); }
+      FIX::StringView designation() const
+      { return getString( FIX::FIELD::Designation ); }
+      FIX::Decimal accruedInterestRate() const
+      { return getDecimal( FIX::FIELD::AccruedInterestRate ); }
+      FIX::Decimal accruedInterestAmt() const
+      { return getDecimal( FIX::FIELD::AccruedInterestAmt ); }
+      FIX::Decimal netMoney() const
+      { return getDecimal( FIX::FIELD::NetMoney ); }
+      int noSides() const
+      { return getInt( FIX::FIELD::NoSides ); }
+      int noTradingSessions() const
+      { return getInt( FIX::FIELD::NoTradingSessions ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "t" ) {}
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setCrossID( const FIX::StringView& value )
+      { setString( FIX::FIELD::CrossID, value ); }
+      void setOrigCrossID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrigCrossID, value ); }
+      void setCrossType( int value )
+      { setInt( FIX::FIELD::CrossType, value ); }
+      void setCrossPrioritization( int value )
+      { setInt( FIX::FIELD::CrossPrioritization, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityIDSource, value ); }
+      void setProduct( int value )
+      { setInt( FIX::FIELD::Product, value ); }
+      void setCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::CFICode, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDate, value ); }
+      void setCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::CouponPaymentDate, value ); }
+      void setIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::IssueDate, value ); }
+      void setRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RepoCollateralSecurityType, value ); }
+      void setRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::RepurchaseTerm, value ); }
+      void setRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::RepurchaseRate, value ); }
+      void setFactor( double value )
+      { setDouble( FIX::FIELD::Factor, value ); }
+      void setCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::CreditRating, value ); }
+      void setInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::InstrRegistry, value ); }
+      void setCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::CountryOfIssue, value ); }
+      void setStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::StateOrProvinceOfIssue, value ); }
+      void setLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::LocaleOfIssue, value ); }
+      void setRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::RedemptionDate, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setNoSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoSecurityAltID, value ); }
+      void setSettlmntTyp( char value )
+      { setChar( FIX::FIELD::SettlmntTyp, value ); }
+      void setFutSettDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate, value ); }
+      void setHandlInst( char value )
+      { setChar( FIX::FIELD::HandlInst, value ); }
+      void setExecInst( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecInst, value ); }
+      void setMinQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MinQty, value ); }
+      void setMaxFloor( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MaxFloor, value ); }
+      void setExDestination( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExDestination, value ); }
+      void setProcessCode( char value )
+      { setChar( FIX::FIELD::ProcessCode, value ); }
+      void setPrevClosePx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::PrevClosePx, value ); }
+      void setLocateReqd( bool value )
+      { setBool( FIX::FIELD::LocateReqd, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setNoStipulations( int value )
+      { setInt( FIX::FIELD::NoStipulations, value ); }
+      void setOrdType( char value )
+      { setChar( FIX::FIELD::OrdType, value ); }
+      void setPriceType( int value )
+      { setInt( FIX::FIELD::PriceType, value ); }
+      void setPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Price, value ); }
+      void setStopPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StopPx, value ); }
+      void setSpread( double value )
+      { setDouble( FIX::FIELD::Spread, value ); }
+      void setBenchmarkCurveCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkCurveCurrency, value ); }
+      void setBenchmarkCurveName( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkCurveName, value ); }
+      void setBenchmarkCurvePoint( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkCurvePoint, value ); }
+      void setYieldType( const FIX::StringView& value )
+      { setString( FIX::FIELD::YieldType, value ); }
+      void setYield( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Yield, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setComplianceID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ComplianceID, value ); }
+      void setIOIid( const FIX::StringView& value )
+      { setString( FIX::FIELD::IOIid, value ); }
+      void setQuoteID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteID, value ); }
+      void setTimeInForce( char value )
+      { setChar( FIX::FIELD::TimeInForce, value ); }
+      void setEffectiveTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::EffectiveTime, value ); }
+      void setEffectiveTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::EffectiveTime, value, precision ); }
+      void setExpireDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExpireDate, value ); }
+      void setExpireTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExpireTime, value ); }
+      void setExpireTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::ExpireTime, value, precision ); }
+      void setGTBookingInst( int value )
+      { setInt( FIX::FIELD::GTBookingInst, value ); }
+      void setMaxShow( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MaxShow, value ); }
+      void setPegDifference( double value )
+      { setDouble( FIX::FIELD::PegDifference, value ); }
+      void setDiscretionInst( char value )
+      { setChar( FIX::FIELD::DiscretionInst, value ); }
+      void setDiscretionOffset( double value )
+      { setDouble( FIX::FIELD::DiscretionOffset, value ); }
+      void setCancellationRights( char value )
+      { setChar( FIX::FIELD::CancellationRights, value ); }
+      void setMoneyLaunderingStatus( char value )
+      { setChar( FIX::FIELD::MoneyLaunderingStatus, value ); }
+      void setRegistID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RegistID, value ); }
+      void setDesignation( const FIX::StringView& value )
+      { setString( FIX::FIELD::Designation, value ); }
+      void setAccruedInterestRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AccruedInterestRate, value ); }
+      void setAccruedInterestAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AccruedInterestAmt, value ); }
+      void setNetMoney( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::NetMoney, value ); }
+      void setNoSides( int value )
+      { setInt( FIX::FIELD::NoSides, value ); }
+      void setNoTradingSessions( int value )
+      { setInt( FIX::FIELD::NoTradingSessions, value ); }
     };
   };
 
@@ -74,7 +74,16 @@ namespace FIX43
     NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+    { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
     FIELD_SET(*this, FIX::TransactTime);
     FIELD_SET(*this, FIX::NoSides);
     class NoSides: public FIX::Group
@@ -96,7 +105,18 @@ namespace FIX43
         FIELD_SET(*this, FIX::PartyIDSource);
         FIELD_SET(*this, FIX::PartyRole);
         FIELD_SET(*this, FIX::PartySubID);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::PartyID);
+          FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::PartyRole);
+          FIELD_VIEW(*m_pMap, FIX::PartySubID);
+        };
       };
+      FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+      { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
       FIELD_SET(*this, FIX::TradeOriginationDate);
       FIELD_SET(*this, FIX::OrderQty);
       FIELD_SET(*this, FIX::CashOrderQty);
@@ -107,6 +127,208 @@ namespace FIX43
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Side);
+        FIELD_VIEW(*m_pMap, FIX::OrigClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::ClOrdLinkID);
+        FIELD_VIEW(*m_pMap, FIX::OrigOrdModTime);
+        FIELD_VIEW(*m_pMap, FIX::NoPartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::TradeOriginationDate);
+        FIELD_VIEW(*m_pMap, FIX::OrderQty);
+        FIELD_VIEW(*m_pMap, FIX::CashOrderQty);
+        FIELD_VIEW(*m_pMap, FIX::OrderPercent);
+        FIELD_VIEW(*m_pMap, FIX::RoundingDirection);
+        FIELD_VIEW(*m_pMap, FIX::RoundingModulus);
+        FIELD_VIEW(*m_pMap, FIX::ComplianceID);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+        FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+        { return FIX::GroupView<NoPartyIDs::View>( *m_pMap, FIX::FIELD::NoPartyIDs ); }
+      };
+    };
+    FIX::GroupView<NoSides::View> noSides() const
+    { return FIX::GroupView<NoSides::View>( *this, FIX::FIELD::NoSides ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView crossID() const
+      { return getString( FIX::FIELD::CrossID ); }
+      FIX::StringView origCrossID() const
+      { return getString( FIX::FIELD::OrigCrossID ); }
+      int crossType() const
+      { return getInt( FIX::FIELD::CrossType ); }
+      int crossPrioritization() const
+      { return getInt( FIX::FIELD::CrossPrioritization ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView securityIDSource() const
+      { return getString( FIX::FIELD::SecurityIDSource ); }
+      int product() const
+      { return getInt( FIX::FIELD::Product ); }
+      FIX::StringView cFICode() const
+      { return getString( FIX::FIELD::CFICode ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDate() const
+      { return getString( FIX::FIELD::MaturityDate ); }
+      FIX::StringView couponPaymentDate() const
+      { return getString( FIX::FIELD::CouponPaymentDate ); }
+      FIX::StringView issueDate() const
+      { return getString( FIX::FIELD::IssueDate ); }
+      FIX::StringView repoCollateralSecurityType() const
+      { return getString( FIX::FIELD::RepoCollateralSecurityType ); }
+      int repurchaseTerm() const
+      { return getInt( FIX::FIELD::RepurchaseTerm ); }
+      FIX::Decimal repurchaseRate() const
+      { return getDecimal( FIX::FIELD::RepurchaseRate ); }
+      double factor() const
+      { return getDouble( FIX::FIELD::Factor ); }
+      FIX::StringView creditRating() const
+      { return getString( FIX::FIELD::CreditRating ); }
+      FIX::StringView instrRegistry() const
+      { return getString( FIX::FIELD::InstrRegistry ); }
+      FIX::StringView countryOfIssue() const
+      { return getString( FIX::FIELD::CountryOfIssue ); }
+      FIX::StringView stateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::StateOrProvinceOfIssue ); }
+      FIX::StringView localeOfIssue() const
+      { return getString( FIX::FIELD::LocaleOfIssue ); }
+      FIX::StringView redemptionDate() const
+      { return getString( FIX::FIELD::RedemptionDate ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      int noSecurityAltID() const
+      { return getInt( FIX::FIELD::NoSecurityAltID ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      int noSides() const
+      { return getInt( FIX::FIELD::NoSides ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "u" ) {}
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setCrossID( const FIX::StringView& value )
+      { setString( FIX::FIELD::CrossID, value ); }
+      void setOrigCrossID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrigCrossID, value ); }
+      void setCrossType( int value )
+      { setInt( FIX::FIELD::CrossType, value ); }
+      void setCrossPrioritization( int value )
+      { setInt( FIX::FIELD::CrossPrioritization, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityIDSource, value ); }
+      void setProduct( int value )
+      { setInt( FIX::FIELD::Product, value ); }
+      void setCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::CFICode, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDate, value ); }
+      void setCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::CouponPaymentDate, value ); }
+      void setIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::IssueDate, value ); }
+      void setRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RepoCollateralSecurityType, value ); }
+      void setRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::RepurchaseTerm, value ); }
+      void setRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::RepurchaseRate, value ); }
+      void setFactor( double value )
+      { setDouble( FIX::FIELD::Factor, value ); }
+      void setCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::CreditRating, value ); }
+      void setInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::InstrRegistry, value ); }
+      void setCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::CountryOfIssue, value ); }
+      void setStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::StateOrProvinceOfIssue, value ); }
+      void setLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::LocaleOfIssue, value ); }
+      void setRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::RedemptionDate, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setNoSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoSecurityAltID, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setNoSides( int value )
+      { setInt( FIX::FIELD::NoSides, value ); }
     };
   };
 
@@ -69,7 +69,16 @@ namespace FIX43
     NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
       FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
       FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+    { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *this, FIX::FIELD::NoUnderlyingSecurityAltID ); }
     FIELD_SET(*this, FIX::TotalNumSecurities);
     FIELD_SET(*this, FIX::NoRelatedSym);
     class NoRelatedSym: public FIX::Group
@@ -115,7 +124,16 @@ namespace FIX43
       NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+      { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
       FIELD_SET(*this, FIX::Currency);
       FIELD_SET(*this, FIX::TradingSessionID);
       FIELD_SET(*this, FIX::TradingSessionSubID);
@@ -168,10 +186,285 @@ namespace FIX43
         NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
           FIELD_SET(*this, FIX::LegSecurityAltID);
           FIELD_SET(*this, FIX::LegSecurityAltIDSource);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityAltID);
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityAltIDSource);
+          };
         };
+        FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+        { return FIX::GroupView<NoLegSecurityAltID::View>( *this, FIX::FIELD::NoLegSecurityAltID ); }
         FIELD_SET(*this, FIX::LegCurrency);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::LegSymbol);
+          FIELD_VIEW(*m_pMap, FIX::LegSymbolSfx);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityID);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityIDSource);
+          FIELD_VIEW(*m_pMap, FIX::LegProduct);
+          FIELD_VIEW(*m_pMap, FIX::LegCFICode);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::LegMaturityMonthYear);
+          FIELD_VIEW(*m_pMap, FIX::LegMaturityDate);
+          FIELD_VIEW(*m_pMap, FIX::LegCouponPaymentDate);
+          FIELD_VIEW(*m_pMap, FIX::LegIssueDate);
+          FIELD_VIEW(*m_pMap, FIX::LegRepoCollateralSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::LegRepurchaseTerm);
+          FIELD_VIEW(*m_pMap, FIX::LegRepurchaseRate);
+          FIELD_VIEW(*m_pMap, FIX::LegFactor);
+          FIELD_VIEW(*m_pMap, FIX::LegCreditRating);
+          FIELD_VIEW(*m_pMap, FIX::LegInstrRegistry);
+          FIELD_VIEW(*m_pMap, FIX::LegCountryOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegStateOrProvinceOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegLocaleOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegRedemptionDate);
+          FIELD_VIEW(*m_pMap, FIX::LegStrikePrice);
+          FIELD_VIEW(*m_pMap, FIX::LegOptAttribute);
+          FIELD_VIEW(*m_pMap, FIX::LegContractMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::LegCouponRate);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityExchange);
+          FIELD_VIEW(*m_pMap, FIX::LegIssuer);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuerLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuer);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDescLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::LegRatioQty);
+          FIELD_VIEW(*m_pMap, FIX::LegSide);
+          FIELD_VIEW(*m_pMap, FIX::NoLegSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::LegCurrency);
+          FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+          { return FIX::GroupView<NoLegSecurityAltID::View>( *m_pMap, FIX::FIELD::NoLegSecurityAltID ); }
+        };
+      };
+      FIX::GroupView<NoLegs::View> noLegs() const
+      { return FIX::GroupView<NoLegs::View>( *this, FIX::FIELD::NoLegs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::Product);
+        FIELD_VIEW(*m_pMap, FIX::CFICode);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::IssueDate);
+        FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::Factor);
+        FIELD_VIEW(*m_pMap, FIX::CreditRating);
+        FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::Currency);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+        FIELD_VIEW(*m_pMap, FIX::NoLegs);
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
+        FIX::GroupView<NoLegs::View> noLegs() const
+        { return FIX::GroupView<NoLegs::View>( *m_pMap, FIX::FIELD::NoLegs ); }
       };
     };
+    FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+    { return FIX::GroupView<NoRelatedSym::View>( *this, FIX::FIELD::NoRelatedSym ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView securityReqID() const
+      { return getString( FIX::FIELD::SecurityReqID ); }
+      FIX::StringView securityResponseID() const
+      { return getString( FIX::FIELD::SecurityResponseID ); }
+      int securityRequestResult() const
+      { return getInt( FIX::FIELD::SecurityRequestResult ); }
+      FIX::StringView underlyingSymbol() const
+      { return getString( FIX::FIELD::UnderlyingSymbol ); }
+      FIX::StringView underlyingSymbolSfx() const
+      { return getString( FIX::FIELD::UnderlyingSymbolSfx ); }
+      FIX::StringView underlyingSecurityID() const
+      { return getString( FIX::FIELD::UnderlyingSecurityID ); }
+      FIX::StringView underlyingSecurityIDSource() const
+      { return getString( FIX::FIELD::UnderlyingSecurityIDSource ); }
+      int underlyingProduct() const
+      { return getInt( FIX::FIELD::UnderlyingProduct ); }
+      FIX::StringView underlyingCFICode() const
+      { return getString( FIX::FIELD::UnderlyingCFICode ); }
+      FIX::StringView underlyingSecurityType() const
+      { return getString( FIX::FIELD::UnderlyingSecurityType ); }
+      FIX::StringView underlyingMaturityMonthYear() const
+      { return getString( FIX::FIELD::UnderlyingMaturityMonthYear ); }
+      FIX::StringView underlyingMaturityDate() const
+      { return getString( FIX::FIELD::UnderlyingMaturityDate ); }
+      int underlyingPutOrCall() const
+      { return getInt( FIX::FIELD::UnderlyingPutOrCall ); }
+      FIX::StringView underlyingCouponPaymentDate() const
+      { return getString( FIX::FIELD::UnderlyingCouponPaymentDate ); }
+      FIX::StringView underlyingIssueDate() const
+      { return getString( FIX::FIELD::UnderlyingIssueDate ); }
+      FIX::StringView underlyingRepoCollateralSecurityType() const
+      { return getString( FIX::FIELD::UnderlyingRepoCollateralSecurityType ); }
+      int underlyingRepurchaseTerm() const
+      { return getInt( FIX::FIELD::UnderlyingRepurchaseTerm ); }
+      FIX::Decimal underlyingRepurchaseRate() const
+      { return getDecimal( FIX::FIELD::UnderlyingRepurchaseRate ); }
+      double underlyingFactor() const
+      { return getDouble( FIX::FIELD::UnderlyingFactor ); }
+      FIX::StringView underlyingCreditRating() const
+      { return getString( FIX::FIELD::UnderlyingCreditRating ); }
+      FIX::StringView underlyingInstrRegistry() const
+      { return getString( FIX::FIELD::UnderlyingInstrRegistry ); }
+      FIX::StringView underlyingCountryOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingCountryOfIssue ); }
+      FIX::StringView underlyingStateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingStateOrProvinceOfIssue ); }
+      FIX::StringView underlyingLocaleOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingLocaleOfIssue ); }
+      FIX::StringView underlyingRedemptionDate() const
+      { return getString( FIX::FIELD::UnderlyingRedemptionDate ); }
+      FIX::Decimal underlyingStrikePrice() const
+      { return getDecimal( FIX::FIELD::UnderlyingStrikePrice ); }
+      char underlyingOptAttribute() const
+      { return getChar( FIX::FIELD::UnderlyingOptAttribute ); }
+      double underlyingContractMultiplier() const
+      { return getDouble( FIX::FIELD::UnderlyingContractMultiplier ); }
+      FIX::Decimal underlyingCouponRate() const
+      { return getDecimal( FIX::FIELD::UnderlyingCouponRate ); }
+      FIX::StringView underlyingSecurityExchange() const
+      { return getString( FIX::FIELD::UnderlyingSecurityExchange ); }
+      FIX::StringView underlyingIssuer() const
+      { return getString( FIX::FIELD::UnderlyingIssuer ); }
+      int encodedUnderlyingIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedUnderlyingIssuerLen ); }
+      FIX::StringView encodedUnderlyingIssuer() const
+      { return getString( FIX::FIELD::EncodedUnderlyingIssuer ); }
+      FIX::StringView underlyingSecurityDesc() const
+      { return getString( FIX::FIELD::UnderlyingSecurityDesc ); }
+      int encodedUnderlyingSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedUnderlyingSecurityDescLen ); }
+      FIX::StringView encodedUnderlyingSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedUnderlyingSecurityDesc ); }
+      int noUnderlyingSecurityAltID() const
+      { return getInt( FIX::FIELD::NoUnderlyingSecurityAltID ); }
+      int totalNumSecurities() const
+      { return getInt( FIX::FIELD::TotalNumSecurities ); }
+      int noRelatedSym() const
+      { return getInt( FIX::FIELD::NoRelatedSym ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "AA" ) {}
+      void setSecurityReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityReqID, value ); }
+      void setSecurityResponseID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityResponseID, value ); }
+      void setSecurityRequestResult( int value )
+      { setInt( FIX::FIELD::SecurityRequestResult, value ); }
+      void setUnderlyingSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSymbol, value ); }
+      void setUnderlyingSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSymbolSfx, value ); }
+      void setUnderlyingSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityID, value ); }
+      void setUnderlyingSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityIDSource, value ); }
+      void setUnderlyingProduct( int value )
+      { setInt( FIX::FIELD::UnderlyingProduct, value ); }
+      void setUnderlyingCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCFICode, value ); }
+      void setUnderlyingSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityType, value ); }
+      void setUnderlyingMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingMaturityMonthYear, value ); }
+      void setUnderlyingMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingMaturityDate, value ); }
+      void setUnderlyingPutOrCall( int value )
+      { setInt( FIX::FIELD::UnderlyingPutOrCall, value ); }
+      void setUnderlyingCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCouponPaymentDate, value ); }
+      void setUnderlyingIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingIssueDate, value ); }
+      void setUnderlyingRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingRepoCollateralSecurityType, value ); }
+      void setUnderlyingRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::UnderlyingRepurchaseTerm, value ); }
+      void setUnderlyingRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingRepurchaseRate, value ); }
+      void setUnderlyingFactor( double value )
+      { setDouble( FIX::FIELD::UnderlyingFactor, value ); }
+      void setUnderlyingCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCreditRating, value ); }
+      void setUnderlyingInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingInstrRegistry, value ); }
+      void setUnderlyingCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCountryOfIssue, value ); }
+      void setUnderlyingStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingStateOrProvinceOfIssue, value ); }
+      void setUnderlyingLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingLocaleOfIssue, value ); }
+      void setUnderlyingRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingRedemptionDate, value ); }
+      void setUnderlyingStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingStrikePrice, value ); }
+      void setUnderlyingOptAttribute( char value )
+      { setChar( FIX::FIELD::UnderlyingOptAttribute, value ); }
+      void setUnderlyingContractMultiplier( double value )
+      { setDouble( FIX::FIELD::UnderlyingContractMultiplier, value ); }
+      void setUnderlyingCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingCouponRate, value ); }
+      void setUnderlyingSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityExchange, value ); }
+      void setUnderlyingIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingIssuer, value ); }
+      void setEncodedUnderlyingIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedUnderlyingIssuerLen, value ); }
+      void setEncodedUnderlyingIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedUnderlyingIssuer, value ); }
+      void setUnderlyingSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityDesc, value ); }
+      void setEncodedUnderlyingSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedUnderlyingSecurityDescLen, value ); }
+      void setEncodedUnderlyingSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedUnderlyingSecurityDesc, value ); }
+      void setNoUnderlyingSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoUnderlyingSecurityAltID, value ); }
+      void setTotalNumSecurities( int value )
+      { setInt( FIX::FIELD::TotalNumSecurities, value ); }
+      void setNoRelatedSym( int value )
+      { setInt( FIX::FIELD::NoRelatedSym, value ); }
+    };
   };
 
 }
@@ -66,7 +66,16 @@ namespace FIX43
     NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
       FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
       FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+    { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *this, FIX::FIELD::NoUnderlyingSecurityAltID ); }
     FIELD_SET(*this, FIX::Currency);
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
@@ -74,6 +83,192 @@ namespace FIX43
     FIELD_SET(*this, FIX::TradingSessionID);
     FIELD_SET(*this, FIX::TradingSessionSubID);
     FIELD_SET(*this, FIX::SubscriptionRequestType);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView securityReqID() const
+      { return getString( FIX::FIELD::SecurityReqID ); }
+      int securityListRequestType() const
+      { return getInt( FIX::FIELD::SecurityListRequestType ); }
+      FIX::StringView underlyingSymbol() const
+      { return getString( FIX::FIELD::UnderlyingSymbol ); }
+      FIX::StringView underlyingSymbolSfx() const
+      { return getString( FIX::FIELD::UnderlyingSymbolSfx ); }
+      FIX::StringView underlyingSecurityID() const
+      { return getString( FIX::FIELD::UnderlyingSecurityID ); }
+      FIX::StringView underlyingSecurityIDSource() const
+      { return getString( FIX::FIELD::UnderlyingSecurityIDSource ); }
+      int underlyingProduct() const
+      { return getInt( FIX::FIELD::UnderlyingProduct ); }
+      FIX::StringView underlyingCFICode() const
+      { return getString( FIX::FIELD::UnderlyingCFICode ); }
+      FIX::StringView underlyingSecurityType() const
+      { return getString( FIX::FIELD::UnderlyingSecurityType ); }
+      FIX::StringView underlyingMaturityMonthYear() const
+      { return getString( FIX::FIELD::UnderlyingMaturityMonthYear ); }
+      FIX::StringView underlyingMaturityDate() const
+      { return getString( FIX::FIELD::UnderlyingMaturityDate ); }
+      int underlyingPutOrCall() const
+      { return getInt( FIX::FIELD::UnderlyingPutOrCall ); }
+      FIX::StringView underlyingCouponPaymentDate() const
+      { return getString( FIX::FIELD::UnderlyingCouponPaymentDate ); }
+      FIX::StringView underlyingIssueDate() const
+      { return getString( FIX::FIELD::UnderlyingIssueDate ); }
+      FIX::StringView underlyingRepoCollateralSecurityType() const
+      { return getString( FIX::FIELD::UnderlyingRepoCollateralSecurityType ); }
+      int underlyingRepurchaseTerm() const
+      { return getInt( FIX::FIELD::UnderlyingRepurchaseTerm ); }
+      FIX::Decimal underlyingRepurchaseRate() const
+      { return getDecimal( FIX::FIELD::UnderlyingRepurchaseRate ); }
+      double underlyingFactor() const
+      { return getDouble( FIX::FIELD::UnderlyingFactor ); }
+      FIX::StringView underlyingCreditRating() const
+      { return getString( FIX::FIELD::UnderlyingCreditRating ); }
+      FIX::StringView underlyingInstrRegistry() const
+      { return getString( FIX::FIELD::UnderlyingInstrRegistry ); }
+      FIX::StringView underlyingCountryOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingCountryOfIssue ); }
+      FIX::StringView underlyingStateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingStateOrProvinceOfIssue ); }
+      FIX::StringView underlyingLocaleOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingLocaleOfIssue ); }
+      FIX::StringView underlyingRedemptionDate() const
+      { return getString( FIX::FIELD::UnderlyingRedemptionDate ); }
+      FIX::Decimal underlyingStrikePrice() const
+      { return getDecimal( FIX::FIELD::UnderlyingStrikePrice ); }
+      char underlyingOptAttribute() const
+      { return getChar( FIX::FIELD::UnderlyingOptAttribute ); }
+      double underlyingContractMultiplier() const
+      { return getDouble( FIX::FIELD::UnderlyingContractMultiplier ); }
+      FIX::Decimal underlyingCouponRate() const
+      { return getDecimal( FIX::FIELD::UnderlyingCouponRate ); }
+      FIX::StringView underlyingSecurityExchange() const
+      { return getString( FIX::FIELD::UnderlyingSecurityExchange ); }
+      FIX::StringView underlyingIssuer() const
+      { return getString( FIX::FIELD::UnderlyingIssuer ); }
+      int encodedUnderlyingIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedUnderlyingIssuerLen ); }
+      FIX::StringView encodedUnderlyingIssuer() const
+      { return getString( FIX::FIELD::EncodedUnderlyingIssuer ); }
+      FIX::StringView underlyingSecurityDesc() const
+      { return getString( FIX::FIELD::UnderlyingSecurityDesc ); }
+      int encodedUnderlyingSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedUnderlyingSecurityDescLen ); }
+      FIX::StringView encodedUnderlyingSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedUnderlyingSecurityDesc ); }
+      int noUnderlyingSecurityAltID() const
+      { return getInt( FIX::FIELD::NoUnderlyingSecurityAltID ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::StringView tradingSessionSubID() const
+      { return getString( FIX::FIELD::TradingSessionSubID ); }
+      FIX::SubscriptionRequestType subscriptionRequestType() const
+      { return FIX::SubscriptionRequestType( getChar( FIX::FIELD::SubscriptionRequestType ) ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "z" ) {}
+      void setSecurityReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityReqID, value ); }
+      void setSecurityListRequestType( int value )
+      { setInt( FIX::FIELD::SecurityListRequestType, value ); }
+      void setUnderlyingSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSymbol, value ); }
+      void setUnderlyingSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSymbolSfx, value ); }
+      void setUnderlyingSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityID, value ); }
+      void setUnderlyingSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityIDSource, value ); }
+      void setUnderlyingProduct( int value )
+      { setInt( FIX::FIELD::UnderlyingProduct, value ); }
+      void setUnderlyingCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCFICode, value ); }
+      void setUnderlyingSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityType, value ); }
+      void setUnderlyingMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingMaturityMonthYear, value ); }
+      void setUnderlyingMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingMaturityDate, value ); }
+      void setUnderlyingPutOrCall( int value )
+      { setInt( FIX::FIELD::UnderlyingPutOrCall, value ); }
+      void setUnderlyingCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCouponPaymentDate, value ); }
+      void setUnderlyingIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingIssueDate, value ); }
+      void setUnderlyingRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingRepoCollateralSecurityType, value ); }
+      void setUnderlyingRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::UnderlyingRepurchaseTerm, value ); }
+      void setUnderlyingRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingRepurchaseRate, value ); }
+      void setUnderlyingFactor( double value )
+      { setDouble( FIX::FIELD::UnderlyingFactor, value ); }
+      void setUnderlyingCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCreditRating, value ); }
+      void setUnderlyingInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingInstrRegistry, value ); }
+      void setUnderlyingCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCountryOfIssue, value ); }
+      void setUnderlyingStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingStateOrProvinceOfIssue, value ); }
+      void setUnderlyingLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingLocaleOfIssue, value ); }
+      void setUnderlyingRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingRedemptionDate, value ); }
+      void setUnderlyingStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingStrikePrice, value ); }
+      void setUnderlyingOptAttribute( char value )
+      { setChar( FIX::FIELD::UnderlyingOptAttribute, value ); }
+      void setUnderlyingContractMultiplier( double value )
+      { setDouble( FIX::FIELD::UnderlyingContractMultiplier, value ); }
+      void setUnderlyingCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingCouponRate, value ); }
+      void setUnderlyingSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityExchange, value ); }
+      void setUnderlyingIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingIssuer, value ); }
+      void setEncodedUnderlyingIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedUnderlyingIssuerLen, value ); }
+      void setEncodedUnderlyingIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedUnderlyingIssuer, value ); }
+      void setUnderlyingSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityDesc, value ); }
+      void setEncodedUnderlyingSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedUnderlyingSecurityDescLen, value ); }
+      void setEncodedUnderlyingSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedUnderlyingSecurityDesc, value ); }
+      void setNoUnderlyingSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoUnderlyingSecurityAltID, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setTradingSessionSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionSubID, value ); }
+      void setSubscriptionRequestType( char value )
+      { setChar( FIX::FIELD::SubscriptionRequestType, value ); }
+    };
   };
 
 }
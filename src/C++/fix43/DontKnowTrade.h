@@ -70,7 +70,16 @@ namespace FIX43
     NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+    { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
     FIELD_SET(*this, FIX::Side);
     FIELD_SET(*this, FIX::OrderQty);
     FIELD_SET(*this, FIX::CashOrderQty);
@@ -82,6 +91,208 @@ namespace FIX43
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView execID() const
+      { return getString( FIX::FIELD::ExecID ); }
+      FIX::DKReason dKReason() const
+      { return FIX::DKReason( getChar( FIX::FIELD::DKReason ) ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView securityIDSource() const
+      { return getString( FIX::FIELD::SecurityIDSource ); }
+      int product() const
+      { return getInt( FIX::FIELD::Product ); }
+      FIX::StringView cFICode() const
+      { return getString( FIX::FIELD::CFICode ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDate() const
+      { return getString( FIX::FIELD::MaturityDate ); }
+      FIX::StringView couponPaymentDate() const
+      { return getString( FIX::FIELD::CouponPaymentDate ); }
+      FIX::StringView issueDate() const
+      { return getString( FIX::FIELD::IssueDate ); }
+      FIX::StringView repoCollateralSecurityType() const
+      { return getString( FIX::FIELD::RepoCollateralSecurityType ); }
+      int repurchaseTerm() const
+      { return getInt( FIX::FIELD::RepurchaseTerm ); }
+      FIX::Decimal repurchaseRate() const
+      { return getDecimal( FIX::FIELD::RepurchaseRate ); }
+      double factor() const
+      { return getDouble( FIX::FIELD::Factor ); }
+      FIX::StringView creditRating() const
+      { return getString( FIX::FIELD::CreditRating ); }
+      FIX::StringView instrRegistry() const
+      { return getString( FIX::FIELD::InstrRegistry ); }
+      FIX::StringView countryOfIssue() const
+      { return getString( FIX::FIELD::CountryOfIssue ); }
+      FIX::StringView stateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::StateOrProvinceOfIssue ); }
+      FIX::StringView localeOfIssue() const
+      { return getString( FIX::FIELD::LocaleOfIssue ); }
+      FIX::StringView redemptionDate() const
+      { return getString( FIX::FIELD::RedemptionDate ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      int noSecurityAltID() const
+      { return getInt( FIX::FIELD::NoSecurityAltID ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::Decimal orderQty() const
+      { return getDecimal( FIX::FIELD::OrderQty ); }
+      FIX::Decimal cashOrderQty() const
+      { return getDecimal( FIX::FIELD::CashOrderQty ); }
+      FIX::Decimal orderPercent() const
+      { return getDecimal( FIX::FIELD::OrderPercent ); }
+      FIX::RoundingDirection roundingDirection() const
+      { return FIX::RoundingDirection( getChar( FIX::FIELD::RoundingDirection ) ); }
+      double roundingModulus() const
+      { return getDouble( FIX::FIELD::RoundingModulus ); }
+      FIX::Decimal lastQty() const
+      { return getDecimal( FIX::FIELD::LastQty ); }
+      FIX::Decimal lastPx() const
+      { return getDecimal( FIX::FIELD::LastPx ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "Q" ) {}
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setExecID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecID, value ); }
+      void setDKReason( char value )
+      { setChar( FIX::FIELD::DKReason, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityIDSource, value ); }
+      void setProduct( int value )
+      { setInt( FIX::FIELD::Product, value ); }
+      void setCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::CFICode, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDate, value ); }
+      void setCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::CouponPaymentDate, value ); }
+      void setIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::IssueDate, value ); }
+      void setRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RepoCollateralSecurityType, value ); }
+      void setRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::RepurchaseTerm, value ); }
+      void setRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::RepurchaseRate, value ); }
+      void setFactor( double value )
+      { setDouble( FIX::FIELD::Factor, value ); }
+      void setCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::CreditRating, value ); }
+      void setInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::InstrRegistry, value ); }
+      void setCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::CountryOfIssue, value ); }
+      void setStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::StateOrProvinceOfIssue, value ); }
+      void setLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::LocaleOfIssue, value ); }
+      void setRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::RedemptionDate, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setNoSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoSecurityAltID, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderQty, value ); }
+      void setCashOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CashOrderQty, value ); }
+      void setOrderPercent( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderPercent, value ); }
+      void setRoundingDirection( char value )
+      { setChar( FIX::FIELD::RoundingDirection, value ); }
+      void setRoundingModulus( double value )
+      { setDouble( FIX::FIELD::RoundingModulus, value ); }
+      void setLastQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastQty, value ); }
+      void setLastPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastPx, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+    };
   };
 
 }
@@ -43,7 +43,16 @@ namespace FIX43
     NoRoutingIDs() : FIX::Group(215,216,FIX::message_order(216,217,0)) {}
       FIELD_SET(*this, FIX::RoutingType);
       FIELD_SET(*this, FIX::RoutingID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::RoutingType);
+        FIELD_VIEW(*m_pMap, FIX::RoutingID);
+      };
     };
+    FIX::GroupView<NoRoutingIDs::View> noRoutingIDs() const
+    { return FIX::GroupView<NoRoutingIDs::View>( *this, FIX::FIELD::NoRoutingIDs ); }
     FIELD_SET(*this, FIX::NoRelatedSym);
     class NoRelatedSym: public FIX::Group
     {
@@ -88,8 +97,59 @@ namespace FIX43
       NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+        };
+      };
+      FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+      { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::Product);
+        FIELD_VIEW(*m_pMap, FIX::CFICode);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::IssueDate);
+        FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::Factor);
+        FIELD_VIEW(*m_pMap, FIX::CreditRating);
+        FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
       };
     };
+    FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+    { return FIX::GroupView<NoRelatedSym::View>( *this, FIX::FIELD::NoRelatedSym ); }
     FIELD_SET(*this, FIX::LinesOfText);
     class LinesOfText: public FIX::Group
     {
@@ -98,6 +158,84 @@ namespace FIX43
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+      };
+    };
+    FIX::GroupView<LinesOfText::View> linesOfText() const
+    { return FIX::GroupView<LinesOfText::View>( *this, FIX::FIELD::LinesOfText ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView emailThreadID() const
+      { return getString( FIX::FIELD::EmailThreadID ); }
+      FIX::EmailType emailType() const
+      { return FIX::EmailType( getChar( FIX::FIELD::EmailType ) ); }
+      FIX::StringView origTime() const
+      { return getString( FIX::FIELD::OrigTime ); }
+      FIX::StringView subject() const
+      { return getString( FIX::FIELD::Subject ); }
+      int encodedSubjectLen() const
+      { return getInt( FIX::FIELD::EncodedSubjectLen ); }
+      FIX::StringView encodedSubject() const
+      { return getString( FIX::FIELD::EncodedSubject ); }
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      int rawDataLength() const
+      { return getInt( FIX::FIELD::RawDataLength ); }
+      FIX::StringView rawData() const
+      { return getString( FIX::FIELD::RawData ); }
+      int noRoutingIDs() const
+      { return getInt( FIX::FIELD::NoRoutingIDs ); }
+      int noRelatedSym() const
+      { return getInt( FIX::FIELD::NoRelatedSym ); }
+      int linesOfText() const
+      { return getInt( FIX::FIELD::LinesOfText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "C" ) {}
+      void setEmailThreadID( const FIX::StringView& value )
+      { setString( FIX::FIELD::EmailThreadID, value ); }
+      void setEmailType( char value )
+      { setChar( FIX::FIELD::EmailType, value ); }
+      void setOrigTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrigTime, value ); }
+      void setOrigTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::OrigTime, value, precision ); }
+      void setSubject( const FIX::StringView& value )
+      { setString( FIX::FIELD::Subject, value ); }
+      void setEncodedSubjectLen( int value )
+      { setInt( FIX::FIELD::EncodedSubjectLen, value ); }
+      void setEncodedSubject( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSubject, value ); }
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setRawDataLength( int value )
+      { setInt( FIX::FIELD::RawDataLength, value ); }
+      void setRawData( const FIX::StringView& value )
+      { setString( FIX::FIELD::RawData, value ); }
+      void setNoRoutingIDs( int value )
+      { setInt( FIX::FIELD::NoRoutingIDs, value ); }
+      void setNoRelatedSym( int value )
+      { setInt( FIX::FIELD::NoRelatedSym, value ); }
+      void setLinesOfText( int value )
+      { setInt( FIX::FIELD::LinesOfText, value ); }
     };
   };
 
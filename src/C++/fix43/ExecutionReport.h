@@ -52,7 +52,18 @@ namespace FIX43
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
       FIELD_SET(*this, FIX::PartySubID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PartyID);
+        FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PartyRole);
+        FIELD_VIEW(*m_pMap, FIX::PartySubID);
+      };
     };
+    FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+    { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
     FIELD_SET(*this, FIX::TradeOriginationDate);
     FIELD_SET(*this, FIX::ListID);
     FIELD_SET(*this, FIX::CrossID);
@@ -113,7 +124,16 @@ namespace FIX43
     NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+    { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
     FIELD_SET(*this, FIX::Side);
     FIELD_SET(*this, FIX::NoStipulations);
     class NoStipulations: public FIX::Group
@@ -122,7 +142,16 @@ namespace FIX43
     NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
       FIELD_SET(*this, FIX::StipulationType);
       FIELD_SET(*this, FIX::StipulationValue);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::StipulationType);
+        FIELD_VIEW(*m_pMap, FIX::StipulationValue);
+      };
     };
+    FIX::GroupView<NoStipulations::View> noStipulations() const
+    { return FIX::GroupView<NoStipulations::View>( *this, FIX::FIELD::NoStipulations ); }
     FIELD_SET(*this, FIX::QuantityType);
     FIELD_SET(*this, FIX::OrderQty);
     FIELD_SET(*this, FIX::CashOrderQty);
@@ -225,7 +254,19 @@ namespace FIX43
       FIELD_SET(*this, FIX::ContraTradeQty);
       FIELD_SET(*this, FIX::ContraTradeTime);
       FIELD_SET(*this, FIX::ContraLegRefID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ContraBroker);
+        FIELD_VIEW(*m_pMap, FIX::ContraTrader);
+        FIELD_VIEW(*m_pMap, FIX::ContraTradeQty);
+        FIELD_VIEW(*m_pMap, FIX::ContraTradeTime);
+        FIELD_VIEW(*m_pMap, FIX::ContraLegRefID);
+      };
     };
+    FIX::GroupView<NoContraBrokers::View> noContraBrokers() const
+    { return FIX::GroupView<NoContraBrokers::View>( *this, FIX::FIELD::NoContraBrokers ); }
     FIELD_SET(*this, FIX::NoContAmts);
     class NoContAmts: public FIX::Group
     {
@@ -234,7 +275,17 @@ namespace FIX43
       FIELD_SET(*this, FIX::ContAmtType);
       FIELD_SET(*this, FIX::ContAmtValue);
       FIELD_SET(*this, FIX::ContAmtCurr);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ContAmtType);
+        FIELD_VIEW(*m_pMap, FIX::ContAmtValue);
+        FIELD_VIEW(*m_pMap, FIX::ContAmtCurr);
+      };
     };
+    FIX::GroupView<NoContAmts::View> noContAmts() const
+    { return FIX::GroupView<NoContAmts::View>( *this, FIX::FIELD::NoContAmts ); }
     FIELD_SET(*this, FIX::NoLegs);
     class NoLegs: public FIX::Group
     {
@@ -281,7 +332,16 @@ namespace FIX43
       NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
         FIELD_SET(*this, FIX::LegSecurityAltID);
         FIELD_SET(*this, FIX::LegSecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+      { return FIX::GroupView<NoLegSecurityAltID::View>( *this, FIX::FIELD::NoLegSecurityAltID ); }
       FIELD_SET(*this, FIX::LegPositionEffect);
       FIELD_SET(*this, FIX::LegCoveredOrUncovered);
       FIELD_SET(*this, FIX::NoNestedPartyIDs);
@@ -293,12 +353,737 @@ namespace FIX43
         FIELD_SET(*this, FIX::NestedPartyIDSource);
         FIELD_SET(*this, FIX::NestedPartyRole);
         FIELD_SET(*this, FIX::NestedPartySubID);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyID);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartySubID);
+        };
       };
+      FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+      { return FIX::GroupView<NoNestedPartyIDs::View>( *this, FIX::FIELD::NoNestedPartyIDs ); }
       FIELD_SET(*this, FIX::LegRefID);
       FIELD_SET(*this, FIX::LegPrice);
       FIELD_SET(*this, FIX::LegSettlmntTyp);
       FIELD_SET(*this, FIX::LegFutSettDate);
       FIELD_SET(*this, FIX::LegLastPx);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::LegSymbol);
+        FIELD_VIEW(*m_pMap, FIX::LegSymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::LegProduct);
+        FIELD_VIEW(*m_pMap, FIX::LegCFICode);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::LegMaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::LegMaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::LegCouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::LegIssueDate);
+        FIELD_VIEW(*m_pMap, FIX::LegRepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::LegRepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::LegRepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::LegFactor);
+        FIELD_VIEW(*m_pMap, FIX::LegCreditRating);
+        FIELD_VIEW(*m_pMap, FIX::LegInstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::LegCountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegStateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegLocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegRedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::LegStrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::LegOptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::LegContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::LegCouponRate);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::LegIssuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuer);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::LegRatioQty);
+        FIELD_VIEW(*m_pMap, FIX::LegSide);
+        FIELD_VIEW(*m_pMap, FIX::NoLegSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::LegPositionEffect);
+        FIELD_VIEW(*m_pMap, FIX::LegCoveredOrUncovered);
+        FIELD_VIEW(*m_pMap, FIX::NoNestedPartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::LegRefID);
+        FIELD_VIEW(*m_pMap, FIX::LegPrice);
+        FIELD_VIEW(*m_pMap, FIX::LegSettlmntTyp);
+        FIELD_VIEW(*m_pMap, FIX::LegFutSettDate);
+        FIELD_VIEW(*m_pMap, FIX::LegLastPx);
+        FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+        { return FIX::GroupView<NoLegSecurityAltID::View>( *m_pMap, FIX::FIELD::NoLegSecurityAltID ); }
+        FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+        { return FIX::GroupView<NoNestedPartyIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartyIDs ); }
+      };
+    };
+    FIX::GroupView<NoLegs::View> noLegs() const
+    { return FIX::GroupView<NoLegs::View>( *this, FIX::FIELD::NoLegs ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView secondaryOrderID() const
+      { return getString( FIX::FIELD::SecondaryOrderID ); }
+      FIX::StringView secondaryClOrdID() const
+      { return getString( FIX::FIELD::SecondaryClOrdID ); }
+      FIX::StringView secondaryExecID() const
+      { return getString( FIX::FIELD::SecondaryExecID ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      FIX::StringView origClOrdID() const
+      { return getString( FIX::FIELD::OrigClOrdID ); }
+      FIX::StringView clOrdLinkID() const
+      { return getString( FIX::FIELD::ClOrdLinkID ); }
+      int noPartyIDs() const
+      { return getInt( FIX::FIELD::NoPartyIDs ); }
+      FIX::StringView tradeOriginationDate() const
+      { return getString( FIX::FIELD::TradeOriginationDate ); }
+      FIX::StringView listID() const
+      { return getString( FIX::FIELD::ListID ); }
+      FIX::StringView crossID() const
+      { return getString( FIX::FIELD::CrossID ); }
+      FIX::StringView origCrossID() const
+      { return getString( FIX::FIELD::OrigCrossID ); }
+      int crossType() const
+      { return getInt( FIX::FIELD::CrossType ); }
+      FIX::StringView execID() const
+      { return getString( FIX::FIELD::ExecID ); }
+      FIX::StringView execRefID() const
+      { return getString( FIX::FIELD::ExecRefID ); }
+      FIX::ExecType execType() const
+      { return FIX::ExecType( getChar( FIX::FIELD::ExecType ) ); }
+      FIX::OrdStatus ordStatus() const
+      { return FIX::OrdStatus( getChar( FIX::FIELD::OrdStatus ) ); }
+      bool workingIndicator() const
+      { return getBool( FIX::FIELD::WorkingIndicator ); }
+      int ordRejReason() const
+      { return getInt( FIX::FIELD::OrdRejReason ); }
+      int execRestatementReason() const
+      { return getInt( FIX::FIELD::ExecRestatementReason ); }
+      FIX::StringView account() const
+      { return getString( FIX::FIELD::Account ); }
+      int accountType() const
+      { return getInt( FIX::FIELD::AccountType ); }
+      FIX::DayBookingInst dayBookingInst() const
+      { return FIX::DayBookingInst( getChar( FIX::FIELD::DayBookingInst ) ); }
+      FIX::BookingUnit bookingUnit() const
+      { return FIX::BookingUnit( getChar( FIX::FIELD::BookingUnit ) ); }
+      FIX::PreallocMethod preallocMethod() const
+      { return FIX::PreallocMethod( getChar( FIX::FIELD::PreallocMethod ) ); }
+      FIX::SettlmntTyp settlmntTyp() const
+      { return FIX::SettlmntTyp( getChar( FIX::FIELD::SettlmntTyp ) ); }
+      FIX::StringView futSettDate() const
+      { return getString( FIX::FIELD::FutSettDate ); }
+      FIX::CashMargin cashMargin() const
+      { return FIX::CashMargin( getChar( FIX::FIELD::CashMargin ) ); }
+      FIX::StringView clearingFeeIndicator() const
+      { return getString( FIX::FIELD::ClearingFeeIndicator ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView securityIDSource() const
+      { return getString( FIX::FIELD::SecurityIDSource ); }
+      int product() const
+      { return getInt( FIX::FIELD::Product ); }
+      FIX::StringView cFICode() const
+      { return getString( FIX::FIELD::CFICode ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDate() const
+      { return getString( FIX::FIELD::MaturityDate ); }
+      FIX::StringView couponPaymentDate() const
+      { return getString( FIX::FIELD::CouponPaymentDate ); }
+      FIX::StringView issueDate() const
+      { return getString( FIX::FIELD::IssueDate ); }
+      FIX::StringView repoCollateralSecurityType() const
+      { return getString( FIX::FIELD::RepoCollateralSecurityType ); }
+      int repurchaseTerm() const
+      { return getInt( FIX::FIELD::RepurchaseTerm ); }
+      FIX::Decimal repurchaseRate() const
+      { return getDecimal( FIX::FIELD::RepurchaseRate ); }
+      double factor() const
+      { return getDouble( FIX::FIELD::Factor ); }
+      FIX::StringView creditRating() const
+      { return getString( FIX::FIELD::CreditRating ); }
+      FIX::StringView instrRegistry() const
+      { return getString( FIX::FIELD::InstrRegistry ); }
+      FIX::StringView countryOfIssue() const
+      { return getString( FIX::FIELD::CountryOfIssue ); }
+      FIX::StringView stateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::StateOrProvinceOfIssue ); }
+      FIX::StringView localeOfIssue() const
+      { return getString( FIX::FIELD::LocaleOfIssue ); }
+      FIX::StringView redemptionDate() const
+      { return getString( FIX::FIELD::RedemptionDate ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      int noSecurityAltID() const
+      { return getInt( FIX::FIELD::NoSecurityAltID ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      int noStipulations() const
+      { return getInt( FIX::FIELD::NoStipulations ); }
+      int quantityType() const
+      { return getInt( FIX::FIELD::QuantityType ); }
+      FIX::Decimal orderQty() const
+      { return getDecimal( FIX::FIELD::OrderQty ); }
+      FIX::Decimal cashOrderQty() const
+      { return getDecimal( FIX::FIELD::CashOrderQty ); }
+      FIX::Decimal orderPercent() const
+      { return getDecimal( FIX::FIELD::OrderPercent ); }
+      FIX::RoundingDirection roundingDirection() const
+      { return FIX::RoundingDirection( getChar( FIX::FIELD::RoundingDirection ) ); }
+      double roundingModulus() const
+      { return getDouble( FIX::FIELD::RoundingModulus ); }
+      FIX::OrdType ordType() const
+      { return FIX::OrdType( getChar( FIX::FIELD::OrdType ) ); }
+      int priceType() const
+      { return getInt( FIX::FIELD::PriceType ); }
+      FIX::Decimal price() const
+      { return getDecimal( FIX::FIELD::Price ); }
+      FIX::Decimal stopPx() const
+      { return getDecimal( FIX::FIELD::StopPx ); }
+      double pegDifference() const
+      { return getDouble( FIX::FIELD::PegDifference ); }
+      FIX::DiscretionInst discretionInst() const
+      { return FIX::DiscretionInst( getChar( FIX::FIELD::DiscretionInst ) ); }
+      double discretionOffset() const
+      { return getDouble( FIX::FIELD::DiscretionOffset ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::StringView complianceID() const
+      { return getString( FIX::FIELD::ComplianceID ); }
+      bool solicitedFlag() const
+      { return getBool( FIX::FIELD::SolicitedFlag ); }
+      FIX::TimeInForce timeInForce() const
+      { return FIX::TimeInForce( getChar( FIX::FIELD::TimeInForce ) ); }
+      FIX::StringView effectiveTime() const
+      { return getString( FIX::FIELD::EffectiveTime ); }
+      FIX::StringView expireDate() const
+      { return getString( FIX::FIELD::ExpireDate ); }
+      FIX::StringView expireTime() const
+      { return getString( FIX::FIELD::ExpireTime ); }
+      FIX::StringView execInst() const
+      { return getString( FIX::FIELD::ExecInst ); }
+      FIX::OrderCapacity orderCapacity() const
+      { return FIX::OrderCapacity( getChar( FIX::FIELD::OrderCapacity ) ); }
+      FIX::StringView orderRestrictions() const
+      { return getString( FIX::FIELD::OrderRestrictions ); }
+      int custOrderCapacity() const
+      { return getInt( FIX::FIELD::CustOrderCapacity ); }
+      FIX::Rule80A rule80A() const
+      { return FIX::Rule80A( getChar( FIX::FIELD::Rule80A ) ); }
+      FIX::Decimal lastQty() const
+      { return getDecimal( FIX::FIELD::LastQty ); }
+      FIX::Decimal underlyingLastQty() const
+      { return getDecimal( FIX::FIELD::UnderlyingLastQty ); }
+      FIX::Decimal lastPx() const
+      { return getDecimal( FIX::FIELD::LastPx ); }
+      FIX::Decimal underlyingLastPx() const
+      { return getDecimal( FIX::FIELD::UnderlyingLastPx ); }
+      FIX::Decimal lastSpotRate() const
+      { return getDecimal( FIX::FIELD::LastSpotRate ); }
+      double lastForwardPoints() const
+      { return getDouble( FIX::FIELD::LastForwardPoints ); }
+      FIX::StringView lastMkt() const
+      { return getString( FIX::FIELD::LastMkt ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::StringView tradingSessionSubID() const
+      { return getString( FIX::FIELD::TradingSessionSubID ); }
+      FIX::LastCapacity lastCapacity() const
+      { return FIX::LastCapacity( getChar( FIX::FIELD::LastCapacity ) ); }
+      FIX::Decimal leavesQty() const
+      { return getDecimal( FIX::FIELD::LeavesQty ); }
+      FIX::Decimal cumQty() const
+      { return getDecimal( FIX::FIELD::CumQty ); }
+      FIX::Decimal avgPx() const
+      { return getDecimal( FIX::FIELD::AvgPx ); }
+      FIX::Decimal dayOrderQty() const
+      { return getDecimal( FIX::FIELD::DayOrderQty ); }
+      FIX::Decimal dayCumQty() const
+      { return getDecimal( FIX::FIELD::DayCumQty ); }
+      FIX::Decimal dayAvgPx() const
+      { return getDecimal( FIX::FIELD::DayAvgPx ); }
+      int gTBookingInst() const
+      { return getInt( FIX::FIELD::GTBookingInst ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      bool reportToExch() const
+      { return getBool( FIX::FIELD::ReportToExch ); }
+      FIX::Decimal commission() const
+      { return getDecimal( FIX::FIELD::Commission ); }
+      FIX::CommType commType() const
+      { return FIX::CommType( getChar( FIX::FIELD::CommType ) ); }
+      FIX::StringView commCurrency() const
+      { return getString( FIX::FIELD::CommCurrency ); }
+      FIX::FundRenewWaiv fundRenewWaiv() const
+      { return FIX::FundRenewWaiv( getChar( FIX::FIELD::FundRenewWaiv ) ); }
+      double spread() const
+      { return getDouble( FIX::FIELD::Spread ); }
+      FIX::StringView benchmarkCurveCurrency() const
+      { return getString( FIX::FIELD::BenchmarkCurveCurrency ); }
+      FIX::StringView benchmarkCurveName() const
+      { return getString( FIX::FIELD::BenchmarkCurveName ); }
+      FIX::StringView benchmarkCurvePoint() const
+      { return getString( FIX::FIELD::BenchmarkCurvePoint ); }
+      FIX::StringView yieldType() const
+      { return getString( FIX::FIELD::YieldType ); }
+      FIX::Decimal yield() const
+      { return getDecimal( FIX::FIELD::Yield ); }
+      FIX::Decimal grossTradeAmt() const
+      { return getDecimal( FIX::FIELD::GrossTradeAmt ); }
+      int numDaysInterest() const
+      { return getInt( FIX::FIELD::NumDaysInterest ); }
+      FIX::StringView exDate() const
+      { return getString( FIX::FIELD::ExDate ); }
+      FIX::Decimal accruedInterestRate() const
+      { return getDecimal( FIX::FIELD::AccruedInterestRate ); }
+      FIX::Decimal accruedInterestAmt() const
+      { return getDecimal( FIX::FIELD::AccruedInterestAmt ); }
+      bool tradedFlatSwitch() const
+      { return getBool( FIX::FIELD::TradedFlatSwitch ); }
+      FIX::StringView basisFeatureDate() const
+      { return getString( FIX::FIELD::BasisFeatureDate ); }
+      FIX::Decimal basisFeaturePrice() const
+      { return getDecimal( FIX::FIELD::BasisFeaturePrice ); }
+      FIX::Decimal concession() const
+      { return getDecimal( FIX::FIELD::Concession ); }
+      FIX::Decimal totalTakedown() const
+      { return getDecimal( FIX::FIELD::TotalTakedown ); }
+      FIX::Decimal netMoney() const
+      { return getDecimal( FIX::FIELD::NetMoney ); }
+      FIX::Decimal settlCurrAmt() const
+      { return getDecimal( FIX::FIELD::SettlCurrAmt ); }
+      FIX::StringView settlCurrency() const
+      { return getString( FIX::FIELD::SettlCurrency ); }
+      double settlCurrFxRate() const
+      { return getDouble( FIX::FIELD::SettlCurrFxRate ); }
+      FIX::SettlCurrFxRateCalc settlCurrFxRateCalc() const
+      { return FIX::SettlCurrFxRateCalc( getChar( FIX::FIELD::SettlCurrFxRateCalc ) ); }
+      FIX::HandlInst handlInst() const
+      { return FIX::HandlInst( getChar( FIX::FIELD::HandlInst ) ); }
+      FIX::Decimal minQty() const
+      { return getDecimal( FIX::FIELD::MinQty ); }
+      FIX::Decimal maxFloor() const
+      { return getDecimal( FIX::FIELD::MaxFloor ); }
+      FIX::PositionEffect positionEffect() const
+      { return FIX::PositionEffect( getChar( FIX::FIELD::PositionEffect ) ); }
+      FIX::Decimal maxShow() const
+      { return getDecimal( FIX::FIELD::MaxShow ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      FIX::StringView futSettDate2() const
+      { return getString( FIX::FIELD::FutSettDate2 ); }
+      FIX::Decimal orderQty2() const
+      { return getDecimal( FIX::FIELD::OrderQty2 ); }
+      double lastForwardPoints2() const
+      { return getDouble( FIX::FIELD::LastForwardPoints2 ); }
+      FIX::MultiLegReportingType multiLegReportingType() const
+      { return FIX::MultiLegReportingType( getChar( FIX::FIELD::MultiLegReportingType ) ); }
+      FIX::CancellationRights cancellationRights() const
+      { return FIX::CancellationRights( getChar( FIX::FIELD::CancellationRights ) ); }
+      FIX::MoneyLaunderingStatus moneyLaunderingStatus() const
+      { return FIX::MoneyLaunderingStatus( getChar( FIX::FIELD::MoneyLaunderingStatus ) ); }
+      FIX::StringView registID() const
+      { return getString( FIX::FIELD::RegistID ); }
+      FIX::StringView designation() const
+      { return getString( FIX::FIELD::Designation ); }
+      FIX::StringView transBkdTime() const
+      { return getString( FIX::FIELD::TransBkdTime ); }
+      FIX::StringView execValuationPoint() const
+      { return getString( FIX::FIELD::ExecValuationPoint ); }
+      FIX::ExecPriceType execPriceType() const
+      { return FIX::ExecPriceType( getChar( FIX::FIELD::ExecPriceType ) ); }
+      double execPriceAdjustment() const
+      { return getDouble( FIX::FIELD::ExecPriceAdjustment ); }
+      int priorityIndicator() const
+      { return getInt( FIX::FIELD::PriorityIndicator ); }
+      double priceImprovement() const
+      { return getDouble( FIX::FIELD::PriceImprovement ); }
+      int noContraBrokers() const
+      { return getInt( FIX::FIELD::NoContraBrokers ); }
+      int noContAmts() const
+      { return getInt( FIX::FIELD::NoContAmts ); }
+      int noLegs() const
+      { return getInt( FIX::FIELD::NoLegs ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "8" ) {}
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setSecondaryOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecondaryOrderID, value ); }
+      void setSecondaryClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecondaryClOrdID, value ); }
+      void setSecondaryExecID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecondaryExecID, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setOrigClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrigClOrdID, value ); }
+      void setClOrdLinkID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdLinkID, value ); }
+      void setNoPartyIDs( int value )
+      { setInt( FIX::FIELD::NoPartyIDs, value ); }
+      void setTradeOriginationDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeOriginationDate, value ); }
+      void setListID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListID, value ); }
+      void setCrossID( const FIX::StringView& value )
+      { setString( FIX::FIELD::CrossID, value ); }
+      void setOrigCrossID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrigCrossID, value ); }
+      void setCrossType( int value )
+      { setInt( FIX::FIELD::CrossType, value ); }
+      void setExecID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecID, value ); }
+      void setExecRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecRefID, value ); }
+      void setExecType( char value )
+      { setChar( FIX::FIELD::ExecType, value ); }
+      void setOrdStatus( char value )
+      { setChar( FIX::FIELD::OrdStatus, value ); }
+      void setWorkingIndicator( bool value )
+      { setBool( FIX::FIELD::WorkingIndicator, value ); }
+      void setOrdRejReason( int value )
+      { setInt( FIX::FIELD::OrdRejReason, value ); }
+      void setExecRestatementReason( int value )
+      { setInt( FIX::FIELD::ExecRestatementReason, value ); }
+      void setAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::Account, value ); }
+      void setAccountType( int value )
+      { setInt( FIX::FIELD::AccountType, value ); }
+      void setDayBookingInst( char value )
+      { setChar( FIX::FIELD::DayBookingInst, value ); }
+      void setBookingUnit( char value )
+      { setChar( FIX::FIELD::BookingUnit, value ); }
+      void setPreallocMethod( char value )
+      { setChar( FIX::FIELD::PreallocMethod, value ); }
+      void setSettlmntTyp( char value )
+      { setChar( FIX::FIELD::SettlmntTyp, value ); }
+      void setFutSettDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate, value ); }
+      void setCashMargin( char value )
+      { setChar( FIX::FIELD::CashMargin, value ); }
+      void setClearingFeeIndicator( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClearingFeeIndicator, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityIDSource, value ); }
+      void setProduct( int value )
+      { setInt( FIX::FIELD::Product, value ); }
+      void setCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::CFICode, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDate, value ); }
+      void setCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::CouponPaymentDate, value ); }
+      void setIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::IssueDate, value ); }
+      void setRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RepoCollateralSecurityType, value ); }
+      void setRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::RepurchaseTerm, value ); }
+      void setRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::RepurchaseRate, value ); }
+      void setFactor( double value )
+      { setDouble( FIX::FIELD::Factor, value ); }
+      void setCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::CreditRating, value ); }
+      void setInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::InstrRegistry, value ); }
+      void setCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::CountryOfIssue, value ); }
+      void setStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::StateOrProvinceOfIssue, value ); }
+      void setLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::LocaleOfIssue, value ); }
+      void setRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::RedemptionDate, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setNoSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoSecurityAltID, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setNoStipulations( int value )
+      { setInt( FIX::FIELD::NoStipulations, value ); }
+      void setQuantityType( int value )
+      { setInt( FIX::FIELD::QuantityType, value ); }
+      void setOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderQty, value ); }
+      void setCashOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CashOrderQty, value ); }
+      void setOrderPercent( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderPercent, value ); }
+      void setRoundingDirection( char value )
+      { setChar( FIX::FIELD::RoundingDirection, value ); }
+      void setRoundingModulus( double value )
+      { setDouble( FIX::FIELD::RoundingModulus, value ); }
+      void setOrdType( char value )
+      { setChar( FIX::FIELD::OrdType, value ); }
+      void setPriceType( int value )
+      { setInt( FIX::FIELD::PriceType, value ); }
+      void setPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Price, value ); }
+      void setStopPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StopPx, value ); }
+      void setPegDifference( double value )
+      { setDouble( FIX::FIELD::PegDifference, value ); }
+      void setDiscretionInst( char value )
+      { setChar( FIX::FIELD::DiscretionInst, value ); }
+      void setDiscretionOffset( double value )
+      { setDouble( FIX::FIELD::DiscretionOffset, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setComplianceID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ComplianceID, value ); }
+      void setSolicitedFlag( bool value )
+      { setBool( FIX::FIELD::SolicitedFlag, value ); }
+      void setTimeInForce( char value )
+      { setChar( FIX::FIELD::TimeInForce, value ); }
+      void setEffectiveTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::EffectiveTime, value ); }
+      void setEffectiveTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::EffectiveTime, value, precision ); }
+      void setExpireDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExpireDate, value ); }
+      void setExpireTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExpireTime, value ); }
+      void setExpireTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::ExpireTime, value, precision ); }
+      void setExecInst( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecInst, value ); }
+      void setOrderCapacity( char value )
+      { setChar( FIX::FIELD::OrderCapacity, value ); }
+      void setOrderRestrictions( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderRestrictions, value ); }
+      void setCustOrderCapacity( int value )
+      { setInt( FIX::FIELD::CustOrderCapacity, value ); }
+      void setRule80A( char value )
+      { setChar( FIX::FIELD::Rule80A, value ); }
+      void setLastQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastQty, value ); }
+      void setUnderlyingLastQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingLastQty, value ); }
+      void setLastPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastPx, value ); }
+      void setUnderlyingLastPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingLastPx, value ); }
+      void setLastSpotRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastSpotRate, value ); }
+      void setLastForwardPoints( double value )
+      { setDouble( FIX::FIELD::LastForwardPoints, value ); }
+      void setLastMkt( const FIX::StringView& value )
+      { setString( FIX::FIELD::LastMkt, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setTradingSessionSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionSubID, value ); }
+      void setLastCapacity( char value )
+      { setChar( FIX::FIELD::LastCapacity, value ); }
+      void setLeavesQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LeavesQty, value ); }
+      void setCumQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CumQty, value ); }
+      void setAvgPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AvgPx, value ); }
+      void setDayOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DayOrderQty, value ); }
+      void setDayCumQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DayCumQty, value ); }
+      void setDayAvgPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DayAvgPx, value ); }
+      void setGTBookingInst( int value )
+      { setInt( FIX::FIELD::GTBookingInst, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setReportToExch( bool value )
+      { setBool( FIX::FIELD::ReportToExch, value ); }
+      void setCommission( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Commission, value ); }
+      void setCommType( char value )
+      { setChar( FIX::FIELD::CommType, value ); }
+      void setCommCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::CommCurrency, value ); }
+      void setFundRenewWaiv( char value )
+      { setChar( FIX::FIELD::FundRenewWaiv, value ); }
+      void setSpread( double value )
+      { setDouble( FIX::FIELD::Spread, value ); }
+      void setBenchmarkCurveCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkCurveCurrency, value ); }
+      void setBenchmarkCurveName( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkCurveName, value ); }
+      void setBenchmarkCurvePoint( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkCurvePoint, value ); }
+      void setYieldType( const FIX::StringView& value )
+      { setString( FIX::FIELD::YieldType, value ); }
+      void setYield( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Yield, value ); }
+      void setGrossTradeAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::GrossTradeAmt, value ); }
+      void setNumDaysInterest( int value )
+      { setInt( FIX::FIELD::NumDaysInterest, value ); }
+      void setExDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExDate, value ); }
+      void setAccruedInterestRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AccruedInterestRate, value ); }
+      void setAccruedInterestAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AccruedInterestAmt, value ); }
+      void setTradedFlatSwitch( bool value )
+      { setBool( FIX::FIELD::TradedFlatSwitch, value ); }
+      void setBasisFeatureDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::BasisFeatureDate, value ); }
+      void setBasisFeaturePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::BasisFeaturePrice, value ); }
+      void setConcession( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Concession, value ); }
+      void setTotalTakedown( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::TotalTakedown, value ); }
+      void setNetMoney( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::NetMoney, value ); }
+      void setSettlCurrAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::SettlCurrAmt, value ); }
+      void setSettlCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlCurrency, value ); }
+      void setSettlCurrFxRate( double value )
+      { setDouble( FIX::FIELD::SettlCurrFxRate, value ); }
+      void setSettlCurrFxRateCalc( char value )
+      { setChar( FIX::FIELD::SettlCurrFxRateCalc, value ); }
+      void setHandlInst( char value )
+      { setChar( FIX::FIELD::HandlInst, value ); }
+      void setMinQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MinQty, value ); }
+      void setMaxFloor( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MaxFloor, value ); }
+      void setPositionEffect( char value )
+      { setChar( FIX::FIELD::PositionEffect, value ); }
+      void setMaxShow( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MaxShow, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setFutSettDate2( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate2, value ); }
+      void setOrderQty2( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderQty2, value ); }
+      void setLastForwardPoints2( double value )
+      { setDouble( FIX::FIELD::LastForwardPoints2, value ); }
+      void setMultiLegReportingType( char value )
+      { setChar( FIX::FIELD::MultiLegReportingType, value ); }
+      void setCancellationRights( char value )
+      { setChar( FIX::FIELD::CancellationRights, value ); }
+      void setMoneyLaunderingStatus( char value )
+      { setChar( FIX::FIELD::MoneyLaunderingStatus, value ); }
+      void setRegistID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RegistID, value ); }
+      void setDesignation( const FIX::StringView& value )
+      { setString( FIX::FIELD::Designation, value ); }
+      void setTransBkdTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransBkdTime, value ); }
+      void setTransBkdTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransBkdTime, value, precision ); }
+      void setExecValuationPoint( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecValuationPoint, value ); }
+      void setExecValuationPoint( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::ExecValuationPoint, value, precision ); }
+      void setExecPriceType( char value )
+      { setChar( FIX::FIELD::ExecPriceType, value ); }
+      void setExecPriceAdjustment( double value )
+      { setDouble( FIX::FIELD::ExecPriceAdjustment, value ); }
+      void setPriorityIndicator( int value )
+      { setInt( FIX::FIELD::PriorityIndicator, value ); }
+      void setPriceImprovement( double value )
+      { setDouble( FIX::FIELD::PriceImprovement, value ); }
+      void setNoContraBrokers( int value )
+      { setInt( FIX::FIELD::NoContraBrokers, value ); }
+      void setNoContAmts( int value )
+      { setInt( FIX::FIELD::NoContAmts, value ); }
+      void setNoLegs( int value )
+      { setInt( FIX::FIELD::NoLegs, value ); }
     };
   };
 
@@ -70,7 +70,16 @@ namespace FIX43
       NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+      { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
       FIELD_SET(*this, FIX::PrevClosePx);
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::SecondaryClOrdID);
@@ -80,6 +89,83 @@ namespace FIX43
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::Product);
+        FIELD_VIEW(*m_pMap, FIX::CFICode);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::IssueDate);
+        FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::Factor);
+        FIELD_VIEW(*m_pMap, FIX::CreditRating);
+        FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::PrevClosePx);
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::Side);
+        FIELD_VIEW(*m_pMap, FIX::Price);
+        FIELD_VIEW(*m_pMap, FIX::Currency);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
+      };
+    };
+    FIX::GroupView<NoStrikes::View> noStrikes() const
+    { return FIX::GroupView<NoStrikes::View>( *this, FIX::FIELD::NoStrikes ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView listID() const
+      { return getString( FIX::FIELD::ListID ); }
+      int totNoStrikes() const
+      { return getInt( FIX::FIELD::TotNoStrikes ); }
+      int noStrikes() const
+      { return getInt( FIX::FIELD::NoStrikes ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "m" ) {}
+      void setListID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListID, value ); }
+      void setTotNoStrikes( int value )
+      { setInt( FIX::FIELD::TotNoStrikes, value ); }
+      void setNoStrikes( int value )
+      { setInt( FIX::FIELD::NoStrikes, value ); }
     };
   };
 
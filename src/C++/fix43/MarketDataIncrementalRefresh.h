@@ -65,7 +65,16 @@ namespace FIX43
       NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+      { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
       FIELD_SET(*this, FIX::FinancialStatus);
       FIELD_SET(*this, FIX::CorporateAction);
       FIELD_SET(*this, FIX::MDEntryPx);
@@ -103,6 +112,112 @@ namespace FIX43
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::MDUpdateAction);
+        FIELD_VIEW(*m_pMap, FIX::DeleteReason);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryType);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryID);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryRefID);
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::Product);
+        FIELD_VIEW(*m_pMap, FIX::CFICode);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::IssueDate);
+        FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::Factor);
+        FIELD_VIEW(*m_pMap, FIX::CreditRating);
+        FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::FinancialStatus);
+        FIELD_VIEW(*m_pMap, FIX::CorporateAction);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryPx);
+        FIELD_VIEW(*m_pMap, FIX::Currency);
+        FIELD_VIEW(*m_pMap, FIX::MDEntrySize);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryDate);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryTime);
+        FIELD_VIEW(*m_pMap, FIX::TickDirection);
+        FIELD_VIEW(*m_pMap, FIX::MDMkt);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+        FIELD_VIEW(*m_pMap, FIX::QuoteCondition);
+        FIELD_VIEW(*m_pMap, FIX::TradeCondition);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryOriginator);
+        FIELD_VIEW(*m_pMap, FIX::LocationID);
+        FIELD_VIEW(*m_pMap, FIX::DeskID);
+        FIELD_VIEW(*m_pMap, FIX::OpenCloseSettleFlag);
+        FIELD_VIEW(*m_pMap, FIX::TimeInForce);
+        FIELD_VIEW(*m_pMap, FIX::ExpireDate);
+        FIELD_VIEW(*m_pMap, FIX::ExpireTime);
+        FIELD_VIEW(*m_pMap, FIX::MinQty);
+        FIELD_VIEW(*m_pMap, FIX::ExecInst);
+        FIELD_VIEW(*m_pMap, FIX::SellerDays);
+        FIELD_VIEW(*m_pMap, FIX::OrderID);
+        FIELD_VIEW(*m_pMap, FIX::QuoteEntryID);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryBuyer);
+        FIELD_VIEW(*m_pMap, FIX::MDEntrySeller);
+        FIELD_VIEW(*m_pMap, FIX::NumberOfOrders);
+        FIELD_VIEW(*m_pMap, FIX::MDEntryPositionNo);
+        FIELD_VIEW(*m_pMap, FIX::Scope);
+        FIELD_VIEW(*m_pMap, FIX::TotalVolumeTraded);
+        FIELD_VIEW(*m_pMap, FIX::TotalVolumeTradedDate);
+        FIELD_VIEW(*m_pMap, FIX::TotalVolumeTradedTime);
+        FIELD_VIEW(*m_pMap, FIX::NetChgPrevDay);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
+      };
+    };
+    FIX::GroupView<NoMDEntries::View> noMDEntries() const
+    { return FIX::GroupView<NoMDEntries::View>( *this, FIX::FIELD::NoMDEntries ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView mDReqID() const
+      { return getString( FIX::FIELD::MDReqID ); }
+      int noMDEntries() const
+      { return getInt( FIX::FIELD::NoMDEntries ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "X" ) {}
+      void setMDReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MDReqID, value ); }
+      void setNoMDEntries( int value )
+      { setInt( FIX::FIELD::NoMDEntries, value ); }
     };
   };
 
@@ -40,7 +40,15 @@ namespace FIX43
     public:
     NoMDEntryTypes() : FIX::Group(267,269,FIX::message_order(269,0)) {}
       FIELD_SET(*this, FIX::MDEntryType);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::MDEntryType);
+      };
     };
+    FIX::GroupView<NoMDEntryTypes::View> noMDEntryTypes() const
+    { return FIX::GroupView<NoMDEntryTypes::View>( *this, FIX::FIELD::NoMDEntryTypes ); }
     FIELD_SET(*this, FIX::NoRelatedSym);
     class NoRelatedSym: public FIX::Group
     {
@@ -85,8 +93,59 @@ namespace FIX43
       NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+        };
+      };
+      FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+      { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::Product);
+        FIELD_VIEW(*m_pMap, FIX::CFICode);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::IssueDate);
+        FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::Factor);
+        FIELD_VIEW(*m_pMap, FIX::CreditRating);
+        FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
       };
     };
+    FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+    { return FIX::GroupView<NoRelatedSym::View>( *this, FIX::FIELD::NoRelatedSym ); }
     FIELD_SET(*this, FIX::NoTradingSessions);
     class NoTradingSessions: public FIX::Group
     {
@@ -94,6 +153,73 @@ namespace FIX43
     NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,0)) {}
       FIELD_SET(*this, FIX::TradingSessionID);
       FIELD_SET(*this, FIX::TradingSessionSubID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+      };
+    };
+    FIX::GroupView<NoTradingSessions::View> noTradingSessions() const
+    { return FIX::GroupView<NoTradingSessions::View>( *this, FIX::FIELD::NoTradingSessions ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView mDReqID() const
+      { return getString( FIX::FIELD::MDReqID ); }
+      FIX::SubscriptionRequestType subscriptionRequestType() const
+      { return FIX::SubscriptionRequestType( getChar( FIX::FIELD::SubscriptionRequestType ) ); }
+      int marketDepth() const
+      { return getInt( FIX::FIELD::MarketDepth ); }
+      int mDUpdateType() const
+      { return getInt( FIX::FIELD::MDUpdateType ); }
+      bool aggregatedBook() const
+      { return getBool( FIX::FIELD::AggregatedBook ); }
+      FIX::StringView openCloseSettleFlag() const
+      { return getString( FIX::FIELD::OpenCloseSettleFlag ); }
+      FIX::StringView scope() const
+      { return getString( FIX::FIELD::Scope ); }
+      bool mDImplicitDelete() const
+      { return getBool( FIX::FIELD::MDImplicitDelete ); }
+      int noMDEntryTypes() const
+      { return getInt( FIX::FIELD::NoMDEntryTypes ); }
+      int noRelatedSym() const
+      { return getInt( FIX::FIELD::NoRelatedSym ); }
+      int noTradingSessions() const
+      { return getInt( FIX::FIELD::NoTradingSessions ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "V" ) {}
+      void setMDReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MDReqID, value ); }
+      void setSubscriptionRequestType( char value )
+      { setChar( FIX::FIELD::SubscriptionRequestType, value ); }
+      void setMarketDepth( int value )
+      { setInt( FIX::FIELD::MarketDepth, value ); }
+      void setMDUpdateType( int value )
+      { setInt( FIX::FIELD::MDUpdateType, value ); }
+      void setAggregatedBook( bool value )
+      { setBool( FIX::FIELD::AggregatedBook, value ); }
+      void setOpenCloseSettleFlag( const FIX::StringView& value )
+      { setString( FIX::FIELD::OpenCloseSettleFlag, value ); }
+      void setScope( const FIX::StringView& value )
+      { setString( FIX::FIELD::Scope, value ); }
+      void setMDImplicitDelete( bool value )
+      { setBool( FIX::FIELD::MDImplicitDelete, value ); }
+      void setNoMDEntryTypes( int value )
+      { setInt( FIX::FIELD::NoMDEntryTypes, value ); }
+      void setNoRelatedSym( int value )
+      { setInt( FIX::FIELD::NoRelatedSym, value ); }
+      void setNoTradingSessions( int value )
+      { setInt( FIX::FIELD::NoTradingSessions, value ); }
     };
   };
 
@@ -35,7 +35,18 @@ namespace FIX43
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
       FIELD_SET(*this, FIX::PartySubID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PartyID);
+        FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PartyRole);
+        FIELD_VIEW(*m_pMap, FIX::PartySubID);
+      };
     };
+    FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+    { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
     FIELD_SET(*this, FIX::Account);
     FIELD_SET(*this, FIX::AccountType);
     FIELD_SET(*this, FIX::DefBidSize);
@@ -86,7 +97,16 @@ namespace FIX43
       NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
         FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
         FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+      { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *this, FIX::FIELD::NoUnderlyingSecurityAltID ); }
       FIELD_SET(*this, FIX::QuoteSetValidUntilTime);
       FIELD_SET(*this, FIX::TotQuoteEntries);
       FIELD_SET(*this, FIX::NoQuoteEntries);
@@ -134,7 +154,16 @@ namespace FIX43
         NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
           FIELD_SET(*this, FIX::SecurityAltID);
           FIELD_SET(*this, FIX::SecurityAltIDSource);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+            FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+          };
         };
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
         FIELD_SET(*this, FIX::BidPx);
         FIELD_SET(*this, FIX::OfferPx);
         FIELD_SET(*this, FIX::BidSize);
@@ -158,8 +187,177 @@ namespace FIX43
         FIELD_SET(*this, FIX::BidForwardPoints2);
         FIELD_SET(*this, FIX::OfferForwardPoints2);
         FIELD_SET(*this, FIX::Currency);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::QuoteEntryID);
+          FIELD_VIEW(*m_pMap, FIX::Symbol);
+          FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+          FIELD_VIEW(*m_pMap, FIX::SecurityID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+          FIELD_VIEW(*m_pMap, FIX::Product);
+          FIELD_VIEW(*m_pMap, FIX::CFICode);
+          FIELD_VIEW(*m_pMap, FIX::SecurityType);
+          FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+          FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+          FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+          FIELD_VIEW(*m_pMap, FIX::IssueDate);
+          FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+          FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+          FIELD_VIEW(*m_pMap, FIX::Factor);
+          FIELD_VIEW(*m_pMap, FIX::CreditRating);
+          FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+          FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+          FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+          FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+          FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::CouponRate);
+          FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+          FIELD_VIEW(*m_pMap, FIX::Issuer);
+          FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+          FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::BidPx);
+          FIELD_VIEW(*m_pMap, FIX::OfferPx);
+          FIELD_VIEW(*m_pMap, FIX::BidSize);
+          FIELD_VIEW(*m_pMap, FIX::OfferSize);
+          FIELD_VIEW(*m_pMap, FIX::ValidUntilTime);
+          FIELD_VIEW(*m_pMap, FIX::BidSpotRate);
+          FIELD_VIEW(*m_pMap, FIX::OfferSpotRate);
+          FIELD_VIEW(*m_pMap, FIX::BidForwardPoints);
+          FIELD_VIEW(*m_pMap, FIX::OfferForwardPoints);
+          FIELD_VIEW(*m_pMap, FIX::MidPx);
+          FIELD_VIEW(*m_pMap, FIX::BidYield);
+          FIELD_VIEW(*m_pMap, FIX::MidYield);
+          FIELD_VIEW(*m_pMap, FIX::OfferYield);
+          FIELD_VIEW(*m_pMap, FIX::TransactTime);
+          FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+          FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+          FIELD_VIEW(*m_pMap, FIX::FutSettDate);
+          FIELD_VIEW(*m_pMap, FIX::OrdType);
+          FIELD_VIEW(*m_pMap, FIX::FutSettDate2);
+          FIELD_VIEW(*m_pMap, FIX::OrderQty2);
+          FIELD_VIEW(*m_pMap, FIX::BidForwardPoints2);
+          FIELD_VIEW(*m_pMap, FIX::OfferForwardPoints2);
+          FIELD_VIEW(*m_pMap, FIX::Currency);
+          FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+          { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
+        };
+      };
+      FIX::GroupView<NoQuoteEntries::View> noQuoteEntries() const
+      { return FIX::GroupView<NoQuoteEntries::View>( *this, FIX::FIELD::NoQuoteEntries ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::QuoteSetID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbol);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingProduct);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCFICode);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingPutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingIssueDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingFactor);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCreditRating);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingLocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingOptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponRate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingIssuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuer);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::NoUnderlyingSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::QuoteSetValidUntilTime);
+        FIELD_VIEW(*m_pMap, FIX::TotQuoteEntries);
+        FIELD_VIEW(*m_pMap, FIX::NoQuoteEntries);
+        FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+        { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *m_pMap, FIX::FIELD::NoUnderlyingSecurityAltID ); }
+        FIX::GroupView<NoQuoteEntries::View> noQuoteEntries() const
+        { return FIX::GroupView<NoQuoteEntries::View>( *m_pMap, FIX::FIELD::NoQuoteEntries ); }
       };
     };
+    FIX::GroupView<NoQuoteSets::View> noQuoteSets() const
+    { return FIX::GroupView<NoQuoteSets::View>( *this, FIX::FIELD::NoQuoteSets ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView quoteReqID() const
+      { return getString( FIX::FIELD::QuoteReqID ); }
+      FIX::StringView quoteID() const
+      { return getString( FIX::FIELD::QuoteID ); }
+      int quoteType() const
+      { return getInt( FIX::FIELD::QuoteType ); }
+      int quoteResponseLevel() const
+      { return getInt( FIX::FIELD::QuoteResponseLevel ); }
+      int noPartyIDs() const
+      { return getInt( FIX::FIELD::NoPartyIDs ); }
+      FIX::StringView account() const
+      { return getString( FIX::FIELD::Account ); }
+      int accountType() const
+      { return getInt( FIX::FIELD::AccountType ); }
+      FIX::Decimal defBidSize() const
+      { return getDecimal( FIX::FIELD::DefBidSize ); }
+      FIX::Decimal defOfferSize() const
+      { return getDecimal( FIX::FIELD::DefOfferSize ); }
+      int noQuoteSets() const
+      { return getInt( FIX::FIELD::NoQuoteSets ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "i" ) {}
+      void setQuoteReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteReqID, value ); }
+      void setQuoteID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteID, value ); }
+      void setQuoteType( int value )
+      { setInt( FIX::FIELD::QuoteType, value ); }
+      void setQuoteResponseLevel( int value )
+      { setInt( FIX::FIELD::QuoteResponseLevel, value ); }
+      void setNoPartyIDs( int value )
+      { setInt( FIX::FIELD::NoPartyIDs, value ); }
+      void setAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::Account, value ); }
+      void setAccountType( int value )
+      { setInt( FIX::FIELD::AccountType, value ); }
+      void setDefBidSize( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DefBidSize, value ); }
+      void setDefOfferSize( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DefOfferSize, value ); }
+      void setNoQuoteSets( int value )
+      { setInt( FIX::FIELD::NoQuoteSets, value ); }
+    };
   };
 
 }
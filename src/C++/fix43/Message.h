@@ -3,6 +3,8 @@
 
 #include "../Message.h"
 #include "../Group.h"
+#include "../GroupView.h"
+#include "../Flyweight.h"
 
 namespace FIX43
 {
@@ -44,7 +46,17 @@ namespace FIX43
       FIELD_SET(*this, FIX::HopCompID);
       FIELD_SET(*this, FIX::HopSendingTime);
       FIELD_SET(*this, FIX::HopRefID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::HopCompID);
+        FIELD_VIEW(*m_pMap, FIX::HopSendingTime);
+        FIELD_VIEW(*m_pMap, FIX::HopRefID);
+      };
     };
+    FIX::GroupView<NoHops::View> noHops() const
+    { return FIX::GroupView<NoHops::View>( *this, FIX::FIELD::NoHops ); }
   };
 
   class Trailer : public FIX::Trailer
@@ -69,6 +81,139 @@ namespace FIX43
     const Header& getHeader() const { return (Header&)m_header; }
     Trailer& getTrailer() { return (Trailer&)m_trailer; }
     const Trailer& getTrailer() const { return (Trailer&)m_trailer; }
+
+    class Reader : public FIX::FlyweightReader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : FIX::FlyweightReader( data, length, pDataDictionary ) {}
+      FIX::StringView beginString() const
+      { return getString( FIX::FIELD::BeginString ); }
+      int bodyLength() const
+      { return getInt( FIX::FIELD::BodyLength ); }
+      FIX::StringView msgType() const
+      { return getString( FIX::FIELD::MsgType ); }
+      FIX::StringView senderCompID() const
+      { return getString( FIX::FIELD::SenderCompID ); }
+      FIX::StringView targetCompID() const
+      { return getString( FIX::FIELD::TargetCompID ); }
+      FIX::StringView onBehalfOfCompID() const
+      { return getString( FIX::FIELD::OnBehalfOfCompID ); }
+      FIX::StringView deliverToCompID() const
+      { return getString( FIX::FIELD::DeliverToCompID ); }
+      int secureDataLen() const
+      { return getInt( FIX::FIELD::SecureDataLen ); }
+      FIX::StringView secureData() const
+      { return getString( FIX::FIELD::SecureData ); }
+      int msgSeqNum() const
+      { return getInt( FIX::FIELD::MsgSeqNum ); }
+      FIX::StringView senderSubID() const
+      { return getString( FIX::FIELD::SenderSubID ); }
+      FIX::StringView senderLocationID() const
+      { return getString( FIX::FIELD::SenderLocationID ); }
+      FIX::StringView targetSubID() const
+      { return getString( FIX::FIELD::TargetSubID ); }
+      FIX::StringView targetLocationID() const
+      { return getString( FIX::FIELD::TargetLocationID ); }
+      FIX::StringView onBehalfOfSubID() const
+      { return getString( FIX::FIELD::OnBehalfOfSubID ); }
+      FIX::StringView onBehalfOfLocationID() const
+      { return getString( FIX::FIELD::OnBehalfOfLocationID ); }
+      FIX::StringView deliverToSubID() const
+      { return getString( FIX::FIELD::DeliverToSubID ); }
+      FIX::StringView deliverToLocationID() const
+      { return getString( FIX::FIELD::DeliverToLocationID ); }
+      bool possDupFlag() const
+      { return getBool( FIX::FIELD::PossDupFlag ); }
+      bool possResend() const
+      { return getBool( FIX::FIELD::PossResend ); }
+      FIX::StringView sendingTime() const
+      { return getString( FIX::FIELD::SendingTime ); }
+      FIX::StringView origSendingTime() const
+      { return getString( FIX::FIELD::OrigSendingTime ); }
+      int xmlDataLen() const
+      { return getInt( FIX::FIELD::XmlDataLen ); }
+      FIX::StringView xmlData() const
+      { return getString( FIX::FIELD::XmlData ); }
+      FIX::StringView messageEncoding() const
+      { return getString( FIX::FIELD::MessageEncoding ); }
+      int lastMsgSeqNumProcessed() const
+      { return getInt( FIX::FIELD::LastMsgSeqNumProcessed ); }
+      FIX::StringView onBehalfOfSendingTime() const
+      { return getString( FIX::FIELD::OnBehalfOfSendingTime ); }
+      int noHops() const
+      { return getInt( FIX::FIELD::NoHops ); }
+      int signatureLength() const
+      { return getInt( FIX::FIELD::SignatureLength ); }
+      FIX::StringView signature() const
+      { return getString( FIX::FIELD::Signature ); }
+      FIX::StringView checkSum() const
+      { return getString( FIX::FIELD::CheckSum ); }
+    };
+
+    class Writer : public FIX::FlyweightWriter
+    {
+    public:
+      Writer( const char* msgType )
+      : FIX::FlyweightWriter( "FIX.4.3", msgType ) {}
+      void setSenderCompID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SenderCompID, value ); }
+      void setTargetCompID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TargetCompID, value ); }
+      void setOnBehalfOfCompID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OnBehalfOfCompID, value ); }
+      void setDeliverToCompID( const FIX::StringView& value )
+      { setString( FIX::FIELD::DeliverToCompID, value ); }
+      void setSecureDataLen( int value )
+      { setInt( FIX::FIELD::SecureDataLen, value ); }
+      void setSecureData( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecureData, value ); }
+      void setMsgSeqNum( int value )
+      { setInt( FIX::FIELD::MsgSeqNum, value ); }
+      void setSenderSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SenderSubID, value ); }
+      void setSenderLocationID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SenderLocationID, value ); }
+      void setTargetSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TargetSubID, value ); }
+      void setTargetLocationID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TargetLocationID, value ); }
+      void setOnBehalfOfSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OnBehalfOfSubID, value ); }
+      void setOnBehalfOfLocationID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OnBehalfOfLocationID, value ); }
+      void setDeliverToSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::DeliverToSubID, value ); }
+      void setDeliverToLocationID( const FIX::StringView& value )
+      { setString( FIX::FIELD::DeliverToLocationID, value ); }
+      void setPossDupFlag( bool value )
+      { setBool( FIX::FIELD::PossDupFlag, value ); }
+      void setPossResend( bool value )
+      { setBool( FIX::FIELD::PossResend, value ); }
+      void setSendingTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::SendingTime, value ); }
+      void setSendingTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::SendingTime, value, precision ); }
+      void setOrigSendingTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrigSendingTime, value ); }
+      void setOrigSendingTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::OrigSendingTime, value, precision ); }
+      void setXmlDataLen( int value )
+      { setInt( FIX::FIELD::XmlDataLen, value ); }
+      void setXmlData( const FIX::StringView& value )
+      { setString( FIX::FIELD::XmlData, value ); }
+      void setMessageEncoding( const FIX::StringView& value )
+      { setString( FIX::FIELD::MessageEncoding, value ); }
+      void setLastMsgSeqNumProcessed( int value )
+      { setInt( FIX::FIELD::LastMsgSeqNumProcessed, value ); }
+      void setOnBehalfOfSendingTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::OnBehalfOfSendingTime, value ); }
+      void setOnBehalfOfSendingTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::OnBehalfOfSendingTime, value, precision ); }
+      void setNoHops( int value )
+      { setInt( FIX::FIELD::NoHops, value ); }
+    };
   };
 
 }
@@ -47,7 +47,18 @@ namespace FIX43
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
       FIELD_SET(*this, FIX::PartySubID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PartyID);
+        FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PartyRole);
+        FIELD_VIEW(*m_pMap, FIX::PartySubID);
+      };
     };
+    FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+    { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
     FIELD_SET(*this, FIX::Account);
     FIELD_SET(*this, FIX::AccountType);
     FIELD_SET(*this, FIX::DayBookingInst);
@@ -103,7 +114,16 @@ namespace FIX43
     NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+    { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
     FIELD_SET(*this, FIX::PrevClosePx);
     FIELD_SET(*this, FIX::LocateReqd);
     FIELD_SET(*this, FIX::TransactTime);
@@ -159,7 +179,17 @@ namespace FIX43
       FIELD_SET(*this, FIX::AllocAccount);
       FIELD_SET(*this, FIX::IndividualAllocID);
       FIELD_SET(*this, FIX::AllocQty);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::AllocAccount);
+        FIELD_VIEW(*m_pMap, FIX::IndividualAllocID);
+        FIELD_VIEW(*m_pMap, FIX::AllocQty);
+      };
     };
+    FIX::GroupView<NoAllocs::View> noAllocs() const
+    { return FIX::GroupView<NoAllocs::View>( *this, FIX::FIELD::NoAllocs ); }
     FIELD_SET(*this, FIX::NoTradingSessions);
     class NoTradingSessions: public FIX::Group
     {
@@ -167,7 +197,16 @@ namespace FIX43
     NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,0)) {}
       FIELD_SET(*this, FIX::TradingSessionID);
       FIELD_SET(*this, FIX::TradingSessionSubID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+      };
     };
+    FIX::GroupView<NoTradingSessions::View> noTradingSessions() const
+    { return FIX::GroupView<NoTradingSessions::View>( *this, FIX::FIELD::NoTradingSessions ); }
     FIELD_SET(*this, FIX::NoLegs);
     class NoLegs: public FIX::Group
     {
@@ -214,7 +253,16 @@ namespace FIX43
       NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
         FIELD_SET(*this, FIX::LegSecurityAltID);
         FIELD_SET(*this, FIX::LegSecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+      { return FIX::GroupView<NoLegSecurityAltID::View>( *this, FIX::FIELD::NoLegSecurityAltID ); }
       FIELD_SET(*this, FIX::LegPositionEffect);
       FIELD_SET(*this, FIX::LegCoveredOrUncovered);
       FIELD_SET(*this, FIX::NoNestedPartyIDs);
@@ -226,11 +274,521 @@ namespace FIX43
         FIELD_SET(*this, FIX::NestedPartyIDSource);
         FIELD_SET(*this, FIX::NestedPartyRole);
         FIELD_SET(*this, FIX::NestedPartySubID);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyID);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartySubID);
+        };
       };
+      FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+      { return FIX::GroupView<NoNestedPartyIDs::View>( *this, FIX::FIELD::NoNestedPartyIDs ); }
       FIELD_SET(*this, FIX::LegRefID);
       FIELD_SET(*this, FIX::LegPrice);
       FIELD_SET(*this, FIX::LegSettlmntTyp);
       FIELD_SET(*this, FIX::LegFutSettDate);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::LegSymbol);
+        FIELD_VIEW(*m_pMap, FIX::LegSymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::LegProduct);
+        FIELD_VIEW(*m_pMap, FIX::LegCFICode);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::LegMaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::LegMaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::LegCouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::LegIssueDate);
+        FIELD_VIEW(*m_pMap, FIX::LegRepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::LegRepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::LegRepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::LegFactor);
+        FIELD_VIEW(*m_pMap, FIX::LegCreditRating);
+        FIELD_VIEW(*m_pMap, FIX::LegInstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::LegCountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegStateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegLocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegRedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::LegStrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::LegOptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::LegContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::LegCouponRate);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::LegIssuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuer);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::LegRatioQty);
+        FIELD_VIEW(*m_pMap, FIX::LegSide);
+        FIELD_VIEW(*m_pMap, FIX::NoLegSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::LegPositionEffect);
+        FIELD_VIEW(*m_pMap, FIX::LegCoveredOrUncovered);
+        FIELD_VIEW(*m_pMap, FIX::NoNestedPartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::LegRefID);
+        FIELD_VIEW(*m_pMap, FIX::LegPrice);
+        FIELD_VIEW(*m_pMap, FIX::LegSettlmntTyp);
+        FIELD_VIEW(*m_pMap, FIX::LegFutSettDate);
+        FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+        { return FIX::GroupView<NoLegSecurityAltID::View>( *m_pMap, FIX::FIELD::NoLegSecurityAltID ); }
+        FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+        { return FIX::GroupView<NoNestedPartyIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartyIDs ); }
+      };
+    };
+    FIX::GroupView<NoLegs::View> noLegs() const
+    { return FIX::GroupView<NoLegs::View>( *this, FIX::FIELD::NoLegs ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView origClOrdID() const
+      { return getString( FIX::FIELD::OrigClOrdID ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      FIX::StringView secondaryClOrdID() const
+      { return getString( FIX::FIELD::SecondaryClOrdID ); }
+      FIX::StringView clOrdLinkID() const
+      { return getString( FIX::FIELD::ClOrdLinkID ); }
+      FIX::StringView origOrdModTime() const
+      { return getString( FIX::FIELD::OrigOrdModTime ); }
+      int noPartyIDs() const
+      { return getInt( FIX::FIELD::NoPartyIDs ); }
+      FIX::StringView account() const
+      { return getString( FIX::FIELD::Account ); }
+      int accountType() const
+      { return getInt( FIX::FIELD::AccountType ); }
+      FIX::DayBookingInst dayBookingInst() const
+      { return FIX::DayBookingInst( getChar( FIX::FIELD::DayBookingInst ) ); }
+      FIX::BookingUnit bookingUnit() const
+      { return FIX::BookingUnit( getChar( FIX::FIELD::BookingUnit ) ); }
+      FIX::PreallocMethod preallocMethod() const
+      { return FIX::PreallocMethod( getChar( FIX::FIELD::PreallocMethod ) ); }
+      FIX::SettlmntTyp settlmntTyp() const
+      { return FIX::SettlmntTyp( getChar( FIX::FIELD::SettlmntTyp ) ); }
+      FIX::StringView futSettDate() const
+      { return getString( FIX::FIELD::FutSettDate ); }
+      FIX::CashMargin cashMargin() const
+      { return FIX::CashMargin( getChar( FIX::FIELD::CashMargin ) ); }
+      FIX::StringView clearingFeeIndicator() const
+      { return getString( FIX::FIELD::ClearingFeeIndicator ); }
+      FIX::HandlInst handlInst() const
+      { return FIX::HandlInst( getChar( FIX::FIELD::HandlInst ) ); }
+      FIX::StringView execInst() const
+      { return getString( FIX::FIELD::ExecInst ); }
+      FIX::Decimal minQty() const
+      { return getDecimal( FIX::FIELD::MinQty ); }
+      FIX::Decimal maxFloor() const
+      { return getDecimal( FIX::FIELD::MaxFloor ); }
+      FIX::StringView exDestination() const
+      { return getString( FIX::FIELD::ExDestination ); }
+      FIX::ProcessCode processCode() const
+      { return FIX::ProcessCode( getChar( FIX::FIELD::ProcessCode ) ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView securityIDSource() const
+      { return getString( FIX::FIELD::SecurityIDSource ); }
+      int product() const
+      { return getInt( FIX::FIELD::Product ); }
+      FIX::StringView cFICode() const
+      { return getString( FIX::FIELD::CFICode ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDate() const
+      { return getString( FIX::FIELD::MaturityDate ); }
+      FIX::StringView couponPaymentDate() const
+      { return getString( FIX::FIELD::CouponPaymentDate ); }
+      FIX::StringView issueDate() const
+      { return getString( FIX::FIELD::IssueDate ); }
+      FIX::StringView repoCollateralSecurityType() const
+      { return getString( FIX::FIELD::RepoCollateralSecurityType ); }
+      int repurchaseTerm() const
+      { return getInt( FIX::FIELD::RepurchaseTerm ); }
+      FIX::Decimal repurchaseRate() const
+      { return getDecimal( FIX::FIELD::RepurchaseRate ); }
+      double factor() const
+      { return getDouble( FIX::FIELD::Factor ); }
+      FIX::StringView creditRating() const
+      { return getString( FIX::FIELD::CreditRating ); }
+      FIX::StringView instrRegistry() const
+      { return getString( FIX::FIELD::InstrRegistry ); }
+      FIX::StringView countryOfIssue() const
+      { return getString( FIX::FIELD::CountryOfIssue ); }
+      FIX::StringView stateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::StateOrProvinceOfIssue ); }
+      FIX::StringView localeOfIssue() const
+      { return getString( FIX::FIELD::LocaleOfIssue ); }
+      FIX::StringView redemptionDate() const
+      { return getString( FIX::FIELD::RedemptionDate ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      int noSecurityAltID() const
+      { return getInt( FIX::FIELD::NoSecurityAltID ); }
+      FIX::Decimal prevClosePx() const
+      { return getDecimal( FIX::FIELD::PrevClosePx ); }
+      bool locateReqd() const
+      { return getBool( FIX::FIELD::LocateReqd ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      int quantityType() const
+      { return getInt( FIX::FIELD::QuantityType ); }
+      FIX::Decimal orderQty() const
+      { return getDecimal( FIX::FIELD::OrderQty ); }
+      FIX::Decimal cashOrderQty() const
+      { return getDecimal( FIX::FIELD::CashOrderQty ); }
+      FIX::Decimal orderPercent() const
+      { return getDecimal( FIX::FIELD::OrderPercent ); }
+      FIX::RoundingDirection roundingDirection() const
+      { return FIX::RoundingDirection( getChar( FIX::FIELD::RoundingDirection ) ); }
+      double roundingModulus() const
+      { return getDouble( FIX::FIELD::RoundingModulus ); }
+      FIX::OrdType ordType() const
+      { return FIX::OrdType( getChar( FIX::FIELD::OrdType ) ); }
+      int priceType() const
+      { return getInt( FIX::FIELD::PriceType ); }
+      FIX::Decimal price() const
+      { return getDecimal( FIX::FIELD::Price ); }
+      FIX::Decimal stopPx() const
+      { return getDecimal( FIX::FIELD::StopPx ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::StringView complianceID() const
+      { return getString( FIX::FIELD::ComplianceID ); }
+      bool solicitedFlag() const
+      { return getBool( FIX::FIELD::SolicitedFlag ); }
+      FIX::StringView iOIid() const
+      { return getString( FIX::FIELD::IOIid ); }
+      FIX::StringView quoteID() const
+      { return getString( FIX::FIELD::QuoteID ); }
+      FIX::TimeInForce timeInForce() const
+      { return FIX::TimeInForce( getChar( FIX::FIELD::TimeInForce ) ); }
+      FIX::StringView effectiveTime() const
+      { return getString( FIX::FIELD::EffectiveTime ); }
+      FIX::StringView expireDate() const
+      { return getString( FIX::FIELD::ExpireDate ); }
+      FIX::StringView expireTime() const
+      { return getString( FIX::FIELD::ExpireTime ); }
+      int gTBookingInst() const
+      { return getInt( FIX::FIELD::GTBookingInst ); }
+      FIX::Decimal commission() const
+      { return getDecimal( FIX::FIELD::Commission ); }
+      FIX::CommType commType() const
+      { return FIX::CommType( getChar( FIX::FIELD::CommType ) ); }
+      FIX::StringView commCurrency() const
+      { return getString( FIX::FIELD::CommCurrency ); }
+      FIX::FundRenewWaiv fundRenewWaiv() const
+      { return FIX::FundRenewWaiv( getChar( FIX::FIELD::FundRenewWaiv ) ); }
+      FIX::OrderCapacity orderCapacity() const
+      { return FIX::OrderCapacity( getChar( FIX::FIELD::OrderCapacity ) ); }
+      FIX::StringView orderRestrictions() const
+      { return getString( FIX::FIELD::OrderRestrictions ); }
+      int custOrderCapacity() const
+      { return getInt( FIX::FIELD::CustOrderCapacity ); }
+      bool forexReq() const
+      { return getBool( FIX::FIELD::ForexReq ); }
+      FIX::StringView settlCurrency() const
+      { return getString( FIX::FIELD::SettlCurrency ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      FIX::PositionEffect positionEffect() const
+      { return FIX::PositionEffect( getChar( FIX::FIELD::PositionEffect ) ); }
+      int coveredOrUncovered() const
+      { return getInt( FIX::FIELD::CoveredOrUncovered ); }
+      FIX::Decimal maxShow() const
+      { return getDecimal( FIX::FIELD::MaxShow ); }
+      double pegDifference() const
+      { return getDouble( FIX::FIELD::PegDifference ); }
+      FIX::DiscretionInst discretionInst() const
+      { return FIX::DiscretionInst( getChar( FIX::FIELD::DiscretionInst ) ); }
+      double discretionOffset() const
+      { return getDouble( FIX::FIELD::DiscretionOffset ); }
+      FIX::CancellationRights cancellationRights() const
+      { return FIX::CancellationRights( getChar( FIX::FIELD::CancellationRights ) ); }
+      FIX::MoneyLaunderingStatus moneyLaunderingStatus() const
+      { return FIX::MoneyLaunderingStatus( getChar( FIX::FIELD::MoneyLaunderingStatus ) ); }
+      FIX::StringView registID() const
+      { return getString( FIX::FIELD::RegistID ); }
+      FIX::StringView designation() const
+      { return getString( FIX::FIELD::Designation ); }
+      int multiLegRptTypeReq() const
+      { return getInt( FIX::FIELD::MultiLegRptTypeReq ); }
+      FIX::Decimal netMoney() const
+      { return getDecimal( FIX::FIELD::NetMoney ); }
+      int noAllocs() const
+      { return getInt( FIX::FIELD::NoAllocs ); }
+      int noTradingSessions() const
+      { return getInt( FIX::FIELD::NoTradingSessions ); }
+      int noLegs() const
+      { return getInt( FIX::FIELD::NoLegs ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "AC" ) {}
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setOrigClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrigClOrdID, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setSecondaryClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecondaryClOrdID, value ); }
+      void setClOrdLinkID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdLinkID, value ); }
+      void setOrigOrdModTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrigOrdModTime, value ); }
+      void setOrigOrdModTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::OrigOrdModTime, value, precision ); }
+      void setNoPartyIDs( int value )
+      { setInt( FIX::FIELD::NoPartyIDs, value ); }
+      void setAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::Account, value ); }
+      void setAccountType( int value )
+      { setInt( FIX::FIELD::AccountType, value ); }
+      void setDayBookingInst( char value )
+      { setChar( FIX::FIELD::DayBookingInst, value ); }
+      void setBookingUnit( char value )
+      { setChar( FIX::FIELD::BookingUnit, value ); }
+      void setPreallocMethod( char value )
+      { setChar( FIX::FIELD::PreallocMethod, value ); }
+      void setSettlmntTyp( char value )
+      { setChar( FIX::FIELD::SettlmntTyp, value ); }
+      void setFutSettDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate, value ); }
+      void setCashMargin( char value )
+      { setChar( FIX::FIELD::CashMargin, value ); }
+      void setClearingFeeIndicator( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClearingFeeIndicator, value ); }
+      void setHandlInst( char value )
+      { setChar( FIX::FIELD::HandlInst, value ); }
+      void setExecInst( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecInst, value ); }
+      void setMinQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MinQty, value ); }
+      void setMaxFloor( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MaxFloor, value ); }
+      void setExDestination( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExDestination, value ); }
+      void setProcessCode( char value )
+      { setChar( FIX::FIELD::ProcessCode, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityIDSource, value ); }
+      void setProduct( int value )
+      { setInt( FIX::FIELD::Product, value ); }
+      void setCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::CFICode, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDate, value ); }
+      void setCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::CouponPaymentDate, value ); }
+      void setIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::IssueDate, value ); }
+      void setRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RepoCollateralSecurityType, value ); }
+      void setRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::RepurchaseTerm, value ); }
+      void setRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::RepurchaseRate, value ); }
+      void setFactor( double value )
+      { setDouble( FIX::FIELD::Factor, value ); }
+      void setCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::CreditRating, value ); }
+      void setInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::InstrRegistry, value ); }
+      void setCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::CountryOfIssue, value ); }
+      void setStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::StateOrProvinceOfIssue, value ); }
+      void setLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::LocaleOfIssue, value ); }
+      void setRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::RedemptionDate, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setNoSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoSecurityAltID, value ); }
+      void setPrevClosePx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::PrevClosePx, value ); }
+      void setLocateReqd( bool value )
+      { setBool( FIX::FIELD::LocateReqd, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setQuantityType( int value )
+      { setInt( FIX::FIELD::QuantityType, value ); }
+      void setOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderQty, value ); }
+      void setCashOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CashOrderQty, value ); }
+      void setOrderPercent( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderPercent, value ); }
+      void setRoundingDirection( char value )
+      { setChar( FIX::FIELD::RoundingDirection, value ); }
+      void setRoundingModulus( double value )
+      { setDouble( FIX::FIELD::RoundingModulus, value ); }
+      void setOrdType( char value )
+      { setChar( FIX::FIELD::OrdType, value ); }
+      void setPriceType( int value )
+      { setInt( FIX::FIELD::PriceType, value ); }
+      void setPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Price, value ); }
+      void setStopPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StopPx, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setComplianceID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ComplianceID, value ); }
+      void setSolicitedFlag( bool value )
+      { setBool( FIX::FIELD::SolicitedFlag, value ); }
+      void setIOIid( const FIX::StringView& value )
+      { setString( FIX::FIELD::IOIid, value ); }
+      void setQuoteID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteID, value ); }
+      void setTimeInForce( char value )
+      { setChar( FIX::FIELD::TimeInForce, value ); }
+      void setEffectiveTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::EffectiveTime, value ); }
+      void setEffectiveTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::EffectiveTime, value, precision ); }
+      void setExpireDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExpireDate, value ); }
+      void setExpireTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExpireTime, value ); }
+      void setExpireTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::ExpireTime, value, precision ); }
+      void setGTBookingInst( int value )
+      { setInt( FIX::FIELD::GTBookingInst, value ); }
+      void setCommission( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Commission, value ); }
+      void setCommType( char value )
+      { setChar( FIX::FIELD::CommType, value ); }
+      void setCommCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::CommCurrency, value ); }
+      void setFundRenewWaiv( char value )
+      { setChar( FIX::FIELD::FundRenewWaiv, value ); }
+      void setOrderCapacity( char value )
+      { setChar( FIX::FIELD::OrderCapacity, value ); }
+      void setOrderRestrictions( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderRestrictions, value ); }
+      void setCustOrderCapacity( int value )
+      { setInt( FIX::FIELD::CustOrderCapacity, value ); }
+      void setForexReq( bool value )
+      { setBool( FIX::FIELD::ForexReq, value ); }
+      void setSettlCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlCurrency, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setPositionEffect( char value )
+      { setChar( FIX::FIELD::PositionEffect, value ); }
+      void setCoveredOrUncovered( int value )
+      { setInt( FIX::FIELD::CoveredOrUncovered, value ); }
+      void setMaxShow( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MaxShow, value ); }
+      void setPegDifference( double value )
+      { setDouble( FIX::FIELD::PegDifference, value ); }
+      void setDiscretionInst( char value )
+      { setChar( FIX::FIELD::DiscretionInst, value ); }
+      void setDiscretionOffset( double value )
+      { setDouble( FIX::FIELD::DiscretionOffset, value ); }
+      void setCancellationRights( char value )
+      { setChar( FIX::FIELD::CancellationRights, value ); }
+      void setMoneyLaunderingStatus( char value )
+      { setChar( FIX::FIELD::MoneyLaunderingStatus, value ); }
+      void setRegistID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RegistID, value ); }
+      void setDesignation( const FIX::StringView& value )
+      { setString( FIX::FIELD::Designation, value ); }
+      void setMultiLegRptTypeReq( int value )
+      { setInt( FIX::FIELD::MultiLegRptTypeReq, value ); }
+      void setNetMoney( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::NetMoney, value ); }
+      void setNoAllocs( int value )
+      { setInt( FIX::FIELD::NoAllocs, value ); }
+      void setNoTradingSessions( int value )
+      { setInt( FIX::FIELD::NoTradingSessions, value ); }
+      void setNoLegs( int value )
+      { setInt( FIX::FIELD::NoLegs, value ); }
     };
   };
 
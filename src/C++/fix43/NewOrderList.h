@@ -59,7 +59,18 @@ namespace FIX43
         FIELD_SET(*this, FIX::PartyIDSource);
         FIELD_SET(*this, FIX::PartyRole);
         FIELD_SET(*this, FIX::PartySubID);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::PartyID);
+          FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::PartyRole);
+          FIELD_VIEW(*m_pMap, FIX::PartySubID);
+        };
       };
+      FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+      { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
       FIELD_SET(*this, FIX::TradeOriginationDate);
       FIELD_SET(*this, FIX::Account);
       FIELD_SET(*this, FIX::AccountType);
@@ -115,7 +126,16 @@ namespace FIX43
       NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+      { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
       FIELD_SET(*this, FIX::PrevClosePx);
       FIELD_SET(*this, FIX::Side);
       FIELD_SET(*this, FIX::SideValueInd);
@@ -128,7 +148,16 @@ namespace FIX43
       NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
         FIELD_SET(*this, FIX::StipulationType);
         FIELD_SET(*this, FIX::StipulationValue);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::StipulationType);
+          FIELD_VIEW(*m_pMap, FIX::StipulationValue);
+        };
       };
+      FIX::GroupView<NoStipulations::View> noStipulations() const
+      { return FIX::GroupView<NoStipulations::View>( *this, FIX::FIELD::NoStipulations ); }
       FIELD_SET(*this, FIX::QuantityType);
       FIELD_SET(*this, FIX::OrderQty);
       FIELD_SET(*this, FIX::CashOrderQty);
@@ -197,9 +226,33 @@ namespace FIX43
           FIELD_SET(*this, FIX::NestedPartyIDSource);
           FIELD_SET(*this, FIX::NestedPartyRole);
           FIELD_SET(*this, FIX::NestedPartySubID);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::NestedPartyID);
+            FIELD_VIEW(*m_pMap, FIX::NestedPartyIDSource);
+            FIELD_VIEW(*m_pMap, FIX::NestedPartyRole);
+            FIELD_VIEW(*m_pMap, FIX::NestedPartySubID);
+          };
         };
+        FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+        { return FIX::GroupView<NoNestedPartyIDs::View>( *this, FIX::FIELD::NoNestedPartyIDs ); }
         FIELD_SET(*this, FIX::AllocQty);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::AllocAccount);
+          FIELD_VIEW(*m_pMap, FIX::IndividualAllocID);
+          FIELD_VIEW(*m_pMap, FIX::NoNestedPartyIDs);
+          FIELD_VIEW(*m_pMap, FIX::AllocQty);
+          FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+          { return FIX::GroupView<NoNestedPartyIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartyIDs ); }
+        };
       };
+      FIX::GroupView<NoAllocs::View> noAllocs() const
+      { return FIX::GroupView<NoAllocs::View>( *this, FIX::FIELD::NoAllocs ); }
       FIELD_SET(*this, FIX::NoTradingSessions);
       class NoTradingSessions: public FIX::Group
       {
@@ -207,7 +260,222 @@ namespace FIX43
       NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,0)) {}
         FIELD_SET(*this, FIX::TradingSessionID);
         FIELD_SET(*this, FIX::TradingSessionSubID);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+          FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+        };
       };
+      FIX::GroupView<NoTradingSessions::View> noTradingSessions() const
+      { return FIX::GroupView<NoTradingSessions::View>( *this, FIX::FIELD::NoTradingSessions ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::ListSeqNo);
+        FIELD_VIEW(*m_pMap, FIX::ClOrdLinkID);
+        FIELD_VIEW(*m_pMap, FIX::SettlInstMode);
+        FIELD_VIEW(*m_pMap, FIX::NoPartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::TradeOriginationDate);
+        FIELD_VIEW(*m_pMap, FIX::Account);
+        FIELD_VIEW(*m_pMap, FIX::AccountType);
+        FIELD_VIEW(*m_pMap, FIX::DayBookingInst);
+        FIELD_VIEW(*m_pMap, FIX::BookingUnit);
+        FIELD_VIEW(*m_pMap, FIX::PreallocMethod);
+        FIELD_VIEW(*m_pMap, FIX::SettlmntTyp);
+        FIELD_VIEW(*m_pMap, FIX::FutSettDate);
+        FIELD_VIEW(*m_pMap, FIX::CashMargin);
+        FIELD_VIEW(*m_pMap, FIX::ClearingFeeIndicator);
+        FIELD_VIEW(*m_pMap, FIX::HandlInst);
+        FIELD_VIEW(*m_pMap, FIX::ExecInst);
+        FIELD_VIEW(*m_pMap, FIX::MinQty);
+        FIELD_VIEW(*m_pMap, FIX::MaxFloor);
+        FIELD_VIEW(*m_pMap, FIX::ExDestination);
+        FIELD_VIEW(*m_pMap, FIX::ProcessCode);
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::Product);
+        FIELD_VIEW(*m_pMap, FIX::CFICode);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::IssueDate);
+        FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::Factor);
+        FIELD_VIEW(*m_pMap, FIX::CreditRating);
+        FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::PrevClosePx);
+        FIELD_VIEW(*m_pMap, FIX::Side);
+        FIELD_VIEW(*m_pMap, FIX::SideValueInd);
+        FIELD_VIEW(*m_pMap, FIX::LocateReqd);
+        FIELD_VIEW(*m_pMap, FIX::TransactTime);
+        FIELD_VIEW(*m_pMap, FIX::NoStipulations);
+        FIELD_VIEW(*m_pMap, FIX::QuantityType);
+        FIELD_VIEW(*m_pMap, FIX::OrderQty);
+        FIELD_VIEW(*m_pMap, FIX::CashOrderQty);
+        FIELD_VIEW(*m_pMap, FIX::OrderPercent);
+        FIELD_VIEW(*m_pMap, FIX::RoundingDirection);
+        FIELD_VIEW(*m_pMap, FIX::RoundingModulus);
+        FIELD_VIEW(*m_pMap, FIX::OrdType);
+        FIELD_VIEW(*m_pMap, FIX::PriceType);
+        FIELD_VIEW(*m_pMap, FIX::Price);
+        FIELD_VIEW(*m_pMap, FIX::StopPx);
+        FIELD_VIEW(*m_pMap, FIX::Spread);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkCurveCurrency);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkCurveName);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkCurvePoint);
+        FIELD_VIEW(*m_pMap, FIX::YieldType);
+        FIELD_VIEW(*m_pMap, FIX::Yield);
+        FIELD_VIEW(*m_pMap, FIX::Currency);
+        FIELD_VIEW(*m_pMap, FIX::ComplianceID);
+        FIELD_VIEW(*m_pMap, FIX::SolicitedFlag);
+        FIELD_VIEW(*m_pMap, FIX::IOIid);
+        FIELD_VIEW(*m_pMap, FIX::QuoteID);
+        FIELD_VIEW(*m_pMap, FIX::TimeInForce);
+        FIELD_VIEW(*m_pMap, FIX::EffectiveTime);
+        FIELD_VIEW(*m_pMap, FIX::ExpireDate);
+        FIELD_VIEW(*m_pMap, FIX::ExpireTime);
+        FIELD_VIEW(*m_pMap, FIX::GTBookingInst);
+        FIELD_VIEW(*m_pMap, FIX::Commission);
+        FIELD_VIEW(*m_pMap, FIX::CommType);
+        FIELD_VIEW(*m_pMap, FIX::CommCurrency);
+        FIELD_VIEW(*m_pMap, FIX::FundRenewWaiv);
+        FIELD_VIEW(*m_pMap, FIX::OrderCapacity);
+        FIELD_VIEW(*m_pMap, FIX::OrderRestrictions);
+        FIELD_VIEW(*m_pMap, FIX::CustOrderCapacity);
+        FIELD_VIEW(*m_pMap, FIX::Rule80A);
+        FIELD_VIEW(*m_pMap, FIX::ForexReq);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrency);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+        FIELD_VIEW(*m_pMap, FIX::FutSettDate2);
+        FIELD_VIEW(*m_pMap, FIX::OrderQty2);
+        FIELD_VIEW(*m_pMap, FIX::Price2);
+        FIELD_VIEW(*m_pMap, FIX::PositionEffect);
+        FIELD_VIEW(*m_pMap, FIX::CoveredOrUncovered);
+        FIELD_VIEW(*m_pMap, FIX::MaxShow);
+        FIELD_VIEW(*m_pMap, FIX::PegDifference);
+        FIELD_VIEW(*m_pMap, FIX::DiscretionInst);
+        FIELD_VIEW(*m_pMap, FIX::DiscretionOffset);
+        FIELD_VIEW(*m_pMap, FIX::Designation);
+        FIELD_VIEW(*m_pMap, FIX::AccruedInterestRate);
+        FIELD_VIEW(*m_pMap, FIX::AccruedInterestAmt);
+        FIELD_VIEW(*m_pMap, FIX::NetMoney);
+        FIELD_VIEW(*m_pMap, FIX::NoAllocs);
+        FIELD_VIEW(*m_pMap, FIX::NoTradingSessions);
+        FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+        { return FIX::GroupView<NoPartyIDs::View>( *m_pMap, FIX::FIELD::NoPartyIDs ); }
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
+        FIX::GroupView<NoStipulations::View> noStipulations() const
+        { return FIX::GroupView<NoStipulations::View>( *m_pMap, FIX::FIELD::NoStipulations ); }
+        FIX::GroupView<NoAllocs::View> noAllocs() const
+        { return FIX::GroupView<NoAllocs::View>( *m_pMap, FIX::FIELD::NoAllocs ); }
+        FIX::GroupView<NoTradingSessions::View> noTradingSessions() const
+        { return FIX::GroupView<NoTradingSessions::View>( *m_pMap, FIX::FIELD::NoTradingSessions ); }
+      };
+    };
+    FIX::GroupView<NoOrders::View> noOrders() const
+    { return FIX::GroupView<NoOrders::View>( *this, FIX::FIELD::NoOrders ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView listID() const
+      { return getString( FIX::FIELD::ListID ); }
+      FIX::StringView bidID() const
+      { return getString( FIX::FIELD::BidID ); }
+      FIX::StringView clientBidID() const
+      { return getString( FIX::FIELD::ClientBidID ); }
+      int progRptReqs() const
+      { return getInt( FIX::FIELD::ProgRptReqs ); }
+      int bidType() const
+      { return getInt( FIX::FIELD::BidType ); }
+      int progPeriodInterval() const
+      { return getInt( FIX::FIELD::ProgPeriodInterval ); }
+      FIX::CancellationRights cancellationRights() const
+      { return FIX::CancellationRights( getChar( FIX::FIELD::CancellationRights ) ); }
+      FIX::MoneyLaunderingStatus moneyLaunderingStatus() const
+      { return FIX::MoneyLaunderingStatus( getChar( FIX::FIELD::MoneyLaunderingStatus ) ); }
+      FIX::StringView registID() const
+      { return getString( FIX::FIELD::RegistID ); }
+      FIX::ListExecInstType listExecInstType() const
+      { return FIX::ListExecInstType( getChar( FIX::FIELD::ListExecInstType ) ); }
+      FIX::StringView listExecInst() const
+      { return getString( FIX::FIELD::ListExecInst ); }
+      int encodedListExecInstLen() const
+      { return getInt( FIX::FIELD::EncodedListExecInstLen ); }
+      FIX::StringView encodedListExecInst() const
+      { return getString( FIX::FIELD::EncodedListExecInst ); }
+      int totNoOrders() const
+      { return getInt( FIX::FIELD::TotNoOrders ); }
+      int noOrders() const
+      { return getInt( FIX::FIELD::NoOrders ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "E" ) {}
+      void setListID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListID, value ); }
+      void setBidID( const FIX::StringView& value )
+      { setString( FIX::FIELD::BidID, value ); }
+      void setClientBidID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClientBidID, value ); }
+      void setProgRptReqs( int value )
+      { setInt( FIX::FIELD::ProgRptReqs, value ); }
+      void setBidType( int value )
+      { setInt( FIX::FIELD::BidType, value ); }
+      void setProgPeriodInterval( int value )
+      { setInt( FIX::FIELD::ProgPeriodInterval, value ); }
+      void setCancellationRights( char value )
+      { setChar( FIX::FIELD::CancellationRights, value ); }
+      void setMoneyLaunderingStatus( char value )
+      { setChar( FIX::FIELD::MoneyLaunderingStatus, value ); }
+      void setRegistID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RegistID, value ); }
+      void setListExecInstType( char value )
+      { setChar( FIX::FIELD::ListExecInstType, value ); }
+      void setListExecInst( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListExecInst, value ); }
+      void setEncodedListExecInstLen( int value )
+      { setInt( FIX::FIELD::EncodedListExecInstLen, value ); }
+      void setEncodedListExecInst( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedListExecInst, value ); }
+      void setTotNoOrders( int value )
+      { setInt( FIX::FIELD::TotNoOrders, value ); }
+      void setNoOrders( int value )
+      { setInt( FIX::FIELD::NoOrders, value ); }
     };
   };
 
@@ -75,7 +75,16 @@ namespace FIX43
     NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+    { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
     FIELD_SET(*this, FIX::UnderlyingSymbol);
     FIELD_SET(*this, FIX::UnderlyingSymbolSfx);
     FIELD_SET(*this, FIX::UnderlyingSecurityID);
@@ -116,7 +125,16 @@ namespace FIX43
     NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
       FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
       FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+    { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *this, FIX::FIELD::NoUnderlyingSecurityAltID ); }
     FIELD_SET(*this, FIX::Side);
     FIELD_SET(*this, FIX::TransactTime);
     FIELD_SET(*this, FIX::Text);
@@ -130,6 +148,364 @@ namespace FIX43
       FIELD_SET(*this, FIX::OrigClOrdID);
       FIELD_SET(*this, FIX::AffectedOrderID);
       FIELD_SET(*this, FIX::AffectedSecondaryOrderID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::OrigClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::AffectedOrderID);
+        FIELD_VIEW(*m_pMap, FIX::AffectedSecondaryOrderID);
+      };
+    };
+    FIX::GroupView<NoAffectedOrders::View> noAffectedOrders() const
+    { return FIX::GroupView<NoAffectedOrders::View>( *this, FIX::FIELD::NoAffectedOrders ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      FIX::StringView secondaryClOrdID() const
+      { return getString( FIX::FIELD::SecondaryClOrdID ); }
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView secondaryOrderID() const
+      { return getString( FIX::FIELD::SecondaryOrderID ); }
+      FIX::MassCancelRequestType massCancelRequestType() const
+      { return FIX::MassCancelRequestType( getChar( FIX::FIELD::MassCancelRequestType ) ); }
+      FIX::MassCancelResponse massCancelResponse() const
+      { return FIX::MassCancelResponse( getChar( FIX::FIELD::MassCancelResponse ) ); }
+      int massCancelRejectReason() const
+      { return getInt( FIX::FIELD::MassCancelRejectReason ); }
+      int totalAffectedOrders() const
+      { return getInt( FIX::FIELD::TotalAffectedOrders ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::StringView tradingSessionSubID() const
+      { return getString( FIX::FIELD::TradingSessionSubID ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView securityIDSource() const
+      { return getString( FIX::FIELD::SecurityIDSource ); }
+      int product() const
+      { return getInt( FIX::FIELD::Product ); }
+      FIX::StringView cFICode() const
+      { return getString( FIX::FIELD::CFICode ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDate() const
+      { return getString( FIX::FIELD::MaturityDate ); }
+      FIX::StringView couponPaymentDate() const
+      { return getString( FIX::FIELD::CouponPaymentDate ); }
+      FIX::StringView issueDate() const
+      { return getString( FIX::FIELD::IssueDate ); }
+      FIX::StringView repoCollateralSecurityType() const
+      { return getString( FIX::FIELD::RepoCollateralSecurityType ); }
+      int repurchaseTerm() const
+      { return getInt( FIX::FIELD::RepurchaseTerm ); }
+      FIX::Decimal repurchaseRate() const
+      { return getDecimal( FIX::FIELD::RepurchaseRate ); }
+      double factor() const
+      { return getDouble( FIX::FIELD::Factor ); }
+      FIX::StringView creditRating() const
+      { return getString( FIX::FIELD::CreditRating ); }
+      FIX::StringView instrRegistry() const
+      { return getString( FIX::FIELD::InstrRegistry ); }
+      FIX::StringView countryOfIssue() const
+      { return getString( FIX::FIELD::CountryOfIssue ); }
+      FIX::StringView stateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::StateOrProvinceOfIssue ); }
+      FIX::StringView localeOfIssue() const
+      { return getString( FIX::FIELD::LocaleOfIssue ); }
+      FIX::StringView redemptionDate() const
+      { return getString( FIX::FIELD::RedemptionDate ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      int noSecurityAltID() const
+      { return getInt( FIX::FIELD::NoSecurityAltID ); }
+      FIX::StringView underlyingSymbol() const
+      { return getString( FIX::FIELD::UnderlyingSymbol ); }
+      FIX::StringView underlyingSymbolSfx() const
+      { return getString( FIX::FIELD::UnderlyingSymbolSfx ); }
+      FIX::StringView underlyingSecurityID() const
+      { return getString( FIX::FIELD::UnderlyingSecurityID ); }
+      FIX::StringView underlyingSecurityIDSource() const
+      { return getString( FIX::FIELD::UnderlyingSecurityIDSource ); }
+      int underlyingProduct() const
+      { return getInt( FIX::FIELD::UnderlyingProduct ); }
+      FIX::StringView underlyingCFICode() const
+      { return getString( FIX::FIELD::UnderlyingCFICode ); }
+      FIX::StringView underlyingSecurityType() const
+      { return getString( FIX::FIELD::UnderlyingSecurityType ); }
+      FIX::StringView underlyingMaturityMonthYear() const
+      { return getString( FIX::FIELD::UnderlyingMaturityMonthYear ); }
+      FIX::StringView underlyingMaturityDate() const
+      { return getString( FIX::FIELD::UnderlyingMaturityDate ); }
+      int underlyingPutOrCall() const
+      { return getInt( FIX::FIELD::UnderlyingPutOrCall ); }
+      FIX::StringView underlyingCouponPaymentDate() const
+      { return getString( FIX::FIELD::UnderlyingCouponPaymentDate ); }
+      FIX::StringView underlyingIssueDate() const
+      { return getString( FIX::FIELD::UnderlyingIssueDate ); }
+      FIX::StringView underlyingRepoCollateralSecurityType() const
+      { return getString( FIX::FIELD::UnderlyingRepoCollateralSecurityType ); }
+      int underlyingRepurchaseTerm() const
+      { return getInt( FIX::FIELD::UnderlyingRepurchaseTerm ); }
+      FIX::Decimal underlyingRepurchaseRate() const
+      { return getDecimal( FIX::FIELD::UnderlyingRepurchaseRate ); }
+      double underlyingFactor() const
+      { return getDouble( FIX::FIELD::UnderlyingFactor ); }
+      FIX::StringView underlyingCreditRating() const
+      { return getString( FIX::FIELD::UnderlyingCreditRating ); }
+      FIX::StringView underlyingInstrRegistry() const
+      { return getString( FIX::FIELD::UnderlyingInstrRegistry ); }
+      FIX::StringView underlyingCountryOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingCountryOfIssue ); }
+      FIX::StringView underlyingStateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingStateOrProvinceOfIssue ); }
+      FIX::StringView underlyingLocaleOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingLocaleOfIssue ); }
+      FIX::StringView underlyingRedemptionDate() const
+      { return getString( FIX::FIELD::UnderlyingRedemptionDate ); }
+      FIX::Decimal underlyingStrikePrice() const
+      { return getDecimal( FIX::FIELD::UnderlyingStrikePrice ); }
+      char underlyingOptAttribute() const
+      { return getChar( FIX::FIELD::UnderlyingOptAttribute ); }
+      double underlyingContractMultiplier() const
+      { return getDouble( FIX::FIELD::UnderlyingContractMultiplier ); }
+      FIX::Decimal underlyingCouponRate() const
+      { return getDecimal( FIX::FIELD::UnderlyingCouponRate ); }
+      FIX::StringView underlyingSecurityExchange() const
+      { return getString( FIX::FIELD::UnderlyingSecurityExchange ); }
+      FIX::StringView underlyingIssuer() const
+      { return getString( FIX::FIELD::UnderlyingIssuer ); }
+      int encodedUnderlyingIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedUnderlyingIssuerLen ); }
+      FIX::StringView encodedUnderlyingIssuer() const
+      { return getString( FIX::FIELD::EncodedUnderlyingIssuer ); }
+      FIX::StringView underlyingSecurityDesc() const
+      { return getString( FIX::FIELD::UnderlyingSecurityDesc ); }
+      int encodedUnderlyingSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedUnderlyingSecurityDescLen ); }
+      FIX::StringView encodedUnderlyingSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedUnderlyingSecurityDesc ); }
+      int noUnderlyingSecurityAltID() const
+      { return getInt( FIX::FIELD::NoUnderlyingSecurityAltID ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      int noAffectedOrders() const
+      { return getInt( FIX::FIELD::NoAffectedOrders ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "r" ) {}
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setSecondaryClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecondaryClOrdID, value ); }
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setSecondaryOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecondaryOrderID, value ); }
+      void setMassCancelRequestType( char value )
+      { setChar( FIX::FIELD::MassCancelRequestType, value ); }
+      void setMassCancelResponse( char value )
+      { setChar( FIX::FIELD::MassCancelResponse, value ); }
+      void setMassCancelRejectReason( int value )
+      { setInt( FIX::FIELD::MassCancelRejectReason, value ); }
+      void setTotalAffectedOrders( int value )
+      { setInt( FIX::FIELD::TotalAffectedOrders, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setTradingSessionSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionSubID, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityIDSource, value ); }
+      void setProduct( int value )
+      { setInt( FIX::FIELD::Product, value ); }
+      void setCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::CFICode, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDate, value ); }
+      void setCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::CouponPaymentDate, value ); }
+      void setIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::IssueDate, value ); }
+      void setRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RepoCollateralSecurityType, value ); }
+      void setRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::RepurchaseTerm, value ); }
+      void setRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::RepurchaseRate, value ); }
+      void setFactor( double value )
+      { setDouble( FIX::FIELD::Factor, value ); }
+      void setCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::CreditRating, value ); }
+      void setInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::InstrRegistry, value ); }
+      void setCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::CountryOfIssue, value ); }
+      void setStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::StateOrProvinceOfIssue, value ); }
+      void setLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::LocaleOfIssue, value ); }
+      void setRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::RedemptionDate, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setNoSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoSecurityAltID, value ); }
+      void setUnderlyingSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSymbol, value ); }
+      void setUnderlyingSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSymbolSfx, value ); }
+      void setUnderlyingSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityID, value ); }
+      void setUnderlyingSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityIDSource, value ); }
+      void setUnderlyingProduct( int value )
+      { setInt( FIX::FIELD::UnderlyingProduct, value ); }
+      void setUnderlyingCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCFICode, value ); }
+      void setUnderlyingSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityType, value ); }
+      void setUnderlyingMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingMaturityMonthYear, value ); }
+      void setUnderlyingMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingMaturityDate, value ); }
+      void setUnderlyingPutOrCall( int value )
+      { setInt( FIX::FIELD::UnderlyingPutOrCall, value ); }
+      void setUnderlyingCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCouponPaymentDate, value ); }
+      void setUnderlyingIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingIssueDate, value ); }
+      void setUnderlyingRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingRepoCollateralSecurityType, value ); }
+      void setUnderlyingRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::UnderlyingRepurchaseTerm, value ); }
+      void setUnderlyingRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingRepurchaseRate, value ); }
+      void setUnderlyingFactor( double value )
+      { setDouble( FIX::FIELD::UnderlyingFactor, value ); }
+      void setUnderlyingCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCreditRating, value ); }
+      void setUnderlyingInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingInstrRegistry, value ); }
+      void setUnderlyingCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCountryOfIssue, value ); }
+      void setUnderlyingStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingStateOrProvinceOfIssue, value ); }
+      void setUnderlyingLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingLocaleOfIssue, value ); }
+      void setUnderlyingRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingRedemptionDate, value ); }
+      void setUnderlyingStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingStrikePrice, value ); }
+      void setUnderlyingOptAttribute( char value )
+      { setChar( FIX::FIELD::UnderlyingOptAttribute, value ); }
+      void setUnderlyingContractMultiplier( double value )
+      { setDouble( FIX::FIELD::UnderlyingContractMultiplier, value ); }
+      void setUnderlyingCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingCouponRate, value ); }
+      void setUnderlyingSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityExchange, value ); }
+      void setUnderlyingIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingIssuer, value ); }
+      void setEncodedUnderlyingIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedUnderlyingIssuerLen, value ); }
+      void setEncodedUnderlyingIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedUnderlyingIssuer, value ); }
+      void setUnderlyingSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityDesc, value ); }
+      void setEncodedUnderlyingSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedUnderlyingSecurityDescLen, value ); }
+      void setEncodedUnderlyingSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedUnderlyingSecurityDesc, value ); }
+      void setNoUnderlyingSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoUnderlyingSecurityAltID, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setNoAffectedOrders( int value )
+      { setInt( FIX::FIELD::NoAffectedOrders, value ); }
     };
   };
 
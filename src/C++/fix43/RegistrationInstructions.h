@@ -39,7 +39,18 @@ namespace FIX43
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
       FIELD_SET(*this, FIX::PartySubID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PartyID);
+        FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PartyRole);
+        FIELD_VIEW(*m_pMap, FIX::PartySubID);
+      };
     };
+    FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+    { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
     FIELD_SET(*this, FIX::Account);
     FIELD_SET(*this, FIX::RegistAcctType);
     FIELD_SET(*this, FIX::TaxAdvantageType);
@@ -62,11 +73,39 @@ namespace FIX43
         FIELD_SET(*this, FIX::NestedPartyIDSource);
         FIELD_SET(*this, FIX::NestedPartyRole);
         FIELD_SET(*this, FIX::NestedPartySubID);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyID);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartySubID);
+        };
       };
+      FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+      { return FIX::GroupView<NoNestedPartyIDs::View>( *this, FIX::FIELD::NoNestedPartyIDs ); }
       FIELD_SET(*this, FIX::OwnerType);
       FIELD_SET(*this, FIX::DateOfBirth);
       FIELD_SET(*this, FIX::InvestorCountryOfResidence);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::RegistDetls);
+        FIELD_VIEW(*m_pMap, FIX::RegistEmail);
+        FIELD_VIEW(*m_pMap, FIX::MailingDtls);
+        FIELD_VIEW(*m_pMap, FIX::MailingInst);
+        FIELD_VIEW(*m_pMap, FIX::NoNestedPartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::OwnerType);
+        FIELD_VIEW(*m_pMap, FIX::DateOfBirth);
+        FIELD_VIEW(*m_pMap, FIX::InvestorCountryOfResidence);
+        FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+        { return FIX::GroupView<NoNestedPartyIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartyIDs ); }
+      };
     };
+    FIX::GroupView<NoRegistDtls::View> noRegistDtls() const
+    { return FIX::GroupView<NoRegistDtls::View>( *this, FIX::FIELD::NoRegistDtls ); }
     FIELD_SET(*this, FIX::NoDistribInsts);
     class NoDistribInsts: public FIX::Group
     {
@@ -79,6 +118,78 @@ namespace FIX43
       FIELD_SET(*this, FIX::CashDistribAgentCode);
       FIELD_SET(*this, FIX::CashDistribAgentAcctNumber);
       FIELD_SET(*this, FIX::CashDistribPayRef);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::DistribPaymentMethod);
+        FIELD_VIEW(*m_pMap, FIX::DistribPercentage);
+        FIELD_VIEW(*m_pMap, FIX::CashDistribCurr);
+        FIELD_VIEW(*m_pMap, FIX::CashDistribAgentName);
+        FIELD_VIEW(*m_pMap, FIX::CashDistribAgentCode);
+        FIELD_VIEW(*m_pMap, FIX::CashDistribAgentAcctNumber);
+        FIELD_VIEW(*m_pMap, FIX::CashDistribPayRef);
+      };
+    };
+    FIX::GroupView<NoDistribInsts::View> noDistribInsts() const
+    { return FIX::GroupView<NoDistribInsts::View>( *this, FIX::FIELD::NoDistribInsts ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView registID() const
+      { return getString( FIX::FIELD::RegistID ); }
+      FIX::RegistTransType registTransType() const
+      { return FIX::RegistTransType( getChar( FIX::FIELD::RegistTransType ) ); }
+      FIX::StringView registRefID() const
+      { return getString( FIX::FIELD::RegistRefID ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      int noPartyIDs() const
+      { return getInt( FIX::FIELD::NoPartyIDs ); }
+      FIX::StringView account() const
+      { return getString( FIX::FIELD::Account ); }
+      FIX::StringView registAcctType() const
+      { return getString( FIX::FIELD::RegistAcctType ); }
+      int taxAdvantageType() const
+      { return getInt( FIX::FIELD::TaxAdvantageType ); }
+      FIX::OwnershipType ownershipType() const
+      { return FIX::OwnershipType( getChar( FIX::FIELD::OwnershipType ) ); }
+      int noRegistDtls() const
+      { return getInt( FIX::FIELD::NoRegistDtls ); }
+      int noDistribInsts() const
+      { return getInt( FIX::FIELD::NoDistribInsts ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "o" ) {}
+      void setRegistID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RegistID, value ); }
+      void setRegistTransType( char value )
+      { setChar( FIX::FIELD::RegistTransType, value ); }
+      void setRegistRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RegistRefID, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setNoPartyIDs( int value )
+      { setInt( FIX::FIELD::NoPartyIDs, value ); }
+      void setAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::Account, value ); }
+      void setRegistAcctType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RegistAcctType, value ); }
+      void setTaxAdvantageType( int value )
+      { setInt( FIX::FIELD::TaxAdvantageType, value ); }
+      void setOwnershipType( char value )
+      { setChar( FIX::FIELD::OwnershipType, value ); }
+      void setNoRegistDtls( int value )
+      { setInt( FIX::FIELD::NoRegistDtls, value ); }
+      void setNoDistribInsts( int value )
+      { setInt( FIX::FIELD::NoDistribInsts, value ); }
     };
   };
 
@@ -41,11 +41,72 @@ namespace FIX43
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
       FIELD_SET(*this, FIX::PartySubID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PartyID);
+        FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PartyRole);
+        FIELD_VIEW(*m_pMap, FIX::PartySubID);
+      };
     };
+    FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+    { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
     FIELD_SET(*this, FIX::Account);
     FIELD_SET(*this, FIX::RegistStatus);
     FIELD_SET(*this, FIX::RegistRejReasonCode);
     FIELD_SET(*this, FIX::RegistRejReasonText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView registID() const
+      { return getString( FIX::FIELD::RegistID ); }
+      FIX::RegistTransType registTransType() const
+      { return FIX::RegistTransType( getChar( FIX::FIELD::RegistTransType ) ); }
+      FIX::StringView registRefID() const
+      { return getString( FIX::FIELD::RegistRefID ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      int noPartyIDs() const
+      { return getInt( FIX::FIELD::NoPartyIDs ); }
+      FIX::StringView account() const
+      { return getString( FIX::FIELD::Account ); }
+      FIX::RegistStatus registStatus() const
+      { return FIX::RegistStatus( getChar( FIX::FIELD::RegistStatus ) ); }
+      int registRejReasonCode() const
+      { return getInt( FIX::FIELD::RegistRejReasonCode ); }
+      FIX::StringView registRejReasonText() const
+      { return getString( FIX::FIELD::RegistRejReasonText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "p" ) {}
+      void setRegistID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RegistID, value ); }
+      void setRegistTransType( char value )
+      { setChar( FIX::FIELD::RegistTransType, value ); }
+      void setRegistRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RegistRefID, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setNoPartyIDs( int value )
+      { setInt( FIX::FIELD::NoPartyIDs, value ); }
+      void setAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::Account, value ); }
+      void setRegistStatus( char value )
+      { setChar( FIX::FIELD::RegistStatus, value ); }
+      void setRegistRejReasonCode( int value )
+      { setInt( FIX::FIELD::RegistRejReasonCode, value ); }
+      void setRegistRejReasonText( const FIX::StringView& value )
+      { setString( FIX::FIELD::RegistRejReasonText, value ); }
+    };
   };
 
 }
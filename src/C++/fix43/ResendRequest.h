@@ -26,6 +26,28 @@ namespace FIX43
 
     FIELD_SET(*this, FIX::BeginSeqNo);
     FIELD_SET(*this, FIX::EndSeqNo);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      int beginSeqNo() const
+      { return getInt( FIX::FIELD::BeginSeqNo ); }
+      int endSeqNo() const
+      { return getInt( FIX::FIELD::EndSeqNo ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "2" ) {}
+      void setBeginSeqNo( int value )
+      { setInt( FIX::FIELD::BeginSeqNo, value ); }
+      void setEndSeqNo( int value )
+      { setInt( FIX::FIELD::EndSeqNo, value ); }
+    };
   };
 
 }
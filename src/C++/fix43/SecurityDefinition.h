@@ -68,7 +68,16 @@ namespace FIX43
     NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+    { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
     FIELD_SET(*this, FIX::Currency);
     FIELD_SET(*this, FIX::TradingSessionID);
     FIELD_SET(*this, FIX::TradingSessionSubID);
@@ -123,8 +132,256 @@ namespace FIX43
       NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
         FIELD_SET(*this, FIX::LegSecurityAltID);
         FIELD_SET(*this, FIX::LegSecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+      { return FIX::GroupView<NoLegSecurityAltID::View>( *this, FIX::FIELD::NoLegSecurityAltID ); }
       FIELD_SET(*this, FIX::LegCurrency);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::LegSymbol);
+        FIELD_VIEW(*m_pMap, FIX::LegSymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::LegProduct);
+        FIELD_VIEW(*m_pMap, FIX::LegCFICode);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::LegMaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::LegMaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::LegCouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::LegIssueDate);
+        FIELD_VIEW(*m_pMap, FIX::LegRepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::LegRepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::LegRepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::LegFactor);
+        FIELD_VIEW(*m_pMap, FIX::LegCreditRating);
+        FIELD_VIEW(*m_pMap, FIX::LegInstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::LegCountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegStateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegLocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegRedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::LegStrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::LegOptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::LegContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::LegCouponRate);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::LegIssuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuer);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::LegRatioQty);
+        FIELD_VIEW(*m_pMap, FIX::LegSide);
+        FIELD_VIEW(*m_pMap, FIX::NoLegSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::LegCurrency);
+        FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+        { return FIX::GroupView<NoLegSecurityAltID::View>( *m_pMap, FIX::FIELD::NoLegSecurityAltID ); }
+      };
+    };
+    FIX::GroupView<NoLegs::View> noLegs() const
+    { return FIX::GroupView<NoLegs::View>( *this, FIX::FIELD::NoLegs ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView securityReqID() const
+      { return getString( FIX::FIELD::SecurityReqID ); }
+      FIX::StringView securityResponseID() const
+      { return getString( FIX::FIELD::SecurityResponseID ); }
+      int securityResponseType() const
+      { return getInt( FIX::FIELD::SecurityResponseType ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView securityIDSource() const
+      { return getString( FIX::FIELD::SecurityIDSource ); }
+      int product() const
+      { return getInt( FIX::FIELD::Product ); }
+      FIX::StringView cFICode() const
+      { return getString( FIX::FIELD::CFICode ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDate() const
+      { return getString( FIX::FIELD::MaturityDate ); }
+      FIX::StringView couponPaymentDate() const
+      { return getString( FIX::FIELD::CouponPaymentDate ); }
+      FIX::StringView issueDate() const
+      { return getString( FIX::FIELD::IssueDate ); }
+      FIX::StringView repoCollateralSecurityType() const
+      { return getString( FIX::FIELD::RepoCollateralSecurityType ); }
+      int repurchaseTerm() const
+      { return getInt( FIX::FIELD::RepurchaseTerm ); }
+      FIX::Decimal repurchaseRate() const
+      { return getDecimal( FIX::FIELD::RepurchaseRate ); }
+      double factor() const
+      { return getDouble( FIX::FIELD::Factor ); }
+      FIX::StringView creditRating() const
+      { return getString( FIX::FIELD::CreditRating ); }
+      FIX::StringView instrRegistry() const
+      { return getString( FIX::FIELD::InstrRegistry ); }
+      FIX::StringView countryOfIssue() const
+      { return getString( FIX::FIELD::CountryOfIssue ); }
+      FIX::StringView stateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::StateOrProvinceOfIssue ); }
+      FIX::StringView localeOfIssue() const
+      { return getString( FIX::FIELD::LocaleOfIssue ); }
+      FIX::StringView redemptionDate() const
+      { return getString( FIX::FIELD::RedemptionDate ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      int noSecurityAltID() const
+      { return getInt( FIX::FIELD::NoSecurityAltID ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::StringView tradingSessionSubID() const
+      { return getString( FIX::FIELD::TradingSessionSubID ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      FIX::Decimal roundLot() const
+      { return getDecimal( FIX::FIELD::RoundLot ); }
+      FIX::Decimal minTradeVol() const
+      { return getDecimal( FIX::FIELD::MinTradeVol ); }
+      int noLegs() const
+      { return getInt( FIX::FIELD::NoLegs ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "d" ) {}
+      void setSecurityReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityReqID, value ); }
+      void setSecurityResponseID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityResponseID, value ); }
+      void setSecurityResponseType( int value )
+      { setInt( FIX::FIELD::SecurityResponseType, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityIDSource, value ); }
+      void setProduct( int value )
+      { setInt( FIX::FIELD::Product, value ); }
+      void setCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::CFICode, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDate, value ); }
+      void setCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::CouponPaymentDate, value ); }
+      void setIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::IssueDate, value ); }
+      void setRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RepoCollateralSecurityType, value ); }
+      void setRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::RepurchaseTerm, value ); }
+      void setRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::RepurchaseRate, value ); }
+      void setFactor( double value )
+      { setDouble( FIX::FIELD::Factor, value ); }
+      void setCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::CreditRating, value ); }
+      void setInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::InstrRegistry, value ); }
+      void setCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::CountryOfIssue, value ); }
+      void setStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::StateOrProvinceOfIssue, value ); }
+      void setLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::LocaleOfIssue, value ); }
+      void setRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::RedemptionDate, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setNoSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoSecurityAltID, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setTradingSessionSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionSubID, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setRoundLot( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::RoundLot, value ); }
+      void setMinTradeVol( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MinTradeVol, value ); }
+      void setNoLegs( int value )
+      { setInt( FIX::FIELD::NoLegs, value ); }
     };
   };
 
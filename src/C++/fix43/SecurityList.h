@@ -74,7 +74,16 @@ namespace FIX43
       NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+      { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
       FIELD_SET(*this, FIX::Currency);
       FIELD_SET(*this, FIX::RoundLot);
       FIELD_SET(*this, FIX::MinTradeVol);
@@ -129,10 +138,151 @@ namespace FIX43
         NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
           FIELD_SET(*this, FIX::LegSecurityAltID);
           FIELD_SET(*this, FIX::LegSecurityAltIDSource);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityAltID);
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityAltIDSource);
+          };
         };
+        FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+        { return FIX::GroupView<NoLegSecurityAltID::View>( *this, FIX::FIELD::NoLegSecurityAltID ); }
         FIELD_SET(*this, FIX::LegCurrency);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::LegSymbol);
+          FIELD_VIEW(*m_pMap, FIX::LegSymbolSfx);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityID);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityIDSource);
+          FIELD_VIEW(*m_pMap, FIX::LegProduct);
+          FIELD_VIEW(*m_pMap, FIX::LegCFICode);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::LegMaturityMonthYear);
+          FIELD_VIEW(*m_pMap, FIX::LegMaturityDate);
+          FIELD_VIEW(*m_pMap, FIX::LegCouponPaymentDate);
+          FIELD_VIEW(*m_pMap, FIX::LegIssueDate);
+          FIELD_VIEW(*m_pMap, FIX::LegRepoCollateralSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::LegRepurchaseTerm);
+          FIELD_VIEW(*m_pMap, FIX::LegRepurchaseRate);
+          FIELD_VIEW(*m_pMap, FIX::LegFactor);
+          FIELD_VIEW(*m_pMap, FIX::LegCreditRating);
+          FIELD_VIEW(*m_pMap, FIX::LegInstrRegistry);
+          FIELD_VIEW(*m_pMap, FIX::LegCountryOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegStateOrProvinceOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegLocaleOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegRedemptionDate);
+          FIELD_VIEW(*m_pMap, FIX::LegStrikePrice);
+          FIELD_VIEW(*m_pMap, FIX::LegOptAttribute);
+          FIELD_VIEW(*m_pMap, FIX::LegContractMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::LegCouponRate);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityExchange);
+          FIELD_VIEW(*m_pMap, FIX::LegIssuer);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuerLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuer);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDescLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::LegRatioQty);
+          FIELD_VIEW(*m_pMap, FIX::LegSide);
+          FIELD_VIEW(*m_pMap, FIX::NoLegSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::LegCurrency);
+          FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+          { return FIX::GroupView<NoLegSecurityAltID::View>( *m_pMap, FIX::FIELD::NoLegSecurityAltID ); }
+        };
+      };
+      FIX::GroupView<NoLegs::View> noLegs() const
+      { return FIX::GroupView<NoLegs::View>( *this, FIX::FIELD::NoLegs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::Product);
+        FIELD_VIEW(*m_pMap, FIX::CFICode);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::IssueDate);
+        FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::Factor);
+        FIELD_VIEW(*m_pMap, FIX::CreditRating);
+        FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::Currency);
+        FIELD_VIEW(*m_pMap, FIX::RoundLot);
+        FIELD_VIEW(*m_pMap, FIX::MinTradeVol);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+        FIELD_VIEW(*m_pMap, FIX::NoLegs);
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
+        FIX::GroupView<NoLegs::View> noLegs() const
+        { return FIX::GroupView<NoLegs::View>( *m_pMap, FIX::FIELD::NoLegs ); }
       };
     };
+    FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+    { return FIX::GroupView<NoRelatedSym::View>( *this, FIX::FIELD::NoRelatedSym ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView securityReqID() const
+      { return getString( FIX::FIELD::SecurityReqID ); }
+      FIX::StringView securityResponseID() const
+      { return getString( FIX::FIELD::SecurityResponseID ); }
+      int securityRequestResult() const
+      { return getInt( FIX::FIELD::SecurityRequestResult ); }
+      int totalNumSecurities() const
+      { return getInt( FIX::FIELD::TotalNumSecurities ); }
+      int noRelatedSym() const
+      { return getInt( FIX::FIELD::NoRelatedSym ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "y" ) {}
+      void setSecurityReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityReqID, value ); }
+      void setSecurityResponseID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityResponseID, value ); }
+      void setSecurityRequestResult( int value )
+      { setInt( FIX::FIELD::SecurityRequestResult, value ); }
+      void setTotalNumSecurities( int value )
+      { setInt( FIX::FIELD::TotalNumSecurities, value ); }
+      void setNoRelatedSym( int value )
+      { setInt( FIX::FIELD::NoRelatedSym, value ); }
+    };
   };
 
 }
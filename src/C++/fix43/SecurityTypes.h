@@ -44,6 +44,74 @@ namespace FIX43
       FIELD_SET(*this, FIX::SecurityType);
       FIELD_SET(*this, FIX::Product);
       FIELD_SET(*this, FIX::CFICode);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::Product);
+        FIELD_VIEW(*m_pMap, FIX::CFICode);
+      };
+    };
+    FIX::GroupView<NoSecurityTypes::View> noSecurityTypes() const
+    { return FIX::GroupView<NoSecurityTypes::View>( *this, FIX::FIELD::NoSecurityTypes ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView securityReqID() const
+      { return getString( FIX::FIELD::SecurityReqID ); }
+      FIX::StringView securityResponseID() const
+      { return getString( FIX::FIELD::SecurityResponseID ); }
+      int securityResponseType() const
+      { return getInt( FIX::FIELD::SecurityResponseType ); }
+      int totalNumSecurityTypes() const
+      { return getInt( FIX::FIELD::TotalNumSecurityTypes ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::StringView tradingSessionSubID() const
+      { return getString( FIX::FIELD::TradingSessionSubID ); }
+      FIX::SubscriptionRequestType subscriptionRequestType() const
+      { return FIX::SubscriptionRequestType( getChar( FIX::FIELD::SubscriptionRequestType ) ); }
+      int noSecurityTypes() const
+      { return getInt( FIX::FIELD::NoSecurityTypes ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "w" ) {}
+      void setSecurityReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityReqID, value ); }
+      void setSecurityResponseID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityResponseID, value ); }
+      void setSecurityResponseType( int value )
+      { setInt( FIX::FIELD::SecurityResponseType, value ); }
+      void setTotalNumSecurityTypes( int value )
+      { setInt( FIX::FIELD::TotalNumSecurityTypes, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setTradingSessionSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionSubID, value ); }
+      void setSubscriptionRequestType( char value )
+      { setChar( FIX::FIELD::SubscriptionRequestType, value ); }
+      void setNoSecurityTypes( int value )
+      { setInt( FIX::FIELD::NoSecurityTypes, value ); }
     };
   };
 
@@ -60,7 +60,18 @@ namespace FIX43
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
       FIELD_SET(*this, FIX::PartySubID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PartyID);
+        FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PartyRole);
+        FIELD_VIEW(*m_pMap, FIX::PartySubID);
+      };
     };
+    FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+    { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
     FIELD_SET(*this, FIX::StandInstDbType);
     FIELD_SET(*this, FIX::StandInstDbName);
     FIELD_SET(*this, FIX::StandInstDbID);
@@ -89,6 +100,208 @@ namespace FIX43
     FIELD_SET(*this, FIX::CardIssNo);
     FIELD_SET(*this, FIX::PaymentDate);
     FIELD_SET(*this, FIX::PaymentRemitterID);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView settlInstID() const
+      { return getString( FIX::FIELD::SettlInstID ); }
+      FIX::SettlInstTransType settlInstTransType() const
+      { return FIX::SettlInstTransType( getChar( FIX::FIELD::SettlInstTransType ) ); }
+      FIX::StringView settlInstRefID() const
+      { return getString( FIX::FIELD::SettlInstRefID ); }
+      FIX::SettlInstMode settlInstMode() const
+      { return FIX::SettlInstMode( getChar( FIX::FIELD::SettlInstMode ) ); }
+      FIX::SettlInstSource settlInstSource() const
+      { return FIX::SettlInstSource( getChar( FIX::FIELD::SettlInstSource ) ); }
+      FIX::StringView allocAccount() const
+      { return getString( FIX::FIELD::AllocAccount ); }
+      FIX::StringView individualAllocID() const
+      { return getString( FIX::FIELD::IndividualAllocID ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView allocID() const
+      { return getString( FIX::FIELD::AllocID ); }
+      FIX::StringView lastMkt() const
+      { return getString( FIX::FIELD::LastMkt ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::StringView tradingSessionSubID() const
+      { return getString( FIX::FIELD::TradingSessionSubID ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView effectiveTime() const
+      { return getString( FIX::FIELD::EffectiveTime ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      int noPartyIDs() const
+      { return getInt( FIX::FIELD::NoPartyIDs ); }
+      int standInstDbType() const
+      { return getInt( FIX::FIELD::StandInstDbType ); }
+      FIX::StringView standInstDbName() const
+      { return getString( FIX::FIELD::StandInstDbName ); }
+      FIX::StringView standInstDbID() const
+      { return getString( FIX::FIELD::StandInstDbID ); }
+      int settlDeliveryType() const
+      { return getInt( FIX::FIELD::SettlDeliveryType ); }
+      FIX::StringView settlDepositoryCode() const
+      { return getString( FIX::FIELD::SettlDepositoryCode ); }
+      FIX::StringView settlBrkrCode() const
+      { return getString( FIX::FIELD::SettlBrkrCode ); }
+      FIX::StringView settlInstCode() const
+      { return getString( FIX::FIELD::SettlInstCode ); }
+      FIX::StringView securitySettlAgentName() const
+      { return getString( FIX::FIELD::SecuritySettlAgentName ); }
+      FIX::StringView securitySettlAgentCode() const
+      { return getString( FIX::FIELD::SecuritySettlAgentCode ); }
+      FIX::StringView securitySettlAgentAcctNum() const
+      { return getString( FIX::FIELD::SecuritySettlAgentAcctNum ); }
+      FIX::StringView securitySettlAgentAcctName() const
+      { return getString( FIX::FIELD::SecuritySettlAgentAcctName ); }
+      FIX::StringView securitySettlAgentContactName() const
+      { return getString( FIX::FIELD::SecuritySettlAgentContactName ); }
+      FIX::StringView securitySettlAgentContactPhone() const
+      { return getString( FIX::FIELD::SecuritySettlAgentContactPhone ); }
+      FIX::StringView cashSettlAgentName() const
+      { return getString( FIX::FIELD::CashSettlAgentName ); }
+      FIX::StringView cashSettlAgentCode() const
+      { return getString( FIX::FIELD::CashSettlAgentCode ); }
+      FIX::StringView cashSettlAgentAcctNum() const
+      { return getString( FIX::FIELD::CashSettlAgentAcctNum ); }
+      FIX::StringView cashSettlAgentAcctName() const
+      { return getString( FIX::FIELD::CashSettlAgentAcctName ); }
+      FIX::StringView cashSettlAgentContactName() const
+      { return getString( FIX::FIELD::CashSettlAgentContactName ); }
+      FIX::StringView cashSettlAgentContactPhone() const
+      { return getString( FIX::FIELD::CashSettlAgentContactPhone ); }
+      int paymentMethod() const
+      { return getInt( FIX::FIELD::PaymentMethod ); }
+      FIX::StringView paymentRef() const
+      { return getString( FIX::FIELD::PaymentRef ); }
+      FIX::StringView cardHolderName() const
+      { return getString( FIX::FIELD::CardHolderName ); }
+      FIX::StringView cardNumber() const
+      { return getString( FIX::FIELD::CardNumber ); }
+      FIX::StringView cardStartDate() const
+      { return getString( FIX::FIELD::CardStartDate ); }
+      FIX::StringView cardExpDate() const
+      { return getString( FIX::FIELD::CardExpDate ); }
+      FIX::StringView cardIssNo() const
+      { return getString( FIX::FIELD::CardIssNo ); }
+      FIX::StringView paymentDate() const
+      { return getString( FIX::FIELD::PaymentDate ); }
+      FIX::StringView paymentRemitterID() const
+      { return getString( FIX::FIELD::PaymentRemitterID ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "T" ) {}
+      void setSettlInstID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlInstID, value ); }
+      void setSettlInstTransType( char value )
+      { setChar( FIX::FIELD::SettlInstTransType, value ); }
+      void setSettlInstRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlInstRefID, value ); }
+      void setSettlInstMode( char value )
+      { setChar( FIX::FIELD::SettlInstMode, value ); }
+      void setSettlInstSource( char value )
+      { setChar( FIX::FIELD::SettlInstSource, value ); }
+      void setAllocAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocAccount, value ); }
+      void setIndividualAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::IndividualAllocID, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocID, value ); }
+      void setLastMkt( const FIX::StringView& value )
+      { setString( FIX::FIELD::LastMkt, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setTradingSessionSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionSubID, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setEffectiveTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::EffectiveTime, value ); }
+      void setEffectiveTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::EffectiveTime, value, precision ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setNoPartyIDs( int value )
+      { setInt( FIX::FIELD::NoPartyIDs, value ); }
+      void setStandInstDbType( int value )
+      { setInt( FIX::FIELD::StandInstDbType, value ); }
+      void setStandInstDbName( const FIX::StringView& value )
+      { setString( FIX::FIELD::StandInstDbName, value ); }
+      void setStandInstDbID( const FIX::StringView& value )
+      { setString( FIX::FIELD::StandInstDbID, value ); }
+      void setSettlDeliveryType( int value )
+      { setInt( FIX::FIELD::SettlDeliveryType, value ); }
+      void setSettlDepositoryCode( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlDepositoryCode, value ); }
+      void setSettlBrkrCode( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlBrkrCode, value ); }
+      void setSettlInstCode( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlInstCode, value ); }
+      void setSecuritySettlAgentName( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySettlAgentName, value ); }
+      void setSecuritySettlAgentCode( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySettlAgentCode, value ); }
+      void setSecuritySettlAgentAcctNum( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySettlAgentAcctNum, value ); }
+      void setSecuritySettlAgentAcctName( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySettlAgentAcctName, value ); }
+      void setSecuritySettlAgentContactName( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySettlAgentContactName, value ); }
+      void setSecuritySettlAgentContactPhone( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySettlAgentContactPhone, value ); }
+      void setCashSettlAgentName( const FIX::StringView& value )
+      { setString( FIX::FIELD::CashSettlAgentName, value ); }
+      void setCashSettlAgentCode( const FIX::StringView& value )
+      { setString( FIX::FIELD::CashSettlAgentCode, value ); }
+      void setCashSettlAgentAcctNum( const FIX::StringView& value )
+      { setString( FIX::FIELD::CashSettlAgentAcctNum, value ); }
+      void setCashSettlAgentAcctName( const FIX::StringView& value )
+      { setString( FIX::FIELD::CashSettlAgentAcctName, value ); }
+      void setCashSettlAgentContactName( const FIX::StringView& value )
+      { setString( FIX::FIELD::CashSettlAgentContactName, value ); }
+      void setCashSettlAgentContactPhone( const FIX::StringView& value )
+      { setString( FIX::FIELD::CashSettlAgentContactPhone, value ); }
+      void setPaymentMethod( int value )
+      { setInt( FIX::FIELD::PaymentMethod, value ); }
+      void setPaymentRef( const FIX::StringView& value )
+      { setString( FIX::FIELD::PaymentRef, value ); }
+      void setCardHolderName( const FIX::StringView& value )
+      { setString( FIX::FIELD::CardHolderName, value ); }
+      void setCardNumber( const FIX::StringView& value )
+      { setString( FIX::FIELD::CardNumber, value ); }
+      void setCardStartDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::CardStartDate, value ); }
+      void setCardExpDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::CardExpDate, value ); }
+      void setCardIssNo( const FIX::StringView& value )
+      { setString( FIX::FIELD::CardIssNo, value ); }
+      void setPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::PaymentDate, value ); }
+      void setPaymentRemitterID( const FIX::StringView& value )
+      { setString( FIX::FIELD::PaymentRemitterID, value ); }
+    };
   };
 
 }
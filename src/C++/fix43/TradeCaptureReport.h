@@ -82,7 +82,16 @@ namespace FIX43
     NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+    { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
     FIELD_SET(*this, FIX::OrderQty);
     FIELD_SET(*this, FIX::CashOrderQty);
     FIELD_SET(*this, FIX::OrderPercent);
@@ -117,7 +126,18 @@ namespace FIX43
         FIELD_SET(*this, FIX::PartyIDSource);
         FIELD_SET(*this, FIX::PartyRole);
         FIELD_SET(*this, FIX::PartySubID);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::PartyID);
+          FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::PartyRole);
+          FIELD_VIEW(*m_pMap, FIX::PartySubID);
+        };
       };
+      FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+      { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
       FIELD_SET(*this, FIX::Account);
       FIELD_SET(*this, FIX::AccountType);
       FIELD_SET(*this, FIX::ProcessCode);
@@ -161,7 +181,15 @@ namespace FIX43
       public:
       NoClearingInstructions() : FIX::Group(576,577,FIX::message_order(577,0)) {}
         FIELD_SET(*this, FIX::ClearingInstruction);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::ClearingInstruction);
+        };
       };
+      FIX::GroupView<NoClearingInstructions::View> noClearingInstructions() const
+      { return FIX::GroupView<NoClearingInstructions::View>( *this, FIX::FIELD::NoClearingInstructions ); }
       FIELD_SET(*this, FIX::NoContAmts);
       class NoContAmts: public FIX::Group
       {
@@ -170,7 +198,17 @@ namespace FIX43
         FIELD_SET(*this, FIX::ContAmtType);
         FIELD_SET(*this, FIX::ContAmtValue);
         FIELD_SET(*this, FIX::ContAmtCurr);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::ContAmtType);
+          FIELD_VIEW(*m_pMap, FIX::ContAmtValue);
+          FIELD_VIEW(*m_pMap, FIX::ContAmtCurr);
+        };
       };
+      FIX::GroupView<NoContAmts::View> noContAmts() const
+      { return FIX::GroupView<NoContAmts::View>( *this, FIX::FIELD::NoContAmts ); }
       FIELD_SET(*this, FIX::NoMiscFees);
       class NoMiscFees: public FIX::Group
       {
@@ -179,7 +217,329 @@ namespace FIX43
         FIELD_SET(*this, FIX::MiscFeeAmt);
         FIELD_SET(*this, FIX::MiscFeeCurr);
         FIELD_SET(*this, FIX::MiscFeeType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::MiscFeeAmt);
+          FIELD_VIEW(*m_pMap, FIX::MiscFeeCurr);
+          FIELD_VIEW(*m_pMap, FIX::MiscFeeType);
+        };
       };
+      FIX::GroupView<NoMiscFees::View> noMiscFees() const
+      { return FIX::GroupView<NoMiscFees::View>( *this, FIX::FIELD::NoMiscFees ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Side);
+        FIELD_VIEW(*m_pMap, FIX::OrderID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryOrderID);
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::NoPartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::Account);
+        FIELD_VIEW(*m_pMap, FIX::AccountType);
+        FIELD_VIEW(*m_pMap, FIX::ProcessCode);
+        FIELD_VIEW(*m_pMap, FIX::OddLot);
+        FIELD_VIEW(*m_pMap, FIX::ClearingFeeIndicator);
+        FIELD_VIEW(*m_pMap, FIX::TradeInputSource);
+        FIELD_VIEW(*m_pMap, FIX::TradeInputDevice);
+        FIELD_VIEW(*m_pMap, FIX::Currency);
+        FIELD_VIEW(*m_pMap, FIX::ComplianceID);
+        FIELD_VIEW(*m_pMap, FIX::SolicitedFlag);
+        FIELD_VIEW(*m_pMap, FIX::OrderCapacity);
+        FIELD_VIEW(*m_pMap, FIX::OrderRestrictions);
+        FIELD_VIEW(*m_pMap, FIX::CustOrderCapacity);
+        FIELD_VIEW(*m_pMap, FIX::TransBkdTime);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+        FIELD_VIEW(*m_pMap, FIX::Commission);
+        FIELD_VIEW(*m_pMap, FIX::CommType);
+        FIELD_VIEW(*m_pMap, FIX::CommCurrency);
+        FIELD_VIEW(*m_pMap, FIX::FundRenewWaiv);
+        FIELD_VIEW(*m_pMap, FIX::GrossTradeAmt);
+        FIELD_VIEW(*m_pMap, FIX::NumDaysInterest);
+        FIELD_VIEW(*m_pMap, FIX::ExDate);
+        FIELD_VIEW(*m_pMap, FIX::AccruedInterestRate);
+        FIELD_VIEW(*m_pMap, FIX::AccruedInterestAmt);
+        FIELD_VIEW(*m_pMap, FIX::Concession);
+        FIELD_VIEW(*m_pMap, FIX::TotalTakedown);
+        FIELD_VIEW(*m_pMap, FIX::NetMoney);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrAmt);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrency);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrFxRate);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrFxRateCalc);
+        FIELD_VIEW(*m_pMap, FIX::PositionEffect);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+        FIELD_VIEW(*m_pMap, FIX::MultiLegReportingType);
+        FIELD_VIEW(*m_pMap, FIX::NoClearingInstructions);
+        FIELD_VIEW(*m_pMap, FIX::NoContAmts);
+        FIELD_VIEW(*m_pMap, FIX::NoMiscFees);
+        FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+        { return FIX::GroupView<NoPartyIDs::View>( *m_pMap, FIX::FIELD::NoPartyIDs ); }
+        FIX::GroupView<NoClearingInstructions::View> noClearingInstructions() const
+        { return FIX::GroupView<NoClearingInstructions::View>( *m_pMap, FIX::FIELD::NoClearingInstructions ); }
+        FIX::GroupView<NoContAmts::View> noContAmts() const
+        { return FIX::GroupView<NoContAmts::View>( *m_pMap, FIX::FIELD::NoContAmts ); }
+        FIX::GroupView<NoMiscFees::View> noMiscFees() const
+        { return FIX::GroupView<NoMiscFees::View>( *m_pMap, FIX::FIELD::NoMiscFees ); }
+      };
+    };
+    FIX::GroupView<NoSides::View> noSides() const
+    { return FIX::GroupView<NoSides::View>( *this, FIX::FIELD::NoSides ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView tradeReportID() const
+      { return getString( FIX::FIELD::TradeReportID ); }
+      int tradeReportTransType() const
+      { return getInt( FIX::FIELD::TradeReportTransType ); }
+      FIX::StringView tradeRequestID() const
+      { return getString( FIX::FIELD::TradeRequestID ); }
+      FIX::ExecType execType() const
+      { return FIX::ExecType( getChar( FIX::FIELD::ExecType ) ); }
+      FIX::StringView tradeReportRefID() const
+      { return getString( FIX::FIELD::TradeReportRefID ); }
+      FIX::StringView execID() const
+      { return getString( FIX::FIELD::ExecID ); }
+      FIX::StringView secondaryExecID() const
+      { return getString( FIX::FIELD::SecondaryExecID ); }
+      int execRestatementReason() const
+      { return getInt( FIX::FIELD::ExecRestatementReason ); }
+      bool previouslyReported() const
+      { return getBool( FIX::FIELD::PreviouslyReported ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView securityIDSource() const
+      { return getString( FIX::FIELD::SecurityIDSource ); }
+      int product() const
+      { return getInt( FIX::FIELD::Product ); }
+      FIX::StringView cFICode() const
+      { return getString( FIX::FIELD::CFICode ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDate() const
+      { return getString( FIX::FIELD::MaturityDate ); }
+      FIX::StringView couponPaymentDate() const
+      { return getString( FIX::FIELD::CouponPaymentDate ); }
+      FIX::StringView issueDate() const
+      { return getString( FIX::FIELD::IssueDate ); }
+      FIX::StringView repoCollateralSecurityType() const
+      { return getString( FIX::FIELD::RepoCollateralSecurityType ); }
+      int repurchaseTerm() const
+      { return getInt( FIX::FIELD::RepurchaseTerm ); }
+      FIX::Decimal repurchaseRate() const
+      { return getDecimal( FIX::FIELD::RepurchaseRate ); }
+      double factor() const
+      { return getDouble( FIX::FIELD::Factor ); }
+      FIX::StringView creditRating() const
+      { return getString( FIX::FIELD::CreditRating ); }
+      FIX::StringView instrRegistry() const
+      { return getString( FIX::FIELD::InstrRegistry ); }
+      FIX::StringView countryOfIssue() const
+      { return getString( FIX::FIELD::CountryOfIssue ); }
+      FIX::StringView stateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::StateOrProvinceOfIssue ); }
+      FIX::StringView localeOfIssue() const
+      { return getString( FIX::FIELD::LocaleOfIssue ); }
+      FIX::StringView redemptionDate() const
+      { return getString( FIX::FIELD::RedemptionDate ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      int noSecurityAltID() const
+      { return getInt( FIX::FIELD::NoSecurityAltID ); }
+      FIX::Decimal orderQty() const
+      { return getDecimal( FIX::FIELD::OrderQty ); }
+      FIX::Decimal cashOrderQty() const
+      { return getDecimal( FIX::FIELD::CashOrderQty ); }
+      FIX::Decimal orderPercent() const
+      { return getDecimal( FIX::FIELD::OrderPercent ); }
+      FIX::RoundingDirection roundingDirection() const
+      { return FIX::RoundingDirection( getChar( FIX::FIELD::RoundingDirection ) ); }
+      double roundingModulus() const
+      { return getDouble( FIX::FIELD::RoundingModulus ); }
+      FIX::Decimal lastQty() const
+      { return getDecimal( FIX::FIELD::LastQty ); }
+      FIX::Decimal lastPx() const
+      { return getDecimal( FIX::FIELD::LastPx ); }
+      FIX::Decimal lastSpotRate() const
+      { return getDecimal( FIX::FIELD::LastSpotRate ); }
+      double lastForwardPoints() const
+      { return getDouble( FIX::FIELD::LastForwardPoints ); }
+      FIX::StringView lastMkt() const
+      { return getString( FIX::FIELD::LastMkt ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      FIX::SettlmntTyp settlmntTyp() const
+      { return FIX::SettlmntTyp( getChar( FIX::FIELD::SettlmntTyp ) ); }
+      FIX::StringView futSettDate() const
+      { return getString( FIX::FIELD::FutSettDate ); }
+      FIX::MatchStatus matchStatus() const
+      { return FIX::MatchStatus( getChar( FIX::FIELD::MatchStatus ) ); }
+      FIX::StringView matchType() const
+      { return getString( FIX::FIELD::MatchType ); }
+      int noSides() const
+      { return getInt( FIX::FIELD::NoSides ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "AE" ) {}
+      void setTradeReportID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeReportID, value ); }
+      void setTradeReportTransType( int value )
+      { setInt( FIX::FIELD::TradeReportTransType, value ); }
+      void setTradeRequestID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeRequestID, value ); }
+      void setExecType( char value )
+      { setChar( FIX::FIELD::ExecType, value ); }
+      void setTradeReportRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeReportRefID, value ); }
+      void setExecID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExecID, value ); }
+      void setSecondaryExecID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecondaryExecID, value ); }
+      void setExecRestatementReason( int value )
+      { setInt( FIX::FIELD::ExecRestatementReason, value ); }
+      void setPreviouslyReported( bool value )
+      { setBool( FIX::FIELD::PreviouslyReported, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityIDSource, value ); }
+      void setProduct( int value )
+      { setInt( FIX::FIELD::Product, value ); }
+      void setCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::CFICode, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDate, value ); }
+      void setCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::CouponPaymentDate, value ); }
+      void setIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::IssueDate, value ); }
+      void setRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RepoCollateralSecurityType, value ); }
+      void setRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::RepurchaseTerm, value ); }
+      void setRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::RepurchaseRate, value ); }
+      void setFactor( double value )
+      { setDouble( FIX::FIELD::Factor, value ); }
+      void setCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::CreditRating, value ); }
+      void setInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::InstrRegistry, value ); }
+      void setCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::CountryOfIssue, value ); }
+      void setStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::StateOrProvinceOfIssue, value ); }
+      void setLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::LocaleOfIssue, value ); }
+      void setRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::RedemptionDate, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setNoSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoSecurityAltID, value ); }
+      void setOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderQty, value ); }
+      void setCashOrderQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CashOrderQty, value ); }
+      void setOrderPercent( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OrderPercent, value ); }
+      void setRoundingDirection( char value )
+      { setChar( FIX::FIELD::RoundingDirection, value ); }
+      void setRoundingModulus( double value )
+      { setDouble( FIX::FIELD::RoundingModulus, value ); }
+      void setLastQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastQty, value ); }
+      void setLastPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastPx, value ); }
+      void setLastSpotRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LastSpotRate, value ); }
+      void setLastForwardPoints( double value )
+      { setDouble( FIX::FIELD::LastForwardPoints, value ); }
+      void setLastMkt( const FIX::StringView& value )
+      { setString( FIX::FIELD::LastMkt, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setSettlmntTyp( char value )
+      { setChar( FIX::FIELD::SettlmntTyp, value ); }
+      void setFutSettDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::FutSettDate, value ); }
+      void setMatchStatus( char value )
+      { setChar( FIX::FIELD::MatchStatus, value ); }
+      void setMatchType( const FIX::StringView& value )
+      { setString( FIX::FIELD::MatchType, value ); }
+      void setNoSides( int value )
+      { setInt( FIX::FIELD::NoSides, value ); }
     };
   };
 
@@ -30,6 +30,44 @@ namespace FIX43
     FIELD_SET(*this, FIX::TradSesMethod);
     FIELD_SET(*this, FIX::TradSesMode);
     FIELD_SET(*this, FIX::SubscriptionRequestType);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView tradSesReqID() const
+      { return getString( FIX::FIELD::TradSesReqID ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::StringView tradingSessionSubID() const
+      { return getString( FIX::FIELD::TradingSessionSubID ); }
+      int tradSesMethod() const
+      { return getInt( FIX::FIELD::TradSesMethod ); }
+      int tradSesMode() const
+      { return getInt( FIX::FIELD::TradSesMode ); }
+      FIX::SubscriptionRequestType subscriptionRequestType() const
+      { return FIX::SubscriptionRequestType( getChar( FIX::FIELD::SubscriptionRequestType ) ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "g" ) {}
+      void setTradSesReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradSesReqID, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setTradingSessionSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionSubID, value ); }
+      void setTradSesMethod( int value )
+      { setInt( FIX::FIELD::TradSesMethod, value ); }
+      void setTradSesMode( int value )
+      { setInt( FIX::FIELD::TradSesMode, value ); }
+      void setSubscriptionRequestType( char value )
+      { setChar( FIX::FIELD::SubscriptionRequestType, value ); }
+    };
   };
 
 }
@@ -15,6 +15,20 @@ namespace FIX43
     XMLnonFIX(const XMLnonFIX& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("n"); }
 
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "n" ) {}
+    };
   };
 
 }
@@ -72,12 +72,52 @@ namespace FIX44
         NoNested2PartySubIDs() : FIX::Group(806,760,FIX::message_order(760,807,0)) {}
           FIELD_SET(*this, FIX::Nested2PartySubID);
           FIELD_SET(*this, FIX::Nested2PartySubIDType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::Nested2PartySubID);
+            FIELD_VIEW(*m_pMap, FIX::Nested2PartySubIDType);
+          };
+        };
+        FIX::GroupView<NoNested2PartySubIDs::View> noNested2PartySubIDs() const
+        { return FIX::GroupView<NoNested2PartySubIDs::View>( *this, FIX::FIELD::NoNested2PartySubIDs ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::Nested2PartyID);
+          FIELD_VIEW(*m_pMap, FIX::Nested2PartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::Nested2PartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NoNested2PartySubIDs);
+          FIX::GroupView<NoNested2PartySubIDs::View> noNested2PartySubIDs() const
+          { return FIX::GroupView<NoNested2PartySubIDs::View>( *m_pMap, FIX::FIELD::NoNested2PartySubIDs ); }
         };
       };
+      FIX::GroupView<NoNested2PartyIDs::View> noNested2PartyIDs() const
+      { return FIX::GroupView<NoNested2PartyIDs::View>( *this, FIX::FIELD::NoNested2PartyIDs ); }
       FIELD_SET(*this, FIX::OrderQty);
       FIELD_SET(*this, FIX::OrderAvgPx);
       FIELD_SET(*this, FIX::OrderBookingQty);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::OrderID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryOrderID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::ListID);
+        FIELD_VIEW(*m_pMap, FIX::NoNested2PartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::OrderQty);
+        FIELD_VIEW(*m_pMap, FIX::OrderAvgPx);
+        FIELD_VIEW(*m_pMap, FIX::OrderBookingQty);
+        FIX::GroupView<NoNested2PartyIDs::View> noNested2PartyIDs() const
+        { return FIX::GroupView<NoNested2PartyIDs::View>( *m_pMap, FIX::FIELD::NoNested2PartyIDs ); }
+      };
     };
+    FIX::GroupView<NoOrders::View> noOrders() const
+    { return FIX::GroupView<NoOrders::View>( *this, FIX::FIELD::NoOrders ); }
     FIELD_SET(*this, FIX::NoExecs);
     class NoExecs: public FIX::Group
     {
@@ -89,7 +129,20 @@ namespace FIX44
       FIELD_SET(*this, FIX::LastPx);
       FIELD_SET(*this, FIX::LastParPx);
       FIELD_SET(*this, FIX::LastCapacity);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::LastQty);
+        FIELD_VIEW(*m_pMap, FIX::ExecID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryExecID);
+        FIELD_VIEW(*m_pMap, FIX::LastPx);
+        FIELD_VIEW(*m_pMap, FIX::LastParPx);
+        FIELD_VIEW(*m_pMap, FIX::LastCapacity);
+      };
     };
+    FIX::GroupView<NoExecs::View> noExecs() const
+    { return FIX::GroupView<NoExecs::View>( *this, FIX::FIELD::NoExecs ); }
     FIELD_SET(*this, FIX::PreviouslyReported);
     FIELD_SET(*this, FIX::ReversalIndicator);
     FIELD_SET(*this, FIX::MatchType);
@@ -105,7 +158,16 @@ namespace FIX44
     NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+    { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
     FIELD_SET(*this, FIX::Product);
     FIELD_SET(*this, FIX::CFICode);
     FIELD_SET(*this, FIX::SecurityType);
@@ -150,7 +212,18 @@ namespace FIX44
       FIELD_SET(*this, FIX::EventDate);
       FIELD_SET(*this, FIX::EventPx);
       FIELD_SET(*this, FIX::EventText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::EventType);
+        FIELD_VIEW(*m_pMap, FIX::EventDate);
+        FIELD_VIEW(*m_pMap, FIX::EventPx);
+        FIELD_VIEW(*m_pMap, FIX::EventText);
+      };
     };
+    FIX::GroupView<NoEvents::View> noEvents() const
+    { return FIX::GroupView<NoEvents::View>( *this, FIX::FIELD::NoEvents ); }
     FIELD_SET(*this, FIX::DatedDate);
     FIELD_SET(*this, FIX::InterestAccrualDate);
     FIELD_SET(*this, FIX::DeliveryForm);
@@ -162,7 +235,16 @@ namespace FIX44
     NoInstrAttrib() : FIX::Group(870,871,FIX::message_order(871,872,0)) {}
       FIELD_SET(*this, FIX::InstrAttribType);
       FIELD_SET(*this, FIX::InstrAttribValue);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::InstrAttribType);
+        FIELD_VIEW(*m_pMap, FIX::InstrAttribValue);
+      };
     };
+    FIX::GroupView<NoInstrAttrib::View> noInstrAttrib() const
+    { return FIX::GroupView<NoInstrAttrib::View>( *this, FIX::FIELD::NoInstrAttrib ); }
     FIELD_SET(*this, FIX::AgreementDesc);
     FIELD_SET(*this, FIX::AgreementID);
     FIELD_SET(*this, FIX::AgreementDate);
@@ -188,7 +270,16 @@ namespace FIX44
       NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
         FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
         FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+      { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *this, FIX::FIELD::NoUnderlyingSecurityAltID ); }
       FIELD_SET(*this, FIX::UnderlyingProduct);
       FIELD_SET(*this, FIX::UnderlyingCFICode);
       FIELD_SET(*this, FIX::UnderlyingSecurityType);
@@ -237,8 +328,75 @@ namespace FIX44
       NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
         FIELD_SET(*this, FIX::UnderlyingStipType);
         FIELD_SET(*this, FIX::UnderlyingStipValue);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStipType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStipValue);
+        };
+      };
+      FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+      { return FIX::GroupView<NoUnderlyingStips::View>( *this, FIX::FIELD::NoUnderlyingStips ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbol);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::NoUnderlyingSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingProduct);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCFICode);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecuritySubType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingPutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingIssueDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingFactor);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCreditRating);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingLocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikeCurrency);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingOptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponRate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingIssuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuer);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCPProgram);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCPRegType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrency);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingQty);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingPx);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingDirtyPrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingEndPrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStartValue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrentValue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingEndValue);
+        FIELD_VIEW(*m_pMap, FIX::NoUnderlyingStips);
+        FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+        { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *m_pMap, FIX::FIELD::NoUnderlyingSecurityAltID ); }
+        FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+        { return FIX::GroupView<NoUnderlyingStips::View>( *m_pMap, FIX::FIELD::NoUnderlyingStips ); }
       };
     };
+    FIX::GroupView<NoUnderlyings::View> noUnderlyings() const
+    { return FIX::GroupView<NoUnderlyings::View>( *this, FIX::FIELD::NoUnderlyings ); }
     FIELD_SET(*this, FIX::NoLegs);
     class NoLegs: public FIX::Group
     {
@@ -255,7 +413,16 @@ namespace FIX44
       NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
         FIELD_SET(*this, FIX::LegSecurityAltID);
         FIELD_SET(*this, FIX::LegSecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+      { return FIX::GroupView<NoLegSecurityAltID::View>( *this, FIX::FIELD::NoLegSecurityAltID ); }
       FIELD_SET(*this, FIX::LegProduct);
       FIELD_SET(*this, FIX::LegCFICode);
       FIELD_SET(*this, FIX::LegSecurityType);
@@ -293,7 +460,58 @@ namespace FIX44
       FIELD_SET(*this, FIX::LegDatedDate);
       FIELD_SET(*this, FIX::LegContractSettlMonth);
       FIELD_SET(*this, FIX::LegInterestAccrualDate);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::LegSymbol);
+        FIELD_VIEW(*m_pMap, FIX::LegSymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::NoLegSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::LegProduct);
+        FIELD_VIEW(*m_pMap, FIX::LegCFICode);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::LegSecuritySubType);
+        FIELD_VIEW(*m_pMap, FIX::LegMaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::LegMaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::LegCouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::LegIssueDate);
+        FIELD_VIEW(*m_pMap, FIX::LegRepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::LegRepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::LegRepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::LegFactor);
+        FIELD_VIEW(*m_pMap, FIX::LegCreditRating);
+        FIELD_VIEW(*m_pMap, FIX::LegInstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::LegCountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegStateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegLocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegRedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::LegStrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::LegStrikeCurrency);
+        FIELD_VIEW(*m_pMap, FIX::LegOptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::LegContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::LegCouponRate);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::LegIssuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuer);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::LegRatioQty);
+        FIELD_VIEW(*m_pMap, FIX::LegSide);
+        FIELD_VIEW(*m_pMap, FIX::LegCurrency);
+        FIELD_VIEW(*m_pMap, FIX::LegPool);
+        FIELD_VIEW(*m_pMap, FIX::LegDatedDate);
+        FIELD_VIEW(*m_pMap, FIX::LegContractSettlMonth);
+        FIELD_VIEW(*m_pMap, FIX::LegInterestAccrualDate);
+        FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+        { return FIX::GroupView<NoLegSecurityAltID::View>( *m_pMap, FIX::FIELD::NoLegSecurityAltID ); }
+      };
     };
+    FIX::GroupView<NoLegs::View> noLegs() const
+    { return FIX::GroupView<NoLegs::View>( *this, FIX::FIELD::NoLegs ); }
     FIELD_SET(*this, FIX::Quantity);
     FIELD_SET(*this, FIX::QtyType);
     FIELD_SET(*this, FIX::LastMkt);
@@ -328,8 +546,30 @@ namespace FIX44
       NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::PartySubID);
+          FIELD_VIEW(*m_pMap, FIX::PartySubIDType);
+        };
+      };
+      FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+      { return FIX::GroupView<NoPartySubIDs::View>( *this, FIX::FIELD::NoPartySubIDs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PartyID);
+        FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PartyRole);
+        FIELD_VIEW(*m_pMap, FIX::NoPartySubIDs);
+        FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+        { return FIX::GroupView<NoPartySubIDs::View>( *m_pMap, FIX::FIELD::NoPartySubIDs ); }
       };
     };
+    FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+    { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
     FIELD_SET(*this, FIX::TradeDate);
     FIELD_SET(*this, FIX::TransactTime);
     FIELD_SET(*this, FIX::SettlType);
@@ -360,7 +600,16 @@ namespace FIX44
     NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
       FIELD_SET(*this, FIX::StipulationType);
       FIELD_SET(*this, FIX::StipulationValue);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::StipulationType);
+        FIELD_VIEW(*m_pMap, FIX::StipulationValue);
+      };
     };
+    FIX::GroupView<NoStipulations::View> noStipulations() const
+    { return FIX::GroupView<NoStipulations::View>( *this, FIX::FIELD::NoStipulations ); }
     FIELD_SET(*this, FIX::YieldType);
     FIELD_SET(*this, FIX::Yield);
     FIELD_SET(*this, FIX::YieldCalcDate);
@@ -396,8 +645,30 @@ namespace FIX44
         NoNestedPartySubIDs() : FIX::Group(804,545,FIX::message_order(545,805,0)) {}
           FIELD_SET(*this, FIX::NestedPartySubID);
           FIELD_SET(*this, FIX::NestedPartySubIDType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::NestedPartySubID);
+            FIELD_VIEW(*m_pMap, FIX::NestedPartySubIDType);
+          };
+        };
+        FIX::GroupView<NoNestedPartySubIDs::View> noNestedPartySubIDs() const
+        { return FIX::GroupView<NoNestedPartySubIDs::View>( *this, FIX::FIELD::NoNestedPartySubIDs ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyID);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NoNestedPartySubIDs);
+          FIX::GroupView<NoNestedPartySubIDs::View> noNestedPartySubIDs() const
+          { return FIX::GroupView<NoNestedPartySubIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartySubIDs ); }
         };
       };
+      FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+      { return FIX::GroupView<NoNestedPartyIDs::View>( *this, FIX::FIELD::NoNestedPartyIDs ); }
       FIELD_SET(*this, FIX::NotifyBrokerOfCredit);
       FIELD_SET(*this, FIX::AllocHandlInst);
       FIELD_SET(*this, FIX::AllocText);
@@ -426,14 +697,33 @@ namespace FIX44
         FIELD_SET(*this, FIX::MiscFeeCurr);
         FIELD_SET(*this, FIX::MiscFeeType);
         FIELD_SET(*this, FIX::MiscFeeBasis);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::MiscFeeAmt);
+          FIELD_VIEW(*m_pMap, FIX::MiscFeeCurr);
+          FIELD_VIEW(*m_pMap, FIX::MiscFeeType);
+          FIELD_VIEW(*m_pMap, FIX::MiscFeeBasis);
+        };
       };
+      FIX::GroupView<NoMiscFees::View> noMiscFees() const
+      { return FIX::GroupView<NoMiscFees::View>( *this, FIX::FIELD::NoMiscFees ); }
       FIELD_SET(*this, FIX::NoClearingInstructions);
       class NoClearingInstructions: public FIX::Group
       {
       public:
       NoClearingInstructions() : FIX::Group(576,577,FIX::message_order(577,0)) {}
         FIELD_SET(*this, FIX::ClearingInstruction);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::ClearingInstruction);
+        };
       };
+      FIX::GroupView<NoClearingInstructions::View> noClearingInstructions() const
+      { return FIX::GroupView<NoClearingInstructions::View>( *this, FIX::FIELD::NoClearingInstructions ); }
       FIELD_SET(*this, FIX::AllocSettlInstType);
       FIELD_SET(*this, FIX::SettlDeliveryType);
       FIELD_SET(*this, FIX::StandInstDbType);
@@ -461,10 +751,618 @@ namespace FIX44
           NoSettlPartySubIDs() : FIX::Group(801,785,FIX::message_order(785,786,0)) {}
             FIELD_SET(*this, FIX::SettlPartySubID);
             FIELD_SET(*this, FIX::SettlPartySubIDType);
+            class View : public FIX::GroupEntry
+            {
+            public:
+            View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+              FIELD_VIEW(*m_pMap, FIX::SettlPartySubID);
+              FIELD_VIEW(*m_pMap, FIX::SettlPartySubIDType);
+            };
+          };
+          FIX::GroupView<NoSettlPartySubIDs::View> noSettlPartySubIDs() const
+          { return FIX::GroupView<NoSettlPartySubIDs::View>( *this, FIX::FIELD::NoSettlPartySubIDs ); }
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::SettlPartyID);
+            FIELD_VIEW(*m_pMap, FIX::SettlPartyIDSource);
+            FIELD_VIEW(*m_pMap, FIX::SettlPartyRole);
+            FIELD_VIEW(*m_pMap, FIX::NoSettlPartySubIDs);
+            FIX::GroupView<NoSettlPartySubIDs::View> noSettlPartySubIDs() const
+            { return FIX::GroupView<NoSettlPartySubIDs::View>( *m_pMap, FIX::FIELD::NoSettlPartySubIDs ); }
           };
         };
+        FIX::GroupView<NoSettlPartyIDs::View> noSettlPartyIDs() const
+        { return FIX::GroupView<NoSettlPartyIDs::View>( *this, FIX::FIELD::NoSettlPartyIDs ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SettlInstSource);
+          FIELD_VIEW(*m_pMap, FIX::DlvyInstType);
+          FIELD_VIEW(*m_pMap, FIX::NoSettlPartyIDs);
+          FIX::GroupView<NoSettlPartyIDs::View> noSettlPartyIDs() const
+          { return FIX::GroupView<NoSettlPartyIDs::View>( *m_pMap, FIX::FIELD::NoSettlPartyIDs ); }
+        };
+      };
+      FIX::GroupView<NoDlvyInst::View> noDlvyInst() const
+      { return FIX::GroupView<NoDlvyInst::View>( *this, FIX::FIELD::NoDlvyInst ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::AllocAccount);
+        FIELD_VIEW(*m_pMap, FIX::AllocAcctIDSource);
+        FIELD_VIEW(*m_pMap, FIX::MatchStatus);
+        FIELD_VIEW(*m_pMap, FIX::AllocPrice);
+        FIELD_VIEW(*m_pMap, FIX::AllocQty);
+        FIELD_VIEW(*m_pMap, FIX::IndividualAllocID);
+        FIELD_VIEW(*m_pMap, FIX::ProcessCode);
+        FIELD_VIEW(*m_pMap, FIX::NoNestedPartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::NotifyBrokerOfCredit);
+        FIELD_VIEW(*m_pMap, FIX::AllocHandlInst);
+        FIELD_VIEW(*m_pMap, FIX::AllocText);
+        FIELD_VIEW(*m_pMap, FIX::EncodedAllocTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedAllocText);
+        FIELD_VIEW(*m_pMap, FIX::Commission);
+        FIELD_VIEW(*m_pMap, FIX::CommType);
+        FIELD_VIEW(*m_pMap, FIX::CommCurrency);
+        FIELD_VIEW(*m_pMap, FIX::FundRenewWaiv);
+        FIELD_VIEW(*m_pMap, FIX::AllocAvgPx);
+        FIELD_VIEW(*m_pMap, FIX::AllocNetMoney);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrAmt);
+        FIELD_VIEW(*m_pMap, FIX::AllocSettlCurrAmt);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrency);
+        FIELD_VIEW(*m_pMap, FIX::AllocSettlCurrency);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrFxRate);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrFxRateCalc);
+        FIELD_VIEW(*m_pMap, FIX::AllocAccruedInterestAmt);
+        FIELD_VIEW(*m_pMap, FIX::AllocInterestAtMaturity);
+        FIELD_VIEW(*m_pMap, FIX::NoMiscFees);
+        FIELD_VIEW(*m_pMap, FIX::NoClearingInstructions);
+        FIELD_VIEW(*m_pMap, FIX::AllocSettlInstType);
+        FIELD_VIEW(*m_pMap, FIX::SettlDeliveryType);
+        FIELD_VIEW(*m_pMap, FIX::StandInstDbType);
+        FIELD_VIEW(*m_pMap, FIX::StandInstDbName);
+        FIELD_VIEW(*m_pMap, FIX::StandInstDbID);
+        FIELD_VIEW(*m_pMap, FIX::NoDlvyInst);
+        FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+        { return FIX::GroupView<NoNestedPartyIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartyIDs ); }
+        FIX::GroupView<NoMiscFees::View> noMiscFees() const
+        { return FIX::GroupView<NoMiscFees::View>( *m_pMap, FIX::FIELD::NoMiscFees ); }
+        FIX::GroupView<NoClearingInstructions::View> noClearingInstructions() const
+        { return FIX::GroupView<NoClearingInstructions::View>( *m_pMap, FIX::FIELD::NoClearingInstructions ); }
+        FIX::GroupView<NoDlvyInst::View> noDlvyInst() const
+        { return FIX::GroupView<NoDlvyInst::View>( *m_pMap, FIX::FIELD::NoDlvyInst ); }
       };
     };
+    FIX::GroupView<NoAllocs::View> noAllocs() const
+    { return FIX::GroupView<NoAllocs::View>( *this, FIX::FIELD::NoAllocs ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView allocID() const
+      { return getString( FIX::FIELD::AllocID ); }
+      FIX::AllocTransType allocTransType() const
+      { return FIX::AllocTransType( getChar( FIX::FIELD::AllocTransType ) ); }
+      int allocType() const
+      { return getInt( FIX::FIELD::AllocType ); }
+      FIX::StringView secondaryAllocID() const
+      { return getString( FIX::FIELD::SecondaryAllocID ); }
+      FIX::StringView refAllocID() const
+      { return getString( FIX::FIELD::RefAllocID ); }
+      int allocCancReplaceReason() const
+      { return getInt( FIX::FIELD::AllocCancReplaceReason ); }
+      int allocIntermedReqType() const
+      { return getInt( FIX::FIELD::AllocIntermedReqType ); }
+      FIX::StringView allocLinkID() const
+      { return getString( FIX::FIELD::AllocLinkID ); }
+      int allocLinkType() const
+      { return getInt( FIX::FIELD::AllocLinkType ); }
+      FIX::StringView bookingRefID() const
+      { return getString( FIX::FIELD::BookingRefID ); }
+      int allocNoOrdersType() const
+      { return getInt( FIX::FIELD::AllocNoOrdersType ); }
+      int noOrders() const
+      { return getInt( FIX::FIELD::NoOrders ); }
+      int noExecs() const
+      { return getInt( FIX::FIELD::NoExecs ); }
+      bool previouslyReported() const
+      { return getBool( FIX::FIELD::PreviouslyReported ); }
+      bool reversalIndicator() const
+      { return getBool( FIX::FIELD::ReversalIndicator ); }
+      FIX::StringView matchType() const
+      { return getString( FIX::FIELD::MatchType ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView securityIDSource() const
+      { return getString( FIX::FIELD::SecurityIDSource ); }
+      int noSecurityAltID() const
+      { return getInt( FIX::FIELD::NoSecurityAltID ); }
+      int product() const
+      { return getInt( FIX::FIELD::Product ); }
+      FIX::StringView cFICode() const
+      { return getString( FIX::FIELD::CFICode ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView securitySubType() const
+      { return getString( FIX::FIELD::SecuritySubType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDate() const
+      { return getString( FIX::FIELD::MaturityDate ); }
+      int putOrCall() const
+      { return getInt( FIX::FIELD::PutOrCall ); }
+      FIX::StringView couponPaymentDate() const
+      { return getString( FIX::FIELD::CouponPaymentDate ); }
+      FIX::StringView issueDate() const
+      { return getString( FIX::FIELD::IssueDate ); }
+      FIX::StringView repoCollateralSecurityType() const
+      { return getString( FIX::FIELD::RepoCollateralSecurityType ); }
+      int repurchaseTerm() const
+      { return getInt( FIX::FIELD::RepurchaseTerm ); }
+      FIX::Decimal repurchaseRate() const
+      { return getDecimal( FIX::FIELD::RepurchaseRate ); }
+      double factor() const
+      { return getDouble( FIX::FIELD::Factor ); }
+      FIX::StringView creditRating() const
+      { return getString( FIX::FIELD::CreditRating ); }
+      FIX::StringView instrRegistry() const
+      { return getString( FIX::FIELD::InstrRegistry ); }
+      FIX::StringView countryOfIssue() const
+      { return getString( FIX::FIELD::CountryOfIssue ); }
+      FIX::StringView stateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::StateOrProvinceOfIssue ); }
+      FIX::StringView localeOfIssue() const
+      { return getString( FIX::FIELD::LocaleOfIssue ); }
+      FIX::StringView redemptionDate() const
+      { return getString( FIX::FIELD::RedemptionDate ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      FIX::StringView strikeCurrency() const
+      { return getString( FIX::FIELD::StrikeCurrency ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      FIX::StringView pool() const
+      { return getString( FIX::FIELD::Pool ); }
+      FIX::StringView contractSettlMonth() const
+      { return getString( FIX::FIELD::ContractSettlMonth ); }
+      int cPProgram() const
+      { return getInt( FIX::FIELD::CPProgram ); }
+      FIX::StringView cPRegType() const
+      { return getString( FIX::FIELD::CPRegType ); }
+      int noEvents() const
+      { return getInt( FIX::FIELD::NoEvents ); }
+      FIX::StringView datedDate() const
+      { return getString( FIX::FIELD::DatedDate ); }
+      FIX::StringView interestAccrualDate() const
+      { return getString( FIX::FIELD::InterestAccrualDate ); }
+      int deliveryForm() const
+      { return getInt( FIX::FIELD::DeliveryForm ); }
+      FIX::Decimal pctAtRisk() const
+      { return getDecimal( FIX::FIELD::PctAtRisk ); }
+      int noInstrAttrib() const
+      { return getInt( FIX::FIELD::NoInstrAttrib ); }
+      FIX::StringView agreementDesc() const
+      { return getString( FIX::FIELD::AgreementDesc ); }
+      FIX::StringView agreementID() const
+      { return getString( FIX::FIELD::AgreementID ); }
+      FIX::StringView agreementDate() const
+      { return getString( FIX::FIELD::AgreementDate ); }
+      FIX::StringView agreementCurrency() const
+      { return getString( FIX::FIELD::AgreementCurrency ); }
+      int terminationType() const
+      { return getInt( FIX::FIELD::TerminationType ); }
+      FIX::StringView startDate() const
+      { return getString( FIX::FIELD::StartDate ); }
+      FIX::StringView endDate() const
+      { return getString( FIX::FIELD::EndDate ); }
+      int deliveryType() const
+      { return getInt( FIX::FIELD::DeliveryType ); }
+      FIX::Decimal marginRatio() const
+      { return getDecimal( FIX::FIELD::MarginRatio ); }
+      int noUnderlyings() const
+      { return getInt( FIX::FIELD::NoUnderlyings ); }
+      int noLegs() const
+      { return getInt( FIX::FIELD::NoLegs ); }
+      FIX::Decimal quantity() const
+      { return getDecimal( FIX::FIELD::Quantity ); }
+      int qtyType() const
+      { return getInt( FIX::FIELD::QtyType ); }
+      FIX::StringView lastMkt() const
+      { return getString( FIX::FIELD::LastMkt ); }
+      FIX::StringView tradeOriginationDate() const
+      { return getString( FIX::FIELD::TradeOriginationDate ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::StringView tradingSessionSubID() const
+      { return getString( FIX::FIELD::TradingSessionSubID ); }
+      int priceType() const
+      { return getInt( FIX::FIELD::PriceType ); }
+      FIX::Decimal avgPx() const
+      { return getDecimal( FIX::FIELD::AvgPx ); }
+      FIX::Decimal avgParPx() const
+      { return getDecimal( FIX::FIELD::AvgParPx ); }
+      double spread() const
+      { return getDouble( FIX::FIELD::Spread ); }
+      FIX::StringView benchmarkCurveCurrency() const
+      { return getString( FIX::FIELD::BenchmarkCurveCurrency ); }
+      FIX::StringView benchmarkCurveName() const
+      { return getString( FIX::FIELD::BenchmarkCurveName ); }
+      FIX::StringView benchmarkCurvePoint() const
+      { return getString( FIX::FIELD::BenchmarkCurvePoint ); }
+      FIX::Decimal benchmarkPrice() const
+      { return getDecimal( FIX::FIELD::BenchmarkPrice ); }
+      int benchmarkPriceType() const
+      { return getInt( FIX::FIELD::BenchmarkPriceType ); }
+      FIX::StringView benchmarkSecurityID() const
+      { return getString( FIX::FIELD::BenchmarkSecurityID ); }
+      FIX::StringView benchmarkSecurityIDSource() const
+      { return getString( FIX::FIELD::BenchmarkSecurityIDSource ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      int avgPxPrecision() const
+      { return getInt( FIX::FIELD::AvgPxPrecision ); }
+      int noPartyIDs() const
+      { return getInt( FIX::FIELD::NoPartyIDs ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      FIX::StringView settlType() const
+      { return getString( FIX::FIELD::SettlType ); }
+      FIX::StringView settlDate() const
+      { return getString( FIX::FIELD::SettlDate ); }
+      int bookingType() const
+      { return getInt( FIX::FIELD::BookingType ); }
+      FIX::Decimal grossTradeAmt() const
+      { return getDecimal( FIX::FIELD::GrossTradeAmt ); }
+      FIX::Decimal concession() const
+      { return getDecimal( FIX::FIELD::Concession ); }
+      FIX::Decimal totalTakedown() const
+      { return getDecimal( FIX::FIELD::TotalTakedown ); }
+      FIX::Decimal netMoney() const
+      { return getDecimal( FIX::FIELD::NetMoney ); }
+      FIX::PositionEffect positionEffect() const
+      { return FIX::PositionEffect( getChar( FIX::FIELD::PositionEffect ) ); }
+      bool autoAcceptIndicator() const
+      { return getBool( FIX::FIELD::AutoAcceptIndicator ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      int numDaysInterest() const
+      { return getInt( FIX::FIELD::NumDaysInterest ); }
+      FIX::Decimal accruedInterestRate() const
+      { return getDecimal( FIX::FIELD::AccruedInterestRate ); }
+      FIX::Decimal accruedInterestAmt() const
+      { return getDecimal( FIX::FIELD::AccruedInterestAmt ); }
+      FIX::Decimal totalAccruedInterestAmt() const
+      { return getDecimal( FIX::FIELD::TotalAccruedInterestAmt ); }
+      FIX::Decimal interestAtMaturity() const
+      { return getDecimal( FIX::FIELD::InterestAtMaturity ); }
+      FIX::Decimal endAccruedInterestAmt() const
+      { return getDecimal( FIX::FIELD::EndAccruedInterestAmt ); }
+      FIX::Decimal startCash() const
+      { return getDecimal( FIX::FIELD::StartCash ); }
+      FIX::Decimal endCash() const
+      { return getDecimal( FIX::FIELD::EndCash ); }
+      bool legalConfirm() const
+      { return getBool( FIX::FIELD::LegalConfirm ); }
+      int noStipulations() const
+      { return getInt( FIX::FIELD::NoStipulations ); }
+      FIX::StringView yieldType() const
+      { return getString( FIX::FIELD::YieldType ); }
+      FIX::Decimal yield() const
+      { return getDecimal( FIX::FIELD::Yield ); }
+      FIX::StringView yieldCalcDate() const
+      { return getString( FIX::FIELD::YieldCalcDate ); }
+      FIX::StringView yieldRedemptionDate() const
+      { return getString( FIX::FIELD::YieldRedemptionDate ); }
+      FIX::Decimal yieldRedemptionPrice() const
+      { return getDecimal( FIX::FIELD::YieldRedemptionPrice ); }
+      int yieldRedemptionPriceType() const
+      { return getInt( FIX::FIELD::YieldRedemptionPriceType ); }
+      int totNoAllocs() const
+      { return getInt( FIX::FIELD::TotNoAllocs ); }
+      bool lastFragment() const
+      { return getBool( FIX::FIELD::LastFragment ); }
+      int noAllocs() const
+      { return getInt( FIX::FIELD::NoAllocs ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "J" ) {}
+      void setAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocID, value ); }
+      void setAllocTransType( char value )
+      { setChar( FIX::FIELD::AllocTransType, value ); }
+      void setAllocType( int value )
+      { setInt( FIX::FIELD::AllocType, value ); }
+      void setSecondaryAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecondaryAllocID, value ); }
+      void setRefAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RefAllocID, value ); }
+      void setAllocCancReplaceReason( int value )
+      { setInt( FIX::FIELD::AllocCancReplaceReason, value ); }
+      void setAllocIntermedReqType( int value )
+      { setInt( FIX::FIELD::AllocIntermedReqType, value ); }
+      void setAllocLinkID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocLinkID, value ); }
+      void setAllocLinkType( int value )
+      { setInt( FIX::FIELD::AllocLinkType, value ); }
+      void setBookingRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::BookingRefID, value ); }
+      void setAllocNoOrdersType( int value )
+      { setInt( FIX::FIELD::AllocNoOrdersType, value ); }
+      void setNoOrders( int value )
+      { setInt( FIX::FIELD::NoOrders, value ); }
+      void setNoExecs( int value )
+      { setInt( FIX::FIELD::NoExecs, value ); }
+      void setPreviouslyReported( bool value )
+      { setBool( FIX::FIELD::PreviouslyReported, value ); }
+      void setReversalIndicator( bool value )
+      { setBool( FIX::FIELD::ReversalIndicator, value ); }
+      void setMatchType( const FIX::StringView& value )
+      { setString( FIX::FIELD::MatchType, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityIDSource, value ); }
+      void setNoSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoSecurityAltID, value ); }
+      void setProduct( int value )
+      { setInt( FIX::FIELD::Product, value ); }
+      void setCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::CFICode, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setSecuritySubType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySubType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDate, value ); }
+      void setPutOrCall( int value )
+      { setInt( FIX::FIELD::PutOrCall, value ); }
+      void setCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::CouponPaymentDate, value ); }
+      void setIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::IssueDate, value ); }
+      void setRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RepoCollateralSecurityType, value ); }
+      void setRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::RepurchaseTerm, value ); }
+      void setRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::RepurchaseRate, value ); }
+      void setFactor( double value )
+      { setDouble( FIX::FIELD::Factor, value ); }
+      void setCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::CreditRating, value ); }
+      void setInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::InstrRegistry, value ); }
+      void setCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::CountryOfIssue, value ); }
+      void setStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::StateOrProvinceOfIssue, value ); }
+      void setLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::LocaleOfIssue, value ); }
+      void setRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::RedemptionDate, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setStrikeCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::StrikeCurrency, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setPool( const FIX::StringView& value )
+      { setString( FIX::FIELD::Pool, value ); }
+      void setContractSettlMonth( const FIX::StringView& value )
+      { setString( FIX::FIELD::ContractSettlMonth, value ); }
+      void setCPProgram( int value )
+      { setInt( FIX::FIELD::CPProgram, value ); }
+      void setCPRegType( const FIX::StringView& value )
+      { setString( FIX::FIELD::CPRegType, value ); }
+      void setNoEvents( int value )
+      { setInt( FIX::FIELD::NoEvents, value ); }
+      void setDatedDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::DatedDate, value ); }
+      void setInterestAccrualDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::InterestAccrualDate, value ); }
+      void setDeliveryForm( int value )
+      { setInt( FIX::FIELD::DeliveryForm, value ); }
+      void setPctAtRisk( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::PctAtRisk, value ); }
+      void setNoInstrAttrib( int value )
+      { setInt( FIX::FIELD::NoInstrAttrib, value ); }
+      void setAgreementDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::AgreementDesc, value ); }
+      void setAgreementID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AgreementID, value ); }
+      void setAgreementDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::AgreementDate, value ); }
+      void setAgreementCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::AgreementCurrency, value ); }
+      void setTerminationType( int value )
+      { setInt( FIX::FIELD::TerminationType, value ); }
+      void setStartDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::StartDate, value ); }
+      void setEndDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::EndDate, value ); }
+      void setDeliveryType( int value )
+      { setInt( FIX::FIELD::DeliveryType, value ); }
+      void setMarginRatio( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MarginRatio, value ); }
+      void setNoUnderlyings( int value )
+      { setInt( FIX::FIELD::NoUnderlyings, value ); }
+      void setNoLegs( int value )
+      { setInt( FIX::FIELD::NoLegs, value ); }
+      void setQuantity( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Quantity, value ); }
+      void setQtyType( int value )
+      { setInt( FIX::FIELD::QtyType, value ); }
+      void setLastMkt( const FIX::StringView& value )
+      { setString( FIX::FIELD::LastMkt, value ); }
+      void setTradeOriginationDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeOriginationDate, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setTradingSessionSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionSubID, value ); }
+      void setPriceType( int value )
+      { setInt( FIX::FIELD::PriceType, value ); }
+      void setAvgPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AvgPx, value ); }
+      void setAvgParPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AvgParPx, value ); }
+      void setSpread( double value )
+      { setDouble( FIX::FIELD::Spread, value ); }
+      void setBenchmarkCurveCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkCurveCurrency, value ); }
+      void setBenchmarkCurveName( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkCurveName, value ); }
+      void setBenchmarkCurvePoint( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkCurvePoint, value ); }
+      void setBenchmarkPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::BenchmarkPrice, value ); }
+      void setBenchmarkPriceType( int value )
+      { setInt( FIX::FIELD::BenchmarkPriceType, value ); }
+      void setBenchmarkSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkSecurityID, value ); }
+      void setBenchmarkSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkSecurityIDSource, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setAvgPxPrecision( int value )
+      { setInt( FIX::FIELD::AvgPxPrecision, value ); }
+      void setNoPartyIDs( int value )
+      { setInt( FIX::FIELD::NoPartyIDs, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setSettlType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlType, value ); }
+      void setSettlDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlDate, value ); }
+      void setBookingType( int value )
+      { setInt( FIX::FIELD::BookingType, value ); }
+      void setGrossTradeAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::GrossTradeAmt, value ); }
+      void setConcession( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Concession, value ); }
+      void setTotalTakedown( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::TotalTakedown, value ); }
+      void setNetMoney( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::NetMoney, value ); }
+      void setPositionEffect( char value )
+      { setChar( FIX::FIELD::PositionEffect, value ); }
+      void setAutoAcceptIndicator( bool value )
+      { setBool( FIX::FIELD::AutoAcceptIndicator, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setNumDaysInterest( int value )
+      { setInt( FIX::FIELD::NumDaysInterest, value ); }
+      void setAccruedInterestRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AccruedInterestRate, value ); }
+      void setAccruedInterestAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AccruedInterestAmt, value ); }
+      void setTotalAccruedInterestAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::TotalAccruedInterestAmt, value ); }
+      void setInterestAtMaturity( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::InterestAtMaturity, value ); }
+      void setEndAccruedInterestAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::EndAccruedInterestAmt, value ); }
+      void setStartCash( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StartCash, value ); }
+      void setEndCash( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::EndCash, value ); }
+      void setLegalConfirm( bool value )
+      { setBool( FIX::FIELD::LegalConfirm, value ); }
+      void setNoStipulations( int value )
+      { setInt( FIX::FIELD::NoStipulations, value ); }
+      void setYieldType( const FIX::StringView& value )
+      { setString( FIX::FIELD::YieldType, value ); }
+      void setYield( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Yield, value ); }
+      void setYieldCalcDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::YieldCalcDate, value ); }
+      void setYieldRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::YieldRedemptionDate, value ); }
+      void setYieldRedemptionPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::YieldRedemptionPrice, value ); }
+      void setYieldRedemptionPriceType( int value )
+      { setInt( FIX::FIELD::YieldRedemptionPriceType, value ); }
+      void setTotNoAllocs( int value )
+      { setInt( FIX::FIELD::TotNoAllocs, value ); }
+      void setLastFragment( bool value )
+      { setBool( FIX::FIELD::LastFragment, value ); }
+      void setNoAllocs( int value )
+      { setInt( FIX::FIELD::NoAllocs, value ); }
+    };
   };
 
 }
@@ -42,8 +42,30 @@ namespace FIX44
       NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::PartySubID);
+          FIELD_VIEW(*m_pMap, FIX::PartySubIDType);
+        };
+      };
+      FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+      { return FIX::GroupView<NoPartySubIDs::View>( *this, FIX::FIELD::NoPartySubIDs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PartyID);
+        FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PartyRole);
+        FIELD_VIEW(*m_pMap, FIX::NoPartySubIDs);
+        FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+        { return FIX::GroupView<NoPartySubIDs::View>( *m_pMap, FIX::FIELD::NoPartySubIDs ); }
       };
     };
+    FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+    { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
     FIELD_SET(*this, FIX::SecondaryAllocID);
     FIELD_SET(*this, FIX::TradeDate);
     FIELD_SET(*this, FIX::TransactTime);
@@ -70,6 +92,101 @@ namespace FIX44
       FIELD_SET(*this, FIX::AllocText);
       FIELD_SET(*this, FIX::EncodedAllocTextLen);
       FIELD_SET(*this, FIX::EncodedAllocText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::AllocAccount);
+        FIELD_VIEW(*m_pMap, FIX::AllocAcctIDSource);
+        FIELD_VIEW(*m_pMap, FIX::AllocPrice);
+        FIELD_VIEW(*m_pMap, FIX::IndividualAllocID);
+        FIELD_VIEW(*m_pMap, FIX::IndividualAllocRejCode);
+        FIELD_VIEW(*m_pMap, FIX::AllocText);
+        FIELD_VIEW(*m_pMap, FIX::EncodedAllocTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedAllocText);
+      };
+    };
+    FIX::GroupView<NoAllocs::View> noAllocs() const
+    { return FIX::GroupView<NoAllocs::View>( *this, FIX::FIELD::NoAllocs ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView allocID() const
+      { return getString( FIX::FIELD::AllocID ); }
+      int noPartyIDs() const
+      { return getInt( FIX::FIELD::NoPartyIDs ); }
+      FIX::StringView secondaryAllocID() const
+      { return getString( FIX::FIELD::SecondaryAllocID ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      int allocStatus() const
+      { return getInt( FIX::FIELD::AllocStatus ); }
+      int allocRejCode() const
+      { return getInt( FIX::FIELD::AllocRejCode ); }
+      int allocType() const
+      { return getInt( FIX::FIELD::AllocType ); }
+      int allocIntermedReqType() const
+      { return getInt( FIX::FIELD::AllocIntermedReqType ); }
+      FIX::MatchStatus matchStatus() const
+      { return FIX::MatchStatus( getChar( FIX::FIELD::MatchStatus ) ); }
+      int product() const
+      { return getInt( FIX::FIELD::Product ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      int noAllocs() const
+      { return getInt( FIX::FIELD::NoAllocs ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "P" ) {}
+      void setAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocID, value ); }
+      void setNoPartyIDs( int value )
+      { setInt( FIX::FIELD::NoPartyIDs, value ); }
+      void setSecondaryAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecondaryAllocID, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setAllocStatus( int value )
+      { setInt( FIX::FIELD::AllocStatus, value ); }
+      void setAllocRejCode( int value )
+      { setInt( FIX::FIELD::AllocRejCode, value ); }
+      void setAllocType( int value )
+      { setInt( FIX::FIELD::AllocType, value ); }
+      void setAllocIntermedReqType( int value )
+      { setInt( FIX::FIELD::AllocIntermedReqType, value ); }
+      void setMatchStatus( char value )
+      { setChar( FIX::FIELD::MatchStatus, value ); }
+      void setProduct( int value )
+      { setInt( FIX::FIELD::Product, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setNoAllocs( int value )
+      { setInt( FIX::FIELD::NoAllocs, value ); }
     };
   };
 
@@ -60,8 +60,30 @@ namespace FIX44
       NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::PartySubID);
+          FIELD_VIEW(*m_pMap, FIX::PartySubIDType);
+        };
+      };
+      FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+      { return FIX::GroupView<NoPartySubIDs::View>( *this, FIX::FIELD::NoPartySubIDs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PartyID);
+        FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PartyRole);
+        FIELD_VIEW(*m_pMap, FIX::NoPartySubIDs);
+        FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+        { return FIX::GroupView<NoPartySubIDs::View>( *m_pMap, FIX::FIELD::NoPartySubIDs ); }
       };
     };
+    FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+    { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
     FIELD_SET(*this, FIX::Account);
     FIELD_SET(*this, FIX::AccountType);
     FIELD_SET(*this, FIX::Symbol);
@@ -75,7 +97,16 @@ namespace FIX44
     NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+    { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
     FIELD_SET(*this, FIX::Product);
     FIELD_SET(*this, FIX::CFICode);
     FIELD_SET(*this, FIX::SecurityType);
@@ -120,7 +151,18 @@ namespace FIX44
       FIELD_SET(*this, FIX::EventDate);
       FIELD_SET(*this, FIX::EventPx);
       FIELD_SET(*this, FIX::EventText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::EventType);
+        FIELD_VIEW(*m_pMap, FIX::EventDate);
+        FIELD_VIEW(*m_pMap, FIX::EventPx);
+        FIELD_VIEW(*m_pMap, FIX::EventText);
+      };
     };
+    FIX::GroupView<NoEvents::View> noEvents() const
+    { return FIX::GroupView<NoEvents::View>( *this, FIX::FIELD::NoEvents ); }
     FIELD_SET(*this, FIX::DatedDate);
     FIELD_SET(*this, FIX::InterestAccrualDate);
     FIELD_SET(*this, FIX::Currency);
@@ -140,7 +182,16 @@ namespace FIX44
       NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
         FIELD_SET(*this, FIX::LegSecurityAltID);
         FIELD_SET(*this, FIX::LegSecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+      { return FIX::GroupView<NoLegSecurityAltID::View>( *this, FIX::FIELD::NoLegSecurityAltID ); }
       FIELD_SET(*this, FIX::LegProduct);
       FIELD_SET(*this, FIX::LegCFICode);
       FIELD_SET(*this, FIX::LegSecurityType);
@@ -178,7 +229,58 @@ namespace FIX44
       FIELD_SET(*this, FIX::LegDatedDate);
       FIELD_SET(*this, FIX::LegContractSettlMonth);
       FIELD_SET(*this, FIX::LegInterestAccrualDate);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::LegSymbol);
+        FIELD_VIEW(*m_pMap, FIX::LegSymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::NoLegSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::LegProduct);
+        FIELD_VIEW(*m_pMap, FIX::LegCFICode);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::LegSecuritySubType);
+        FIELD_VIEW(*m_pMap, FIX::LegMaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::LegMaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::LegCouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::LegIssueDate);
+        FIELD_VIEW(*m_pMap, FIX::LegRepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::LegRepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::LegRepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::LegFactor);
+        FIELD_VIEW(*m_pMap, FIX::LegCreditRating);
+        FIELD_VIEW(*m_pMap, FIX::LegInstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::LegCountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegStateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegLocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegRedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::LegStrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::LegStrikeCurrency);
+        FIELD_VIEW(*m_pMap, FIX::LegOptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::LegContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::LegCouponRate);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::LegIssuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuer);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::LegRatioQty);
+        FIELD_VIEW(*m_pMap, FIX::LegSide);
+        FIELD_VIEW(*m_pMap, FIX::LegCurrency);
+        FIELD_VIEW(*m_pMap, FIX::LegPool);
+        FIELD_VIEW(*m_pMap, FIX::LegDatedDate);
+        FIELD_VIEW(*m_pMap, FIX::LegContractSettlMonth);
+        FIELD_VIEW(*m_pMap, FIX::LegInterestAccrualDate);
+        FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+        { return FIX::GroupView<NoLegSecurityAltID::View>( *m_pMap, FIX::FIELD::NoLegSecurityAltID ); }
+      };
     };
+    FIX::GroupView<NoLegs::View> noLegs() const
+    { return FIX::GroupView<NoLegs::View>( *this, FIX::FIELD::NoLegs ); }
     FIELD_SET(*this, FIX::NoUnderlyings);
     class NoUnderlyings: public FIX::Group
     {
@@ -195,7 +297,16 @@ namespace FIX44
       NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
         FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
         FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+      { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *this, FIX::FIELD::NoUnderlyingSecurityAltID ); }
       FIELD_SET(*this, FIX::UnderlyingProduct);
       FIELD_SET(*this, FIX::UnderlyingCFICode);
       FIELD_SET(*this, FIX::UnderlyingSecurityType);
@@ -244,8 +355,75 @@ namespace FIX44
       NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
         FIELD_SET(*this, FIX::UnderlyingStipType);
         FIELD_SET(*this, FIX::UnderlyingStipValue);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStipType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStipValue);
+        };
+      };
+      FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+      { return FIX::GroupView<NoUnderlyingStips::View>( *this, FIX::FIELD::NoUnderlyingStips ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbol);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::NoUnderlyingSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingProduct);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCFICode);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecuritySubType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingPutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingIssueDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingFactor);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCreditRating);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingLocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikeCurrency);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingOptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponRate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingIssuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuer);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCPProgram);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCPRegType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrency);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingQty);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingPx);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingDirtyPrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingEndPrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStartValue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrentValue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingEndValue);
+        FIELD_VIEW(*m_pMap, FIX::NoUnderlyingStips);
+        FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+        { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *m_pMap, FIX::FIELD::NoUnderlyingSecurityAltID ); }
+        FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+        { return FIX::GroupView<NoUnderlyingStips::View>( *m_pMap, FIX::FIELD::NoUnderlyingStips ); }
       };
     };
+    FIX::GroupView<NoUnderlyings::View> noUnderlyings() const
+    { return FIX::GroupView<NoUnderlyings::View>( *this, FIX::FIELD::NoUnderlyings ); }
     FIELD_SET(*this, FIX::NoPositions);
     class NoPositions: public FIX::Group
     {
@@ -270,9 +448,45 @@ namespace FIX44
         NoNestedPartySubIDs() : FIX::Group(804,545,FIX::message_order(545,805,0)) {}
           FIELD_SET(*this, FIX::NestedPartySubID);
           FIELD_SET(*this, FIX::NestedPartySubIDType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::NestedPartySubID);
+            FIELD_VIEW(*m_pMap, FIX::NestedPartySubIDType);
+          };
         };
+        FIX::GroupView<NoNestedPartySubIDs::View> noNestedPartySubIDs() const
+        { return FIX::GroupView<NoNestedPartySubIDs::View>( *this, FIX::FIELD::NoNestedPartySubIDs ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyID);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NoNestedPartySubIDs);
+          FIX::GroupView<NoNestedPartySubIDs::View> noNestedPartySubIDs() const
+          { return FIX::GroupView<NoNestedPartySubIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartySubIDs ); }
+        };
+      };
+      FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+      { return FIX::GroupView<NoNestedPartyIDs::View>( *this, FIX::FIELD::NoNestedPartyIDs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PosType);
+        FIELD_VIEW(*m_pMap, FIX::LongQty);
+        FIELD_VIEW(*m_pMap, FIX::ShortQty);
+        FIELD_VIEW(*m_pMap, FIX::PosQtyStatus);
+        FIELD_VIEW(*m_pMap, FIX::NoNestedPartyIDs);
+        FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+        { return FIX::GroupView<NoNestedPartyIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartyIDs ); }
       };
     };
+    FIX::GroupView<NoPositions::View> noPositions() const
+    { return FIX::GroupView<NoPositions::View>( *this, FIX::FIELD::NoPositions ); }
     FIELD_SET(*this, FIX::NoPosAmt);
     class NoPosAmt: public FIX::Group
     {
@@ -280,7 +494,16 @@ namespace FIX44
     NoPosAmt() : FIX::Group(753,707,FIX::message_order(707,708,0)) {}
       FIELD_SET(*this, FIX::PosAmtType);
       FIELD_SET(*this, FIX::PosAmt);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PosAmtType);
+        FIELD_VIEW(*m_pMap, FIX::PosAmt);
+      };
     };
+    FIX::GroupView<NoPosAmt::View> noPosAmt() const
+    { return FIX::GroupView<NoPosAmt::View>( *this, FIX::FIELD::NoPosAmt ); }
     FIELD_SET(*this, FIX::ThresholdAmount);
     FIELD_SET(*this, FIX::SettlPrice);
     FIELD_SET(*this, FIX::SettlPriceType);
@@ -296,6 +519,296 @@ namespace FIX44
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView asgnRptID() const
+      { return getString( FIX::FIELD::AsgnRptID ); }
+      int totNumAssignmentReports() const
+      { return getInt( FIX::FIELD::TotNumAssignmentReports ); }
+      bool lastRptRequested() const
+      { return getBool( FIX::FIELD::LastRptRequested ); }
+      int noPartyIDs() const
+      { return getInt( FIX::FIELD::NoPartyIDs ); }
+      FIX::StringView account() const
+      { return getString( FIX::FIELD::Account ); }
+      int accountType() const
+      { return getInt( FIX::FIELD::AccountType ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView securityIDSource() const
+      { return getString( FIX::FIELD::SecurityIDSource ); }
+      int noSecurityAltID() const
+      { return getInt( FIX::FIELD::NoSecurityAltID ); }
+      int product() const
+      { return getInt( FIX::FIELD::Product ); }
+      FIX::StringView cFICode() const
+      { return getString( FIX::FIELD::CFICode ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView securitySubType() const
+      { return getString( FIX::FIELD::SecuritySubType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDate() const
+      { return getString( FIX::FIELD::MaturityDate ); }
+      int putOrCall() const
+      { return getInt( FIX::FIELD::PutOrCall ); }
+      FIX::StringView couponPaymentDate() const
+      { return getString( FIX::FIELD::CouponPaymentDate ); }
+      FIX::StringView issueDate() const
+      { return getString( FIX::FIELD::IssueDate ); }
+      FIX::StringView repoCollateralSecurityType() const
+      { return getString( FIX::FIELD::RepoCollateralSecurityType ); }
+      int repurchaseTerm() const
+      { return getInt( FIX::FIELD::RepurchaseTerm ); }
+      FIX::Decimal repurchaseRate() const
+      { return getDecimal( FIX::FIELD::RepurchaseRate ); }
+      double factor() const
+      { return getDouble( FIX::FIELD::Factor ); }
+      FIX::StringView creditRating() const
+      { return getString( FIX::FIELD::CreditRating ); }
+      FIX::StringView instrRegistry() const
+      { return getString( FIX::FIELD::InstrRegistry ); }
+      FIX::StringView countryOfIssue() const
+      { return getString( FIX::FIELD::CountryOfIssue ); }
+      FIX::StringView stateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::StateOrProvinceOfIssue ); }
+      FIX::StringView localeOfIssue() const
+      { return getString( FIX::FIELD::LocaleOfIssue ); }
+      FIX::StringView redemptionDate() const
+      { return getString( FIX::FIELD::RedemptionDate ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      FIX::StringView strikeCurrency() const
+      { return getString( FIX::FIELD::StrikeCurrency ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      FIX::StringView pool() const
+      { return getString( FIX::FIELD::Pool ); }
+      FIX::StringView contractSettlMonth() const
+      { return getString( FIX::FIELD::ContractSettlMonth ); }
+      int cPProgram() const
+      { return getInt( FIX::FIELD::CPProgram ); }
+      FIX::StringView cPRegType() const
+      { return getString( FIX::FIELD::CPRegType ); }
+      int noEvents() const
+      { return getInt( FIX::FIELD::NoEvents ); }
+      FIX::StringView datedDate() const
+      { return getString( FIX::FIELD::DatedDate ); }
+      FIX::StringView interestAccrualDate() const
+      { return getString( FIX::FIELD::InterestAccrualDate ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      int noLegs() const
+      { return getInt( FIX::FIELD::NoLegs ); }
+      int noUnderlyings() const
+      { return getInt( FIX::FIELD::NoUnderlyings ); }
+      int noPositions() const
+      { return getInt( FIX::FIELD::NoPositions ); }
+      int noPosAmt() const
+      { return getInt( FIX::FIELD::NoPosAmt ); }
+      double thresholdAmount() const
+      { return getDouble( FIX::FIELD::ThresholdAmount ); }
+      FIX::Decimal settlPrice() const
+      { return getDecimal( FIX::FIELD::SettlPrice ); }
+      int settlPriceType() const
+      { return getInt( FIX::FIELD::SettlPriceType ); }
+      FIX::Decimal underlyingSettlPrice() const
+      { return getDecimal( FIX::FIELD::UnderlyingSettlPrice ); }
+      FIX::StringView expireDate() const
+      { return getString( FIX::FIELD::ExpireDate ); }
+      FIX::AssignmentMethod assignmentMethod() const
+      { return FIX::AssignmentMethod( getChar( FIX::FIELD::AssignmentMethod ) ); }
+      FIX::Decimal assignmentUnit() const
+      { return getDecimal( FIX::FIELD::AssignmentUnit ); }
+      FIX::Decimal openInterest() const
+      { return getDecimal( FIX::FIELD::OpenInterest ); }
+      FIX::ExerciseMethod exerciseMethod() const
+      { return FIX::ExerciseMethod( getChar( FIX::FIELD::ExerciseMethod ) ); }
+      FIX::StringView settlSessID() const
+      { return getString( FIX::FIELD::SettlSessID ); }
+      FIX::StringView settlSessSubID() const
+      { return getString( FIX::FIELD::SettlSessSubID ); }
+      FIX::StringView clearingBusinessDate() const
+      { return getString( FIX::FIELD::ClearingBusinessDate ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "AW" ) {}
+      void setAsgnRptID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AsgnRptID, value ); }
+      void setTotNumAssignmentReports( int value )
+      { setInt( FIX::FIELD::TotNumAssignmentReports, value ); }
+      void setLastRptRequested( bool value )
+      { setBool( FIX::FIELD::LastRptRequested, value ); }
+      void setNoPartyIDs( int value )
+      { setInt( FIX::FIELD::NoPartyIDs, value ); }
+      void setAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::Account, value ); }
+      void setAccountType( int value )
+      { setInt( FIX::FIELD::AccountType, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityIDSource, value ); }
+      void setNoSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoSecurityAltID, value ); }
+      void setProduct( int value )
+      { setInt( FIX::FIELD::Product, value ); }
+      void setCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::CFICode, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setSecuritySubType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySubType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDate, value ); }
+      void setPutOrCall( int value )
+      { setInt( FIX::FIELD::PutOrCall, value ); }
+      void setCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::CouponPaymentDate, value ); }
+      void setIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::IssueDate, value ); }
+      void setRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RepoCollateralSecurityType, value ); }
+      void setRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::RepurchaseTerm, value ); }
+      void setRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::RepurchaseRate, value ); }
+      void setFactor( double value )
+      { setDouble( FIX::FIELD::Factor, value ); }
+      void setCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::CreditRating, value ); }
+      void setInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::InstrRegistry, value ); }
+      void setCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::CountryOfIssue, value ); }
+      void setStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::StateOrProvinceOfIssue, value ); }
+      void setLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::LocaleOfIssue, value ); }
+      void setRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::RedemptionDate, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setStrikeCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::StrikeCurrency, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setPool( const FIX::StringView& value )
+      { setString( FIX::FIELD::Pool, value ); }
+      void setContractSettlMonth( const FIX::StringView& value )
+      { setString( FIX::FIELD::ContractSettlMonth, value ); }
+      void setCPProgram( int value )
+      { setInt( FIX::FIELD::CPProgram, value ); }
+      void setCPRegType( const FIX::StringView& value )
+      { setString( FIX::FIELD::CPRegType, value ); }
+      void setNoEvents( int value )
+      { setInt( FIX::FIELD::NoEvents, value ); }
+      void setDatedDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::DatedDate, value ); }
+      void setInterestAccrualDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::InterestAccrualDate, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setNoLegs( int value )
+      { setInt( FIX::FIELD::NoLegs, value ); }
+      void setNoUnderlyings( int value )
+      { setInt( FIX::FIELD::NoUnderlyings, value ); }
+      void setNoPositions( int value )
+      { setInt( FIX::FIELD::NoPositions, value ); }
+      void setNoPosAmt( int value )
+      { setInt( FIX::FIELD::NoPosAmt, value ); }
+      void setThresholdAmount( double value )
+      { setDouble( FIX::FIELD::ThresholdAmount, value ); }
+      void setSettlPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::SettlPrice, value ); }
+      void setSettlPriceType( int value )
+      { setInt( FIX::FIELD::SettlPriceType, value ); }
+      void setUnderlyingSettlPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingSettlPrice, value ); }
+      void setExpireDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExpireDate, value ); }
+      void setAssignmentMethod( char value )
+      { setChar( FIX::FIELD::AssignmentMethod, value ); }
+      void setAssignmentUnit( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AssignmentUnit, value ); }
+      void setOpenInterest( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OpenInterest, value ); }
+      void setExerciseMethod( char value )
+      { setChar( FIX::FIELD::ExerciseMethod, value ); }
+      void setSettlSessID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlSessID, value ); }
+      void setSettlSessSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlSessSubID, value ); }
+      void setClearingBusinessDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClearingBusinessDate, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+    };
   };
 
 }
@@ -58,7 +58,25 @@ namespace FIX44
       FIELD_SET(*this, FIX::FairValue);
       FIELD_SET(*this, FIX::OutsideIndexPct);
       FIELD_SET(*this, FIX::ValueOfFutures);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::BidDescriptorType);
+        FIELD_VIEW(*m_pMap, FIX::BidDescriptor);
+        FIELD_VIEW(*m_pMap, FIX::SideValueInd);
+        FIELD_VIEW(*m_pMap, FIX::LiquidityValue);
+        FIELD_VIEW(*m_pMap, FIX::LiquidityNumSecurities);
+        FIELD_VIEW(*m_pMap, FIX::LiquidityPctLow);
+        FIELD_VIEW(*m_pMap, FIX::LiquidityPctHigh);
+        FIELD_VIEW(*m_pMap, FIX::EFPTrackingError);
+        FIELD_VIEW(*m_pMap, FIX::FairValue);
+        FIELD_VIEW(*m_pMap, FIX::OutsideIndexPct);
+        FIELD_VIEW(*m_pMap, FIX::ValueOfFutures);
+      };
     };
+    FIX::GroupView<NoBidDescriptors::View> noBidDescriptors() const
+    { return FIX::GroupView<NoBidDescriptors::View>( *this, FIX::FIELD::NoBidDescriptors ); }
     FIELD_SET(*this, FIX::NoBidComponents);
     class NoBidComponents: public FIX::Group
     {
@@ -73,7 +91,23 @@ namespace FIX44
       FIELD_SET(*this, FIX::SettlDate);
       FIELD_SET(*this, FIX::Account);
       FIELD_SET(*this, FIX::AcctIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ListID);
+        FIELD_VIEW(*m_pMap, FIX::Side);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+        FIELD_VIEW(*m_pMap, FIX::NetGrossInd);
+        FIELD_VIEW(*m_pMap, FIX::SettlType);
+        FIELD_VIEW(*m_pMap, FIX::SettlDate);
+        FIELD_VIEW(*m_pMap, FIX::Account);
+        FIELD_VIEW(*m_pMap, FIX::AcctIDSource);
+      };
     };
+    FIX::GroupView<NoBidComponents::View> noBidComponents() const
+    { return FIX::GroupView<NoBidComponents::View>( *this, FIX::FIELD::NoBidComponents ); }
     FIELD_SET(*this, FIX::LiquidityIndType);
     FIELD_SET(*this, FIX::WtAverageLiquidity);
     FIELD_SET(*this, FIX::ExchangeForPhysical);
@@ -91,6 +125,138 @@ namespace FIX44
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView bidID() const
+      { return getString( FIX::FIELD::BidID ); }
+      FIX::StringView clientBidID() const
+      { return getString( FIX::FIELD::ClientBidID ); }
+      FIX::BidRequestTransType bidRequestTransType() const
+      { return FIX::BidRequestTransType( getChar( FIX::FIELD::BidRequestTransType ) ); }
+      FIX::StringView listName() const
+      { return getString( FIX::FIELD::ListName ); }
+      int totNoRelatedSym() const
+      { return getInt( FIX::FIELD::TotNoRelatedSym ); }
+      int bidType() const
+      { return getInt( FIX::FIELD::BidType ); }
+      int numTickets() const
+      { return getInt( FIX::FIELD::NumTickets ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::Decimal sideValue1() const
+      { return getDecimal( FIX::FIELD::SideValue1 ); }
+      FIX::Decimal sideValue2() const
+      { return getDecimal( FIX::FIELD::SideValue2 ); }
+      int noBidDescriptors() const
+      { return getInt( FIX::FIELD::NoBidDescriptors ); }
+      int noBidComponents() const
+      { return getInt( FIX::FIELD::NoBidComponents ); }
+      int liquidityIndType() const
+      { return getInt( FIX::FIELD::LiquidityIndType ); }
+      FIX::Decimal wtAverageLiquidity() const
+      { return getDecimal( FIX::FIELD::WtAverageLiquidity ); }
+      bool exchangeForPhysical() const
+      { return getBool( FIX::FIELD::ExchangeForPhysical ); }
+      FIX::Decimal outMainCntryUIndex() const
+      { return getDecimal( FIX::FIELD::OutMainCntryUIndex ); }
+      FIX::Decimal crossPercent() const
+      { return getDecimal( FIX::FIELD::CrossPercent ); }
+      int progRptReqs() const
+      { return getInt( FIX::FIELD::ProgRptReqs ); }
+      int progPeriodInterval() const
+      { return getInt( FIX::FIELD::ProgPeriodInterval ); }
+      int incTaxInd() const
+      { return getInt( FIX::FIELD::IncTaxInd ); }
+      bool forexReq() const
+      { return getBool( FIX::FIELD::ForexReq ); }
+      int numBidders() const
+      { return getInt( FIX::FIELD::NumBidders ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::BidTradeType bidTradeType() const
+      { return FIX::BidTradeType( getChar( FIX::FIELD::BidTradeType ) ); }
+      FIX::BasisPxType basisPxType() const
+      { return FIX::BasisPxType( getChar( FIX::FIELD::BasisPxType ) ); }
+      FIX::StringView strikeTime() const
+      { return getString( FIX::FIELD::StrikeTime ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "k" ) {}
+      void setBidID( const FIX::StringView& value )
+      { setString( FIX::FIELD::BidID, value ); }
+      void setClientBidID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClientBidID, value ); }
+      void setBidRequestTransType( char value )
+      { setChar( FIX::FIELD::BidRequestTransType, value ); }
+      void setListName( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListName, value ); }
+      void setTotNoRelatedSym( int value )
+      { setInt( FIX::FIELD::TotNoRelatedSym, value ); }
+      void setBidType( int value )
+      { setInt( FIX::FIELD::BidType, value ); }
+      void setNumTickets( int value )
+      { setInt( FIX::FIELD::NumTickets, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setSideValue1( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::SideValue1, value ); }
+      void setSideValue2( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::SideValue2, value ); }
+      void setNoBidDescriptors( int value )
+      { setInt( FIX::FIELD::NoBidDescriptors, value ); }
+      void setNoBidComponents( int value )
+      { setInt( FIX::FIELD::NoBidComponents, value ); }
+      void setLiquidityIndType( int value )
+      { setInt( FIX::FIELD::LiquidityIndType, value ); }
+      void setWtAverageLiquidity( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::WtAverageLiquidity, value ); }
+      void setExchangeForPhysical( bool value )
+      { setBool( FIX::FIELD::ExchangeForPhysical, value ); }
+      void setOutMainCntryUIndex( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::OutMainCntryUIndex, value ); }
+      void setCrossPercent( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CrossPercent, value ); }
+      void setProgRptReqs( int value )
+      { setInt( FIX::FIELD::ProgRptReqs, value ); }
+      void setProgPeriodInterval( int value )
+      { setInt( FIX::FIELD::ProgPeriodInterval, value ); }
+      void setIncTaxInd( int value )
+      { setInt( FIX::FIELD::IncTaxInd, value ); }
+      void setForexReq( bool value )
+      { setBool( FIX::FIELD::ForexReq, value ); }
+      void setNumBidders( int value )
+      { setInt( FIX::FIELD::NumBidders, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setBidTradeType( char value )
+      { setChar( FIX::FIELD::BidTradeType, value ); }
+      void setBasisPxType( char value )
+      { setChar( FIX::FIELD::BasisPxType, value ); }
+      void setStrikeTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::StrikeTime, value ); }
+      void setStrikeTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::StrikeTime, value, precision ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+    };
   };
 
 }
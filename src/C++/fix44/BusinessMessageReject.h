@@ -31,6 +31,48 @@ namespace FIX44
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      int refSeqNum() const
+      { return getInt( FIX::FIELD::RefSeqNum ); }
+      FIX::StringView refMsgType() const
+      { return getString( FIX::FIELD::RefMsgType ); }
+      FIX::StringView businessRejectRefID() const
+      { return getString( FIX::FIELD::BusinessRejectRefID ); }
+      int businessRejectReason() const
+      { return getInt( FIX::FIELD::BusinessRejectReason ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "j" ) {}
+      void setRefSeqNum( int value )
+      { setInt( FIX::FIELD::RefSeqNum, value ); }
+      void setRefMsgType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RefMsgType, value ); }
+      void setBusinessRejectRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::BusinessRejectRefID, value ); }
+      void setBusinessRejectReason( int value )
+      { setInt( FIX::FIELD::BusinessRejectReason, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+    };
   };
 
 }
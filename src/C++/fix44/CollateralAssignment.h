@@ -50,8 +50,30 @@ namespace FIX44
       NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::PartySubID);
+          FIELD_VIEW(*m_pMap, FIX::PartySubIDType);
+        };
+      };
+      FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+      { return FIX::GroupView<NoPartySubIDs::View>( *this, FIX::FIELD::NoPartySubIDs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PartyID);
+        FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PartyRole);
+        FIELD_VIEW(*m_pMap, FIX::NoPartySubIDs);
+        FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+        { return FIX::GroupView<NoPartySubIDs::View>( *m_pMap, FIX::FIELD::NoPartySubIDs ); }
       };
     };
+    FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+    { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
     FIELD_SET(*this, FIX::Account);
     FIELD_SET(*this, FIX::AccountType);
     FIELD_SET(*this, FIX::ClOrdID);
@@ -64,7 +86,15 @@ namespace FIX44
     public:
     NoExecs() : FIX::Group(124,17,FIX::message_order(17,0)) {}
       FIELD_SET(*this, FIX::ExecID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ExecID);
+      };
     };
+    FIX::GroupView<NoExecs::View> noExecs() const
+    { return FIX::GroupView<NoExecs::View>( *this, FIX::FIELD::NoExecs ); }
     FIELD_SET(*this, FIX::NoTrades);
     class NoTrades: public FIX::Group
     {
@@ -72,7 +102,16 @@ namespace FIX44
     NoTrades() : FIX::Group(897,571,FIX::message_order(571,818,0)) {}
       FIELD_SET(*this, FIX::TradeReportID);
       FIELD_SET(*this, FIX::SecondaryTradeReportID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::TradeReportID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryTradeReportID);
+      };
     };
+    FIX::GroupView<NoTrades::View> noTrades() const
+    { return FIX::GroupView<NoTrades::View>( *this, FIX::FIELD::NoTrades ); }
     FIELD_SET(*this, FIX::Symbol);
     FIELD_SET(*this, FIX::SymbolSfx);
     FIELD_SET(*this, FIX::SecurityID);
@@ -84,7 +123,16 @@ namespace FIX44
     NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+    { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
     FIELD_SET(*this, FIX::Product);
     FIELD_SET(*this, FIX::CFICode);
     FIELD_SET(*this, FIX::SecurityType);
@@ -129,7 +177,18 @@ namespace FIX44
       FIELD_SET(*this, FIX::EventDate);
       FIELD_SET(*this, FIX::EventPx);
       FIELD_SET(*this, FIX::EventText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::EventType);
+        FIELD_VIEW(*m_pMap, FIX::EventDate);
+        FIELD_VIEW(*m_pMap, FIX::EventPx);
+        FIELD_VIEW(*m_pMap, FIX::EventText);
+      };
     };
+    FIX::GroupView<NoEvents::View> noEvents() const
+    { return FIX::GroupView<NoEvents::View>( *this, FIX::FIELD::NoEvents ); }
     FIELD_SET(*this, FIX::DatedDate);
     FIELD_SET(*this, FIX::InterestAccrualDate);
     FIELD_SET(*this, FIX::AgreementDesc);
@@ -161,7 +220,16 @@ namespace FIX44
       NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
         FIELD_SET(*this, FIX::LegSecurityAltID);
         FIELD_SET(*this, FIX::LegSecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+      { return FIX::GroupView<NoLegSecurityAltID::View>( *this, FIX::FIELD::NoLegSecurityAltID ); }
       FIELD_SET(*this, FIX::LegProduct);
       FIELD_SET(*this, FIX::LegCFICode);
       FIELD_SET(*this, FIX::LegSecurityType);
@@ -199,7 +267,58 @@ namespace FIX44
       FIELD_SET(*this, FIX::LegDatedDate);
       FIELD_SET(*this, FIX::LegContractSettlMonth);
       FIELD_SET(*this, FIX::LegInterestAccrualDate);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::LegSymbol);
+        FIELD_VIEW(*m_pMap, FIX::LegSymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::NoLegSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::LegProduct);
+        FIELD_VIEW(*m_pMap, FIX::LegCFICode);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::LegSecuritySubType);
+        FIELD_VIEW(*m_pMap, FIX::LegMaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::LegMaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::LegCouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::LegIssueDate);
+        FIELD_VIEW(*m_pMap, FIX::LegRepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::LegRepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::LegRepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::LegFactor);
+        FIELD_VIEW(*m_pMap, FIX::LegCreditRating);
+        FIELD_VIEW(*m_pMap, FIX::LegInstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::LegCountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegStateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegLocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LegRedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::LegStrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::LegStrikeCurrency);
+        FIELD_VIEW(*m_pMap, FIX::LegOptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::LegContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::LegCouponRate);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::LegIssuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuer);
+        FIELD_VIEW(*m_pMap, FIX::LegSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::LegRatioQty);
+        FIELD_VIEW(*m_pMap, FIX::LegSide);
+        FIELD_VIEW(*m_pMap, FIX::LegCurrency);
+        FIELD_VIEW(*m_pMap, FIX::LegPool);
+        FIELD_VIEW(*m_pMap, FIX::LegDatedDate);
+        FIELD_VIEW(*m_pMap, FIX::LegContractSettlMonth);
+        FIELD_VIEW(*m_pMap, FIX::LegInterestAccrualDate);
+        FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+        { return FIX::GroupView<NoLegSecurityAltID::View>( *m_pMap, FIX::FIELD::NoLegSecurityAltID ); }
+      };
     };
+    FIX::GroupView<NoLegs::View> noLegs() const
+    { return FIX::GroupView<NoLegs::View>( *this, FIX::FIELD::NoLegs ); }
     FIELD_SET(*this, FIX::NoUnderlyings);
     class NoUnderlyings: public FIX::Group
     {
@@ -216,7 +335,16 @@ namespace FIX44
       NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
         FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
         FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+      { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *this, FIX::FIELD::NoUnderlyingSecurityAltID ); }
       FIELD_SET(*this, FIX::UnderlyingProduct);
       FIELD_SET(*this, FIX::UnderlyingCFICode);
       FIELD_SET(*this, FIX::UnderlyingSecurityType);
@@ -265,9 +393,77 @@ namespace FIX44
       NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
         FIELD_SET(*this, FIX::UnderlyingStipType);
         FIELD_SET(*this, FIX::UnderlyingStipValue);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStipType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStipValue);
+        };
       };
+      FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+      { return FIX::GroupView<NoUnderlyingStips::View>( *this, FIX::FIELD::NoUnderlyingStips ); }
       FIELD_SET(*this, FIX::CollAction);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbol);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::NoUnderlyingSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingProduct);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCFICode);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecuritySubType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingPutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingIssueDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingFactor);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCreditRating);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingLocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikeCurrency);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingOptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponRate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingIssuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuer);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCPProgram);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCPRegType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrency);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingQty);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingPx);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingDirtyPrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingEndPrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStartValue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrentValue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingEndValue);
+        FIELD_VIEW(*m_pMap, FIX::NoUnderlyingStips);
+        FIELD_VIEW(*m_pMap, FIX::CollAction);
+        FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+        { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *m_pMap, FIX::FIELD::NoUnderlyingSecurityAltID ); }
+        FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+        { return FIX::GroupView<NoUnderlyingStips::View>( *m_pMap, FIX::FIELD::NoUnderlyingStips ); }
+      };
     };
+    FIX::GroupView<NoUnderlyings::View> noUnderlyings() const
+    { return FIX::GroupView<NoUnderlyings::View>( *this, FIX::FIELD::NoUnderlyings ); }
     FIELD_SET(*this, FIX::MarginExcess);
     FIELD_SET(*this, FIX::TotalNetValue);
     FIELD_SET(*this, FIX::CashOutstanding);
@@ -279,7 +475,17 @@ namespace FIX44
       FIELD_SET(*this, FIX::TrdRegTimestamp);
       FIELD_SET(*this, FIX::TrdRegTimestampType);
       FIELD_SET(*this, FIX::TrdRegTimestampOrigin);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::TrdRegTimestamp);
+        FIELD_VIEW(*m_pMap, FIX::TrdRegTimestampType);
+        FIELD_VIEW(*m_pMap, FIX::TrdRegTimestampOrigin);
+      };
     };
+    FIX::GroupView<NoTrdRegTimestamps::View> noTrdRegTimestamps() const
+    { return FIX::GroupView<NoTrdRegTimestamps::View>( *this, FIX::FIELD::NoTrdRegTimestamps ); }
     FIELD_SET(*this, FIX::Side);
     FIELD_SET(*this, FIX::NoMiscFees);
     class NoMiscFees: public FIX::Group
@@ -290,7 +496,18 @@ namespace FIX44
       FIELD_SET(*this, FIX::MiscFeeCurr);
       FIELD_SET(*this, FIX::MiscFeeType);
       FIELD_SET(*this, FIX::MiscFeeBasis);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::MiscFeeAmt);
+        FIELD_VIEW(*m_pMap, FIX::MiscFeeCurr);
+        FIELD_VIEW(*m_pMap, FIX::MiscFeeType);
+        FIELD_VIEW(*m_pMap, FIX::MiscFeeBasis);
+      };
     };
+    FIX::GroupView<NoMiscFees::View> noMiscFees() const
+    { return FIX::GroupView<NoMiscFees::View>( *this, FIX::FIELD::NoMiscFees ); }
     FIELD_SET(*this, FIX::Price);
     FIELD_SET(*this, FIX::PriceType);
     FIELD_SET(*this, FIX::AccruedInterestAmt);
@@ -312,7 +529,16 @@ namespace FIX44
     NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
       FIELD_SET(*this, FIX::StipulationType);
       FIELD_SET(*this, FIX::StipulationValue);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::StipulationType);
+        FIELD_VIEW(*m_pMap, FIX::StipulationValue);
+      };
     };
+    FIX::GroupView<NoStipulations::View> noStipulations() const
+    { return FIX::GroupView<NoStipulations::View>( *this, FIX::FIELD::NoStipulations ); }
     FIELD_SET(*this, FIX::SettlDeliveryType);
     FIELD_SET(*this, FIX::StandInstDbType);
     FIELD_SET(*this, FIX::StandInstDbName);
@@ -339,9 +565,43 @@ namespace FIX44
         NoSettlPartySubIDs() : FIX::Group(801,785,FIX::message_order(785,786,0)) {}
           FIELD_SET(*this, FIX::SettlPartySubID);
           FIELD_SET(*this, FIX::SettlPartySubIDType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::SettlPartySubID);
+            FIELD_VIEW(*m_pMap, FIX::SettlPartySubIDType);
+          };
+        };
+        FIX::GroupView<NoSettlPartySubIDs::View> noSettlPartySubIDs() const
+        { return FIX::GroupView<NoSettlPartySubIDs::View>( *this, FIX::FIELD::NoSettlPartySubIDs ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SettlPartyID);
+          FIELD_VIEW(*m_pMap, FIX::SettlPartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::SettlPartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NoSettlPartySubIDs);
+          FIX::GroupView<NoSettlPartySubIDs::View> noSettlPartySubIDs() const
+          { return FIX::GroupView<NoSettlPartySubIDs::View>( *m_pMap, FIX::FIELD::NoSettlPartySubIDs ); }
         };
       };
+      FIX::GroupView<NoSettlPartyIDs::View> noSettlPartyIDs() const
+      { return FIX::GroupView<NoSettlPartyIDs::View>( *this, FIX::FIELD::NoSettlPartyIDs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SettlInstSource);
+        FIELD_VIEW(*m_pMap, FIX::DlvyInstType);
+        FIELD_VIEW(*m_pMap, FIX::NoSettlPartyIDs);
+        FIX::GroupView<NoSettlPartyIDs::View> noSettlPartyIDs() const
+        { return FIX::GroupView<NoSettlPartyIDs::View>( *m_pMap, FIX::FIELD::NoSettlPartyIDs ); }
+      };
     };
+    FIX::GroupView<NoDlvyInst::View> noDlvyInst() const
+    { return FIX::GroupView<NoDlvyInst::View>( *this, FIX::FIELD::NoDlvyInst ); }
     FIELD_SET(*this, FIX::TradingSessionID);
     FIELD_SET(*this, FIX::TradingSessionSubID);
     FIELD_SET(*this, FIX::SettlSessID);
@@ -350,6 +610,456 @@ namespace FIX44
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView collAsgnID() const
+      { return getString( FIX::FIELD::CollAsgnID ); }
+      FIX::StringView collReqID() const
+      { return getString( FIX::FIELD::CollReqID ); }
+      int collAsgnReason() const
+      { return getInt( FIX::FIELD::CollAsgnReason ); }
+      int collAsgnTransType() const
+      { return getInt( FIX::FIELD::CollAsgnTransType ); }
+      FIX::StringView collAsgnRefID() const
+      { return getString( FIX::FIELD::CollAsgnRefID ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      FIX::StringView expireTime() const
+      { return getString( FIX::FIELD::ExpireTime ); }
+      int noPartyIDs() const
+      { return getInt( FIX::FIELD::NoPartyIDs ); }
+      FIX::StringView account() const
+      { return getString( FIX::FIELD::Account ); }
+      int accountType() const
+      { return getInt( FIX::FIELD::AccountType ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      FIX::StringView orderID() const
+      { return getString( FIX::FIELD::OrderID ); }
+      FIX::StringView secondaryOrderID() const
+      { return getString( FIX::FIELD::SecondaryOrderID ); }
+      FIX::StringView secondaryClOrdID() const
+      { return getString( FIX::FIELD::SecondaryClOrdID ); }
+      int noExecs() const
+      { return getInt( FIX::FIELD::NoExecs ); }
+      int noTrades() const
+      { return getInt( FIX::FIELD::NoTrades ); }
+      FIX::StringView symbol() const
+      { return getString( FIX::FIELD::Symbol ); }
+      FIX::StringView symbolSfx() const
+      { return getString( FIX::FIELD::SymbolSfx ); }
+      FIX::StringView securityID() const
+      { return getString( FIX::FIELD::SecurityID ); }
+      FIX::StringView securityIDSource() const
+      { return getString( FIX::FIELD::SecurityIDSource ); }
+      int noSecurityAltID() const
+      { return getInt( FIX::FIELD::NoSecurityAltID ); }
+      int product() const
+      { return getInt( FIX::FIELD::Product ); }
+      FIX::StringView cFICode() const
+      { return getString( FIX::FIELD::CFICode ); }
+      FIX::StringView securityType() const
+      { return getString( FIX::FIELD::SecurityType ); }
+      FIX::StringView securitySubType() const
+      { return getString( FIX::FIELD::SecuritySubType ); }
+      FIX::StringView maturityMonthYear() const
+      { return getString( FIX::FIELD::MaturityMonthYear ); }
+      FIX::StringView maturityDate() const
+      { return getString( FIX::FIELD::MaturityDate ); }
+      int putOrCall() const
+      { return getInt( FIX::FIELD::PutOrCall ); }
+      FIX::StringView couponPaymentDate() const
+      { return getString( FIX::FIELD::CouponPaymentDate ); }
+      FIX::StringView issueDate() const
+      { return getString( FIX::FIELD::IssueDate ); }
+      FIX::StringView repoCollateralSecurityType() const
+      { return getString( FIX::FIELD::RepoCollateralSecurityType ); }
+      int repurchaseTerm() const
+      { return getInt( FIX::FIELD::RepurchaseTerm ); }
+      FIX::Decimal repurchaseRate() const
+      { return getDecimal( FIX::FIELD::RepurchaseRate ); }
+      double factor() const
+      { return getDouble( FIX::FIELD::Factor ); }
+      FIX::StringView creditRating() const
+      { return getString( FIX::FIELD::CreditRating ); }
+      FIX::StringView instrRegistry() const
+      { return getString( FIX::FIELD::InstrRegistry ); }
+      FIX::StringView countryOfIssue() const
+      { return getString( FIX::FIELD::CountryOfIssue ); }
+      FIX::StringView stateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::StateOrProvinceOfIssue ); }
+      FIX::StringView localeOfIssue() const
+      { return getString( FIX::FIELD::LocaleOfIssue ); }
+      FIX::StringView redemptionDate() const
+      { return getString( FIX::FIELD::RedemptionDate ); }
+      FIX::Decimal strikePrice() const
+      { return getDecimal( FIX::FIELD::StrikePrice ); }
+      FIX::StringView strikeCurrency() const
+      { return getString( FIX::FIELD::StrikeCurrency ); }
+      char optAttribute() const
+      { return getChar( FIX::FIELD::OptAttribute ); }
+      double contractMultiplier() const
+      { return getDouble( FIX::FIELD::ContractMultiplier ); }
+      FIX::Decimal couponRate() const
+      { return getDecimal( FIX::FIELD::CouponRate ); }
+      FIX::StringView securityExchange() const
+      { return getString( FIX::FIELD::SecurityExchange ); }
+      FIX::StringView issuer() const
+      { return getString( FIX::FIELD::Issuer ); }
+      int encodedIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedIssuerLen ); }
+      FIX::StringView encodedIssuer() const
+      { return getString( FIX::FIELD::EncodedIssuer ); }
+      FIX::StringView securityDesc() const
+      { return getString( FIX::FIELD::SecurityDesc ); }
+      int encodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedSecurityDescLen ); }
+      FIX::StringView encodedSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedSecurityDesc ); }
+      FIX::StringView pool() const
+      { return getString( FIX::FIELD::Pool ); }
+      FIX::StringView contractSettlMonth() const
+      { return getString( FIX::FIELD::ContractSettlMonth ); }
+      int cPProgram() const
+      { return getInt( FIX::FIELD::CPProgram ); }
+      FIX::StringView cPRegType() const
+      { return getString( FIX::FIELD::CPRegType ); }
+      int noEvents() const
+      { return getInt( FIX::FIELD::NoEvents ); }
+      FIX::StringView datedDate() const
+      { return getString( FIX::FIELD::DatedDate ); }
+      FIX::StringView interestAccrualDate() const
+      { return getString( FIX::FIELD::InterestAccrualDate ); }
+      FIX::StringView agreementDesc() const
+      { return getString( FIX::FIELD::AgreementDesc ); }
+      FIX::StringView agreementID() const
+      { return getString( FIX::FIELD::AgreementID ); }
+      FIX::StringView agreementDate() const
+      { return getString( FIX::FIELD::AgreementDate ); }
+      FIX::StringView agreementCurrency() const
+      { return getString( FIX::FIELD::AgreementCurrency ); }
+      int terminationType() const
+      { return getInt( FIX::FIELD::TerminationType ); }
+      FIX::StringView startDate() const
+      { return getString( FIX::FIELD::StartDate ); }
+      FIX::StringView endDate() const
+      { return getString( FIX::FIELD::EndDate ); }
+      int deliveryType() const
+      { return getInt( FIX::FIELD::DeliveryType ); }
+      FIX::Decimal marginRatio() const
+      { return getDecimal( FIX::FIELD::MarginRatio ); }
+      FIX::StringView settlDate() const
+      { return getString( FIX::FIELD::SettlDate ); }
+      FIX::Decimal quantity() const
+      { return getDecimal( FIX::FIELD::Quantity ); }
+      int qtyType() const
+      { return getInt( FIX::FIELD::QtyType ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      int noLegs() const
+      { return getInt( FIX::FIELD::NoLegs ); }
+      int noUnderlyings() const
+      { return getInt( FIX::FIELD::NoUnderlyings ); }
+      FIX::Decimal marginExcess() const
+      { return getDecimal( FIX::FIELD::MarginExcess ); }
+      FIX::Decimal totalNetValue() const
+      { return getDecimal( FIX::FIELD::TotalNetValue ); }
+      FIX::Decimal cashOutstanding() const
+      { return getDecimal( FIX::FIELD::CashOutstanding ); }
+      int noTrdRegTimestamps() const
+      { return getInt( FIX::FIELD::NoTrdRegTimestamps ); }
+      FIX::Side side() const
+      { return FIX::Side( getChar( FIX::FIELD::Side ) ); }
+      int noMiscFees() const
+      { return getInt( FIX::FIELD::NoMiscFees ); }
+      FIX::Decimal price() const
+      { return getDecimal( FIX::FIELD::Price ); }
+      int priceType() const
+      { return getInt( FIX::FIELD::PriceType ); }
+      FIX::Decimal accruedInterestAmt() const
+      { return getDecimal( FIX::FIELD::AccruedInterestAmt ); }
+      FIX::Decimal endAccruedInterestAmt() const
+      { return getDecimal( FIX::FIELD::EndAccruedInterestAmt ); }
+      FIX::Decimal startCash() const
+      { return getDecimal( FIX::FIELD::StartCash ); }
+      FIX::Decimal endCash() const
+      { return getDecimal( FIX::FIELD::EndCash ); }
+      double spread() const
+      { return getDouble( FIX::FIELD::Spread ); }
+      FIX::StringView benchmarkCurveCurrency() const
+      { return getString( FIX::FIELD::BenchmarkCurveCurrency ); }
+      FIX::StringView benchmarkCurveName() const
+      { return getString( FIX::FIELD::BenchmarkCurveName ); }
+      FIX::StringView benchmarkCurvePoint() const
+      { return getString( FIX::FIELD::BenchmarkCurvePoint ); }
+      FIX::Decimal benchmarkPrice() const
+      { return getDecimal( FIX::FIELD::BenchmarkPrice ); }
+      int benchmarkPriceType() const
+      { return getInt( FIX::FIELD::BenchmarkPriceType ); }
+      FIX::StringView benchmarkSecurityID() const
+      { return getString( FIX::FIELD::BenchmarkSecurityID ); }
+      FIX::StringView benchmarkSecurityIDSource() const
+      { return getString( FIX::FIELD::BenchmarkSecurityIDSource ); }
+      int noStipulations() const
+      { return getInt( FIX::FIELD::NoStipulations ); }
+      int settlDeliveryType() const
+      { return getInt( FIX::FIELD::SettlDeliveryType ); }
+      int standInstDbType() const
+      { return getInt( FIX::FIELD::StandInstDbType ); }
+      FIX::StringView standInstDbName() const
+      { return getString( FIX::FIELD::StandInstDbName ); }
+      FIX::StringView standInstDbID() const
+      { return getString( FIX::FIELD::StandInstDbID ); }
+      int noDlvyInst() const
+      { return getInt( FIX::FIELD::NoDlvyInst ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::StringView tradingSessionSubID() const
+      { return getString( FIX::FIELD::TradingSessionSubID ); }
+      FIX::StringView settlSessID() const
+      { return getString( FIX::FIELD::SettlSessID ); }
+      FIX::StringView settlSessSubID() const
+      { return getString( FIX::FIELD::SettlSessSubID ); }
+      FIX::StringView clearingBusinessDate() const
+      { return getString( FIX::FIELD::ClearingBusinessDate ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "AY" ) {}
+      void setCollAsgnID( const FIX::StringView& value )
+      { setString( FIX::FIELD::CollAsgnID, value ); }
+      void setCollReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::CollReqID, value ); }
+      void setCollAsgnReason( int value )
+      { setInt( FIX::FIELD::CollAsgnReason, value ); }
+      void setCollAsgnTransType( int value )
+      { setInt( FIX::FIELD::CollAsgnTransType, value ); }
+      void setCollAsgnRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::CollAsgnRefID, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setExpireTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::ExpireTime, value ); }
+      void setExpireTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::ExpireTime, value, precision ); }
+      void setNoPartyIDs( int value )
+      { setInt( FIX::FIELD::NoPartyIDs, value ); }
+      void setAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::Account, value ); }
+      void setAccountType( int value )
+      { setInt( FIX::FIELD::AccountType, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::OrderID, value ); }
+      void setSecondaryOrderID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecondaryOrderID, value ); }
+      void setSecondaryClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecondaryClOrdID, value ); }
+      void setNoExecs( int value )
+      { setInt( FIX::FIELD::NoExecs, value ); }
+      void setNoTrades( int value )
+      { setInt( FIX::FIELD::NoTrades, value ); }
+      void setSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::Symbol, value ); }
+      void setSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::SymbolSfx, value ); }
+      void setSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityID, value ); }
+      void setSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityIDSource, value ); }
+      void setNoSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoSecurityAltID, value ); }
+      void setProduct( int value )
+      { setInt( FIX::FIELD::Product, value ); }
+      void setCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::CFICode, value ); }
+      void setSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityType, value ); }
+      void setSecuritySubType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySubType, value ); }
+      void setMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityMonthYear, value ); }
+      void setMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::MaturityDate, value ); }
+      void setPutOrCall( int value )
+      { setInt( FIX::FIELD::PutOrCall, value ); }
+      void setCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::CouponPaymentDate, value ); }
+      void setIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::IssueDate, value ); }
+      void setRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RepoCollateralSecurityType, value ); }
+      void setRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::RepurchaseTerm, value ); }
+      void setRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::RepurchaseRate, value ); }
+      void setFactor( double value )
+      { setDouble( FIX::FIELD::Factor, value ); }
+      void setCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::CreditRating, value ); }
+      void setInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::InstrRegistry, value ); }
+      void setCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::CountryOfIssue, value ); }
+      void setStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::StateOrProvinceOfIssue, value ); }
+      void setLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::LocaleOfIssue, value ); }
+      void setRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::RedemptionDate, value ); }
+      void setStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StrikePrice, value ); }
+      void setStrikeCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::StrikeCurrency, value ); }
+      void setOptAttribute( char value )
+      { setChar( FIX::FIELD::OptAttribute, value ); }
+      void setContractMultiplier( double value )
+      { setDouble( FIX::FIELD::ContractMultiplier, value ); }
+      void setCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CouponRate, value ); }
+      void setSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityExchange, value ); }
+      void setIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::Issuer, value ); }
+      void setEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedIssuerLen, value ); }
+      void setEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedIssuer, value ); }
+      void setSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityDesc, value ); }
+      void setEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedSecurityDescLen, value ); }
+      void setEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedSecurityDesc, value ); }
+      void setPool( const FIX::StringView& value )
+      { setString( FIX::FIELD::Pool, value ); }
+      void setContractSettlMonth( const FIX::StringView& value )
+      { setString( FIX::FIELD::ContractSettlMonth, value ); }
+      void setCPProgram( int value )
+      { setInt( FIX::FIELD::CPProgram, value ); }
+      void setCPRegType( const FIX::StringView& value )
+      { setString( FIX::FIELD::CPRegType, value ); }
+      void setNoEvents( int value )
+      { setInt( FIX::FIELD::NoEvents, value ); }
+      void setDatedDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::DatedDate, value ); }
+      void setInterestAccrualDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::InterestAccrualDate, value ); }
+      void setAgreementDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::AgreementDesc, value ); }
+      void setAgreementID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AgreementID, value ); }
+      void setAgreementDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::AgreementDate, value ); }
+      void setAgreementCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::AgreementCurrency, value ); }
+      void setTerminationType( int value )
+      { setInt( FIX::FIELD::TerminationType, value ); }
+      void setStartDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::StartDate, value ); }
+      void setEndDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::EndDate, value ); }
+      void setDeliveryType( int value )
+      { setInt( FIX::FIELD::DeliveryType, value ); }
+      void setMarginRatio( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MarginRatio, value ); }
+      void setSettlDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlDate, value ); }
+      void setQuantity( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Quantity, value ); }
+      void setQtyType( int value )
+      { setInt( FIX::FIELD::QtyType, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setNoLegs( int value )
+      { setInt( FIX::FIELD::NoLegs, value ); }
+      void setNoUnderlyings( int value )
+      { setInt( FIX::FIELD::NoUnderlyings, value ); }
+      void setMarginExcess( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MarginExcess, value ); }
+      void setTotalNetValue( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::TotalNetValue, value ); }
+      void setCashOutstanding( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::CashOutstanding, value ); }
+      void setNoTrdRegTimestamps( int value )
+      { setInt( FIX::FIELD::NoTrdRegTimestamps, value ); }
+      void setSide( char value )
+      { setChar( FIX::FIELD::Side, value ); }
+      void setNoMiscFees( int value )
+      { setInt( FIX::FIELD::NoMiscFees, value ); }
+      void setPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::Price, value ); }
+      void setPriceType( int value )
+      { setInt( FIX::FIELD::PriceType, value ); }
+      void setAccruedInterestAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AccruedInterestAmt, value ); }
+      void setEndAccruedInterestAmt( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::EndAccruedInterestAmt, value ); }
+      void setStartCash( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::StartCash, value ); }
+      void setEndCash( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::EndCash, value ); }
+      void setSpread( double value )
+      { setDouble( FIX::FIELD::Spread, value ); }
+      void setBenchmarkCurveCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkCurveCurrency, value ); }
+      void setBenchmarkCurveName( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkCurveName, value ); }
+      void setBenchmarkCurvePoint( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkCurvePoint, value ); }
+      void setBenchmarkPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::BenchmarkPrice, value ); }
+      void setBenchmarkPriceType( int value )
+      { setInt( FIX::FIELD::BenchmarkPriceType, value ); }
+      void setBenchmarkSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkSecurityID, value ); }
+      void setBenchmarkSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::BenchmarkSecurityIDSource, value ); }
+      void setNoStipulations( int value )
+      { setInt( FIX::FIELD::NoStipulations, value ); }
+      void setSettlDeliveryType( int value )
+      { setInt( FIX::FIELD::SettlDeliveryType, value ); }
+      void setStandInstDbType( int value )
+      { setInt( FIX::FIELD::StandInstDbType, value ); }
+      void setStandInstDbName( const FIX::StringView& value )
+      { setString( FIX::FIELD::StandInstDbName, value ); }
+      void setStandInstDbID( const FIX::StringView& value )
+      { setString( FIX::FIELD::StandInstDbID, value ); }
+      void setNoDlvyInst( int value )
+      { setInt( FIX::FIELD::NoDlvyInst, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setTradingSessionSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionSubID, value ); }
+      void setSettlSessID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlSessID, value ); }
+      void setSettlSessSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlSessSubID, value ); }
+      void setClearingBusinessDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClearingBusinessDate, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+    };
   };
 
 }
@@ -37,6 +37,58 @@ namespace FIX44
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView confirmID() const
+      { return getString( FIX::FIELD::ConfirmID ); }
+      FIX::StringView tradeDate() const
+      { return getString( FIX::FIELD::TradeDate ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      int affirmStatus() const
+      { return getInt( FIX::FIELD::AffirmStatus ); }
+      int confirmRejReason() const
+      { return getInt( FIX::FIELD::ConfirmRejReason ); }
+      FIX::MatchStatus matchStatus() const
+      { return FIX::MatchStatus( getChar( FIX::FIELD::MatchStatus ) ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "AU" ) {}
+      void setConfirmID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ConfirmID, value ); }
+      void setTradeDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradeDate, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setAffirmStatus( int value )
+      { setInt( FIX::FIELD::AffirmStatus, value ); }
+      void setConfirmRejReason( int value )
+      { setInt( FIX::FIELD::ConfirmRejReason, value ); }
+      void setMatchStatus( char value )
+      { setChar( FIX::FIELD::MatchStatus, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+    };
   };
 
 }
@@ -53,12 +53,52 @@ namespace FIX44
         NoNested2PartySubIDs() : FIX::Group(806,760,FIX::message_order(760,807,0)) {}
           FIELD_SET(*this, FIX::Nested2PartySubID);
           FIELD_SET(*this, FIX::Nested2PartySubIDType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::Nested2PartySubID);
+            FIELD_VIEW(*m_pMap, FIX::Nested2PartySubIDType);
+          };
+        };
+        FIX::GroupView<NoNested2PartySubIDs::View> noNested2PartySubIDs() const
+        { return FIX::GroupView<NoNested2PartySubIDs::View>( *this, FIX::FIELD::NoNested2PartySubIDs ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::Nested2PartyID);
+          FIELD_VIEW(*m_pMap, FIX::Nested2PartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::Nested2PartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NoNested2PartySubIDs);
+          FIX::GroupView<NoNested2PartySubIDs::View> noNested2PartySubIDs() const
+          { return FIX::GroupView<NoNested2PartySubIDs::View>( *m_pMap, FIX::FIELD::NoNested2PartySubIDs ); }
         };
       };
+      FIX::GroupView<NoNested2PartyIDs::View> noNested2PartyIDs() const
+      { return FIX::GroupView<NoNested2PartyIDs::View>( *this, FIX::FIELD::NoNested2PartyIDs ); }
       FIELD_SET(*this, FIX::OrderQty);
       FIELD_SET(*this, FIX::OrderAvgPx);
       FIELD_SET(*this, FIX::OrderBookingQty);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::OrderID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryOrderID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::ListID);
+        FIELD_VIEW(*m_pMap, FIX::NoNested2PartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::OrderQty);
+        FIELD_VIEW(*m_pMap, FIX::OrderAvgPx);
+        FIELD_VIEW(*m_pMap, FIX::OrderBookingQty);
+        FIX::GroupView<NoNested2PartyIDs::View> noNested2PartyIDs() const
+        { return FIX::GroupView<NoNested2PartyIDs::View>( *m_pMap, FIX::FIELD::NoNested2PartyIDs ); }
+      };
     };
+    FIX::GroupView<NoOrders::View> noOrders() const
+    { return FIX::GroupView<NoOrders::View>( *this, FIX::FIELD::NoOrders ); }
     FIELD_SET(*this, FIX::AllocID);
     FIELD_SET(*this, FIX::SecondaryAllocID);
     FIELD_SET(*this, FIX::IndividualAllocID);
@@ -69,6 +109,74 @@ namespace FIX44
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView confirmReqID() const
+      { return getString( FIX::FIELD::ConfirmReqID ); }
+      int confirmType() const
+      { return getInt( FIX::FIELD::ConfirmType ); }
+      int noOrders() const
+      { return getInt( FIX::FIELD::NoOrders ); }
+      FIX::StringView allocID() const
+      { return getString( FIX::FIELD::AllocID ); }
+      FIX::StringView secondaryAllocID() const
+      { return getString( FIX::FIELD::SecondaryAllocID ); }
+      FIX::StringView individualAllocID() const
+      { return getString( FIX::FIELD::IndividualAllocID ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      FIX::StringView allocAccount() const
+      { return getString( FIX::FIELD::AllocAccount ); }
+      int allocAcctIDSource() const
+      { return getInt( FIX::FIELD::AllocAcctIDSource ); }
+      int allocAccountType() const
+      { return getInt( FIX::FIELD::AllocAccountType ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "BH" ) {}
+      void setConfirmReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ConfirmReqID, value ); }
+      void setConfirmType( int value )
+      { setInt( FIX::FIELD::ConfirmType, value ); }
+      void setNoOrders( int value )
+      { setInt( FIX::FIELD::NoOrders, value ); }
+      void setAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocID, value ); }
+      void setSecondaryAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecondaryAllocID, value ); }
+      void setIndividualAllocID( const FIX::StringView& value )
+      { setString( FIX::FIELD::IndividualAllocID, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setAllocAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllocAccount, value ); }
+      void setAllocAcctIDSource( int value )
+      { setInt( FIX::FIELD::AllocAcctIDSource, value ); }
+      void setAllocAccountType( int value )
+      { setInt( FIX::FIELD::AllocAccountType, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+    };
   };
 
 }
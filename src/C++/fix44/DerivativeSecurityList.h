@@ -40,7 +40,16 @@ namespace FIX44
     NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
       FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
       FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+    { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *this, FIX::FIELD::NoUnderlyingSecurityAltID ); }
     FIELD_SET(*this, FIX::UnderlyingProduct);
     FIELD_SET(*this, FIX::UnderlyingCFICode);
     FIELD_SET(*this, FIX::UnderlyingSecurityType);
@@ -89,7 +98,16 @@ namespace FIX44
     NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
       FIELD_SET(*this, FIX::UnderlyingStipType);
       FIELD_SET(*this, FIX::UnderlyingStipValue);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStipType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStipValue);
+      };
     };
+    FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+    { return FIX::GroupView<NoUnderlyingStips::View>( *this, FIX::FIELD::NoUnderlyingStips ); }
     FIELD_SET(*this, FIX::TotNoRelatedSym);
     FIELD_SET(*this, FIX::LastFragment);
     FIELD_SET(*this, FIX::NoRelatedSym);
@@ -108,7 +126,16 @@ namespace FIX44
       NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+      { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
       FIELD_SET(*this, FIX::Product);
       FIELD_SET(*this, FIX::CFICode);
       FIELD_SET(*this, FIX::SecurityType);
@@ -153,7 +180,18 @@ namespace FIX44
         FIELD_SET(*this, FIX::EventDate);
         FIELD_SET(*this, FIX::EventPx);
         FIELD_SET(*this, FIX::EventText);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::EventType);
+          FIELD_VIEW(*m_pMap, FIX::EventDate);
+          FIELD_VIEW(*m_pMap, FIX::EventPx);
+          FIELD_VIEW(*m_pMap, FIX::EventText);
+        };
       };
+      FIX::GroupView<NoEvents::View> noEvents() const
+      { return FIX::GroupView<NoEvents::View>( *this, FIX::FIELD::NoEvents ); }
       FIELD_SET(*this, FIX::DatedDate);
       FIELD_SET(*this, FIX::InterestAccrualDate);
       FIELD_SET(*this, FIX::Currency);
@@ -167,7 +205,16 @@ namespace FIX44
       NoInstrAttrib() : FIX::Group(870,871,FIX::message_order(871,872,0)) {}
         FIELD_SET(*this, FIX::InstrAttribType);
         FIELD_SET(*this, FIX::InstrAttribValue);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::InstrAttribType);
+          FIELD_VIEW(*m_pMap, FIX::InstrAttribValue);
+        };
       };
+      FIX::GroupView<NoInstrAttrib::View> noInstrAttrib() const
+      { return FIX::GroupView<NoInstrAttrib::View>( *this, FIX::FIELD::NoInstrAttrib ); }
       FIELD_SET(*this, FIX::NoLegs);
       class NoLegs: public FIX::Group
       {
@@ -184,7 +231,16 @@ namespace FIX44
         NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
           FIELD_SET(*this, FIX::LegSecurityAltID);
           FIELD_SET(*this, FIX::LegSecurityAltIDSource);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityAltID);
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityAltIDSource);
+          };
         };
+        FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+        { return FIX::GroupView<NoLegSecurityAltID::View>( *this, FIX::FIELD::NoLegSecurityAltID ); }
         FIELD_SET(*this, FIX::LegProduct);
         FIELD_SET(*this, FIX::LegCFICode);
         FIELD_SET(*this, FIX::LegSecurityType);
@@ -222,12 +278,358 @@ namespace FIX44
         FIELD_SET(*this, FIX::LegDatedDate);
         FIELD_SET(*this, FIX::LegContractSettlMonth);
         FIELD_SET(*this, FIX::LegInterestAccrualDate);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::LegSymbol);
+          FIELD_VIEW(*m_pMap, FIX::LegSymbolSfx);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityID);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NoLegSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::LegProduct);
+          FIELD_VIEW(*m_pMap, FIX::LegCFICode);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::LegSecuritySubType);
+          FIELD_VIEW(*m_pMap, FIX::LegMaturityMonthYear);
+          FIELD_VIEW(*m_pMap, FIX::LegMaturityDate);
+          FIELD_VIEW(*m_pMap, FIX::LegCouponPaymentDate);
+          FIELD_VIEW(*m_pMap, FIX::LegIssueDate);
+          FIELD_VIEW(*m_pMap, FIX::LegRepoCollateralSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::LegRepurchaseTerm);
+          FIELD_VIEW(*m_pMap, FIX::LegRepurchaseRate);
+          FIELD_VIEW(*m_pMap, FIX::LegFactor);
+          FIELD_VIEW(*m_pMap, FIX::LegCreditRating);
+          FIELD_VIEW(*m_pMap, FIX::LegInstrRegistry);
+          FIELD_VIEW(*m_pMap, FIX::LegCountryOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegStateOrProvinceOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegLocaleOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegRedemptionDate);
+          FIELD_VIEW(*m_pMap, FIX::LegStrikePrice);
+          FIELD_VIEW(*m_pMap, FIX::LegStrikeCurrency);
+          FIELD_VIEW(*m_pMap, FIX::LegOptAttribute);
+          FIELD_VIEW(*m_pMap, FIX::LegContractMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::LegCouponRate);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityExchange);
+          FIELD_VIEW(*m_pMap, FIX::LegIssuer);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuerLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuer);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDescLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::LegRatioQty);
+          FIELD_VIEW(*m_pMap, FIX::LegSide);
+          FIELD_VIEW(*m_pMap, FIX::LegCurrency);
+          FIELD_VIEW(*m_pMap, FIX::LegPool);
+          FIELD_VIEW(*m_pMap, FIX::LegDatedDate);
+          FIELD_VIEW(*m_pMap, FIX::LegContractSettlMonth);
+          FIELD_VIEW(*m_pMap, FIX::LegInterestAccrualDate);
+          FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+          { return FIX::GroupView<NoLegSecurityAltID::View>( *m_pMap, FIX::FIELD::NoLegSecurityAltID ); }
+        };
       };
+      FIX::GroupView<NoLegs::View> noLegs() const
+      { return FIX::GroupView<NoLegs::View>( *this, FIX::FIELD::NoLegs ); }
       FIELD_SET(*this, FIX::TradingSessionID);
       FIELD_SET(*this, FIX::TradingSessionSubID);
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::Product);
+        FIELD_VIEW(*m_pMap, FIX::CFICode);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::SecuritySubType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::IssueDate);
+        FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::Factor);
+        FIELD_VIEW(*m_pMap, FIX::CreditRating);
+        FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::StrikeCurrency);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::Pool);
+        FIELD_VIEW(*m_pMap, FIX::ContractSettlMonth);
+        FIELD_VIEW(*m_pMap, FIX::CPProgram);
+        FIELD_VIEW(*m_pMap, FIX::CPRegType);
+        FIELD_VIEW(*m_pMap, FIX::NoEvents);
+        FIELD_VIEW(*m_pMap, FIX::DatedDate);
+        FIELD_VIEW(*m_pMap, FIX::InterestAccrualDate);
+        FIELD_VIEW(*m_pMap, FIX::Currency);
+        FIELD_VIEW(*m_pMap, FIX::ExpirationCycle);
+        FIELD_VIEW(*m_pMap, FIX::DeliveryForm);
+        FIELD_VIEW(*m_pMap, FIX::PctAtRisk);
+        FIELD_VIEW(*m_pMap, FIX::NoInstrAttrib);
+        FIELD_VIEW(*m_pMap, FIX::NoLegs);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
+        FIX::GroupView<NoEvents::View> noEvents() const
+        { return FIX::GroupView<NoEvents::View>( *m_pMap, FIX::FIELD::NoEvents ); }
+        FIX::GroupView<NoInstrAttrib::View> noInstrAttrib() const
+        { return FIX::GroupView<NoInstrAttrib::View>( *m_pMap, FIX::FIELD::NoInstrAttrib ); }
+        FIX::GroupView<NoLegs::View> noLegs() const
+        { return FIX::GroupView<NoLegs::View>( *m_pMap, FIX::FIELD::NoLegs ); }
+      };
+    };
+    FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+    { return FIX::GroupView<NoRelatedSym::View>( *this, FIX::FIELD::NoRelatedSym ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView securityReqID() const
+      { return getString( FIX::FIELD::SecurityReqID ); }
+      FIX::StringView securityResponseID() const
+      { return getString( FIX::FIELD::SecurityResponseID ); }
+      int securityRequestResult() const
+      { return getInt( FIX::FIELD::SecurityRequestResult ); }
+      FIX::StringView underlyingSymbol() const
+      { return getString( FIX::FIELD::UnderlyingSymbol ); }
+      FIX::StringView underlyingSymbolSfx() const
+      { return getString( FIX::FIELD::UnderlyingSymbolSfx ); }
+      FIX::StringView underlyingSecurityID() const
+      { return getString( FIX::FIELD::UnderlyingSecurityID ); }
+      FIX::StringView underlyingSecurityIDSource() const
+      { return getString( FIX::FIELD::UnderlyingSecurityIDSource ); }
+      int noUnderlyingSecurityAltID() const
+      { return getInt( FIX::FIELD::NoUnderlyingSecurityAltID ); }
+      int underlyingProduct() const
+      { return getInt( FIX::FIELD::UnderlyingProduct ); }
+      FIX::StringView underlyingCFICode() const
+      { return getString( FIX::FIELD::UnderlyingCFICode ); }
+      FIX::StringView underlyingSecurityType() const
+      { return getString( FIX::FIELD::UnderlyingSecurityType ); }
+      FIX::StringView underlyingSecuritySubType() const
+      { return getString( FIX::FIELD::UnderlyingSecuritySubType ); }
+      FIX::StringView underlyingMaturityMonthYear() const
+      { return getString( FIX::FIELD::UnderlyingMaturityMonthYear ); }
+      FIX::StringView underlyingMaturityDate() const
+      { return getString( FIX::FIELD::UnderlyingMaturityDate ); }
+      int underlyingPutOrCall() const
+      { return getInt( FIX::FIELD::UnderlyingPutOrCall ); }
+      FIX::StringView underlyingCouponPaymentDate() const
+      { return getString( FIX::FIELD::UnderlyingCouponPaymentDate ); }
+      FIX::StringView underlyingIssueDate() const
+      { return getString( FIX::FIELD::UnderlyingIssueDate ); }
+      FIX::StringView underlyingRepoCollateralSecurityType() const
+      { return getString( FIX::FIELD::UnderlyingRepoCollateralSecurityType ); }
+      int underlyingRepurchaseTerm() const
+      { return getInt( FIX::FIELD::UnderlyingRepurchaseTerm ); }
+      FIX::Decimal underlyingRepurchaseRate() const
+      { return getDecimal( FIX::FIELD::UnderlyingRepurchaseRate ); }
+      double underlyingFactor() const
+      { return getDouble( FIX::FIELD::UnderlyingFactor ); }
+      FIX::StringView underlyingCreditRating() const
+      { return getString( FIX::FIELD::UnderlyingCreditRating ); }
+      FIX::StringView underlyingInstrRegistry() const
+      { return getString( FIX::FIELD::UnderlyingInstrRegistry ); }
+      FIX::StringView underlyingCountryOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingCountryOfIssue ); }
+      FIX::StringView underlyingStateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingStateOrProvinceOfIssue ); }
+      FIX::StringView underlyingLocaleOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingLocaleOfIssue ); }
+      FIX::StringView underlyingRedemptionDate() const
+      { return getString( FIX::FIELD::UnderlyingRedemptionDate ); }
+      FIX::Decimal underlyingStrikePrice() const
+      { return getDecimal( FIX::FIELD::UnderlyingStrikePrice ); }
+      FIX::StringView underlyingStrikeCurrency() const
+      { return getString( FIX::FIELD::UnderlyingStrikeCurrency ); }
+      char underlyingOptAttribute() const
+      { return getChar( FIX::FIELD::UnderlyingOptAttribute ); }
+      double underlyingContractMultiplier() const
+      { return getDouble( FIX::FIELD::UnderlyingContractMultiplier ); }
+      FIX::Decimal underlyingCouponRate() const
+      { return getDecimal( FIX::FIELD::UnderlyingCouponRate ); }
+      FIX::StringView underlyingSecurityExchange() const
+      { return getString( FIX::FIELD::UnderlyingSecurityExchange ); }
+      FIX::StringView underlyingIssuer() const
+      { return getString( FIX::FIELD::UnderlyingIssuer ); }
+      int encodedUnderlyingIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedUnderlyingIssuerLen ); }
+      FIX::StringView encodedUnderlyingIssuer() const
+      { return getString( FIX::FIELD::EncodedUnderlyingIssuer ); }
+      FIX::StringView underlyingSecurityDesc() const
+      { return getString( FIX::FIELD::UnderlyingSecurityDesc ); }
+      int encodedUnderlyingSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedUnderlyingSecurityDescLen ); }
+      FIX::StringView encodedUnderlyingSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedUnderlyingSecurityDesc ); }
+      FIX::StringView underlyingCPProgram() const
+      { return getString( FIX::FIELD::UnderlyingCPProgram ); }
+      FIX::StringView underlyingCPRegType() const
+      { return getString( FIX::FIELD::UnderlyingCPRegType ); }
+      FIX::StringView underlyingCurrency() const
+      { return getString( FIX::FIELD::UnderlyingCurrency ); }
+      FIX::Decimal underlyingQty() const
+      { return getDecimal( FIX::FIELD::UnderlyingQty ); }
+      FIX::Decimal underlyingPx() const
+      { return getDecimal( FIX::FIELD::UnderlyingPx ); }
+      FIX::Decimal underlyingDirtyPrice() const
+      { return getDecimal( FIX::FIELD::UnderlyingDirtyPrice ); }
+      FIX::Decimal underlyingEndPrice() const
+      { return getDecimal( FIX::FIELD::UnderlyingEndPrice ); }
+      FIX::Decimal underlyingStartValue() const
+      { return getDecimal( FIX::FIELD::UnderlyingStartValue ); }
+      FIX::Decimal underlyingCurrentValue() const
+      { return getDecimal( FIX::FIELD::UnderlyingCurrentValue ); }
+      FIX::Decimal underlyingEndValue() const
+      { return getDecimal( FIX::FIELD::UnderlyingEndValue ); }
+      int noUnderlyingStips() const
+      { return getInt( FIX::FIELD::NoUnderlyingStips ); }
+      int totNoRelatedSym() const
+      { return getInt( FIX::FIELD::TotNoRelatedSym ); }
+      bool lastFragment() const
+      { return getBool( FIX::FIELD::LastFragment ); }
+      int noRelatedSym() const
+      { return getInt( FIX::FIELD::NoRelatedSym ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "AA" ) {}
+      void setSecurityReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityReqID, value ); }
+      void setSecurityResponseID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityResponseID, value ); }
+      void setSecurityRequestResult( int value )
+      { setInt( FIX::FIELD::SecurityRequestResult, value ); }
+      void setUnderlyingSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSymbol, value ); }
+      void setUnderlyingSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSymbolSfx, value ); }
+      void setUnderlyingSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityID, value ); }
+      void setUnderlyingSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityIDSource, value ); }
+      void setNoUnderlyingSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoUnderlyingSecurityAltID, value ); }
+      void setUnderlyingProduct( int value )
+      { setInt( FIX::FIELD::UnderlyingProduct, value ); }
+      void setUnderlyingCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCFICode, value ); }
+      void setUnderlyingSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityType, value ); }
+      void setUnderlyingSecuritySubType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecuritySubType, value ); }
+      void setUnderlyingMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingMaturityMonthYear, value ); }
+      void setUnderlyingMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingMaturityDate, value ); }
+      void setUnderlyingPutOrCall( int value )
+      { setInt( FIX::FIELD::UnderlyingPutOrCall, value ); }
+      void setUnderlyingCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCouponPaymentDate, value ); }
+      void setUnderlyingIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingIssueDate, value ); }
+      void setUnderlyingRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingRepoCollateralSecurityType, value ); }
+      void setUnderlyingRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::UnderlyingRepurchaseTerm, value ); }
+      void setUnderlyingRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingRepurchaseRate, value ); }
+      void setUnderlyingFactor( double value )
+      { setDouble( FIX::FIELD::UnderlyingFactor, value ); }
+      void setUnderlyingCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCreditRating, value ); }
+      void setUnderlyingInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingInstrRegistry, value ); }
+      void setUnderlyingCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCountryOfIssue, value ); }
+      void setUnderlyingStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingStateOrProvinceOfIssue, value ); }
+      void setUnderlyingLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingLocaleOfIssue, value ); }
+      void setUnderlyingRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingRedemptionDate, value ); }
+      void setUnderlyingStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingStrikePrice, value ); }
+      void setUnderlyingStrikeCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingStrikeCurrency, value ); }
+      void setUnderlyingOptAttribute( char value )
+      { setChar( FIX::FIELD::UnderlyingOptAttribute, value ); }
+      void setUnderlyingContractMultiplier( double value )
+      { setDouble( FIX::FIELD::UnderlyingContractMultiplier, value ); }
+      void setUnderlyingCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingCouponRate, value ); }
+      void setUnderlyingSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityExchange, value ); }
+      void setUnderlyingIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingIssuer, value ); }
+      void setEncodedUnderlyingIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedUnderlyingIssuerLen, value ); }
+      void setEncodedUnderlyingIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedUnderlyingIssuer, value ); }
+      void setUnderlyingSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityDesc, value ); }
+      void setEncodedUnderlyingSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedUnderlyingSecurityDescLen, value ); }
+      void setEncodedUnderlyingSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedUnderlyingSecurityDesc, value ); }
+      void setUnderlyingCPProgram( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCPProgram, value ); }
+      void setUnderlyingCPRegType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCPRegType, value ); }
+      void setUnderlyingCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCurrency, value ); }
+      void setUnderlyingQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingQty, value ); }
+      void setUnderlyingPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingPx, value ); }
+      void setUnderlyingDirtyPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingDirtyPrice, value ); }
+      void setUnderlyingEndPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingEndPrice, value ); }
+      void setUnderlyingStartValue( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingStartValue, value ); }
+      void setUnderlyingCurrentValue( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingCurrentValue, value ); }
+      void setUnderlyingEndValue( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingEndValue, value ); }
+      void setNoUnderlyingStips( int value )
+      { setInt( FIX::FIELD::NoUnderlyingStips, value ); }
+      void setTotNoRelatedSym( int value )
+      { setInt( FIX::FIELD::TotNoRelatedSym, value ); }
+      void setLastFragment( bool value )
+      { setBool( FIX::FIELD::LastFragment, value ); }
+      void setNoRelatedSym( int value )
+      { setInt( FIX::FIELD::NoRelatedSym, value ); }
     };
   };
 
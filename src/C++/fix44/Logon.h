@@ -41,6 +41,73 @@ namespace FIX44
     NoMsgTypes() : FIX::Group(384,372,FIX::message_order(372,385,0)) {}
       FIELD_SET(*this, FIX::RefMsgType);
       FIELD_SET(*this, FIX::MsgDirection);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::RefMsgType);
+        FIELD_VIEW(*m_pMap, FIX::MsgDirection);
+      };
+    };
+    FIX::GroupView<NoMsgTypes::View> noMsgTypes() const
+    { return FIX::GroupView<NoMsgTypes::View>( *this, FIX::FIELD::NoMsgTypes ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      int encryptMethod() const
+      { return getInt( FIX::FIELD::EncryptMethod ); }
+      int heartBtInt() const
+      { return getInt( FIX::FIELD::HeartBtInt ); }
+      int rawDataLength() const
+      { return getInt( FIX::FIELD::RawDataLength ); }
+      FIX::StringView rawData() const
+      { return getString( FIX::FIELD::RawData ); }
+      bool resetSeqNumFlag() const
+      { return getBool( FIX::FIELD::ResetSeqNumFlag ); }
+      int nextExpectedMsgSeqNum() const
+      { return getInt( FIX::FIELD::NextExpectedMsgSeqNum ); }
+      int maxMessageSize() const
+      { return getInt( FIX::FIELD::MaxMessageSize ); }
+      bool testMessageIndicator() const
+      { return getBool( FIX::FIELD::TestMessageIndicator ); }
+      FIX::StringView username() const
+      { return getString( FIX::FIELD::Username ); }
+      FIX::StringView password() const
+      { return getString( FIX::FIELD::Password ); }
+      int noMsgTypes() const
+      { return getInt( FIX::FIELD::NoMsgTypes ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "A" ) {}
+      void setEncryptMethod( int value )
+      { setInt( FIX::FIELD::EncryptMethod, value ); }
+      void setHeartBtInt( int value )
+      { setInt( FIX::FIELD::HeartBtInt, value ); }
+      void setRawDataLength( int value )
+      { setInt( FIX::FIELD::RawDataLength, value ); }
+      void setRawData( const FIX::StringView& value )
+      { setString( FIX::FIELD::RawData, value ); }
+      void setResetSeqNumFlag( bool value )
+      { setBool( FIX::FIELD::ResetSeqNumFlag, value ); }
+      void setNextExpectedMsgSeqNum( int value )
+      { setInt( FIX::FIELD::NextExpectedMsgSeqNum, value ); }
+      void setMaxMessageSize( int value )
+      { setInt( FIX::FIELD::MaxMessageSize, value ); }
+      void setTestMessageIndicator( bool value )
+      { setBool( FIX::FIELD::TestMessageIndicator, value ); }
+      void setUsername( const FIX::StringView& value )
+      { setString( FIX::FIELD::Username, value ); }
+      void setPassword( const FIX::StringView& value )
+      { setString( FIX::FIELD::Password, value ); }
+      void setNoMsgTypes( int value )
+      { setInt( FIX::FIELD::NoMsgTypes, value ); }
     };
   };
 
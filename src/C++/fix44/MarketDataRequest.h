@@ -40,7 +40,15 @@ namespace FIX44
     public:
     NoMDEntryTypes() : FIX::Group(267,269,FIX::message_order(269,0)) {}
       FIELD_SET(*this, FIX::MDEntryType);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::MDEntryType);
+      };
     };
+    FIX::GroupView<NoMDEntryTypes::View> noMDEntryTypes() const
+    { return FIX::GroupView<NoMDEntryTypes::View>( *this, FIX::FIELD::NoMDEntryTypes ); }
     FIELD_SET(*this, FIX::NoRelatedSym);
     class NoRelatedSym: public FIX::Group
     {
@@ -57,7 +65,16 @@ namespace FIX44
       NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+      { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
       FIELD_SET(*this, FIX::Product);
       FIELD_SET(*this, FIX::CFICode);
       FIELD_SET(*this, FIX::SecurityType);
@@ -102,7 +119,18 @@ namespace FIX44
         FIELD_SET(*this, FIX::EventDate);
         FIELD_SET(*this, FIX::EventPx);
         FIELD_SET(*this, FIX::EventText);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::EventType);
+          FIELD_VIEW(*m_pMap, FIX::EventDate);
+          FIELD_VIEW(*m_pMap, FIX::EventPx);
+          FIELD_VIEW(*m_pMap, FIX::EventText);
+        };
       };
+      FIX::GroupView<NoEvents::View> noEvents() const
+      { return FIX::GroupView<NoEvents::View>( *this, FIX::FIELD::NoEvents ); }
       FIELD_SET(*this, FIX::DatedDate);
       FIELD_SET(*this, FIX::InterestAccrualDate);
       FIELD_SET(*this, FIX::NoUnderlyings);
@@ -121,7 +149,16 @@ namespace FIX44
         NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
           FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
           FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltID);
+            FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltIDSource);
+          };
         };
+        FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+        { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *this, FIX::FIELD::NoUnderlyingSecurityAltID ); }
         FIELD_SET(*this, FIX::UnderlyingProduct);
         FIELD_SET(*this, FIX::UnderlyingCFICode);
         FIELD_SET(*this, FIX::UnderlyingSecurityType);
@@ -170,8 +207,75 @@ namespace FIX44
         NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
           FIELD_SET(*this, FIX::UnderlyingStipType);
           FIELD_SET(*this, FIX::UnderlyingStipValue);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::UnderlyingStipType);
+            FIELD_VIEW(*m_pMap, FIX::UnderlyingStipValue);
+          };
+        };
+        FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+        { return FIX::GroupView<NoUnderlyingStips::View>( *this, FIX::FIELD::NoUnderlyingStips ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbol);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbolSfx);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityID);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NoUnderlyingSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingProduct);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCFICode);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecuritySubType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityMonthYear);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityDate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingPutOrCall);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponPaymentDate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingIssueDate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingRepoCollateralSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseTerm);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseRate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingFactor);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCreditRating);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrRegistry);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCountryOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStateOrProvinceOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingLocaleOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingRedemptionDate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikePrice);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikeCurrency);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingOptAttribute);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingContractMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponRate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityExchange);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingIssuer);
+          FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuerLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuer);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDescLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCPProgram);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCPRegType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrency);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingQty);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingPx);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingDirtyPrice);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingEndPrice);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStartValue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrentValue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingEndValue);
+          FIELD_VIEW(*m_pMap, FIX::NoUnderlyingStips);
+          FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+          { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *m_pMap, FIX::FIELD::NoUnderlyingSecurityAltID ); }
+          FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+          { return FIX::GroupView<NoUnderlyingStips::View>( *m_pMap, FIX::FIELD::NoUnderlyingStips ); }
         };
       };
+      FIX::GroupView<NoUnderlyings::View> noUnderlyings() const
+      { return FIX::GroupView<NoUnderlyings::View>( *this, FIX::FIELD::NoUnderlyings ); }
       FIELD_SET(*this, FIX::NoLegs);
       class NoLegs: public FIX::Group
       {
@@ -188,7 +292,16 @@ namespace FIX44
         NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
           FIELD_SET(*this, FIX::LegSecurityAltID);
           FIELD_SET(*this, FIX::LegSecurityAltIDSource);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityAltID);
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityAltIDSource);
+          };
         };
+        FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+        { return FIX::GroupView<NoLegSecurityAltID::View>( *this, FIX::FIELD::NoLegSecurityAltID ); }
         FIELD_SET(*this, FIX::LegProduct);
         FIELD_SET(*this, FIX::LegCFICode);
         FIELD_SET(*this, FIX::LegSecurityType);
@@ -226,8 +339,119 @@ namespace FIX44
         FIELD_SET(*this, FIX::LegDatedDate);
         FIELD_SET(*this, FIX::LegContractSettlMonth);
         FIELD_SET(*this, FIX::LegInterestAccrualDate);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::LegSymbol);
+          FIELD_VIEW(*m_pMap, FIX::LegSymbolSfx);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityID);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NoLegSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::LegProduct);
+          FIELD_VIEW(*m_pMap, FIX::LegCFICode);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::LegSecuritySubType);
+          FIELD_VIEW(*m_pMap, FIX::LegMaturityMonthYear);
+          FIELD_VIEW(*m_pMap, FIX::LegMaturityDate);
+          FIELD_VIEW(*m_pMap, FIX::LegCouponPaymentDate);
+          FIELD_VIEW(*m_pMap, FIX::LegIssueDate);
+          FIELD_VIEW(*m_pMap, FIX::LegRepoCollateralSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::LegRepurchaseTerm);
+          FIELD_VIEW(*m_pMap, FIX::LegRepurchaseRate);
+          FIELD_VIEW(*m_pMap, FIX::LegFactor);
+          FIELD_VIEW(*m_pMap, FIX::LegCreditRating);
+          FIELD_VIEW(*m_pMap, FIX::LegInstrRegistry);
+          FIELD_VIEW(*m_pMap, FIX::LegCountryOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegStateOrProvinceOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegLocaleOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegRedemptionDate);
+          FIELD_VIEW(*m_pMap, FIX::LegStrikePrice);
+          FIELD_VIEW(*m_pMap, FIX::LegStrikeCurrency);
+          FIELD_VIEW(*m_pMap, FIX::LegOptAttribute);
+          FIELD_VIEW(*m_pMap, FIX::LegContractMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::LegCouponRate);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityExchange);
+          FIELD_VIEW(*m_pMap, FIX::LegIssuer);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuerLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuer);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDescLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::LegRatioQty);
+          FIELD_VIEW(*m_pMap, FIX::LegSide);
+          FIELD_VIEW(*m_pMap, FIX::LegCurrency);
+          FIELD_VIEW(*m_pMap, FIX::LegPool);
+          FIELD_VIEW(*m_pMap, FIX::LegDatedDate);
+          FIELD_VIEW(*m_pMap, FIX::LegContractSettlMonth);
+          FIELD_VIEW(*m_pMap, FIX::LegInterestAccrualDate);
+          FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+          { return FIX::GroupView<NoLegSecurityAltID::View>( *m_pMap, FIX::FIELD::NoLegSecurityAltID ); }
+        };
+      };
+      FIX::GroupView<NoLegs::View> noLegs() const
+      { return FIX::GroupView<NoLegs::View>( *this, FIX::FIELD::NoLegs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::Product);
+        FIELD_VIEW(*m_pMap, FIX::CFICode);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::SecuritySubType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::IssueDate);
+        FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::Factor);
+        FIELD_VIEW(*m_pMap, FIX::CreditRating);
+        FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::StrikeCurrency);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::Pool);
+        FIELD_VIEW(*m_pMap, FIX::ContractSettlMonth);
+        FIELD_VIEW(*m_pMap, FIX::CPProgram);
+        FIELD_VIEW(*m_pMap, FIX::CPRegType);
+        FIELD_VIEW(*m_pMap, FIX::NoEvents);
+        FIELD_VIEW(*m_pMap, FIX::DatedDate);
+        FIELD_VIEW(*m_pMap, FIX::InterestAccrualDate);
+        FIELD_VIEW(*m_pMap, FIX::NoUnderlyings);
+        FIELD_VIEW(*m_pMap, FIX::NoLegs);
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
+        FIX::GroupView<NoEvents::View> noEvents() const
+        { return FIX::GroupView<NoEvents::View>( *m_pMap, FIX::FIELD::NoEvents ); }
+        FIX::GroupView<NoUnderlyings::View> noUnderlyings() const
+        { return FIX::GroupView<NoUnderlyings::View>( *m_pMap, FIX::FIELD::NoUnderlyings ); }
+        FIX::GroupView<NoLegs::View> noLegs() const
+        { return FIX::GroupView<NoLegs::View>( *m_pMap, FIX::FIELD::NoLegs ); }
       };
     };
+    FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+    { return FIX::GroupView<NoRelatedSym::View>( *this, FIX::FIELD::NoRelatedSym ); }
     FIELD_SET(*this, FIX::NoTradingSessions);
     class NoTradingSessions: public FIX::Group
     {
@@ -235,9 +459,84 @@ namespace FIX44
     NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,0)) {}
       FIELD_SET(*this, FIX::TradingSessionID);
       FIELD_SET(*this, FIX::TradingSessionSubID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+      };
     };
+    FIX::GroupView<NoTradingSessions::View> noTradingSessions() const
+    { return FIX::GroupView<NoTradingSessions::View>( *this, FIX::FIELD::NoTradingSessions ); }
     FIELD_SET(*this, FIX::ApplQueueAction);
     FIELD_SET(*this, FIX::ApplQueueMax);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView mDReqID() const
+      { return getString( FIX::FIELD::MDReqID ); }
+      FIX::SubscriptionRequestType subscriptionRequestType() const
+      { return FIX::SubscriptionRequestType( getChar( FIX::FIELD::SubscriptionRequestType ) ); }
+      int marketDepth() const
+      { return getInt( FIX::FIELD::MarketDepth ); }
+      int mDUpdateType() const
+      { return getInt( FIX::FIELD::MDUpdateType ); }
+      bool aggregatedBook() const
+      { return getBool( FIX::FIELD::AggregatedBook ); }
+      FIX::StringView openCloseSettlFlag() const
+      { return getString( FIX::FIELD::OpenCloseSettlFlag ); }
+      FIX::StringView scope() const
+      { return getString( FIX::FIELD::Scope ); }
+      bool mDImplicitDelete() const
+      { return getBool( FIX::FIELD::MDImplicitDelete ); }
+      int noMDEntryTypes() const
+      { return getInt( FIX::FIELD::NoMDEntryTypes ); }
+      int noRelatedSym() const
+      { return getInt( FIX::FIELD::NoRelatedSym ); }
+      int noTradingSessions() const
+      { return getInt( FIX::FIELD::NoTradingSessions ); }
+      int applQueueAction() const
+      { return getInt( FIX::FIELD::ApplQueueAction ); }
+      int applQueueMax() const
+      { return getInt( FIX::FIELD::ApplQueueMax ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "V" ) {}
+      void setMDReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MDReqID, value ); }
+      void setSubscriptionRequestType( char value )
+      { setChar( FIX::FIELD::SubscriptionRequestType, value ); }
+      void setMarketDepth( int value )
+      { setInt( FIX::FIELD::MarketDepth, value ); }
+      void setMDUpdateType( int value )
+      { setInt( FIX::FIELD::MDUpdateType, value ); }
+      void setAggregatedBook( bool value )
+      { setBool( FIX::FIELD::AggregatedBook, value ); }
+      void setOpenCloseSettlFlag( const FIX::StringView& value )
+      { setString( FIX::FIELD::OpenCloseSettlFlag, value ); }
+      void setScope( const FIX::StringView& value )
+      { setString( FIX::FIELD::Scope, value ); }
+      void setMDImplicitDelete( bool value )
+      { setBool( FIX::FIELD::MDImplicitDelete, value ); }
+      void setNoMDEntryTypes( int value )
+      { setInt( FIX::FIELD::NoMDEntryTypes, value ); }
+      void setNoRelatedSym( int value )
+      { setInt( FIX::FIELD::NoRelatedSym, value ); }
+      void setNoTradingSessions( int value )
+      { setInt( FIX::FIELD::NoTradingSessions, value ); }
+      void setApplQueueAction( int value )
+      { setInt( FIX::FIELD::ApplQueueAction, value ); }
+      void setApplQueueMax( int value )
+      { setInt( FIX::FIELD::ApplQueueMax, value ); }
+    };
   };
 
 }
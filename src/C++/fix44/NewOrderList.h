@@ -69,8 +69,30 @@ namespace FIX44
         NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
           FIELD_SET(*this, FIX::PartySubID);
           FIELD_SET(*this, FIX::PartySubIDType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::PartySubID);
+            FIELD_VIEW(*m_pMap, FIX::PartySubIDType);
+          };
+        };
+        FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+        { return FIX::GroupView<NoPartySubIDs::View>( *this, FIX::FIELD::NoPartySubIDs ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::PartyID);
+          FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::PartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NoPartySubIDs);
+          FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+          { return FIX::GroupView<NoPartySubIDs::View>( *m_pMap, FIX::FIELD::NoPartySubIDs ); }
         };
       };
+      FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+      { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
       FIELD_SET(*this, FIX::TradeOriginationDate);
       FIELD_SET(*this, FIX::TradeDate);
       FIELD_SET(*this, FIX::Account);
@@ -104,10 +126,47 @@ namespace FIX44
           NoNestedPartySubIDs() : FIX::Group(804,545,FIX::message_order(545,805,0)) {}
             FIELD_SET(*this, FIX::NestedPartySubID);
             FIELD_SET(*this, FIX::NestedPartySubIDType);
+            class View : public FIX::GroupEntry
+            {
+            public:
+            View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+              FIELD_VIEW(*m_pMap, FIX::NestedPartySubID);
+              FIELD_VIEW(*m_pMap, FIX::NestedPartySubIDType);
+            };
+          };
+          FIX::GroupView<NoNestedPartySubIDs::View> noNestedPartySubIDs() const
+          { return FIX::GroupView<NoNestedPartySubIDs::View>( *this, FIX::FIELD::NoNestedPartySubIDs ); }
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::NestedPartyID);
+            FIELD_VIEW(*m_pMap, FIX::NestedPartyIDSource);
+            FIELD_VIEW(*m_pMap, FIX::NestedPartyRole);
+            FIELD_VIEW(*m_pMap, FIX::NoNestedPartySubIDs);
+            FIX::GroupView<NoNestedPartySubIDs::View> noNestedPartySubIDs() const
+            { return FIX::GroupView<NoNestedPartySubIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartySubIDs ); }
           };
         };
+        FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+        { return FIX::GroupView<NoNestedPartyIDs::View>( *this, FIX::FIELD::NoNestedPartyIDs ); }
         FIELD_SET(*this, FIX::AllocQty);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::AllocAccount);
+          FIELD_VIEW(*m_pMap, FIX::AllocAcctIDSource);
+          FIELD_VIEW(*m_pMap, FIX::AllocSettlCurrency);
+          FIELD_VIEW(*m_pMap, FIX::IndividualAllocID);
+          FIELD_VIEW(*m_pMap, FIX::NoNestedPartyIDs);
+          FIELD_VIEW(*m_pMap, FIX::AllocQty);
+          FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+          { return FIX::GroupView<NoNestedPartyIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartyIDs ); }
+        };
       };
+      FIX::GroupView<NoAllocs::View> noAllocs() const
+      { return FIX::GroupView<NoAllocs::View>( *this, FIX::FIELD::NoAllocs ); }
       FIELD_SET(*this, FIX::SettlType);
       FIELD_SET(*this, FIX::SettlDate);
       FIELD_SET(*this, FIX::CashMargin);
@@ -124,7 +183,16 @@ namespace FIX44
       NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,0)) {}
         FIELD_SET(*this, FIX::TradingSessionID);
         FIELD_SET(*this, FIX::TradingSessionSubID);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+          FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+        };
       };
+      FIX::GroupView<NoTradingSessions::View> noTradingSessions() const
+      { return FIX::GroupView<NoTradingSessions::View>( *this, FIX::FIELD::NoTradingSessions ); }
       FIELD_SET(*this, FIX::ProcessCode);
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
@@ -137,7 +205,16 @@ namespace FIX44
       NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+      { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
       FIELD_SET(*this, FIX::Product);
       FIELD_SET(*this, FIX::CFICode);
       FIELD_SET(*this, FIX::SecurityType);
@@ -182,7 +259,18 @@ namespace FIX44
         FIELD_SET(*this, FIX::EventDate);
         FIELD_SET(*this, FIX::EventPx);
         FIELD_SET(*this, FIX::EventText);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::EventType);
+          FIELD_VIEW(*m_pMap, FIX::EventDate);
+          FIELD_VIEW(*m_pMap, FIX::EventPx);
+          FIELD_VIEW(*m_pMap, FIX::EventText);
+        };
       };
+      FIX::GroupView<NoEvents::View> noEvents() const
+      { return FIX::GroupView<NoEvents::View>( *this, FIX::FIELD::NoEvents ); }
       FIELD_SET(*this, FIX::DatedDate);
       FIELD_SET(*this, FIX::InterestAccrualDate);
       FIELD_SET(*this, FIX::NoUnderlyings);
@@ -201,7 +289,16 @@ namespace FIX44
         NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
           FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
           FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltID);
+            FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltIDSource);
+          };
         };
+        FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+        { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *this, FIX::FIELD::NoUnderlyingSecurityAltID ); }
         FIELD_SET(*this, FIX::UnderlyingProduct);
         FIELD_SET(*this, FIX::UnderlyingCFICode);
         FIELD_SET(*this, FIX::UnderlyingSecurityType);
@@ -250,8 +347,75 @@ namespace FIX44
         NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
           FIELD_SET(*this, FIX::UnderlyingStipType);
           FIELD_SET(*this, FIX::UnderlyingStipValue);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::UnderlyingStipType);
+            FIELD_VIEW(*m_pMap, FIX::UnderlyingStipValue);
+          };
+        };
+        FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+        { return FIX::GroupView<NoUnderlyingStips::View>( *this, FIX::FIELD::NoUnderlyingStips ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbol);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbolSfx);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityID);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NoUnderlyingSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingProduct);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCFICode);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecuritySubType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityMonthYear);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityDate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingPutOrCall);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponPaymentDate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingIssueDate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingRepoCollateralSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseTerm);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseRate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingFactor);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCreditRating);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrRegistry);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCountryOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStateOrProvinceOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingLocaleOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingRedemptionDate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikePrice);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikeCurrency);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingOptAttribute);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingContractMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponRate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityExchange);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingIssuer);
+          FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuerLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuer);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDescLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCPProgram);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCPRegType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrency);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingQty);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingPx);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingDirtyPrice);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingEndPrice);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStartValue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrentValue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingEndValue);
+          FIELD_VIEW(*m_pMap, FIX::NoUnderlyingStips);
+          FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+          { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *m_pMap, FIX::FIELD::NoUnderlyingSecurityAltID ); }
+          FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+          { return FIX::GroupView<NoUnderlyingStips::View>( *m_pMap, FIX::FIELD::NoUnderlyingStips ); }
         };
       };
+      FIX::GroupView<NoUnderlyings::View> noUnderlyings() const
+      { return FIX::GroupView<NoUnderlyings::View>( *this, FIX::FIELD::NoUnderlyings ); }
       FIELD_SET(*this, FIX::PrevClosePx);
       FIELD_SET(*this, FIX::Side);
       FIELD_SET(*this, FIX::SideValueInd);
@@ -264,7 +428,16 @@ namespace FIX44
       NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
         FIELD_SET(*this, FIX::StipulationType);
         FIELD_SET(*this, FIX::StipulationValue);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::StipulationType);
+          FIELD_VIEW(*m_pMap, FIX::StipulationValue);
+        };
       };
+      FIX::GroupView<NoStipulations::View> noStipulations() const
+      { return FIX::GroupView<NoStipulations::View>( *this, FIX::FIELD::NoStipulations ); }
       FIELD_SET(*this, FIX::QtyType);
       FIELD_SET(*this, FIX::OrderQty);
       FIELD_SET(*this, FIX::CashOrderQty);
@@ -335,6 +508,264 @@ namespace FIX44
       FIELD_SET(*this, FIX::TargetStrategyParameters);
       FIELD_SET(*this, FIX::ParticipationRate);
       FIELD_SET(*this, FIX::Designation);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::ListSeqNo);
+        FIELD_VIEW(*m_pMap, FIX::ClOrdLinkID);
+        FIELD_VIEW(*m_pMap, FIX::SettlInstMode);
+        FIELD_VIEW(*m_pMap, FIX::NoPartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::TradeOriginationDate);
+        FIELD_VIEW(*m_pMap, FIX::TradeDate);
+        FIELD_VIEW(*m_pMap, FIX::Account);
+        FIELD_VIEW(*m_pMap, FIX::AcctIDSource);
+        FIELD_VIEW(*m_pMap, FIX::AccountType);
+        FIELD_VIEW(*m_pMap, FIX::DayBookingInst);
+        FIELD_VIEW(*m_pMap, FIX::BookingUnit);
+        FIELD_VIEW(*m_pMap, FIX::AllocID);
+        FIELD_VIEW(*m_pMap, FIX::PreallocMethod);
+        FIELD_VIEW(*m_pMap, FIX::NoAllocs);
+        FIELD_VIEW(*m_pMap, FIX::SettlType);
+        FIELD_VIEW(*m_pMap, FIX::SettlDate);
+        FIELD_VIEW(*m_pMap, FIX::CashMargin);
+        FIELD_VIEW(*m_pMap, FIX::ClearingFeeIndicator);
+        FIELD_VIEW(*m_pMap, FIX::HandlInst);
+        FIELD_VIEW(*m_pMap, FIX::ExecInst);
+        FIELD_VIEW(*m_pMap, FIX::MinQty);
+        FIELD_VIEW(*m_pMap, FIX::MaxFloor);
+        FIELD_VIEW(*m_pMap, FIX::ExDestination);
+        FIELD_VIEW(*m_pMap, FIX::NoTradingSessions);
+        FIELD_VIEW(*m_pMap, FIX::ProcessCode);
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::Product);
+        FIELD_VIEW(*m_pMap, FIX::CFICode);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::SecuritySubType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::IssueDate);
+        FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::Factor);
+        FIELD_VIEW(*m_pMap, FIX::CreditRating);
+        FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::StrikeCurrency);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::Pool);
+        FIELD_VIEW(*m_pMap, FIX::ContractSettlMonth);
+        FIELD_VIEW(*m_pMap, FIX::CPProgram);
+        FIELD_VIEW(*m_pMap, FIX::CPRegType);
+        FIELD_VIEW(*m_pMap, FIX::NoEvents);
+        FIELD_VIEW(*m_pMap, FIX::DatedDate);
+        FIELD_VIEW(*m_pMap, FIX::InterestAccrualDate);
+        FIELD_VIEW(*m_pMap, FIX::NoUnderlyings);
+        FIELD_VIEW(*m_pMap, FIX::PrevClosePx);
+        FIELD_VIEW(*m_pMap, FIX::Side);
+        FIELD_VIEW(*m_pMap, FIX::SideValueInd);
+        FIELD_VIEW(*m_pMap, FIX::LocateReqd);
+        FIELD_VIEW(*m_pMap, FIX::TransactTime);
+        FIELD_VIEW(*m_pMap, FIX::NoStipulations);
+        FIELD_VIEW(*m_pMap, FIX::QtyType);
+        FIELD_VIEW(*m_pMap, FIX::OrderQty);
+        FIELD_VIEW(*m_pMap, FIX::CashOrderQty);
+        FIELD_VIEW(*m_pMap, FIX::OrderPercent);
+        FIELD_VIEW(*m_pMap, FIX::RoundingDirection);
+        FIELD_VIEW(*m_pMap, FIX::RoundingModulus);
+        FIELD_VIEW(*m_pMap, FIX::OrdType);
+        FIELD_VIEW(*m_pMap, FIX::PriceType);
+        FIELD_VIEW(*m_pMap, FIX::Price);
+        FIELD_VIEW(*m_pMap, FIX::StopPx);
+        FIELD_VIEW(*m_pMap, FIX::Spread);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkCurveCurrency);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkCurveName);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkCurvePoint);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkPrice);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkPriceType);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkSecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::YieldType);
+        FIELD_VIEW(*m_pMap, FIX::Yield);
+        FIELD_VIEW(*m_pMap, FIX::YieldCalcDate);
+        FIELD_VIEW(*m_pMap, FIX::YieldRedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::YieldRedemptionPrice);
+        FIELD_VIEW(*m_pMap, FIX::YieldRedemptionPriceType);
+        FIELD_VIEW(*m_pMap, FIX::Currency);
+        FIELD_VIEW(*m_pMap, FIX::ComplianceID);
+        FIELD_VIEW(*m_pMap, FIX::SolicitedFlag);
+        FIELD_VIEW(*m_pMap, FIX::IOIID);
+        FIELD_VIEW(*m_pMap, FIX::QuoteID);
+        FIELD_VIEW(*m_pMap, FIX::TimeInForce);
+        FIELD_VIEW(*m_pMap, FIX::EffectiveTime);
+        FIELD_VIEW(*m_pMap, FIX::ExpireDate);
+        FIELD_VIEW(*m_pMap, FIX::ExpireTime);
+        FIELD_VIEW(*m_pMap, FIX::GTBookingInst);
+        FIELD_VIEW(*m_pMap, FIX::Commission);
+        FIELD_VIEW(*m_pMap, FIX::CommType);
+        FIELD_VIEW(*m_pMap, FIX::CommCurrency);
+        FIELD_VIEW(*m_pMap, FIX::FundRenewWaiv);
+        FIELD_VIEW(*m_pMap, FIX::OrderCapacity);
+        FIELD_VIEW(*m_pMap, FIX::OrderRestrictions);
+        FIELD_VIEW(*m_pMap, FIX::CustOrderCapacity);
+        FIELD_VIEW(*m_pMap, FIX::ForexReq);
+        FIELD_VIEW(*m_pMap, FIX::SettlCurrency);
+        FIELD_VIEW(*m_pMap, FIX::BookingType);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+        FIELD_VIEW(*m_pMap, FIX::SettlDate2);
+        FIELD_VIEW(*m_pMap, FIX::OrderQty2);
+        FIELD_VIEW(*m_pMap, FIX::Price2);
+        FIELD_VIEW(*m_pMap, FIX::PositionEffect);
+        FIELD_VIEW(*m_pMap, FIX::CoveredOrUncovered);
+        FIELD_VIEW(*m_pMap, FIX::MaxShow);
+        FIELD_VIEW(*m_pMap, FIX::PegOffsetValue);
+        FIELD_VIEW(*m_pMap, FIX::PegMoveType);
+        FIELD_VIEW(*m_pMap, FIX::PegOffsetType);
+        FIELD_VIEW(*m_pMap, FIX::PegLimitType);
+        FIELD_VIEW(*m_pMap, FIX::PegRoundDirection);
+        FIELD_VIEW(*m_pMap, FIX::PegScope);
+        FIELD_VIEW(*m_pMap, FIX::DiscretionInst);
+        FIELD_VIEW(*m_pMap, FIX::DiscretionOffsetValue);
+        FIELD_VIEW(*m_pMap, FIX::DiscretionMoveType);
+        FIELD_VIEW(*m_pMap, FIX::DiscretionOffsetType);
+        FIELD_VIEW(*m_pMap, FIX::DiscretionLimitType);
+        FIELD_VIEW(*m_pMap, FIX::DiscretionRoundDirection);
+        FIELD_VIEW(*m_pMap, FIX::DiscretionScope);
+        FIELD_VIEW(*m_pMap, FIX::TargetStrategy);
+        FIELD_VIEW(*m_pMap, FIX::TargetStrategyParameters);
+        FIELD_VIEW(*m_pMap, FIX::ParticipationRate);
+        FIELD_VIEW(*m_pMap, FIX::Designation);
+        FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+        { return FIX::GroupView<NoPartyIDs::View>( *m_pMap, FIX::FIELD::NoPartyIDs ); }
+        FIX::GroupView<NoAllocs::View> noAllocs() const
+        { return FIX::GroupView<NoAllocs::View>( *m_pMap, FIX::FIELD::NoAllocs ); }
+        FIX::GroupView<NoTradingSessions::View> noTradingSessions() const
+        { return FIX::GroupView<NoTradingSessions::View>( *m_pMap, FIX::FIELD::NoTradingSessions ); }
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
+        FIX::GroupView<NoEvents::View> noEvents() const
+        { return FIX::GroupView<NoEvents::View>( *m_pMap, FIX::FIELD::NoEvents ); }
+        FIX::GroupView<NoUnderlyings::View> noUnderlyings() const
+        { return FIX::GroupView<NoUnderlyings::View>( *m_pMap, FIX::FIELD::NoUnderlyings ); }
+        FIX::GroupView<NoStipulations::View> noStipulations() const
+        { return FIX::GroupView<NoStipulations::View>( *m_pMap, FIX::FIELD::NoStipulations ); }
+      };
+    };
+    FIX::GroupView<NoOrders::View> noOrders() const
+    { return FIX::GroupView<NoOrders::View>( *this, FIX::FIELD::NoOrders ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView listID() const
+      { return getString( FIX::FIELD::ListID ); }
+      FIX::StringView bidID() const
+      { return getString( FIX::FIELD::BidID ); }
+      FIX::StringView clientBidID() const
+      { return getString( FIX::FIELD::ClientBidID ); }
+      int progRptReqs() const
+      { return getInt( FIX::FIELD::ProgRptReqs ); }
+      int bidType() const
+      { return getInt( FIX::FIELD::BidType ); }
+      int progPeriodInterval() const
+      { return getInt( FIX::FIELD::ProgPeriodInterval ); }
+      FIX::CancellationRights cancellationRights() const
+      { return FIX::CancellationRights( getChar( FIX::FIELD::CancellationRights ) ); }
+      FIX::MoneyLaunderingStatus moneyLaunderingStatus() const
+      { return FIX::MoneyLaunderingStatus( getChar( FIX::FIELD::MoneyLaunderingStatus ) ); }
+      FIX::StringView registID() const
+      { return getString( FIX::FIELD::RegistID ); }
+      FIX::ListExecInstType listExecInstType() const
+      { return FIX::ListExecInstType( getChar( FIX::FIELD::ListExecInstType ) ); }
+      FIX::StringView listExecInst() const
+      { return getString( FIX::FIELD::ListExecInst ); }
+      int encodedListExecInstLen() const
+      { return getInt( FIX::FIELD::EncodedListExecInstLen ); }
+      FIX::StringView encodedListExecInst() const
+      { return getString( FIX::FIELD::EncodedListExecInst ); }
+      FIX::Decimal allowableOneSidednessPct() const
+      { return getDecimal( FIX::FIELD::AllowableOneSidednessPct ); }
+      FIX::Decimal allowableOneSidednessValue() const
+      { return getDecimal( FIX::FIELD::AllowableOneSidednessValue ); }
+      FIX::StringView allowableOneSidednessCurr() const
+      { return getString( FIX::FIELD::AllowableOneSidednessCurr ); }
+      int totNoOrders() const
+      { return getInt( FIX::FIELD::TotNoOrders ); }
+      bool lastFragment() const
+      { return getBool( FIX::FIELD::LastFragment ); }
+      int noOrders() const
+      { return getInt( FIX::FIELD::NoOrders ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "E" ) {}
+      void setListID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListID, value ); }
+      void setBidID( const FIX::StringView& value )
+      { setString( FIX::FIELD::BidID, value ); }
+      void setClientBidID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClientBidID, value ); }
+      void setProgRptReqs( int value )
+      { setInt( FIX::FIELD::ProgRptReqs, value ); }
+      void setBidType( int value )
+      { setInt( FIX::FIELD::BidType, value ); }
+      void setProgPeriodInterval( int value )
+      { setInt( FIX::FIELD::ProgPeriodInterval, value ); }
+      void setCancellationRights( char value )
+      { setChar( FIX::FIELD::CancellationRights, value ); }
+      void setMoneyLaunderingStatus( char value )
+      { setChar( FIX::FIELD::MoneyLaunderingStatus, value ); }
+      void setRegistID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RegistID, value ); }
+      void setListExecInstType( char value )
+      { setChar( FIX::FIELD::ListExecInstType, value ); }
+      void setListExecInst( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListExecInst, value ); }
+      void setEncodedListExecInstLen( int value )
+      { setInt( FIX::FIELD::EncodedListExecInstLen, value ); }
+      void setEncodedListExecInst( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedListExecInst, value ); }
+      void setAllowableOneSidednessPct( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AllowableOneSidednessPct, value ); }
+      void setAllowableOneSidednessValue( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::AllowableOneSidednessValue, value ); }
+      void setAllowableOneSidednessCurr( const FIX::StringView& value )
+      { setString( FIX::FIELD::AllowableOneSidednessCurr, value ); }
+      void setTotNoOrders( int value )
+      { setInt( FIX::FIELD::TotNoOrders, value ); }
+      void setLastFragment( bool value )
+      { setBool( FIX::FIELD::LastFragment, value ); }
+      void setNoOrders( int value )
+      { setInt( FIX::FIELD::NoOrders, value ); }
     };
   };
 
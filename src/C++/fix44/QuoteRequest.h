@@ -42,7 +42,16 @@ namespace FIX44
       NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+      { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
       FIELD_SET(*this, FIX::Product);
       FIELD_SET(*this, FIX::CFICode);
       FIELD_SET(*this, FIX::SecurityType);
@@ -87,7 +96,18 @@ namespace FIX44
         FIELD_SET(*this, FIX::EventDate);
         FIELD_SET(*this, FIX::EventPx);
         FIELD_SET(*this, FIX::EventText);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::EventType);
+          FIELD_VIEW(*m_pMap, FIX::EventDate);
+          FIELD_VIEW(*m_pMap, FIX::EventPx);
+          FIELD_VIEW(*m_pMap, FIX::EventText);
+        };
       };
+      FIX::GroupView<NoEvents::View> noEvents() const
+      { return FIX::GroupView<NoEvents::View>( *this, FIX::FIELD::NoEvents ); }
       FIELD_SET(*this, FIX::DatedDate);
       FIELD_SET(*this, FIX::InterestAccrualDate);
       FIELD_SET(*this, FIX::AgreementDesc);
@@ -115,7 +135,16 @@ namespace FIX44
         NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
           FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
           FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltID);
+            FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltIDSource);
+          };
         };
+        FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+        { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *this, FIX::FIELD::NoUnderlyingSecurityAltID ); }
         FIELD_SET(*this, FIX::UnderlyingProduct);
         FIELD_SET(*this, FIX::UnderlyingCFICode);
         FIELD_SET(*this, FIX::UnderlyingSecurityType);
@@ -164,8 +193,75 @@ namespace FIX44
         NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
           FIELD_SET(*this, FIX::UnderlyingStipType);
           FIELD_SET(*this, FIX::UnderlyingStipValue);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::UnderlyingStipType);
+            FIELD_VIEW(*m_pMap, FIX::UnderlyingStipValue);
+          };
+        };
+        FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+        { return FIX::GroupView<NoUnderlyingStips::View>( *this, FIX::FIELD::NoUnderlyingStips ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbol);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbolSfx);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityID);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NoUnderlyingSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingProduct);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCFICode);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecuritySubType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityMonthYear);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityDate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingPutOrCall);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponPaymentDate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingIssueDate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingRepoCollateralSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseTerm);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseRate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingFactor);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCreditRating);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrRegistry);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCountryOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStateOrProvinceOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingLocaleOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingRedemptionDate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikePrice);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikeCurrency);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingOptAttribute);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingContractMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponRate);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityExchange);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingIssuer);
+          FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuerLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuer);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDescLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCPProgram);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCPRegType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrency);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingQty);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingPx);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingDirtyPrice);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingEndPrice);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStartValue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrentValue);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingEndValue);
+          FIELD_VIEW(*m_pMap, FIX::NoUnderlyingStips);
+          FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+          { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *m_pMap, FIX::FIELD::NoUnderlyingSecurityAltID ); }
+          FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+          { return FIX::GroupView<NoUnderlyingStips::View>( *m_pMap, FIX::FIELD::NoUnderlyingStips ); }
         };
       };
+      FIX::GroupView<NoUnderlyings::View> noUnderlyings() const
+      { return FIX::GroupView<NoUnderlyings::View>( *this, FIX::FIELD::NoUnderlyings ); }
       FIELD_SET(*this, FIX::PrevClosePx);
       FIELD_SET(*this, FIX::QuoteRequestType);
       FIELD_SET(*this, FIX::QuoteType);
@@ -191,7 +287,16 @@ namespace FIX44
       NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
         FIELD_SET(*this, FIX::StipulationType);
         FIELD_SET(*this, FIX::StipulationValue);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::StipulationType);
+          FIELD_VIEW(*m_pMap, FIX::StipulationValue);
+        };
       };
+      FIX::GroupView<NoStipulations::View> noStipulations() const
+      { return FIX::GroupView<NoStipulations::View>( *this, FIX::FIELD::NoStipulations ); }
       FIELD_SET(*this, FIX::Account);
       FIELD_SET(*this, FIX::AcctIDSource);
       FIELD_SET(*this, FIX::AccountType);
@@ -211,7 +316,16 @@ namespace FIX44
         NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
           FIELD_SET(*this, FIX::LegSecurityAltID);
           FIELD_SET(*this, FIX::LegSecurityAltIDSource);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityAltID);
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityAltIDSource);
+          };
         };
+        FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+        { return FIX::GroupView<NoLegSecurityAltID::View>( *this, FIX::FIELD::NoLegSecurityAltID ); }
         FIELD_SET(*this, FIX::LegProduct);
         FIELD_SET(*this, FIX::LegCFICode);
         FIELD_SET(*this, FIX::LegSecurityType);
@@ -260,7 +374,16 @@ namespace FIX44
         NoLegStipulations() : FIX::Group(683,688,FIX::message_order(688,689,0)) {}
           FIELD_SET(*this, FIX::LegStipulationType);
           FIELD_SET(*this, FIX::LegStipulationValue);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::LegStipulationType);
+            FIELD_VIEW(*m_pMap, FIX::LegStipulationValue);
+          };
         };
+        FIX::GroupView<NoLegStipulations::View> noLegStipulations() const
+        { return FIX::GroupView<NoLegStipulations::View>( *this, FIX::FIELD::NoLegStipulations ); }
         FIELD_SET(*this, FIX::NoNestedPartyIDs);
         class NoNestedPartyIDs: public FIX::Group
         {
@@ -276,21 +399,117 @@ namespace FIX44
           NoNestedPartySubIDs() : FIX::Group(804,545,FIX::message_order(545,805,0)) {}
             FIELD_SET(*this, FIX::NestedPartySubID);
             FIELD_SET(*this, FIX::NestedPartySubIDType);
+            class View : public FIX::GroupEntry
+            {
+            public:
+            View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+              FIELD_VIEW(*m_pMap, FIX::NestedPartySubID);
+              FIELD_VIEW(*m_pMap, FIX::NestedPartySubIDType);
+            };
+          };
+          FIX::GroupView<NoNestedPartySubIDs::View> noNestedPartySubIDs() const
+          { return FIX::GroupView<NoNestedPartySubIDs::View>( *this, FIX::FIELD::NoNestedPartySubIDs ); }
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::NestedPartyID);
+            FIELD_VIEW(*m_pMap, FIX::NestedPartyIDSource);
+            FIELD_VIEW(*m_pMap, FIX::NestedPartyRole);
+            FIELD_VIEW(*m_pMap, FIX::NoNestedPartySubIDs);
+            FIX::GroupView<NoNestedPartySubIDs::View> noNestedPartySubIDs() const
+            { return FIX::GroupView<NoNestedPartySubIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartySubIDs ); }
           };
         };
+        FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+        { return FIX::GroupView<NoNestedPartyIDs::View>( *this, FIX::FIELD::NoNestedPartyIDs ); }
         FIELD_SET(*this, FIX::LegBenchmarkCurveCurrency);
         FIELD_SET(*this, FIX::LegBenchmarkCurveName);
         FIELD_SET(*this, FIX::LegBenchmarkCurvePoint);
         FIELD_SET(*this, FIX::LegBenchmarkPrice);
         FIELD_SET(*this, FIX::LegBenchmarkPriceType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::LegSymbol);
+          FIELD_VIEW(*m_pMap, FIX::LegSymbolSfx);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityID);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NoLegSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::LegProduct);
+          FIELD_VIEW(*m_pMap, FIX::LegCFICode);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::LegSecuritySubType);
+          FIELD_VIEW(*m_pMap, FIX::LegMaturityMonthYear);
+          FIELD_VIEW(*m_pMap, FIX::LegMaturityDate);
+          FIELD_VIEW(*m_pMap, FIX::LegCouponPaymentDate);
+          FIELD_VIEW(*m_pMap, FIX::LegIssueDate);
+          FIELD_VIEW(*m_pMap, FIX::LegRepoCollateralSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::LegRepurchaseTerm);
+          FIELD_VIEW(*m_pMap, FIX::LegRepurchaseRate);
+          FIELD_VIEW(*m_pMap, FIX::LegFactor);
+          FIELD_VIEW(*m_pMap, FIX::LegCreditRating);
+          FIELD_VIEW(*m_pMap, FIX::LegInstrRegistry);
+          FIELD_VIEW(*m_pMap, FIX::LegCountryOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegStateOrProvinceOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegLocaleOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegRedemptionDate);
+          FIELD_VIEW(*m_pMap, FIX::LegStrikePrice);
+          FIELD_VIEW(*m_pMap, FIX::LegStrikeCurrency);
+          FIELD_VIEW(*m_pMap, FIX::LegOptAttribute);
+          FIELD_VIEW(*m_pMap, FIX::LegContractMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::LegCouponRate);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityExchange);
+          FIELD_VIEW(*m_pMap, FIX::LegIssuer);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuerLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuer);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDescLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::LegRatioQty);
+          FIELD_VIEW(*m_pMap, FIX::LegSide);
+          FIELD_VIEW(*m_pMap, FIX::LegCurrency);
+          FIELD_VIEW(*m_pMap, FIX::LegPool);
+          FIELD_VIEW(*m_pMap, FIX::LegDatedDate);
+          FIELD_VIEW(*m_pMap, FIX::LegContractSettlMonth);
+          FIELD_VIEW(*m_pMap, FIX::LegInterestAccrualDate);
+          FIELD_VIEW(*m_pMap, FIX::LegQty);
+          FIELD_VIEW(*m_pMap, FIX::LegSwapType);
+          FIELD_VIEW(*m_pMap, FIX::LegSettlType);
+          FIELD_VIEW(*m_pMap, FIX::LegSettlDate);
+          FIELD_VIEW(*m_pMap, FIX::NoLegStipulations);
+          FIELD_VIEW(*m_pMap, FIX::NoNestedPartyIDs);
+          FIELD_VIEW(*m_pMap, FIX::LegBenchmarkCurveCurrency);
+          FIELD_VIEW(*m_pMap, FIX::LegBenchmarkCurveName);
+          FIELD_VIEW(*m_pMap, FIX::LegBenchmarkCurvePoint);
+          FIELD_VIEW(*m_pMap, FIX::LegBenchmarkPrice);
+          FIELD_VIEW(*m_pMap, FIX::LegBenchmarkPriceType);
+          FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+          { return FIX::GroupView<NoLegSecurityAltID::View>( *m_pMap, FIX::FIELD::NoLegSecurityAltID ); }
+          FIX::GroupView<NoLegStipulations::View> noLegStipulations() const
+          { return FIX::GroupView<NoLegStipulations::View>( *m_pMap, FIX::FIELD::NoLegStipulations ); }
+          FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+          { return FIX::GroupView<NoNestedPartyIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartyIDs ); }
+        };
       };
+      FIX::GroupView<NoLegs::View> noLegs() const
+      { return FIX::GroupView<NoLegs::View>( *this, FIX::FIELD::NoLegs ); }
       FIELD_SET(*this, FIX::NoQuoteQualifiers);
       class NoQuoteQualifiers: public FIX::Group
       {
       public:
       NoQuoteQualifiers() : FIX::Group(735,695,FIX::message_order(695,0)) {}
         FIELD_SET(*this, FIX::QuoteQualifier);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::QuoteQualifier);
+        };
       };
+      FIX::GroupView<NoQuoteQualifiers::View> noQuoteQualifiers() const
+      { return FIX::GroupView<NoQuoteQualifiers::View>( *this, FIX::FIELD::NoQuoteQualifiers ); }
       FIELD_SET(*this, FIX::QuotePriceType);
       FIELD_SET(*this, FIX::OrdType);
       FIELD_SET(*this, FIX::ValidUntilTime);
@@ -328,12 +547,201 @@ namespace FIX44
         NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
           FIELD_SET(*this, FIX::PartySubID);
           FIELD_SET(*this, FIX::PartySubIDType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::PartySubID);
+            FIELD_VIEW(*m_pMap, FIX::PartySubIDType);
+          };
         };
+        FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+        { return FIX::GroupView<NoPartySubIDs::View>( *this, FIX::FIELD::NoPartySubIDs ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::PartyID);
+          FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::PartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NoPartySubIDs);
+          FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+          { return FIX::GroupView<NoPartySubIDs::View>( *m_pMap, FIX::FIELD::NoPartySubIDs ); }
+        };
+      };
+      FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+      { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::Product);
+        FIELD_VIEW(*m_pMap, FIX::CFICode);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::SecuritySubType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::IssueDate);
+        FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::Factor);
+        FIELD_VIEW(*m_pMap, FIX::CreditRating);
+        FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::StrikeCurrency);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::Pool);
+        FIELD_VIEW(*m_pMap, FIX::ContractSettlMonth);
+        FIELD_VIEW(*m_pMap, FIX::CPProgram);
+        FIELD_VIEW(*m_pMap, FIX::CPRegType);
+        FIELD_VIEW(*m_pMap, FIX::NoEvents);
+        FIELD_VIEW(*m_pMap, FIX::DatedDate);
+        FIELD_VIEW(*m_pMap, FIX::InterestAccrualDate);
+        FIELD_VIEW(*m_pMap, FIX::AgreementDesc);
+        FIELD_VIEW(*m_pMap, FIX::AgreementID);
+        FIELD_VIEW(*m_pMap, FIX::AgreementDate);
+        FIELD_VIEW(*m_pMap, FIX::AgreementCurrency);
+        FIELD_VIEW(*m_pMap, FIX::TerminationType);
+        FIELD_VIEW(*m_pMap, FIX::StartDate);
+        FIELD_VIEW(*m_pMap, FIX::EndDate);
+        FIELD_VIEW(*m_pMap, FIX::DeliveryType);
+        FIELD_VIEW(*m_pMap, FIX::MarginRatio);
+        FIELD_VIEW(*m_pMap, FIX::NoUnderlyings);
+        FIELD_VIEW(*m_pMap, FIX::PrevClosePx);
+        FIELD_VIEW(*m_pMap, FIX::QuoteRequestType);
+        FIELD_VIEW(*m_pMap, FIX::QuoteType);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+        FIELD_VIEW(*m_pMap, FIX::TradeOriginationDate);
+        FIELD_VIEW(*m_pMap, FIX::Side);
+        FIELD_VIEW(*m_pMap, FIX::QtyType);
+        FIELD_VIEW(*m_pMap, FIX::OrderQty);
+        FIELD_VIEW(*m_pMap, FIX::CashOrderQty);
+        FIELD_VIEW(*m_pMap, FIX::OrderPercent);
+        FIELD_VIEW(*m_pMap, FIX::RoundingDirection);
+        FIELD_VIEW(*m_pMap, FIX::RoundingModulus);
+        FIELD_VIEW(*m_pMap, FIX::SettlType);
+        FIELD_VIEW(*m_pMap, FIX::SettlDate);
+        FIELD_VIEW(*m_pMap, FIX::SettlDate2);
+        FIELD_VIEW(*m_pMap, FIX::OrderQty2);
+        FIELD_VIEW(*m_pMap, FIX::Currency);
+        FIELD_VIEW(*m_pMap, FIX::NoStipulations);
+        FIELD_VIEW(*m_pMap, FIX::Account);
+        FIELD_VIEW(*m_pMap, FIX::AcctIDSource);
+        FIELD_VIEW(*m_pMap, FIX::AccountType);
+        FIELD_VIEW(*m_pMap, FIX::NoLegs);
+        FIELD_VIEW(*m_pMap, FIX::NoQuoteQualifiers);
+        FIELD_VIEW(*m_pMap, FIX::QuotePriceType);
+        FIELD_VIEW(*m_pMap, FIX::OrdType);
+        FIELD_VIEW(*m_pMap, FIX::ValidUntilTime);
+        FIELD_VIEW(*m_pMap, FIX::ExpireTime);
+        FIELD_VIEW(*m_pMap, FIX::TransactTime);
+        FIELD_VIEW(*m_pMap, FIX::Spread);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkCurveCurrency);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkCurveName);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkCurvePoint);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkPrice);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkPriceType);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::BenchmarkSecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PriceType);
+        FIELD_VIEW(*m_pMap, FIX::Price);
+        FIELD_VIEW(*m_pMap, FIX::Price2);
+        FIELD_VIEW(*m_pMap, FIX::YieldType);
+        FIELD_VIEW(*m_pMap, FIX::Yield);
+        FIELD_VIEW(*m_pMap, FIX::YieldCalcDate);
+        FIELD_VIEW(*m_pMap, FIX::YieldRedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::YieldRedemptionPrice);
+        FIELD_VIEW(*m_pMap, FIX::YieldRedemptionPriceType);
+        FIELD_VIEW(*m_pMap, FIX::NoPartyIDs);
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
+        FIX::GroupView<NoEvents::View> noEvents() const
+        { return FIX::GroupView<NoEvents::View>( *m_pMap, FIX::FIELD::NoEvents ); }
+        FIX::GroupView<NoUnderlyings::View> noUnderlyings() const
+        { return FIX::GroupView<NoUnderlyings::View>( *m_pMap, FIX::FIELD::NoUnderlyings ); }
+        FIX::GroupView<NoStipulations::View> noStipulations() const
+        { return FIX::GroupView<NoStipulations::View>( *m_pMap, FIX::FIELD::NoStipulations ); }
+        FIX::GroupView<NoLegs::View> noLegs() const
+        { return FIX::GroupView<NoLegs::View>( *m_pMap, FIX::FIELD::NoLegs ); }
+        FIX::GroupView<NoQuoteQualifiers::View> noQuoteQualifiers() const
+        { return FIX::GroupView<NoQuoteQualifiers::View>( *m_pMap, FIX::FIELD::NoQuoteQualifiers ); }
+        FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+        { return FIX::GroupView<NoPartyIDs::View>( *m_pMap, FIX::FIELD::NoPartyIDs ); }
       };
     };
+    FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+    { return FIX::GroupView<NoRelatedSym::View>( *this, FIX::FIELD::NoRelatedSym ); }
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView quoteReqID() const
+      { return getString( FIX::FIELD::QuoteReqID ); }
+      FIX::StringView rFQReqID() const
+      { return getString( FIX::FIELD::RFQReqID ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      FIX::OrderCapacity orderCapacity() const
+      { return FIX::OrderCapacity( getChar( FIX::FIELD::OrderCapacity ) ); }
+      int noRelatedSym() const
+      { return getInt( FIX::FIELD::NoRelatedSym ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "R" ) {}
+      void setQuoteReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteReqID, value ); }
+      void setRFQReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RFQReqID, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setOrderCapacity( char value )
+      { setChar( FIX::FIELD::OrderCapacity, value ); }
+      void setNoRelatedSym( int value )
+      { setInt( FIX::FIELD::NoRelatedSym, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+    };
   };
 
 }
@@ -45,8 +45,30 @@ namespace FIX44
       NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::PartySubID);
+          FIELD_VIEW(*m_pMap, FIX::PartySubIDType);
+        };
+      };
+      FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+      { return FIX::GroupView<NoPartySubIDs::View>( *this, FIX::FIELD::NoPartySubIDs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PartyID);
+        FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PartyRole);
+        FIELD_VIEW(*m_pMap, FIX::NoPartySubIDs);
+        FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+        { return FIX::GroupView<NoPartySubIDs::View>( *m_pMap, FIX::FIELD::NoPartySubIDs ); }
       };
     };
+    FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+    { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
     FIELD_SET(*this, FIX::Account);
     FIELD_SET(*this, FIX::AcctIDSource);
     FIELD_SET(*this, FIX::RegistAcctType);
@@ -76,12 +98,51 @@ namespace FIX44
         NoNestedPartySubIDs() : FIX::Group(804,545,FIX::message_order(545,805,0)) {}
           FIELD_SET(*this, FIX::NestedPartySubID);
           FIELD_SET(*this, FIX::NestedPartySubIDType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::NestedPartySubID);
+            FIELD_VIEW(*m_pMap, FIX::NestedPartySubIDType);
+          };
+        };
+        FIX::GroupView<NoNestedPartySubIDs::View> noNestedPartySubIDs() const
+        { return FIX::GroupView<NoNestedPartySubIDs::View>( *this, FIX::FIELD::NoNestedPartySubIDs ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyID);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NestedPartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NoNestedPartySubIDs);
+          FIX::GroupView<NoNestedPartySubIDs::View> noNestedPartySubIDs() const
+          { return FIX::GroupView<NoNestedPartySubIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartySubIDs ); }
         };
       };
+      FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+      { return FIX::GroupView<NoNestedPartyIDs::View>( *this, FIX::FIELD::NoNestedPartyIDs ); }
       FIELD_SET(*this, FIX::OwnerType);
       FIELD_SET(*this, FIX::DateOfBirth);
       FIELD_SET(*this, FIX::InvestorCountryOfResidence);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::RegistDtls);
+        FIELD_VIEW(*m_pMap, FIX::RegistEmail);
+        FIELD_VIEW(*m_pMap, FIX::MailingDtls);
+        FIELD_VIEW(*m_pMap, FIX::MailingInst);
+        FIELD_VIEW(*m_pMap, FIX::NoNestedPartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::OwnerType);
+        FIELD_VIEW(*m_pMap, FIX::DateOfBirth);
+        FIELD_VIEW(*m_pMap, FIX::InvestorCountryOfResidence);
+        FIX::GroupView<NoNestedPartyIDs::View> noNestedPartyIDs() const
+        { return FIX::GroupView<NoNestedPartyIDs::View>( *m_pMap, FIX::FIELD::NoNestedPartyIDs ); }
+      };
     };
+    FIX::GroupView<NoRegistDtls::View> noRegistDtls() const
+    { return FIX::GroupView<NoRegistDtls::View>( *this, FIX::FIELD::NoRegistDtls ); }
     FIELD_SET(*this, FIX::NoDistribInsts);
     class NoDistribInsts: public FIX::Group
     {
@@ -95,6 +156,83 @@ namespace FIX44
       FIELD_SET(*this, FIX::CashDistribAgentAcctNumber);
       FIELD_SET(*this, FIX::CashDistribPayRef);
       FIELD_SET(*this, FIX::CashDistribAgentAcctName);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::DistribPaymentMethod);
+        FIELD_VIEW(*m_pMap, FIX::DistribPercentage);
+        FIELD_VIEW(*m_pMap, FIX::CashDistribCurr);
+        FIELD_VIEW(*m_pMap, FIX::CashDistribAgentName);
+        FIELD_VIEW(*m_pMap, FIX::CashDistribAgentCode);
+        FIELD_VIEW(*m_pMap, FIX::CashDistribAgentAcctNumber);
+        FIELD_VIEW(*m_pMap, FIX::CashDistribPayRef);
+        FIELD_VIEW(*m_pMap, FIX::CashDistribAgentAcctName);
+      };
+    };
+    FIX::GroupView<NoDistribInsts::View> noDistribInsts() const
+    { return FIX::GroupView<NoDistribInsts::View>( *this, FIX::FIELD::NoDistribInsts ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView registID() const
+      { return getString( FIX::FIELD::RegistID ); }
+      FIX::RegistTransType registTransType() const
+      { return FIX::RegistTransType( getChar( FIX::FIELD::RegistTransType ) ); }
+      FIX::StringView registRefID() const
+      { return getString( FIX::FIELD::RegistRefID ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      int noPartyIDs() const
+      { return getInt( FIX::FIELD::NoPartyIDs ); }
+      FIX::StringView account() const
+      { return getString( FIX::FIELD::Account ); }
+      int acctIDSource() const
+      { return getInt( FIX::FIELD::AcctIDSource ); }
+      FIX::StringView registAcctType() const
+      { return getString( FIX::FIELD::RegistAcctType ); }
+      int taxAdvantageType() const
+      { return getInt( FIX::FIELD::TaxAdvantageType ); }
+      FIX::OwnershipType ownershipType() const
+      { return FIX::OwnershipType( getChar( FIX::FIELD::OwnershipType ) ); }
+      int noRegistDtls() const
+      { return getInt( FIX::FIELD::NoRegistDtls ); }
+      int noDistribInsts() const
+      { return getInt( FIX::FIELD::NoDistribInsts ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "o" ) {}
+      void setRegistID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RegistID, value ); }
+      void setRegistTransType( char value )
+      { setChar( FIX::FIELD::RegistTransType, value ); }
+      void setRegistRefID( const FIX::StringView& value )
+      { setString( FIX::FIELD::RegistRefID, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setNoPartyIDs( int value )
+      { setInt( FIX::FIELD::NoPartyIDs, value ); }
+      void setAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::Account, value ); }
+      void setAcctIDSource( int value )
+      { setInt( FIX::FIELD::AcctIDSource, value ); }
+      void setRegistAcctType( const FIX::StringView& value )
+      { setString( FIX::FIELD::RegistAcctType, value ); }
+      void setTaxAdvantageType( int value )
+      { setInt( FIX::FIELD::TaxAdvantageType, value ); }
+      void setOwnershipType( char value )
+      { setChar( FIX::FIELD::OwnershipType, value ); }
+      void setNoRegistDtls( int value )
+      { setInt( FIX::FIELD::NoRegistDtls, value ); }
+      void setNoDistribInsts( int value )
+      { setInt( FIX::FIELD::NoDistribInsts, value ); }
     };
   };
 
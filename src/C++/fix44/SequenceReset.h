@@ -24,6 +24,28 @@ namespace FIX44
 
     FIELD_SET(*this, FIX::GapFillFlag);
     FIELD_SET(*this, FIX::NewSeqNo);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      bool gapFillFlag() const
+      { return getBool( FIX::FIELD::GapFillFlag ); }
+      int newSeqNo() const
+      { return getInt( FIX::FIELD::NewSeqNo ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "4" ) {}
+      void setGapFillFlag( bool value )
+      { setBool( FIX::FIELD::GapFillFlag, value ); }
+      void setNewSeqNo( int value )
+      { setInt( FIX::FIELD::NewSeqNo, value ); }
+    };
   };
 
 }
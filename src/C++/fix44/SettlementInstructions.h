@@ -58,8 +58,30 @@ namespace FIX44
         NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
           FIELD_SET(*this, FIX::PartySubID);
           FIELD_SET(*this, FIX::PartySubIDType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::PartySubID);
+            FIELD_VIEW(*m_pMap, FIX::PartySubIDType);
+          };
+        };
+        FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+        { return FIX::GroupView<NoPartySubIDs::View>( *this, FIX::FIELD::NoPartySubIDs ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::PartyID);
+          FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::PartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NoPartySubIDs);
+          FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+          { return FIX::GroupView<NoPartySubIDs::View>( *m_pMap, FIX::FIELD::NoPartySubIDs ); }
         };
       };
+      FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+      { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
       FIELD_SET(*this, FIX::Side);
       FIELD_SET(*this, FIX::Product);
       FIELD_SET(*this, FIX::SecurityType);
@@ -93,9 +115,43 @@ namespace FIX44
           NoSettlPartySubIDs() : FIX::Group(801,785,FIX::message_order(785,786,0)) {}
             FIELD_SET(*this, FIX::SettlPartySubID);
             FIELD_SET(*this, FIX::SettlPartySubIDType);
+            class View : public FIX::GroupEntry
+            {
+            public:
+            View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+              FIELD_VIEW(*m_pMap, FIX::SettlPartySubID);
+              FIELD_VIEW(*m_pMap, FIX::SettlPartySubIDType);
+            };
           };
+          FIX::GroupView<NoSettlPartySubIDs::View> noSettlPartySubIDs() const
+          { return FIX::GroupView<NoSettlPartySubIDs::View>( *this, FIX::FIELD::NoSettlPartySubIDs ); }
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::SettlPartyID);
+            FIELD_VIEW(*m_pMap, FIX::SettlPartyIDSource);
+            FIELD_VIEW(*m_pMap, FIX::SettlPartyRole);
+            FIELD_VIEW(*m_pMap, FIX::NoSettlPartySubIDs);
+            FIX::GroupView<NoSettlPartySubIDs::View> noSettlPartySubIDs() const
+            { return FIX::GroupView<NoSettlPartySubIDs::View>( *m_pMap, FIX::FIELD::NoSettlPartySubIDs ); }
+          };
+        };
+        FIX::GroupView<NoSettlPartyIDs::View> noSettlPartyIDs() const
+        { return FIX::GroupView<NoSettlPartyIDs::View>( *this, FIX::FIELD::NoSettlPartyIDs ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SettlInstSource);
+          FIELD_VIEW(*m_pMap, FIX::DlvyInstType);
+          FIELD_VIEW(*m_pMap, FIX::NoSettlPartyIDs);
+          FIX::GroupView<NoSettlPartyIDs::View> noSettlPartyIDs() const
+          { return FIX::GroupView<NoSettlPartyIDs::View>( *m_pMap, FIX::FIELD::NoSettlPartyIDs ); }
         };
       };
+      FIX::GroupView<NoDlvyInst::View> noDlvyInst() const
+      { return FIX::GroupView<NoDlvyInst::View>( *this, FIX::FIELD::NoDlvyInst ); }
       FIELD_SET(*this, FIX::PaymentMethod);
       FIELD_SET(*this, FIX::PaymentRef);
       FIELD_SET(*this, FIX::CardHolderName);
@@ -105,6 +161,98 @@ namespace FIX44
       FIELD_SET(*this, FIX::CardIssNum);
       FIELD_SET(*this, FIX::PaymentDate);
       FIELD_SET(*this, FIX::PaymentRemitterID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::SettlInstID);
+        FIELD_VIEW(*m_pMap, FIX::SettlInstTransType);
+        FIELD_VIEW(*m_pMap, FIX::SettlInstRefID);
+        FIELD_VIEW(*m_pMap, FIX::NoPartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::Side);
+        FIELD_VIEW(*m_pMap, FIX::Product);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::CFICode);
+        FIELD_VIEW(*m_pMap, FIX::EffectiveTime);
+        FIELD_VIEW(*m_pMap, FIX::ExpireTime);
+        FIELD_VIEW(*m_pMap, FIX::LastUpdateTime);
+        FIELD_VIEW(*m_pMap, FIX::SettlDeliveryType);
+        FIELD_VIEW(*m_pMap, FIX::StandInstDbType);
+        FIELD_VIEW(*m_pMap, FIX::StandInstDbName);
+        FIELD_VIEW(*m_pMap, FIX::StandInstDbID);
+        FIELD_VIEW(*m_pMap, FIX::NoDlvyInst);
+        FIELD_VIEW(*m_pMap, FIX::PaymentMethod);
+        FIELD_VIEW(*m_pMap, FIX::PaymentRef);
+        FIELD_VIEW(*m_pMap, FIX::CardHolderName);
+        FIELD_VIEW(*m_pMap, FIX::CardNumber);
+        FIELD_VIEW(*m_pMap, FIX::CardStartDate);
+        FIELD_VIEW(*m_pMap, FIX::CardExpDate);
+        FIELD_VIEW(*m_pMap, FIX::CardIssNum);
+        FIELD_VIEW(*m_pMap, FIX::PaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::PaymentRemitterID);
+        FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+        { return FIX::GroupView<NoPartyIDs::View>( *m_pMap, FIX::FIELD::NoPartyIDs ); }
+        FIX::GroupView<NoDlvyInst::View> noDlvyInst() const
+        { return FIX::GroupView<NoDlvyInst::View>( *m_pMap, FIX::FIELD::NoDlvyInst ); }
+      };
+    };
+    FIX::GroupView<NoSettlInst::View> noSettlInst() const
+    { return FIX::GroupView<NoSettlInst::View>( *this, FIX::FIELD::NoSettlInst ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView settlInstMsgID() const
+      { return getString( FIX::FIELD::SettlInstMsgID ); }
+      FIX::StringView settlInstReqID() const
+      { return getString( FIX::FIELD::SettlInstReqID ); }
+      FIX::SettlInstMode settlInstMode() const
+      { return FIX::SettlInstMode( getChar( FIX::FIELD::SettlInstMode ) ); }
+      int settlInstReqRejCode() const
+      { return getInt( FIX::FIELD::SettlInstReqRejCode ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      FIX::StringView clOrdID() const
+      { return getString( FIX::FIELD::ClOrdID ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      int noSettlInst() const
+      { return getInt( FIX::FIELD::NoSettlInst ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "T" ) {}
+      void setSettlInstMsgID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlInstMsgID, value ); }
+      void setSettlInstReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SettlInstReqID, value ); }
+      void setSettlInstMode( char value )
+      { setChar( FIX::FIELD::SettlInstMode, value ); }
+      void setSettlInstReqRejCode( int value )
+      { setInt( FIX::FIELD::SettlInstReqRejCode, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setClOrdID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClOrdID, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setNoSettlInst( int value )
+      { setInt( FIX::FIELD::NoSettlInst, value ); }
     };
   };
 
@@ -41,6 +41,98 @@ namespace FIX44
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView tradSesReqID() const
+      { return getString( FIX::FIELD::TradSesReqID ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::StringView tradingSessionSubID() const
+      { return getString( FIX::FIELD::TradingSessionSubID ); }
+      int tradSesMethod() const
+      { return getInt( FIX::FIELD::TradSesMethod ); }
+      int tradSesMode() const
+      { return getInt( FIX::FIELD::TradSesMode ); }
+      bool unsolicitedIndicator() const
+      { return getBool( FIX::FIELD::UnsolicitedIndicator ); }
+      int tradSesStatus() const
+      { return getInt( FIX::FIELD::TradSesStatus ); }
+      int tradSesStatusRejReason() const
+      { return getInt( FIX::FIELD::TradSesStatusRejReason ); }
+      FIX::StringView tradSesStartTime() const
+      { return getString( FIX::FIELD::TradSesStartTime ); }
+      FIX::StringView tradSesOpenTime() const
+      { return getString( FIX::FIELD::TradSesOpenTime ); }
+      FIX::StringView tradSesPreCloseTime() const
+      { return getString( FIX::FIELD::TradSesPreCloseTime ); }
+      FIX::StringView tradSesCloseTime() const
+      { return getString( FIX::FIELD::TradSesCloseTime ); }
+      FIX::StringView tradSesEndTime() const
+      { return getString( FIX::FIELD::TradSesEndTime ); }
+      FIX::Decimal totalVolumeTraded() const
+      { return getDecimal( FIX::FIELD::TotalVolumeTraded ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "h" ) {}
+      void setTradSesReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradSesReqID, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setTradingSessionSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionSubID, value ); }
+      void setTradSesMethod( int value )
+      { setInt( FIX::FIELD::TradSesMethod, value ); }
+      void setTradSesMode( int value )
+      { setInt( FIX::FIELD::TradSesMode, value ); }
+      void setUnsolicitedIndicator( bool value )
+      { setBool( FIX::FIELD::UnsolicitedIndicator, value ); }
+      void setTradSesStatus( int value )
+      { setInt( FIX::FIELD::TradSesStatus, value ); }
+      void setTradSesStatusRejReason( int value )
+      { setInt( FIX::FIELD::TradSesStatusRejReason, value ); }
+      void setTradSesStartTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradSesStartTime, value ); }
+      void setTradSesStartTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TradSesStartTime, value, precision ); }
+      void setTradSesOpenTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradSesOpenTime, value ); }
+      void setTradSesOpenTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TradSesOpenTime, value, precision ); }
+      void setTradSesPreCloseTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradSesPreCloseTime, value ); }
+      void setTradSesPreCloseTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TradSesPreCloseTime, value, precision ); }
+      void setTradSesCloseTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradSesCloseTime, value ); }
+      void setTradSesCloseTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TradSesCloseTime, value, precision ); }
+      void setTradSesEndTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradSesEndTime, value ); }
+      void setTradSesEndTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TradSesEndTime, value, precision ); }
+      void setTotalVolumeTraded( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::TotalVolumeTraded, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+    };
   };
 
 }
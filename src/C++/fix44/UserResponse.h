@@ -28,6 +28,36 @@ namespace FIX44
     FIELD_SET(*this, FIX::Username);
     FIELD_SET(*this, FIX::UserStatus);
     FIELD_SET(*this, FIX::UserStatusText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView userRequestID() const
+      { return getString( FIX::FIELD::UserRequestID ); }
+      FIX::StringView username() const
+      { return getString( FIX::FIELD::Username ); }
+      int userStatus() const
+      { return getInt( FIX::FIELD::UserStatus ); }
+      FIX::StringView userStatusText() const
+      { return getString( FIX::FIELD::UserStatusText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "BF" ) {}
+      void setUserRequestID( const FIX::StringView& value )
+      { setString( FIX::FIELD::UserRequestID, value ); }
+      void setUsername( const FIX::StringView& value )
+      { setString( FIX::FIELD::Username, value ); }
+      void setUserStatus( int value )
+      { setInt( FIX::FIELD::UserStatus, value ); }
+      void setUserStatusText( const FIX::StringView& value )
+      { setString( FIX::FIELD::UserStatusText, value ); }
+    };
   };
 
 }
@@ -60,6 +60,89 @@ namespace FIX50
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryClOrdID);
+        FIELD_VIEW(*m_pMap, FIX::CumQty);
+        FIELD_VIEW(*m_pMap, FIX::OrdStatus);
+        FIELD_VIEW(*m_pMap, FIX::WorkingIndicator);
+        FIELD_VIEW(*m_pMap, FIX::LeavesQty);
+        FIELD_VIEW(*m_pMap, FIX::CxlQty);
+        FIELD_VIEW(*m_pMap, FIX::AvgPx);
+        FIELD_VIEW(*m_pMap, FIX::OrdRejReason);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+      };
+    };
+    FIX::GroupView<NoOrders::View> noOrders() const
+    { return FIX::GroupView<NoOrders::View>( *this, FIX::FIELD::NoOrders ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView listID() const
+      { return getString( FIX::FIELD::ListID ); }
+      int listStatusType() const
+      { return getInt( FIX::FIELD::ListStatusType ); }
+      int noRpts() const
+      { return getInt( FIX::FIELD::NoRpts ); }
+      int listOrderStatus() const
+      { return getInt( FIX::FIELD::ListOrderStatus ); }
+      int rptSeq() const
+      { return getInt( FIX::FIELD::RptSeq ); }
+      FIX::StringView listStatusText() const
+      { return getString( FIX::FIELD::ListStatusText ); }
+      int encodedListStatusTextLen() const
+      { return getInt( FIX::FIELD::EncodedListStatusTextLen ); }
+      FIX::StringView encodedListStatusText() const
+      { return getString( FIX::FIELD::EncodedListStatusText ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      int totNoOrders() const
+      { return getInt( FIX::FIELD::TotNoOrders ); }
+      bool lastFragment() const
+      { return getBool( FIX::FIELD::LastFragment ); }
+      int noOrders() const
+      { return getInt( FIX::FIELD::NoOrders ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "N" ) {}
+      void setListID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListID, value ); }
+      void setListStatusType( int value )
+      { setInt( FIX::FIELD::ListStatusType, value ); }
+      void setNoRpts( int value )
+      { setInt( FIX::FIELD::NoRpts, value ); }
+      void setListOrderStatus( int value )
+      { setInt( FIX::FIELD::ListOrderStatus, value ); }
+      void setRptSeq( int value )
+      { setInt( FIX::FIELD::RptSeq, value ); }
+      void setListStatusText( const FIX::StringView& value )
+      { setString( FIX::FIELD::ListStatusText, value ); }
+      void setEncodedListStatusTextLen( int value )
+      { setInt( FIX::FIELD::EncodedListStatusTextLen, value ); }
+      void setEncodedListStatusText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedListStatusText, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setTotNoOrders( int value )
+      { setInt( FIX::FIELD::TotNoOrders, value ); }
+      void setLastFragment( bool value )
+      { setBool( FIX::FIELD::LastFragment, value ); }
+      void setNoOrders( int value )
+      { setInt( FIX::FIELD::NoOrders, value ); }
     };
   };
 
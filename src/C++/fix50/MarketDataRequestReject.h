@@ -30,10 +30,56 @@ namespace FIX50
     public:
     NoAltMDSource() : FIX::Group(816,817,FIX::message_order(817,0)) {}
       FIELD_SET(*this, FIX::AltMDSourceID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::AltMDSourceID);
+      };
     };
+    FIX::GroupView<NoAltMDSource::View> noAltMDSource() const
+    { return FIX::GroupView<NoAltMDSource::View>( *this, FIX::FIELD::NoAltMDSource ); }
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView mDReqID() const
+      { return getString( FIX::FIELD::MDReqID ); }
+      FIX::MDReqRejReason mDReqRejReason() const
+      { return FIX::MDReqRejReason( getChar( FIX::FIELD::MDReqRejReason ) ); }
+      int noAltMDSource() const
+      { return getInt( FIX::FIELD::NoAltMDSource ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "Y" ) {}
+      void setMDReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MDReqID, value ); }
+      void setMDReqRejReason( char value )
+      { setChar( FIX::FIELD::MDReqRejReason, value ); }
+      void setNoAltMDSource( int value )
+      { setInt( FIX::FIELD::NoAltMDSource, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+    };
   };
 
 }
@@ -41,8 +41,30 @@ namespace FIX50
       NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::PartySubID);
+          FIELD_VIEW(*m_pMap, FIX::PartySubIDType);
+        };
+      };
+      FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+      { return FIX::GroupView<NoPartySubIDs::View>( *this, FIX::FIELD::NoPartySubIDs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::PartyID);
+        FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::PartyRole);
+        FIELD_VIEW(*m_pMap, FIX::NoPartySubIDs);
+        FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+        { return FIX::GroupView<NoPartySubIDs::View>( *m_pMap, FIX::FIELD::NoPartySubIDs ); }
       };
     };
+    FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+    { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
     FIELD_SET(*this, FIX::Account);
     FIELD_SET(*this, FIX::AcctIDSource);
     FIELD_SET(*this, FIX::AccountType);
@@ -65,7 +87,16 @@ namespace FIX50
       NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
         FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
         FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+      { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *this, FIX::FIELD::NoUnderlyingSecurityAltID ); }
       FIELD_SET(*this, FIX::UnderlyingProduct);
       FIELD_SET(*this, FIX::UnderlyingCFICode);
       FIELD_SET(*this, FIX::UnderlyingSecurityType);
@@ -120,7 +151,16 @@ namespace FIX50
       NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
         FIELD_SET(*this, FIX::UnderlyingStipType);
         FIELD_SET(*this, FIX::UnderlyingStipValue);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStipType);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingStipValue);
+        };
       };
+      FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+      { return FIX::GroupView<NoUnderlyingStips::View>( *this, FIX::FIELD::NoUnderlyingStips ); }
       FIELD_SET(*this, FIX::UnderlyingAdjustedQuantity);
       FIELD_SET(*this, FIX::UnderlyingFXRate);
       FIELD_SET(*this, FIX::UnderlyingFXRateCalc);
@@ -140,8 +180,30 @@ namespace FIX50
         NoUndlyInstrumentPartySubIDs() : FIX::Group(1062,1063,FIX::message_order(1063,1064,0)) {}
           FIELD_SET(*this, FIX::UndlyInstrumentPartySubID);
           FIELD_SET(*this, FIX::UndlyInstrumentPartySubIDType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::UndlyInstrumentPartySubID);
+            FIELD_VIEW(*m_pMap, FIX::UndlyInstrumentPartySubIDType);
+          };
+        };
+        FIX::GroupView<NoUndlyInstrumentPartySubIDs::View> noUndlyInstrumentPartySubIDs() const
+        { return FIX::GroupView<NoUndlyInstrumentPartySubIDs::View>( *this, FIX::FIELD::NoUndlyInstrumentPartySubIDs ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UndlyInstrumentPartyID);
+          FIELD_VIEW(*m_pMap, FIX::UndlyInstrumentPartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::UndlyInstrumentPartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NoUndlyInstrumentPartySubIDs);
+          FIX::GroupView<NoUndlyInstrumentPartySubIDs::View> noUndlyInstrumentPartySubIDs() const
+          { return FIX::GroupView<NoUndlyInstrumentPartySubIDs::View>( *m_pMap, FIX::FIELD::NoUndlyInstrumentPartySubIDs ); }
         };
       };
+      FIX::GroupView<NoUndlyInstrumentParties::View> noUndlyInstrumentParties() const
+      { return FIX::GroupView<NoUndlyInstrumentParties::View>( *this, FIX::FIELD::NoUndlyInstrumentParties ); }
       FIELD_SET(*this, FIX::UnderlyingSettlMethod);
       FIELD_SET(*this, FIX::QuoteSetValidUntilTime);
       FIELD_SET(*this, FIX::TotNoQuoteEntries);
@@ -163,7 +225,16 @@ namespace FIX50
         NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
           FIELD_SET(*this, FIX::SecurityAltID);
           FIELD_SET(*this, FIX::SecurityAltIDSource);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+            FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+          };
         };
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
         FIELD_SET(*this, FIX::Product);
         FIELD_SET(*this, FIX::CFICode);
         FIELD_SET(*this, FIX::SecurityType);
@@ -219,7 +290,18 @@ namespace FIX50
           FIELD_SET(*this, FIX::EventDate);
           FIELD_SET(*this, FIX::EventPx);
           FIELD_SET(*this, FIX::EventText);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::EventType);
+            FIELD_VIEW(*m_pMap, FIX::EventDate);
+            FIELD_VIEW(*m_pMap, FIX::EventPx);
+            FIELD_VIEW(*m_pMap, FIX::EventText);
+          };
         };
+        FIX::GroupView<NoEvents::View> noEvents() const
+        { return FIX::GroupView<NoEvents::View>( *this, FIX::FIELD::NoEvents ); }
         FIELD_SET(*this, FIX::DatedDate);
         FIELD_SET(*this, FIX::InterestAccrualDate);
         FIELD_SET(*this, FIX::NoInstrumentParties);
@@ -237,8 +319,30 @@ namespace FIX50
           NoInstrumentPartySubIDs() : FIX::Group(1052,1053,FIX::message_order(1053,1054,0)) {}
             FIELD_SET(*this, FIX::InstrumentPartySubID);
             FIELD_SET(*this, FIX::InstrumentPartySubIDType);
+            class View : public FIX::GroupEntry
+            {
+            public:
+            View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+              FIELD_VIEW(*m_pMap, FIX::InstrumentPartySubID);
+              FIELD_VIEW(*m_pMap, FIX::InstrumentPartySubIDType);
+            };
+          };
+          FIX::GroupView<NoInstrumentPartySubIDs::View> noInstrumentPartySubIDs() const
+          { return FIX::GroupView<NoInstrumentPartySubIDs::View>( *this, FIX::FIELD::NoInstrumentPartySubIDs ); }
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::InstrumentPartyID);
+            FIELD_VIEW(*m_pMap, FIX::InstrumentPartyIDSource);
+            FIELD_VIEW(*m_pMap, FIX::InstrumentPartyRole);
+            FIELD_VIEW(*m_pMap, FIX::NoInstrumentPartySubIDs);
+            FIX::GroupView<NoInstrumentPartySubIDs::View> noInstrumentPartySubIDs() const
+            { return FIX::GroupView<NoInstrumentPartySubIDs::View>( *m_pMap, FIX::FIELD::NoInstrumentPartySubIDs ); }
           };
         };
+        FIX::GroupView<NoInstrumentParties::View> noInstrumentParties() const
+        { return FIX::GroupView<NoInstrumentParties::View>( *this, FIX::FIELD::NoInstrumentParties ); }
         FIELD_SET(*this, FIX::NoLegs);
         class NoLegs: public FIX::Group
         {
@@ -255,7 +359,16 @@ namespace FIX50
           NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
             FIELD_SET(*this, FIX::LegSecurityAltID);
             FIELD_SET(*this, FIX::LegSecurityAltIDSource);
+            class View : public FIX::GroupEntry
+            {
+            public:
+            View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+              FIELD_VIEW(*m_pMap, FIX::LegSecurityAltID);
+              FIELD_VIEW(*m_pMap, FIX::LegSecurityAltIDSource);
+            };
           };
+          FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+          { return FIX::GroupView<NoLegSecurityAltID::View>( *this, FIX::FIELD::NoLegSecurityAltID ); }
           FIELD_SET(*this, FIX::LegProduct);
           FIELD_SET(*this, FIX::LegCFICode);
           FIELD_SET(*this, FIX::LegSecurityType);
@@ -296,7 +409,61 @@ namespace FIX50
           FIELD_SET(*this, FIX::LegContractSettlMonth);
           FIELD_SET(*this, FIX::LegInterestAccrualDate);
           FIELD_SET(*this, FIX::LegOptionRatio);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::LegSymbol);
+            FIELD_VIEW(*m_pMap, FIX::LegSymbolSfx);
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityID);
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityIDSource);
+            FIELD_VIEW(*m_pMap, FIX::NoLegSecurityAltID);
+            FIELD_VIEW(*m_pMap, FIX::LegProduct);
+            FIELD_VIEW(*m_pMap, FIX::LegCFICode);
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityType);
+            FIELD_VIEW(*m_pMap, FIX::LegSecuritySubType);
+            FIELD_VIEW(*m_pMap, FIX::LegMaturityMonthYear);
+            FIELD_VIEW(*m_pMap, FIX::LegMaturityDate);
+            FIELD_VIEW(*m_pMap, FIX::LegCouponPaymentDate);
+            FIELD_VIEW(*m_pMap, FIX::LegIssueDate);
+            FIELD_VIEW(*m_pMap, FIX::LegRepoCollateralSecurityType);
+            FIELD_VIEW(*m_pMap, FIX::LegRepurchaseTerm);
+            FIELD_VIEW(*m_pMap, FIX::LegRepurchaseRate);
+            FIELD_VIEW(*m_pMap, FIX::LegFactor);
+            FIELD_VIEW(*m_pMap, FIX::LegCreditRating);
+            FIELD_VIEW(*m_pMap, FIX::LegInstrRegistry);
+            FIELD_VIEW(*m_pMap, FIX::LegCountryOfIssue);
+            FIELD_VIEW(*m_pMap, FIX::LegStateOrProvinceOfIssue);
+            FIELD_VIEW(*m_pMap, FIX::LegLocaleOfIssue);
+            FIELD_VIEW(*m_pMap, FIX::LegRedemptionDate);
+            FIELD_VIEW(*m_pMap, FIX::LegStrikePrice);
+            FIELD_VIEW(*m_pMap, FIX::LegStrikeCurrency);
+            FIELD_VIEW(*m_pMap, FIX::LegOptAttribute);
+            FIELD_VIEW(*m_pMap, FIX::LegContractMultiplier);
+            FIELD_VIEW(*m_pMap, FIX::LegUnitOfMeasure);
+            FIELD_VIEW(*m_pMap, FIX::LegTimeUnit);
+            FIELD_VIEW(*m_pMap, FIX::LegCouponRate);
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityExchange);
+            FIELD_VIEW(*m_pMap, FIX::LegIssuer);
+            FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuerLen);
+            FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuer);
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityDesc);
+            FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDescLen);
+            FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDesc);
+            FIELD_VIEW(*m_pMap, FIX::LegRatioQty);
+            FIELD_VIEW(*m_pMap, FIX::LegSide);
+            FIELD_VIEW(*m_pMap, FIX::LegCurrency);
+            FIELD_VIEW(*m_pMap, FIX::LegPool);
+            FIELD_VIEW(*m_pMap, FIX::LegDatedDate);
+            FIELD_VIEW(*m_pMap, FIX::LegContractSettlMonth);
+            FIELD_VIEW(*m_pMap, FIX::LegInterestAccrualDate);
+            FIELD_VIEW(*m_pMap, FIX::LegOptionRatio);
+            FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+            { return FIX::GroupView<NoLegSecurityAltID::View>( *m_pMap, FIX::FIELD::NoLegSecurityAltID ); }
+          };
         };
+        FIX::GroupView<NoLegs::View> noLegs() const
+        { return FIX::GroupView<NoLegs::View>( *this, FIX::FIELD::NoLegs ); }
         FIELD_SET(*this, FIX::BidPx);
         FIELD_SET(*this, FIX::OfferPx);
         FIELD_SET(*this, FIX::BidSize);
@@ -320,7 +487,239 @@ namespace FIX50
         FIELD_SET(*this, FIX::BidForwardPoints2);
         FIELD_SET(*this, FIX::OfferForwardPoints2);
         FIELD_SET(*this, FIX::Currency);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::QuoteEntryID);
+          FIELD_VIEW(*m_pMap, FIX::Symbol);
+          FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+          FIELD_VIEW(*m_pMap, FIX::SecurityID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::Product);
+          FIELD_VIEW(*m_pMap, FIX::CFICode);
+          FIELD_VIEW(*m_pMap, FIX::SecurityType);
+          FIELD_VIEW(*m_pMap, FIX::SecuritySubType);
+          FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+          FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+          FIELD_VIEW(*m_pMap, FIX::MaturityTime);
+          FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+          FIELD_VIEW(*m_pMap, FIX::SettleOnOpenFlag);
+          FIELD_VIEW(*m_pMap, FIX::InstrmtAssignmentMethod);
+          FIELD_VIEW(*m_pMap, FIX::SecurityStatus);
+          FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+          FIELD_VIEW(*m_pMap, FIX::IssueDate);
+          FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+          FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+          FIELD_VIEW(*m_pMap, FIX::Factor);
+          FIELD_VIEW(*m_pMap, FIX::CreditRating);
+          FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+          FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+          FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+          FIELD_VIEW(*m_pMap, FIX::StrikeCurrency);
+          FIELD_VIEW(*m_pMap, FIX::StrikeMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::StrikeValue);
+          FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+          FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::MinPriceIncrement);
+          FIELD_VIEW(*m_pMap, FIX::UnitOfMeasure);
+          FIELD_VIEW(*m_pMap, FIX::TimeUnit);
+          FIELD_VIEW(*m_pMap, FIX::CouponRate);
+          FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+          FIELD_VIEW(*m_pMap, FIX::PositionLimit);
+          FIELD_VIEW(*m_pMap, FIX::NTPositionLimit);
+          FIELD_VIEW(*m_pMap, FIX::Issuer);
+          FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+          FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::Pool);
+          FIELD_VIEW(*m_pMap, FIX::ContractSettlMonth);
+          FIELD_VIEW(*m_pMap, FIX::CPProgram);
+          FIELD_VIEW(*m_pMap, FIX::CPRegType);
+          FIELD_VIEW(*m_pMap, FIX::NoEvents);
+          FIELD_VIEW(*m_pMap, FIX::DatedDate);
+          FIELD_VIEW(*m_pMap, FIX::InterestAccrualDate);
+          FIELD_VIEW(*m_pMap, FIX::NoInstrumentParties);
+          FIELD_VIEW(*m_pMap, FIX::NoLegs);
+          FIELD_VIEW(*m_pMap, FIX::BidPx);
+          FIELD_VIEW(*m_pMap, FIX::OfferPx);
+          FIELD_VIEW(*m_pMap, FIX::BidSize);
+          FIELD_VIEW(*m_pMap, FIX::OfferSize);
+          FIELD_VIEW(*m_pMap, FIX::ValidUntilTime);
+          FIELD_VIEW(*m_pMap, FIX::BidSpotRate);
+          FIELD_VIEW(*m_pMap, FIX::OfferSpotRate);
+          FIELD_VIEW(*m_pMap, FIX::BidForwardPoints);
+          FIELD_VIEW(*m_pMap, FIX::OfferForwardPoints);
+          FIELD_VIEW(*m_pMap, FIX::MidPx);
+          FIELD_VIEW(*m_pMap, FIX::BidYield);
+          FIELD_VIEW(*m_pMap, FIX::MidYield);
+          FIELD_VIEW(*m_pMap, FIX::OfferYield);
+          FIELD_VIEW(*m_pMap, FIX::TransactTime);
+          FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+          FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+          FIELD_VIEW(*m_pMap, FIX::SettlDate);
+          FIELD_VIEW(*m_pMap, FIX::OrdType);
+          FIELD_VIEW(*m_pMap, FIX::SettlDate2);
+          FIELD_VIEW(*m_pMap, FIX::OrderQty2);
+          FIELD_VIEW(*m_pMap, FIX::BidForwardPoints2);
+          FIELD_VIEW(*m_pMap, FIX::OfferForwardPoints2);
+          FIELD_VIEW(*m_pMap, FIX::Currency);
+          FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+          { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
+          FIX::GroupView<NoEvents::View> noEvents() const
+          { return FIX::GroupView<NoEvents::View>( *m_pMap, FIX::FIELD::NoEvents ); }
+          FIX::GroupView<NoInstrumentParties::View> noInstrumentParties() const
+          { return FIX::GroupView<NoInstrumentParties::View>( *m_pMap, FIX::FIELD::NoInstrumentParties ); }
+          FIX::GroupView<NoLegs::View> noLegs() const
+          { return FIX::GroupView<NoLegs::View>( *m_pMap, FIX::FIELD::NoLegs ); }
+        };
       };
+      FIX::GroupView<NoQuoteEntries::View> noQuoteEntries() const
+      { return FIX::GroupView<NoQuoteEntries::View>( *this, FIX::FIELD::NoQuoteEntries ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::QuoteSetID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbol);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::NoUnderlyingSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingProduct);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCFICode);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecuritySubType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingMaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingPutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingIssueDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingFactor);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCreditRating);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingLocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingRedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStrikeCurrency);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingOptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingUnitOfMeasure);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingTimeUnit);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCouponRate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingIssuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingIssuer);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedUnderlyingSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCPProgram);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCPRegType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingAllocationPercent);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrency);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingQty);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSettlementType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCashAmount);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCashType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingPx);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingDirtyPrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingEndPrice);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStartValue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCurrentValue);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingEndValue);
+        FIELD_VIEW(*m_pMap, FIX::NoUnderlyingStips);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingAdjustedQuantity);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingFXRate);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingFXRateCalc);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingCapValue);
+        FIELD_VIEW(*m_pMap, FIX::NoUndlyInstrumentParties);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSettlMethod);
+        FIELD_VIEW(*m_pMap, FIX::QuoteSetValidUntilTime);
+        FIELD_VIEW(*m_pMap, FIX::TotNoQuoteEntries);
+        FIELD_VIEW(*m_pMap, FIX::LastFragment);
+        FIELD_VIEW(*m_pMap, FIX::NoQuoteEntries);
+        FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+        { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *m_pMap, FIX::FIELD::NoUnderlyingSecurityAltID ); }
+        FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+        { return FIX::GroupView<NoUnderlyingStips::View>( *m_pMap, FIX::FIELD::NoUnderlyingStips ); }
+        FIX::GroupView<NoUndlyInstrumentParties::View> noUndlyInstrumentParties() const
+        { return FIX::GroupView<NoUndlyInstrumentParties::View>( *m_pMap, FIX::FIELD::NoUndlyInstrumentParties ); }
+        FIX::GroupView<NoQuoteEntries::View> noQuoteEntries() const
+        { return FIX::GroupView<NoQuoteEntries::View>( *m_pMap, FIX::FIELD::NoQuoteEntries ); }
+      };
+    };
+    FIX::GroupView<NoQuoteSets::View> noQuoteSets() const
+    { return FIX::GroupView<NoQuoteSets::View>( *this, FIX::FIELD::NoQuoteSets ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView quoteReqID() const
+      { return getString( FIX::FIELD::QuoteReqID ); }
+      FIX::StringView quoteID() const
+      { return getString( FIX::FIELD::QuoteID ); }
+      int quoteType() const
+      { return getInt( FIX::FIELD::QuoteType ); }
+      int quoteResponseLevel() const
+      { return getInt( FIX::FIELD::QuoteResponseLevel ); }
+      int noPartyIDs() const
+      { return getInt( FIX::FIELD::NoPartyIDs ); }
+      FIX::StringView account() const
+      { return getString( FIX::FIELD::Account ); }
+      int acctIDSource() const
+      { return getInt( FIX::FIELD::AcctIDSource ); }
+      int accountType() const
+      { return getInt( FIX::FIELD::AccountType ); }
+      FIX::Decimal defBidSize() const
+      { return getDecimal( FIX::FIELD::DefBidSize ); }
+      FIX::Decimal defOfferSize() const
+      { return getDecimal( FIX::FIELD::DefOfferSize ); }
+      int noQuoteSets() const
+      { return getInt( FIX::FIELD::NoQuoteSets ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "i" ) {}
+      void setQuoteReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteReqID, value ); }
+      void setQuoteID( const FIX::StringView& value )
+      { setString( FIX::FIELD::QuoteID, value ); }
+      void setQuoteType( int value )
+      { setInt( FIX::FIELD::QuoteType, value ); }
+      void setQuoteResponseLevel( int value )
+      { setInt( FIX::FIELD::QuoteResponseLevel, value ); }
+      void setNoPartyIDs( int value )
+      { setInt( FIX::FIELD::NoPartyIDs, value ); }
+      void setAccount( const FIX::StringView& value )
+      { setString( FIX::FIELD::Account, value ); }
+      void setAcctIDSource( int value )
+      { setInt( FIX::FIELD::AcctIDSource, value ); }
+      void setAccountType( int value )
+      { setInt( FIX::FIELD::AccountType, value ); }
+      void setDefBidSize( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DefBidSize, value ); }
+      void setDefOfferSize( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DefOfferSize, value ); }
+      void setNoQuoteSets( int value )
+      { setInt( FIX::FIELD::NoQuoteSets, value ); }
     };
   };
 
@@ -38,6 +38,52 @@ namespace FIX50
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::TradSesMethod);
+        FIELD_VIEW(*m_pMap, FIX::TradSesMode);
+        FIELD_VIEW(*m_pMap, FIX::UnsolicitedIndicator);
+        FIELD_VIEW(*m_pMap, FIX::TradSesStatus);
+        FIELD_VIEW(*m_pMap, FIX::TradSesStatusRejReason);
+        FIELD_VIEW(*m_pMap, FIX::TradSesStartTime);
+        FIELD_VIEW(*m_pMap, FIX::TradSesOpenTime);
+        FIELD_VIEW(*m_pMap, FIX::TradSesPreCloseTime);
+        FIELD_VIEW(*m_pMap, FIX::TradSesCloseTime);
+        FIELD_VIEW(*m_pMap, FIX::TradSesEndTime);
+        FIELD_VIEW(*m_pMap, FIX::TotalVolumeTraded);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+      };
+    };
+    FIX::GroupView<NoTradingSessions::View> noTradingSessions() const
+    { return FIX::GroupView<NoTradingSessions::View>( *this, FIX::FIELD::NoTradingSessions ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView tradSesReqID() const
+      { return getString( FIX::FIELD::TradSesReqID ); }
+      int noTradingSessions() const
+      { return getInt( FIX::FIELD::NoTradingSessions ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "BJ" ) {}
+      void setTradSesReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradSesReqID, value ); }
+      void setNoTradingSessions( int value )
+      { setInt( FIX::FIELD::NoTradingSessions, value ); }
     };
   };
 
@@ -33,6 +33,48 @@ namespace FIX50
     FIELD_SET(*this, FIX::NewPassword);
     FIELD_SET(*this, FIX::RawDataLength);
     FIELD_SET(*this, FIX::RawData);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView userRequestID() const
+      { return getString( FIX::FIELD::UserRequestID ); }
+      int userRequestType() const
+      { return getInt( FIX::FIELD::UserRequestType ); }
+      FIX::StringView username() const
+      { return getString( FIX::FIELD::Username ); }
+      FIX::StringView password() const
+      { return getString( FIX::FIELD::Password ); }
+      FIX::StringView newPassword() const
+      { return getString( FIX::FIELD::NewPassword ); }
+      int rawDataLength() const
+      { return getInt( FIX::FIELD::RawDataLength ); }
+      FIX::StringView rawData() const
+      { return getString( FIX::FIELD::RawData ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "BE" ) {}
+      void setUserRequestID( const FIX::StringView& value )
+      { setString( FIX::FIELD::UserRequestID, value ); }
+      void setUserRequestType( int value )
+      { setInt( FIX::FIELD::UserRequestType, value ); }
+      void setUsername( const FIX::StringView& value )
+      { setString( FIX::FIELD::Username, value ); }
+      void setPassword( const FIX::StringView& value )
+      { setString( FIX::FIELD::Password, value ); }
+      void setNewPassword( const FIX::StringView& value )
+      { setString( FIX::FIELD::NewPassword, value ); }
+      void setRawDataLength( int value )
+      { setInt( FIX::FIELD::RawDataLength, value ); }
+      void setRawData( const FIX::StringView& value )
+      { setString( FIX::FIELD::RawData, value ); }
+    };
   };
 
 }
@@ -46,7 +46,18 @@ namespace FIX50SP1
       FIELD_SET(*this, FIX::EndTickPriceRange);
       FIELD_SET(*this, FIX::TickIncrement);
       FIELD_SET(*this, FIX::TickRuleType);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::StartTickPriceRange);
+        FIELD_VIEW(*m_pMap, FIX::EndTickPriceRange);
+        FIELD_VIEW(*m_pMap, FIX::TickIncrement);
+        FIELD_VIEW(*m_pMap, FIX::TickRuleType);
+      };
     };
+    FIX::GroupView<NoTickRules::View> noTickRules() const
+    { return FIX::GroupView<NoTickRules::View>( *this, FIX::FIELD::NoTickRules ); }
     FIELD_SET(*this, FIX::NoLotTypeRules);
     class NoLotTypeRules: public FIX::Group
     {
@@ -54,7 +65,16 @@ namespace FIX50SP1
     NoLotTypeRules() : FIX::Group(1234,1093,FIX::message_order(1093,1231,0)) {}
       FIELD_SET(*this, FIX::LotType);
       FIELD_SET(*this, FIX::MinLotSize);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::LotType);
+        FIELD_VIEW(*m_pMap, FIX::MinLotSize);
+      };
     };
+    FIX::GroupView<NoLotTypeRules::View> noLotTypeRules() const
+    { return FIX::GroupView<NoLotTypeRules::View>( *this, FIX::FIELD::NoLotTypeRules ); }
     FIELD_SET(*this, FIX::PriceLimitType);
     FIELD_SET(*this, FIX::LowLimitPrice);
     FIELD_SET(*this, FIX::HighLimitPrice);
@@ -75,25 +95,209 @@ namespace FIX50SP1
     public:
     NoOrdTypeRules() : FIX::Group(1237,40,FIX::message_order(40,0)) {}
       FIELD_SET(*this, FIX::OrdType);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::OrdType);
+      };
     };
+    FIX::GroupView<NoOrdTypeRules::View> noOrdTypeRules() const
+    { return FIX::GroupView<NoOrdTypeRules::View>( *this, FIX::FIELD::NoOrdTypeRules ); }
     FIELD_SET(*this, FIX::NoTimeInForceRules);
     class NoTimeInForceRules: public FIX::Group
     {
     public:
     NoTimeInForceRules() : FIX::Group(1239,59,FIX::message_order(59,0)) {}
       FIELD_SET(*this, FIX::TimeInForce);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::TimeInForce);
+      };
     };
+    FIX::GroupView<NoTimeInForceRules::View> noTimeInForceRules() const
+    { return FIX::GroupView<NoTimeInForceRules::View>( *this, FIX::FIELD::NoTimeInForceRules ); }
     FIELD_SET(*this, FIX::NoExecInstRules);
     class NoExecInstRules: public FIX::Group
     {
     public:
     NoExecInstRules() : FIX::Group(1232,1308,FIX::message_order(1308,0)) {}
       FIELD_SET(*this, FIX::ExecInstValue);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::ExecInstValue);
+      };
     };
+    FIX::GroupView<NoExecInstRules::View> noExecInstRules() const
+    { return FIX::GroupView<NoExecInstRules::View>( *this, FIX::FIELD::NoExecInstRules ); }
     FIELD_SET(*this, FIX::TransactTime);
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView applID() const
+      { return getString( FIX::FIELD::ApplID ); }
+      int applSeqNum() const
+      { return getInt( FIX::FIELD::ApplSeqNum ); }
+      int applLastSeqNum() const
+      { return getInt( FIX::FIELD::ApplLastSeqNum ); }
+      bool applResendFlag() const
+      { return getBool( FIX::FIELD::ApplResendFlag ); }
+      FIX::StringView marketReportID() const
+      { return getString( FIX::FIELD::MarketReportID ); }
+      FIX::StringView marketReqID() const
+      { return getString( FIX::FIELD::MarketReqID ); }
+      FIX::StringView marketID() const
+      { return getString( FIX::FIELD::MarketID ); }
+      FIX::StringView marketSegmentID() const
+      { return getString( FIX::FIELD::MarketSegmentID ); }
+      FIX::StringView marketSegmentDesc() const
+      { return getString( FIX::FIELD::MarketSegmentDesc ); }
+      int encodedMktSegmDescLen() const
+      { return getInt( FIX::FIELD::EncodedMktSegmDescLen ); }
+      FIX::StringView encodedMktSegmDesc() const
+      { return getString( FIX::FIELD::EncodedMktSegmDesc ); }
+      FIX::StringView parentMktSegmID() const
+      { return getString( FIX::FIELD::ParentMktSegmID ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      int noTickRules() const
+      { return getInt( FIX::FIELD::NoTickRules ); }
+      int noLotTypeRules() const
+      { return getInt( FIX::FIELD::NoLotTypeRules ); }
+      int priceLimitType() const
+      { return getInt( FIX::FIELD::PriceLimitType ); }
+      FIX::Decimal lowLimitPrice() const
+      { return getDecimal( FIX::FIELD::LowLimitPrice ); }
+      FIX::Decimal highLimitPrice() const
+      { return getDecimal( FIX::FIELD::HighLimitPrice ); }
+      FIX::Decimal tradingReferencePrice() const
+      { return getDecimal( FIX::FIELD::TradingReferencePrice ); }
+      int expirationCycle() const
+      { return getInt( FIX::FIELD::ExpirationCycle ); }
+      FIX::Decimal minTradeVol() const
+      { return getDecimal( FIX::FIELD::MinTradeVol ); }
+      FIX::Decimal maxTradeVol() const
+      { return getDecimal( FIX::FIELD::MaxTradeVol ); }
+      double maxPriceVariation() const
+      { return getDouble( FIX::FIELD::MaxPriceVariation ); }
+      int impliedMarketIndicator() const
+      { return getInt( FIX::FIELD::ImpliedMarketIndicator ); }
+      FIX::StringView tradingCurrency() const
+      { return getString( FIX::FIELD::TradingCurrency ); }
+      FIX::Decimal roundLot() const
+      { return getDecimal( FIX::FIELD::RoundLot ); }
+      int multilegModel() const
+      { return getInt( FIX::FIELD::MultilegModel ); }
+      int multilegPriceMethod() const
+      { return getInt( FIX::FIELD::MultilegPriceMethod ); }
+      int priceType() const
+      { return getInt( FIX::FIELD::PriceType ); }
+      int noOrdTypeRules() const
+      { return getInt( FIX::FIELD::NoOrdTypeRules ); }
+      int noTimeInForceRules() const
+      { return getInt( FIX::FIELD::NoTimeInForceRules ); }
+      int noExecInstRules() const
+      { return getInt( FIX::FIELD::NoExecInstRules ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "BU" ) {}
+      void setApplID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ApplID, value ); }
+      void setApplSeqNum( int value )
+      { setInt( FIX::FIELD::ApplSeqNum, value ); }
+      void setApplLastSeqNum( int value )
+      { setInt( FIX::FIELD::ApplLastSeqNum, value ); }
+      void setApplResendFlag( bool value )
+      { setBool( FIX::FIELD::ApplResendFlag, value ); }
+      void setMarketReportID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MarketReportID, value ); }
+      void setMarketReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MarketReqID, value ); }
+      void setMarketID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MarketID, value ); }
+      void setMarketSegmentID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MarketSegmentID, value ); }
+      void setMarketSegmentDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::MarketSegmentDesc, value ); }
+      void setEncodedMktSegmDescLen( int value )
+      { setInt( FIX::FIELD::EncodedMktSegmDescLen, value ); }
+      void setEncodedMktSegmDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedMktSegmDesc, value ); }
+      void setParentMktSegmID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ParentMktSegmID, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setNoTickRules( int value )
+      { setInt( FIX::FIELD::NoTickRules, value ); }
+      void setNoLotTypeRules( int value )
+      { setInt( FIX::FIELD::NoLotTypeRules, value ); }
+      void setPriceLimitType( int value )
+      { setInt( FIX::FIELD::PriceLimitType, value ); }
+      void setLowLimitPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::LowLimitPrice, value ); }
+      void setHighLimitPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::HighLimitPrice, value ); }
+      void setTradingReferencePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::TradingReferencePrice, value ); }
+      void setExpirationCycle( int value )
+      { setInt( FIX::FIELD::ExpirationCycle, value ); }
+      void setMinTradeVol( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MinTradeVol, value ); }
+      void setMaxTradeVol( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::MaxTradeVol, value ); }
+      void setMaxPriceVariation( double value )
+      { setDouble( FIX::FIELD::MaxPriceVariation, value ); }
+      void setImpliedMarketIndicator( int value )
+      { setInt( FIX::FIELD::ImpliedMarketIndicator, value ); }
+      void setTradingCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingCurrency, value ); }
+      void setRoundLot( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::RoundLot, value ); }
+      void setMultilegModel( int value )
+      { setInt( FIX::FIELD::MultilegModel, value ); }
+      void setMultilegPriceMethod( int value )
+      { setInt( FIX::FIELD::MultilegPriceMethod, value ); }
+      void setPriceType( int value )
+      { setInt( FIX::FIELD::PriceType, value ); }
+      void setNoOrdTypeRules( int value )
+      { setInt( FIX::FIELD::NoOrdTypeRules, value ); }
+      void setNoTimeInForceRules( int value )
+      { setInt( FIX::FIELD::NoTimeInForceRules, value ); }
+      void setNoExecInstRules( int value )
+      { setInt( FIX::FIELD::NoExecInstRules, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+    };
   };
 
 }
@@ -29,6 +29,40 @@ namespace FIX50SP1
     FIELD_SET(*this, FIX::MarketID);
     FIELD_SET(*this, FIX::MarketSegmentID);
     FIELD_SET(*this, FIX::ParentMktSegmID);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView marketReqID() const
+      { return getString( FIX::FIELD::MarketReqID ); }
+      FIX::SubscriptionRequestType subscriptionRequestType() const
+      { return FIX::SubscriptionRequestType( getChar( FIX::FIELD::SubscriptionRequestType ) ); }
+      FIX::StringView marketID() const
+      { return getString( FIX::FIELD::MarketID ); }
+      FIX::StringView marketSegmentID() const
+      { return getString( FIX::FIELD::MarketSegmentID ); }
+      FIX::StringView parentMktSegmID() const
+      { return getString( FIX::FIELD::ParentMktSegmID ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "BT" ) {}
+      void setMarketReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MarketReqID, value ); }
+      void setSubscriptionRequestType( char value )
+      { setChar( FIX::FIELD::SubscriptionRequestType, value ); }
+      void setMarketID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MarketID, value ); }
+      void setMarketSegmentID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MarketSegmentID, value ); }
+      void setParentMktSegmID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ParentMktSegmID, value ); }
+    };
   };
 
 }
@@ -35,6 +35,43 @@ namespace FIX50SP1
       FIELD_SET(*this, FIX::RefSubID);
       FIELD_SET(*this, FIX::LocationID);
       FIELD_SET(*this, FIX::DeskID);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::RefCompID);
+        FIELD_VIEW(*m_pMap, FIX::RefSubID);
+        FIELD_VIEW(*m_pMap, FIX::LocationID);
+        FIELD_VIEW(*m_pMap, FIX::DeskID);
+      };
+    };
+    FIX::GroupView<NoCompIDs::View> noCompIDs() const
+    { return FIX::GroupView<NoCompIDs::View>( *this, FIX::FIELD::NoCompIDs ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      int networkRequestType() const
+      { return getInt( FIX::FIELD::NetworkRequestType ); }
+      FIX::StringView networkRequestID() const
+      { return getString( FIX::FIELD::NetworkRequestID ); }
+      int noCompIDs() const
+      { return getInt( FIX::FIELD::NoCompIDs ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "BC" ) {}
+      void setNetworkRequestType( int value )
+      { setInt( FIX::FIELD::NetworkRequestType, value ); }
+      void setNetworkRequestID( const FIX::StringView& value )
+      { setString( FIX::FIELD::NetworkRequestID, value ); }
+      void setNoCompIDs( int value )
+      { setInt( FIX::FIELD::NoCompIDs, value ); }
     };
   };
 
@@ -28,11 +28,53 @@ namespace FIX50SP1
     public:
     NoUsernames() : FIX::Group(809,553,FIX::message_order(553,0)) {}
       FIELD_SET(*this, FIX::Username);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Username);
+      };
     };
+    FIX::GroupView<NoUsernames::View> noUsernames() const
+    { return FIX::GroupView<NoUsernames::View>( *this, FIX::FIELD::NoUsernames ); }
     FIELD_SET(*this, FIX::UserStatus);
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      int noUsernames() const
+      { return getInt( FIX::FIELD::NoUsernames ); }
+      int userStatus() const
+      { return getInt( FIX::FIELD::UserStatus ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "CB" ) {}
+      void setNoUsernames( int value )
+      { setInt( FIX::FIELD::NoUsernames, value ); }
+      void setUserStatus( int value )
+      { setInt( FIX::FIELD::UserStatus, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+    };
   };
 
 }
@@ -38,6 +38,68 @@ namespace FIX50SP1
     FIELD_SET(*this, FIX::EncryptedNewPassword);
     FIELD_SET(*this, FIX::RawDataLength);
     FIELD_SET(*this, FIX::RawData);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView userRequestID() const
+      { return getString( FIX::FIELD::UserRequestID ); }
+      int userRequestType() const
+      { return getInt( FIX::FIELD::UserRequestType ); }
+      FIX::StringView username() const
+      { return getString( FIX::FIELD::Username ); }
+      FIX::StringView password() const
+      { return getString( FIX::FIELD::Password ); }
+      FIX::StringView newPassword() const
+      { return getString( FIX::FIELD::NewPassword ); }
+      int encryptedPasswordMethod() const
+      { return getInt( FIX::FIELD::EncryptedPasswordMethod ); }
+      int encryptedPasswordLen() const
+      { return getInt( FIX::FIELD::EncryptedPasswordLen ); }
+      FIX::StringView encryptedPassword() const
+      { return getString( FIX::FIELD::EncryptedPassword ); }
+      int encryptedNewPasswordLen() const
+      { return getInt( FIX::FIELD::EncryptedNewPasswordLen ); }
+      FIX::StringView encryptedNewPassword() const
+      { return getString( FIX::FIELD::EncryptedNewPassword ); }
+      int rawDataLength() const
+      { return getInt( FIX::FIELD::RawDataLength ); }
+      FIX::StringView rawData() const
+      { return getString( FIX::FIELD::RawData ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "BE" ) {}
+      void setUserRequestID( const FIX::StringView& value )
+      { setString( FIX::FIELD::UserRequestID, value ); }
+      void setUserRequestType( int value )
+      { setInt( FIX::FIELD::UserRequestType, value ); }
+      void setUsername( const FIX::StringView& value )
+      { setString( FIX::FIELD::Username, value ); }
+      void setPassword( const FIX::StringView& value )
+      { setString( FIX::FIELD::Password, value ); }
+      void setNewPassword( const FIX::StringView& value )
+      { setString( FIX::FIELD::NewPassword, value ); }
+      void setEncryptedPasswordMethod( int value )
+      { setInt( FIX::FIELD::EncryptedPasswordMethod, value ); }
+      void setEncryptedPasswordLen( int value )
+      { setInt( FIX::FIELD::EncryptedPasswordLen, value ); }
+      void setEncryptedPassword( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncryptedPassword, value ); }
+      void setEncryptedNewPasswordLen( int value )
+      { setInt( FIX::FIELD::EncryptedNewPasswordLen, value ); }
+      void setEncryptedNewPassword( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncryptedNewPassword, value ); }
+      void setRawDataLength( int value )
+      { setInt( FIX::FIELD::RawDataLength, value ); }
+      void setRawData( const FIX::StringView& value )
+      { setString( FIX::FIELD::RawData, value ); }
+    };
   };
 
 }
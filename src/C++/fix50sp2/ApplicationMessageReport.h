@@ -34,11 +34,63 @@ namespace FIX50SP2
       FIELD_SET(*this, FIX::RefApplID);
       FIELD_SET(*this, FIX::ApplNewSeqNum);
       FIELD_SET(*this, FIX::RefApplLastSeqNum);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::RefApplID);
+        FIELD_VIEW(*m_pMap, FIX::ApplNewSeqNum);
+        FIELD_VIEW(*m_pMap, FIX::RefApplLastSeqNum);
+      };
     };
+    FIX::GroupView<NoApplIDs::View> noApplIDs() const
+    { return FIX::GroupView<NoApplIDs::View>( *this, FIX::FIELD::NoApplIDs ); }
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
     FIELD_SET(*this, FIX::ApplReqID);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView applReportID() const
+      { return getString( FIX::FIELD::ApplReportID ); }
+      int applReportType() const
+      { return getInt( FIX::FIELD::ApplReportType ); }
+      int noApplIDs() const
+      { return getInt( FIX::FIELD::NoApplIDs ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      FIX::StringView applReqID() const
+      { return getString( FIX::FIELD::ApplReqID ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "BY" ) {}
+      void setApplReportID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ApplReportID, value ); }
+      void setApplReportType( int value )
+      { setInt( FIX::FIELD::ApplReportType, value ); }
+      void setNoApplIDs( int value )
+      { setInt( FIX::FIELD::NoApplIDs, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setApplReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ApplReqID, value ); }
+    };
   };
 
 }
@@ -33,7 +33,16 @@ namespace FIX50SP2
     NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
       FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
       FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+    { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *this, FIX::FIELD::NoUnderlyingSecurityAltID ); }
     FIELD_SET(*this, FIX::UnderlyingProduct);
     FIELD_SET(*this, FIX::UnderlyingCFICode);
     FIELD_SET(*this, FIX::UnderlyingSecurityType);
@@ -92,7 +101,16 @@ namespace FIX50SP2
     NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
       FIELD_SET(*this, FIX::UnderlyingStipType);
       FIELD_SET(*this, FIX::UnderlyingStipValue);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStipType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStipValue);
+      };
     };
+    FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+    { return FIX::GroupView<NoUnderlyingStips::View>( *this, FIX::FIELD::NoUnderlyingStips ); }
     FIELD_SET(*this, FIX::UnderlyingAdjustedQuantity);
     FIELD_SET(*this, FIX::UnderlyingFXRate);
     FIELD_SET(*this, FIX::UnderlyingFXRateCalc);
@@ -112,8 +130,30 @@ namespace FIX50SP2
       NoUndlyInstrumentPartySubIDs() : FIX::Group(1062,1063,FIX::message_order(1063,1064,0)) {}
         FIELD_SET(*this, FIX::UnderlyingInstrumentPartySubID);
         FIELD_SET(*this, FIX::UnderlyingInstrumentPartySubIDType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrumentPartySubID);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrumentPartySubIDType);
+        };
+      };
+      FIX::GroupView<NoUndlyInstrumentPartySubIDs::View> noUndlyInstrumentPartySubIDs() const
+      { return FIX::GroupView<NoUndlyInstrumentPartySubIDs::View>( *this, FIX::FIELD::NoUndlyInstrumentPartySubIDs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrumentPartyID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrumentPartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrumentPartyRole);
+        FIELD_VIEW(*m_pMap, FIX::NoUndlyInstrumentPartySubIDs);
+        FIX::GroupView<NoUndlyInstrumentPartySubIDs::View> noUndlyInstrumentPartySubIDs() const
+        { return FIX::GroupView<NoUndlyInstrumentPartySubIDs::View>( *m_pMap, FIX::FIELD::NoUndlyInstrumentPartySubIDs ); }
       };
     };
+    FIX::GroupView<NoUndlyInstrumentParties::View> noUndlyInstrumentParties() const
+    { return FIX::GroupView<NoUndlyInstrumentParties::View>( *this, FIX::FIELD::NoUndlyInstrumentParties ); }
     FIELD_SET(*this, FIX::UnderlyingSettlMethod);
     FIELD_SET(*this, FIX::UnderlyingPutOrCall);
     FIELD_SET(*this, FIX::UnderlyingContractMultiplierUnit);
@@ -135,7 +175,16 @@ namespace FIX50SP2
     NoDerivativeSecurityAltID() : FIX::Group(1218,1219,FIX::message_order(1219,1220,0)) {}
       FIELD_SET(*this, FIX::DerivativeSecurityAltID);
       FIELD_SET(*this, FIX::DerivativeSecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::DerivativeSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeSecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoDerivativeSecurityAltID::View> noDerivativeSecurityAltID() const
+    { return FIX::GroupView<NoDerivativeSecurityAltID::View>( *this, FIX::FIELD::NoDerivativeSecurityAltID ); }
     FIELD_SET(*this, FIX::DerivativeProduct);
     FIELD_SET(*this, FIX::DerivativeProductComplex);
     FIELD_SET(*this, FIX::DerivFlexProductEligibilityIndicator);
@@ -199,7 +248,19 @@ namespace FIX50SP2
       FIELD_SET(*this, FIX::DerivativeEventTime);
       FIELD_SET(*this, FIX::DerivativeEventPx);
       FIELD_SET(*this, FIX::DerivativeEventText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::DerivativeEventType);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeEventDate);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeEventTime);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeEventPx);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeEventText);
+      };
     };
+    FIX::GroupView<NoDerivativeEvents::View> noDerivativeEvents() const
+    { return FIX::GroupView<NoDerivativeEvents::View>( *this, FIX::FIELD::NoDerivativeEvents ); }
     FIELD_SET(*this, FIX::NoDerivativeInstrumentParties);
     class NoDerivativeInstrumentParties: public FIX::Group
     {
@@ -215,8 +276,30 @@ namespace FIX50SP2
       NoDerivativeInstrumentPartySubIDs() : FIX::Group(1296,1297,FIX::message_order(1297,1298,0)) {}
         FIELD_SET(*this, FIX::DerivativeInstrumentPartySubID);
         FIELD_SET(*this, FIX::DerivativeInstrumentPartySubIDType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::DerivativeInstrumentPartySubID);
+          FIELD_VIEW(*m_pMap, FIX::DerivativeInstrumentPartySubIDType);
+        };
+      };
+      FIX::GroupView<NoDerivativeInstrumentPartySubIDs::View> noDerivativeInstrumentPartySubIDs() const
+      { return FIX::GroupView<NoDerivativeInstrumentPartySubIDs::View>( *this, FIX::FIELD::NoDerivativeInstrumentPartySubIDs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::DerivativeInstrumentPartyID);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeInstrumentPartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeInstrumentPartyRole);
+        FIELD_VIEW(*m_pMap, FIX::NoDerivativeInstrumentPartySubIDs);
+        FIX::GroupView<NoDerivativeInstrumentPartySubIDs::View> noDerivativeInstrumentPartySubIDs() const
+        { return FIX::GroupView<NoDerivativeInstrumentPartySubIDs::View>( *m_pMap, FIX::FIELD::NoDerivativeInstrumentPartySubIDs ); }
       };
     };
+    FIX::GroupView<NoDerivativeInstrumentParties::View> noDerivativeInstrumentParties() const
+    { return FIX::GroupView<NoDerivativeInstrumentParties::View>( *this, FIX::FIELD::NoDerivativeInstrumentParties ); }
     FIELD_SET(*this, FIX::DerivativeContractMultiplierUnit);
     FIELD_SET(*this, FIX::DerivativeFlowScheduleType);
     FIELD_SET(*this, FIX::NoDerivativeInstrAttrib);
@@ -226,7 +309,16 @@ namespace FIX50SP2
     NoDerivativeInstrAttrib() : FIX::Group(1311,1313,FIX::message_order(1313,1314,0)) {}
       FIELD_SET(*this, FIX::DerivativeInstrAttribType);
       FIELD_SET(*this, FIX::DerivativeInstrAttribValue);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::DerivativeInstrAttribType);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeInstrAttribValue);
+      };
     };
+    FIX::GroupView<NoDerivativeInstrAttrib::View> noDerivativeInstrAttrib() const
+    { return FIX::GroupView<NoDerivativeInstrAttrib::View>( *this, FIX::FIELD::NoDerivativeInstrAttrib ); }
     FIELD_SET(*this, FIX::NoMarketSegments);
     class NoMarketSegments: public FIX::Group
     {
@@ -243,7 +335,18 @@ namespace FIX50SP2
         FIELD_SET(*this, FIX::EndTickPriceRange);
         FIELD_SET(*this, FIX::TickIncrement);
         FIELD_SET(*this, FIX::TickRuleType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::StartTickPriceRange);
+          FIELD_VIEW(*m_pMap, FIX::EndTickPriceRange);
+          FIELD_VIEW(*m_pMap, FIX::TickIncrement);
+          FIELD_VIEW(*m_pMap, FIX::TickRuleType);
+        };
       };
+      FIX::GroupView<NoTickRules::View> noTickRules() const
+      { return FIX::GroupView<NoTickRules::View>( *this, FIX::FIELD::NoTickRules ); }
       FIELD_SET(*this, FIX::NoLotTypeRules);
       class NoLotTypeRules: public FIX::Group
       {
@@ -251,7 +354,16 @@ namespace FIX50SP2
       NoLotTypeRules() : FIX::Group(1234,1093,FIX::message_order(1093,1231,0)) {}
         FIELD_SET(*this, FIX::LotType);
         FIELD_SET(*this, FIX::MinLotSize);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::LotType);
+          FIELD_VIEW(*m_pMap, FIX::MinLotSize);
+        };
       };
+      FIX::GroupView<NoLotTypeRules::View> noLotTypeRules() const
+      { return FIX::GroupView<NoLotTypeRules::View>( *this, FIX::FIELD::NoLotTypeRules ); }
       FIELD_SET(*this, FIX::PriceLimitType);
       FIELD_SET(*this, FIX::LowLimitPrice);
       FIELD_SET(*this, FIX::HighLimitPrice);
@@ -279,21 +391,45 @@ namespace FIX50SP2
         public:
         NoOrdTypeRules() : FIX::Group(1237,40,FIX::message_order(40,0)) {}
           FIELD_SET(*this, FIX::OrdType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::OrdType);
+          };
         };
+        FIX::GroupView<NoOrdTypeRules::View> noOrdTypeRules() const
+        { return FIX::GroupView<NoOrdTypeRules::View>( *this, FIX::FIELD::NoOrdTypeRules ); }
         FIELD_SET(*this, FIX::NoTimeInForceRules);
         class NoTimeInForceRules: public FIX::Group
         {
         public:
         NoTimeInForceRules() : FIX::Group(1239,59,FIX::message_order(59,0)) {}
           FIELD_SET(*this, FIX::TimeInForce);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::TimeInForce);
+          };
         };
+        FIX::GroupView<NoTimeInForceRules::View> noTimeInForceRules() const
+        { return FIX::GroupView<NoTimeInForceRules::View>( *this, FIX::FIELD::NoTimeInForceRules ); }
         FIELD_SET(*this, FIX::NoExecInstRules);
         class NoExecInstRules: public FIX::Group
         {
         public:
         NoExecInstRules() : FIX::Group(1232,1308,FIX::message_order(1308,0)) {}
           FIELD_SET(*this, FIX::ExecInstValue);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::ExecInstValue);
+          };
         };
+        FIX::GroupView<NoExecInstRules::View> noExecInstRules() const
+        { return FIX::GroupView<NoExecInstRules::View>( *this, FIX::FIELD::NoExecInstRules ); }
         FIELD_SET(*this, FIX::NoMatchRules);
         class NoMatchRules: public FIX::Group
         {
@@ -301,7 +437,16 @@ namespace FIX50SP2
         NoMatchRules() : FIX::Group(1235,1142,FIX::message_order(1142,574,0)) {}
           FIELD_SET(*this, FIX::MatchAlgorithm);
           FIELD_SET(*this, FIX::MatchType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::MatchAlgorithm);
+            FIELD_VIEW(*m_pMap, FIX::MatchType);
+          };
         };
+        FIX::GroupView<NoMatchRules::View> noMatchRules() const
+        { return FIX::GroupView<NoMatchRules::View>( *this, FIX::FIELD::NoMatchRules ); }
         FIELD_SET(*this, FIX::NoMDFeedTypes);
         class NoMDFeedTypes: public FIX::Group
         {
@@ -310,8 +455,42 @@ namespace FIX50SP2
           FIELD_SET(*this, FIX::MDFeedType);
           FIELD_SET(*this, FIX::MarketDepth);
           FIELD_SET(*this, FIX::MDBookType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::MDFeedType);
+            FIELD_VIEW(*m_pMap, FIX::MarketDepth);
+            FIELD_VIEW(*m_pMap, FIX::MDBookType);
+          };
+        };
+        FIX::GroupView<NoMDFeedTypes::View> noMDFeedTypes() const
+        { return FIX::GroupView<NoMDFeedTypes::View>( *this, FIX::FIELD::NoMDFeedTypes ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+          FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+          FIELD_VIEW(*m_pMap, FIX::NoOrdTypeRules);
+          FIELD_VIEW(*m_pMap, FIX::NoTimeInForceRules);
+          FIELD_VIEW(*m_pMap, FIX::NoExecInstRules);
+          FIELD_VIEW(*m_pMap, FIX::NoMatchRules);
+          FIELD_VIEW(*m_pMap, FIX::NoMDFeedTypes);
+          FIX::GroupView<NoOrdTypeRules::View> noOrdTypeRules() const
+          { return FIX::GroupView<NoOrdTypeRules::View>( *m_pMap, FIX::FIELD::NoOrdTypeRules ); }
+          FIX::GroupView<NoTimeInForceRules::View> noTimeInForceRules() const
+          { return FIX::GroupView<NoTimeInForceRules::View>( *m_pMap, FIX::FIELD::NoTimeInForceRules ); }
+          FIX::GroupView<NoExecInstRules::View> noExecInstRules() const
+          { return FIX::GroupView<NoExecInstRules::View>( *m_pMap, FIX::FIELD::NoExecInstRules ); }
+          FIX::GroupView<NoMatchRules::View> noMatchRules() const
+          { return FIX::GroupView<NoMatchRules::View>( *m_pMap, FIX::FIELD::NoMatchRules ); }
+          FIX::GroupView<NoMDFeedTypes::View> noMDFeedTypes() const
+          { return FIX::GroupView<NoMDFeedTypes::View>( *m_pMap, FIX::FIELD::NoMDFeedTypes ); }
         };
       };
+      FIX::GroupView<NoTradingSessionRules::View> noTradingSessionRules() const
+      { return FIX::GroupView<NoTradingSessionRules::View>( *this, FIX::FIELD::NoTradingSessionRules ); }
       FIELD_SET(*this, FIX::NoNestedInstrAttrib);
       class NoNestedInstrAttrib: public FIX::Group
       {
@@ -319,7 +498,16 @@ namespace FIX50SP2
       NoNestedInstrAttrib() : FIX::Group(1312,1210,FIX::message_order(1210,1211,0)) {}
         FIELD_SET(*this, FIX::NestedInstrAttribType);
         FIELD_SET(*this, FIX::NestedInstrAttribValue);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::NestedInstrAttribType);
+          FIELD_VIEW(*m_pMap, FIX::NestedInstrAttribValue);
+        };
       };
+      FIX::GroupView<NoNestedInstrAttrib::View> noNestedInstrAttrib() const
+      { return FIX::GroupView<NoNestedInstrAttrib::View>( *this, FIX::FIELD::NoNestedInstrAttrib ); }
       FIELD_SET(*this, FIX::NoStrikeRules);
       class NoStrikeRules: public FIX::Group
       {
@@ -341,9 +529,75 @@ namespace FIX50SP2
           FIELD_SET(*this, FIX::StartMaturityMonthYear);
           FIELD_SET(*this, FIX::EndMaturityMonthYear);
           FIELD_SET(*this, FIX::MaturityMonthYearIncrement);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::MaturityRuleID);
+            FIELD_VIEW(*m_pMap, FIX::MaturityMonthYearFormat);
+            FIELD_VIEW(*m_pMap, FIX::MaturityMonthYearIncrementUnits);
+            FIELD_VIEW(*m_pMap, FIX::StartMaturityMonthYear);
+            FIELD_VIEW(*m_pMap, FIX::EndMaturityMonthYear);
+            FIELD_VIEW(*m_pMap, FIX::MaturityMonthYearIncrement);
+          };
         };
+        FIX::GroupView<NoMaturityRules::View> noMaturityRules() const
+        { return FIX::GroupView<NoMaturityRules::View>( *this, FIX::FIELD::NoMaturityRules ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::StrikeRuleID);
+          FIELD_VIEW(*m_pMap, FIX::StartStrikePxRange);
+          FIELD_VIEW(*m_pMap, FIX::EndStrikePxRange);
+          FIELD_VIEW(*m_pMap, FIX::StrikeIncrement);
+          FIELD_VIEW(*m_pMap, FIX::StrikeExerciseStyle);
+          FIELD_VIEW(*m_pMap, FIX::NoMaturityRules);
+          FIX::GroupView<NoMaturityRules::View> noMaturityRules() const
+          { return FIX::GroupView<NoMaturityRules::View>( *m_pMap, FIX::FIELD::NoMaturityRules ); }
+        };
+      };
+      FIX::GroupView<NoStrikeRules::View> noStrikeRules() const
+      { return FIX::GroupView<NoStrikeRules::View>( *this, FIX::FIELD::NoStrikeRules ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::MarketID);
+        FIELD_VIEW(*m_pMap, FIX::MarketSegmentID);
+        FIELD_VIEW(*m_pMap, FIX::NoTickRules);
+        FIELD_VIEW(*m_pMap, FIX::NoLotTypeRules);
+        FIELD_VIEW(*m_pMap, FIX::PriceLimitType);
+        FIELD_VIEW(*m_pMap, FIX::LowLimitPrice);
+        FIELD_VIEW(*m_pMap, FIX::HighLimitPrice);
+        FIELD_VIEW(*m_pMap, FIX::TradingReferencePrice);
+        FIELD_VIEW(*m_pMap, FIX::ExpirationCycle);
+        FIELD_VIEW(*m_pMap, FIX::MinTradeVol);
+        FIELD_VIEW(*m_pMap, FIX::MaxTradeVol);
+        FIELD_VIEW(*m_pMap, FIX::MaxPriceVariation);
+        FIELD_VIEW(*m_pMap, FIX::ImpliedMarketIndicator);
+        FIELD_VIEW(*m_pMap, FIX::TradingCurrency);
+        FIELD_VIEW(*m_pMap, FIX::RoundLot);
+        FIELD_VIEW(*m_pMap, FIX::MultilegModel);
+        FIELD_VIEW(*m_pMap, FIX::MultilegPriceMethod);
+        FIELD_VIEW(*m_pMap, FIX::PriceType);
+        FIELD_VIEW(*m_pMap, FIX::NoTradingSessionRules);
+        FIELD_VIEW(*m_pMap, FIX::NoNestedInstrAttrib);
+        FIELD_VIEW(*m_pMap, FIX::NoStrikeRules);
+        FIX::GroupView<NoTickRules::View> noTickRules() const
+        { return FIX::GroupView<NoTickRules::View>( *m_pMap, FIX::FIELD::NoTickRules ); }
+        FIX::GroupView<NoLotTypeRules::View> noLotTypeRules() const
+        { return FIX::GroupView<NoLotTypeRules::View>( *m_pMap, FIX::FIELD::NoLotTypeRules ); }
+        FIX::GroupView<NoTradingSessionRules::View> noTradingSessionRules() const
+        { return FIX::GroupView<NoTradingSessionRules::View>( *m_pMap, FIX::FIELD::NoTradingSessionRules ); }
+        FIX::GroupView<NoNestedInstrAttrib::View> noNestedInstrAttrib() const
+        { return FIX::GroupView<NoNestedInstrAttrib::View>( *m_pMap, FIX::FIELD::NoNestedInstrAttrib ); }
+        FIX::GroupView<NoStrikeRules::View> noStrikeRules() const
+        { return FIX::GroupView<NoStrikeRules::View>( *m_pMap, FIX::FIELD::NoStrikeRules ); }
       };
     };
+    FIX::GroupView<NoMarketSegments::View> noMarketSegments() const
+    { return FIX::GroupView<NoMarketSegments::View>( *this, FIX::FIELD::NoMarketSegments ); }
     FIELD_SET(*this, FIX::TotNoRelatedSym);
     FIELD_SET(*this, FIX::LastFragment);
     FIELD_SET(*this, FIX::NoRelatedSym);
@@ -362,7 +616,16 @@ namespace FIX50SP2
       NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+        };
       };
+      FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+      { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
       FIELD_SET(*this, FIX::Product);
       FIELD_SET(*this, FIX::ProductComplex);
       FIELD_SET(*this, FIX::SecurityGroup);
@@ -438,7 +701,19 @@ namespace FIX50SP2
         FIELD_SET(*this, FIX::EventTime);
         FIELD_SET(*this, FIX::EventPx);
         FIELD_SET(*this, FIX::EventText);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::EventType);
+          FIELD_VIEW(*m_pMap, FIX::EventDate);
+          FIELD_VIEW(*m_pMap, FIX::EventTime);
+          FIELD_VIEW(*m_pMap, FIX::EventPx);
+          FIELD_VIEW(*m_pMap, FIX::EventText);
+        };
       };
+      FIX::GroupView<NoEvents::View> noEvents() const
+      { return FIX::GroupView<NoEvents::View>( *this, FIX::FIELD::NoEvents ); }
       FIELD_SET(*this, FIX::DatedDate);
       FIELD_SET(*this, FIX::InterestAccrualDate);
       FIELD_SET(*this, FIX::NoInstrumentParties);
@@ -456,8 +731,30 @@ namespace FIX50SP2
         NoInstrumentPartySubIDs() : FIX::Group(1052,1053,FIX::message_order(1053,1054,0)) {}
           FIELD_SET(*this, FIX::InstrumentPartySubID);
           FIELD_SET(*this, FIX::InstrumentPartySubIDType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::InstrumentPartySubID);
+            FIELD_VIEW(*m_pMap, FIX::InstrumentPartySubIDType);
+          };
+        };
+        FIX::GroupView<NoInstrumentPartySubIDs::View> noInstrumentPartySubIDs() const
+        { return FIX::GroupView<NoInstrumentPartySubIDs::View>( *this, FIX::FIELD::NoInstrumentPartySubIDs ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::InstrumentPartyID);
+          FIELD_VIEW(*m_pMap, FIX::InstrumentPartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::InstrumentPartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NoInstrumentPartySubIDs);
+          FIX::GroupView<NoInstrumentPartySubIDs::View> noInstrumentPartySubIDs() const
+          { return FIX::GroupView<NoInstrumentPartySubIDs::View>( *m_pMap, FIX::FIELD::NoInstrumentPartySubIDs ); }
         };
       };
+      FIX::GroupView<NoInstrumentParties::View> noInstrumentParties() const
+      { return FIX::GroupView<NoInstrumentParties::View>( *this, FIX::FIELD::NoInstrumentParties ); }
       FIELD_SET(*this, FIX::ContractMultiplierUnit);
       FIELD_SET(*this, FIX::FlowScheduleType);
       FIELD_SET(*this, FIX::RestructuringType);
@@ -497,9 +794,47 @@ namespace FIX50SP2
           NoComplexEventTimes() : FIX::Group(1494,1495,FIX::message_order(1495,1496,0)) {}
             FIELD_SET(*this, FIX::ComplexEventStartTime);
             FIELD_SET(*this, FIX::ComplexEventEndTime);
+            class View : public FIX::GroupEntry
+            {
+            public:
+            View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+              FIELD_VIEW(*m_pMap, FIX::ComplexEventStartTime);
+              FIELD_VIEW(*m_pMap, FIX::ComplexEventEndTime);
+            };
+          };
+          FIX::GroupView<NoComplexEventTimes::View> noComplexEventTimes() const
+          { return FIX::GroupView<NoComplexEventTimes::View>( *this, FIX::FIELD::NoComplexEventTimes ); }
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::ComplexEventStartDate);
+            FIELD_VIEW(*m_pMap, FIX::ComplexEventEndDate);
+            FIELD_VIEW(*m_pMap, FIX::NoComplexEventTimes);
+            FIX::GroupView<NoComplexEventTimes::View> noComplexEventTimes() const
+            { return FIX::GroupView<NoComplexEventTimes::View>( *m_pMap, FIX::FIELD::NoComplexEventTimes ); }
           };
         };
+        FIX::GroupView<NoComplexEventDates::View> noComplexEventDates() const
+        { return FIX::GroupView<NoComplexEventDates::View>( *this, FIX::FIELD::NoComplexEventDates ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::ComplexEventType);
+          FIELD_VIEW(*m_pMap, FIX::ComplexOptPayoutAmount);
+          FIELD_VIEW(*m_pMap, FIX::ComplexEventPrice);
+          FIELD_VIEW(*m_pMap, FIX::ComplexEventPriceBoundaryMethod);
+          FIELD_VIEW(*m_pMap, FIX::ComplexEventPriceBoundaryPrecision);
+          FIELD_VIEW(*m_pMap, FIX::ComplexEventPriceTimeType);
+          FIELD_VIEW(*m_pMap, FIX::ComplexEventCondition);
+          FIELD_VIEW(*m_pMap, FIX::NoComplexEventDates);
+          FIX::GroupView<NoComplexEventDates::View> noComplexEventDates() const
+          { return FIX::GroupView<NoComplexEventDates::View>( *m_pMap, FIX::FIELD::NoComplexEventDates ); }
+        };
       };
+      FIX::GroupView<NoComplexEvents::View> noComplexEvents() const
+      { return FIX::GroupView<NoComplexEvents::View>( *this, FIX::FIELD::NoComplexEvents ); }
       FIELD_SET(*this, FIX::SecondaryPriceLimitType);
       FIELD_SET(*this, FIX::SecondaryLowLimitPrice);
       FIELD_SET(*this, FIX::SecondaryHighLimitPrice);
@@ -515,7 +850,16 @@ namespace FIX50SP2
       NoInstrAttrib() : FIX::Group(870,871,FIX::message_order(871,872,0)) {}
         FIELD_SET(*this, FIX::InstrAttribType);
         FIELD_SET(*this, FIX::InstrAttribValue);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::InstrAttribType);
+          FIELD_VIEW(*m_pMap, FIX::InstrAttribValue);
+        };
       };
+      FIX::GroupView<NoInstrAttrib::View> noInstrAttrib() const
+      { return FIX::GroupView<NoInstrAttrib::View>( *this, FIX::FIELD::NoInstrAttrib ); }
       FIELD_SET(*this, FIX::NoLegs);
       class NoLegs: public FIX::Group
       {
@@ -532,7 +876,16 @@ namespace FIX50SP2
         NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
           FIELD_SET(*this, FIX::LegSecurityAltID);
           FIELD_SET(*this, FIX::LegSecurityAltIDSource);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityAltID);
+            FIELD_VIEW(*m_pMap, FIX::LegSecurityAltIDSource);
+          };
         };
+        FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+        { return FIX::GroupView<NoLegSecurityAltID::View>( *this, FIX::FIELD::NoLegSecurityAltID ); }
         FIELD_SET(*this, FIX::LegProduct);
         FIELD_SET(*this, FIX::LegCFICode);
         FIELD_SET(*this, FIX::LegSecurityType);
@@ -581,15 +934,810 @@ namespace FIX50SP2
         FIELD_SET(*this, FIX::LegOptionRatio);
         FIELD_SET(*this, FIX::LegContractMultiplierUnit);
         FIELD_SET(*this, FIX::LegFlowScheduleType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::LegSymbol);
+          FIELD_VIEW(*m_pMap, FIX::LegSymbolSfx);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityID);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NoLegSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::LegProduct);
+          FIELD_VIEW(*m_pMap, FIX::LegCFICode);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::LegSecuritySubType);
+          FIELD_VIEW(*m_pMap, FIX::LegMaturityMonthYear);
+          FIELD_VIEW(*m_pMap, FIX::LegMaturityDate);
+          FIELD_VIEW(*m_pMap, FIX::LegMaturityTime);
+          FIELD_VIEW(*m_pMap, FIX::LegCouponPaymentDate);
+          FIELD_VIEW(*m_pMap, FIX::LegIssueDate);
+          FIELD_VIEW(*m_pMap, FIX::LegRepoCollateralSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::LegRepurchaseTerm);
+          FIELD_VIEW(*m_pMap, FIX::LegRepurchaseRate);
+          FIELD_VIEW(*m_pMap, FIX::LegFactor);
+          FIELD_VIEW(*m_pMap, FIX::LegCreditRating);
+          FIELD_VIEW(*m_pMap, FIX::LegInstrRegistry);
+          FIELD_VIEW(*m_pMap, FIX::LegCountryOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegStateOrProvinceOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegLocaleOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LegRedemptionDate);
+          FIELD_VIEW(*m_pMap, FIX::LegStrikePrice);
+          FIELD_VIEW(*m_pMap, FIX::LegStrikeCurrency);
+          FIELD_VIEW(*m_pMap, FIX::LegOptAttribute);
+          FIELD_VIEW(*m_pMap, FIX::LegContractMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::LegUnitOfMeasure);
+          FIELD_VIEW(*m_pMap, FIX::LegUnitOfMeasureQty);
+          FIELD_VIEW(*m_pMap, FIX::LegPriceUnitOfMeasure);
+          FIELD_VIEW(*m_pMap, FIX::LegPriceUnitOfMeasureQty);
+          FIELD_VIEW(*m_pMap, FIX::LegTimeUnit);
+          FIELD_VIEW(*m_pMap, FIX::LegExerciseStyle);
+          FIELD_VIEW(*m_pMap, FIX::LegCouponRate);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityExchange);
+          FIELD_VIEW(*m_pMap, FIX::LegIssuer);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuerLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegIssuer);
+          FIELD_VIEW(*m_pMap, FIX::LegSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDescLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedLegSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::LegRatioQty);
+          FIELD_VIEW(*m_pMap, FIX::LegSide);
+          FIELD_VIEW(*m_pMap, FIX::LegCurrency);
+          FIELD_VIEW(*m_pMap, FIX::LegPool);
+          FIELD_VIEW(*m_pMap, FIX::LegDatedDate);
+          FIELD_VIEW(*m_pMap, FIX::LegContractSettlMonth);
+          FIELD_VIEW(*m_pMap, FIX::LegInterestAccrualDate);
+          FIELD_VIEW(*m_pMap, FIX::LegPutOrCall);
+          FIELD_VIEW(*m_pMap, FIX::LegOptionRatio);
+          FIELD_VIEW(*m_pMap, FIX::LegContractMultiplierUnit);
+          FIELD_VIEW(*m_pMap, FIX::LegFlowScheduleType);
+          FIX::GroupView<NoLegSecurityAltID::View> noLegSecurityAltID() const
+          { return FIX::GroupView<NoLegSecurityAltID::View>( *m_pMap, FIX::FIELD::NoLegSecurityAltID ); }
+        };
       };
+      FIX::GroupView<NoLegs::View> noLegs() const
+      { return FIX::GroupView<NoLegs::View>( *this, FIX::FIELD::NoLegs ); }
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
       FIELD_SET(*this, FIX::RelSymTransactTime);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::Symbol);
+        FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+        FIELD_VIEW(*m_pMap, FIX::SecurityID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+        FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::Product);
+        FIELD_VIEW(*m_pMap, FIX::ProductComplex);
+        FIELD_VIEW(*m_pMap, FIX::SecurityGroup);
+        FIELD_VIEW(*m_pMap, FIX::CFICode);
+        FIELD_VIEW(*m_pMap, FIX::SecurityType);
+        FIELD_VIEW(*m_pMap, FIX::SecuritySubType);
+        FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+        FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+        FIELD_VIEW(*m_pMap, FIX::MaturityTime);
+        FIELD_VIEW(*m_pMap, FIX::SettleOnOpenFlag);
+        FIELD_VIEW(*m_pMap, FIX::InstrmtAssignmentMethod);
+        FIELD_VIEW(*m_pMap, FIX::SecurityStatus);
+        FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+        FIELD_VIEW(*m_pMap, FIX::IssueDate);
+        FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+        FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+        FIELD_VIEW(*m_pMap, FIX::Factor);
+        FIELD_VIEW(*m_pMap, FIX::CreditRating);
+        FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+        FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+        FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+        FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+        FIELD_VIEW(*m_pMap, FIX::StrikeCurrency);
+        FIELD_VIEW(*m_pMap, FIX::StrikeMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::StrikeValue);
+        FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+        FIELD_VIEW(*m_pMap, FIX::MinPriceIncrement);
+        FIELD_VIEW(*m_pMap, FIX::MinPriceIncrementAmount);
+        FIELD_VIEW(*m_pMap, FIX::UnitOfMeasure);
+        FIELD_VIEW(*m_pMap, FIX::UnitOfMeasureQty);
+        FIELD_VIEW(*m_pMap, FIX::PriceUnitOfMeasure);
+        FIELD_VIEW(*m_pMap, FIX::PriceUnitOfMeasureQty);
+        FIELD_VIEW(*m_pMap, FIX::SettlMethod);
+        FIELD_VIEW(*m_pMap, FIX::ExerciseStyle);
+        FIELD_VIEW(*m_pMap, FIX::OptPayoutAmount);
+        FIELD_VIEW(*m_pMap, FIX::PriceQuoteMethod);
+        FIELD_VIEW(*m_pMap, FIX::ValuationMethod);
+        FIELD_VIEW(*m_pMap, FIX::ListMethod);
+        FIELD_VIEW(*m_pMap, FIX::CapPrice);
+        FIELD_VIEW(*m_pMap, FIX::FloorPrice);
+        FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+        FIELD_VIEW(*m_pMap, FIX::FlexibleIndicator);
+        FIELD_VIEW(*m_pMap, FIX::FlexProductEligibilityIndicator);
+        FIELD_VIEW(*m_pMap, FIX::TimeUnit);
+        FIELD_VIEW(*m_pMap, FIX::CouponRate);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::PositionLimit);
+        FIELD_VIEW(*m_pMap, FIX::NTPositionLimit);
+        FIELD_VIEW(*m_pMap, FIX::Issuer);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+        FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+        FIELD_VIEW(*m_pMap, FIX::SecurityXMLLen);
+        FIELD_VIEW(*m_pMap, FIX::SecurityXML);
+        FIELD_VIEW(*m_pMap, FIX::SecurityXMLSchema);
+        FIELD_VIEW(*m_pMap, FIX::Pool);
+        FIELD_VIEW(*m_pMap, FIX::ContractSettlMonth);
+        FIELD_VIEW(*m_pMap, FIX::CPProgram);
+        FIELD_VIEW(*m_pMap, FIX::CPRegType);
+        FIELD_VIEW(*m_pMap, FIX::NoEvents);
+        FIELD_VIEW(*m_pMap, FIX::DatedDate);
+        FIELD_VIEW(*m_pMap, FIX::InterestAccrualDate);
+        FIELD_VIEW(*m_pMap, FIX::NoInstrumentParties);
+        FIELD_VIEW(*m_pMap, FIX::ContractMultiplierUnit);
+        FIELD_VIEW(*m_pMap, FIX::FlowScheduleType);
+        FIELD_VIEW(*m_pMap, FIX::RestructuringType);
+        FIELD_VIEW(*m_pMap, FIX::Seniority);
+        FIELD_VIEW(*m_pMap, FIX::NotionalPercentageOutstanding);
+        FIELD_VIEW(*m_pMap, FIX::OriginalNotionalPercentageOutstanding);
+        FIELD_VIEW(*m_pMap, FIX::AttachmentPoint);
+        FIELD_VIEW(*m_pMap, FIX::DetachmentPoint);
+        FIELD_VIEW(*m_pMap, FIX::StrikePriceDeterminationMethod);
+        FIELD_VIEW(*m_pMap, FIX::StrikePriceBoundaryMethod);
+        FIELD_VIEW(*m_pMap, FIX::StrikePriceBoundaryPrecision);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingPriceDeterminationMethod);
+        FIELD_VIEW(*m_pMap, FIX::OptPayoutType);
+        FIELD_VIEW(*m_pMap, FIX::NoComplexEvents);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryPriceLimitType);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryLowLimitPrice);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryHighLimitPrice);
+        FIELD_VIEW(*m_pMap, FIX::SecondaryTradingReferencePrice);
+        FIELD_VIEW(*m_pMap, FIX::Currency);
+        FIELD_VIEW(*m_pMap, FIX::CorporateAction);
+        FIELD_VIEW(*m_pMap, FIX::DeliveryForm);
+        FIELD_VIEW(*m_pMap, FIX::PctAtRisk);
+        FIELD_VIEW(*m_pMap, FIX::NoInstrAttrib);
+        FIELD_VIEW(*m_pMap, FIX::NoLegs);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+        FIELD_VIEW(*m_pMap, FIX::RelSymTransactTime);
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
+        FIX::GroupView<NoEvents::View> noEvents() const
+        { return FIX::GroupView<NoEvents::View>( *m_pMap, FIX::FIELD::NoEvents ); }
+        FIX::GroupView<NoInstrumentParties::View> noInstrumentParties() const
+        { return FIX::GroupView<NoInstrumentParties::View>( *m_pMap, FIX::FIELD::NoInstrumentParties ); }
+        FIX::GroupView<NoComplexEvents::View> noComplexEvents() const
+        { return FIX::GroupView<NoComplexEvents::View>( *m_pMap, FIX::FIELD::NoComplexEvents ); }
+        FIX::GroupView<NoInstrAttrib::View> noInstrAttrib() const
+        { return FIX::GroupView<NoInstrAttrib::View>( *m_pMap, FIX::FIELD::NoInstrAttrib ); }
+        FIX::GroupView<NoLegs::View> noLegs() const
+        { return FIX::GroupView<NoLegs::View>( *m_pMap, FIX::FIELD::NoLegs ); }
+      };
     };
+    FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+    { return FIX::GroupView<NoRelatedSym::View>( *this, FIX::FIELD::NoRelatedSym ); }
     FIELD_SET(*this, FIX::SecurityReportID);
     FIELD_SET(*this, FIX::ClearingBusinessDate);
     FIELD_SET(*this, FIX::TransactTime);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView applID() const
+      { return getString( FIX::FIELD::ApplID ); }
+      int applSeqNum() const
+      { return getInt( FIX::FIELD::ApplSeqNum ); }
+      int applLastSeqNum() const
+      { return getInt( FIX::FIELD::ApplLastSeqNum ); }
+      bool applResendFlag() const
+      { return getBool( FIX::FIELD::ApplResendFlag ); }
+      FIX::StringView securityReqID() const
+      { return getString( FIX::FIELD::SecurityReqID ); }
+      FIX::StringView securityResponseID() const
+      { return getString( FIX::FIELD::SecurityResponseID ); }
+      int securityRequestResult() const
+      { return getInt( FIX::FIELD::SecurityRequestResult ); }
+      FIX::StringView underlyingSymbol() const
+      { return getString( FIX::FIELD::UnderlyingSymbol ); }
+      FIX::StringView underlyingSymbolSfx() const
+      { return getString( FIX::FIELD::UnderlyingSymbolSfx ); }
+      FIX::StringView underlyingSecurityID() const
+      { return getString( FIX::FIELD::UnderlyingSecurityID ); }
+      FIX::StringView underlyingSecurityIDSource() const
+      { return getString( FIX::FIELD::UnderlyingSecurityIDSource ); }
+      int noUnderlyingSecurityAltID() const
+      { return getInt( FIX::FIELD::NoUnderlyingSecurityAltID ); }
+      int underlyingProduct() const
+      { return getInt( FIX::FIELD::UnderlyingProduct ); }
+      FIX::StringView underlyingCFICode() const
+      { return getString( FIX::FIELD::UnderlyingCFICode ); }
+      FIX::StringView underlyingSecurityType() const
+      { return getString( FIX::FIELD::UnderlyingSecurityType ); }
+      FIX::StringView underlyingSecuritySubType() const
+      { return getString( FIX::FIELD::UnderlyingSecuritySubType ); }
+      FIX::StringView underlyingMaturityMonthYear() const
+      { return getString( FIX::FIELD::UnderlyingMaturityMonthYear ); }
+      FIX::StringView underlyingMaturityDate() const
+      { return getString( FIX::FIELD::UnderlyingMaturityDate ); }
+      FIX::StringView underlyingMaturityTime() const
+      { return getString( FIX::FIELD::UnderlyingMaturityTime ); }
+      FIX::StringView underlyingCouponPaymentDate() const
+      { return getString( FIX::FIELD::UnderlyingCouponPaymentDate ); }
+      FIX::StringView underlyingIssueDate() const
+      { return getString( FIX::FIELD::UnderlyingIssueDate ); }
+      FIX::StringView underlyingRepoCollateralSecurityType() const
+      { return getString( FIX::FIELD::UnderlyingRepoCollateralSecurityType ); }
+      int underlyingRepurchaseTerm() const
+      { return getInt( FIX::FIELD::UnderlyingRepurchaseTerm ); }
+      FIX::Decimal underlyingRepurchaseRate() const
+      { return getDecimal( FIX::FIELD::UnderlyingRepurchaseRate ); }
+      double underlyingFactor() const
+      { return getDouble( FIX::FIELD::UnderlyingFactor ); }
+      FIX::StringView underlyingCreditRating() const
+      { return getString( FIX::FIELD::UnderlyingCreditRating ); }
+      FIX::StringView underlyingInstrRegistry() const
+      { return getString( FIX::FIELD::UnderlyingInstrRegistry ); }
+      FIX::StringView underlyingCountryOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingCountryOfIssue ); }
+      FIX::StringView underlyingStateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingStateOrProvinceOfIssue ); }
+      FIX::StringView underlyingLocaleOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingLocaleOfIssue ); }
+      FIX::StringView underlyingRedemptionDate() const
+      { return getString( FIX::FIELD::UnderlyingRedemptionDate ); }
+      FIX::Decimal underlyingStrikePrice() const
+      { return getDecimal( FIX::FIELD::UnderlyingStrikePrice ); }
+      FIX::StringView underlyingStrikeCurrency() const
+      { return getString( FIX::FIELD::UnderlyingStrikeCurrency ); }
+      char underlyingOptAttribute() const
+      { return getChar( FIX::FIELD::UnderlyingOptAttribute ); }
+      double underlyingContractMultiplier() const
+      { return getDouble( FIX::FIELD::UnderlyingContractMultiplier ); }
+      FIX::StringView underlyingUnitOfMeasure() const
+      { return getString( FIX::FIELD::UnderlyingUnitOfMeasure ); }
+      FIX::Decimal underlyingUnitOfMeasureQty() const
+      { return getDecimal( FIX::FIELD::UnderlyingUnitOfMeasureQty ); }
+      FIX::StringView underlyingPriceUnitOfMeasure() const
+      { return getString( FIX::FIELD::UnderlyingPriceUnitOfMeasure ); }
+      FIX::Decimal underlyingPriceUnitOfMeasureQty() const
+      { return getDecimal( FIX::FIELD::UnderlyingPriceUnitOfMeasureQty ); }
+      FIX::StringView underlyingTimeUnit() const
+      { return getString( FIX::FIELD::UnderlyingTimeUnit ); }
+      int underlyingExerciseStyle() const
+      { return getInt( FIX::FIELD::UnderlyingExerciseStyle ); }
+      FIX::Decimal underlyingCouponRate() const
+      { return getDecimal( FIX::FIELD::UnderlyingCouponRate ); }
+      FIX::StringView underlyingSecurityExchange() const
+      { return getString( FIX::FIELD::UnderlyingSecurityExchange ); }
+      FIX::StringView underlyingIssuer() const
+      { return getString( FIX::FIELD::UnderlyingIssuer ); }
+      int encodedUnderlyingIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedUnderlyingIssuerLen ); }
+      FIX::StringView encodedUnderlyingIssuer() const
+      { return getString( FIX::FIELD::EncodedUnderlyingIssuer ); }
+      FIX::StringView underlyingSecurityDesc() const
+      { return getString( FIX::FIELD::UnderlyingSecurityDesc ); }
+      int encodedUnderlyingSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedUnderlyingSecurityDescLen ); }
+      FIX::StringView encodedUnderlyingSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedUnderlyingSecurityDesc ); }
+      FIX::StringView underlyingCPProgram() const
+      { return getString( FIX::FIELD::UnderlyingCPProgram ); }
+      FIX::StringView underlyingCPRegType() const
+      { return getString( FIX::FIELD::UnderlyingCPRegType ); }
+      FIX::Decimal underlyingAllocationPercent() const
+      { return getDecimal( FIX::FIELD::UnderlyingAllocationPercent ); }
+      FIX::StringView underlyingCurrency() const
+      { return getString( FIX::FIELD::UnderlyingCurrency ); }
+      FIX::Decimal underlyingQty() const
+      { return getDecimal( FIX::FIELD::UnderlyingQty ); }
+      int underlyingSettlementType() const
+      { return getInt( FIX::FIELD::UnderlyingSettlementType ); }
+      FIX::Decimal underlyingCashAmount() const
+      { return getDecimal( FIX::FIELD::UnderlyingCashAmount ); }
+      FIX::StringView underlyingCashType() const
+      { return getString( FIX::FIELD::UnderlyingCashType ); }
+      FIX::Decimal underlyingPx() const
+      { return getDecimal( FIX::FIELD::UnderlyingPx ); }
+      FIX::Decimal underlyingDirtyPrice() const
+      { return getDecimal( FIX::FIELD::UnderlyingDirtyPrice ); }
+      FIX::Decimal underlyingEndPrice() const
+      { return getDecimal( FIX::FIELD::UnderlyingEndPrice ); }
+      FIX::Decimal underlyingStartValue() const
+      { return getDecimal( FIX::FIELD::UnderlyingStartValue ); }
+      FIX::Decimal underlyingCurrentValue() const
+      { return getDecimal( FIX::FIELD::UnderlyingCurrentValue ); }
+      FIX::Decimal underlyingEndValue() const
+      { return getDecimal( FIX::FIELD::UnderlyingEndValue ); }
+      int noUnderlyingStips() const
+      { return getInt( FIX::FIELD::NoUnderlyingStips ); }
+      FIX::Decimal underlyingAdjustedQuantity() const
+      { return getDecimal( FIX::FIELD::UnderlyingAdjustedQuantity ); }
+      double underlyingFXRate() const
+      { return getDouble( FIX::FIELD::UnderlyingFXRate ); }
+      FIX::UnderlyingFXRateCalc underlyingFXRateCalc() const
+      { return FIX::UnderlyingFXRateCalc( getChar( FIX::FIELD::UnderlyingFXRateCalc ) ); }
+      FIX::Decimal underlyingCapValue() const
+      { return getDecimal( FIX::FIELD::UnderlyingCapValue ); }
+      int noUndlyInstrumentParties() const
+      { return getInt( FIX::FIELD::NoUndlyInstrumentParties ); }
+      FIX::StringView underlyingSettlMethod() const
+      { return getString( FIX::FIELD::UnderlyingSettlMethod ); }
+      int underlyingPutOrCall() const
+      { return getInt( FIX::FIELD::UnderlyingPutOrCall ); }
+      int underlyingContractMultiplierUnit() const
+      { return getInt( FIX::FIELD::UnderlyingContractMultiplierUnit ); }
+      int underlyingFlowScheduleType() const
+      { return getInt( FIX::FIELD::UnderlyingFlowScheduleType ); }
+      FIX::StringView underlyingRestructuringType() const
+      { return getString( FIX::FIELD::UnderlyingRestructuringType ); }
+      FIX::StringView underlyingSeniority() const
+      { return getString( FIX::FIELD::UnderlyingSeniority ); }
+      FIX::Decimal underlyingNotionalPercentageOutstanding() const
+      { return getDecimal( FIX::FIELD::UnderlyingNotionalPercentageOutstanding ); }
+      FIX::Decimal underlyingOriginalNotionalPercentageOutstanding() const
+      { return getDecimal( FIX::FIELD::UnderlyingOriginalNotionalPercentageOutstanding ); }
+      FIX::Decimal underlyingAttachmentPoint() const
+      { return getDecimal( FIX::FIELD::UnderlyingAttachmentPoint ); }
+      FIX::Decimal underlyingDetachmentPoint() const
+      { return getDecimal( FIX::FIELD::UnderlyingDetachmentPoint ); }
+      FIX::StringView derivativeSymbol() const
+      { return getString( FIX::FIELD::DerivativeSymbol ); }
+      FIX::StringView derivativeSymbolSfx() const
+      { return getString( FIX::FIELD::DerivativeSymbolSfx ); }
+      FIX::StringView derivativeSecurityID() const
+      { return getString( FIX::FIELD::DerivativeSecurityID ); }
+      FIX::StringView derivativeSecurityIDSource() const
+      { return getString( FIX::FIELD::DerivativeSecurityIDSource ); }
+      int noDerivativeSecurityAltID() const
+      { return getInt( FIX::FIELD::NoDerivativeSecurityAltID ); }
+      int derivativeProduct() const
+      { return getInt( FIX::FIELD::DerivativeProduct ); }
+      FIX::StringView derivativeProductComplex() const
+      { return getString( FIX::FIELD::DerivativeProductComplex ); }
+      bool derivFlexProductEligibilityIndicator() const
+      { return getBool( FIX::FIELD::DerivFlexProductEligibilityIndicator ); }
+      FIX::StringView derivativeSecurityGroup() const
+      { return getString( FIX::FIELD::DerivativeSecurityGroup ); }
+      FIX::StringView derivativeCFICode() const
+      { return getString( FIX::FIELD::DerivativeCFICode ); }
+      FIX::StringView derivativeSecurityType() const
+      { return getString( FIX::FIELD::DerivativeSecurityType ); }
+      FIX::StringView derivativeSecuritySubType() const
+      { return getString( FIX::FIELD::DerivativeSecuritySubType ); }
+      FIX::StringView derivativeMaturityMonthYear() const
+      { return getString( FIX::FIELD::DerivativeMaturityMonthYear ); }
+      FIX::StringView derivativeMaturityDate() const
+      { return getString( FIX::FIELD::DerivativeMaturityDate ); }
+      FIX::StringView derivativeMaturityTime() const
+      { return getString( FIX::FIELD::DerivativeMaturityTime ); }
+      FIX::StringView derivativeSettleOnOpenFlag() const
+      { return getString( FIX::FIELD::DerivativeSettleOnOpenFlag ); }
+      char derivativeInstrmtAssignmentMethod() const
+      { return getChar( FIX::FIELD::DerivativeInstrmtAssignmentMethod ); }
+      FIX::StringView derivativeSecurityStatus() const
+      { return getString( FIX::FIELD::DerivativeSecurityStatus ); }
+      FIX::StringView derivativeIssueDate() const
+      { return getString( FIX::FIELD::DerivativeIssueDate ); }
+      FIX::StringView derivativeInstrRegistry() const
+      { return getString( FIX::FIELD::DerivativeInstrRegistry ); }
+      FIX::StringView derivativeCountryOfIssue() const
+      { return getString( FIX::FIELD::DerivativeCountryOfIssue ); }
+      FIX::StringView derivativeStateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::DerivativeStateOrProvinceOfIssue ); }
+      FIX::StringView derivativeLocaleOfIssue() const
+      { return getString( FIX::FIELD::DerivativeLocaleOfIssue ); }
+      FIX::Decimal derivativeStrikePrice() const
+      { return getDecimal( FIX::FIELD::DerivativeStrikePrice ); }
+      FIX::StringView derivativeStrikeCurrency() const
+      { return getString( FIX::FIELD::DerivativeStrikeCurrency ); }
+      double derivativeStrikeMultiplier() const
+      { return getDouble( FIX::FIELD::DerivativeStrikeMultiplier ); }
+      double derivativeStrikeValue() const
+      { return getDouble( FIX::FIELD::DerivativeStrikeValue ); }
+      char derivativeOptAttribute() const
+      { return getChar( FIX::FIELD::DerivativeOptAttribute ); }
+      double derivativeContractMultiplier() const
+      { return getDouble( FIX::FIELD::DerivativeContractMultiplier ); }
+      double derivativeMinPriceIncrement() const
+      { return getDouble( FIX::FIELD::DerivativeMinPriceIncrement ); }
+      FIX::Decimal derivativeMinPriceIncrementAmount() const
+      { return getDecimal( FIX::FIELD::DerivativeMinPriceIncrementAmount ); }
+      FIX::StringView derivativeUnitOfMeasure() const
+      { return getString( FIX::FIELD::DerivativeUnitOfMeasure ); }
+      FIX::Decimal derivativeUnitOfMeasureQty() const
+      { return getDecimal( FIX::FIELD::DerivativeUnitOfMeasureQty ); }
+      FIX::StringView derivativePriceUnitOfMeasure() const
+      { return getString( FIX::FIELD::DerivativePriceUnitOfMeasure ); }
+      FIX::Decimal derivativePriceUnitOfMeasureQty() const
+      { return getDecimal( FIX::FIELD::DerivativePriceUnitOfMeasureQty ); }
+      char derivativeSettlMethod() const
+      { return getChar( FIX::FIELD::DerivativeSettlMethod ); }
+      FIX::StringView derivativePriceQuoteMethod() const
+      { return getString( FIX::FIELD::DerivativePriceQuoteMethod ); }
+      FIX::StringView derivativeValuationMethod() const
+      { return getString( FIX::FIELD::DerivativeValuationMethod ); }
+      int derivativeListMethod() const
+      { return getInt( FIX::FIELD::DerivativeListMethod ); }
+      FIX::Decimal derivativeCapPrice() const
+      { return getDecimal( FIX::FIELD::DerivativeCapPrice ); }
+      FIX::Decimal derivativeFloorPrice() const
+      { return getDecimal( FIX::FIELD::DerivativeFloorPrice ); }
+      int derivativePutOrCall() const
+      { return getInt( FIX::FIELD::DerivativePutOrCall ); }
+      char derivativeExerciseStyle() const
+      { return getChar( FIX::FIELD::DerivativeExerciseStyle ); }
+      FIX::Decimal derivativeOptPayAmount() const
+      { return getDecimal( FIX::FIELD::DerivativeOptPayAmount ); }
+      FIX::StringView derivativeTimeUnit() const
+      { return getString( FIX::FIELD::DerivativeTimeUnit ); }
+      FIX::StringView derivativeSecurityExchange() const
+      { return getString( FIX::FIELD::DerivativeSecurityExchange ); }
+      int derivativePositionLimit() const
+      { return getInt( FIX::FIELD::DerivativePositionLimit ); }
+      int derivativeNTPositionLimit() const
+      { return getInt( FIX::FIELD::DerivativeNTPositionLimit ); }
+      FIX::StringView derivativeIssuer() const
+      { return getString( FIX::FIELD::DerivativeIssuer ); }
+      int derivativeEncodedIssuerLen() const
+      { return getInt( FIX::FIELD::DerivativeEncodedIssuerLen ); }
+      FIX::StringView derivativeEncodedIssuer() const
+      { return getString( FIX::FIELD::DerivativeEncodedIssuer ); }
+      FIX::StringView derivativeSecurityDesc() const
+      { return getString( FIX::FIELD::DerivativeSecurityDesc ); }
+      int derivativeEncodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::DerivativeEncodedSecurityDescLen ); }
+      FIX::StringView derivativeEncodedSecurityDesc() const
+      { return getString( FIX::FIELD::DerivativeEncodedSecurityDesc ); }
+      int derivativeSecurityXMLLen() const
+      { return getInt( FIX::FIELD::DerivativeSecurityXMLLen ); }
+      FIX::StringView derivativeSecurityXML() const
+      { return getString( FIX::FIELD::DerivativeSecurityXML ); }
+      FIX::StringView derivativeSecurityXMLSchema() const
+      { return getString( FIX::FIELD::DerivativeSecurityXMLSchema ); }
+      FIX::StringView derivativeContractSettlMonth() const
+      { return getString( FIX::FIELD::DerivativeContractSettlMonth ); }
+      int noDerivativeEvents() const
+      { return getInt( FIX::FIELD::NoDerivativeEvents ); }
+      int noDerivativeInstrumentParties() const
+      { return getInt( FIX::FIELD::NoDerivativeInstrumentParties ); }
+      int derivativeContractMultiplierUnit() const
+      { return getInt( FIX::FIELD::DerivativeContractMultiplierUnit ); }
+      int derivativeFlowScheduleType() const
+      { return getInt( FIX::FIELD::DerivativeFlowScheduleType ); }
+      int noDerivativeInstrAttrib() const
+      { return getInt( FIX::FIELD::NoDerivativeInstrAttrib ); }
+      int noMarketSegments() const
+      { return getInt( FIX::FIELD::NoMarketSegments ); }
+      int totNoRelatedSym() const
+      { return getInt( FIX::FIELD::TotNoRelatedSym ); }
+      bool lastFragment() const
+      { return getBool( FIX::FIELD::LastFragment ); }
+      int noRelatedSym() const
+      { return getInt( FIX::FIELD::NoRelatedSym ); }
+      int securityReportID() const
+      { return getInt( FIX::FIELD::SecurityReportID ); }
+      FIX::StringView clearingBusinessDate() const
+      { return getString( FIX::FIELD::ClearingBusinessDate ); }
+      FIX::StringView transactTime() const
+      { return getString( FIX::FIELD::TransactTime ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "AA" ) {}
+      void setApplID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ApplID, value ); }
+      void setApplSeqNum( int value )
+      { setInt( FIX::FIELD::ApplSeqNum, value ); }
+      void setApplLastSeqNum( int value )
+      { setInt( FIX::FIELD::ApplLastSeqNum, value ); }
+      void setApplResendFlag( bool value )
+      { setBool( FIX::FIELD::ApplResendFlag, value ); }
+      void setSecurityReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityReqID, value ); }
+      void setSecurityResponseID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityResponseID, value ); }
+      void setSecurityRequestResult( int value )
+      { setInt( FIX::FIELD::SecurityRequestResult, value ); }
+      void setUnderlyingSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSymbol, value ); }
+      void setUnderlyingSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSymbolSfx, value ); }
+      void setUnderlyingSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityID, value ); }
+      void setUnderlyingSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityIDSource, value ); }
+      void setNoUnderlyingSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoUnderlyingSecurityAltID, value ); }
+      void setUnderlyingProduct( int value )
+      { setInt( FIX::FIELD::UnderlyingProduct, value ); }
+      void setUnderlyingCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCFICode, value ); }
+      void setUnderlyingSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityType, value ); }
+      void setUnderlyingSecuritySubType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecuritySubType, value ); }
+      void setUnderlyingMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingMaturityMonthYear, value ); }
+      void setUnderlyingMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingMaturityDate, value ); }
+      void setUnderlyingMaturityTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingMaturityTime, value ); }
+      void setUnderlyingCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCouponPaymentDate, value ); }
+      void setUnderlyingIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingIssueDate, value ); }
+      void setUnderlyingRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingRepoCollateralSecurityType, value ); }
+      void setUnderlyingRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::UnderlyingRepurchaseTerm, value ); }
+      void setUnderlyingRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingRepurchaseRate, value ); }
+      void setUnderlyingFactor( double value )
+      { setDouble( FIX::FIELD::UnderlyingFactor, value ); }
+      void setUnderlyingCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCreditRating, value ); }
+      void setUnderlyingInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingInstrRegistry, value ); }
+      void setUnderlyingCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCountryOfIssue, value ); }
+      void setUnderlyingStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingStateOrProvinceOfIssue, value ); }
+      void setUnderlyingLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingLocaleOfIssue, value ); }
+      void setUnderlyingRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingRedemptionDate, value ); }
+      void setUnderlyingStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingStrikePrice, value ); }
+      void setUnderlyingStrikeCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingStrikeCurrency, value ); }
+      void setUnderlyingOptAttribute( char value )
+      { setChar( FIX::FIELD::UnderlyingOptAttribute, value ); }
+      void setUnderlyingContractMultiplier( double value )
+      { setDouble( FIX::FIELD::UnderlyingContractMultiplier, value ); }
+      void setUnderlyingUnitOfMeasure( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingUnitOfMeasure, value ); }
+      void setUnderlyingUnitOfMeasureQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingUnitOfMeasureQty, value ); }
+      void setUnderlyingPriceUnitOfMeasure( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingPriceUnitOfMeasure, value ); }
+      void setUnderlyingPriceUnitOfMeasureQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingPriceUnitOfMeasureQty, value ); }
+      void setUnderlyingTimeUnit( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingTimeUnit, value ); }
+      void setUnderlyingExerciseStyle( int value )
+      { setInt( FIX::FIELD::UnderlyingExerciseStyle, value ); }
+      void setUnderlyingCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingCouponRate, value ); }
+      void setUnderlyingSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityExchange, value ); }
+      void setUnderlyingIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingIssuer, value ); }
+      void setEncodedUnderlyingIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedUnderlyingIssuerLen, value ); }
+      void setEncodedUnderlyingIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedUnderlyingIssuer, value ); }
+      void setUnderlyingSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityDesc, value ); }
+      void setEncodedUnderlyingSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedUnderlyingSecurityDescLen, value ); }
+      void setEncodedUnderlyingSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedUnderlyingSecurityDesc, value ); }
+      void setUnderlyingCPProgram( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCPProgram, value ); }
+      void setUnderlyingCPRegType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCPRegType, value ); }
+      void setUnderlyingAllocationPercent( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingAllocationPercent, value ); }
+      void setUnderlyingCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCurrency, value ); }
+      void setUnderlyingQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingQty, value ); }
+      void setUnderlyingSettlementType( int value )
+      { setInt( FIX::FIELD::UnderlyingSettlementType, value ); }
+      void setUnderlyingCashAmount( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingCashAmount, value ); }
+      void setUnderlyingCashType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCashType, value ); }
+      void setUnderlyingPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingPx, value ); }
+      void setUnderlyingDirtyPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingDirtyPrice, value ); }
+      void setUnderlyingEndPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingEndPrice, value ); }
+      void setUnderlyingStartValue( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingStartValue, value ); }
+      void setUnderlyingCurrentValue( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingCurrentValue, value ); }
+      void setUnderlyingEndValue( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingEndValue, value ); }
+      void setNoUnderlyingStips( int value )
+      { setInt( FIX::FIELD::NoUnderlyingStips, value ); }
+      void setUnderlyingAdjustedQuantity( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingAdjustedQuantity, value ); }
+      void setUnderlyingFXRate( double value )
+      { setDouble( FIX::FIELD::UnderlyingFXRate, value ); }
+      void setUnderlyingFXRateCalc( char value )
+      { setChar( FIX::FIELD::UnderlyingFXRateCalc, value ); }
+      void setUnderlyingCapValue( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingCapValue, value ); }
+      void setNoUndlyInstrumentParties( int value )
+      { setInt( FIX::FIELD::NoUndlyInstrumentParties, value ); }
+      void setUnderlyingSettlMethod( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSettlMethod, value ); }
+      void setUnderlyingPutOrCall( int value )
+      { setInt( FIX::FIELD::UnderlyingPutOrCall, value ); }
+      void setUnderlyingContractMultiplierUnit( int value )
+      { setInt( FIX::FIELD::UnderlyingContractMultiplierUnit, value ); }
+      void setUnderlyingFlowScheduleType( int value )
+      { setInt( FIX::FIELD::UnderlyingFlowScheduleType, value ); }
+      void setUnderlyingRestructuringType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingRestructuringType, value ); }
+      void setUnderlyingSeniority( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSeniority, value ); }
+      void setUnderlyingNotionalPercentageOutstanding( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingNotionalPercentageOutstanding, value ); }
+      void setUnderlyingOriginalNotionalPercentageOutstanding( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingOriginalNotionalPercentageOutstanding, value ); }
+      void setUnderlyingAttachmentPoint( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingAttachmentPoint, value ); }
+      void setUnderlyingDetachmentPoint( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingDetachmentPoint, value ); }
+      void setDerivativeSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSymbol, value ); }
+      void setDerivativeSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSymbolSfx, value ); }
+      void setDerivativeSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityID, value ); }
+      void setDerivativeSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityIDSource, value ); }
+      void setNoDerivativeSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoDerivativeSecurityAltID, value ); }
+      void setDerivativeProduct( int value )
+      { setInt( FIX::FIELD::DerivativeProduct, value ); }
+      void setDerivativeProductComplex( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeProductComplex, value ); }
+      void setDerivFlexProductEligibilityIndicator( bool value )
+      { setBool( FIX::FIELD::DerivFlexProductEligibilityIndicator, value ); }
+      void setDerivativeSecurityGroup( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityGroup, value ); }
+      void setDerivativeCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeCFICode, value ); }
+      void setDerivativeSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityType, value ); }
+      void setDerivativeSecuritySubType( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecuritySubType, value ); }
+      void setDerivativeMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeMaturityMonthYear, value ); }
+      void setDerivativeMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeMaturityDate, value ); }
+      void setDerivativeMaturityTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeMaturityTime, value ); }
+      void setDerivativeSettleOnOpenFlag( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSettleOnOpenFlag, value ); }
+      void setDerivativeInstrmtAssignmentMethod( char value )
+      { setChar( FIX::FIELD::DerivativeInstrmtAssignmentMethod, value ); }
+      void setDerivativeSecurityStatus( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityStatus, value ); }
+      void setDerivativeIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeIssueDate, value ); }
+      void setDerivativeInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeInstrRegistry, value ); }
+      void setDerivativeCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeCountryOfIssue, value ); }
+      void setDerivativeStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeStateOrProvinceOfIssue, value ); }
+      void setDerivativeLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeLocaleOfIssue, value ); }
+      void setDerivativeStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DerivativeStrikePrice, value ); }
+      void setDerivativeStrikeCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeStrikeCurrency, value ); }
+      void setDerivativeStrikeMultiplier( double value )
+      { setDouble( FIX::FIELD::DerivativeStrikeMultiplier, value ); }
+      void setDerivativeStrikeValue( double value )
+      { setDouble( FIX::FIELD::DerivativeStrikeValue, value ); }
+      void setDerivativeOptAttribute( char value )
+      { setChar( FIX::FIELD::DerivativeOptAttribute, value ); }
+      void setDerivativeContractMultiplier( double value )
+      { setDouble( FIX::FIELD::DerivativeContractMultiplier, value ); }
+      void setDerivativeMinPriceIncrement( double value )
+      { setDouble( FIX::FIELD::DerivativeMinPriceIncrement, value ); }
+      void setDerivativeMinPriceIncrementAmount( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DerivativeMinPriceIncrementAmount, value ); }
+      void setDerivativeUnitOfMeasure( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeUnitOfMeasure, value ); }
+      void setDerivativeUnitOfMeasureQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DerivativeUnitOfMeasureQty, value ); }
+      void setDerivativePriceUnitOfMeasure( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativePriceUnitOfMeasure, value ); }
+      void setDerivativePriceUnitOfMeasureQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DerivativePriceUnitOfMeasureQty, value ); }
+      void setDerivativeSettlMethod( char value )
+      { setChar( FIX::FIELD::DerivativeSettlMethod, value ); }
+      void setDerivativePriceQuoteMethod( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativePriceQuoteMethod, value ); }
+      void setDerivativeValuationMethod( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeValuationMethod, value ); }
+      void setDerivativeListMethod( int value )
+      { setInt( FIX::FIELD::DerivativeListMethod, value ); }
+      void setDerivativeCapPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DerivativeCapPrice, value ); }
+      void setDerivativeFloorPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DerivativeFloorPrice, value ); }
+      void setDerivativePutOrCall( int value )
+      { setInt( FIX::FIELD::DerivativePutOrCall, value ); }
+      void setDerivativeExerciseStyle( char value )
+      { setChar( FIX::FIELD::DerivativeExerciseStyle, value ); }
+      void setDerivativeOptPayAmount( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DerivativeOptPayAmount, value ); }
+      void setDerivativeTimeUnit( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeTimeUnit, value ); }
+      void setDerivativeSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityExchange, value ); }
+      void setDerivativePositionLimit( int value )
+      { setInt( FIX::FIELD::DerivativePositionLimit, value ); }
+      void setDerivativeNTPositionLimit( int value )
+      { setInt( FIX::FIELD::DerivativeNTPositionLimit, value ); }
+      void setDerivativeIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeIssuer, value ); }
+      void setDerivativeEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::DerivativeEncodedIssuerLen, value ); }
+      void setDerivativeEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeEncodedIssuer, value ); }
+      void setDerivativeSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityDesc, value ); }
+      void setDerivativeEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::DerivativeEncodedSecurityDescLen, value ); }
+      void setDerivativeEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeEncodedSecurityDesc, value ); }
+      void setDerivativeSecurityXMLLen( int value )
+      { setInt( FIX::FIELD::DerivativeSecurityXMLLen, value ); }
+      void setDerivativeSecurityXML( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityXML, value ); }
+      void setDerivativeSecurityXMLSchema( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityXMLSchema, value ); }
+      void setDerivativeContractSettlMonth( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeContractSettlMonth, value ); }
+      void setNoDerivativeEvents( int value )
+      { setInt( FIX::FIELD::NoDerivativeEvents, value ); }
+      void setNoDerivativeInstrumentParties( int value )
+      { setInt( FIX::FIELD::NoDerivativeInstrumentParties, value ); }
+      void setDerivativeContractMultiplierUnit( int value )
+      { setInt( FIX::FIELD::DerivativeContractMultiplierUnit, value ); }
+      void setDerivativeFlowScheduleType( int value )
+      { setInt( FIX::FIELD::DerivativeFlowScheduleType, value ); }
+      void setNoDerivativeInstrAttrib( int value )
+      { setInt( FIX::FIELD::NoDerivativeInstrAttrib, value ); }
+      void setNoMarketSegments( int value )
+      { setInt( FIX::FIELD::NoMarketSegments, value ); }
+      void setTotNoRelatedSym( int value )
+      { setInt( FIX::FIELD::TotNoRelatedSym, value ); }
+      void setLastFragment( bool value )
+      { setBool( FIX::FIELD::LastFragment, value ); }
+      void setNoRelatedSym( int value )
+      { setInt( FIX::FIELD::NoRelatedSym, value ); }
+      void setSecurityReportID( int value )
+      { setInt( FIX::FIELD::SecurityReportID, value ); }
+      void setClearingBusinessDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::ClearingBusinessDate, value ); }
+      void setTransactTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::TransactTime, value ); }
+      void setTransactTime( const FIX::UtcTimeStamp& value, int precision = 0 )
+      { setUtcTimeStamp( FIX::FIELD::TransactTime, value, precision ); }
+    };
   };
 
 }
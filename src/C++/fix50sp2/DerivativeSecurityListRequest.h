@@ -39,7 +39,16 @@ namespace FIX50SP2
     NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
       FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
       FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingSecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoUnderlyingSecurityAltID::View> noUnderlyingSecurityAltID() const
+    { return FIX::GroupView<NoUnderlyingSecurityAltID::View>( *this, FIX::FIELD::NoUnderlyingSecurityAltID ); }
     FIELD_SET(*this, FIX::UnderlyingProduct);
     FIELD_SET(*this, FIX::UnderlyingCFICode);
     FIELD_SET(*this, FIX::UnderlyingSecurityType);
@@ -98,7 +107,16 @@ namespace FIX50SP2
     NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
       FIELD_SET(*this, FIX::UnderlyingStipType);
       FIELD_SET(*this, FIX::UnderlyingStipValue);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStipType);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingStipValue);
+      };
     };
+    FIX::GroupView<NoUnderlyingStips::View> noUnderlyingStips() const
+    { return FIX::GroupView<NoUnderlyingStips::View>( *this, FIX::FIELD::NoUnderlyingStips ); }
     FIELD_SET(*this, FIX::UnderlyingAdjustedQuantity);
     FIELD_SET(*this, FIX::UnderlyingFXRate);
     FIELD_SET(*this, FIX::UnderlyingFXRateCalc);
@@ -118,8 +136,30 @@ namespace FIX50SP2
       NoUndlyInstrumentPartySubIDs() : FIX::Group(1062,1063,FIX::message_order(1063,1064,0)) {}
         FIELD_SET(*this, FIX::UnderlyingInstrumentPartySubID);
         FIELD_SET(*this, FIX::UnderlyingInstrumentPartySubIDType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrumentPartySubID);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrumentPartySubIDType);
+        };
+      };
+      FIX::GroupView<NoUndlyInstrumentPartySubIDs::View> noUndlyInstrumentPartySubIDs() const
+      { return FIX::GroupView<NoUndlyInstrumentPartySubIDs::View>( *this, FIX::FIELD::NoUndlyInstrumentPartySubIDs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrumentPartyID);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrumentPartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::UnderlyingInstrumentPartyRole);
+        FIELD_VIEW(*m_pMap, FIX::NoUndlyInstrumentPartySubIDs);
+        FIX::GroupView<NoUndlyInstrumentPartySubIDs::View> noUndlyInstrumentPartySubIDs() const
+        { return FIX::GroupView<NoUndlyInstrumentPartySubIDs::View>( *m_pMap, FIX::FIELD::NoUndlyInstrumentPartySubIDs ); }
       };
     };
+    FIX::GroupView<NoUndlyInstrumentParties::View> noUndlyInstrumentParties() const
+    { return FIX::GroupView<NoUndlyInstrumentParties::View>( *this, FIX::FIELD::NoUndlyInstrumentParties ); }
     FIELD_SET(*this, FIX::UnderlyingSettlMethod);
     FIELD_SET(*this, FIX::UnderlyingPutOrCall);
     FIELD_SET(*this, FIX::UnderlyingContractMultiplierUnit);
@@ -141,7 +181,16 @@ namespace FIX50SP2
     NoDerivativeSecurityAltID() : FIX::Group(1218,1219,FIX::message_order(1219,1220,0)) {}
       FIELD_SET(*this, FIX::DerivativeSecurityAltID);
       FIELD_SET(*this, FIX::DerivativeSecurityAltIDSource);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::DerivativeSecurityAltID);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeSecurityAltIDSource);
+      };
     };
+    FIX::GroupView<NoDerivativeSecurityAltID::View> noDerivativeSecurityAltID() const
+    { return FIX::GroupView<NoDerivativeSecurityAltID::View>( *this, FIX::FIELD::NoDerivativeSecurityAltID ); }
     FIELD_SET(*this, FIX::DerivativeProduct);
     FIELD_SET(*this, FIX::DerivativeProductComplex);
     FIELD_SET(*this, FIX::DerivFlexProductEligibilityIndicator);
@@ -205,7 +254,19 @@ namespace FIX50SP2
       FIELD_SET(*this, FIX::DerivativeEventTime);
       FIELD_SET(*this, FIX::DerivativeEventPx);
       FIELD_SET(*this, FIX::DerivativeEventText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::DerivativeEventType);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeEventDate);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeEventTime);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeEventPx);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeEventText);
+      };
     };
+    FIX::GroupView<NoDerivativeEvents::View> noDerivativeEvents() const
+    { return FIX::GroupView<NoDerivativeEvents::View>( *this, FIX::FIELD::NoDerivativeEvents ); }
     FIELD_SET(*this, FIX::NoDerivativeInstrumentParties);
     class NoDerivativeInstrumentParties: public FIX::Group
     {
@@ -221,8 +282,30 @@ namespace FIX50SP2
       NoDerivativeInstrumentPartySubIDs() : FIX::Group(1296,1297,FIX::message_order(1297,1298,0)) {}
         FIELD_SET(*this, FIX::DerivativeInstrumentPartySubID);
         FIELD_SET(*this, FIX::DerivativeInstrumentPartySubIDType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::DerivativeInstrumentPartySubID);
+          FIELD_VIEW(*m_pMap, FIX::DerivativeInstrumentPartySubIDType);
+        };
+      };
+      FIX::GroupView<NoDerivativeInstrumentPartySubIDs::View> noDerivativeInstrumentPartySubIDs() const
+      { return FIX::GroupView<NoDerivativeInstrumentPartySubIDs::View>( *this, FIX::FIELD::NoDerivativeInstrumentPartySubIDs ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::DerivativeInstrumentPartyID);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeInstrumentPartyIDSource);
+        FIELD_VIEW(*m_pMap, FIX::DerivativeInstrumentPartyRole);
+        FIELD_VIEW(*m_pMap, FIX::NoDerivativeInstrumentPartySubIDs);
+        FIX::GroupView<NoDerivativeInstrumentPartySubIDs::View> noDerivativeInstrumentPartySubIDs() const
+        { return FIX::GroupView<NoDerivativeInstrumentPartySubIDs::View>( *m_pMap, FIX::FIELD::NoDerivativeInstrumentPartySubIDs ); }
       };
     };
+    FIX::GroupView<NoDerivativeInstrumentParties::View> noDerivativeInstrumentParties() const
+    { return FIX::GroupView<NoDerivativeInstrumentParties::View>( *this, FIX::FIELD::NoDerivativeInstrumentParties ); }
     FIELD_SET(*this, FIX::DerivativeContractMultiplierUnit);
     FIELD_SET(*this, FIX::DerivativeFlowScheduleType);
     FIELD_SET(*this, FIX::SecuritySubType);
@@ -233,6 +316,604 @@ namespace FIX50SP2
     FIELD_SET(*this, FIX::TradingSessionID);
     FIELD_SET(*this, FIX::TradingSessionSubID);
     FIELD_SET(*this, FIX::SubscriptionRequestType);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView securityReqID() const
+      { return getString( FIX::FIELD::SecurityReqID ); }
+      int securityListRequestType() const
+      { return getInt( FIX::FIELD::SecurityListRequestType ); }
+      FIX::StringView marketID() const
+      { return getString( FIX::FIELD::MarketID ); }
+      FIX::StringView marketSegmentID() const
+      { return getString( FIX::FIELD::MarketSegmentID ); }
+      FIX::StringView underlyingSymbol() const
+      { return getString( FIX::FIELD::UnderlyingSymbol ); }
+      FIX::StringView underlyingSymbolSfx() const
+      { return getString( FIX::FIELD::UnderlyingSymbolSfx ); }
+      FIX::StringView underlyingSecurityID() const
+      { return getString( FIX::FIELD::UnderlyingSecurityID ); }
+      FIX::StringView underlyingSecurityIDSource() const
+      { return getString( FIX::FIELD::UnderlyingSecurityIDSource ); }
+      int noUnderlyingSecurityAltID() const
+      { return getInt( FIX::FIELD::NoUnderlyingSecurityAltID ); }
+      int underlyingProduct() const
+      { return getInt( FIX::FIELD::UnderlyingProduct ); }
+      FIX::StringView underlyingCFICode() const
+      { return getString( FIX::FIELD::UnderlyingCFICode ); }
+      FIX::StringView underlyingSecurityType() const
+      { return getString( FIX::FIELD::UnderlyingSecurityType ); }
+      FIX::StringView underlyingSecuritySubType() const
+      { return getString( FIX::FIELD::UnderlyingSecuritySubType ); }
+      FIX::StringView underlyingMaturityMonthYear() const
+      { return getString( FIX::FIELD::UnderlyingMaturityMonthYear ); }
+      FIX::StringView underlyingMaturityDate() const
+      { return getString( FIX::FIELD::UnderlyingMaturityDate ); }
+      FIX::StringView underlyingMaturityTime() const
+      { return getString( FIX::FIELD::UnderlyingMaturityTime ); }
+      FIX::StringView underlyingCouponPaymentDate() const
+      { return getString( FIX::FIELD::UnderlyingCouponPaymentDate ); }
+      FIX::StringView underlyingIssueDate() const
+      { return getString( FIX::FIELD::UnderlyingIssueDate ); }
+      FIX::StringView underlyingRepoCollateralSecurityType() const
+      { return getString( FIX::FIELD::UnderlyingRepoCollateralSecurityType ); }
+      int underlyingRepurchaseTerm() const
+      { return getInt( FIX::FIELD::UnderlyingRepurchaseTerm ); }
+      FIX::Decimal underlyingRepurchaseRate() const
+      { return getDecimal( FIX::FIELD::UnderlyingRepurchaseRate ); }
+      double underlyingFactor() const
+      { return getDouble( FIX::FIELD::UnderlyingFactor ); }
+      FIX::StringView underlyingCreditRating() const
+      { return getString( FIX::FIELD::UnderlyingCreditRating ); }
+      FIX::StringView underlyingInstrRegistry() const
+      { return getString( FIX::FIELD::UnderlyingInstrRegistry ); }
+      FIX::StringView underlyingCountryOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingCountryOfIssue ); }
+      FIX::StringView underlyingStateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingStateOrProvinceOfIssue ); }
+      FIX::StringView underlyingLocaleOfIssue() const
+      { return getString( FIX::FIELD::UnderlyingLocaleOfIssue ); }
+      FIX::StringView underlyingRedemptionDate() const
+      { return getString( FIX::FIELD::UnderlyingRedemptionDate ); }
+      FIX::Decimal underlyingStrikePrice() const
+      { return getDecimal( FIX::FIELD::UnderlyingStrikePrice ); }
+      FIX::StringView underlyingStrikeCurrency() const
+      { return getString( FIX::FIELD::UnderlyingStrikeCurrency ); }
+      char underlyingOptAttribute() const
+      { return getChar( FIX::FIELD::UnderlyingOptAttribute ); }
+      double underlyingContractMultiplier() const
+      { return getDouble( FIX::FIELD::UnderlyingContractMultiplier ); }
+      FIX::StringView underlyingUnitOfMeasure() const
+      { return getString( FIX::FIELD::UnderlyingUnitOfMeasure ); }
+      FIX::Decimal underlyingUnitOfMeasureQty() const
+      { return getDecimal( FIX::FIELD::UnderlyingUnitOfMeasureQty ); }
+      FIX::StringView underlyingPriceUnitOfMeasure() const
+      { return getString( FIX::FIELD::UnderlyingPriceUnitOfMeasure ); }
+      FIX::Decimal underlyingPriceUnitOfMeasureQty() const
+      { return getDecimal( FIX::FIELD::UnderlyingPriceUnitOfMeasureQty ); }
+      FIX::StringView underlyingTimeUnit() const
+      { return getString( FIX::FIELD::UnderlyingTimeUnit ); }
+      int underlyingExerciseStyle() const
+      { return getInt( FIX::FIELD::UnderlyingExerciseStyle ); }
+      FIX::Decimal underlyingCouponRate() const
+      { return getDecimal( FIX::FIELD::UnderlyingCouponRate ); }
+      FIX::StringView underlyingSecurityExchange() const
+      { return getString( FIX::FIELD::UnderlyingSecurityExchange ); }
+      FIX::StringView underlyingIssuer() const
+      { return getString( FIX::FIELD::UnderlyingIssuer ); }
+      int encodedUnderlyingIssuerLen() const
+      { return getInt( FIX::FIELD::EncodedUnderlyingIssuerLen ); }
+      FIX::StringView encodedUnderlyingIssuer() const
+      { return getString( FIX::FIELD::EncodedUnderlyingIssuer ); }
+      FIX::StringView underlyingSecurityDesc() const
+      { return getString( FIX::FIELD::UnderlyingSecurityDesc ); }
+      int encodedUnderlyingSecurityDescLen() const
+      { return getInt( FIX::FIELD::EncodedUnderlyingSecurityDescLen ); }
+      FIX::StringView encodedUnderlyingSecurityDesc() const
+      { return getString( FIX::FIELD::EncodedUnderlyingSecurityDesc ); }
+      FIX::StringView underlyingCPProgram() const
+      { return getString( FIX::FIELD::UnderlyingCPProgram ); }
+      FIX::StringView underlyingCPRegType() const
+      { return getString( FIX::FIELD::UnderlyingCPRegType ); }
+      FIX::Decimal underlyingAllocationPercent() const
+      { return getDecimal( FIX::FIELD::UnderlyingAllocationPercent ); }
+      FIX::StringView underlyingCurrency() const
+      { return getString( FIX::FIELD::UnderlyingCurrency ); }
+      FIX::Decimal underlyingQty() const
+      { return getDecimal( FIX::FIELD::UnderlyingQty ); }
+      int underlyingSettlementType() const
+      { return getInt( FIX::FIELD::UnderlyingSettlementType ); }
+      FIX::Decimal underlyingCashAmount() const
+      { return getDecimal( FIX::FIELD::UnderlyingCashAmount ); }
+      FIX::StringView underlyingCashType() const
+      { return getString( FIX::FIELD::UnderlyingCashType ); }
+      FIX::Decimal underlyingPx() const
+      { return getDecimal( FIX::FIELD::UnderlyingPx ); }
+      FIX::Decimal underlyingDirtyPrice() const
+      { return getDecimal( FIX::FIELD::UnderlyingDirtyPrice ); }
+      FIX::Decimal underlyingEndPrice() const
+      { return getDecimal( FIX::FIELD::UnderlyingEndPrice ); }
+      FIX::Decimal underlyingStartValue() const
+      { return getDecimal( FIX::FIELD::UnderlyingStartValue ); }
+      FIX::Decimal underlyingCurrentValue() const
+      { return getDecimal( FIX::FIELD::UnderlyingCurrentValue ); }
+      FIX::Decimal underlyingEndValue() const
+      { return getDecimal( FIX::FIELD::UnderlyingEndValue ); }
+      int noUnderlyingStips() const
+      { return getInt( FIX::FIELD::NoUnderlyingStips ); }
+      FIX::Decimal underlyingAdjustedQuantity() const
+      { return getDecimal( FIX::FIELD::UnderlyingAdjustedQuantity ); }
+      double underlyingFXRate() const
+      { return getDouble( FIX::FIELD::UnderlyingFXRate ); }
+      FIX::UnderlyingFXRateCalc underlyingFXRateCalc() const
+      { return FIX::UnderlyingFXRateCalc( getChar( FIX::FIELD::UnderlyingFXRateCalc ) ); }
+      FIX::Decimal underlyingCapValue() const
+      { return getDecimal( FIX::FIELD::UnderlyingCapValue ); }
+      int noUndlyInstrumentParties() const
+      { return getInt( FIX::FIELD::NoUndlyInstrumentParties ); }
+      FIX::StringView underlyingSettlMethod() const
+      { return getString( FIX::FIELD::UnderlyingSettlMethod ); }
+      int underlyingPutOrCall() const
+      { return getInt( FIX::FIELD::UnderlyingPutOrCall ); }
+      int underlyingContractMultiplierUnit() const
+      { return getInt( FIX::FIELD::UnderlyingContractMultiplierUnit ); }
+      int underlyingFlowScheduleType() const
+      { return getInt( FIX::FIELD::UnderlyingFlowScheduleType ); }
+      FIX::StringView underlyingRestructuringType() const
+      { return getString( FIX::FIELD::UnderlyingRestructuringType ); }
+      FIX::StringView underlyingSeniority() const
+      { return getString( FIX::FIELD::UnderlyingSeniority ); }
+      FIX::Decimal underlyingNotionalPercentageOutstanding() const
+      { return getDecimal( FIX::FIELD::UnderlyingNotionalPercentageOutstanding ); }
+      FIX::Decimal underlyingOriginalNotionalPercentageOutstanding() const
+      { return getDecimal( FIX::FIELD::UnderlyingOriginalNotionalPercentageOutstanding ); }
+      FIX::Decimal underlyingAttachmentPoint() const
+      { return getDecimal( FIX::FIELD::UnderlyingAttachmentPoint ); }
+      FIX::Decimal underlyingDetachmentPoint() const
+      { return getDecimal( FIX::FIELD::UnderlyingDetachmentPoint ); }
+      FIX::StringView derivativeSymbol() const
+      { return getString( FIX::FIELD::DerivativeSymbol ); }
+      FIX::StringView derivativeSymbolSfx() const
+      { return getString( FIX::FIELD::DerivativeSymbolSfx ); }
+      FIX::StringView derivativeSecurityID() const
+      { return getString( FIX::FIELD::DerivativeSecurityID ); }
+      FIX::StringView derivativeSecurityIDSource() const
+      { return getString( FIX::FIELD::DerivativeSecurityIDSource ); }
+      int noDerivativeSecurityAltID() const
+      { return getInt( FIX::FIELD::NoDerivativeSecurityAltID ); }
+      int derivativeProduct() const
+      { return getInt( FIX::FIELD::DerivativeProduct ); }
+      FIX::StringView derivativeProductComplex() const
+      { return getString( FIX::FIELD::DerivativeProductComplex ); }
+      bool derivFlexProductEligibilityIndicator() const
+      { return getBool( FIX::FIELD::DerivFlexProductEligibilityIndicator ); }
+      FIX::StringView derivativeSecurityGroup() const
+      { return getString( FIX::FIELD::DerivativeSecurityGroup ); }
+      FIX::StringView derivativeCFICode() const
+      { return getString( FIX::FIELD::DerivativeCFICode ); }
+      FIX::StringView derivativeSecurityType() const
+      { return getString( FIX::FIELD::DerivativeSecurityType ); }
+      FIX::StringView derivativeSecuritySubType() const
+      { return getString( FIX::FIELD::DerivativeSecuritySubType ); }
+      FIX::StringView derivativeMaturityMonthYear() const
+      { return getString( FIX::FIELD::DerivativeMaturityMonthYear ); }
+      FIX::StringView derivativeMaturityDate() const
+      { return getString( FIX::FIELD::DerivativeMaturityDate ); }
+      FIX::StringView derivativeMaturityTime() const
+      { return getString( FIX::FIELD::DerivativeMaturityTime ); }
+      FIX::StringView derivativeSettleOnOpenFlag() const
+      { return getString( FIX::FIELD::DerivativeSettleOnOpenFlag ); }
+      char derivativeInstrmtAssignmentMethod() const
+      { return getChar( FIX::FIELD::DerivativeInstrmtAssignmentMethod ); }
+      FIX::StringView derivativeSecurityStatus() const
+      { return getString( FIX::FIELD::DerivativeSecurityStatus ); }
+      FIX::StringView derivativeIssueDate() const
+      { return getString( FIX::FIELD::DerivativeIssueDate ); }
+      FIX::StringView derivativeInstrRegistry() const
+      { return getString( FIX::FIELD::DerivativeInstrRegistry ); }
+      FIX::StringView derivativeCountryOfIssue() const
+      { return getString( FIX::FIELD::DerivativeCountryOfIssue ); }
+      FIX::StringView derivativeStateOrProvinceOfIssue() const
+      { return getString( FIX::FIELD::DerivativeStateOrProvinceOfIssue ); }
+      FIX::StringView derivativeLocaleOfIssue() const
+      { return getString( FIX::FIELD::DerivativeLocaleOfIssue ); }
+      FIX::Decimal derivativeStrikePrice() const
+      { return getDecimal( FIX::FIELD::DerivativeStrikePrice ); }
+      FIX::StringView derivativeStrikeCurrency() const
+      { return getString( FIX::FIELD::DerivativeStrikeCurrency ); }
+      double derivativeStrikeMultiplier() const
+      { return getDouble( FIX::FIELD::DerivativeStrikeMultiplier ); }
+      double derivativeStrikeValue() const
+      { return getDouble( FIX::FIELD::DerivativeStrikeValue ); }
+      char derivativeOptAttribute() const
+      { return getChar( FIX::FIELD::DerivativeOptAttribute ); }
+      double derivativeContractMultiplier() const
+      { return getDouble( FIX::FIELD::DerivativeContractMultiplier ); }
+      double derivativeMinPriceIncrement() const
+      { return getDouble( FIX::FIELD::DerivativeMinPriceIncrement ); }
+      FIX::Decimal derivativeMinPriceIncrementAmount() const
+      { return getDecimal( FIX::FIELD::DerivativeMinPriceIncrementAmount ); }
+      FIX::StringView derivativeUnitOfMeasure() const
+      { return getString( FIX::FIELD::DerivativeUnitOfMeasure ); }
+      FIX::Decimal derivativeUnitOfMeasureQty() const
+      { return getDecimal( FIX::FIELD::DerivativeUnitOfMeasureQty ); }
+      FIX::StringView derivativePriceUnitOfMeasure() const
+      { return getString( FIX::FIELD::DerivativePriceUnitOfMeasure ); }
+      FIX::Decimal derivativePriceUnitOfMeasureQty() const
+      { return getDecimal( FIX::FIELD::DerivativePriceUnitOfMeasureQty ); }
+      char derivativeSettlMethod() const
+      { return getChar( FIX::FIELD::DerivativeSettlMethod ); }
+      FIX::StringView derivativePriceQuoteMethod() const
+      { return getString( FIX::FIELD::DerivativePriceQuoteMethod ); }
+      FIX::StringView derivativeValuationMethod() const
+      { return getString( FIX::FIELD::DerivativeValuationMethod ); }
+      int derivativeListMethod() const
+      { return getInt( FIX::FIELD::DerivativeListMethod ); }
+      FIX::Decimal derivativeCapPrice() const
+      { return getDecimal( FIX::FIELD::DerivativeCapPrice ); }
+      FIX::Decimal derivativeFloorPrice() const
+      { return getDecimal( FIX::FIELD::DerivativeFloorPrice ); }
+      int derivativePutOrCall() const
+      { return getInt( FIX::FIELD::DerivativePutOrCall ); }
+      char derivativeExerciseStyle() const
+      { return getChar( FIX::FIELD::DerivativeExerciseStyle ); }
+      FIX::Decimal derivativeOptPayAmount() const
+      { return getDecimal( FIX::FIELD::DerivativeOptPayAmount ); }
+      FIX::StringView derivativeTimeUnit() const
+      { return getString( FIX::FIELD::DerivativeTimeUnit ); }
+      FIX::StringView derivativeSecurityExchange() const
+      { return getString( FIX::FIELD::DerivativeSecurityExchange ); }
+      int derivativePositionLimit() const
+      { return getInt( FIX::FIELD::DerivativePositionLimit ); }
+      int derivativeNTPositionLimit() const
+      { return getInt( FIX::FIELD::DerivativeNTPositionLimit ); }
+      FIX::StringView derivativeIssuer() const
+      { return getString( FIX::FIELD::DerivativeIssuer ); }
+      int derivativeEncodedIssuerLen() const
+      { return getInt( FIX::FIELD::DerivativeEncodedIssuerLen ); }
+      FIX::StringView derivativeEncodedIssuer() const
+      { return getString( FIX::FIELD::DerivativeEncodedIssuer ); }
+      FIX::StringView derivativeSecurityDesc() const
+      { return getString( FIX::FIELD::DerivativeSecurityDesc ); }
+      int derivativeEncodedSecurityDescLen() const
+      { return getInt( FIX::FIELD::DerivativeEncodedSecurityDescLen ); }
+      FIX::StringView derivativeEncodedSecurityDesc() const
+      { return getString( FIX::FIELD::DerivativeEncodedSecurityDesc ); }
+      int derivativeSecurityXMLLen() const
+      { return getInt( FIX::FIELD::DerivativeSecurityXMLLen ); }
+      FIX::StringView derivativeSecurityXML() const
+      { return getString( FIX::FIELD::DerivativeSecurityXML ); }
+      FIX::StringView derivativeSecurityXMLSchema() const
+      { return getString( FIX::FIELD::DerivativeSecurityXMLSchema ); }
+      FIX::StringView derivativeContractSettlMonth() const
+      { return getString( FIX::FIELD::DerivativeContractSettlMonth ); }
+      int noDerivativeEvents() const
+      { return getInt( FIX::FIELD::NoDerivativeEvents ); }
+      int noDerivativeInstrumentParties() const
+      { return getInt( FIX::FIELD::NoDerivativeInstrumentParties ); }
+      int derivativeContractMultiplierUnit() const
+      { return getInt( FIX::FIELD::DerivativeContractMultiplierUnit ); }
+      int derivativeFlowScheduleType() const
+      { return getInt( FIX::FIELD::DerivativeFlowScheduleType ); }
+      FIX::StringView securitySubType() const
+      { return getString( FIX::FIELD::SecuritySubType ); }
+      FIX::StringView currency() const
+      { return getString( FIX::FIELD::Currency ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+      FIX::StringView tradingSessionID() const
+      { return getString( FIX::FIELD::TradingSessionID ); }
+      FIX::StringView tradingSessionSubID() const
+      { return getString( FIX::FIELD::TradingSessionSubID ); }
+      FIX::SubscriptionRequestType subscriptionRequestType() const
+      { return FIX::SubscriptionRequestType( getChar( FIX::FIELD::SubscriptionRequestType ) ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "z" ) {}
+      void setSecurityReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecurityReqID, value ); }
+      void setSecurityListRequestType( int value )
+      { setInt( FIX::FIELD::SecurityListRequestType, value ); }
+      void setMarketID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MarketID, value ); }
+      void setMarketSegmentID( const FIX::StringView& value )
+      { setString( FIX::FIELD::MarketSegmentID, value ); }
+      void setUnderlyingSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSymbol, value ); }
+      void setUnderlyingSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSymbolSfx, value ); }
+      void setUnderlyingSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityID, value ); }
+      void setUnderlyingSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityIDSource, value ); }
+      void setNoUnderlyingSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoUnderlyingSecurityAltID, value ); }
+      void setUnderlyingProduct( int value )
+      { setInt( FIX::FIELD::UnderlyingProduct, value ); }
+      void setUnderlyingCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCFICode, value ); }
+      void setUnderlyingSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityType, value ); }
+      void setUnderlyingSecuritySubType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecuritySubType, value ); }
+      void setUnderlyingMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingMaturityMonthYear, value ); }
+      void setUnderlyingMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingMaturityDate, value ); }
+      void setUnderlyingMaturityTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingMaturityTime, value ); }
+      void setUnderlyingCouponPaymentDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCouponPaymentDate, value ); }
+      void setUnderlyingIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingIssueDate, value ); }
+      void setUnderlyingRepoCollateralSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingRepoCollateralSecurityType, value ); }
+      void setUnderlyingRepurchaseTerm( int value )
+      { setInt( FIX::FIELD::UnderlyingRepurchaseTerm, value ); }
+      void setUnderlyingRepurchaseRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingRepurchaseRate, value ); }
+      void setUnderlyingFactor( double value )
+      { setDouble( FIX::FIELD::UnderlyingFactor, value ); }
+      void setUnderlyingCreditRating( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCreditRating, value ); }
+      void setUnderlyingInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingInstrRegistry, value ); }
+      void setUnderlyingCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCountryOfIssue, value ); }
+      void setUnderlyingStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingStateOrProvinceOfIssue, value ); }
+      void setUnderlyingLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingLocaleOfIssue, value ); }
+      void setUnderlyingRedemptionDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingRedemptionDate, value ); }
+      void setUnderlyingStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingStrikePrice, value ); }
+      void setUnderlyingStrikeCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingStrikeCurrency, value ); }
+      void setUnderlyingOptAttribute( char value )
+      { setChar( FIX::FIELD::UnderlyingOptAttribute, value ); }
+      void setUnderlyingContractMultiplier( double value )
+      { setDouble( FIX::FIELD::UnderlyingContractMultiplier, value ); }
+      void setUnderlyingUnitOfMeasure( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingUnitOfMeasure, value ); }
+      void setUnderlyingUnitOfMeasureQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingUnitOfMeasureQty, value ); }
+      void setUnderlyingPriceUnitOfMeasure( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingPriceUnitOfMeasure, value ); }
+      void setUnderlyingPriceUnitOfMeasureQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingPriceUnitOfMeasureQty, value ); }
+      void setUnderlyingTimeUnit( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingTimeUnit, value ); }
+      void setUnderlyingExerciseStyle( int value )
+      { setInt( FIX::FIELD::UnderlyingExerciseStyle, value ); }
+      void setUnderlyingCouponRate( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingCouponRate, value ); }
+      void setUnderlyingSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityExchange, value ); }
+      void setUnderlyingIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingIssuer, value ); }
+      void setEncodedUnderlyingIssuerLen( int value )
+      { setInt( FIX::FIELD::EncodedUnderlyingIssuerLen, value ); }
+      void setEncodedUnderlyingIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedUnderlyingIssuer, value ); }
+      void setUnderlyingSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSecurityDesc, value ); }
+      void setEncodedUnderlyingSecurityDescLen( int value )
+      { setInt( FIX::FIELD::EncodedUnderlyingSecurityDescLen, value ); }
+      void setEncodedUnderlyingSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedUnderlyingSecurityDesc, value ); }
+      void setUnderlyingCPProgram( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCPProgram, value ); }
+      void setUnderlyingCPRegType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCPRegType, value ); }
+      void setUnderlyingAllocationPercent( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingAllocationPercent, value ); }
+      void setUnderlyingCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCurrency, value ); }
+      void setUnderlyingQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingQty, value ); }
+      void setUnderlyingSettlementType( int value )
+      { setInt( FIX::FIELD::UnderlyingSettlementType, value ); }
+      void setUnderlyingCashAmount( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingCashAmount, value ); }
+      void setUnderlyingCashType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingCashType, value ); }
+      void setUnderlyingPx( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingPx, value ); }
+      void setUnderlyingDirtyPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingDirtyPrice, value ); }
+      void setUnderlyingEndPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingEndPrice, value ); }
+      void setUnderlyingStartValue( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingStartValue, value ); }
+      void setUnderlyingCurrentValue( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingCurrentValue, value ); }
+      void setUnderlyingEndValue( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingEndValue, value ); }
+      void setNoUnderlyingStips( int value )
+      { setInt( FIX::FIELD::NoUnderlyingStips, value ); }
+      void setUnderlyingAdjustedQuantity( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingAdjustedQuantity, value ); }
+      void setUnderlyingFXRate( double value )
+      { setDouble( FIX::FIELD::UnderlyingFXRate, value ); }
+      void setUnderlyingFXRateCalc( char value )
+      { setChar( FIX::FIELD::UnderlyingFXRateCalc, value ); }
+      void setUnderlyingCapValue( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingCapValue, value ); }
+      void setNoUndlyInstrumentParties( int value )
+      { setInt( FIX::FIELD::NoUndlyInstrumentParties, value ); }
+      void setUnderlyingSettlMethod( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSettlMethod, value ); }
+      void setUnderlyingPutOrCall( int value )
+      { setInt( FIX::FIELD::UnderlyingPutOrCall, value ); }
+      void setUnderlyingContractMultiplierUnit( int value )
+      { setInt( FIX::FIELD::UnderlyingContractMultiplierUnit, value ); }
+      void setUnderlyingFlowScheduleType( int value )
+      { setInt( FIX::FIELD::UnderlyingFlowScheduleType, value ); }
+      void setUnderlyingRestructuringType( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingRestructuringType, value ); }
+      void setUnderlyingSeniority( const FIX::StringView& value )
+      { setString( FIX::FIELD::UnderlyingSeniority, value ); }
+      void setUnderlyingNotionalPercentageOutstanding( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingNotionalPercentageOutstanding, value ); }
+      void setUnderlyingOriginalNotionalPercentageOutstanding( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingOriginalNotionalPercentageOutstanding, value ); }
+      void setUnderlyingAttachmentPoint( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingAttachmentPoint, value ); }
+      void setUnderlyingDetachmentPoint( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::UnderlyingDetachmentPoint, value ); }
+      void setDerivativeSymbol( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSymbol, value ); }
+      void setDerivativeSymbolSfx( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSymbolSfx, value ); }
+      void setDerivativeSecurityID( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityID, value ); }
+      void setDerivativeSecurityIDSource( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityIDSource, value ); }
+      void setNoDerivativeSecurityAltID( int value )
+      { setInt( FIX::FIELD::NoDerivativeSecurityAltID, value ); }
+      void setDerivativeProduct( int value )
+      { setInt( FIX::FIELD::DerivativeProduct, value ); }
+      void setDerivativeProductComplex( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeProductComplex, value ); }
+      void setDerivFlexProductEligibilityIndicator( bool value )
+      { setBool( FIX::FIELD::DerivFlexProductEligibilityIndicator, value ); }
+      void setDerivativeSecurityGroup( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityGroup, value ); }
+      void setDerivativeCFICode( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeCFICode, value ); }
+      void setDerivativeSecurityType( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityType, value ); }
+      void setDerivativeSecuritySubType( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecuritySubType, value ); }
+      void setDerivativeMaturityMonthYear( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeMaturityMonthYear, value ); }
+      void setDerivativeMaturityDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeMaturityDate, value ); }
+      void setDerivativeMaturityTime( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeMaturityTime, value ); }
+      void setDerivativeSettleOnOpenFlag( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSettleOnOpenFlag, value ); }
+      void setDerivativeInstrmtAssignmentMethod( char value )
+      { setChar( FIX::FIELD::DerivativeInstrmtAssignmentMethod, value ); }
+      void setDerivativeSecurityStatus( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityStatus, value ); }
+      void setDerivativeIssueDate( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeIssueDate, value ); }
+      void setDerivativeInstrRegistry( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeInstrRegistry, value ); }
+      void setDerivativeCountryOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeCountryOfIssue, value ); }
+      void setDerivativeStateOrProvinceOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeStateOrProvinceOfIssue, value ); }
+      void setDerivativeLocaleOfIssue( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeLocaleOfIssue, value ); }
+      void setDerivativeStrikePrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DerivativeStrikePrice, value ); }
+      void setDerivativeStrikeCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeStrikeCurrency, value ); }
+      void setDerivativeStrikeMultiplier( double value )
+      { setDouble( FIX::FIELD::DerivativeStrikeMultiplier, value ); }
+      void setDerivativeStrikeValue( double value )
+      { setDouble( FIX::FIELD::DerivativeStrikeValue, value ); }
+      void setDerivativeOptAttribute( char value )
+      { setChar( FIX::FIELD::DerivativeOptAttribute, value ); }
+      void setDerivativeContractMultiplier( double value )
+      { setDouble( FIX::FIELD::DerivativeContractMultiplier, value ); }
+      void setDerivativeMinPriceIncrement( double value )
+      { setDouble( FIX::FIELD::DerivativeMinPriceIncrement, value ); }
+      void setDerivativeMinPriceIncrementAmount( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DerivativeMinPriceIncrementAmount, value ); }
+      void setDerivativeUnitOfMeasure( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeUnitOfMeasure, value ); }
+      void setDerivativeUnitOfMeasureQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DerivativeUnitOfMeasureQty, value ); }
+      void setDerivativePriceUnitOfMeasure( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativePriceUnitOfMeasure, value ); }
+      void setDerivativePriceUnitOfMeasureQty( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DerivativePriceUnitOfMeasureQty, value ); }
+      void setDerivativeSettlMethod( char value )
+      { setChar( FIX::FIELD::DerivativeSettlMethod, value ); }
+      void setDerivativePriceQuoteMethod( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativePriceQuoteMethod, value ); }
+      void setDerivativeValuationMethod( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeValuationMethod, value ); }
+      void setDerivativeListMethod( int value )
+      { setInt( FIX::FIELD::DerivativeListMethod, value ); }
+      void setDerivativeCapPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DerivativeCapPrice, value ); }
+      void setDerivativeFloorPrice( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DerivativeFloorPrice, value ); }
+      void setDerivativePutOrCall( int value )
+      { setInt( FIX::FIELD::DerivativePutOrCall, value ); }
+      void setDerivativeExerciseStyle( char value )
+      { setChar( FIX::FIELD::DerivativeExerciseStyle, value ); }
+      void setDerivativeOptPayAmount( const FIX::Decimal& value )
+      { setDecimal( FIX::FIELD::DerivativeOptPayAmount, value ); }
+      void setDerivativeTimeUnit( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeTimeUnit, value ); }
+      void setDerivativeSecurityExchange( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityExchange, value ); }
+      void setDerivativePositionLimit( int value )
+      { setInt( FIX::FIELD::DerivativePositionLimit, value ); }
+      void setDerivativeNTPositionLimit( int value )
+      { setInt( FIX::FIELD::DerivativeNTPositionLimit, value ); }
+      void setDerivativeIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeIssuer, value ); }
+      void setDerivativeEncodedIssuerLen( int value )
+      { setInt( FIX::FIELD::DerivativeEncodedIssuerLen, value ); }
+      void setDerivativeEncodedIssuer( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeEncodedIssuer, value ); }
+      void setDerivativeSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityDesc, value ); }
+      void setDerivativeEncodedSecurityDescLen( int value )
+      { setInt( FIX::FIELD::DerivativeEncodedSecurityDescLen, value ); }
+      void setDerivativeEncodedSecurityDesc( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeEncodedSecurityDesc, value ); }
+      void setDerivativeSecurityXMLLen( int value )
+      { setInt( FIX::FIELD::DerivativeSecurityXMLLen, value ); }
+      void setDerivativeSecurityXML( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityXML, value ); }
+      void setDerivativeSecurityXMLSchema( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeSecurityXMLSchema, value ); }
+      void setDerivativeContractSettlMonth( const FIX::StringView& value )
+      { setString( FIX::FIELD::DerivativeContractSettlMonth, value ); }
+      void setNoDerivativeEvents( int value )
+      { setInt( FIX::FIELD::NoDerivativeEvents, value ); }
+      void setNoDerivativeInstrumentParties( int value )
+      { setInt( FIX::FIELD::NoDerivativeInstrumentParties, value ); }
+      void setDerivativeContractMultiplierUnit( int value )
+      { setInt( FIX::FIELD::DerivativeContractMultiplierUnit, value ); }
+      void setDerivativeFlowScheduleType( int value )
+      { setInt( FIX::FIELD::DerivativeFlowScheduleType, value ); }
+      void setSecuritySubType( const FIX::StringView& value )
+      { setString( FIX::FIELD::SecuritySubType, value ); }
+      void setCurrency( const FIX::StringView& value )
+      { setString( FIX::FIELD::Currency, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+      void setTradingSessionID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionID, value ); }
+      void setTradingSessionSubID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradingSessionSubID, value ); }
+      void setSubscriptionRequestType( char value )
+      { setChar( FIX::FIELD::SubscriptionRequestType, value ); }
+    };
   };
 
 }
@@ -39,6 +39,53 @@ namespace FIX50SP2
       FIELD_SET(*this, FIX::DeskID);
       FIELD_SET(*this, FIX::StatusValue);
       FIELD_SET(*this, FIX::StatusText);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::RefCompID);
+        FIELD_VIEW(*m_pMap, FIX::RefSubID);
+        FIELD_VIEW(*m_pMap, FIX::LocationID);
+        FIELD_VIEW(*m_pMap, FIX::DeskID);
+        FIELD_VIEW(*m_pMap, FIX::StatusValue);
+        FIELD_VIEW(*m_pMap, FIX::StatusText);
+      };
+    };
+    FIX::GroupView<NoCompIDs::View> noCompIDs() const
+    { return FIX::GroupView<NoCompIDs::View>( *this, FIX::FIELD::NoCompIDs ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      int networkStatusResponseType() const
+      { return getInt( FIX::FIELD::NetworkStatusResponseType ); }
+      FIX::StringView networkRequestID() const
+      { return getString( FIX::FIELD::NetworkRequestID ); }
+      FIX::StringView networkResponseID() const
+      { return getString( FIX::FIELD::NetworkResponseID ); }
+      FIX::StringView lastNetworkResponseID() const
+      { return getString( FIX::FIELD::LastNetworkResponseID ); }
+      int noCompIDs() const
+      { return getInt( FIX::FIELD::NoCompIDs ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "BD" ) {}
+      void setNetworkStatusResponseType( int value )
+      { setInt( FIX::FIELD::NetworkStatusResponseType, value ); }
+      void setNetworkRequestID( const FIX::StringView& value )
+      { setString( FIX::FIELD::NetworkRequestID, value ); }
+      void setNetworkResponseID( const FIX::StringView& value )
+      { setString( FIX::FIELD::NetworkResponseID, value ); }
+      void setLastNetworkResponseID( const FIX::StringView& value )
+      { setString( FIX::FIELD::LastNetworkResponseID, value ); }
+      void setNoCompIDs( int value )
+      { setInt( FIX::FIELD::NoCompIDs, value ); }
     };
   };
 
@@ -45,8 +45,30 @@ namespace FIX50SP2
         NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
           FIELD_SET(*this, FIX::PartySubID);
           FIELD_SET(*this, FIX::PartySubIDType);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::PartySubID);
+            FIELD_VIEW(*m_pMap, FIX::PartySubIDType);
+          };
+        };
+        FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+        { return FIX::GroupView<NoPartySubIDs::View>( *this, FIX::FIELD::NoPartySubIDs ); }
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::PartyID);
+          FIELD_VIEW(*m_pMap, FIX::PartyIDSource);
+          FIELD_VIEW(*m_pMap, FIX::PartyRole);
+          FIELD_VIEW(*m_pMap, FIX::NoPartySubIDs);
+          FIX::GroupView<NoPartySubIDs::View> noPartySubIDs() const
+          { return FIX::GroupView<NoPartySubIDs::View>( *m_pMap, FIX::FIELD::NoPartySubIDs ); }
         };
       };
+      FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+      { return FIX::GroupView<NoPartyIDs::View>( *this, FIX::FIELD::NoPartyIDs ); }
       FIELD_SET(*this, FIX::NoRelatedSym);
       class NoRelatedSym: public FIX::Group
       {
@@ -63,7 +85,16 @@ namespace FIX50SP2
         NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
           FIELD_SET(*this, FIX::SecurityAltID);
           FIELD_SET(*this, FIX::SecurityAltIDSource);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::SecurityAltID);
+            FIELD_VIEW(*m_pMap, FIX::SecurityAltIDSource);
+          };
         };
+        FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+        { return FIX::GroupView<NoSecurityAltID::View>( *this, FIX::FIELD::NoSecurityAltID ); }
         FIELD_SET(*this, FIX::Product);
         FIELD_SET(*this, FIX::ProductComplex);
         FIELD_SET(*this, FIX::SecurityGroup);
@@ -139,7 +170,19 @@ namespace FIX50SP2
           FIELD_SET(*this, FIX::EventTime);
           FIELD_SET(*this, FIX::EventPx);
           FIELD_SET(*this, FIX::EventText);
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::EventType);
+            FIELD_VIEW(*m_pMap, FIX::EventDate);
+            FIELD_VIEW(*m_pMap, FIX::EventTime);
+            FIELD_VIEW(*m_pMap, FIX::EventPx);
+            FIELD_VIEW(*m_pMap, FIX::EventText);
+          };
         };
+        FIX::GroupView<NoEvents::View> noEvents() const
+        { return FIX::GroupView<NoEvents::View>( *this, FIX::FIELD::NoEvents ); }
         FIELD_SET(*this, FIX::DatedDate);
         FIELD_SET(*this, FIX::InterestAccrualDate);
         FIELD_SET(*this, FIX::NoInstrumentParties);
@@ -157,8 +200,30 @@ namespace FIX50SP2
           NoInstrumentPartySubIDs() : FIX::Group(1052,1053,FIX::message_order(1053,1054,0)) {}
             FIELD_SET(*this, FIX::InstrumentPartySubID);
             FIELD_SET(*this, FIX::InstrumentPartySubIDType);
+            class View : public FIX::GroupEntry
+            {
+            public:
+            View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+              FIELD_VIEW(*m_pMap, FIX::InstrumentPartySubID);
+              FIELD_VIEW(*m_pMap, FIX::InstrumentPartySubIDType);
+            };
+          };
+          FIX::GroupView<NoInstrumentPartySubIDs::View> noInstrumentPartySubIDs() const
+          { return FIX::GroupView<NoInstrumentPartySubIDs::View>( *this, FIX::FIELD::NoInstrumentPartySubIDs ); }
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::InstrumentPartyID);
+            FIELD_VIEW(*m_pMap, FIX::InstrumentPartyIDSource);
+            FIELD_VIEW(*m_pMap, FIX::InstrumentPartyRole);
+            FIELD_VIEW(*m_pMap, FIX::NoInstrumentPartySubIDs);
+            FIX::GroupView<NoInstrumentPartySubIDs::View> noInstrumentPartySubIDs() const
+            { return FIX::GroupView<NoInstrumentPartySubIDs::View>( *m_pMap, FIX::FIELD::NoInstrumentPartySubIDs ); }
           };
         };
+        FIX::GroupView<NoInstrumentParties::View> noInstrumentParties() const
+        { return FIX::GroupView<NoInstrumentParties::View>( *this, FIX::FIELD::NoInstrumentParties ); }
         FIELD_SET(*this, FIX::ContractMultiplierUnit);
         FIELD_SET(*this, FIX::FlowScheduleType);
         FIELD_SET(*this, FIX::RestructuringType);
@@ -198,9 +263,47 @@ namespace FIX50SP2
             NoComplexEventTimes() : FIX::Group(1494,1495,FIX::message_order(1495,1496,0)) {}
               FIELD_SET(*this, FIX::ComplexEventStartTime);
               FIELD_SET(*this, FIX::ComplexEventEndTime);
+              class View : public FIX::GroupEntry
+              {
+              public:
+              View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+                FIELD_VIEW(*m_pMap, FIX::ComplexEventStartTime);
+                FIELD_VIEW(*m_pMap, FIX::ComplexEventEndTime);
+              };
+            };
+            FIX::GroupView<NoComplexEventTimes::View> noComplexEventTimes() const
+            { return FIX::GroupView<NoComplexEventTimes::View>( *this, FIX::FIELD::NoComplexEventTimes ); }
+            class View : public FIX::GroupEntry
+            {
+            public:
+            View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+              FIELD_VIEW(*m_pMap, FIX::ComplexEventStartDate);
+              FIELD_VIEW(*m_pMap, FIX::ComplexEventEndDate);
+              FIELD_VIEW(*m_pMap, FIX::NoComplexEventTimes);
+              FIX::GroupView<NoComplexEventTimes::View> noComplexEventTimes() const
+              { return FIX::GroupView<NoComplexEventTimes::View>( *m_pMap, FIX::FIELD::NoComplexEventTimes ); }
             };
           };
+          FIX::GroupView<NoComplexEventDates::View> noComplexEventDates() const
+          { return FIX::GroupView<NoComplexEventDates::View>( *this, FIX::FIELD::NoComplexEventDates ); }
+          class View : public FIX::GroupEntry
+          {
+          public:
+          View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+            FIELD_VIEW(*m_pMap, FIX::ComplexEventType);
+            FIELD_VIEW(*m_pMap, FIX::ComplexOptPayoutAmount);
+            FIELD_VIEW(*m_pMap, FIX::ComplexEventPrice);
+            FIELD_VIEW(*m_pMap, FIX::ComplexEventPriceBoundaryMethod);
+            FIELD_VIEW(*m_pMap, FIX::ComplexEventPriceBoundaryPrecision);
+            FIELD_VIEW(*m_pMap, FIX::ComplexEventPriceTimeType);
+            FIELD_VIEW(*m_pMap, FIX::ComplexEventCondition);
+            FIELD_VIEW(*m_pMap, FIX::NoComplexEventDates);
+            FIX::GroupView<NoComplexEventDates::View> noComplexEventDates() const
+            { return FIX::GroupView<NoComplexEventDates::View>( *m_pMap, FIX::FIELD::NoComplexEventDates ); }
+          };
         };
+        FIX::GroupView<NoComplexEvents::View> noComplexEvents() const
+        { return FIX::GroupView<NoComplexEvents::View>( *this, FIX::FIELD::NoComplexEvents ); }
         FIELD_SET(*this, FIX::SettlType);
         FIELD_SET(*this, FIX::StreamAsgnType);
         FIELD_SET(*this, FIX::MDStreamID);
@@ -208,7 +311,160 @@ namespace FIX50SP2
         FIELD_SET(*this, FIX::Text);
         FIELD_SET(*this, FIX::EncodedTextLen);
         FIELD_SET(*this, FIX::EncodedText);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::Symbol);
+          FIELD_VIEW(*m_pMap, FIX::SymbolSfx);
+          FIELD_VIEW(*m_pMap, FIX::SecurityID);
+          FIELD_VIEW(*m_pMap, FIX::SecurityIDSource);
+          FIELD_VIEW(*m_pMap, FIX::NoSecurityAltID);
+          FIELD_VIEW(*m_pMap, FIX::Product);
+          FIELD_VIEW(*m_pMap, FIX::ProductComplex);
+          FIELD_VIEW(*m_pMap, FIX::SecurityGroup);
+          FIELD_VIEW(*m_pMap, FIX::CFICode);
+          FIELD_VIEW(*m_pMap, FIX::SecurityType);
+          FIELD_VIEW(*m_pMap, FIX::SecuritySubType);
+          FIELD_VIEW(*m_pMap, FIX::MaturityMonthYear);
+          FIELD_VIEW(*m_pMap, FIX::MaturityDate);
+          FIELD_VIEW(*m_pMap, FIX::MaturityTime);
+          FIELD_VIEW(*m_pMap, FIX::SettleOnOpenFlag);
+          FIELD_VIEW(*m_pMap, FIX::InstrmtAssignmentMethod);
+          FIELD_VIEW(*m_pMap, FIX::SecurityStatus);
+          FIELD_VIEW(*m_pMap, FIX::CouponPaymentDate);
+          FIELD_VIEW(*m_pMap, FIX::IssueDate);
+          FIELD_VIEW(*m_pMap, FIX::RepoCollateralSecurityType);
+          FIELD_VIEW(*m_pMap, FIX::RepurchaseTerm);
+          FIELD_VIEW(*m_pMap, FIX::RepurchaseRate);
+          FIELD_VIEW(*m_pMap, FIX::Factor);
+          FIELD_VIEW(*m_pMap, FIX::CreditRating);
+          FIELD_VIEW(*m_pMap, FIX::InstrRegistry);
+          FIELD_VIEW(*m_pMap, FIX::CountryOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::StateOrProvinceOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::LocaleOfIssue);
+          FIELD_VIEW(*m_pMap, FIX::RedemptionDate);
+          FIELD_VIEW(*m_pMap, FIX::StrikePrice);
+          FIELD_VIEW(*m_pMap, FIX::StrikeCurrency);
+          FIELD_VIEW(*m_pMap, FIX::StrikeMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::StrikeValue);
+          FIELD_VIEW(*m_pMap, FIX::OptAttribute);
+          FIELD_VIEW(*m_pMap, FIX::ContractMultiplier);
+          FIELD_VIEW(*m_pMap, FIX::MinPriceIncrement);
+          FIELD_VIEW(*m_pMap, FIX::MinPriceIncrementAmount);
+          FIELD_VIEW(*m_pMap, FIX::UnitOfMeasure);
+          FIELD_VIEW(*m_pMap, FIX::UnitOfMeasureQty);
+          FIELD_VIEW(*m_pMap, FIX::PriceUnitOfMeasure);
+          FIELD_VIEW(*m_pMap, FIX::PriceUnitOfMeasureQty);
+          FIELD_VIEW(*m_pMap, FIX::SettlMethod);
+          FIELD_VIEW(*m_pMap, FIX::ExerciseStyle);
+          FIELD_VIEW(*m_pMap, FIX::OptPayoutAmount);
+          FIELD_VIEW(*m_pMap, FIX::PriceQuoteMethod);
+          FIELD_VIEW(*m_pMap, FIX::ValuationMethod);
+          FIELD_VIEW(*m_pMap, FIX::ListMethod);
+          FIELD_VIEW(*m_pMap, FIX::CapPrice);
+          FIELD_VIEW(*m_pMap, FIX::FloorPrice);
+          FIELD_VIEW(*m_pMap, FIX::PutOrCall);
+          FIELD_VIEW(*m_pMap, FIX::FlexibleIndicator);
+          FIELD_VIEW(*m_pMap, FIX::FlexProductEligibilityIndicator);
+          FIELD_VIEW(*m_pMap, FIX::TimeUnit);
+          FIELD_VIEW(*m_pMap, FIX::CouponRate);
+          FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+          FIELD_VIEW(*m_pMap, FIX::PositionLimit);
+          FIELD_VIEW(*m_pMap, FIX::NTPositionLimit);
+          FIELD_VIEW(*m_pMap, FIX::Issuer);
+          FIELD_VIEW(*m_pMap, FIX::EncodedIssuerLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedIssuer);
+          FIELD_VIEW(*m_pMap, FIX::SecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDescLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedSecurityDesc);
+          FIELD_VIEW(*m_pMap, FIX::SecurityXMLLen);
+          FIELD_VIEW(*m_pMap, FIX::SecurityXML);
+          FIELD_VIEW(*m_pMap, FIX::SecurityXMLSchema);
+          FIELD_VIEW(*m_pMap, FIX::Pool);
+          FIELD_VIEW(*m_pMap, FIX::ContractSettlMonth);
+          FIELD_VIEW(*m_pMap, FIX::CPProgram);
+          FIELD_VIEW(*m_pMap, FIX::CPRegType);
+          FIELD_VIEW(*m_pMap, FIX::NoEvents);
+          FIELD_VIEW(*m_pMap, FIX::DatedDate);
+          FIELD_VIEW(*m_pMap, FIX::InterestAccrualDate);
+          FIELD_VIEW(*m_pMap, FIX::NoInstrumentParties);
+          FIELD_VIEW(*m_pMap, FIX::ContractMultiplierUnit);
+          FIELD_VIEW(*m_pMap, FIX::FlowScheduleType);
+          FIELD_VIEW(*m_pMap, FIX::RestructuringType);
+          FIELD_VIEW(*m_pMap, FIX::Seniority);
+          FIELD_VIEW(*m_pMap, FIX::NotionalPercentageOutstanding);
+          FIELD_VIEW(*m_pMap, FIX::OriginalNotionalPercentageOutstanding);
+          FIELD_VIEW(*m_pMap, FIX::AttachmentPoint);
+          FIELD_VIEW(*m_pMap, FIX::DetachmentPoint);
+          FIELD_VIEW(*m_pMap, FIX::StrikePriceDeterminationMethod);
+          FIELD_VIEW(*m_pMap, FIX::StrikePriceBoundaryMethod);
+          FIELD_VIEW(*m_pMap, FIX::StrikePriceBoundaryPrecision);
+          FIELD_VIEW(*m_pMap, FIX::UnderlyingPriceDeterminationMethod);
+          FIELD_VIEW(*m_pMap, FIX::OptPayoutType);
+          FIELD_VIEW(*m_pMap, FIX::NoComplexEvents);
+          FIELD_VIEW(*m_pMap, FIX::SettlType);
+          FIELD_VIEW(*m_pMap, FIX::StreamAsgnType);
+          FIELD_VIEW(*m_pMap, FIX::MDStreamID);
+          FIELD_VIEW(*m_pMap, FIX::StreamAsgnRejReason);
+          FIELD_VIEW(*m_pMap, FIX::Text);
+          FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+          FIELD_VIEW(*m_pMap, FIX::EncodedText);
+          FIX::GroupView<NoSecurityAltID::View> noSecurityAltID() const
+          { return FIX::GroupView<NoSecurityAltID::View>( *m_pMap, FIX::FIELD::NoSecurityAltID ); }
+          FIX::GroupView<NoEvents::View> noEvents() const
+          { return FIX::GroupView<NoEvents::View>( *m_pMap, FIX::FIELD::NoEvents ); }
+          FIX::GroupView<NoInstrumentParties::View> noInstrumentParties() const
+          { return FIX::GroupView<NoInstrumentParties::View>( *m_pMap, FIX::FIELD::NoInstrumentParties ); }
+          FIX::GroupView<NoComplexEvents::View> noComplexEvents() const
+          { return FIX::GroupView<NoComplexEvents::View>( *m_pMap, FIX::FIELD::NoComplexEvents ); }
+        };
       };
+      FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+      { return FIX::GroupView<NoRelatedSym::View>( *this, FIX::FIELD::NoRelatedSym ); }
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::NoPartyIDs);
+        FIELD_VIEW(*m_pMap, FIX::NoRelatedSym);
+        FIX::GroupView<NoPartyIDs::View> noPartyIDs() const
+        { return FIX::GroupView<NoPartyIDs::View>( *m_pMap, FIX::FIELD::NoPartyIDs ); }
+        FIX::GroupView<NoRelatedSym::View> noRelatedSym() const
+        { return FIX::GroupView<NoRelatedSym::View>( *m_pMap, FIX::FIELD::NoRelatedSym ); }
+      };
+    };
+    FIX::GroupView<NoAsgnReqs::View> noAsgnReqs() const
+    { return FIX::GroupView<NoAsgnReqs::View>( *this, FIX::FIELD::NoAsgnReqs ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView streamAsgnRptID() const
+      { return getString( FIX::FIELD::StreamAsgnRptID ); }
+      int streamAsgnReqType() const
+      { return getInt( FIX::FIELD::StreamAsgnReqType ); }
+      FIX::StringView streamAsgnReqID() const
+      { return getString( FIX::FIELD::StreamAsgnReqID ); }
+      int noAsgnReqs() const
+      { return getInt( FIX::FIELD::NoAsgnReqs ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "CD" ) {}
+      void setStreamAsgnRptID( const FIX::StringView& value )
+      { setString( FIX::FIELD::StreamAsgnRptID, value ); }
+      void setStreamAsgnReqType( int value )
+      { setInt( FIX::FIELD::StreamAsgnReqType, value ); }
+      void setStreamAsgnReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::StreamAsgnReqID, value ); }
+      void setNoAsgnReqs( int value )
+      { setInt( FIX::FIELD::NoAsgnReqs, value ); }
     };
   };
 
@@ -30,6 +30,44 @@ namespace FIX50SP2
     FIELD_SET(*this, FIX::Text);
     FIELD_SET(*this, FIX::EncodedTextLen);
     FIELD_SET(*this, FIX::EncodedText);
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      int streamAsgnAckType() const
+      { return getInt( FIX::FIELD::StreamAsgnAckType ); }
+      FIX::StringView streamAsgnRptID() const
+      { return getString( FIX::FIELD::StreamAsgnRptID ); }
+      int streamAsgnRejReason() const
+      { return getInt( FIX::FIELD::StreamAsgnRejReason ); }
+      FIX::StringView text() const
+      { return getString( FIX::FIELD::Text ); }
+      int encodedTextLen() const
+      { return getInt( FIX::FIELD::EncodedTextLen ); }
+      FIX::StringView encodedText() const
+      { return getString( FIX::FIELD::EncodedText ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "CE" ) {}
+      void setStreamAsgnAckType( int value )
+      { setInt( FIX::FIELD::StreamAsgnAckType, value ); }
+      void setStreamAsgnRptID( const FIX::StringView& value )
+      { setString( FIX::FIELD::StreamAsgnRptID, value ); }
+      void setStreamAsgnRejReason( int value )
+      { setInt( FIX::FIELD::StreamAsgnRejReason, value ); }
+      void setText( const FIX::StringView& value )
+      { setString( FIX::FIELD::Text, value ); }
+      void setEncodedTextLen( int value )
+      { setInt( FIX::FIELD::EncodedTextLen, value ); }
+      void setEncodedText( const FIX::StringView& value )
+      { setString( FIX::FIELD::EncodedText, value ); }
+    };
   };
 
 }
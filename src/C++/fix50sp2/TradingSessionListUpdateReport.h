@@ -48,21 +48,45 @@ namespace FIX50SP2
       public:
       NoOrdTypeRules() : FIX::Group(1237,40,FIX::message_order(40,0)) {}
         FIELD_SET(*this, FIX::OrdType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::OrdType);
+        };
       };
+      FIX::GroupView<NoOrdTypeRules::View> noOrdTypeRules() const
+      { return FIX::GroupView<NoOrdTypeRules::View>( *this, FIX::FIELD::NoOrdTypeRules ); }
       FIELD_SET(*this, FIX::NoTimeInForceRules);
       class NoTimeInForceRules: public FIX::Group
       {
       public:
       NoTimeInForceRules() : FIX::Group(1239,59,FIX::message_order(59,0)) {}
         FIELD_SET(*this, FIX::TimeInForce);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::TimeInForce);
+        };
       };
+      FIX::GroupView<NoTimeInForceRules::View> noTimeInForceRules() const
+      { return FIX::GroupView<NoTimeInForceRules::View>( *this, FIX::FIELD::NoTimeInForceRules ); }
       FIELD_SET(*this, FIX::NoExecInstRules);
       class NoExecInstRules: public FIX::Group
       {
       public:
       NoExecInstRules() : FIX::Group(1232,1308,FIX::message_order(1308,0)) {}
         FIELD_SET(*this, FIX::ExecInstValue);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::ExecInstValue);
+        };
       };
+      FIX::GroupView<NoExecInstRules::View> noExecInstRules() const
+      { return FIX::GroupView<NoExecInstRules::View>( *this, FIX::FIELD::NoExecInstRules ); }
       FIELD_SET(*this, FIX::NoMatchRules);
       class NoMatchRules: public FIX::Group
       {
@@ -70,7 +94,16 @@ namespace FIX50SP2
       NoMatchRules() : FIX::Group(1235,1142,FIX::message_order(1142,574,0)) {}
         FIELD_SET(*this, FIX::MatchAlgorithm);
         FIELD_SET(*this, FIX::MatchType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::MatchAlgorithm);
+          FIELD_VIEW(*m_pMap, FIX::MatchType);
+        };
       };
+      FIX::GroupView<NoMatchRules::View> noMatchRules() const
+      { return FIX::GroupView<NoMatchRules::View>( *this, FIX::FIELD::NoMatchRules ); }
       FIELD_SET(*this, FIX::NoMDFeedTypes);
       class NoMDFeedTypes: public FIX::Group
       {
@@ -79,12 +112,104 @@ namespace FIX50SP2
         FIELD_SET(*this, FIX::MDFeedType);
         FIELD_SET(*this, FIX::MarketDepth);
         FIELD_SET(*this, FIX::MDBookType);
+        class View : public FIX::GroupEntry
+        {
+        public:
+        View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+          FIELD_VIEW(*m_pMap, FIX::MDFeedType);
+          FIELD_VIEW(*m_pMap, FIX::MarketDepth);
+          FIELD_VIEW(*m_pMap, FIX::MDBookType);
+        };
       };
+      FIX::GroupView<NoMDFeedTypes::View> noMDFeedTypes() const
+      { return FIX::GroupView<NoMDFeedTypes::View>( *this, FIX::FIELD::NoMDFeedTypes ); }
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
       FIELD_SET(*this, FIX::TransactTime);
       FIELD_SET(*this, FIX::TradSesUpdateAction);
+      class View : public FIX::GroupEntry
+      {
+      public:
+      View( const FIX::FieldMap* pMap = 0 ) : FIX::GroupEntry( pMap ) {}
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionID);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionSubID);
+        FIELD_VIEW(*m_pMap, FIX::SecurityExchange);
+        FIELD_VIEW(*m_pMap, FIX::MarketID);
+        FIELD_VIEW(*m_pMap, FIX::MarketSegmentID);
+        FIELD_VIEW(*m_pMap, FIX::TradingSessionDesc);
+        FIELD_VIEW(*m_pMap, FIX::TradSesMethod);
+        FIELD_VIEW(*m_pMap, FIX::TradSesMode);
+        FIELD_VIEW(*m_pMap, FIX::UnsolicitedIndicator);
+        FIELD_VIEW(*m_pMap, FIX::TradSesStatus);
+        FIELD_VIEW(*m_pMap, FIX::TradSesStatusRejReason);
+        FIELD_VIEW(*m_pMap, FIX::TradSesStartTime);
+        FIELD_VIEW(*m_pMap, FIX::TradSesOpenTime);
+        FIELD_VIEW(*m_pMap, FIX::TradSesPreCloseTime);
+        FIELD_VIEW(*m_pMap, FIX::TradSesCloseTime);
+        FIELD_VIEW(*m_pMap, FIX::TradSesEndTime);
+        FIELD_VIEW(*m_pMap, FIX::TotalVolumeTraded);
+        FIELD_VIEW(*m_pMap, FIX::NoOrdTypeRules);
+        FIELD_VIEW(*m_pMap, FIX::NoTimeInForceRules);
+        FIELD_VIEW(*m_pMap, FIX::NoExecInstRules);
+        FIELD_VIEW(*m_pMap, FIX::NoMatchRules);
+        FIELD_VIEW(*m_pMap, FIX::NoMDFeedTypes);
+        FIELD_VIEW(*m_pMap, FIX::Text);
+        FIELD_VIEW(*m_pMap, FIX::EncodedTextLen);
+        FIELD_VIEW(*m_pMap, FIX::EncodedText);
+        FIELD_VIEW(*m_pMap, FIX::TransactTime);
+        FIELD_VIEW(*m_pMap, FIX::TradSesUpdateAction);
+        FIX::GroupView<NoOrdTypeRules::View> noOrdTypeRules() const
+        { return FIX::GroupView<NoOrdTypeRules::View>( *m_pMap, FIX::FIELD::NoOrdTypeRules ); }
+        FIX::GroupView<NoTimeInForceRules::View> noTimeInForceRules() const
+        { return FIX::GroupView<NoTimeInForceRules::View>( *m_pMap, FIX::FIELD::NoTimeInForceRules ); }
+        FIX::GroupView<NoExecInstRules::View> noExecInstRules() const
+        { return FIX::GroupView<NoExecInstRules::View>( *m_pMap, FIX::FIELD::NoExecInstRules ); }
+        FIX::GroupView<NoMatchRules::View> noMatchRules() const
+        { return FIX::GroupView<NoMatchRules::View>( *m_pMap, FIX::FIELD::NoMatchRules ); }
+        FIX::GroupView<NoMDFeedTypes::View> noMDFeedTypes() const
+        { return FIX::GroupView<NoMDFeedTypes::View>( *m_pMap, FIX::FIELD::NoMDFeedTypes ); }
+      };
+    };
+    FIX::GroupView<NoTradingSessions::View> noTradingSessions() const
+    { return FIX::GroupView<NoTradingSessions::View>( *this, FIX::FIELD::NoTradingSessions ); }
+
+    class Reader : public Message::Reader
+    {
+    public:
+      Reader() {}
+      Reader( const char* data, size_t length, const FIX::DataDictionary* pDataDictionary = 0 )
+      : Message::Reader( data, length, pDataDictionary ) {}
+      FIX::StringView applID() const
+      { return getString( FIX::FIELD::ApplID ); }
+      int applSeqNum() const
+      { return getInt( FIX::FIELD::ApplSeqNum ); }
+      int applLastSeqNum() const
+      { return getInt( FIX::FIELD::ApplLastSeqNum ); }
+      bool applResendFlag() const
+      { return getBool( FIX::FIELD::ApplResendFlag ); }
+      FIX::StringView tradSesReqID() const
+      { return getString( FIX::FIELD::TradSesReqID ); }
+      int noTradingSessions() const
+      { return getInt( FIX::FIELD::NoTradingSessions ); }
+    };
+
+    class Writer : public Message::Writer
+    {
+    public:
+      Writer() : Message::Writer( "BS" ) {}
+      void setApplID( const FIX::StringView& value )
+      { setString( FIX::FIELD::ApplID, value ); }
+      void setApplSeqNum( int value )
+      { setInt( FIX::FIELD::ApplSeqNum, value ); }
+      void setApplLastSeqNum( int value )
+      { setInt( FIX::FIELD::ApplLastSeqNum, value ); }
+      void setApplResendFlag( bool value )
+      { setBool( FIX::FIELD::ApplResendFlag, value ); }
+      void setTradSesReqID( const FIX::StringView& value )
+      { setString( FIX::FIELD::TradSesReqID, value ); }
+      void setNoTradingSessions( int value )
+      { setInt( FIX::FIELD::NoTradingSessions, value ); }
     };
   };
 
@@ -194,6 +194,83 @@ TEST(doubleConvertFrom)
   CHECK_THROW( DoubleConvertor::convert( "1e5" ), FieldConvertError );
 }
 
+TEST(decimalConvertTo)
+{
+  CHECK_EQUAL( "45.32", DecimalConvertor::convert( Decimal( 4532, -2 ) ) );
+  CHECK_EQUAL( "45", DecimalConvertor::convert( Decimal( 45 ) ) );
+  CHECK_EQUAL( "4500", DecimalConvertor::convert( Decimal( 45, 2 ) ) );
+  CHECK_EQUAL( "0", DecimalConvertor::convert( Decimal() ) );
+  CHECK_EQUAL( "0", DecimalConvertor::convert( Decimal( 0, 3 ) ) );
+  CHECK_EQUAL( "0.00001", DecimalConvertor::convert( Decimal( 1, -5 ) ) );
+  CHECK_EQUAL( "-0.00001", DecimalConvertor::convert( Decimal( -1, -5 ) ) );
+  CHECK_EQUAL( "-12.000000000001", DecimalConvertor::convert( Decimal( -12000000000001LL, -12 ) ) );
+  CHECK_EQUAL( "1.50", DecimalConvertor::convert( Decimal( 150, -2 ) ) );
+  CHECK_EQUAL( "-9223372036854775808",
+    DecimalConvertor::convert( Decimal( std::numeric_limits<int64_t>::min() ) ) );
+
+  CHECK_EQUAL( "1.500", DecimalConvertor::convert( Decimal( 15, -1 ), 3 ) );
+  CHECK_EQUAL( "45.00000", DecimalConvertor::convert( Decimal( 45 ), 5 ) );
+  CHECK_EQUAL( "-5.00", DecimalConvertor::convert( Decimal( -5 ), 2 ) );
+  CHECK_EQUAL( "-12.2345", DecimalConvertor::convert( Decimal( -122345, -4 ), 2 ) );
+  CHECK_EQUAL( "0.0", DecimalConvertor::convert( Decimal(), 1 ) );
+}
+
+TEST(decimalConvertFrom)
+{
+  Decimal value = DecimalConvertor::convert( "45.32" );
+  CHECK_EQUAL( 4532, value.getMantissa() );
+  CHECK_EQUAL( -2, value.getExponent() );
+
+  value = DecimalConvertor::convert( "-0045.3200" );
+  CHECK_EQUAL( -453200, value.getMantissa() );
+  CHECK_EQUAL( -4, value.getExponent() );
+
+  CHECK( Decimal( 4532, -2 ) == DecimalConvertor::convert( "45.32" ) );
+  CHECK( Decimal( 6, -2 ) == DecimalConvertor::convert( "000.0600" ) );
+  CHECK( Decimal( 1, -5 ) == DecimalConvertor::convert( "0.00001" ) );
+  CHECK( Decimal( -1050 ) == DecimalConvertor::convert( "-1050" ) );
+  CHECK( Decimal() == DecimalConvertor::convert( "0." ) );
+  CHECK( Decimal() == DecimalConvertor::convert( ".0" ) );
+  CHECK( Decimal( 5, -1 ) == DecimalConvertor::convert( ".5" ) );
+  CHECK( Decimal( 1, -40 ) == DecimalConvertor::convert(
+    "0.0000000000000000000000000000000000000001" ) );
+
+  // 18 digits of precision survive where a double would round
+  CHECK( Decimal( 123456789012345678LL, -9 )
+         == DecimalConvertor::convert( "123456789.012345678" ) );
+
+  // trailing zeros that do not fit are dropped without changing the value
+  value = DecimalConvertor::convert( "1234567890123456789.000000" );
+  CHECK_EQUAL( 1234567890123456789LL, value.getMantissa() );
+  CHECK_EQUAL( 0, value.getExponent() );
+
+  CHECK_THROW( DecimalConvertor::convert( "abc" ), FieldConvertError );
+  CHECK_THROW( DecimalConvertor::convert( "123.A" ), FieldConvertError );
+  CHECK_THROW( DecimalConvertor::convert( "123.45.67" ), FieldConvertError );
+  CHECK_THROW( DecimalConvertor::convert( "." ), FieldConvertError );
+  CHECK_THROW( DecimalConvertor::convert( "-" ), FieldConvertError );
+  CHECK_THROW( DecimalConvertor::convert( "" ), FieldConvertError );
+  CHECK_THROW( DecimalConvertor::convert( "1e5" ), FieldConvertError );
+  CHECK_THROW( DecimalConvertor::convert( "99999999999999999999" ), FieldConvertError );
+}
+
+TEST(decimalCompare)
+{
+  CHECK( Decimal( 15, -1 ) == Decimal( 150, -2 ) );
+  CHECK( Decimal( 15, -1 ) < Decimal( 151, -2 ) );
+  CHECK( Decimal( -2 ) < Decimal( -15, -1 ) );
+  CHECK( Decimal( 1, 30 ) > Decimal( 999999999, -2 ) );
+  CHECK( Decimal( -1, 30 ) < Decimal( 1, -2 ) );
+  CHECK_EQUAL( 1.5, Decimal( 15, -1 ).toDouble() );
+  CHECK( Decimal( 12346, -2 ) == Decimal::fromDouble( 123.456, 2 ) );
+  CHECK_THROW( Decimal::fromDouble( 1e17, 2 ), FieldConvertError );
+  CHECK_THROW( Decimal::fromDouble( -1e17, 2 ), FieldConvertError );
+  CHECK_THROW( Decimal::fromDouble( std::numeric_limits<double>::infinity(), 0 ),
+               FieldConvertError );
+  CHECK_THROW( Decimal::fromDouble( std::numeric_limits<double>::quiet_NaN(), 0 ),
+               FieldConvertError );
+}
+
 TEST(charConvertTo)
 {
   CHECK_EQUAL( "a", CharConvertor::convert( 'a' ) );
@@ -88,6 +88,11 @@ TEST_FIXTURE(resetBeforeAndAfterFileStoreFixture, setGet)
   CHECK_MESSAGE_STORE_SET_GET;
 }
 
+TEST_FIXTURE(resetBeforeAndAfterFileStoreFixture, setMany)
+{
+  CHECK_MESSAGE_STORE_SET_MANY;
+}
+
 TEST_FIXTURE(resetBeforeAndAfterFileStoreFixture, setGetWithQuote)
 {
   CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
@@ -0,0 +1,180 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <Flyweight.h>
+#include <DataDictionary.h>
+#include <fix43/NewOrderSingle.h>
+#include <fix43/News.h>
+
+using namespace FIX;
+
+SUITE(FlyweightTests)
+{
+
+UtcTimeStamp sendingTime()
+{
+  return UtcTimeStamp( 12, 5, 6, 0, 26, 4, 2000 );
+}
+
+FIX43::NewOrderSingle newOrderSingle()
+{
+  FIX43::NewOrderSingle message
+    ( ClOrdID( "ORD1" ), HandlInst( '1' ), Side( Side_BUY ),
+      TransactTime( sendingTime() ), OrdType( OrdType_LIMIT ) );
+  message.getHeader().setField( MsgSeqNum( 7 ) );
+  message.getHeader().setField( SenderCompID( "TW" ) );
+  message.getHeader().setField( SendingTime( sendingTime() ) );
+  message.getHeader().setField( TargetCompID( "ISLD" ) );
+  message.set( OrderQty( 100 ) );
+  message.set( Price( 12.25 ) );
+  message.set( Symbol( "MSFT" ) );
+  return message;
+}
+
+TEST(readGeneratedAccessors)
+{
+  std::string string = newOrderSingle().toString();
+  FIX43::NewOrderSingle::Reader object( string.data(), string.size() );
+
+  CHECK_EQUAL( "FIX.4.3", object.beginString().str() );
+  CHECK_EQUAL( "D", object.msgType().str() );
+  CHECK_EQUAL( 7, object.msgSeqNum() );
+  CHECK_EQUAL( "TW", object.senderCompID().str() );
+  CHECK_EQUAL( "20000426-12:05:06", object.sendingTime().str() );
+  CHECK_EQUAL( "ORD1", object.clOrdID().str() );
+  CHECK_EQUAL( Side_BUY, object.side() );
+  CHECK_EQUAL( OrdType_LIMIT, object.ordType() );
+  CHECK( Decimal( 100 ).compare( object.orderQty() ) == 0 );
+  CHECK( Decimal( 1225, -2 ).compare( object.price() ) == 0 );
+  CHECK_EQUAL( "MSFT", object.symbol().str() );
+
+  // views point into the buffer that was read
+  CHECK( object.clOrdID().data() > string.data() );
+  CHECK( object.clOrdID().data() < string.data() + string.size() );
+
+  CHECK( !object.isSet( FIELD::Account ) );
+  CHECK_THROW( object.account(), FieldNotFound );
+}
+
+TEST(readIncorrectDataFormat)
+{
+  std::string string = "35=D\00138=ten\00154=12\001";
+  FIX43::NewOrderSingle::Reader object( string.data(), string.size() );
+
+  CHECK_THROW( object.orderQty(), IncorrectDataFormat );
+  CHECK_THROW( object.side(), IncorrectDataFormat );
+  CHECK_EQUAL( 3, (int)object.size() );
+  CHECK_EQUAL( 54, object.getTag( 2 ) );
+  CHECK_EQUAL( "12", object.getValue( 2 ).str() );
+}
+
+TEST(readInvalidFraming)
+{
+  FlyweightReader object;
+  std::string noEqualSign = "35=D\00138\001";
+  std::string noSoh = "35=D\00138=10";
+  std::string badTag = "35=D\001X=10\001";
+  CHECK_THROW( object.parse( noEqualSign ), InvalidMessage );
+  CHECK_THROW( object.parse( noSoh ), InvalidMessage );
+  CHECK_THROW( object.parse( badTag ), InvalidMessage );
+}
+
+TEST(readRepeatedTags)
+{
+  std::string string = "35=B\001148=Headline\00133=2\00158=first\00158=second\001";
+  FIX43::News::Reader object( string.data(), string.size() );
+
+  CHECK_EQUAL( 2, object.linesOfText() );
+  size_t first = object.find( FIELD::Text );
+  size_t second = object.find( FIELD::Text, first + 1 );
+  CHECK_EQUAL( "first", object.getValue( first ).str() );
+  CHECK_EQUAL( "second", object.getValue( second ).str() );
+  CHECK_EQUAL( object.size(), object.find( FIELD::Text, second + 1 ) );
+}
+
+TEST(readDataField)
+{
+  DataDictionary dataDictionary( "../spec/FIX43.xml" );
+  std::string data( "A\001B", 3 );
+  std::string string = "35=B\001148=Headline\00195=3\00196=" + data + "\00110=000\001";
+
+  FIX43::News::Reader object( string.data(), string.size(), &dataDictionary );
+  CHECK_EQUAL( data, object.rawData().str() );
+  CHECK_EQUAL( "000", object.checkSum().str() );
+
+  CHECK_THROW( object.parse( string ), InvalidMessage );
+}
+
+TEST(writeGeneratedSetters)
+{
+  FIX43::NewOrderSingle::Writer object;
+  object.setMsgSeqNum( 7 );
+  object.setSenderCompID( "TW" );
+  object.setSendingTime( sendingTime() );
+  object.setTargetCompID( "ISLD" );
+  object.setClOrdID( "ORD1" );
+  object.setHandlInst( '1' );
+  object.setOrderQty( Decimal( 100 ) );
+  object.setOrdType( OrdType_LIMIT );
+  object.setPrice( Decimal( 1225, -2 ) );
+  object.setSide( Side_BUY );
+  object.setSymbol( "MSFT" );
+  object.setTransactTime( sendingTime() );
+
+  // fields set in tag order come out as Message writes them
+  CHECK_EQUAL( newOrderSingle().toString(), object.finish().str() );
+
+  object.reset();
+  object.setClOrdID( "ORD2" );
+  CHECK_EQUAL( "8=FIX.4.3\0019=13\00135=D\00111=ORD2\00110=156\001",
+               object.finish().str() );
+}
+
+TEST(writeReadBack)
+{
+  FlyweightWriter writer( "FIXT.1.1", "8", "9" );
+  writer.setInt( FIELD::MsgSeqNum, -12 );
+  writer.setBool( FIELD::PossDupFlag, true );
+  writer.setDouble( FIELD::AvgPx, 1.5 );
+  writer.setString( FIELD::Text, std::string( 200, 'x' ) );
+  StringView string = writer.finish();
+
+  FlyweightReader reader( string.data(), string.size() );
+  CHECK_EQUAL( "FIXT.1.1", reader.getString( FIELD::BeginString ).str() );
+  CHECK_EQUAL( "9", reader.getString( FIELD::ApplVerID ).str() );
+  CHECK_EQUAL( -12, reader.getInt( FIELD::MsgSeqNum ) );
+  CHECK_EQUAL( 1.5, reader.getDouble( FIELD::AvgPx ) );
+  CHECK( reader.getBool( FIELD::PossDupFlag ) );
+  CHECK_EQUAL( 200, (int)reader.getString( FIELD::Text ).size() );
+
+  // body length and checksum check out
+  Message message( string.str(), true );
+  CHECK_EQUAL( "9", message.getHeader().getField( FIELD::ApplVerID ) );
+  CHECK_EQUAL( std::string( 200, 'x' ), message.getField( FIELD::Text ) );
+}
+
+}
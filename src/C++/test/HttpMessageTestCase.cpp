@@ -79,4 +79,15 @@ TEST(setString)
   CHECK_THROW( object.setString( strBad3 ), InvalidMessage );
 }
 
+TEST(createResponse)
+{
+  std::string html = HttpMessage::createResponse( 200, "<HTML></HTML>" );
+  CHECK( html.find( "Content-Type: text/html" ) != std::string::npos );
+  CHECK( html.find( "<!DOCTYPE" ) != std::string::npos );
+
+  std::string text = HttpMessage::createResponse( 200, "a 1\n", "text/plain" );
+  CHECK_EQUAL( "HTTP/1.1 200 OK\r\nServer: QuickFIX\r\n"
+               "Content-Type: text/plain\r\n\r\na 1\n", text );
+}
+
 }
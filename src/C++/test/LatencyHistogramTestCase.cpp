@@ -0,0 +1,111 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <LatencyHistogram.h>
+
+using namespace FIX;
+
+SUITE(LatencyHistogramTests)
+{
+
+TEST(empty)
+{
+  LatencyHistogram histogram;
+  CHECK_EQUAL( 0U, histogram.getCount() );
+  CHECK_EQUAL( 0, histogram.getMin() );
+  CHECK_EQUAL( 0, histogram.getMax() );
+  CHECK_EQUAL( 0, histogram.getValueAtPercentile( 99 ) );
+}
+
+TEST(smallValuesAreExact)
+{
+  LatencyHistogram histogram;
+  for( int i = 1; i <= 50; ++i )
+    histogram.record( i );
+  CHECK_EQUAL( 50U, histogram.getCount() );
+  CHECK_EQUAL( 1, histogram.getMin() );
+  CHECK_EQUAL( 50, histogram.getMax() );
+  CHECK_CLOSE( 25.5, histogram.getMean(), 0.001 );
+  CHECK_EQUAL( 25, histogram.getValueAtPercentile( 50 ) );
+  CHECK_EQUAL( 50, histogram.getValueAtPercentile( 100 ) );
+}
+
+TEST(percentiles)
+{
+  LatencyHistogram histogram;
+  for( int i = 0; i < 990; ++i )
+    histogram.record( 10000 );
+  for( int i = 0; i < 10; ++i )
+    histogram.record( 5000000 );
+
+  int64_t median = histogram.getValueAtPercentile( 50 );
+  CHECK( median >= 10000 && median <= 10000 * 1.04 );
+  int64_t p99 = histogram.getValueAtPercentile( 99 );
+  CHECK( p99 >= 10000 && p99 <= 10000 * 1.04 );
+  int64_t p999 = histogram.getValueAtPercentile( 99.9 );
+  CHECK( p999 >= 5000000 && p999 <= 5000000 * 1.04 );
+  CHECK_EQUAL( 5000000, histogram.getMax() );
+}
+
+TEST(largeValues)
+{
+  LatencyHistogram histogram;
+  histogram.record( -5 );
+  histogram.record( (int64_t)1 << 50 );
+  CHECK_EQUAL( 0, histogram.getMin() );
+  CHECK_EQUAL( (int64_t)1 << 50, histogram.getValueAtPercentile( 100 ) );
+}
+
+TEST(mergeAndReset)
+{
+  LatencyHistogram first;
+  LatencyHistogram second;
+  first.record( 100 );
+  second.record( 300 );
+  second.record( 200 );
+  first.merge( second );
+  CHECK_EQUAL( 3U, first.getCount() );
+  CHECK_EQUAL( 100, first.getMin() );
+  CHECK_EQUAL( 300, first.getMax() );
+  CHECK_CLOSE( 200.0, first.getMean(), 0.001 );
+
+  first.reset();
+  CHECK_EQUAL( 0U, first.getCount() );
+  CHECK_EQUAL( 0, first.getMax() );
+}
+
+TEST(recordSince)
+{
+  LatencyHistogram histogram;
+  int64_t start = LatencyHistogram::now();
+  int64_t end = histogram.recordSince( start );
+  CHECK( end >= start );
+  CHECK_EQUAL( 1U, histogram.getCount() );
+  CHECK_EQUAL( end - start, histogram.getMax() );
+}
+
+}
@@ -0,0 +1,191 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <MarketDataColumns.h>
+#include <DataDictionary.h>
+
+using namespace FIX;
+
+SUITE(MarketDataColumnsTests)
+{
+
+struct marketDataColumnsFixture
+{
+  marketDataColumnsFixture()
+  : dataDictionary( "../spec/FIX44.xml" ) {}
+
+  std::string snapshot( const std::string& price = "12.25", int entries = 3 )
+  {
+    FlyweightWriter writer( "FIX.4.4", "W" );
+    writer.setString( FIELD::SenderCompID, "ISLD" );
+    writer.setString( FIELD::TargetCompID, "TW" );
+    writer.setInt( FIELD::MsgSeqNum, 2 );
+    writer.setString( FIELD::SendingTime, "20000426-12:05:06" );
+    writer.setString( FIELD::Symbol, "MSFT" );
+    writer.setInt( FIELD::NoMDEntries, entries );
+    writer.setChar( FIELD::MDEntryType, '0' );
+    writer.setString( FIELD::MDEntryPx, price );
+    writer.setString( FIELD::MDEntrySize, "100" );
+    writer.setString( FIELD::MDEntryTime, "12:30:05.250" );
+    writer.setInt( FIELD::MDEntryPositionNo, 1 );
+    writer.setChar( FIELD::MDEntryType, '1' );
+    writer.setString( FIELD::MDEntryPx, "12.5" );
+    writer.setString( FIELD::MDEntrySize, "250" );
+    writer.setChar( FIELD::MDEntryType, '2' );
+    writer.setString( FIELD::MDEntryPx, "12.3" );
+    writer.setInt( FIELD::ApplQueueDepth, 5 );
+    return writer.finish().str();
+  }
+
+  std::string incrementalRefresh()
+  {
+    FlyweightWriter writer( "FIX.4.4", "X" );
+    writer.setString( FIELD::SenderCompID, "ISLD" );
+    writer.setString( FIELD::TargetCompID, "TW" );
+    writer.setInt( FIELD::MsgSeqNum, 3 );
+    writer.setString( FIELD::SendingTime, "20000426-12:05:06" );
+    writer.setInt( FIELD::NoMDEntries, 2 );
+    writer.setChar( FIELD::MDUpdateAction, '0' );
+    writer.setChar( FIELD::MDEntryType, '0' );
+    writer.setString( FIELD::Symbol, "MSFT" );
+    writer.setInt( FIELD::NoSecurityAltID, 2 );
+    writer.setString( FIELD::SecurityAltID, "594918104" );
+    writer.setString( FIELD::SecurityAltIDSource, "1" );
+    writer.setString( FIELD::SecurityAltID, "US5949181045" );
+    writer.setString( FIELD::SecurityAltIDSource, "4" );
+    writer.setString( FIELD::MDEntryPx, "12.25" );
+    writer.setChar( FIELD::MDUpdateAction, '2' );
+    writer.setChar( FIELD::MDEntryType, '1' );
+    writer.setString( FIELD::Symbol, "MSFT" );
+    writer.setString( FIELD::MDEntryPx, "12.5" );
+    return writer.finish().str();
+  }
+
+  void checkSnapshot( const MarketDataColumns& object )
+  {
+    CHECK_EQUAL( 3U, object.size() );
+    CHECK_EQUAL( '0', object.getEntryTypes()[ 0 ] );
+    CHECK_EQUAL( '1', object.getEntryTypes()[ 1 ] );
+    CHECK_EQUAL( '2', object.getEntryTypes()[ 2 ] );
+    CHECK_EQUAL( 12.25, object.getPrices()[ 0 ] );
+    CHECK_EQUAL( 12.5, object.getPrices()[ 1 ] );
+    CHECK_EQUAL( 12.3, object.getPrices()[ 2 ] );
+    CHECK_EQUAL( 100, object.getSizes()[ 0 ] );
+    CHECK_EQUAL( 250, object.getSizes()[ 1 ] );
+    CHECK_EQUAL( 1, object.getPositions()[ 0 ] );
+    CHECK_EQUAL( ( ( 12 * 60 + 30 ) * 60 + 5 ) * 1000000000LL + 250000000LL,
+                 object.getTimes()[ 0 ] );
+
+    // fields an entry does not carry are 0
+    CHECK_EQUAL( 0, object.getUpdateActions()[ 0 ] );
+    CHECK_EQUAL( 0, object.getSizes()[ 2 ] );
+    CHECK_EQUAL( 0, object.getPositions()[ 1 ] );
+    CHECK_EQUAL( 0, object.getTimes()[ 2 ] );
+  }
+
+  DataDictionary dataDictionary;
+};
+
+TEST_FIXTURE(marketDataColumnsFixture, decodeString)
+{
+  MarketDataColumns object;
+  CHECK( object.decode( snapshot(), dataDictionary ) );
+  checkSnapshot( object );
+
+  // the entries of the next message replace those of the last
+  CHECK( object.decode( incrementalRefresh(), dataDictionary ) );
+  CHECK_EQUAL( 2U, object.size() );
+}
+
+TEST_FIXTURE(marketDataColumnsFixture, decodeNestedGroup)
+{
+  MarketDataColumns object;
+  CHECK( object.decode( incrementalRefresh(), dataDictionary ) );
+  CHECK_EQUAL( 2U, object.size() );
+  CHECK_EQUAL( '0', object.getUpdateActions()[ 0 ] );
+  CHECK_EQUAL( '2', object.getUpdateActions()[ 1 ] );
+  CHECK_EQUAL( '0', object.getEntryTypes()[ 0 ] );
+  CHECK_EQUAL( '1', object.getEntryTypes()[ 1 ] );
+  CHECK_EQUAL( 12.25, object.getPrices()[ 0 ] );
+  CHECK_EQUAL( 12.5, object.getPrices()[ 1 ] );
+}
+
+TEST_FIXTURE(marketDataColumnsFixture, decodeParsedMessage)
+{
+  Message message( snapshot(), dataDictionary );
+  MarketDataColumns object;
+  CHECK( object.decode( message, &dataDictionary ) );
+  checkSnapshot( object );
+}
+
+TEST_FIXTURE(marketDataColumnsFixture, decodeLazyMessage)
+{
+  Message message;
+  message.setString( snapshot(), true, &dataDictionary, &dataDictionary, true );
+  CHECK( !message.isBodyParsed() );
+
+  MarketDataColumns object;
+  CHECK( object.decode( message ) );
+  checkSnapshot( object );
+
+  // read straight from the string, the body is still left alone
+  CHECK( !message.isBodyParsed() );
+}
+
+TEST_FIXTURE(marketDataColumnsFixture, decodeIncorrectDataFormat)
+{
+  MarketDataColumns object;
+  CHECK_THROW( object.decode( snapshot( "12.x" ), dataDictionary ), IncorrectDataFormat );
+
+  Message message;
+  message.setString( snapshot( "12.x" ), true, &dataDictionary, &dataDictionary, true );
+  CHECK_THROW( object.decode( message ), IncorrectDataFormat );
+}
+
+TEST_FIXTURE(marketDataColumnsFixture, decodeInflatedCount)
+{
+  // the columns are not sized by a count the entries do not back up
+  MarketDataColumns object;
+  CHECK( object.decode( snapshot( "12.25", 2000000000 ), dataDictionary ) );
+  checkSnapshot( object );
+  CHECK( object.getPrices().capacity() < 1000 );
+}
+
+TEST_FIXTURE(marketDataColumnsFixture, decodeWithoutEntries)
+{
+  FlyweightWriter writer( "FIX.4.4", "B" );
+  writer.setString( FIELD::Headline, "Headline" );
+  std::string news = writer.finish().str();
+
+  MarketDataColumns object;
+  CHECK( object.decode( snapshot(), dataDictionary ) );
+  CHECK( !object.decode( news, dataDictionary ) );
+  CHECK( object.empty() );
+  CHECK( !object.decode( Message( news, dataDictionary, false ) ) );
+}
+
+}
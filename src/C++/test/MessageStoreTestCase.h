@@ -52,6 +52,26 @@
   CHECK_EQUAL( heartbeat.toString(), messages[ 0 ] );       \
   CHECK_EQUAL( newOrderSingle.toString(), messages[ 1 ] );
 
+#define CHECK_MESSAGE_STORE_SET_MANY                       \
+  std::vector < std::string > batch;                        \
+  for( int i = 1; i <= 3; ++i )                             \
+  {                                                         \
+    FIX42::Heartbeat heartbeat;                             \
+    heartbeat.getHeader().setField( MsgSeqNum( i ) );       \
+    batch.push_back( heartbeat.toString() );                \
+  }                                                         \
+  CHECK( object->setMany( 1, batch ) );                    \
+                                                            \
+  std::vector < std::string > messages;                     \
+  object->get( 1, 3, messages );                            \
+  CHECK_EQUAL( 3U, messages.size() );                        \
+  CHECK_EQUAL( batch[ 0 ], messages[ 0 ] );                 \
+  CHECK_EQUAL( batch[ 2 ], messages[ 2 ] );                 \
+                                                            \
+  object->get( 2, 2, messages );                            \
+  CHECK_EQUAL( 1U, messages.size() );                        \
+  CHECK_EQUAL( batch[ 1 ], messages[ 0 ] );
+
 #define CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE        \
   FIX42::ExecutionReport singleQuote;                 \
   singleQuote.setField( Text("Some Text") );          \
@@ -211,6 +211,45 @@ TEST(setStringWithGroup)
   CHECK_EQUAL( str, object.toString() );
 }
 
+TEST(setStringDeferBody)
+{
+  DataDictionary dataDictionary( "../spec/FIX42.xml" );
+  static const char* str =
+    "8=FIX.4.2\0019=97\00135=D\00134=2\00149=ISLD\00152=20000101-00:00:00\001"
+    "56=TW\00111=ID\00121=1\00140=1\00154=1\00155=SYMBOL\00160=20000101-00:00:00\001"
+    "10=237\001";
+
+  FIX::Message object;
+  object.setString( str, true, &dataDictionary, &dataDictionary, true );
+  CHECK( !object.isBodyParsed() );
+  CHECK_EQUAL( "D", object.getHeader().getField( FIELD::MsgType ) );
+  CHECK( !object.isSetField( FIELD::ClOrdID ) );
+
+  FIX::Message copy( object );
+  object.parseBody();
+  CHECK( object.isBodyParsed() );
+  CHECK_EQUAL( "ID", object.getField( FIELD::ClOrdID ) );
+  CHECK_EQUAL( str, object.toString() );
+
+  CHECK( !copy.isBodyParsed() );
+  copy.parseBody();
+  CHECK_EQUAL( str, copy.toString() );
+
+  std::string badCheckSum( str );
+  badCheckSum.replace( badCheckSum.size() - 4, 3, "238" );
+  CHECK_THROW( object.setString( badCheckSum, true, &dataDictionary, &dataDictionary, true ),
+               InvalidMessage );
+  object.setString( badCheckSum, false, &dataDictionary, &dataDictionary, true );
+  CHECK( !object.isBodyParsed() );
+
+  std::string headerAfterBody( str );
+  headerAfterBody.replace( headerAfterBody.find( "\00152=" ) + 1, 21, "" );
+  headerAfterBody.insert( headerAfterBody.find( "\00110=" ) + 1, "52=20000101-00:00:00\001" );
+  object.setString( headerAfterBody, false, &dataDictionary, &dataDictionary, true );
+  CHECK( object.isBodyParsed() );
+  CHECK_EQUAL( "ID", object.getField( FIELD::ClOrdID ) );
+}
+
 TEST(setStringWithGroupWithoutDelimiter)
 {
   FIX::Message object;
@@ -375,6 +414,39 @@ TEST(checkSum)
   CHECK_EQUAL( chksum, object.checkSum() );
 }
 
+TEST(toBody)
+{
+  FIX::Message object;
+  object.getHeader().setField( BeginString( "FIX.4.2" ) );
+  object.getHeader().setField( MsgType( "D" ) );
+  object.getHeader().setField( SenderCompID( "TW" ) );
+  object.getHeader().setField( TargetCompID( "ISLD" ) );
+  object.getHeader().setField( MsgSeqNum( 3 ) );
+  object.setField( ClOrdID( "ORDERID" ) );
+  object.setField( Symbol( "LNUX" ) );
+  object.setField( Text( "HELLO" ) );
+
+  SerializedBody body;
+  object.toBody( body );
+  CHECK_EQUAL( "11=ORDERID\00155=LNUX\00158=HELLO\001", body.string );
+  CHECK_EQUAL( object.calculateLength(), body.length );
+  CHECK_EQUAL( object.calculateTotal(), body.total );
+
+  std::string expected = object.toString();
+  std::string str;
+  CHECK_EQUAL( expected, object.toString( body, str ) );
+
+  // another header around the same body
+  object.getHeader().setField( TargetCompID( "DLSI" ) );
+  object.getHeader().setField( MsgSeqNum( 1000 ) );
+  expected = object.toString();
+  std::string header, trailer;
+  object.toString( body, header, trailer );
+  CHECK_EQUAL( expected, header + body.string + trailer );
+  CHECK_EQUAL( "10=" + CheckSumConvertor::convert( object.checkSum() ) + "\001",
+               trailer );
+}
+
 TEST(headerFieldsFirst)
 {
   FIX::Message object;
@@ -635,6 +707,52 @@ TEST(replaceGroup)
   CHECK_EQUAL( "C", group.getField(clOrdID).getString() );
 }
 
+TEST(groupView)
+{
+  FIX44::MarketDataRequest object;
+  CHECK( object.noRelatedSym().empty() );
+  CHECK( object.noRelatedSym().begin() == object.noRelatedSym().end() );
+
+  FIX44::MarketDataRequest::NoRelatedSym symbolGroup;
+  FIX44::MarketDataRequest::NoRelatedSym::NoSecurityAltID altIDGroup;
+  symbolGroup.set( Symbol( "MSFT" ) );
+  altIDGroup.set( SecurityAltID( "US5949181045" ) );
+  altIDGroup.set( SecurityAltIDSource( "4" ) );
+  symbolGroup.addGroup( altIDGroup );
+  object.addGroup( symbolGroup );
+
+  symbolGroup = FIX44::MarketDataRequest::NoRelatedSym();
+  symbolGroup.set( Symbol( "IBM" ) );
+  object.addGroup( symbolGroup );
+
+  DataDictionary dataDictionary( "../spec/FIX44.xml" );
+  FIX44::MarketDataRequest parsed;
+  parsed.setString( object.toString(), true, &dataDictionary );
+
+  typedef GroupView<FIX44::MarketDataRequest::NoRelatedSym::View> Symbols;
+  Symbols symbols = parsed.noRelatedSym();
+  CHECK_EQUAL( 2U, symbols.size() );
+
+  Symbol symbol;
+  SecurityAltID altID;
+  Symbols::const_iterator i = symbols.begin();
+  CHECK( i->isSet( symbol ) );
+  CHECK_EQUAL( "MSFT", i->get( symbol ) );
+  CHECK_EQUAL( 1U, i->noSecurityAltID().size() );
+  CHECK_EQUAL( "US5949181045", i->noSecurityAltID()[0].get( altID ) );
+  CHECK_EQUAL( "MSFT", ( FIELD_GET_REF( i->getFieldMap(), Symbol ) ).getString() );
+
+  ++i;
+  CHECK_EQUAL( "IBM", (*i).get( symbol ) );
+  SecurityID securityID;
+  CHECK( !i->getIfSet( securityID ) );
+  CHECK( i->noSecurityAltID().empty() );
+  CHECK( ++i == symbols.end() );
+
+  CHECK_EQUAL( "IBM", symbols[1].get( symbol ) );
+  CHECK( &symbols[0].getFieldMap() == &parsed.getGroupRef( 1, FIX::FIELD::NoRelatedSym ) );
+}
+
 TEST(logonGetString)
 {
   Logon object;
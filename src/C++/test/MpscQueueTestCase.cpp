@@ -0,0 +1,125 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <MpscQueue.h>
+
+using namespace FIX;
+
+SUITE(MpscQueueTests)
+{
+
+TEST(claimUntilFull)
+{
+  MpscQueue<int> object( 3 );
+  CHECK_EQUAL( 4U, object.capacity() );
+  CHECK( object.empty() );
+
+  uint64_t position;
+  for( int i = 0; i < 4; ++i )
+  {
+    int* pSlot = object.claim( position );
+    CHECK( pSlot != 0 );
+    if( !pSlot ) return;
+    CHECK_EQUAL( ( uint64_t ) i, position );
+    *pSlot = i;
+    object.publish( position );
+  }
+  CHECK( !object.claim( position ) );
+
+  CHECK_EQUAL( 0, *object.front() );
+  CHECK_EQUAL( 3, *object.front( 3 ) );
+  object.pop( 2 );
+  CHECK_EQUAL( 2U, object.popped() );
+  CHECK_EQUAL( 2, *object.front() );
+  CHECK( object.claim( position ) != 0 );
+  CHECK_EQUAL( 4U, position );
+}
+
+TEST(publishOutOfOrder)
+{
+  MpscQueue<int> object( 4 );
+  uint64_t first, second;
+  *object.claim( first ) = 1;
+  *object.claim( second ) = 2;
+
+  object.publish( second );
+  // the element behind the unpublished one waits for it
+  CHECK( !object.front() );
+
+  object.publish( first );
+  CHECK_EQUAL( 1, *object.front() );
+  CHECK_EQUAL( 2, *object.front( 1 ) );
+}
+
+struct Transfer
+{
+  enum { PRODUCERS = 4, COUNT = 20000 };
+  Transfer() : queue( 64 ), next( 0 ) {}
+  MpscQueue< std::pair<int, int> > queue;
+  atomic_count next;
+};
+
+THREAD_PROC produce( void* p )
+{
+  Transfer* pTransfer = static_cast < Transfer* > ( p );
+  int producer = ++pTransfer->next;
+  for( int i = 0; i < Transfer::COUNT; ++i )
+  {
+    uint64_t position;
+    std::pair<int, int>* pSlot;
+    while( !( pSlot = pTransfer->queue.claim( position ) ) ) {}
+    *pSlot = std::make_pair( producer, i );
+    pTransfer->queue.publish( position );
+  }
+  return 0;
+}
+
+TEST(keepsOrderOfEachProducer)
+{
+  Transfer transfer;
+  thread_id threads[ Transfer::PRODUCERS ];
+  for( int i = 0; i < Transfer::PRODUCERS; ++i )
+    CHECK( thread_spawn( &produce, &transfer, threads[ i ] ) );
+
+  std::vector<int> expected( Transfer::PRODUCERS + 1, 0 );
+  bool ordered = true;
+  for( int received = 0; received < Transfer::PRODUCERS * Transfer::COUNT; )
+  {
+    std::pair<int, int>* pValue = transfer.queue.front();
+    if( !pValue ) continue;
+    ordered = ordered && pValue->second == expected[ pValue->first ]++;
+    transfer.queue.pop();
+    ++received;
+  }
+  for( int i = 0; i < Transfer::PRODUCERS; ++i )
+    thread_join( threads[ i ] );
+
+  CHECK( ordered );
+  CHECK( transfer.queue.empty() );
+}
+
+}
@@ -0,0 +1,128 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#ifdef HAVE_POSTGRESQL
+
+#include <UnitTest++.h>
+#include <TestHelper.h>
+#include <PostgreSQLLog.h>
+
+using namespace FIX;
+
+SUITE(PostgreSQLLogTests)
+{
+
+struct copyPostgreSQLLogFixture
+{
+  copyPostgreSQLLogFixture()
+  : factory( TestSettings::sessionSettings ),
+    connection( "quickfix", "postgres", "password", "localhost", 0 )
+  {
+    try
+    {
+      object = (PostgreSQLLog*)factory.create();
+    }
+    catch( std::exception& e )
+    {
+      std::cerr << e.what() << std::endl;
+      throw;
+    }
+  }
+
+  ~copyPostgreSQLLogFixture()
+  {
+    factory.destroy( object );
+  }
+
+  int count( const std::string& text )
+  {
+    PostgreSQLQuery query( "SELECT count(*) FROM messages_log WHERE "
+                           "sendercompid IS NULL AND text='" + text + "'" );
+    if( !connection.execute( query ) )
+      return -1;
+    return atoi( query.getValue( 0, 0 ) );
+  }
+
+  PostgreSQLLogFactory factory;
+  PostgreSQLConnection connection;
+  PostgreSQLLog* object;
+};
+
+TEST(appendCopyValue)
+{
+  std::string row;
+  PostgreSQLLogWriter::appendCopyValue( row, "8=FIX.4.2\0019=5\00158=a\\b\tc\r\n" );
+  CHECK_EQUAL( "8=FIX.4.2\0019=5\00158=a\\\\b\\tc\\r\\n", row );
+}
+
+TEST_FIXTURE(copyPostgreSQLLogFixture, copy)
+{
+  DatabaseConnectionID id( "quickfix", "postgres", "password", "localhost", 0 );
+  PostgreSQLLogWriter* writer = factory.getWriter( id );
+  CHECK( writer != 0 );
+  DatabaseConnectionID other( "quickfix", "postgres", "password", "otherhost", 0 );
+  CHECK( factory.getWriter( other ) == 0 );
+  int before = count( "copy\\1" );
+
+  for( int i = 0; i < 100; ++i )
+    object->onIncoming( "copy\\1" );
+  object->onEvent( "copy event" );
+  writer->flush();
+
+  PostgreSQLLogWriter::Stats stats;
+  writer->getStats( stats );
+  CHECK_EQUAL( 101U, stats.written );
+  CHECK_EQUAL( 0U, stats.failed );
+  CHECK_EQUAL( 0U, stats.pendingBytes );
+  CHECK_EQUAL( before + 100, count( "copy\\1" ) );
+}
+
+TEST_FIXTURE(copyPostgreSQLLogFixture, drop)
+{
+  DatabaseConnectionID id( "quickfix", "postgres", "password", "localhost", 0 );
+  PostgreSQLLogWriter writer( id, 200, 60000 );
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "COPY" ), TargetCompID( "TEST" ) );
+
+  int added = 0;
+  for( int i = 0; i < 100; ++i )
+  {
+    if( writer.add( "messages_log", &sessionID, "dropped" ) )
+      ++added;
+  }
+  CHECK( added > 0 );
+
+  PostgreSQLLogWriter::Stats stats;
+  writer.getStats( stats );
+  CHECK_EQUAL( 100U, added + stats.dropped );
+  CHECK( stats.dropped > 0 );
+  CHECK( stats.pendingBytes <= 200 );
+  CHECK( stats.lag >= 0 );
+}
+
+}
+
+#endif
@@ -85,9 +85,41 @@ TEST_FIXTURE(resetPostgreSQLStoreFixture, setGet)
   CHECK_MESSAGE_STORE_SET_GET;
 }
 
+TEST_FIXTURE(resetPostgreSQLStoreFixture, setMany)
+{
+  CHECK_MESSAGE_STORE_SET_MANY;
+}
+
 TEST_FIXTURE(resetPostgreSQLStoreFixture, setGetWithQuote)
 {
-  //CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
+  CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
+}
+
+TEST_FIXTURE(resetPostgreSQLStoreFixture, batch)
+{
+  PostgreSQLStore* store = static_cast<PostgreSQLStore*>( object );
+  store->setBatch( 10, 1000 );
+  for( int i = 1; i <= 5; ++i )
+  {
+    store->set( i, "message" + IntConvertor::convert( i ) );
+    store->incrNextSenderMsgSeqNum();
+  }
+
+  std::vector < std::string > messages;
+  store->get( 1, 5, messages );
+  CHECK_EQUAL( 5U, messages.size() );
+  CHECK_EQUAL( "message5", messages[4] );
+
+  store->set( 6, "message6" );
+  store->incrNextSenderMsgSeqNum();
+  factory.destroy( object );
+
+  object = factory.create( SessionID( BeginString( "FIX.4.2" ),
+                           SenderCompID( "SETGET" ), TargetCompID( "TEST" ) ) );
+  CHECK_EQUAL( 7, object->getNextSenderMsgSeqNum() );
+  object->get( 6, 6, messages );
+  CHECK_EQUAL( 1U, messages.size() );
+  CHECK_EQUAL( "message6", messages[0] );
 }
 
 TEST_FIXTURE(resetPostgreSQLStoreFixture, other)
@@ -0,0 +1,198 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <SequenceBuffer.h>
+#include <climits>
+#include <fix42/Heartbeat.h>
+
+using namespace FIX;
+
+SUITE(SequenceBufferTests)
+{
+
+FIX42::Heartbeat createSequenced( int seq )
+{
+  FIX42::Heartbeat heartbeat;
+  heartbeat.getHeader().setField( MsgSeqNum( seq ) );
+  return heartbeat;
+}
+
+int seqOf( const FIX::Message& message )
+{
+  MsgSeqNum msgSeqNum;
+  message.getHeader().getField( msgSeqNum );
+  return msgSeqNum;
+}
+
+void release( SequenceBuffer::Messages& messages )
+{
+  for( size_t i = 0; i < messages.size(); ++i )
+    delete messages[ i ];
+  messages.clear();
+}
+
+TEST(popSingle)
+{
+  SequenceBuffer object;
+  CHECK( object.empty() );
+
+  CHECK( object.push( 2, 5, createSequenced( 5 ) ) );
+  CHECK( object.push( 2, 3, createSequenced( 3 ) ) );
+  CHECK_EQUAL( 2, object.size() );
+
+  FIX::Message message;
+  CHECK( !object.pop( 4, message ) );
+  CHECK( object.pop( 5, message ) );
+  CHECK_EQUAL( 5, seqOf( message ) );
+
+  // anything below the requested number was discarded
+  CHECK( object.empty() );
+  CHECK( !object.pop( 3, message ) );
+}
+
+TEST(popContiguousRun)
+{
+  SequenceBuffer object;
+  for( int i = 10; i < 15; ++i )
+    CHECK( object.push( 9, i, createSequenced( i ) ) );
+  CHECK( object.push( 9, 16, createSequenced( 16 ) ) );
+
+  SequenceBuffer::Messages messages;
+  CHECK_EQUAL( 0, object.pop( 9, messages ) );
+  CHECK_EQUAL( 5, object.pop( 10, messages ) );
+  CHECK_EQUAL( 5, (int)messages.size() );
+  for( int i = 0; i < 5; ++i )
+    CHECK_EQUAL( 10 + i, seqOf( *messages[ i ] ) );
+  release( messages );
+
+  CHECK_EQUAL( 1, object.size() );
+  CHECK_EQUAL( 0, object.pop( 15, messages ) );
+  CHECK_EQUAL( 1, object.pop( 16, messages ) );
+  release( messages );
+  CHECK( object.empty() );
+}
+
+TEST(growsAcrossWrap)
+{
+  SequenceBuffer object;
+  for( int i = 1000; i > 0; i -= 3 )
+    CHECK( object.push( 1, i, createSequenced( i ) ) );
+  for( int i = 1001; i < 1100; ++i )
+    CHECK( object.push( 1, i, createSequenced( i ) ) );
+
+  SequenceBuffer::Messages messages;
+  CHECK_EQUAL( 1, object.pop( 1, messages ) );
+  CHECK_EQUAL( 100, object.pop( 1000, messages ) );
+  CHECK_EQUAL( 101, (int)messages.size() );
+  CHECK_EQUAL( 1099, seqOf( *messages.back() ) );
+  release( messages );
+  CHECK( object.empty() );
+}
+
+TEST(replaceDuplicate)
+{
+  SequenceBuffer object;
+  CHECK( object.push( 1, 7, createSequenced( 7 ) ) );
+  FIX42::Heartbeat heartbeat = createSequenced( 7 );
+  heartbeat.set( TestReqID( "again" ) );
+  CHECK( object.push( 1, 7, heartbeat ) );
+  CHECK_EQUAL( 1, object.size() );
+
+  FIX::Message message;
+  CHECK( object.pop( 7, message ) );
+  CHECK( message.isSetField( FIELD::TestReqID ) );
+}
+
+TEST(maxSize)
+{
+  SequenceBuffer object( 4 );
+  CHECK( object.push( 9, 10, createSequenced( 10 ) ) );
+  CHECK( object.push( 9, 13, createSequenced( 13 ) ) );
+  CHECK( !object.push( 9, 14, createSequenced( 14 ) ) );
+  CHECK( !object.push( 9, 8, createSequenced( 8 ) ) );
+  CHECK( object.push( 9, 11, createSequenced( 11 ) ) );
+  CHECK_EQUAL( 3, object.size() );
+
+  object.clear();
+  CHECK( object.empty() );
+  CHECK( object.push( 14, 14, createSequenced( 14 ) ) );
+}
+
+TEST(farAheadIsSpilled)
+{
+  // a huge gap must neither allocate a slot per number nor overflow
+  SequenceBuffer object;
+  CHECK( object.push( 5, 10, createSequenced( 10 ) ) );
+  CHECK( object.push( 5, INT_MAX, createSequenced( INT_MAX ) ) );
+  CHECK( object.push( 5, INT_MAX - 1, createSequenced( INT_MAX - 1 ) ) );
+  CHECK_EQUAL( 3, object.size() );
+
+  SequenceBuffer::Messages messages;
+  CHECK_EQUAL( 1, object.pop( 10, messages ) );
+  CHECK_EQUAL( 0, object.pop( 11, messages ) );
+  CHECK_EQUAL( 2, object.size() );
+
+  // the window catches up with what was spilled
+  CHECK_EQUAL( 2, object.pop( INT_MAX - 1, messages ) );
+  CHECK_EQUAL( 3, (int)messages.size() );
+  CHECK_EQUAL( INT_MAX, seqOf( *messages.back() ) );
+  release( messages );
+  CHECK( object.empty() );
+}
+
+TEST(spilledRunDrains)
+{
+  SequenceBuffer object;
+  for( int i = 100000; i < 100010; ++i )
+    CHECK( object.push( 1, i, createSequenced( i ) ) );
+  CHECK( object.push( 1, 2, createSequenced( 2 ) ) );
+
+  SequenceBuffer::Messages messages;
+  CHECK_EQUAL( 1, object.pop( 2, messages ) );
+  CHECK_EQUAL( 10, object.pop( 100000, messages ) );
+  CHECK_EQUAL( 11, (int)messages.size() );
+  for( int i = 1; i < 11; ++i )
+    CHECK_EQUAL( 99999 + i, seqOf( *messages[ i ] ) );
+  release( messages );
+  CHECK( object.empty() );
+}
+
+TEST(expectedNumberGoesBack)
+{
+  SequenceBuffer object;
+  CHECK( object.push( 100, 120, createSequenced( 120 ) ) );
+  CHECK( object.push( 50, 60, createSequenced( 60 ) ) );
+  CHECK_EQUAL( 2, object.size() );
+
+  FIX::Message message;
+  CHECK( object.pop( 60, message ) );
+  CHECK( object.pop( 120, message ) );
+  CHECK_EQUAL( 120, seqOf( message ) );
+  CHECK( object.empty() );
+}
+
+}
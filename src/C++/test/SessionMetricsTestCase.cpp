@@ -0,0 +1,104 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <SessionMetrics.h>
+#include <string.h>
+
+using namespace FIX;
+
+SUITE(SessionMetricsTests)
+{
+
+TEST(add)
+{
+  SessionMetrics metrics;
+  metrics.add( SessionMetrics::MESSAGES_SENT );
+  metrics.add( SessionMetrics::MESSAGES_SENT );
+  metrics.add( SessionMetrics::BYTES_SENT, 120 );
+  CHECK_EQUAL( 2U, metrics.get( SessionMetrics::MESSAGES_SENT ) );
+  CHECK_EQUAL( 120U, metrics.get( SessionMetrics::BYTES_SENT ) );
+  CHECK_EQUAL( 0U, metrics.get( SessionMetrics::MESSAGES_RECEIVED ) );
+
+  metrics.reset();
+  CHECK_EQUAL( 0U, metrics.get( SessionMetrics::MESSAGES_SENT ) );
+}
+
+TEST(addReject)
+{
+  SessionMetrics metrics;
+  metrics.addReject( 5 );
+  metrics.addReject( 5 );
+  metrics.addReject( 99 );
+  metrics.addReject( -1 );
+
+  SessionMetrics::Snapshot snapshot;
+  metrics.getSnapshot( snapshot );
+  CHECK_EQUAL( 2U, snapshot.counts[ SessionMetrics::REJECTS_SENT + 5 ] );
+  CHECK_EQUAL( 2U, snapshot.counts
+    [ SessionMetrics::REJECTS_SENT + SessionMetrics::REJECT_REASONS - 1 ] );
+  CHECK_EQUAL( 0U, snapshot.counts[ SessionMetrics::MESSAGES_SENT ] );
+}
+
+TEST(addWrite)
+{
+  SessionMetrics metrics;
+  metrics.addWrite( SessionMetrics::STORE_WRITES, LatencyHistogram::now() );
+  CHECK_EQUAL( 1U, metrics.get( SessionMetrics::STORE_WRITES ) );
+  CHECK_EQUAL( 0U, metrics.get( SessionMetrics::LOG_WRITES ) );
+}
+
+TEST(getName)
+{
+  CHECK( strcmp( "messages_received",
+                 SessionMetrics::getName( SessionMetrics::MESSAGES_RECEIVED ) ) == 0 );
+  CHECK( strcmp( "log_write_nanoseconds",
+                 SessionMetrics::getName( SessionMetrics::LOG_WRITE_NANOSECONDS ) ) == 0 );
+  CHECK( strcmp( "spin_parks",
+                 SessionMetrics::getName( SessionMetrics::SPIN_PARKS ) ) == 0 );
+}
+
+THREAD_PROC addFromThread( void* p )
+{
+  SessionMetrics* pMetrics = static_cast<SessionMetrics*>( p );
+  for( int i = 0; i < 100000; ++i )
+    pMetrics->add( SessionMetrics::MESSAGES_SENT );
+  return 0;
+}
+
+TEST(addFromThreads)
+{
+  SessionMetrics* pMetrics = new SessionMetrics;
+  thread_id threads[ 8 ];
+  for( int i = 0; i < 8; ++i )
+    CHECK( thread_spawn( &addFromThread, pMetrics, threads[ i ] ) );
+  for( int i = 0; i < 8; ++i )
+    thread_join( threads[ i ] );
+  CHECK_EQUAL( 800000U, pMetrics->get( SessionMetrics::MESSAGES_SENT ) );
+  delete pMetrics;
+}
+
+}
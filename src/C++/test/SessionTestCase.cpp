@@ -59,6 +59,8 @@ protected:
   UtcTimeStamp startTimeStamp;
   UtcTimeStamp endTimeStamp;
   FIX::Message lastResent;
+  std::string toAppText;
+  std::string toAppPrice;
 
 public:
   TestCallback()
@@ -76,10 +78,13 @@ public:
     fromReject( 0 ),
     fromSequenceReset( 0 ),
     resent( 0 ),
-    disconnected( 0 )
+    disconnected( 0 ),
+    rescheduled( 0 ),
+    writes( 0 )
     {}
 
-  bool send( const std::string& ) { return true; }
+  bool send( const std::string& string )
+  { writes++; lastWrite = string; return true; }
 
   void toAdmin( FIX::Message& message, const SessionID& )
   {
@@ -143,6 +148,10 @@ public:
       resent++;
       lastResent = message;
     }
+    if( !toAppText.empty() )
+      message.setField( Text( toAppText ) );
+    if( !toAppPrice.empty() )
+      message.setField( FIELD::Price, toAppPrice );
 
     MsgType msgType;
     message.getHeader().getField( msgType );
@@ -154,6 +163,7 @@ public:
   }
 
   void disconnect() { disconnected++; }
+  void reschedule() { rescheduled++; }
 
   FIX::Message sentLogon;
   FIX::Message sentResendRequest;
@@ -172,6 +182,9 @@ public:
   int fromSequenceReset;
   int resent;
   int disconnected;
+  int rescheduled;
+  int writes;
+  std::string lastWrite;
 
   MemoryStoreFactory factory;
 };
@@ -464,6 +477,80 @@ TEST_FIXTURE(acceptorFixture, nextLogon)
   CHECK_EQUAL( 0, encryptMethod );
 }
 
+TEST_FIXTURE(acceptorFixture, latencyHistograms)
+{
+  CHECK( !object->getLatencyHistograms() );
+  object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
+  CHECK_EQUAL( 0U, object->getLatencyHistogram( Session::LATENCY_SEND ).getCount() );
+
+  object->setLatencyHistograms( true );
+  object->next( createNewOrderSingle( "ISLD", "TW", 2 ), UtcTimeStamp() );
+  object->next( createNewOrderSingle( "ISLD", "TW", 3 ).toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 1U, object->getLatencyHistogram( Session::LATENCY_PARSE ).getCount() );
+  CHECK_EQUAL( 2U, object->getLatencyHistogram( Session::LATENCY_VALIDATE ).getCount() );
+  CHECK_EQUAL( 2U, object->getLatencyHistogram( Session::LATENCY_APPLICATION ).getCount() );
+
+  FIX42::ExecutionReport executionReport;
+  CHECK( object->send( executionReport ) );
+  CHECK_EQUAL( 1U, object->getLatencyHistogram( Session::LATENCY_SERIALIZE ).getCount() );
+  CHECK_EQUAL( 1U, object->getLatencyHistogram( Session::LATENCY_PERSIST ).getCount() );
+  CHECK_EQUAL( 1U, object->getLatencyHistogram( Session::LATENCY_SEND ).getCount() );
+
+  object->resetLatencyHistograms();
+  CHECK_EQUAL( 0U, object->getLatencyHistogram( Session::LATENCY_SEND ).getCount() );
+  object->setLatencyHistograms( false );
+  CHECK( !object->getLatencyHistograms() );
+
+  // switched off and on again on a running session, nothing is freed
+  CHECK( object->send( executionReport ) );
+  CHECK_EQUAL( 0U, object->getLatencyHistogram( Session::LATENCY_SEND ).getCount() );
+  object->setLatencyHistograms( true );
+  CHECK( object->send( executionReport ) );
+  CHECK_EQUAL( 1U, object->getLatencyHistogram( Session::LATENCY_SEND ).getCount() );
+}
+
+TEST_FIXTURE(acceptorFixture, collectMetrics)
+{
+  CHECK( !object->getCollectMetrics() );
+  CHECK( !object->getMetrics() );
+  object->setCollectMetrics( true );
+  const SessionMetrics& metrics = *object->getMetrics();
+
+  std::string logon = createLogon( "ISLD", "TW", 1 ).toString();
+  object->next( logon, UtcTimeStamp() );
+  object->next( createTestRequest( "ISLD", "TW", 2, "HELLO" ).toString(), UtcTimeStamp() );
+  object->next( createHeartbeat( "ISLD", "TW", 3 ).toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 3U, metrics.get( SessionMetrics::MESSAGES_RECEIVED ) );
+  CHECK( metrics.get( SessionMetrics::BYTES_RECEIVED ) > logon.size() );
+  CHECK_EQUAL( 1U, metrics.get( SessionMetrics::TEST_REQUESTS_RECEIVED ) );
+  CHECK_EQUAL( 1U, metrics.get( SessionMetrics::HEARTBEATS_RECEIVED ) );
+  CHECK_EQUAL( 1U, metrics.get( SessionMetrics::HEARTBEATS_SENT ) );
+  // logon response and heartbeat
+  CHECK_EQUAL( 2U, metrics.get( SessionMetrics::MESSAGES_SENT ) );
+  CHECK_EQUAL( 2U, metrics.get( SessionMetrics::STORE_WRITES ) );
+  CHECK_EQUAL( 5U, metrics.get( SessionMetrics::LOG_WRITES ) );
+
+  object->next( createReject( "ISLD", "TW", 4, 2 ), UtcTimeStamp() );
+  CHECK_EQUAL( 1U, metrics.get( SessionMetrics::REJECTS_RECEIVED ) );
+
+  size_t messages = 1;
+  size_t bytes = 1;
+  object->getSendQueue( messages, bytes );
+  CHECK_EQUAL( 0U, messages );
+  CHECK_EQUAL( 0U, bytes );
+  CHECK_EQUAL( 0, object->getQueuedMessages() );
+  object->next( createHeartbeat( "ISLD", "TW", 10 ), UtcTimeStamp() );
+  CHECK_EQUAL( 1, object->getQueuedMessages() );
+
+  // the counters outlive switching them off on a running session
+  object->setCollectMetrics( false );
+  CHECK( !object->getMetrics() );
+  object->next( createHeartbeat( "ISLD", "TW", 5 ).toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 3U, metrics.get( SessionMetrics::MESSAGES_RECEIVED ) );
+  object->setCollectMetrics( true );
+  CHECK( &metrics == object->getMetrics() );
+}
+
 TEST_FIXTURE(acceptorFixture, nextLogonNoEncryptMethod)
 {
   // send a correct logon
@@ -814,6 +901,34 @@ TEST_FIXTURE(acceptorFixture, nextLogout)
   CHECK_EQUAL( 1, fromLogout );
 }
 
+TEST_FIXTURE(acceptorFixture, nextTimeout)
+{
+  object->setResponder( this );
+  object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
+  CHECK( object->isLoggedOn() );
+
+  // nothing is due before the heartbeat
+  UtcTimeStamp now;
+  UtcTimeStamp heartbeat = now;
+  heartbeat += 29;
+  CHECK( heartbeat < object->getNextTimeout( now ) );
+
+  // a logout asked for from outside is due straight away
+  int count = rescheduled;
+  object->logout();
+  CHECK_EQUAL( count + 1, rescheduled );
+  CHECK( object->getNextTimeout( now ) == now );
+
+  // then the logout timeout is
+  object->next( now );
+  CHECK_EQUAL( 1, toLogout );
+  CHECK_EQUAL( count + 2, rescheduled );
+  UtcTimeStamp logoutTimeout = now;
+  logoutTimeout += object->getLogoutTimeout() + 1;
+  CHECK( now < object->getNextTimeout( now ) );
+  CHECK( object->getNextTimeout( now ) < logoutTimeout );
+}
+
 TEST_FIXTURE(initiatorFixture, logoutInitiator)
 {
   object->setResponder( this );
@@ -880,6 +995,271 @@ TEST_FIXTURE(acceptorFixture, noOrigSendingTime)
   CHECK_EQUAL( 1, disconnected );
 }
 
+TEST_FIXTURE(acceptorFixture, lazyBodyParsing)
+{
+  object->setResponder( this );
+  object->setLazyBodyParsing( true );
+  object->next( createLogon( "ISLD", "TW", 1 ).toString(), UtcTimeStamp() );
+  object->next( createNewOrderSingle( "ISLD", "TW", 2 ).toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 3, object->getExpectedTargetNum() );
+
+  UtcTimeStamp timeStamp;
+  timeStamp.setSecond( 10 );
+
+  FIX42::NewOrderSingle duplicate = createNewOrderSingle( "ISLD", "TW", 2 );
+  duplicate.getHeader().setField( SendingTime( timeStamp ) );
+  duplicate.getHeader().setField( OrigSendingTime( timeStamp ) );
+  duplicate.getHeader().setField( PossDupFlag( true ) );
+  object->next( duplicate.toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 0, toReject );
+  CHECK_EQUAL( 3, object->getExpectedTargetNum() );
+
+  duplicate.getHeader().removeField( FIELD::OrigSendingTime );
+  object->next( duplicate.toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 1, toReject );
+
+  FIX42::NewOrderSingle newOrderSingle = createNewOrderSingle( "ISLD", "TW", 3 );
+  newOrderSingle.setField( EncryptMethod( 0 ) );
+  object->next( newOrderSingle.toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 2, toReject );
+  CHECK_EQUAL( 4, object->getExpectedTargetNum() );
+
+  object->next( createNewOrderSingle( "ISLD", "TW", 3 ).toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 1, toLogout );
+  CHECK_EQUAL( 1, disconnected );
+}
+
+TEST(lazyBodyParsingValidatesTooLowHeader)
+{
+  // a message with a sequence number too low is handled the same with
+  // and without lazy body parsing, header validation included
+  int rejects[ 2 ], logouts[ 2 ], expected[ 2 ];
+  for( int lazy = 0; lazy < 2; ++lazy )
+  {
+    acceptorFixture fixture;
+    Session* object = fixture.object;
+    object->setLazyBodyParsing( lazy != 0 );
+    object->next( createLogon( "ISLD", "TW", 1 ).toString(), UtcTimeStamp() );
+    object->next( createNewOrderSingle( "ISLD", "TW", 2 ).toString(), UtcTimeStamp() );
+
+    UtcTimeStamp timeStamp;
+    timeStamp.setSecond( 10 );
+    FIX42::NewOrderSingle duplicate = createNewOrderSingle( "ISLD", "TW", 2 );
+    duplicate.getHeader().setField( SendingTime( timeStamp ) );
+    duplicate.getHeader().setField( OrigSendingTime( timeStamp ) );
+    duplicate.getHeader().setField( PossDupFlag( true ) );
+    duplicate.getHeader().setField( FIELD::PossResend, "Z" );
+    object->next( duplicate.toString(), UtcTimeStamp() );
+
+    rejects[ lazy ] = fixture.toReject;
+    logouts[ lazy ] = fixture.toLogout;
+    expected[ lazy ] = object->getExpectedTargetNum();
+  }
+
+  CHECK_EQUAL( 1, rejects[ 0 ] );
+  CHECK_EQUAL( rejects[ 0 ], rejects[ 1 ] );
+  CHECK_EQUAL( logouts[ 0 ], logouts[ 1 ] );
+  CHECK_EQUAL( expected[ 0 ], expected[ 1 ] );
+}
+
+TEST_FIXTURE(acceptorFixture, lazyBodyMsgTypes)
+{
+  std::set<std::string> msgTypes;
+  msgTypes.insert( "D" );
+
+  object->setResponder( this );
+  object->setLazyBodyParsing( true );
+  object->setLazyBodyMsgTypes( msgTypes );
+  object->next( createLogon( "ISLD", "TW", 1 ).toString(), UtcTimeStamp() );
+
+  // the body is left to the application, so it is not validated
+  FIX42::NewOrderSingle newOrderSingle = createNewOrderSingle( "ISLD", "TW", 2 );
+  newOrderSingle.setField( EncryptMethod( 0 ) );
+  object->next( newOrderSingle.toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 0, toReject );
+  CHECK_EQUAL( 3, object->getExpectedTargetNum() );
+
+  // the header still is
+  newOrderSingle = createNewOrderSingle( "ISLD", "TW", 3 );
+  newOrderSingle.getHeader().setField( FIELD::PossResend, "Z" );
+  object->next( newOrderSingle.toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 1, toReject );
+}
+
+TEST_FIXTURE(acceptorFixture, nextPrepared)
+{
+  object->setResponder( this );
+
+  FIX::Message message;
+  bool validated = false;
+  std::string logon = createLogon( "ISLD", "TW", 1 ).toString();
+  CHECK( object->prepare( logon, message, validated ) );
+  CHECK( validated );
+  object->next( logon, message, validated, UtcTimeStamp() );
+  CHECK( object->isLoggedOn() );
+  CHECK_EQUAL( 2, object->getExpectedTargetNum() );
+
+  std::string order = createNewOrderSingle( "ISLD", "TW", 2 ).toString();
+  CHECK( object->prepare( order, message, validated ) );
+  object->next( order, message, validated, UtcTimeStamp() );
+  CHECK_EQUAL( 3, object->getExpectedTargetNum() );
+
+  std::string garbled = order.substr( 0, order.size() - 4 ) + "999\001";
+  CHECK( !object->prepare( garbled, message, validated ) );
+  CHECK( !validated );
+  CHECK_EQUAL( 3, object->getExpectedTargetNum() );
+}
+
+TEST_FIXTURE(acceptorFixture, asyncSend)
+{
+  object->setResponder( this );
+  object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
+  CHECK_EQUAL( 2, object->getExpectedSenderNum() );
+
+  object->setAsyncSend( 4 );
+  CHECK_EQUAL( 4, object->getAsyncSendQueueSize() );
+
+  FIX42::ExecutionReport report = createExecutionReport( "TW", "ISLD", 1 );
+  uint64_t ticket = 0;
+  for( int i = 0; i < 10; ++i )
+  {
+    FIX::Message message( report );
+    ticket = object->sendAsync( message );
+    CHECK_EQUAL( ( uint64_t ) i + 1, ticket );
+    CHECK( message.isEmpty() );
+  }
+
+  // send() takes the message as well
+  FIX::Message message( report );
+  CHECK( object->send( message ) );
+  CHECK( message.isEmpty() );
+  CHECK( object->waitForSend( ticket + 1, 5 ) );
+  CHECK_EQUAL( 0U, object->getAsyncSendQueued() );
+  CHECK_EQUAL( 13, object->getExpectedSenderNum() );
+
+  std::vector < std::string > messages;
+  object->getStore()->get( 2, 12, messages );
+  CHECK_EQUAL( 11U, messages.size() );
+
+  object->setAsyncSend( 0 );
+  CHECK_EQUAL( 0U, object->sendAsync( report ) );
+  CHECK( object->send( report ) );
+  CHECK_EQUAL( 14, object->getExpectedSenderNum() );
+}
+
+TEST_FIXTURE(acceptorFixture, sendBatch)
+{
+  object->setResponder( this );
+  object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
+  CHECK_EQUAL( 2, object->getExpectedSenderNum() );
+  CHECK_EQUAL( 1, writes );
+
+  std::vector < FIX::Message > reports
+    ( 10, createExecutionReport( "TW", "ISLD", 1 ) );
+  reports[ 3 ].getHeader().setField( PossDupFlag( true ) );
+  CHECK( object->send( reports ) );
+  CHECK_EQUAL( 2, writes );
+  CHECK_EQUAL( 12, object->getExpectedSenderNum() );
+  CHECK( !reports[ 3 ].getHeader().isSetField( FIELD::PossDupFlag ) );
+
+  std::vector < std::string > messages;
+  object->getStore()->get( 2, 11, messages );
+  CHECK_EQUAL( 10U, messages.size() );
+  for( int i = 0; i < 10; ++i )
+  {
+    MsgSeqNum msgSeqNum;
+    reports[ i ].getHeader().getField( msgSeqNum );
+    CHECK_EQUAL( i + 2, msgSeqNum );
+    CHECK_EQUAL( reports[ i ].toString(), messages[ i ] );
+  }
+
+  // an admin message in the middle is sent in place
+  std::vector < FIX::Message > mixed( 1, createExecutionReport( "TW", "ISLD", 1 ) );
+  mixed.push_back( createHeartbeat( "TW", "ISLD", 1 ) );
+  mixed.push_back( createExecutionReport( "TW", "ISLD", 1 ) );
+  CHECK( object->send( mixed ) );
+  CHECK_EQUAL( 3, writes );
+  CHECK_EQUAL( 1, toHeartbeat );
+  CHECK_EQUAL( 15, object->getExpectedSenderNum() );
+  object->getStore()->get( 12, 14, messages );
+  CHECK_EQUAL( 3U, messages.size() );
+  CHECK_EQUAL( mixed[ 1 ].toString(), messages[ 1 ] );
+
+  std::vector < FIX::Message > none;
+  CHECK( object->send( none ) );
+  CHECK_EQUAL( 3, writes );
+}
+
+TEST_FIXTURE(acceptorFixture, sendToTargets)
+{
+  object->setResponder( this );
+  object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
+
+  // persists nothing and has no log, so it gets the message in pieces
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "TW" ), TargetCompID( "DLSI" ) );
+  Session other( *this, factory, sessionID, object->getDataDictionaryProvider(),
+                 TimeRange( startTime, endTime ), 0, 0 );
+  other.setPersistMessages( false );
+  other.setResponder( this );
+  other.next( createLogon( "DLSI", "TW", 1 ), UtcTimeStamp() );
+  CHECK( other.isLoggedOn() );
+
+  std::vector < SessionID > sessionIDs;
+  sessionIDs.push_back( object->getSessionID() );
+  sessionIDs.push_back( object->getSessionID() );
+  sessionIDs.push_back( sessionID );
+
+  FIX42::ExecutionReport report = createExecutionReport( "TW", "ISLD", 1 );
+  report.getHeader().setField( PossDupFlag( true ) );
+  int before = writes;
+  CHECK_EQUAL( 3, Session::sendToTargets( report, sessionIDs ) );
+  CHECK_EQUAL( before + 3, writes );
+  CHECK_EQUAL( 4, object->getExpectedSenderNum() );
+  CHECK_EQUAL( 3, other.getExpectedSenderNum() );
+
+  std::vector < std::string > messages;
+  object->getStore()->get( 2, 3, messages );
+  CHECK_EQUAL( 2U, messages.size() );
+  FIX::Message first( messages[ 0 ] );
+  CHECK_EQUAL( "ISLD", first.getHeader().getField( FIELD::TargetCompID ) );
+  CHECK_EQUAL( "2", first.getHeader().getField( FIELD::MsgSeqNum ) );
+  CHECK( !first.getHeader().isSetField( FIELD::PossDupFlag ) );
+  CHECK_EQUAL( report.getField( FIELD::ExecID ), first.getField( FIELD::ExecID ) );
+
+  other.getStore()->get( 2, 2, messages );
+  CHECK_EQUAL( 0U, messages.size() );
+  FIX::Message last( lastWrite );
+  CHECK_EQUAL( "DLSI", last.getHeader().getField( FIELD::TargetCompID ) );
+  CHECK_EQUAL( "2", last.getHeader().getField( FIELD::MsgSeqNum ) );
+  CHECK_EQUAL( first.getField( FIELD::ExecID ), last.getField( FIELD::ExecID ) );
+
+  // a body changed by toApp is serialized again, for the store and the wire
+  toAppText = "changed by toApp";
+  CHECK_EQUAL( 3, Session::sendToTargets( report, sessionIDs ) );
+  object->getStore()->get( 5, 5, messages );
+  CHECK_EQUAL( 1U, messages.size() );
+  CHECK_EQUAL( toAppText, FIX::Message( messages[ 0 ] ).getField( FIELD::Text ) );
+  CHECK_EQUAL( toAppText, FIX::Message( lastWrite ).getField( FIELD::Text ) );
+  report.removeField( FIELD::Text );
+  toAppText = "";
+
+  // as is one that keeps the length and byte sum of the body
+  report.setField( FIELD::Price, "12.5" );
+  toAppPrice = "21.5";
+  CHECK_EQUAL( 3, Session::sendToTargets( report, sessionIDs ) );
+  object->getStore()->get( 7, 7, messages );
+  CHECK_EQUAL( 1U, messages.size() );
+  CHECK_EQUAL( "21.5", FIX::Message( messages[ 0 ] ).getField( FIELD::Price ) );
+  CHECK_EQUAL( "21.5", FIX::Message( lastWrite ).getField( FIELD::Price ) );
+  toAppPrice = "";
+
+  sessionIDs.push_back( SessionID( BeginString( "FIX.4.2" ),
+                                   SenderCompID( "TW" ), TargetCompID( "NONE" ) ) );
+  CHECK_THROW( Session::sendToTargets( report, sessionIDs ), SessionNotFound );
+  CHECK_EQUAL( 8, object->getExpectedSenderNum() );
+}
+
 TEST_FIXTURE(acceptorFixture, badCompID)
 {
   object->setResponder( this );
@@ -1330,6 +1710,29 @@ TEST_FIXTURE(acceptorFixture, processQueuedMessages)
   CHECK_EQUAL( 2, toResendRequest );
 }
 
+TEST_FIXTURE(acceptorFixture, queueOverflow)
+{
+  object->setResponder( this );
+  object->setMaxQueuedMessages( 10 );
+  object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
+
+  for( int i = 3; i <= 20; ++i )
+  {
+    object->next( createNewOrderSingle( "ISLD", "TW", i ), UtcTimeStamp() );
+  }
+  CHECK_EQUAL( 2, object->getExpectedTargetNum() );
+  CHECK_EQUAL( 0, disconnected );
+
+  object->next( createNewOrderSingle( "ISLD", "TW", 2 ), UtcTimeStamp() );
+  CHECK_EQUAL( 13, object->getExpectedTargetNum() );
+
+  object->setDisconnectOnQueueOverflow( true );
+  object->next( createNewOrderSingle( "ISLD", "TW", 14 ), UtcTimeStamp() );
+  CHECK_EQUAL( 0, disconnected );
+  object->next( createNewOrderSingle( "ISLD", "TW", 30 ), UtcTimeStamp() );
+  CHECK_EQUAL( 1, disconnected );
+}
+
 struct initiatorCreatedBeforeStartTimeFixture : public TestCallback
 {
   static const int HEARTBTINT = 30;
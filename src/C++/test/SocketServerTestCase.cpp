@@ -134,6 +134,30 @@ TEST_FIXTURE(socketServerFixture, block)
   CHECK( disconnectSocket > 0 );
 }
 
+TEST_FIXTURE(socketServerFixture, spin)
+{
+  SocketServer object( 0 );
+  object.getMonitor().setSpinTime( 100000 );
+  object.add( TestSettings::port, true, true );
+  int clientS = createSocket( TestSettings::port, "127.0.0.1" );
+  CHECK( clientS >= 0 );
+
+  // the connection is found while spinning, without blocking in select
+  object.block( *this );
+  CHECK_EQUAL( 1, connect );
+  CHECK_EQUAL( 1U, object.getMonitor().getSpinCount() );
+  CHECK_EQUAL( 0U, object.getMonitor().getParkCount() );
+
+  // once the new socket is writable, nothing comes in, so spinning runs
+  // out before blocking
+  object.block( *this );
+  object.getMonitor().setSpinTime( 1000 );
+  object.block( *this, false, 0.01 );
+  CHECK_EQUAL( 1U, object.getMonitor().getParkCount() );
+
+  destroySocket( clientS );
+}
+
 TEST_FIXTURE(socketServerFixture, close)
 {
   SocketServer object( 0 );
@@ -0,0 +1,129 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <SpscQueue.h>
+
+using namespace FIX;
+
+SUITE(SpscQueueTests)
+{
+
+TEST(capacityIsPowerOfTwo)
+{
+  CHECK_EQUAL( 1U, SpscQueue<int>( 0 ).capacity() );
+  CHECK_EQUAL( 8U, SpscQueue<int>( 5 ).capacity() );
+  CHECK_EQUAL( 16U, SpscQueue<int>( 16 ).capacity() );
+}
+
+TEST(claimUntilFull)
+{
+  SpscQueue<int> object( 4 );
+  CHECK( object.empty() );
+  CHECK( !object.front() );
+
+  for( int i = 0; i < 4; ++i )
+  {
+    int* pSlot = object.claim();
+    CHECK( pSlot != 0 );
+    if( !pSlot ) return;
+    *pSlot = i;
+    object.publish();
+  }
+  CHECK_EQUAL( 4U, object.size() );
+  CHECK( !object.claim() );
+
+  CHECK_EQUAL( 0, *object.front() );
+  object.pop();
+  CHECK( object.claim() != 0 );
+}
+
+TEST(claimedSlotNotVisibleUntilPublished)
+{
+  SpscQueue<int> object( 2 );
+  *object.claim() = 7;
+  CHECK( !object.front() );
+  object.publish();
+  CHECK_EQUAL( 7, *object.front() );
+}
+
+TEST(slotsAreReused)
+{
+  SpscQueue<std::string> object( 2 );
+  for( int i = 0; i < 10; ++i )
+  {
+    std::string* pSlot = object.claim();
+    pSlot->assign( 1, ( char ) ( 'a' + i ) );
+    object.publish();
+    CHECK_EQUAL( std::string( 1, ( char ) ( 'a' + i ) ), *object.front() );
+    object.pop();
+  }
+  CHECK( object.empty() );
+}
+
+struct Transfer
+{
+  Transfer() : queue( 64 ), count( 100000 ) {}
+  SpscQueue<int> queue;
+  int count;
+};
+
+THREAD_PROC produce( void* p )
+{
+  Transfer* pTransfer = static_cast < Transfer* > ( p );
+  for( int i = 0; i < pTransfer->count; ++i )
+  {
+    int* pSlot;
+    while( !( pSlot = pTransfer->queue.claim() ) ) {}
+    *pSlot = i;
+    pTransfer->queue.publish();
+  }
+  return 0;
+}
+
+TEST(keepsOrderAcrossThreads)
+{
+  Transfer transfer;
+  thread_id thread;
+  CHECK( thread_spawn( &produce, &transfer, thread ) );
+
+  int expected = 0;
+  bool ordered = true;
+  while( expected < transfer.count )
+  {
+    int* pValue = transfer.queue.front();
+    if( !pValue ) continue;
+    ordered = ordered && *pValue == expected;
+    transfer.queue.pop();
+    ++expected;
+  }
+  thread_join( thread );
+
+  CHECK( ordered );
+  CHECK( transfer.queue.empty() );
+}
+
+}
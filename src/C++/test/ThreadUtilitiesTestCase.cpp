@@ -0,0 +1,77 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <Utility.h>
+
+using namespace FIX;
+
+SUITE(ThreadUtilitiesTests)
+{
+
+TEST(parseaffinity)
+{
+  std::set<int> cpus;
+  CHECK( thread_parseaffinity( "3", cpus ) );
+  CHECK_EQUAL( 1U, cpus.size() );
+  CHECK( cpus.count(3) );
+
+  cpus.clear();
+  CHECK( thread_parseaffinity( "0, 2-4,7", cpus ) );
+  CHECK_EQUAL( 5U, cpus.size() );
+  CHECK( cpus.count(0) && cpus.count(2) && cpus.count(3)
+         && cpus.count(4) && cpus.count(7) );
+}
+
+TEST(parseaffinityInvalid)
+{
+  std::set<int> cpus;
+  CHECK( !thread_parseaffinity( "", cpus ) );
+  CHECK( !thread_parseaffinity( "a", cpus ) );
+  CHECK( !thread_parseaffinity( "1,", cpus ) );
+  CHECK( !thread_parseaffinity( "4-2", cpus ) );
+  CHECK( !thread_parseaffinity( "-1", cpus ) );
+  CHECK( !thread_parseaffinity( "0-2000000000", cpus ) );
+  CHECK( !thread_parseaffinity( "99999999999999999999", cpus ) );
+  CHECK( !thread_parseaffinity( "100000", cpus ) );
+}
+
+TEST(setaffinity)
+{
+  std::set<int> cpus;
+  CHECK( thread_setaffinity( cpus ) );
+#ifdef __linux__
+  cpu_set_t original;
+  pthread_getaffinity_np( pthread_self(), sizeof(original), &original );
+  int cpu = 0;
+  while( !CPU_ISSET( cpu, &original ) ) ++cpu;
+  cpus.insert( cpu );
+  CHECK( thread_setaffinity( cpus ) );
+  pthread_setaffinity_np( pthread_self(), sizeof(original), &original );
+#endif
+}
+
+}
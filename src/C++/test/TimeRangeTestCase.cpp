@@ -288,4 +288,62 @@ TEST(isInSameRangeWithDay)
   CHECK( TimeRange::isInSameRange(startTime, endTime, startDay, endDay, time1, time2) );
 }
 
+TEST(getRangeEnd)
+{
+  TimeRange daily( UtcTimeOnly( 3, 0, 0 ), UtcTimeOnly( 18, 0, 0 ) );
+  UtcTimeStamp now( 10, 0, 0, 10, 10, 2000 );
+  CHECK( UtcTimeStamp( 18, 0, 0, 10, 10, 2000 ) == daily.getRangeEnd( now ) );
+
+  TimeRange overnight( UtcTimeOnly( 18, 0, 0 ), UtcTimeOnly( 3, 0, 0 ) );
+  now = UtcTimeStamp( 20, 0, 0, 10, 10, 2000 );
+  CHECK( UtcTimeStamp( 3, 0, 0, 11, 10, 2000 ) == overnight.getRangeEnd( now ) );
+  now = UtcTimeStamp( 1, 0, 0, 11, 10, 2000 );
+  CHECK( UtcTimeStamp( 3, 0, 0, 11, 10, 2000 ) == overnight.getRangeEnd( now ) );
+
+  TimeRange allDay( UtcTimeOnly( 5, 0, 0 ), UtcTimeOnly( 5, 0, 0 ) );
+  now = UtcTimeStamp( 4, 0, 0, 10, 10, 2000 );
+  CHECK( UtcTimeStamp( 0, 0, 0, 11, 10, 2000 ) == allDay.getRangeEnd( now ) );
+
+  // Monday to Thursday, 28th of July 2004 is a Wednesday
+  TimeRange weekly( UtcTimeOnly( 3, 0, 0 ), UtcTimeOnly( 18, 0, 0 ), 2, 5 );
+  now = UtcTimeStamp( 2, 0, 0, 28, 7, 2004 );
+  CHECK( UtcTimeStamp( 18, 0, 0, 29, 7, 2004 ) == weekly.getRangeEnd( now ) );
+
+  // Friday to Tuesday also ends when the week does
+  TimeRange wrapping( UtcTimeOnly( 3, 0, 0 ), UtcTimeOnly( 18, 0, 0 ), 6, 3 );
+  now = UtcTimeStamp( 12, 0, 0, 30, 7, 2004 );
+  CHECK( UtcTimeStamp( 0, 0, 0, 1, 8, 2004 ) == wrapping.getRangeEnd( now ) );
+}
+
+TEST(getRangeEndMatchesIsInSameRange)
+{
+  TimeRange ranges[] =
+  {
+    TimeRange( UtcTimeOnly( 3, 0, 0 ), UtcTimeOnly( 18, 0, 0 ) ),
+    TimeRange( UtcTimeOnly( 18, 0, 0 ), UtcTimeOnly( 3, 0, 0 ) ),
+    TimeRange( UtcTimeOnly( 9, 0, 0 ), UtcTimeOnly( 9, 0, 0 ) ),
+    TimeRange( UtcTimeOnly( 3, 0, 0 ), UtcTimeOnly( 18, 0, 0 ), 2, 5 ),
+    TimeRange( UtcTimeOnly( 18, 0, 0 ), UtcTimeOnly( 3, 0, 0 ), 6, 3 ),
+    TimeRange( UtcTimeOnly( 9, 1, 0 ), UtcTimeOnly( 8, 59, 0 ), 1, 1 )
+  };
+
+  for( size_t i = 0; i < sizeof( ranges ) / sizeof( ranges[ 0 ] ); ++i )
+  {
+    UtcTimeStamp time( 0, 30, 0, 25, 7, 2004 );
+    for( int hour = 0; hour < 24 * 14; ++hour, time += 3600 )
+    {
+      if( !ranges[ i ].isInRange( time ) )
+        continue;
+      UtcTimeStamp end = ranges[ i ].getRangeEnd( time );
+      UtcTimeStamp before = end;
+      before += -1;
+      UtcTimeStamp after = end;
+      after += 1;
+      CHECK( time < end );
+      CHECK( ranges[ i ].isInSameRange( before, time ) );
+      CHECK( !ranges[ i ].isInSameRange( after, time ) );
+    }
+  }
+}
+
 }
@@ -0,0 +1,148 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+
+#include <UnitTest++.h>
+#include <TimerWheel.h>
+#include <algorithm>
+#include <map>
+
+using namespace FIX;
+
+SUITE(TimerWheelTests)
+{
+
+// milliseconds after midnight of an arbitrary day
+DateTime at( int64_t millis )
+{
+  return DateTime( 2457000 + ( int ) ( millis / 86400000 ),
+                   ( millis % 86400000 ) * 1000000 );
+}
+
+TEST(fireAtDeadline)
+{
+  TimerWheel object( 10, at( 0 ) );
+  CHECK( object.empty() );
+  CHECK_EQUAL( 0.0, object.timeout() );
+
+  object.schedule( 1, at( 250 ) );
+  object.schedule( 2, at( 95 ) );
+  CHECK_EQUAL( 2, object.size() );
+  CHECK_CLOSE( 0.1, object.timeout(), 0.0001 );
+
+  TimerWheel::Timers timers;
+  CHECK_EQUAL( 0, object.expire( at( 99 ), timers ) );
+  CHECK_EQUAL( 1, object.expire( at( 100 ), timers ) );
+  CHECK_EQUAL( 2, timers[ 0 ] );
+  CHECK( !object.isScheduled( 2 ) );
+
+  CHECK_EQUAL( 0, object.expire( at( 249 ), timers ) );
+  CHECK_EQUAL( 1, object.expire( at( 1000 ), timers ) );
+  CHECK_EQUAL( 1, timers[ 1 ] );
+  CHECK( object.empty() );
+}
+
+TEST(rescheduleAndCancel)
+{
+  TimerWheel object( 10, at( 0 ) );
+  object.schedule( 1, at( 100 ) );
+  object.schedule( 2, at( 100 ) );
+  object.schedule( 1, at( 5000 ) );
+  object.cancel( 2 );
+  object.cancel( 3 );
+  CHECK_EQUAL( 1, object.size() );
+
+  TimerWheel::Timers timers;
+  CHECK_EQUAL( 0, object.expire( at( 4990 ), timers ) );
+  CHECK_EQUAL( 1, object.expire( at( 5000 ), timers ) );
+  CHECK_EQUAL( 1, timers[ 0 ] );
+}
+
+TEST(slotsKeepOtherTimersLinked)
+{
+  TimerWheel object( 10, at( 0 ) );
+  object.schedule( -1, at( 100 ) );
+  CHECK( object.empty() );
+
+  // three timers share a slot, taking out the middle and the first one
+  object.schedule( 7, at( 100 ) );
+  object.schedule( 3, at( 100 ) );
+  object.schedule( 42, at( 100 ) );
+  object.cancel( 3 );
+  object.schedule( 42, at( 300 ) );
+  CHECK( object.isScheduled( 7 ) );
+  CHECK( !object.isScheduled( 3 ) );
+  CHECK( !object.isScheduled( 100 ) );
+
+  TimerWheel::Timers timers;
+  CHECK_EQUAL( 1, object.expire( at( 100 ), timers ) );
+  CHECK_EQUAL( 7, timers[ 0 ] );
+  object.schedule( 7, at( 300 ) );
+  CHECK_EQUAL( 2, object.expire( at( 300 ), timers ) );
+  CHECK( object.empty() );
+}
+
+TEST(pastDeadlineFiresOnNextTick)
+{
+  TimerWheel object( 10, at( 1000 ) );
+  object.schedule( 1, at( 500 ) );
+
+  TimerWheel::Timers timers;
+  CHECK_EQUAL( 0, object.expire( at( 1000 ), timers ) );
+  CHECK_EQUAL( 1, object.expire( at( 1010 ), timers ) );
+}
+
+TEST(cascadeAcrossLevels)
+{
+  TimerWheel object( 1, at( 0 ) );
+  std::map<int, int64_t> deadlines;
+  int64_t deadline = 7;
+  for( int id = 0; id < 500; ++id )
+  {
+    deadlines[ id ] = deadline;
+    object.schedule( id, at( deadline ) );
+    // spread deadlines over every level and beyond the wheel
+    deadline = ( deadline * 37 + 11 ) % 40000000;
+  }
+
+  TimerWheel::Timers timers;
+  int64_t now = 0;
+  while( !object.empty() )
+  {
+    now += 997;
+    size_t fired = timers.size();
+    object.expire( at( now ), timers );
+    for( ; fired < timers.size(); ++fired )
+    {
+      int64_t due = deadlines[ timers[ fired ] ];
+      CHECK( due <= now );
+      CHECK( due > now - 997 );
+    }
+  }
+  CHECK_EQUAL( 500, (int)timers.size() );
+}
+
+}
@@ -25,6 +25,9 @@
 
 #include "ThreadedSocketAcceptor.h"
 #include "SocketAcceptor.h"
+#if HAVE_IO_URING
+#include "UringAcceptor.h"
+#endif
 #include "SessionSettings.h"
 #include "FileStore.h"
 #include "Utility.h"
@@ -40,18 +43,25 @@ int main( int argc, char** argv )
 {
   std::string file;
   bool threaded = false;
+  bool uring = false;
 
   if ( getopt( argc, argv, "+f:" ) == 'f' )
     file = optarg;
   else
   {
     std::cout << "usage: " << argv[ 0 ]
-    << " -f FILE [-t]" << std::endl;
+    << " -f FILE [-t|-u]" << std::endl;
     return 1;
   }
 
-  if ( getopt( argc, argv, "+t" ) == 't' )
-    threaded = true;
+  int opt;
+  while ( ( opt = getopt( argc, argv, "+tu" ) ) != -1 )
+  {
+    if ( opt == 't' )
+      threaded = true;
+    else if ( opt == 'u' )
+      uring = true;
+  }
 
   try
   {
@@ -60,6 +70,14 @@ int main( int argc, char** argv )
     FIX::FileStoreFactory factory( "store" );
 
     AcceptorPtr pAcceptor;
+#if HAVE_IO_URING
+    if ( uring )
+    {
+      pAcceptor.reset( new FIX::UringAcceptor
+                       ( application, factory, settings ) );
+    }
+    else
+#endif
     if ( threaded )
     {
       pAcceptor.reset( new FIX::ThreadedSocketAcceptor
@@ -27,306 +27,529 @@
 #endif
 
 #include <memory>
+#include <new>
+#include <fstream>
 #include "getopt-repl.h"
 #include <iostream>
 #include "Application.h"
+#include "AtomicCount.h"
 #include "FieldConvertors.h"
 #include "Values.h"
 #include "FileStore.h"
+#include "NullStore.h"
 #include "SessionID.h"
 #include "Session.h"
 #include "DataDictionary.h"
+#include "LatencyHistogram.h"
+#include "MarketDataColumns.h"
 #include "Parser.h"
+#include "Responder.h"
 #include "Utility.h"
 #include "SocketAcceptor.h"
 #include "SocketInitiator.h"
 #include "ThreadedSocketAcceptor.h"
 #include "ThreadedSocketInitiator.h"
+#ifdef HAVE_POSTGRESQL
+#include "PostgreSQLStore.h"
+#endif
+#ifdef HAVE_MYSQL
+#include "MySQLStore.h"
+#endif
+#ifdef HAVE_ODBC
+#include "OdbcStore.h"
+#endif
+#if HAVE_IO_URING
+#include "UringAcceptor.h"
+#include "UringInitiator.h"
+#endif
 #include "fix42/Heartbeat.h"
+#include "fix42/Logon.h"
 #include "fix42/NewOrderSingle.h"
 #include "fix42/QuoteRequest.h"
+#include "fix42/ResendRequest.h"
+#include "fix42/ExecutionReport.h"
+#include "fix44/MarketDataSnapshotFullRefresh.h"
+#include "fix50sp2/ExecutionReport.h"
+
+/*
+ * Every allocation made by the process is counted so that each benchmark
+ * can report allocations per operation.
+ */
+static volatile uint64_t s_allocations = 0;
+
+void* operator new( size_t size ) EXCEPT ( std::bad_alloc )
+{
+#ifdef _MSC_VER
+  InterlockedIncrement64( ( volatile LONGLONG* ) &s_allocations );
+#elif defined(__GNUC__)
+  __sync_fetch_and_add( &s_allocations, 1 );
+#else
+  ++s_allocations;
+#endif
+  void* p = malloc( size ? size : 1 );
+  if( !p ) throw std::bad_alloc();
+  return p;
+}
 
-long testIntegerToString( int );
-long testStringToInteger( int );
-long testDoubleToString( int );
-long testStringToDouble( int );
-long testCreateHeartbeat( int );
-long testIdentifyType( int );
-long testSerializeToStringHeartbeat( int );
-long testSerializeFromStringHeartbeat( int );
-long testSerializeFromStringAndValidateHeartbeat( int );
-long testCreateNewOrderSingle( int );
-long testSerializeToStringNewOrderSingle( int );
-long testSerializeFromStringNewOrderSingle( int );
-long testSerializeFromStringAndValidateNewOrderSingle( int );
-long testCreateQuoteRequest( int );
-long testReadFromQuoteRequest( int );
-long testSerializeToStringQuoteRequest( int );
-long testSerializeFromStringQuoteRequest( int );
-long testSerializeFromStringAndValidateQuoteRequest( int );
-long testFileStoreNewOrderSingle( int );
-long testValidateNewOrderSingle( int );
-long testValidateDictNewOrderSingle( int );
-long testValidateQuoteRequest( int );
-long testValidateDictQuoteRequest( int );
-long testSendOnSocket( int, short );
-long testSendOnThreadedSocket( int, short );
-void report( long, int );
-
-#ifndef _MSC_VER
-#include <sys/time.h>
-long GetTickCount()
-{
-  timeval tv;
-  gettimeofday( &tv, 0 );
-  long millsec = tv.tv_sec * 1000;
-  millsec += ( long ) tv.tv_usec / ( 1000 );
-
-  return ( long ) millsec;
+void operator delete( void* p ) NOEXCEPT
+{
+  free( p );
 }
+
+/**
+ * Runs one benchmark and collects its statistics.
+ *
+ * A benchmark loops on running().  The first tenth of the iterations
+ * warm up caches and allocators and are not measured.  The measured
+ * iterations are timed in 1000 batches and the mean time per operation
+ * of each batch goes into a histogram.  Its percentiles are percentiles
+ * of batch means, they show how the cost drifts over the run without
+ * timing every call, not the spread of single operations.
+ */
+class Benchmark
+{
+public:
+  enum { BATCHES = 1000 };
+
+  Benchmark( const std::string& name, int count )
+  : m_name( name ), m_count( count > 0 ? count : 1 ), m_warmup( m_count / 10 ),
+    m_batch( m_count / BATCHES > 0 ? m_count / BATCHES : 1 ),
+    m_remaining( 0 ), m_measuring( false ), m_done( 0 ), m_size( 0 ),
+    m_start( 0 ), m_batchStart( 0 ), m_end( 0 ),
+    m_allocationsStart( 0 ), m_allocations( 0 ) {}
+
+  bool running()
+  {
+    if( m_remaining-- > 0 ) return true;
+    return step();
+  }
+
+  /// Include the time since the last iteration, e.g. waiting for replies
+  void finish()
+  {
+    m_end = FIX::LatencyHistogram::now();
+    m_allocations = s_allocations - m_allocationsStart;
+  }
+
+  const std::string& getName() const { return m_name; }
+  /// Number of iterations including warmup
+  int getIterations() const { return m_warmup + m_count; }
+  int getCount() const { return m_count; }
+  double getSeconds() const { return ( double ) ( m_end - m_start ) / 1e9; }
+  double getAllocations() const { return ( double ) m_allocations / m_count; }
+  const FIX::LatencyHistogram& getHistogram() const { return m_histogram; }
+
+private:
+  bool step()
+  {
+    int64_t now = FIX::LatencyHistogram::now();
+    if( !m_measuring )
+    {
+      if( m_warmup && !m_done )
+      {
+        m_done = m_warmup;
+        m_remaining = m_warmup - 1;
+        return true;
+      }
+      m_measuring = true;
+      m_done = 0;
+      m_start = m_batchStart = now;
+      m_allocationsStart = s_allocations;
+    }
+    else
+    {
+      m_histogram.record( ( now - m_batchStart ) / m_size );
+      m_done += m_size;
+      m_batchStart = now;
+      if( m_done >= m_count )
+      {
+        m_end = now;
+        m_allocations = s_allocations - m_allocationsStart;
+        return false;
+      }
+    }
+
+    m_size = m_count - m_done < m_batch ? m_count - m_done : m_batch;
+    m_remaining = m_size - 1;
+    return true;
+  }
+
+  std::string m_name;
+  int m_count;
+  int m_warmup;
+  int m_batch;
+  int m_remaining;
+  bool m_measuring;
+  int m_done;
+  int m_size;
+  int64_t m_start;
+  int64_t m_batchStart;
+  int64_t m_end;
+  uint64_t m_allocationsStart;
+  uint64_t m_allocations;
+  FIX::LatencyHistogram m_histogram;
+};
+
+typedef void ( *BenchmarkFunction )( Benchmark& );
+
+void testIntegerToString( Benchmark& );
+void testStringToInteger( Benchmark& );
+void testDoubleToString( Benchmark& );
+void testStringToDouble( Benchmark& );
+void testDecimalToString( Benchmark& );
+void testStringToDecimal( Benchmark& );
+void testCreateHeartbeat( Benchmark& );
+void testIdentifyType( Benchmark& );
+void testSerializeToStringHeartbeat( Benchmark& );
+void testSerializeFromStringHeartbeat( Benchmark& );
+void testSerializeFromStringAndValidateHeartbeat( Benchmark& );
+void testCreateNewOrderSingle( Benchmark& );
+void testSerializeToStringNewOrderSingle( Benchmark& );
+void testSerializeFromStringNewOrderSingle( Benchmark& );
+void testSerializeFromStringAndValidateNewOrderSingle( Benchmark& );
+void testReadFromStringNewOrderSingle( Benchmark& );
+void testReadFlyweightNewOrderSingle( Benchmark& );
+void testCreateAndSerializeNewOrderSingle( Benchmark& );
+void testWriteFlyweightNewOrderSingle( Benchmark& );
+void testCreateQuoteRequest( Benchmark& );
+void testReadFromQuoteRequest( Benchmark& );
+void testSerializeToStringQuoteRequest( Benchmark& );
+void testSerializeFromStringQuoteRequest( Benchmark& );
+void testSerializeFromStringAndValidateQuoteRequest( Benchmark& );
+void testCreateMarketDataSnapshot( Benchmark& );
+void testSerializeToStringMarketDataSnapshot( Benchmark& );
+void testSerializeFromStringAndValidateMarketDataSnapshot( Benchmark& );
+void testReadGroupsMarketDataSnapshot( Benchmark& );
+void testReadColumnsMarketDataSnapshot( Benchmark& );
+void testSerializeFromStringAndValidateExecutionReport50SP2( Benchmark& );
+void testFileStoreNewOrderSingle( Benchmark& );
+#ifdef HAVE_POSTGRESQL
+void testPostgreSQLStoreNewOrderSingle( Benchmark& );
+void testPostgreSQLStoreBatchNewOrderSingle( Benchmark& );
+#endif
+#ifdef HAVE_MYSQL
+void testMySQLStoreNewOrderSingle( Benchmark& );
+void testMySQLStoreBatchNewOrderSingle( Benchmark& );
+#endif
+#ifdef HAVE_ODBC
+void testOdbcStoreNewOrderSingle( Benchmark& );
+void testOdbcStoreBatchNewOrderSingle( Benchmark& );
+#endif
+void testValidateNewOrderSingle( Benchmark& );
+void testValidateDictNewOrderSingle( Benchmark& );
+void testValidateQuoteRequest( Benchmark& );
+void testValidateDictQuoteRequest( Benchmark& );
+void testResendRequest( Benchmark& );
+void testFanOutSendToTarget( Benchmark& );
+void testFanOutSendToTargets( Benchmark& );
+void testFanOutSendToTargetsNotPersisted( Benchmark& );
+void testSendOnSocket( Benchmark& );
+void testSendOnThreadedSocket( Benchmark& );
+void testSendOnThreadedSocketSpinning( Benchmark& );
+void testSendOnThreadedSocketSessions( Benchmark& );
+#if HAVE_IO_URING
+void testSendOnUring( Benchmark& );
 #endif
 
 SmartPtr<FIX::DataDictionary> s_dataDictionary;
+SmartPtr<FIX::DataDictionary> s_dataDictionary44;
+SmartPtr<FIX::DataDictionary> s_transportDictionary;
+SmartPtr<FIX::DataDictionary> s_dataDictionary50SP2;
 const bool VALIDATE = true;
 const bool DONT_VALIDATE = false;
+short s_port = 0;
+std::string s_filter;
+std::vector<std::string> s_results;
+
+void run( const std::string& name, BenchmarkFunction function, int count )
+{
+  if( s_filter.size() && name.find( s_filter ) == std::string::npos )
+    return;
+
+  std::cout << name << ": " << std::flush;
+  Benchmark benchmark( name, count );
+  try
+  {
+    function( benchmark );
+  }
+  catch( std::exception& e )
+  {
+    std::cout << std::endl << "    failed: " << e.what() << std::endl;
+    return;
+  }
+
+  const FIX::LatencyHistogram& histogram = benchmark.getHistogram();
+  double seconds = benchmark.getSeconds();
+  double perSecond = seconds > 0 ? benchmark.getCount() / seconds : 0;
+  double nanosPerOp = seconds * 1e9 / benchmark.getCount();
+
+  std::cout << std::endl << "    num: " << benchmark.getCount()
+  << ", seconds: " << seconds
+  << ", num_per_second: " << perSecond << std::endl
+  << "    ns/op mean: " << nanosPerOp
+  << ", allocations/op: " << benchmark.getAllocations() << std::endl
+  << "    batch-mean ns/op percentiles p50: " << histogram.getValueAtPercentile( 50 )
+  << ", p90: " << histogram.getValueAtPercentile( 90 )
+  << ", p99: " << histogram.getValueAtPercentile( 99 )
+  << ", max: " << histogram.getMax() << std::endl;
+
+  std::stringstream result;
+  result << "{\"name\":\"" << name << "\""
+  << ",\"num\":" << benchmark.getCount()
+  << ",\"seconds\":" << seconds
+  << ",\"num_per_second\":" << perSecond
+  << ",\"ns_per_op\":" << nanosPerOp
+  << ",\"batch_mean_ns_per_op\":{\"p50\":" << histogram.getValueAtPercentile( 50 )
+  << ",\"p90\":" << histogram.getValueAtPercentile( 90 )
+  << ",\"p99\":" << histogram.getValueAtPercentile( 99 )
+  << ",\"max\":" << histogram.getMax() << "}"
+  << ",\"allocations_per_op\":" << benchmark.getAllocations() << "}";
+  s_results.push_back( result.str() );
+}
 
 int main( int argc, char** argv )
 {
   int count = 0;
-  short port = 0;
+  std::string json;
 
   int opt;
-  while ( (opt = getopt( argc, argv, "+p:+c:" )) != -1 )
+  while ( (opt = getopt( argc, argv, "+p:+c:+j:+f:" )) != -1 )
   {
     switch( opt )
     {
     case 'p':
-      port = (short)atol( optarg );
+      s_port = (short)atol( optarg );
       break;
     case 'c':
       count = atoi( optarg );
       break;
+    case 'j':
+      json = optarg;
+      break;
+    case 'f':
+      s_filter = optarg;
+      break;
     default:
       std::cout << "usage: "
       << argv[ 0 ]
-      << " -p port -c count" << std::endl;
+      << " -p port -c count [-j json_file] [-f name_filter]" << std::endl;
       return 1;
     }
   }
 
   s_dataDictionary.reset( new FIX::DataDictionary( "../spec/FIX42.xml" ) );
+  s_dataDictionary44.reset( new FIX::DataDictionary( "../spec/FIX44.xml" ) );
+  s_transportDictionary.reset( new FIX::DataDictionary( "../spec/FIXT11.xml" ) );
+  s_dataDictionary50SP2.reset( new FIX::DataDictionary( "../spec/FIX50SP2.xml" ) );
+
+  run( "Converting integers to strings", testIntegerToString, count );
+  run( "Converting strings to integers", testStringToInteger, count );
+  run( "Converting doubles to strings", testDoubleToString, count );
+  run( "Converting strings to doubles", testStringToDouble, count );
+  run( "Converting decimals to strings", testDecimalToString, count );
+  run( "Converting strings to decimals", testStringToDecimal, count );
+  run( "Creating Heartbeat messages", testCreateHeartbeat, count );
+  run( "Identifying message types", testIdentifyType, count );
+  run( "Serializing Heartbeat messages to strings", testSerializeToStringHeartbeat, count );
+  run( "Serializing Heartbeat messages from strings", testSerializeFromStringHeartbeat, count );
+  run( "Serializing Heartbeat messages from strings and validation",
+       testSerializeFromStringAndValidateHeartbeat, count );
+  run( "Creating NewOrderSingle messages", testCreateNewOrderSingle, count );
+  run( "Serializing NewOrderSingle messages to strings", testSerializeToStringNewOrderSingle, count );
+  run( "Serializing NewOrderSingle messages from strings", testSerializeFromStringNewOrderSingle, count );
+  run( "Serializing NewOrderSingle messages from strings and validation",
+       testSerializeFromStringAndValidateNewOrderSingle, count );
+  run( "Reading NewOrderSingle fields from strings", testReadFromStringNewOrderSingle, count );
+  run( "Reading NewOrderSingle fields with a flyweight", testReadFlyweightNewOrderSingle, count );
+  run( "Creating and serializing NewOrderSingle messages", testCreateAndSerializeNewOrderSingle, count );
+  run( "Writing NewOrderSingle messages with a flyweight", testWriteFlyweightNewOrderSingle, count );
+  run( "Creating QuoteRequest messages", testCreateQuoteRequest, count );
+  run( "Serializing QuoteRequest messages to strings", testSerializeToStringQuoteRequest, count );
+  run( "Serializing QuoteRequest messages from strings", testSerializeFromStringQuoteRequest, count );
+  run( "Serializing QuoteRequest messages from strings and validation",
+       testSerializeFromStringAndValidateQuoteRequest, count );
+  run( "Reading fields from QuoteRequest message", testReadFromQuoteRequest, count );
+  run( "Creating 100 entry MarketDataSnapshotFullRefresh messages",
+       testCreateMarketDataSnapshot, count / 10 );
+  run( "Serializing 100 entry MarketDataSnapshotFullRefresh messages to strings",
+       testSerializeToStringMarketDataSnapshot, count / 10 );
+  run( "Serializing 100 entry MarketDataSnapshotFullRefresh messages from strings and validation",
+       testSerializeFromStringAndValidateMarketDataSnapshot, count / 10 );
+  run( "Reading entries from 100 entry MarketDataSnapshotFullRefresh messages as groups",
+       testReadGroupsMarketDataSnapshot, count / 10 );
+  run( "Reading entries from 100 entry MarketDataSnapshotFullRefresh messages as columns",
+       testReadColumnsMarketDataSnapshot, count / 10 );
+  run( "Serializing FIX50SP2 ExecutionReport messages from strings and validation",
+       testSerializeFromStringAndValidateExecutionReport50SP2, count );
+  run( "Storing NewOrderSingle messages", testFileStoreNewOrderSingle, count );
+#ifdef HAVE_POSTGRESQL
+  run( "Storing NewOrderSingle messages in PostgreSQL",
+       testPostgreSQLStoreNewOrderSingle, count / 100 );
+  run( "Storing NewOrderSingle messages in PostgreSQL batches of 100",
+       testPostgreSQLStoreBatchNewOrderSingle, count / 10 );
+#endif
+#ifdef HAVE_MYSQL
+  run( "Storing NewOrderSingle messages in MySQL",
+       testMySQLStoreNewOrderSingle, count / 100 );
+  run( "Storing NewOrderSingle messages in MySQL batches of 100",
+       testMySQLStoreBatchNewOrderSingle, count / 10 );
+#endif
+#ifdef HAVE_ODBC
+  run( "Storing NewOrderSingle messages in ODBC",
+       testOdbcStoreNewOrderSingle, count / 100 );
+  run( "Storing NewOrderSingle messages in ODBC batches of 100",
+       testOdbcStoreBatchNewOrderSingle, count / 10 );
+#endif
+  run( "Validating NewOrderSingle messages with no data dictionary", testValidateNewOrderSingle, count );
+  run( "Validating NewOrderSingle messages with data dictionary", testValidateDictNewOrderSingle, count );
+  run( "Validating QuoteRequest messages with no data dictionary", testValidateQuoteRequest, count );
+  run( "Validating QuoteRequest messages with data dictionary", testValidateDictQuoteRequest, count );
+  run( "Resending 100 NewOrderSingle messages", testResendRequest, count / 100 );
+  run( "Fanning out ExecutionReport messages to 40 sessions with sendToTarget",
+       testFanOutSendToTarget, count / 40 );
+  run( "Fanning out ExecutionReport messages to 40 sessions with sendToTargets",
+       testFanOutSendToTargets, count / 40 );
+  run( "Fanning out ExecutionReport messages to 40 unpersisted sessions with sendToTargets",
+       testFanOutSendToTargetsNotPersisted, count / 40 );
+  run( "Sending/Receiving NewOrderSingle/ExecutionReports on Socket", testSendOnSocket, count );
+  run( "Sending/Receiving NewOrderSingle/ExecutionReports on ThreadedSocket",
+       testSendOnThreadedSocket, count );
+  run( "Sending/Receiving NewOrderSingle/ExecutionReports on ThreadedSocket spinning",
+       testSendOnThreadedSocketSpinning, count );
+  run( "Sending/Receiving NewOrderSingle/ExecutionReports on 8 ThreadedSocket sessions",
+       testSendOnThreadedSocketSessions, count );
+#if HAVE_IO_URING
+  run( "Sending/Receiving NewOrderSingle/ExecutionReports on Uring", testSendOnUring, count );
+#endif
 
-  std::cout << "Converting integers to strings: ";
-  report( testIntegerToString( count ), count );
-
-  std::cout << "Converting strings to integers: ";
-  report( testStringToInteger( count ), count );
-
-  std::cout << "Converting doubles to strings: ";
-  report( testDoubleToString( count ), count );
-
-  std::cout << "Converting strings to doubles: ";
-  report( testStringToDouble( count ), count );
-
-  std::cout << "Creating Heartbeat messages: ";
-  report( testCreateHeartbeat( count ), count );
-
-  std::cout << "Identifying message types: ";
-  report( testIdentifyType( count ), count );
-
-  std::cout << "Serializing Heartbeat messages to strings: ";
-  report( testSerializeToStringHeartbeat( count ), count );
-
-  std::cout << "Serializing Heartbeat messages from strings: ";
-  report( testSerializeFromStringHeartbeat( count ), count );
-
-  std::cout << "Serializing Heartbeat messages from strings and validation: ";
-  report( testSerializeFromStringAndValidateHeartbeat( count ), count );
-
-  std::cout << "Creating NewOrderSingle messages: ";
-  report( testCreateNewOrderSingle( count ), count );
-
-  std::cout << "Serializing NewOrderSingle messages to strings: ";
-  report( testSerializeToStringNewOrderSingle( count ), count );
-
-  std::cout << "Serializing NewOrderSingle messages from strings: ";
-  report( testSerializeFromStringNewOrderSingle( count ), count );
-
-  std::cout << "Serializing NewOrderSingle messages from strings and validation: ";
-  report( testSerializeFromStringAndValidateNewOrderSingle( count ), count );
-
-  std::cout << "Creating QuoteRequest messages: ";
-  report( testCreateQuoteRequest( count ), count );
-
-  std::cout << "Serializing QuoteRequest messages to strings: ";
-  report( testSerializeToStringQuoteRequest( count ), count );
-
-  std::cout << "Serializing QuoteRequest messages from strings: ";
-  report( testSerializeFromStringQuoteRequest( count ), count );
-
-  std::cout << "Serializing QuoteRequest messages from strings and validation: ";
-  report( testSerializeFromStringAndValidateQuoteRequest( count ), count );
-
-  std::cout << "Reading fields from QuoteRequest message: ";
-  report( testReadFromQuoteRequest( count ), count );
-
-  std::cout << "Storing NewOrderSingle messages: ";
-  report( testFileStoreNewOrderSingle( count ), count );
-
-  std::cout << "Validating NewOrderSingle messages with no data dictionary: ";
-  report( testValidateNewOrderSingle( count ), count );
-
-  std::cout << "Validating NewOrderSingle messages with data dictionary: ";
-  report( testValidateDictNewOrderSingle( count ), count );
-
-  std::cout << "Validating QuoteRequest messages with no data dictionary: ";
-  report( testValidateQuoteRequest( count ), count );
-
-  std::cout << "Validating QuoteRequest messages with data dictionary: ";
-  report( testValidateDictQuoteRequest( count ), count );
-
-  std::cout << "Sending/Receiving NewOrderSingle/ExecutionReports on Socket";
-  report( testSendOnSocket( count, port ), count );
-
-  std::cout << "Sending/Receiving NewOrderSingle/ExecutionReports on ThreadedSocket";
-  report( testSendOnThreadedSocket( count, port ), count );
+  if( json.size() )
+  {
+    std::ofstream stream( json.c_str() );
+    stream << "{\"count\":" << count << ",\"benchmarks\":[";
+    for( size_t i = 0; i < s_results.size(); ++i )
+      stream << ( i ? "," : "" ) << std::endl << s_results[ i ];
+    stream << std::endl << "]}" << std::endl;
+    if( !stream )
+    {
+      std::cout << "could not write " << json << std::endl;
+      return 1;
+    }
+  }
 
   return 0;
 }
 
-void report( long time, int count )
+void testIntegerToString( Benchmark& b )
 {
-  double seconds = ( double ) time / 1000;
-  double num_per_second = count / seconds;
-  std::cout << std::endl << "    num: " << count
-  << ", seconds: " << seconds
-  << ", num_per_second: " << num_per_second << std::endl;
-}
-
-long testIntegerToString( int count )
-{
-  count = count - 1;
-
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     FIX::IntConvertor::convert( 1234 );
   }
-  return GetTickCount() - start;
 }
 
-long testStringToInteger( int count )
+void testStringToInteger( Benchmark& b )
 {
   std::string value( "1234" );
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     FIX::IntConvertor::convert( value );
   }
-  return GetTickCount() - start;
 }
 
-long testDoubleToString( int count )
+void testDoubleToString( Benchmark& b )
 {
-  count = count - 1;
-
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     FIX::DoubleConvertor::convert( 123.45 );
   }
-  return GetTickCount() - start;
 }
 
-long testStringToDouble( int count )
+void testStringToDouble( Benchmark& b )
 {
   std::string value( "123.45" );
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     FIX::DoubleConvertor::convert( value );
   }
-  return GetTickCount() - start;
 }
 
-long testCreateHeartbeat( int count )
+void testDecimalToString( Benchmark& b )
 {
-  count = count - 1;
+  FIX::Decimal value( 12345, -2 );
 
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
-    FIX42::Heartbeat();
+    FIX::DecimalConvertor::convert( value );
   }
+}
 
-  return GetTickCount() - start;
+void testStringToDecimal( Benchmark& b )
+{
+  std::string value( "123.45" );
+
+  while( b.running() )
+  {
+    FIX::DecimalConvertor::convert( value );
+  }
+}
+
+void testCreateHeartbeat( Benchmark& b )
+{
+  while( b.running() )
+  {
+    FIX42::Heartbeat();
+  }
 }
 
-long testIdentifyType( int count )
+void testIdentifyType( Benchmark& b )
 {
   FIX42::Heartbeat message;
   std::string messageString = message.toString();
 
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     FIX::identifyType( messageString );
   }
-
-  return GetTickCount() - start;
 }
 
-long testSerializeToStringHeartbeat( int count )
+void testSerializeToStringHeartbeat( Benchmark& b )
 {
   FIX42::Heartbeat message;
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     message.toString();
   }
-  return GetTickCount() - start;
 }
 
-long testSerializeFromStringHeartbeat( int count )
+void testSerializeFromStringHeartbeat( Benchmark& b )
 {
   FIX42::Heartbeat message;
   std::string string = message.toString();
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     message.setString( string, DONT_VALIDATE, s_dataDictionary.get() );
   }
-  return GetTickCount() - start;
 }
 
-long testSerializeFromStringAndValidateHeartbeat( int count )
+void testSerializeFromStringAndValidateHeartbeat( Benchmark& b )
 {
   FIX42::Heartbeat message;
   std::string string = message.toString();
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     message.setString( string, VALIDATE, s_dataDictionary.get() );
   }
-  return GetTickCount() - start;
 }
 
-long testCreateNewOrderSingle( int count )
+void testCreateNewOrderSingle( Benchmark& b )
 {
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     FIX::ClOrdID clOrdID( "ORDERID" );
     FIX::HandlInst handlInst( '1' );
@@ -336,11 +559,9 @@ long testCreateNewOrderSingle( int count )
     FIX::OrdType ordType( FIX::OrdType_MARKET );
     FIX42::NewOrderSingle( clOrdID, handlInst, symbol, side, transactTime, ordType );
   }
-
-  return GetTickCount() - start;
 }
 
-long testSerializeToStringNewOrderSingle( int count )
+void testSerializeToStringNewOrderSingle( Benchmark& b )
 {
   FIX::ClOrdID clOrdID( "ORDERID" );
   FIX::HandlInst handlInst( '1' );
@@ -351,17 +572,14 @@ long testSerializeToStringNewOrderSingle( int count )
   FIX42::NewOrderSingle message
   ( clOrdID, handlInst, symbol, side, transactTime, ordType );
 
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     message.toString();
   }
-  return GetTickCount() - start;
 }
 
-long testSerializeFromStringNewOrderSingle( int count )
+void testSerializeFromStringNewOrderSingle( Benchmark& b )
 {
   FIX::ClOrdID clOrdID( "ORDERID" );
   FIX::HandlInst handlInst( '1' );
@@ -373,17 +591,14 @@ long testSerializeFromStringNewOrderSingle( int count )
   ( clOrdID, handlInst, symbol, side, transactTime, ordType );
   std::string string = message.toString();
 
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     message.setString( string, DONT_VALIDATE, s_dataDictionary.get() );
   }
-  return GetTickCount() - start;
 }
 
-long testSerializeFromStringAndValidateNewOrderSingle( int count )
+void testSerializeFromStringAndValidateNewOrderSingle( Benchmark& b )
 {
   FIX::ClOrdID clOrdID( "ORDERID" );
   FIX::HandlInst handlInst( '1' );
@@ -395,21 +610,118 @@ long testSerializeFromStringAndValidateNewOrderSingle( int count )
     ( clOrdID, handlInst, symbol, side, transactTime, ordType );
   std::string string = message.toString();
 
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     message.setString( string, VALIDATE, s_dataDictionary.get() );
   }
-  return GetTickCount() - start;
 }
 
-long testCreateQuoteRequest( int count )
+FIX42::NewOrderSingle limitOrder()
 {
-  count = count - 1;
+  FIX42::NewOrderSingle message
+    ( FIX::ClOrdID( "ORDERID" ), FIX::HandlInst( '1' ), FIX::Symbol( "LNUX" ),
+      FIX::Side( FIX::Side_BUY ), FIX::TransactTime(), FIX::OrdType( FIX::OrdType_LIMIT ) );
+  message.getHeader().setField( FIX::SenderCompID( "TW" ) );
+  message.getHeader().setField( FIX::TargetCompID( "ISLD" ) );
+  message.getHeader().setField( FIX::MsgSeqNum( 1 ) );
+  message.getHeader().setField( FIX::SendingTime() );
+  message.set( FIX::OrderQty( 100 ) );
+  message.set( FIX::Price( 12.25 ) );
+  return message;
+}
 
-  long start = GetTickCount();
+void testReadFromStringNewOrderSingle( Benchmark& b )
+{
+  std::string string = limitOrder().toString();
+  FIX42::NewOrderSingle message;
+  FIX::ClOrdID clOrdID;
+  FIX::Symbol symbol;
+  FIX::Side side;
+  FIX::OrderQty orderQty;
+  FIX::Price price;
+  double total = 0;
+
+  while( b.running() )
+  {
+    message.setString( string, DONT_VALIDATE, s_dataDictionary.get() );
+    message.get( clOrdID );
+    message.get( symbol );
+    message.get( side );
+    message.get( orderQty );
+    message.get( price );
+    total += orderQty * price + side + clOrdID.getValue().size() + symbol.getValue().size();
+  }
+  if( total < 0 ) std::cout << total;
+}
+
+void testReadFlyweightNewOrderSingle( Benchmark& b )
+{
+  std::string string = limitOrder().toString();
+  FIX42::NewOrderSingle::Reader reader;
+  double total = 0;
+
+  while( b.running() )
+  {
+    reader.parse( string );
+    FIX::StringView clOrdID = reader.clOrdID();
+    FIX::StringView symbol = reader.symbol();
+    char side = reader.side();
+    FIX::Decimal orderQty = reader.orderQty();
+    FIX::Decimal price = reader.price();
+    total += orderQty.toDouble() * price.toDouble() + side + clOrdID.size() + symbol.size();
+  }
+  if( total < 0 ) std::cout << total;
+}
+
+void testCreateAndSerializeNewOrderSingle( Benchmark& b )
+{
+  FIX::UtcTimeStamp now;
+  std::string string;
+
+  while( b.running() )
+  {
+    FIX42::NewOrderSingle message
+      ( FIX::ClOrdID( "ORDERID" ), FIX::HandlInst( '1' ), FIX::Symbol( "LNUX" ),
+        FIX::Side( FIX::Side_BUY ), FIX::TransactTime( now ), FIX::OrdType( FIX::OrdType_LIMIT ) );
+    message.getHeader().setField( FIX::SenderCompID( "TW" ) );
+    message.getHeader().setField( FIX::TargetCompID( "ISLD" ) );
+    message.getHeader().setField( FIX::MsgSeqNum( 1 ) );
+    message.getHeader().setField( FIX::SendingTime( now ) );
+    message.set( FIX::OrderQty( 100 ) );
+    message.set( FIX::Price( 12.25 ) );
+    message.toString( string );
+  }
+}
+
+void testWriteFlyweightNewOrderSingle( Benchmark& b )
+{
+  FIX::UtcTimeStamp now;
+  FIX42::NewOrderSingle::Writer writer;
+  size_t total = 0;
+
+  while( b.running() )
+  {
+    writer.reset();
+    writer.setMsgSeqNum( 1 );
+    writer.setSenderCompID( "TW" );
+    writer.setSendingTime( now );
+    writer.setTargetCompID( "ISLD" );
+    writer.setClOrdID( "ORDERID" );
+    writer.setHandlInst( '1' );
+    writer.setOrderQty( FIX::Decimal( 100 ) );
+    writer.setOrdType( FIX::OrdType_LIMIT );
+    writer.setPrice( FIX::Decimal( 1225, -2 ) );
+    writer.setSide( FIX::Side_BUY );
+    writer.setSymbol( "LNUX" );
+    writer.setTransactTime( now );
+    total += writer.finish().size();
+  }
+  if( total == 0 ) std::cout << total;
+}
+
+void testCreateQuoteRequest( Benchmark& b )
+{
   FIX::Symbol symbol;
   FIX::MaturityMonthYear maturityMonthYear;
   FIX::PutOrCall putOrCall;
@@ -419,7 +731,7 @@ long testCreateQuoteRequest( int count )
   FIX::Currency currency;
   FIX::OrdType ordType;
 
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     FIX42::QuoteRequest massQuote( FIX::QuoteReqID("1") );
     FIX42::QuoteRequest::NoRelatedSym noRelatedSym;
@@ -446,11 +758,9 @@ long testCreateQuoteRequest( int count )
       noRelatedSym.clear();
     }
   }
-
-  return GetTickCount() - start;
 }
 
-long testSerializeToStringQuoteRequest( int count )
+void testSerializeToStringQuoteRequest( Benchmark& b )
 {
   FIX42::QuoteRequest message( FIX::QuoteReqID("1") );
   FIX42::QuoteRequest::NoRelatedSym noRelatedSym;
@@ -468,17 +778,14 @@ long testSerializeToStringQuoteRequest( int count )
     message.addGroup( noRelatedSym );
   }
 
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int j = 0; j <= count; ++j )
+  while( b.running() )
   {
     message.toString();
   }
-  return GetTickCount() - start;
 }
 
-long testSerializeFromStringQuoteRequest( int count )
+void testSerializeFromStringQuoteRequest( Benchmark& b )
 {
   FIX42::QuoteRequest message( FIX::QuoteReqID("1") );
   FIX42::QuoteRequest::NoRelatedSym noRelatedSym;
@@ -497,17 +804,14 @@ long testSerializeFromStringQuoteRequest( int count )
   }
   std::string string = message.toString();
 
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int j = 0; j <= count; ++j )
+  while( b.running() )
   {
     message.setString( string, DONT_VALIDATE, s_dataDictionary.get() );
   }
-  return GetTickCount() - start;
 }
 
-long testSerializeFromStringAndValidateQuoteRequest( int count )
+void testSerializeFromStringAndValidateQuoteRequest( Benchmark& b )
 {
   FIX42::QuoteRequest message( FIX::QuoteReqID("1") );
   FIX42::QuoteRequest::NoRelatedSym noRelatedSym;
@@ -526,20 +830,15 @@ long testSerializeFromStringAndValidateQuoteRequest( int count )
   }
   std::string string = message.toString();
 
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int j = 0; j <= count; ++j )
+  while( b.running() )
   {
     message.setString( string, VALIDATE, s_dataDictionary.get() );
   }
-  return GetTickCount() - start;
 }
 
-long testReadFromQuoteRequest( int count )
+void testReadFromQuoteRequest( Benchmark& b )
 {
-  count = count - 1;
-
   FIX42::QuoteRequest message( FIX::QuoteReqID("1") );
   FIX42::QuoteRequest::NoRelatedSym group;
 
@@ -557,8 +856,7 @@ long testReadFromQuoteRequest( int count )
   }
   group.clear();
 
-  long start = GetTickCount();
-  for ( int j = 0; j <= count; ++j )
+  while( b.running() )
   {
     FIX::QuoteReqID quoteReqID;
     FIX::Symbol symbol;
@@ -593,11 +891,120 @@ long testReadFromQuoteRequest( int count )
       ordType.getValue();
     }
   }
+}
 
-  return GetTickCount() - start;
+std::string newOrderSingleToStore()
+{
+  FIX::ClOrdID clOrdID( "ORDERID" );
+  FIX::HandlInst handlInst( '1' );
+  FIX::Symbol symbol( "LNUX" );
+  FIX::Side side( FIX::Side_BUY );
+  FIX::TransactTime transactTime;
+  FIX::OrdType ordType( FIX::OrdType_MARKET );
+  FIX42::NewOrderSingle message
+  ( clOrdID, handlInst, symbol, side, transactTime, ordType );
+  message.getHeader().setField( FIX::MsgSeqNum( 1 ) );
+  return message.toString();
 }
 
-long testFileStoreNewOrderSingle( int count )
+/// Persists messages the way Session::persist does
+void storeNewOrderSingle( Benchmark& b, FIX::MessageStore& store )
+{
+  std::string messageString = newOrderSingleToStore();
+  store.reset();
+
+  while( b.running() )
+  {
+    store.set( store.getNextSenderMsgSeqNum(), messageString );
+    store.incrNextSenderMsgSeqNum();
+  }
+  store.reset();
+}
+
+#ifdef HAVE_POSTGRESQL
+void testPostgreSQLStoreNewOrderSingle( Benchmark& b )
+{
+  FIX::SessionID id( FIX::BeginString( FIX::BeginString_FIX42 ),
+                     FIX::SenderCompID( "SENDER" ), FIX::TargetCompID( "TARGET" ) );
+  FIX::PostgreSQLStore store
+    ( id, FIX::PostgreSQLStoreFactory::DEFAULT_DATABASE,
+      FIX::PostgreSQLStoreFactory::DEFAULT_USER,
+      FIX::PostgreSQLStoreFactory::DEFAULT_PASSWORD,
+      FIX::PostgreSQLStoreFactory::DEFAULT_HOST,
+      FIX::PostgreSQLStoreFactory::DEFAULT_PORT );
+  storeNewOrderSingle( b, store );
+}
+
+void testPostgreSQLStoreBatchNewOrderSingle( Benchmark& b )
+{
+  FIX::SessionID id( FIX::BeginString( FIX::BeginString_FIX42 ),
+                     FIX::SenderCompID( "SENDER" ), FIX::TargetCompID( "TARGET" ) );
+  FIX::PostgreSQLStore store
+    ( id, FIX::PostgreSQLStoreFactory::DEFAULT_DATABASE,
+      FIX::PostgreSQLStoreFactory::DEFAULT_USER,
+      FIX::PostgreSQLStoreFactory::DEFAULT_PASSWORD,
+      FIX::PostgreSQLStoreFactory::DEFAULT_HOST,
+      FIX::PostgreSQLStoreFactory::DEFAULT_PORT );
+  store.setBatch( 100, 10 );
+  storeNewOrderSingle( b, store );
+}
+#endif
+
+#ifdef HAVE_MYSQL
+void testMySQLStoreNewOrderSingle( Benchmark& b )
+{
+  FIX::SessionID id( FIX::BeginString( FIX::BeginString_FIX42 ),
+                     FIX::SenderCompID( "SENDER" ), FIX::TargetCompID( "TARGET" ) );
+  FIX::MySQLStore store
+    ( id, FIX::MySQLStoreFactory::DEFAULT_DATABASE,
+      FIX::MySQLStoreFactory::DEFAULT_USER,
+      FIX::MySQLStoreFactory::DEFAULT_PASSWORD,
+      FIX::MySQLStoreFactory::DEFAULT_HOST,
+      FIX::MySQLStoreFactory::DEFAULT_PORT );
+  storeNewOrderSingle( b, store );
+}
+
+void testMySQLStoreBatchNewOrderSingle( Benchmark& b )
+{
+  FIX::SessionID id( FIX::BeginString( FIX::BeginString_FIX42 ),
+                     FIX::SenderCompID( "SENDER" ), FIX::TargetCompID( "TARGET" ) );
+  FIX::MySQLStore store
+    ( id, FIX::MySQLStoreFactory::DEFAULT_DATABASE,
+      FIX::MySQLStoreFactory::DEFAULT_USER,
+      FIX::MySQLStoreFactory::DEFAULT_PASSWORD,
+      FIX::MySQLStoreFactory::DEFAULT_HOST,
+      FIX::MySQLStoreFactory::DEFAULT_PORT );
+  store.setBatch( 100, 10 );
+  storeNewOrderSingle( b, store );
+}
+#endif
+
+#ifdef HAVE_ODBC
+void testOdbcStoreNewOrderSingle( Benchmark& b )
+{
+  FIX::SessionID id( FIX::BeginString( FIX::BeginString_FIX42 ),
+                     FIX::SenderCompID( "SENDER" ), FIX::TargetCompID( "TARGET" ) );
+  FIX::OdbcStore store
+    ( id, FIX::OdbcStoreFactory::DEFAULT_USER,
+      FIX::OdbcStoreFactory::DEFAULT_PASSWORD,
+      FIX::OdbcStoreFactory::DEFAULT_CONNECTION_STRING );
+  storeNewOrderSingle( b, store );
+}
+
+void testOdbcStoreBatchNewOrderSingle( Benchmark& b )
+{
+  FIX::SessionID id( FIX::BeginString( FIX::BeginString_FIX42 ),
+                     FIX::SenderCompID( "SENDER" ), FIX::TargetCompID( "TARGET" ) );
+  FIX::OdbcStore store
+    ( id, FIX::OdbcStoreFactory::DEFAULT_USER,
+      FIX::OdbcStoreFactory::DEFAULT_PASSWORD,
+      FIX::OdbcStoreFactory::DEFAULT_CONNECTION_STRING );
+  store.setBatch( 100, 10 );
+  storeNewOrderSingle( b, store );
+}
+#endif
+
+void testFileStoreNewOrderSingle( Benchmark& b )
 {
   FIX::BeginString beginString( FIX::BeginString_FIX42 );
   FIX::SenderCompID senderCompID( "SENDER" );
@@ -612,24 +1019,21 @@ long testFileStoreNewOrderSingle( int count )
   FIX::OrdType ordType( FIX::OrdType_MARKET );
   FIX42::NewOrderSingle message
   ( clOrdID, handlInst, symbol, side, transactTime, ordType );
-  message.getHeader().set( FIX::MsgSeqNum( 1 ) );
+  message.getHeader().setField( FIX::MsgSeqNum( 1 ) );
   std::string messageString = message.toString();
 
   FIX::FileStore store( "store", id );
   store.reset();
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  int num = 0;
+  while( b.running() )
   {
-    store.set( ++i, messageString );
+    store.set( ++num, messageString );
   }
-  long end = GetTickCount();
   store.reset();
-  return end - start;
 }
 
-long testValidateNewOrderSingle( int count )
+void testValidateNewOrderSingle( Benchmark& b )
 {
   FIX::ClOrdID clOrdID( "ORDERID" );
   FIX::HandlInst handlInst( '1' );
@@ -639,22 +1043,19 @@ long testValidateNewOrderSingle( int count )
   FIX::OrdType ordType( FIX::OrdType_MARKET );
   FIX42::NewOrderSingle message
   ( clOrdID, handlInst, symbol, side, transactTime, ordType );
-  message.getHeader().set( FIX::SenderCompID( "SENDER" ) );
-  message.getHeader().set( FIX::TargetCompID( "TARGET" ) );
-  message.getHeader().set( FIX::MsgSeqNum( 1 ) );
+  message.getHeader().setField( FIX::SenderCompID( "SENDER" ) );
+  message.getHeader().setField( FIX::TargetCompID( "TARGET" ) );
+  message.getHeader().setField( FIX::MsgSeqNum( 1 ) );
 
   FIX::DataDictionary dataDictionary;
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     dataDictionary.validate( message );
   }
-  return GetTickCount() - start;
 }
 
-long testValidateDictNewOrderSingle( int count )
+void testValidateDictNewOrderSingle( Benchmark& b )
 {
   FIX::ClOrdID clOrdID( "ORDERID" );
   FIX::HandlInst handlInst( '1' );
@@ -664,21 +1065,18 @@ long testValidateDictNewOrderSingle( int count )
   FIX::OrdType ordType( FIX::OrdType_MARKET );
   FIX42::NewOrderSingle message
   ( clOrdID, handlInst, symbol, side, transactTime, ordType );
-  message.getHeader().set( FIX::SenderCompID( "SENDER" ) );
-  message.getHeader().set( FIX::TargetCompID( "TARGET" ) );
-  message.getHeader().set( FIX::MsgSeqNum( 1 ) );
+  message.getHeader().setField( FIX::SenderCompID( "SENDER" ) );
+  message.getHeader().setField( FIX::TargetCompID( "TARGET" ) );
+  message.getHeader().setField( FIX::MsgSeqNum( 1 ) );
 
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
+  while( b.running() )
   {
     s_dataDictionary->validate( message );
   }
-  return GetTickCount() - start;
 }
 
-long testValidateQuoteRequest( int count )
+void testValidateQuoteRequest( Benchmark& b )
 {
   FIX42::QuoteRequest message( FIX::QuoteReqID("1") );
   FIX42::QuoteRequest::NoRelatedSym noRelatedSym;
@@ -697,17 +1095,14 @@ long testValidateQuoteRequest( int count )
   }
 
   FIX::DataDictionary dataDictionary;
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int j = 0; j <= count; ++j )
+  while( b.running() )
   {
     dataDictionary.validate( message );
   }
-  return GetTickCount() - start;
 }
 
-long testValidateDictQuoteRequest( int count )
+void testValidateDictQuoteRequest( Benchmark& b )
 {
   FIX42::QuoteRequest message( FIX::QuoteReqID("1") );
   FIX42::QuoteRequest::NoRelatedSym noRelatedSym;
@@ -725,119 +1120,379 @@ long testValidateDictQuoteRequest( int count )
     message.addGroup( noRelatedSym );
   }
 
-  count = count - 1;
 
-  long start = GetTickCount();
-  for ( int j = 0; j <= count; ++j )
+  while( b.running() )
   {
     s_dataDictionary->validate( message );
   }
-  return GetTickCount() - start;
 }
 
-class TestApplication : public FIX::NullApplication
+void fillMarketDataSnapshot( FIX44::MarketDataSnapshotFullRefresh& message )
 {
-public:
-  TestApplication() : m_count(0) {}
+  message.set( FIX::Symbol( "IBM" ) );
+  FIX44::MarketDataSnapshotFullRefresh::NoMDEntries entry;
+  for( int i = 0; i < 100; ++i )
+  {
+    entry.set( FIX::MDEntryType( i % 2 ? FIX::MDEntryType_OFFER : FIX::MDEntryType_BID ) );
+    entry.set( FIX::MDEntryPx( 120 + i * 0.01 ) );
+    entry.set( FIX::MDEntrySize( 100 * ( i + 1 ) ) );
+    entry.set( FIX::MDEntryPositionNo( i / 2 + 1 ) );
+    message.addGroup( entry );
+  }
+}
 
-  void fromApp( const FIX::Message& m, const FIX::SessionID& )
-  EXCEPT( FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue, FIX::UnsupportedMessageType )
+void testCreateMarketDataSnapshot( Benchmark& b )
+{
+  while( b.running() )
   {
-    m_count++; 
+    FIX44::MarketDataSnapshotFullRefresh message;
+    fillMarketDataSnapshot( message );
   }
+}
 
-  int getCount() { return m_count; }
+void testSerializeToStringMarketDataSnapshot( Benchmark& b )
+{
+  FIX44::MarketDataSnapshotFullRefresh message;
+  fillMarketDataSnapshot( message );
+  std::string string;
 
-private:
-  int m_count;
-};
+  while( b.running() )
+  {
+    message.toString( string );
+  }
+}
 
-long testSendOnSocket( int count, short port )
+void testSerializeFromStringAndValidateMarketDataSnapshot( Benchmark& b )
 {
-  std::stringstream stream;
-  stream
-    << "[DEFAULT]" << std::endl
-    << "SocketConnectHost=localhost" << std::endl
-    << "SocketConnectPort=" << (unsigned short)port << std::endl
-    << "SocketAcceptPort=" << (unsigned short)port << std::endl
-    << "SocketReuseAddress=Y" << std::endl
-    << "StartTime=00:00:00" << std::endl
-    << "EndTime=00:00:00" << std::endl
-    << "UseDataDictionary=N" << std::endl
-    << "BeginString=FIX.4.2" << std::endl
-    << "PersistMessages=N" << std::endl
-    << "[SESSION]" << std::endl
-    << "ConnectionType=acceptor" << std::endl
-    << "SenderCompID=SERVER" << std::endl
-    << "TargetCompID=CLIENT" << std::endl
-    << "[SESSION]" << std::endl
-    << "ConnectionType=initiator" << std::endl
-    << "SenderCompID=CLIENT" << std::endl
-    << "TargetCompID=SERVER" << std::endl
-    << "HeartBtInt=30" << std::endl;
+  FIX44::MarketDataSnapshotFullRefresh message;
+  fillMarketDataSnapshot( message );
+  message.getHeader().setField( FIX::SenderCompID( "SENDER" ) );
+  message.getHeader().setField( FIX::TargetCompID( "TARGET" ) );
+  message.getHeader().setField( FIX::MsgSeqNum( 1 ) );
+  message.getHeader().setField( FIX::SendingTime() );
+  std::string string = message.toString();
 
-  FIX::ClOrdID clOrdID( "ORDERID" );
-  FIX::HandlInst handlInst( '1' );
-  FIX::Symbol symbol( "LNUX" );
-  FIX::Side side( FIX::Side_BUY );
-  FIX::TransactTime transactTime;
-  FIX::OrdType ordType( FIX::OrdType_MARKET );
-  FIX42::NewOrderSingle message( clOrdID, handlInst, symbol, side, transactTime, ordType );
+  while( b.running() )
+  {
+    message.setString( string, VALIDATE, s_dataDictionary44.get() );
+  }
+}
 
-  FIX::SessionID sessionID( "FIX.4.2", "CLIENT", "SERVER" );
+std::string marketDataSnapshotString()
+{
+  FIX44::MarketDataSnapshotFullRefresh message;
+  fillMarketDataSnapshot( message );
+  message.getHeader().setField( FIX::SenderCompID( "SENDER" ) );
+  message.getHeader().setField( FIX::TargetCompID( "TARGET" ) );
+  message.getHeader().setField( FIX::MsgSeqNum( 1 ) );
+  message.getHeader().setField( FIX::SendingTime() );
+  return message.toString();
+}
 
-  TestApplication application;
+void testReadGroupsMarketDataSnapshot( Benchmark& b )
+{
+  std::string string = marketDataSnapshotString();
+  FIX44::MarketDataSnapshotFullRefresh message;
+  FIX44::MarketDataSnapshotFullRefresh::NoMDEntries entry;
+  FIX::MDEntryType type;
+  FIX::MDEntryPx price;
+  FIX::MDEntrySize size;
+  double total = 0;
+
+  while( b.running() )
+  {
+    message.setString( string, DONT_VALIDATE, s_dataDictionary44.get() );
+    int count = (int)message.groupCount( FIX::FIELD::NoMDEntries );
+    for( int i = 1; i <= count; ++i )
+    {
+      message.getGroup( i, entry );
+      entry.get( type );
+      entry.get( price );
+      entry.get( size );
+      if( type == FIX::MDEntryType_BID )
+        total += price * size;
+    }
+  }
+  if( total < 0 ) std::cout << total;
+}
+
+void testReadColumnsMarketDataSnapshot( Benchmark& b )
+{
+  std::string string = marketDataSnapshotString();
+  FIX::Message message;
+  FIX::MarketDataColumns columns;
+  double total = 0;
+
+  while( b.running() )
+  {
+    // as a session hands it to fromApp with LazyBodyMsgTypes=W
+    message.setString( string, DONT_VALIDATE, s_dataDictionary44.get(),
+                       s_dataDictionary44.get(), true );
+    columns.decode( message );
+    const std::vector < char >& types = columns.getEntryTypes();
+    const std::vector < double >& prices = columns.getPrices();
+    const std::vector < double >& sizes = columns.getSizes();
+    for( size_t i = 0; i < columns.size(); ++i )
+      if( types[ i ] == FIX::MDEntryType_BID )
+        total += prices[ i ] * sizes[ i ];
+  }
+  if( total < 0 ) std::cout << total;
+}
+
+void testSerializeFromStringAndValidateExecutionReport50SP2( Benchmark& b )
+{
+  FIX50SP2::ExecutionReport message
+    ( FIX::OrderID( "ORDERID" ), FIX::ExecID( "EXECID" ),
+      FIX::ExecType( FIX::ExecType_TRADE ), FIX::OrdStatus( FIX::OrdStatus_FILLED ),
+      FIX::Side( FIX::Side_BUY ), FIX::LeavesQty( 0 ), FIX::CumQty( 100 ) );
+  message.set( FIX::Symbol( "LNUX" ) );
+  message.set( FIX::LastPx( 12.5 ) );
+  message.set( FIX::LastQty( 100 ) );
+  message.getHeader().setField( FIX::BeginString( FIX::BeginString_FIXT11 ) );
+  message.getHeader().setField( FIX::SenderCompID( "SENDER" ) );
+  message.getHeader().setField( FIX::TargetCompID( "TARGET" ) );
+  message.getHeader().setField( FIX::MsgSeqNum( 1 ) );
+  message.getHeader().setField( FIX::SendingTime() );
+  std::string string = message.toString();
+
+  while( b.running() )
+  {
+    message.setString( string, VALIDATE, s_transportDictionary.get(),
+                       s_dataDictionary50SP2.get() );
+  }
+}
+
+class NullResponder : public FIX::Responder
+{
+public:
+  bool send( const std::string& ) { return true; }
+  bool sendBuffers( const std::string* const*, size_t ) { return true; }
+  void disconnect() {}
+};
+
+void testResendRequest( Benchmark& b )
+{
+  FIX::SessionID sessionID( "FIX.4.2", "SERVER", "RESEND" );
+  FIX::NullApplication application;
   FIX::MemoryStoreFactory factory;
-  FIX::SessionSettings settings( stream );
-  FIX::ScreenLogFactory logFactory( settings );
+  FIX::DataDictionaryProvider provider;
+  provider.addTransportDataDictionary( sessionID.getBeginString(), "../spec/FIX42.xml" );
+  FIX::UtcTimeOnly startTime;
+  FIX::TimeRange sessionTime( startTime, startTime );
+  FIX::Session session( application, factory, sessionID, provider, sessionTime, 0, 0 );
+  NullResponder responder;
+  session.setResponder( &responder );
+
+  FIX42::Logon logon;
+  logon.getHeader().set( FIX::SenderCompID( "RESEND" ) );
+  logon.getHeader().set( FIX::TargetCompID( "SERVER" ) );
+  logon.getHeader().set( FIX::MsgSeqNum( 1 ) );
+  logon.getHeader().set( FIX::SendingTime() );
+  logon.set( FIX::EncryptMethod( 0 ) );
+  logon.set( FIX::HeartBtInt( 30 ) );
+  session.next( logon.toString(), FIX::UtcTimeStamp() );
+  if( !session.isLoggedOn() )
+    throw std::runtime_error( "session did not log on" );
+
+  for( int i = 0; i < 100; ++i )
+  {
+    FIX42::NewOrderSingle message
+      ( FIX::ClOrdID( "ORDERID" ), FIX::HandlInst( '1' ), FIX::Symbol( "LNUX" ),
+        FIX::Side( FIX::Side_BUY ), FIX::TransactTime(), FIX::OrdType( FIX::OrdType_MARKET ) );
+    session.send( message );
+  }
 
-  FIX::SocketAcceptor acceptor( application, factory, settings );
-  acceptor.start();
+  std::vector<std::string> requests;
+  for( int i = 0; i < b.getIterations(); ++i )
+  {
+    FIX42::ResendRequest request( FIX::BeginSeqNo( 2 ), FIX::EndSeqNo( 0 ) );
+    request.getHeader().set( FIX::SenderCompID( "RESEND" ) );
+    request.getHeader().set( FIX::TargetCompID( "SERVER" ) );
+    request.getHeader().set( FIX::MsgSeqNum( i + 2 ) );
+    request.getHeader().set( FIX::SendingTime() );
+    requests.push_back( request.toString() );
+  }
 
-  FIX::SocketInitiator initiator( application, factory, settings );
-  initiator.start();
+  FIX::UtcTimeStamp now;
+  std::vector<std::string>::const_iterator i = requests.begin();
+  while( b.running() )
+  {
+    session.next( *i++, now );
+  }
+}
 
-  FIX::process_sleep( 1 );
+/// Logged on sessions that a drop copy is sent to
+class FanOutSessions
+{
+public:
+  enum { SESSIONS = 40 };
 
-  long start = GetTickCount();
+  FanOutSessions( bool persist )
+  {
+    FIX::UtcTimeOnly startTime;
+    FIX::TimeRange sessionTime( startTime, startTime );
+    m_provider.addTransportDataDictionary( FIX::BeginString( "FIX.4.2" ), "../spec/FIX42.xml" );
+    for( int i = 0; i < SESSIONS; ++i )
+    {
+      std::string target = "CLIENT" + FIX::IntConvertor::convert( i );
+      FIX::SessionID sessionID( "FIX.4.2", "DROPCOPY", target );
+      FIX::Session* pSession = new FIX::Session
+        ( m_application, m_factory, sessionID, m_provider, sessionTime, 0, 0 );
+      pSession->setPersistMessages( persist );
+      pSession->setResponder( &m_responder );
+
+      FIX42::Logon logon;
+      logon.getHeader().set( FIX::SenderCompID( target ) );
+      logon.getHeader().set( FIX::TargetCompID( "DROPCOPY" ) );
+      logon.getHeader().set( FIX::MsgSeqNum( 1 ) );
+      logon.getHeader().set( FIX::SendingTime() );
+      logon.set( FIX::EncryptMethod( 0 ) );
+      logon.set( FIX::HeartBtInt( 30 ) );
+      pSession->next( logon.toString(), FIX::UtcTimeStamp() );
+      if( !pSession->isLoggedOn() )
+        throw std::runtime_error( "session did not log on" );
+
+      m_sessions.push_back( pSession );
+      m_sessionIDs.push_back( sessionID );
+    }
+  }
 
-  for ( int i = 0; i <= count; ++i )
-    FIX::Session::sendToTarget( message, sessionID );
+  ~FanOutSessions()
+  {
+    for( size_t i = 0; i < m_sessions.size(); ++i )
+      delete m_sessions[ i ];
+  }
 
-  while( application.getCount() < count )
-    FIX::process_sleep( 0.1 );
+  const std::vector<FIX::SessionID>& getSessionIDs() const { return m_sessionIDs; }
 
-  long ticks = GetTickCount() - start;
+  static FIX42::ExecutionReport createExecutionReport()
+  {
+    FIX42::ExecutionReport message
+      ( FIX::OrderID( "ORDERID" ), FIX::ExecID( "EXECID" ),
+        FIX::ExecTransType( FIX::ExecTransType_NEW ), FIX::ExecType( FIX::ExecType_FILL ),
+        FIX::OrdStatus( FIX::OrdStatus_FILLED ), FIX::Symbol( "LNUX" ),
+        FIX::Side( FIX::Side_BUY ), FIX::LeavesQty( 0 ), FIX::CumQty( 100 ),
+        FIX::AvgPx( 12.5 ) );
+    message.set( FIX::ClOrdID( "CLORDID" ) );
+    message.set( FIX::LastShares( 100 ) );
+    message.set( FIX::LastPx( 12.5 ) );
+    message.set( FIX::TransactTime() );
+    message.set( FIX::Text( "drop copy of a fill on the primary session" ) );
+    return message;
+  }
 
-  initiator.stop();
-  acceptor.stop();
+private:
+  FIX::NullApplication m_application;
+  FIX::NullStoreFactory m_factory;
+  FIX::DataDictionaryProvider m_provider;
+  NullResponder m_responder;
+  std::vector<FIX::Session*> m_sessions;
+  std::vector<FIX::SessionID> m_sessionIDs;
+};
+
+void testFanOutSendToTarget( Benchmark& b )
+{
+  FanOutSessions sessions( true );
+  const std::vector<FIX::SessionID>& sessionIDs = sessions.getSessionIDs();
+  FIX42::ExecutionReport message = FanOutSessions::createExecutionReport();
+
+  while( b.running() )
+  {
+    for( size_t i = 0; i < sessionIDs.size(); ++i )
+      FIX::Session::sendToTarget( message, sessionIDs[ i ] );
+  }
+}
+
+void testFanOutSendToTargets( Benchmark& b )
+{
+  FanOutSessions sessions( true );
+  const std::vector<FIX::SessionID>& sessionIDs = sessions.getSessionIDs();
+  FIX42::ExecutionReport message = FanOutSessions::createExecutionReport();
 
-  return ticks;
+  while( b.running() )
+  {
+    FIX::Session::sendToTargets( message, sessionIDs );
+  }
 }
 
-long testSendOnThreadedSocket( int count, short port )
+void testFanOutSendToTargetsNotPersisted( Benchmark& b )
+{
+  FanOutSessions sessions( false );
+  const std::vector<FIX::SessionID>& sessionIDs = sessions.getSessionIDs();
+  FIX42::ExecutionReport message = FanOutSessions::createExecutionReport();
+
+  while( b.running() )
+  {
+    FIX::Session::sendToTargets( message, sessionIDs );
+  }
+}
+
+class TestApplication : public FIX::NullApplication
+{
+public:
+  TestApplication() : m_count(0) {}
+
+  void fromApp( const FIX::Message& m, const FIX::SessionID& )
+  EXCEPT( FIX::FieldNotFound, FIX::IncorrectDataFormat, FIX::IncorrectTagValue, FIX::UnsupportedMessageType )
+  {
+    ++m_count;
+  }
+
+  long getCount() { return m_count; }
+
+private:
+  FIX::atomic_count m_count;
+};
+
+std::string socketSettings( int sessions, const std::string& extra = "" )
 {
   std::stringstream stream;
   stream
     << "[DEFAULT]" << std::endl
     << "SocketConnectHost=localhost" << std::endl
-    << "SocketConnectPort=" << (unsigned short)port << std::endl
-    << "SocketAcceptPort=" << (unsigned short)port << std::endl
+    << "SocketConnectPort=" << (unsigned short)s_port << std::endl
+    << "SocketAcceptPort=" << (unsigned short)s_port << std::endl
     << "SocketReuseAddress=Y" << std::endl
     << "StartTime=00:00:00" << std::endl
     << "EndTime=00:00:00" << std::endl
     << "UseDataDictionary=N" << std::endl
     << "BeginString=FIX.4.2" << std::endl
     << "PersistMessages=N" << std::endl
-    << "[SESSION]" << std::endl
-    << "ConnectionType=acceptor" << std::endl
-    << "SenderCompID=SERVER" << std::endl
-    << "TargetCompID=CLIENT" << std::endl
-    << "[SESSION]" << std::endl
-    << "ConnectionType=initiator" << std::endl
-    << "SenderCompID=CLIENT" << std::endl
-    << "TargetCompID=SERVER" << std::endl
-    << "HeartBtInt=30" << std::endl;
+    << extra;
+
+  for( int i = 1; i <= sessions; ++i )
+  {
+    std::string client = sessions == 1 ? "CLIENT" : "CLIENT" + FIX::IntConvertor::convert( i );
+    stream
+      << "[SESSION]" << std::endl
+      << "ConnectionType=acceptor" << std::endl
+      << "SenderCompID=SERVER" << std::endl
+      << "TargetCompID=" << client << std::endl
+      << "[SESSION]" << std::endl
+      << "ConnectionType=initiator" << std::endl
+      << "SenderCompID=" << client << std::endl
+      << "TargetCompID=SERVER" << std::endl
+      << "HeartBtInt=30" << std::endl;
+  }
+  return stream.str();
+}
+
+bool isLoggedOn( const std::vector<FIX::SessionID>& sessionIDs )
+{
+  for( size_t i = 0; i < sessionIDs.size(); ++i )
+  {
+    FIX::Session* pSession = FIX::Session::lookupSession( sessionIDs[ i ] );
+    if( !pSession || !pSession->isLoggedOn() )
+      return false;
+  }
+  return true;
+}
+
+/// Send NewOrderSingles round robin on every initiator session until all arrive
+template < typename Acceptor, typename Initiator >
+void testSend( Benchmark& b, int sessions, const std::string& extra = "" )
+{
+  std::stringstream stream( socketSettings( sessions, extra ) );
 
   FIX::ClOrdID clOrdID( "ORDERID" );
   FIX::HandlInst handlInst( '1' );
@@ -847,31 +1502,74 @@ long testSendOnThreadedSocket( int count, short port )
   FIX::OrdType ordType( FIX::OrdType_MARKET );
   FIX42::NewOrderSingle message( clOrdID, handlInst, symbol, side, transactTime, ordType );
 
-  FIX::SessionID sessionID( "FIX.4.2", "CLIENT", "SERVER" );
+  std::vector<FIX::SessionID> sessionIDs;
+  for( int i = 1; i <= sessions; ++i )
+  {
+    std::string client = sessions == 1 ? "CLIENT" : "CLIENT" + FIX::IntConvertor::convert( i );
+    sessionIDs.push_back( FIX::SessionID( "FIX.4.2", client, "SERVER" ) );
+  }
 
   TestApplication application;
   FIX::MemoryStoreFactory factory;
   FIX::SessionSettings settings( stream );
 
-  FIX::ThreadedSocketAcceptor acceptor( application, factory, settings );
+  Acceptor acceptor( application, factory, settings );
   acceptor.start();
 
-  FIX::ThreadedSocketInitiator initiator( application, factory, settings );
+  Initiator initiator( application, factory, settings );
   initiator.start();
 
-  FIX::process_sleep( 1 );
-
-  long start = GetTickCount();
-  for ( int i = 0; i <= count; ++i )
-    FIX::Session::sendToTarget( message, sessionID );
-
-  while( application.getCount() < count )
+  for( int i = 0; i < 100 && !isLoggedOn( sessionIDs ); ++i )
     FIX::process_sleep( 0.1 );
 
-  long ticks = GetTickCount() - start;
+  size_t next = 0;
+  while( b.running() )
+  {
+    FIX::Session::sendToTarget( message, sessionIDs[ next ] );
+    if( ++next == sessionIDs.size() ) next = 0;
+  }
+
+  long received = 0;
+  int idle = 0;
+  while( application.getCount() < b.getIterations() && idle < 1000 )
+  {
+    FIX::process_sleep( 0.01 );
+    idle = application.getCount() == received ? idle + 1 : 0;
+    received = application.getCount();
+  }
+  b.finish();
 
   initiator.stop();
   acceptor.stop();
 
-  return ticks;
+  if( received < b.getIterations() )
+    throw std::runtime_error( "timed out waiting for messages" );
+}
+
+void testSendOnSocket( Benchmark& b )
+{
+  testSend<FIX::SocketAcceptor, FIX::SocketInitiator>( b, 1 );
+}
+
+void testSendOnThreadedSocket( Benchmark& b )
+{
+  testSend<FIX::ThreadedSocketAcceptor, FIX::ThreadedSocketInitiator>( b, 1 );
+}
+
+void testSendOnThreadedSocketSpinning( Benchmark& b )
+{
+  testSend<FIX::ThreadedSocketAcceptor, FIX::ThreadedSocketInitiator>
+    ( b, 1, "SocketSpinTime=1000\n" );
+}
+
+void testSendOnThreadedSocketSessions( Benchmark& b )
+{
+  testSend<FIX::ThreadedSocketAcceptor, FIX::ThreadedSocketInitiator>( b, 8 );
 }
+
+#if HAVE_IO_URING
+void testSendOnUring( Benchmark& b )
+{
+  testSend<FIX::UringAcceptor, FIX::UringInitiator>( b, 1 );
+}
+#endif
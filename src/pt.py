@@ -0,0 +1,156 @@
+from __future__ import print_function
+import os
+import sys
+import time
+import tempfile
+import threading
+import quickfix as fix
+import quickfix42 as fix42
+
+if len(sys.argv) < 2:
+	print("usage: pt.py PORT [COUNT]")
+	sys.exit(1)
+
+port = int(sys.argv[1])
+count = int(sys.argv[2]) if len(sys.argv) > 2 else 20000
+
+def report(name, num, seconds, extra=""):
+	print(name + ": ")
+	print("    num: %d, seconds: %f, num_per_second: %f%s" % (num, seconds, num / seconds, extra))
+
+def newOrderSingle():
+	message = fix42.NewOrderSingle(
+		fix.ClOrdID("ORDERID"), fix.HandlInst('1'), fix.Symbol("LNUX"),
+		fix.Side(fix.Side_BUY), fix.TransactTime(), fix.OrdType(fix.OrdType_LIMIT))
+	message.setField(fix.OrderQty(100))
+	message.setField(fix.Price(12.5))
+	message.setField(fix.Account("ACCOUNT"))
+	message.setField(fix.TimeInForce(fix.TimeInForce_DAY))
+	return message
+
+class NullApplication(fix.Application):
+	def onCreate(self, sessionID): return
+	def onLogon(self, sessionID): return
+	def onLogout(self, sessionID): return
+	def toAdmin(self, message, sessionID): return
+	def fromAdmin(self, message, sessionID): return
+	def toApp(self, message, sessionID): return
+	def fromApp(self, message, sessionID): return
+
+class CountingApplication(NullApplication):
+	def __init__(self):
+		NullApplication.__init__(self)
+		self.count = 0
+
+	def fromApp(self, message, sessionID):
+		self.count += 1
+
+class BatchedCountingApplication(fix.BatchedApplication):
+	def __init__(self):
+		fix.BatchedApplication.__init__(self, 64)
+		self.count = 0
+		self.batches = 0
+
+	def onCreate(self, sessionID): return
+	def onLogon(self, sessionID): return
+	def onLogout(self, sessionID): return
+	def toAdmin(self, message, sessionID): return
+	def fromAdmin(self, message, sessionID): return
+	def toApp(self, message, sessionID): return
+
+	def fromAppBatch(self, messages):
+		self.count += len(messages)
+		self.batches += 1
+
+def settingsFile(port, client):
+	file = tempfile.NamedTemporaryFile(mode="w", suffix=".cfg", delete=False)
+	file.write("[DEFAULT]\n"
+		"SocketConnectHost=localhost\n"
+		"SocketConnectPort=%d\n"
+		"SocketAcceptPort=%d\n"
+		"SocketReuseAddress=Y\n"
+		"StartTime=00:00:00\n"
+		"EndTime=00:00:00\n"
+		"UseDataDictionary=N\n"
+		"BeginString=FIX.4.2\n"
+		"PersistMessages=N\n"
+		"[SESSION]\n"
+		"ConnectionType=acceptor\n"
+		"SenderCompID=SERVER\n"
+		"TargetCompID=%s\n"
+		"[SESSION]\n"
+		"ConnectionType=initiator\n"
+		"SenderCompID=%s\n"
+		"TargetCompID=SERVER\n"
+		"HeartBtInt=30\n" % (port, port, client, client))
+	file.close()
+	return file.name
+
+def testSend(name, application, port, client):
+	"""Send NewOrderSingles from Python while a Python thread spins alongside"""
+	path = settingsFile(port, client)
+	settings = fix.SessionSettings(path)
+	factory = fix.MemoryStoreFactory()
+	initiatorApplication = NullApplication()
+
+	acceptor = fix.SocketAcceptor(application, factory, settings)
+	initiator = fix.SocketInitiator(initiatorApplication, factory, settings)
+	acceptor.start()
+	initiator.start()
+	if isinstance(application, fix.BatchedApplication):
+		application.start()
+
+	sessionID = fix.SessionID("FIX.4.2", client, "SERVER")
+	for i in range(100):
+		if initiator.isLoggedOn(): break
+		time.sleep(0.1)
+
+	# spins only as often as the GIL lets it
+	spins = [0]
+	done = threading.Event()
+	def spin():
+		while not done.is_set(): spins[0] += 1
+	spinner = threading.Thread(target=spin)
+	spinner.start()
+
+	message = newOrderSingle()
+	start = time.time()
+	for i in range(count):
+		fix.Session.sendToTarget(message, sessionID)
+	while application.count < count and time.time() - start < 60:
+		time.sleep(0.001)
+	seconds = time.time() - start
+	done.set()
+	spinner.join()
+
+	extra = ", spins_per_second: %f" % (spins[0] / seconds)
+	if isinstance(application, fix.BatchedApplication):
+		extra += ", messages_per_batch: %f" % (float(application.count) / max(application.batches, 1))
+		application.stop()
+	report(name, application.count, seconds, extra)
+
+	initiator.stop()
+	acceptor.stop()
+	os.remove(path)
+
+def testReadFields():
+	message = fix.Message(newOrderSingle().toString())
+	fields = [fix.ClOrdID(), fix.HandlInst(), fix.Symbol(), fix.Side(), fix.TransactTime(),
+		fix.OrdType(), fix.OrderQty(), fix.Price(), fix.Account(), fix.TimeInForce()]
+
+	start = time.time()
+	for i in range(count):
+		values = {}
+		for field in fields:
+			message.getField(field)
+			values[field.getTag()] = field.getString()
+	report("Reading 10 fields from NewOrderSingle one by one", count, time.time() - start)
+
+	start = time.time()
+	for i in range(count):
+		values = message.toDict()
+	report("Reading 10 fields from NewOrderSingle with toDict", count, time.time() - start)
+
+testReadFields()
+testSend("Sending/Receiving NewOrderSingle with fromApp", CountingApplication(), port, "CLIENT1")
+testSend("Sending/Receiving NewOrderSingle with fromAppBatch", BatchedCountingApplication(), port + 1, "CLIENT2")
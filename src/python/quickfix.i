@@ -59,8 +59,225 @@
 
 %rename(FIXException) FIX::Exception;
 
+// Wrappers keep the GIL, most calls are too short to be worth releasing it.
+// It is released around the calls that block, do socket or store I/O or
+// take a session lock a session thread may hold while calling back into
+// Python.  Director callbacks take it back on the session threads.
+%feature("nothreadallow");
+%feature("nothreadallow", "0") FIX::Initiator::start;
+%feature("nothreadallow", "0") FIX::Initiator::block;
+%feature("nothreadallow", "0") FIX::Initiator::poll;
+%feature("nothreadallow", "0") FIX::Initiator::stop;
+%feature("nothreadallow", "0") FIX::Initiator::isLoggedOn;
+%feature("nothreadallow", "0") FIX::Acceptor::start;
+%feature("nothreadallow", "0") FIX::Acceptor::block;
+%feature("nothreadallow", "0") FIX::Acceptor::poll;
+%feature("nothreadallow", "0") FIX::Acceptor::stop;
+%feature("nothreadallow", "0") FIX::Acceptor::isLoggedOn;
+%feature("nothreadallow", "0") FIX::SocketInitiator::~SocketInitiator;
+%feature("nothreadallow", "0") FIX::SocketAcceptor::~SocketAcceptor;
+%feature("nothreadallow", "0") FIX::ThreadedSocketInitiator::~ThreadedSocketInitiator;
+%feature("nothreadallow", "0") FIX::ThreadedSocketAcceptor::~ThreadedSocketAcceptor;
+%feature("nothreadallow", "0") FIX::SSLSocketInitiator::~SSLSocketInitiator;
+%feature("nothreadallow", "0") FIX::SSLSocketAcceptor::~SSLSocketAcceptor;
+%feature("nothreadallow", "0") FIX::ThreadedSSLSocketInitiator::~ThreadedSSLSocketInitiator;
+%feature("nothreadallow", "0") FIX::ThreadedSSLSocketAcceptor::~ThreadedSSLSocketAcceptor;
+%feature("nothreadallow", "0") FIX::Session::sendToTarget;
+%feature("nothreadallow", "0") FIX::Session::sendToTargets;
+%feature("nothreadallow", "0") FIX::Session::send;
+%feature("nothreadallow", "0") FIX::Session::sendAsync;
+%feature("nothreadallow", "0") FIX::Session::waitForSend;
+%feature("nothreadallow", "0") FIX::Session::reset;
+%feature("nothreadallow", "0") FIX::Session::refresh;
+%feature("nothreadallow", "0") FIX::Session::setNextSenderMsgSeqNum;
+%feature("nothreadallow", "0") FIX::Session::setNextTargetMsgSeqNum;
+%feature("nothreadallow", "0") FIX::Session::disconnect;
+
 %include ../quickfix.i
 
+%{
+/*
+ * Fields of a map as a dict of tag to value or a list of (tag, value) in
+ * message order.  Repeating groups are given under their count tag as a
+ * list with a dict, or list, for each group in place of the count.
+ */
+static PyObject* FieldMap_toPython( const FIX::FieldMap& map, bool dict )
+{
+  PyObject* pResult = dict ? PyDict_New() : PyList_New( 0 );
+  FIX::FieldMap::const_iterator i;
+  for( i = map.begin(); i != map.end(); ++i )
+  {
+#if PYTHON_MAJOR_VERSION >= 3
+    PyObject* pTag = PyLong_FromLong( i->getTag() );
+#else
+    PyObject* pTag = PyInt_FromLong( i->getTag() );
+#endif
+    PyObject* pValue;
+
+    const std::vector< FIX::FieldMap* >* pGroups = map.getGroupVector( i->getTag() );
+    if( pGroups )
+    {
+      pValue = PyList_New( pGroups->size() );
+      for( size_t j = 0; j < pGroups->size(); ++j )
+        PyList_SET_ITEM( pValue, j, FieldMap_toPython( *( *pGroups )[ j ], dict ) );
+    }
+    else
+    {
+      const std::string& value = i->getString();
+#if PYTHON_MAJOR_VERSION >= 3
+      pValue = PyUnicode_FromStringAndSize( value.c_str(), value.size() );
+#else
+      pValue = PyString_FromStringAndSize( value.c_str(), value.size() );
+#endif
+    }
+
+    if( dict )
+    {
+      PyDict_SetItem( pResult, pTag, pValue );
+    }
+    else
+    {
+      PyObject* pPair = PyTuple_Pack( 2, pTag, pValue );
+      PyList_Append( pResult, pPair );
+      Py_DECREF( pPair );
+    }
+    Py_DECREF( pTag );
+    Py_DECREF( pValue );
+  }
+  return pResult;
+}
+%}
+
+%extend FIX::FieldMap {
+  PyObject* toDict() {
+    return FieldMap_toPython( *self, true );
+  }
+
+  PyObject* toList() {
+    return FieldMap_toPython( *self, false );
+  }
+}
+
+%{
+#include <AutoResetEvent.h>
+#include <deque>
+
+namespace FIX
+{
+/**
+ * Application handing application messages to Python in batches.
+ *
+ * fromApp queues a copy of each message on the session thread and returns
+ * without taking the GIL.  takeBatch hands up to batchSize of them to
+ * Python at once, start runs a thread passing each batch to fromAppBatch
+ * as a list of (message, sessionID).  The messages have been accepted by
+ * the session by then, so raising an exception cannot reject them.  The
+ * other callbacks are made as they are for an Application.
+ */
+class BatchedApplication : public Application
+{
+public:
+  BatchedApplication( int batchSize = 64 )
+  : m_batchSize( batchSize > 0 ? batchSize : 1 ), m_stop( false ) {}
+
+  virtual ~BatchedApplication()
+  {
+    for( ; m_queue.size(); m_queue.pop_front() )
+    {
+      delete m_queue.front().first;
+      delete m_queue.front().second;
+    }
+  }
+
+  void fromApp( const Message& message, const SessionID& sessionID )
+  EXCEPT ( FieldNotFound, IncorrectDataFormat, IncorrectTagValue, UnsupportedMessageType )
+  {
+    Locker locker( m_mutex );
+    m_queue.push_back( Entry( new Message( message ), new SessionID( sessionID ) ) );
+    if( m_queue.size() == 1 ) m_event.signal();
+  }
+
+  /// Up to batchSize queued messages, waiting as long as timeout for one
+  PyObject* takeBatch( double timeout )
+  {
+    Batch batch;
+    Py_BEGIN_ALLOW_THREADS
+    if( !take( batch ) && !m_stop )
+    {
+      m_event.wait( timeout );
+      take( batch );
+    }
+    Py_END_ALLOW_THREADS
+
+    PyObject* pBatch = PyList_New( batch.size() );
+    for( size_t i = 0; i < batch.size(); ++i )
+    {
+      PyObject* pMessage = SWIG_NewPointerObj
+        ( batch[ i ].first, SWIGTYPE_p_FIX__Message, SWIG_POINTER_OWN );
+      PyObject* pSessionID = SWIG_NewPointerObj
+        ( batch[ i ].second, SWIGTYPE_p_FIX__SessionID, SWIG_POINTER_OWN );
+      PyList_SET_ITEM( pBatch, i, Py_BuildValue( "(NN)", pMessage, pSessionID ) );
+    }
+    return pBatch;
+  }
+
+  void stop()
+  {
+    m_stop = true;
+    m_event.signal();
+  }
+
+  bool isStopped() { return m_stop; }
+
+private:
+  typedef std::pair< Message*, SessionID* > Entry;
+  typedef std::vector< Entry > Batch;
+
+  bool take( Batch& batch )
+  {
+    Locker locker( m_mutex );
+    while( batch.size() < m_batchSize && m_queue.size() )
+    {
+      batch.push_back( m_queue.front() );
+      m_queue.pop_front();
+    }
+    return batch.size() != 0;
+  }
+
+  size_t m_batchSize;
+  volatile bool m_stop;
+  std::deque< Entry > m_queue;
+  Mutex m_mutex;
+  AutoResetEvent m_event;
+};
+}
+%}
+
+%feature("director") FIX::BatchedApplication;
+%feature("nodirector") FIX::BatchedApplication::fromApp;
+
+namespace FIX
+{
+class BatchedApplication : public Application
+{
+public:
+  BatchedApplication( int batchSize = 64 );
+  virtual ~BatchedApplication();
+
+  virtual void fromApp( const Message&, const SessionID& );
+  PyObject* takeBatch( double timeout );
+  void stop();
+  bool isStopped();
+};
+}
+
+%extend FIX::BatchedApplication {
+%pythoncode %{
+  def start(self):
+    thread.start_new_thread(_quickfix_dispatch_batches, (self,))
+%}
+}
+
 %pythoncode %{
 #ifdef SWIGPYTHON
 try:
@@ -70,6 +287,17 @@ except ImportError:
 
 def _quickfix_start_thread(i_or_a):
   i_or_a.block()
+
+def _quickfix_dispatch_batches(application):
+  import os, traceback
+  try:
+    while not application.isStopped():
+      batch = application.takeBatch(1.0)
+      if len(batch):
+        application.fromAppBatch(batch)
+  except:
+    traceback.print_exc()
+    os._exit(1)
 #endif
 %}
 
@@ -274,8 +502,116 @@ class SocketAcceptor(SocketAcceptorBase):
     self.storeFactory = storeFactory
     self.settings = settings
     self.logFactory = logFactory
+
+class ThreadedSocketInitiator(ThreadedSocketInitiatorBase):
+  application = 0
+  storeFactory = 0
+  setting = 0
+  logFactory = 0
+
+  def __init__(self, application, storeFactory, settings, logFactory=None):
+    if logFactory == None:
+      ThreadedSocketInitiatorBase.__init__(self, application, storeFactory, settings)
+    else:
+      ThreadedSocketInitiatorBase.__init__(self, application, storeFactory, settings, logFactory)
+
+    self.application = application
+    self.storeFactory = storeFactory
+    self.settings = settings
+    self.logFactory = logFactory
+
+class ThreadedSocketAcceptor(ThreadedSocketAcceptorBase):
+  application = 0
+  storeFactory = 0
+  setting = 0
+  logFactory = 0
+
+  def __init__(self, application, storeFactory, settings, logFactory=None):
+    if logFactory == None:
+      ThreadedSocketAcceptorBase.__init__(self, application, storeFactory, settings)
+    else:
+      ThreadedSocketAcceptorBase.__init__(self, application, storeFactory, settings, logFactory)
+
+    self.application = application
+    self.storeFactory = storeFactory
+    self.settings = settings
+    self.logFactory = logFactory
+#endif
+%}
+
+#if (HAVE_SSL > 0)
+%pythoncode %{
+#ifdef SWIGPYTHON
+class SSLSocketInitiator(SSLSocketInitiatorBase):
+  application = 0
+  storeFactory = 0
+  setting = 0
+  logFactory = 0
+
+  def __init__(self, application, storeFactory, settings, logFactory=None):
+    if logFactory == None:
+      SSLSocketInitiatorBase.__init__(self, application, storeFactory, settings)
+    else:
+      SSLSocketInitiatorBase.__init__(self, application, storeFactory, settings, logFactory)
+
+    self.application = application
+    self.storeFactory = storeFactory
+    self.settings = settings
+    self.logFactory = logFactory
+
+class SSLSocketAcceptor(SSLSocketAcceptorBase):
+  application = 0
+  storeFactory = 0
+  setting = 0
+  logFactory = 0
+
+  def __init__(self, application, storeFactory, settings, logFactory=None):
+    if logFactory == None:
+      SSLSocketAcceptorBase.__init__(self, application, storeFactory, settings)
+    else:
+      SSLSocketAcceptorBase.__init__(self, application, storeFactory, settings, logFactory)
+
+    self.application = application
+    self.storeFactory = storeFactory
+    self.settings = settings
+    self.logFactory = logFactory
+
+class ThreadedSSLSocketInitiator(ThreadedSSLSocketInitiatorBase):
+  application = 0
+  storeFactory = 0
+  setting = 0
+  logFactory = 0
+
+  def __init__(self, application, storeFactory, settings, logFactory=None):
+    if logFactory == None:
+      ThreadedSSLSocketInitiatorBase.__init__(self, application, storeFactory, settings)
+    else:
+      ThreadedSSLSocketInitiatorBase.__init__(self, application, storeFactory, settings, logFactory)
+
+    self.application = application
+    self.storeFactory = storeFactory
+    self.settings = settings
+    self.logFactory = logFactory
+
+class ThreadedSSLSocketAcceptor(ThreadedSSLSocketAcceptorBase):
+  application = 0
+  storeFactory = 0
+  setting = 0
+  logFactory = 0
+
+  def __init__(self, application, storeFactory, settings, logFactory=None):
+    if logFactory == None:
+      ThreadedSSLSocketAcceptorBase.__init__(self, application, storeFactory, settings)
+    else:
+      ThreadedSSLSocketAcceptorBase.__init__(self, application, storeFactory, settings, logFactory)
+
+    self.application = application
+    self.storeFactory = storeFactory
+    self.settings = settings
+    self.logFactory = logFactory
 #endif
 %}
+#endif
 
 %init %{
 #ifndef _MSC_VER
@@ -280,5 +280,26 @@ class MessageTestCase(unittest.TestCase):
         self.object.getGroup( 3, group )
         self.assertEqual( "C", group.getField(clOrdID).getString() )
 
+    def test_toDict(self):
+        self.object.getHeader().setField( fix.MsgType("E") )
+        self.object.setField( fix.ListID( "1" ) )
+        self.object.setField( fix.TotNoOrders( 2 ) )
+
+        group = fix42.NewOrderList.NoOrders()
+        group.setField( fix.ClOrdID( "A" ) )
+        group.setField( fix.Symbol( "DELL" ) )
+        self.object.addGroup( group )
+        group.setField( fix.ClOrdID( "B" ) )
+        group.setField( fix.Symbol( "LNUX" ) )
+        self.object.addGroup( group )
+
+        self.assertEqual( { 35: "E" }, self.object.getHeader().toDict() )
+        self.assertEqual( { 66: "1", 68: "2",
+                            73: [ { 11: "A", 55: "DELL" }, { 11: "B", 55: "LNUX" } ] },
+                          self.object.toDict() )
+        self.assertEqual( [ (66, "1"), (68, "2"),
+                            (73, [ [ (11, "A"), (55, "DELL") ], [ (11, "B"), (55, "LNUX") ] ]) ],
+                          self.object.toList() )
+
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,103 @@
+import quickfix as fix
+import quickfix42 as fix42
+import os
+import socket
+import tempfile
+import threading
+import time
+import unittest
+
+class CountingApplication(fix.Application):
+	def __init__(self):
+		fix.Application.__init__(self)
+		self.toAppCount = 0
+		self.fromAppCount = 0
+
+	def onCreate(self, sessionID): return
+	def onLogon(self, sessionID): return
+	def onLogout(self, sessionID): return
+	def toAdmin(self, message, sessionID): return
+	def fromAdmin(self, message, sessionID): return
+	def toApp(self, message, sessionID):
+		self.toAppCount += 1
+	def fromApp(self, message, sessionID):
+		self.fromAppCount += 1
+
+class SessionTestCase(unittest.TestCase):
+
+	def setUp(self):
+		listener = socket.socket()
+		listener.bind(("localhost", 0))
+		port = listener.getsockname()[1]
+		listener.close()
+
+		file = tempfile.NamedTemporaryFile(mode="w", suffix=".cfg", delete=False)
+		file.write("[DEFAULT]\n"
+			"SocketConnectHost=localhost\n"
+			"SocketConnectPort=%d\n"
+			"SocketAcceptPort=%d\n"
+			"SocketReuseAddress=Y\n"
+			"StartTime=00:00:00\n"
+			"EndTime=00:00:00\n"
+			"UseDataDictionary=N\n"
+			"BeginString=FIX.4.2\n"
+			"PersistMessages=N\n"
+			"[SESSION]\n"
+			"ConnectionType=acceptor\n"
+			"SenderCompID=SERVER\n"
+			"TargetCompID=CLIENT\n"
+			"[SESSION]\n"
+			"ConnectionType=initiator\n"
+			"SenderCompID=CLIENT\n"
+			"TargetCompID=SERVER\n"
+			"HeartBtInt=30\n"
+			"AsyncSendQueueSize=4\n" % (port, port))
+		file.close()
+		self.path = file.name
+
+		self.settings = fix.SessionSettings(self.path)
+		self.factory = fix.MemoryStoreFactory()
+		self.acceptorApplication = CountingApplication()
+		self.initiatorApplication = CountingApplication()
+		self.acceptor = fix.ThreadedSocketAcceptor(self.acceptorApplication, self.factory, self.settings)
+		self.initiator = fix.ThreadedSocketInitiator(self.initiatorApplication, self.factory, self.settings)
+		self.acceptor.start()
+		self.initiator.start()
+		self.sessionID = fix.SessionID("FIX.4.2", "CLIENT", "SERVER")
+
+	def tearDown(self):
+		self.initiator.stop()
+		self.acceptor.stop()
+		# the destructors join the session threads, which take the GIL
+		del self.initiator
+		del self.acceptor
+		os.remove(self.path)
+
+	def waitFor(self, condition):
+		start = time.time()
+		while not condition() and time.time() - start < 10:
+			time.sleep(0.01)
+		return condition()
+
+	def test_sendAsync(self):
+		self.assertTrue(self.waitFor(self.initiator.isLoggedOn))
+		session = fix.Session.lookupSession(self.sessionID)
+		self.assertEqual(4, session.getAsyncSendQueueSize())
+
+		# the sender thread calls toApp, so a full queue only drains while
+		# sendAsync and waitForSend let go of the GIL
+		count = 100
+		ticket = 0
+		for i in range(count):
+			message = fix42.NewOrderSingle(
+				fix.ClOrdID(str(i)), fix.HandlInst('1'), fix.Symbol("LNUX"),
+				fix.Side(fix.Side_BUY), fix.TransactTime(), fix.OrdType(fix.OrdType_MARKET))
+			ticket = session.sendAsync(message)
+			self.assertTrue(ticket != 0)
+
+		self.assertTrue(session.waitForSend(ticket, 10))
+		self.assertEqual(count, self.initiatorApplication.toAppCount)
+		self.assertTrue(self.waitFor(lambda: self.acceptorApplication.fromAppCount == count))
+
+if __name__ == '__main__':
+	unittest.main()
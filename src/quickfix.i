@@ -7,6 +7,7 @@
 %include exception.i
 %include carrays.i
 %include std_unique_ptr.i
+%include stdint.i
 
 %feature("director") FIX::Application;
 %feature("classic") FIX::Exception;
@@ -16,6 +17,14 @@
 %ignore _REENTRANT;
 %rename(SocketInitiatorBase) FIX::SocketInitiator;
 %rename(SocketAcceptorBase) FIX::SocketAcceptor;
+#ifdef SWIGPYTHON
+%rename(ThreadedSocketInitiatorBase) FIX::ThreadedSocketInitiator;
+%rename(ThreadedSocketAcceptorBase) FIX::ThreadedSocketAcceptor;
+%rename(SSLSocketInitiatorBase) FIX::SSLSocketInitiator;
+%rename(SSLSocketAcceptorBase) FIX::SSLSocketAcceptor;
+%rename(ThreadedSSLSocketInitiatorBase) FIX::ThreadedSSLSocketInitiator;
+%rename(ThreadedSSLSocketAcceptorBase) FIX::ThreadedSSLSocketAcceptor;
+#endif
 
 %{
 #include <config.h>
@@ -39,6 +48,14 @@
 #include <SocketInitiator.h>
 #include <Acceptor.h>
 #include <SocketAcceptor.h>
+#ifdef SWIGPYTHON
+#include <ThreadedSocketInitiator.h>
+#include <ThreadedSocketAcceptor.h>
+#include <SSLSocketInitiator.h>
+#include <SSLSocketAcceptor.h>
+#include <ThreadedSSLSocketInitiator.h>
+#include <ThreadedSSLSocketAcceptor.h>
+#endif
 #include <DataDictionary.h>
 typedef FIX::UtcTimeStamp UtcTimeStamp;
 typedef FIX::UtcDate UtcDate;
@@ -165,4 +182,14 @@ typedef FIX::DOMDocumentPtr DOMDocumentPtr;
 %include "../C++/SocketInitiator.h"
 %include "../C++/Acceptor.h"
 %include "../C++/SocketAcceptor.h"
+// only Python subclasses the threaded and SSL classes so far
+#ifdef SWIGPYTHON
+%include "../C++/ThreadedSocketInitiator.h"
+%include "../C++/ThreadedSocketAcceptor.h"
+// the SSL classes are only wrapped when SWIG is given HAVE_SSL
+%include "../C++/SSLSocketInitiator.h"
+%include "../C++/SSLSocketAcceptor.h"
+%include "../C++/ThreadedSSLSocketInitiator.h"
+%include "../C++/ThreadedSSLSocketAcceptor.h"
+#endif
 %include "../C++/DataDictionary.h"
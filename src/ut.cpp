@@ -35,17 +35,24 @@
 #include <FileStoreFactoryTestCase.cpp>
 #include <FileStoreTestCase.cpp>
 #include <FileUtilitiesTestCase.cpp>
+#include <FlyweightTestCase.cpp>
 #include <HttpMessageTestCase.cpp>
 #include <HttpParserTestCase.cpp>
+#include <LatencyHistogramTestCase.cpp>
+#include <MarketDataColumnsTestCase.cpp>
 #include <MemoryStoreTestCase.cpp>
 #include <MessageSortersTestCase.cpp>
 #include <MessagesTestCase.cpp>
+#include <MpscQueueTestCase.cpp>
 #include <MySQLStoreTestCase.cpp>
 #include <NullStoreTestCase.cpp>
 #include <OdbcStoreTestCase.cpp>
 #include <ParserTestCase.cpp>
+#include <PostgreSQLLogTestCase.cpp>
 #include <PostgreSQLStoreTestCase.cpp>
+#include <SequenceBufferTestCase.cpp>
 #include <SessionIDTestCase.cpp>
+#include <SessionMetricsTestCase.cpp>
 #include <SessionSettingsTestCase.cpp>
 #include <SessionTestCase.cpp>
 #include <SessionFactoryTestCase.cpp>
@@ -54,7 +61,10 @@
 #include <SocketConnectorTestCase.cpp>
 #include <SocketServerTestCase.cpp>
 #include <TestHelper.cpp>
+#include <SpscQueueTestCase.cpp>
+#include <ThreadUtilitiesTestCase.cpp>
 #include <TimeRangeTestCase.cpp>
+#include <TimerWheelTestCase.cpp>
 #include <UtcTimeOnlyTestCase.cpp>
 #include <UtcTimeStampTestCase.cpp>
 #endif
@@ -0,0 +1,10 @@
+#!/bin/sh
+
+export PYTHONPATH=../lib/python3
+
+DIR=`pwd`
+
+python3 ../src/pt.py $1 20000
+RESULT=$?
+cd $DIR
+exit $RESULT